@@ -0,0 +1,19 @@
+################################################################################
+# nmea-default.profile
+#
+# u-blox 7/8: the factory NMEA set (GGA, GLL, GSA, GSV, RMC, VTG) with ZDA off
+# and GLONASS on.  Undoes zda-only.profile.
+#
+# Usage: ntpgps-shm-writer --profile nmea-default <device>
+#
+################################################################################
+PORT UBX+NMEA
+CFG-GNSS numTrkChUse=22 GPS=on,4,255 SBAS=on,1,3 QZSS=on,0,3 GLONASS=on,8,255
+CFG-MSG GGA on
+CFG-MSG GLL on
+CFG-MSG GSA on
+CFG-MSG GSV on
+CFG-MSG RMC on
+CFG-MSG VTG on
+CFG-MSG ZDA off
+PORT NMEA
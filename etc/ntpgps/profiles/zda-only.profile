@@ -0,0 +1,25 @@
+################################################################################
+# zda-only.profile
+#
+# u-blox 7/8: ZDA on every port, all other NMEA and $GPTXT off, GLONASS off.
+# Same settings as ntpgps-shm-writer --ublox-zda-only.
+#
+# Usage: ntpgps-shm-writer --profile zda-only <device>
+#
+################################################################################
+PORT UBX+NMEA
+CFG-INF NMEA off
+CFG-MSG ZDA i2c=1 uart1=1 uart2=1 usb=1 spi=1
+CFG-GNSS numTrkChUse=22 GPS=on,4,255 SBAS=on,1,3 QZSS=on,0,3 GLONASS=off,8,255
+CFG-MSG GGA off
+CFG-MSG GLL off
+CFG-MSG GSA off
+CFG-MSG GSV off
+CFG-MSG RMC off
+CFG-MSG VTG off
+CFG-MSG GRS off
+CFG-MSG GST off
+CFG-MSG GBS off
+CFG-MSG DTM off
+CFG-MSG GNS off
+PORT NMEA
@@ -179,7 +179,7 @@ compile_shm_writer() {
     mkdir -vp "$SCRIPT_DIR/bin"
     if [ ! -f "$bin" ] || [ "$bin" -ot "$src" ]; then
         echo "[*] Compiling ntpgps-shm-writer..."
-        gcc -std=c11 -O2 -Wall "$src" -o "$bin" -latomic -pthread
+        gcc -std=c11 -O2 -Wall "$src" -o "$bin" -latomic -pthread -lm
 
         echo "[*] ntpgps-shm-writer compiled successfully."
     else
@@ -258,6 +258,8 @@ files=(
     "644 etc/ntpgps/template/keys.conf /etc/ntpgps/template"
     "644 etc/ntpgps/template/ntpgps.conf /etc/ntpgps/template"
     "644 etc/ntpgps/template/99-ntpgps-usb.rules /etc/ntpgps/template"
+    "644 etc/ntpgps/profiles/zda-only.profile /etc/ntpgps/profiles"
+    "644 etc/ntpgps/profiles/nmea-default.profile /etc/ntpgps/profiles"
     "644 etc/modules-load.d/ntpgps-pps.conf /etc/modules-load.d"
     "644 etc/systemd/system/ntpgps-configure@.service /etc/systemd/system"
     "644 etc/systemd/system/ntpgps-shm-writer@.service /etc/systemd/system"
@@ -0,0 +1,292 @@
+#ifndef GPS_RECORD_H
+#define GPS_RECORD_H
+/*******************************************************************************
+ gps_record.h
+
+ Raw capture of what the receiver sent (--record FILE).
+
+ Every read() chunk from the GPS device is appended to FILE as a record:
+ the bytes, preceded by the CLOCK_MONOTONIC and CLOCK_REALTIME time they
+ were read at.  The file is preallocated to its full size and mapped, so
+ appending is a memcpy() into the page cache with no system call; the
+ kernel writes the pages back, also if the writer crashes.  When a record
+ does not fit, FILE is renamed to FILE.1 (replacing an older FILE.1) and
+ a fresh FILE is started, so a capture takes at most twice its size.  A
+ FILE left by an earlier run (e.g. one that crashed and was restarted) is
+ moved to FILE.1 the same way before recording starts.  The rotation,
+ with its fallocate() and mmap() of the new file, runs on the GPS read
+ path; the read it happens on is already timestamped.
+
+ File layout (little-endian):
+   gps_record_file_t      header, 'magic' written last
+   gps_record_hdr_t       record header, 'len' bytes of data follow,
+   uint8_t data[len]      padded to a multiple of 8
+   ...
+   len == 0               end of the log (the rest of the file is zeros)
+
+ A cleanly closed file is truncated after its last record.  --replay reads
+ it back through gps_record_reader_open() and gps_record_next().
+
+ Example (reader side):
+   test/gps-record-dump.py /var/tmp/gps.rec
+   test/gps-record-dump.py --raw /var/tmp/gps.rec >gps.raw
+
+ Copyright (C) 2025 Richard Elwell
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*******************************************************************************/
+#include <errno.h>
+#include <fcntl.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define GPS_RECORD_MAGIC        0x4e475243  /* "NGRC" */
+#define GPS_RECORD_VERSION      1
+#define GPS_RECORD_SIZE_DEFAULT (16u << 20) /* bytes per file */
+#define GPS_RECORD_SIZE_MIN     (64u << 10)
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t hdr_size;          // sizeof(gps_record_file_t), records start here
+    uint64_t size;              // file size as preallocated
+    uint64_t start_mono_ns;     // when the file was started
+    uint64_t start_real_ns;
+    char     device[32];        // e.g. "ttyACM0"
+} gps_record_file_t;
+
+typedef struct {
+    uint32_t len;               // data bytes following, 0 ends the log
+    uint32_t flags;             // reserved, 0
+    uint64_t mono_ns;           // CLOCK_MONOTONIC at read()
+    uint64_t real_ns;           // CLOCK_REALTIME at read()
+} gps_record_hdr_t;
+
+_Static_assert(sizeof(gps_record_file_t) == 64, "gps_record_file_t is part of the file format");
+_Static_assert(sizeof(gps_record_hdr_t) == 24, "gps_record_hdr_t is part of the file format");
+
+typedef struct {
+    const char *path;
+    char     device[32];
+    size_t   size;
+    uint8_t *map;               // NULL when not recording
+    size_t   pos;               // next record
+    uint64_t records, bytes, rotations;
+} gps_record_t;
+
+static inline uint64_t gps_record_ns(clockid_t clk)
+{
+    struct timespec ts;
+    clock_gettime(clk, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+// Move rec->path to rec->path.1, replacing an older one
+static void gps_record_rotate(gps_record_t *rec)
+{
+    char old[4096];
+    snprintf(old, sizeof(old), "%s.1", rec->path);
+    if (rename(rec->path, old) < 0)
+        perror("rename record");
+}
+
+// Map a fresh, fully allocated file at rec->path.  Returns 0 or -1.
+static int gps_record_start(gps_record_t *rec)
+{
+    int fd = open(rec->path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        perror("open record");
+        return -1;
+    }
+    // allocate the blocks now, so that a full disk fails here rather than
+    // as SIGBUS on a store into the mapping
+    int err = posix_fallocate(fd, 0, (off_t)rec->size);
+    if (err != 0) {
+        fprintf(stderr, "posix_fallocate record: %s\n", strerror(err));
+        close(fd);
+        return -1;
+    }
+    void *p = mmap(NULL, rec->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) {
+        perror("mmap record");
+        return -1;
+    }
+    rec->map = p;
+
+    gps_record_file_t *h = p;
+    h->version = GPS_RECORD_VERSION;
+    h->hdr_size = sizeof(*h);
+    h->size = rec->size;
+    h->start_mono_ns = gps_record_ns(CLOCK_MONOTONIC);
+    h->start_real_ns = gps_record_ns(CLOCK_REALTIME);
+    memcpy(h->device, rec->device, sizeof(h->device));
+    atomic_thread_fence(memory_order_release);
+    h->magic = GPS_RECORD_MAGIC;    // header complete
+    rec->pos = sizeof(*h);
+    return 0;
+}
+
+// Unmap the current file, trimmed after its last record
+static void gps_record_finish(gps_record_t *rec)
+{
+    if (!rec->map)
+        return;
+    munmap(rec->map, rec->size);
+    rec->map = NULL;
+    if (truncate(rec->path, (off_t)rec->pos) < 0)
+        perror("truncate record");
+}
+
+/*
+ * gps_record_open()
+ * -----------------
+ * Starts recording to 'path', 'size' bytes per file (GPS_RECORD_SIZE_MIN
+ * at least).  'device' is noted in the file header.  Returns 0, or -1
+ * with the reason printed.
+ */
+static int gps_record_open(gps_record_t *rec, const char *path, size_t size, const char *device)
+{
+    memset(rec, 0, sizeof(*rec));
+    rec->path = path;
+    rec->size = size < GPS_RECORD_SIZE_MIN ? GPS_RECORD_SIZE_MIN : (size + 7) & ~(size_t)7;
+    snprintf(rec->device, sizeof(rec->device), "%s", device);
+
+    // keep what an earlier run captured, the crash it was restarted after
+    struct stat st;
+    if (stat(path, &st) == 0 && st.st_size > 0)
+        gps_record_rotate(rec);
+    return gps_record_start(rec);
+}
+
+static void gps_record_close(gps_record_t *rec)
+{
+    gps_record_finish(rec);
+}
+
+/*
+ * gps_record_write()
+ * ------------------
+ * Appends one read() chunk with the times it was read at.  Rotates to a
+ * new file when it does not fit; if that fails, recording stops.
+ */
+static void gps_record_write(gps_record_t *rec, uint64_t mono_ns, const struct timespec *real,
+                             const uint8_t *data, size_t len)
+{
+    if (!rec->map || len == 0)
+        return;
+    size_t need = sizeof(gps_record_hdr_t) + ((len + 7) & ~(size_t)7);
+    if (need > rec->size - sizeof(gps_record_file_t))
+        return;     // never fits; read() chunks are far smaller
+    if (rec->pos + need + sizeof(uint32_t) > rec->size) {
+        gps_record_finish(rec);
+        gps_record_rotate(rec);
+        rec->rotations++;
+        if (gps_record_start(rec) < 0)
+            return;
+    }
+
+    gps_record_hdr_t *h = (gps_record_hdr_t *)(rec->map + rec->pos);
+    memcpy(h + 1, data, len);
+    h->flags = 0;
+    h->mono_ns = mono_ns;
+    h->real_ns = (uint64_t)real->tv_sec * 1000000000u + (uint64_t)real->tv_nsec;
+    // 'len' last: a reader of the live file sees the record whole or not at all
+    atomic_thread_fence(memory_order_release);
+    h->len = (uint32_t)len;
+    rec->pos += need;
+    rec->records++;
+    rec->bytes += len;
+}
+
+// Reading a capture back (--replay), mapped read-only
+typedef struct {
+    const char    *path;
+    const uint8_t *map;
+    size_t         size;        // of the file, which may still be growing
+    size_t         pos;         // next record
+    gps_record_file_t hdr;
+} gps_record_reader_t;
+
+/*
+ * gps_record_reader_open()
+ * ------------------------
+ * Maps 'path' and checks its header.  Returns 0, or -1 with the reason
+ * printed.
+ */
+static int gps_record_reader_open(gps_record_reader_t *rd, const char *path)
+{
+    memset(rd, 0, sizeof(*rd));
+    rd->path = path;
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        perror(path);
+        return -1;
+    }
+    off_t size = lseek(fd, 0, SEEK_END);
+    if (size < (off_t)sizeof(gps_record_file_t)) {
+        fprintf(stderr, "%s: too short for a gps record file\n", path);
+        close(fd);
+        return -1;
+    }
+    void *p = mmap(NULL, (size_t)size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) {
+        perror("mmap record");
+        return -1;
+    }
+    rd->map = p;
+    rd->size = (size_t)size;
+    memcpy(&rd->hdr, p, sizeof(rd->hdr));
+    if (rd->hdr.magic != GPS_RECORD_MAGIC || rd->hdr.version != GPS_RECORD_VERSION ||
+        rd->hdr.hdr_size < sizeof(rd->hdr) || rd->hdr.hdr_size > rd->size) {
+        fprintf(stderr, "%s: not a gps record file (version %u)\n", path, GPS_RECORD_VERSION);
+        munmap(p, rd->size);
+        rd->map = NULL;
+        return -1;
+    }
+    rd->pos = rd->hdr.hdr_size;
+    return 0;
+}
+
+// Next record, its data following it, or NULL at the end of the log
+static const gps_record_hdr_t *gps_record_next(gps_record_reader_t *rd)
+{
+    if (!rd->map || rd->pos + sizeof(gps_record_hdr_t) > rd->size)
+        return NULL;
+    const gps_record_hdr_t *h = (const gps_record_hdr_t *)(rd->map + rd->pos);
+    uint32_t len = h->len;
+    atomic_thread_fence(memory_order_acquire);  // pairs with gps_record_write()
+    size_t need = sizeof(*h) + (((size_t)len + 7) & ~(size_t)7);
+    if (len == 0 || rd->pos + sizeof(*h) + len > rd->size)
+        return NULL;
+    rd->pos += need;
+    return h;
+}
+
+static void gps_record_reader_close(gps_record_reader_t *rd)
+{
+    if (rd->map)
+        munmap((void *)rd->map, rd->size);
+    rd->map = NULL;
+}
+
+#endif // GPS_RECORD_H
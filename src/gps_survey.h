@@ -0,0 +1,215 @@
+#ifndef GPS_SURVEY_H
+#define GPS_SURVEY_H
+/*******************************************************************************
+ gps_survey.h
+
+ Host-side position survey for a stationary receiver.
+
+ Each position fix (GGA, or UBX-NAV-PVT) is converted to WGS84 ECEF and
+ then to east/north/up metres around the first fix, and a streaming
+ (Welford) mean and variance is kept per axis.  No fixes are stored, so a
+ survey of any length takes constant memory and stays numerically stable.
+
+ The survey has converged once it has run for its minimum duration and the
+ accuracy of the mean, sqrt((var_e + var_n + var_u) / n), is within the
+ limit.  Successive fixes are strongly correlated, so this figure is
+ optimistic for short surveys; the minimum duration is what covers the
+ slow multipath and ionospheric wander.
+
+ gps_survey_ecef() returns the mean as ECEF metres, ready for
+ UBX-CFG-TMODE2 or the CFG-TMODE-ECEF_* keys.
+
+ Copyright (C) 2025 Richard Elwell
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*******************************************************************************/
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// WGS84 ellipsoid
+#define GPS_WGS84_A     6378137.0
+#define GPS_WGS84_F     (1.0 / 298.257223563)
+#define GPS_WGS84_E2    (GPS_WGS84_F * (2.0 - GPS_WGS84_F))
+
+#define GPS_DEG2RAD(d)  ((d) * (M_PI / 180.0))
+#define GPS_RAD2DEG(r)  ((r) * (180.0 / M_PI))
+
+typedef struct {
+    uint64_t n;                 // fixes added
+    double ref[3];              // ECEF of the first fix [m]
+    double sin_lat, cos_lat;    // ENU rotation at the first fix
+    double sin_lon, cos_lon;
+    double mean[3];             // east, north, up from ref [m]
+    double m2[3];               // sums of squared deviations from the mean
+    double resid[3];            // last fix minus the mean before it [m]
+} gps_survey_t;
+
+static inline void gps_survey_reset(gps_survey_t *s)
+{
+    memset(s, 0, sizeof(*s));
+}
+
+// Geodetic latitude/longitude [deg] and ellipsoidal height [m] to ECEF [m]
+static inline void gps_llh_to_ecef(double lat_deg, double lon_deg, double h, double xyz[3])
+{
+    double lat = GPS_DEG2RAD(lat_deg), lon = GPS_DEG2RAD(lon_deg);
+    double sl = sin(lat), cl = cos(lat);
+    double n = GPS_WGS84_A / sqrt(1.0 - GPS_WGS84_E2 * sl * sl);
+    xyz[0] = (n + h) * cl * cos(lon);
+    xyz[1] = (n + h) * cl * sin(lon);
+    xyz[2] = (n * (1.0 - GPS_WGS84_E2) + h) * sl;
+}
+
+// Inverse of gps_llh_to_ecef(); a few iterations reach sub-millimetre
+static inline void gps_ecef_to_llh(const double xyz[3], double *lat_deg, double *lon_deg, double *h)
+{
+    double p = hypot(xyz[0], xyz[1]);
+    double lat = atan2(xyz[2], p * (1.0 - GPS_WGS84_E2));
+    double alt = 0.0;
+    for (int i = 0; i < 5; i++) {
+        double sl = sin(lat);
+        double n = GPS_WGS84_A / sqrt(1.0 - GPS_WGS84_E2 * sl * sl);
+        alt = p / cos(lat) - n;
+        lat = atan2(xyz[2], p * (1.0 - GPS_WGS84_E2 * n / (n + alt)));
+    }
+    *lat_deg = GPS_RAD2DEG(lat);
+    *lon_deg = GPS_RAD2DEG(atan2(xyz[1], xyz[0]));
+    *h = alt;
+}
+
+// Add one fix given as ECEF [m]
+static inline void gps_survey_add_ecef(gps_survey_t *s, const double xyz[3])
+{
+    if (s->n == 0) {
+        double lat, lon, h;
+        memcpy(s->ref, xyz, sizeof(s->ref));
+        gps_ecef_to_llh(xyz, &lat, &lon, &h);
+        s->sin_lat = sin(GPS_DEG2RAD(lat));
+        s->cos_lat = cos(GPS_DEG2RAD(lat));
+        s->sin_lon = sin(GPS_DEG2RAD(lon));
+        s->cos_lon = cos(GPS_DEG2RAD(lon));
+    }
+
+    double dx = xyz[0] - s->ref[0], dy = xyz[1] - s->ref[1], dz = xyz[2] - s->ref[2];
+    double enu[3] = {
+        -s->sin_lon * dx + s->cos_lon * dy,
+        -s->sin_lat * s->cos_lon * dx - s->sin_lat * s->sin_lon * dy + s->cos_lat * dz,
+         s->cos_lat * s->cos_lon * dx + s->cos_lat * s->sin_lon * dy + s->sin_lat * dz,
+    };
+
+    s->n++;
+    for (int i = 0; i < 3; i++) {
+        double d = enu[i] - s->mean[i];
+        s->resid[i] = d;
+        s->mean[i] += d / (double)s->n;
+        s->m2[i] += d * (enu[i] - s->mean[i]);
+    }
+}
+
+static inline void gps_survey_add_llh(gps_survey_t *s, double lat_deg, double lon_deg, double h)
+{
+    double xyz[3];
+    gps_llh_to_ecef(lat_deg, lon_deg, h, xyz);
+    gps_survey_add_ecef(s, xyz);
+}
+
+// Sample standard deviation of axis 0 = east, 1 = north, 2 = up [m]
+static inline double gps_survey_sigma(const gps_survey_t *s, int axis)
+{
+    return s->n > 1 ? sqrt(s->m2[axis] / (double)(s->n - 1)) : 0.0;
+}
+
+// 3D accuracy of the mean [m]; infinite until there are two fixes
+static inline double gps_survey_mean_acc(const gps_survey_t *s)
+{
+    if (s->n < 2)
+        return INFINITY;
+    double var = (s->m2[0] + s->m2[1] + s->m2[2]) / (double)(s->n - 1);
+    return sqrt(var / (double)s->n);
+}
+
+// The mean position as ECEF [m]
+static inline void gps_survey_ecef(const gps_survey_t *s, double xyz[3])
+{
+    const double *m = s->mean;
+    xyz[0] = s->ref[0] - s->sin_lon * m[0] - s->sin_lat * s->cos_lon * m[1] + s->cos_lat * s->cos_lon * m[2];
+    xyz[1] = s->ref[1] + s->cos_lon * m[0] - s->sin_lat * s->sin_lon * m[1] + s->cos_lat * s->sin_lon * m[2];
+    xyz[2] = s->ref[2] + s->cos_lat * m[1] + s->sin_lat * m[2];
+}
+
+// NMEA ddmm.mmmm / dddmm.mmmm plus hemisphere to signed degrees
+static inline int gps_nmea_degrees(const char *field, const char *hemi, double *deg)
+{
+    char *end;
+    double v = strtod(field, &end);
+    if (end == field || (*hemi != 'N' && *hemi != 'S' && *hemi != 'E' && *hemi != 'W'))
+        return -1;
+    double d = floor(v / 100.0);
+    *deg = d + (v - d * 100.0) / 60.0;
+    if (*hemi == 'S' || *hemi == 'W')
+        *deg = -*deg;
+    return 0;
+}
+
+/*
+ * gps_nmea_gga_position()
+ * -----------------------
+ * Position of a $xxGGA sentence: latitude and longitude [deg] and the
+ * ellipsoidal height [m], i.e. altitude above mean sea level plus the geoid
+ * separation.  Returns the fix quality field (0 = no fix), or -1 if the
+ * line is not a GGA sentence, its checksum is wrong or a field is missing.
+ */
+static int gps_nmea_gga_position(const char *line, double *lat, double *lon, double *h)
+{
+    if (line[0] != '$' || strncmp(&line[3], "GGA,", 4) != 0)
+        return -1;
+
+    uint8_t cs = 0;
+    const char *c = &line[1];
+    for (; *c && *c != '*'; c++)
+        cs ^= (uint8_t)*c;
+    if (*c != '*' || strtoul(c + 1, NULL, 16) != cs)
+        return -1;
+
+    // split the comma separated fields in place, empty fields kept
+    char buf[128];
+    const char *f[15] = {0};
+    size_t nf = 0;
+    strncpy(buf, line, sizeof(buf) - 1);
+    buf[sizeof(buf) - 1] = '\0';
+    char *star = strchr(buf, '*');
+    if (star)
+        *star = '\0';
+    for (char *p = buf; p && nf < 15; nf++) {
+        f[nf] = p;
+        p = strchr(p, ',');
+        if (p)
+            *p++ = '\0';
+    }
+    if (nf < 12 || !*f[6])
+        return -1;
+
+    int quality = atoi(f[6]);
+    if (quality == 0)
+        return 0;
+    if (gps_nmea_degrees(f[2], f[3], lat) != 0 || gps_nmea_degrees(f[4], f[5], lon) != 0 || !*f[9])
+        return -1;
+    *h = strtod(f[9], NULL) + strtod(f[11], NULL);
+    return quality;
+}
+
+#endif // GPS_SURVEY_H
@@ -0,0 +1,230 @@
+#ifndef GPS_VENDOR_H
+#define GPS_VENDOR_H
+/*******************************************************************************
+ gps_vendor.h
+
+ Receiver families other than u-blox and the NMEA command sets used to
+ configure them.
+
+ The family is recognised from what the receiver sends:
+   $PUBX, $GxTXT "u-blox", any UBX frame    u-blox
+   $PMTK (e.g. $PMTK705 firmware reply)     MediaTek (MTK) and MTK-based modules
+   $PQTM, $PAIR                             Quectel LC29H/LC76G family
+   $PSRF                                    SiRF
+ A receiver that emits none of these is left alone as a generic NMEA source.
+
+ gps_vendor_probe[] lists the version queries sent once when the passive
+ output is not conclusive; each family answers its own query and ignores
+ the others.
+
+ gps_vendor_nmea_config() builds the sentences that select one of three
+ output sets, with checksums and CR/LF, ready for a single write():
+   GPS_NMEA_ZDA_ONLY   ZDA alone
+   GPS_NMEA_TIME       RMC (fix status) and ZDA (full date)
+   GPS_NMEA_DEFAULT    the vendor's power-on set
+
+ Copyright (C) 2025 Richard Elwell
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <strings.h>
+
+typedef enum {
+    GPS_FAMILY_NMEA = 0,        // unidentified, NMEA output only
+    GPS_FAMILY_UBLOX,
+    GPS_FAMILY_MTK,
+    GPS_FAMILY_QUECTEL,
+    GPS_FAMILY_SIRF,
+    GPS_FAMILY_COUNT
+} gps_family_t;
+
+typedef enum {
+    GPS_NMEA_ZDA_ONLY = 0,
+    GPS_NMEA_TIME,
+    GPS_NMEA_DEFAULT
+} gps_nmea_set_t;
+
+static const char * const gps_family_names[GPS_FAMILY_COUNT] = {
+    "nmea", "ublox", "mtk", "quectel", "sirf"
+};
+
+static inline const char *gps_family_name(gps_family_t family)
+{
+    return (family >= 0 && family < GPS_FAMILY_COUNT) ? gps_family_names[family] : "?";
+}
+
+// Inverse of gps_family_name(), case-insensitive.  Returns -1 if unknown.
+static inline int gps_family_parse(const char *name)
+{
+    for (int i = 0; i < GPS_FAMILY_COUNT; i++)
+        if (strcasecmp(name, gps_family_names[i]) == 0)
+            return i;
+    return -1;
+}
+
+// Family an NMEA line identifies, or GPS_FAMILY_NMEA if it says nothing
+static gps_family_t gps_family_from_nmea(const char *line)
+{
+    if (line[0] != '$')
+        return GPS_FAMILY_NMEA;
+    if (strncmp(line, "$PUBX,", 6) == 0)
+        return GPS_FAMILY_UBLOX;
+    if (strncmp(line, "$PMTK", 5) == 0)
+        return GPS_FAMILY_MTK;
+    if (strncmp(line, "$PQTM", 5) == 0 || strncmp(line, "$PAIR", 5) == 0)
+        return GPS_FAMILY_QUECTEL;
+    if (strncmp(line, "$PSRF", 5) == 0)
+        return GPS_FAMILY_SIRF;
+
+    // u-blox announces itself in a TXT sentence at power-on; the length
+    // check keeps &line[3] inside a line as short as "$G"
+    if (strlen(line) >= 7 && strncmp(&line[3], "TXT,", 4) == 0 && strstr(line, "u-blox"))
+        return GPS_FAMILY_UBLOX;
+    return GPS_FAMILY_NMEA;
+}
+
+// Version queries, one per family with an NMEA command interface
+static const char * const gps_vendor_probe[] = {
+    "PMTK605",                  // MTK: $PMTK705 firmware release
+    "PQTMVERNO",                // Quectel: $PQTMVERNO version string
+    "PSRF125",                  // SiRF: $PSRFTXT version text
+};
+
+// Append "$<body>*<checksum>\r\n" to 'buf' at 'len'.  Returns the new length,
+// or 'size' if it does not fit.
+static size_t gps_nmea_append(char *buf, size_t len, size_t size, const char *body)
+{
+    uint8_t cs = 0;
+    for (const char *c = body; *c; c++)
+        cs ^= (uint8_t)*c;
+    if (len >= size)
+        return size;
+    int n = snprintf(&buf[len], size - len, "$%s*%02X\r\n", body, cs);
+    return (n < 0 || (size_t)n >= size - len) ? size : len + (size_t)n;
+}
+
+// Sentence numbers in each vendor's rate command
+static const struct {
+    const char *name;
+    uint8_t mtk;                // field of PMTK314
+    uint8_t pair;               // type of PAIR062
+    uint8_t sirf;               // message of PSRF103
+    bool    vendor_default;     // on after power-on
+} gps_vendor_nmea[] = {
+    { "GGA",  3, 0, 0, true  },
+    { "GLL",  0, 1, 1, true  },
+    { "GSA",  4, 2, 2, true  },
+    { "GSV",  5, 3, 3, true  },
+    { "RMC",  1, 4, 4, true  },
+    { "VTG",  2, 5, 5, true  },
+    { "ZDA", 17, 6, 8, false },
+};
+
+#define GPS_MTK_PMTK314_FIELDS 19
+
+static bool gps_vendor_nmea_on(size_t i, gps_nmea_set_t set)
+{
+    const char *name = gps_vendor_nmea[i].name;
+    switch (set) {
+    case GPS_NMEA_ZDA_ONLY: return strcmp(name, "ZDA") == 0;
+    case GPS_NMEA_TIME:     return strcmp(name, "ZDA") == 0 || strcmp(name, "RMC") == 0;
+    default:                return gps_vendor_nmea[i].vendor_default;
+    }
+}
+
+/*
+ * gps_vendor_nmea_config()
+ * ------------------------
+ * Writes the sentences selecting 'set' on a 'family' receiver into 'buf'.
+ * Returns the number of bytes, 0 if the family has no command set, or
+ * 'size' if 'buf' is too small.  *acks receives the number of command
+ * acknowledgements to expect ($PMTK001 / $PAIR001; SiRF sends none).
+ */
+static size_t gps_vendor_nmea_config(gps_family_t family, gps_nmea_set_t set,
+                                     char *buf, size_t size, int *acks)
+{
+    const size_t count = sizeof(gps_vendor_nmea) / sizeof(gps_vendor_nmea[0]);
+    char body[80];
+    size_t len = 0;
+    *acks = 0;
+
+    switch (family) {
+    case GPS_FAMILY_MTK:
+        if (set == GPS_NMEA_DEFAULT) {
+            len = gps_nmea_append(buf, len, size, "PMTK314,-1");
+        } else {
+            // one sentence sets every rate; unlisted fields stay off
+            uint8_t rate[GPS_MTK_PMTK314_FIELDS] = {0};
+            for (size_t i = 0; i < count; i++)
+                rate[gps_vendor_nmea[i].mtk] = gps_vendor_nmea_on(i, set);
+            int n = snprintf(body, sizeof(body), "PMTK314");
+            for (int f = 0; f < GPS_MTK_PMTK314_FIELDS; f++)
+                n += snprintf(&body[n], sizeof(body) - n, ",%u", rate[f]);
+            len = gps_nmea_append(buf, len, size, body);
+        }
+        *acks = 1;
+        break;
+
+    case GPS_FAMILY_QUECTEL:
+        for (size_t i = 0; i < count; i++) {
+            snprintf(body, sizeof(body), "PAIR062,%u,%d", gps_vendor_nmea[i].pair,
+                     gps_vendor_nmea_on(i, set));
+            len = gps_nmea_append(buf, len, size, body);
+        }
+        *acks = (int)count;
+        break;
+
+    case GPS_FAMILY_SIRF:
+        for (size_t i = 0; i < count; i++) {
+            snprintf(body, sizeof(body), "PSRF103,%02u,00,%02d,01", gps_vendor_nmea[i].sirf,
+                     gps_vendor_nmea_on(i, set));
+            len = gps_nmea_append(buf, len, size, body);
+        }
+        break;
+
+    default:
+        return 0;
+    }
+    return len;
+}
+
+/*
+ * gps_vendor_ack()
+ * ----------------
+ * Classifies an NMEA line as a command acknowledgement from 'family':
+ * 1 = accepted, -1 = rejected, 0 = not an acknowledgement.
+ *   $PMTK001,<cmd>,<flag>     flag 3 = success
+ *   $PAIR001,<cmd>,<result>   result 0 = success
+ */
+static int gps_vendor_ack(gps_family_t family, const char *line)
+{
+    const char *prefix = family == GPS_FAMILY_MTK     ? "$PMTK001," :
+                         family == GPS_FAMILY_QUECTEL ? "$PAIR001," : NULL;
+    if (!prefix || strncmp(line, prefix, 9) != 0)
+        return 0;
+
+    const char *flag = strchr(&line[9], ',');
+    if (!flag)
+        return 0;
+    long v = strtol(flag + 1, NULL, 10);
+    return (family == GPS_FAMILY_MTK ? v == 3 : v == 0) ? 1 : -1;
+}
+
+#endif // GPS_VENDOR_H
@@ -23,6 +23,7 @@
 #include <termios.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdarg.h>
@@ -37,49 +38,52 @@
 #include <sys/shm.h>
 #include <sys/socket.h>
 #include <sys/un.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/select.h>
+#include <sys/mman.h>
+#include <sys/eventfd.h>
 #include <pthread.h>
 #include <signal.h>
 #include <time.h>
 #include "ubx_defs.h"
 #include "ubx_disassemble.h"
-
-
+#include "shm_stats.h"
+#include "shm_metrics.h"
+#include "shm_watch.h"
+#include "ubx_profile.h"
+#include "ubx_valcfg.h"
+#include "gps_vendor.h"
+#include "gps_survey.h"
+#include "trace_ring.h"
+#include "gps_record.h"
+
+// NMEA lines and filtered-out frames met while waiting for a UBX reply
+static void ubx_parser_nmea_line(const char *line);
+static void ubx_parser_skipped(const uint8_t *raw, size_t len);
+#define UBX_PARSER_ON_NMEA(p, line) ubx_parser_nmea_line(line)
+#define UBX_PARSER_ON_SKIP(p)       ubx_parser_skipped((p)->raw, (p)->length)
+#include "ubx_parser.h"
+
+
+// TRACE stores a binary record in the calling thread's trace ring
+// (trace_ring.h); the trace thread formats it onto stderr.  TRACE_UBX
+// records a UBX frame, which is disassembled there as well.
 #ifdef DEBUG_TRACE
-  #define TRACE(fmt, ...) \
-    do { \
-        pthread_mutex_lock(&trace_mutex); \
-        fprintf(stderr, fmt, ##__VA_ARGS__); \
-        pthread_mutex_unlock(&trace_mutex); \
-    } while (0)
+  #define TRACE(fmt, ...) TRACE_RECORD(fmt, ##__VA_ARGS__)
+  #define TRACE_UBX(prefix, frame, len) TRACE_RECORD_UBX(prefix, frame, len)
 #else
   #define TRACE(fmt, ...) \
     do { \
-        if (atomic_load(&debug_trace)) { \
-            pthread_mutex_lock(&trace_mutex); \
-            fprintf(stderr, fmt, ##__VA_ARGS__); \
-            pthread_mutex_unlock(&trace_mutex); \
-        } \
-    } while (0)
-#endif
-
-#ifdef DEBUG_TRACE
-  #define TRACE_CALL(cmd) \
-    do { \
-        pthread_mutex_lock(&trace_mutex); \
-        cmd; \
-        pthread_mutex_unlock(&trace_mutex); \
+        if (atomic_load(&debug_trace)) \
+            TRACE_RECORD(fmt, ##__VA_ARGS__); \
     } while (0)
-#else
-  #define TRACE_CALL(cmd) \
+  #define TRACE_UBX(prefix, frame, len) \
     do { \
-        if (atomic_load(&debug_trace)) { \
-            pthread_mutex_lock(&trace_mutex); \
-            cmd; \
-            pthread_mutex_unlock(&trace_mutex); \
-        } \
+        if (atomic_load(&debug_trace)) \
+            TRACE_RECORD_UBX(prefix, frame, len); \
     } while (0)
 #endif
 
@@ -135,11 +139,17 @@ enum nmea_filter_t {
 };
 
 ubx_mon_ver_payload_t mon_ver = {0};
+uint8_t ubx_unique_id[6];       // SEC-UNIQID chip id, protocol 18 and up
+size_t ubx_unique_id_len = 0;   // 0 = not reported
 ubx_cfg_prt_t cfg_prt = {0};
+bool cfg_prt_valid = false;     // cfg_prt holds a real CFG-PRT answer
 
 #define SOCKET_DIR "/run/ntpgps"
 const char socket_dir[] = SOCKET_DIR;
 const char socket_path_fmt[] = SOCKET_DIR"/shmwriter%d.sock";
+const char stats_path_fmt[] = SOCKET_DIR"/shmwriter%d.stats";
+const char ubxcfg_path_fmt[] = SOCKET_DIR"/shmwriter%d.ubxcfg";
+const char baud_path_fmt[] = SOCKET_DIR"/shmwriter%d.baud";
 
 //const char date_seed_dir_default[] = "/var/lib/ntpgps";
 const char date_seed_dir_default[] = "/run/ntpgps";
@@ -158,29 +168,126 @@ time_t   gpsstart_seconds = 0;  // GPS UTC seconds at that moment
 uint64_t ticklatest_ns = 0;     // monotonic timestamp in nanoseconds of latest GPS fix
 time_t   gpslatest_seconds = 0; // latest GPS UTC seconds
 static char sock_path[108];
+static char stats_path[108];
 int require_valid_nmea = 0; // for RMC,GLL,GGA
+int nmea_data_invalid = 0;  // status field of the last parsed RMC,GLL,GGA
 int ublox_zda_only = 0;
+int force_config = 0;           // 1 = send the whole profile, ignore the cache
+int persist_config = 0;         // 1 = save the profile to BBR/flash once applied
+const char *profile_name = NULL;        // --profile, replaces the built-in lists
+static ubx_profile_t ubx_profile;       // frames compiled from the profile file
+static const ubx_entry_t *profile_list = NULL;
+static atomic_int ubx_valcfg_mode = 0;  // 1 = receiver is configured with CFG-VALSET/VALGET
+int pps_config = 0;              // 1 = --pps-* given, configure timepulse 1
+uint32_t pps_width_us = 100000;  // --pps-width, pulse length once locked
+uint32_t pps_period_us = 1000000;
+int pps_utc = 0;                 // 1 = timepulse on the UTC grid instead of GPS time
+uint32_t nav_rate_ms = 0;        // --nav-rate, 0 = leave the receiver's rate alone
+int ubx_timeout_ms = 500;        // --ubx-timeout, reply deadline once a frame has been sent
+int ubx_attempts = 3;            // --ubx-retries, attempts per frame
+int ubx_backoff_ms = 20;         // --ubx-backoff, pause before attempt n is (n-1) times this
+int health_interval_s = 30;      // --health-interval, 0 = no receiver health polls
+int jam_limit = 0;               // --jam-limit, 0 = trust the receiver's own jamming state
+uint32_t utc_tacc_max_ns = 0;    // --utc-valid, 0 = no UBX-NAV-TIMEUTC gate
+int survey_min_s = 0;            // --survey, minimum survey duration; 0 = no position survey
+double survey_acc_m = 2.0;       // --survey-acc, accuracy the surveyed mean must reach [m]
+int receiver_opt = -1;           // --receiver, -1 = probe for the family
+static atomic_int receiver_family = GPS_FAMILY_NMEA;   // gps_family_t, set by gps_init()
 unsigned nmea_filter_mask = 0;  // 0 = accept all
 struct termios orig_tio = {0};
+int serial_raw = 0;             // 1 = we own the tty settings
+int serial_baud = 9600;          // receiver UART1 and tty rate; SETBAUD changes it, see read_serial_baud()
+
+// The SHM gate (ntpgps_stats_t.health_gate), set from health polls and NAV-TIMEUTC
+static void health_set_gate(uint32_t mask, uint32_t bits);
+static void utc_report(const uint8_t *payload, size_t len);
+
+// Receiver changes queued by SETZDAONLY/SETBAUD and carried out by the GPS
+// thread between sentences (guarded by shared_state_mutex)
+static atomic_int reconfig_pending = 0;
+static int pending_zda_only = -1;       // -1 = no change
+static int pending_baud = 0;            // 0 = no change
+static const char *reconfig_state = "idle";
+
+// Position survey (--survey), fed from GGA or NAV-PVT in the GPS thread
+// (guarded by shared_state_mutex)
+typedef enum {
+    SURVEY_OFF = 0,
+    SURVEY_RUNNING,             // collecting fixes
+    SURVEY_CONVERGED,           // position ready, not yet sent to the receiver
+    SURVEY_FIXED,               // receiver in fixed-position timing mode
+    SURVEY_STORED               // receiver has no fixed-position mode, position kept only
+} survey_state_t;
+
+typedef enum { SURVEY_SRC_NONE = 0, SURVEY_SRC_GGA, SURVEY_SRC_NAV_PVT, SURVEY_SRC_FILE } survey_source_t;
+
+static const char * const survey_state_names[] = { "off", "running", "converged", "fixed", "stored" };
+static const char * const survey_source_names[] = { "none", "gga", "nav-pvt", "file" };
+
+static struct {
+    gps_survey_t    s;
+    survey_state_t  state;
+    survey_source_t source;     // where the fixes or the position come from
+    uint64_t start_ns, last_ns; // CLOCK_MONOTONIC of the first and last fix
+    double   pos[3];            // surveyed or stored position, ECEF [m]
+    double   acc;               // accuracy of the mean [m]
+} survey;
+static atomic_int survey_push_pending = 0;      // pos[] waits to go to the receiver
+static atomic_int survey_restart_pending = 0;   // RESTARTSURVEY
+
+// UBX passthrough transactions queued by the UBX command and run by the GPS
+// thread in its own serial session (guarded by shared_state_mutex)
+#define UBX_TXN_QUEUE       4
+#define UBX_TXN_RESULT_SIZE 4608    // two disassembled frames plus prefixes
+
+typedef enum { UBX_TXN_FREE = 0, UBX_TXN_QUEUED, UBX_TXN_RUNNING, UBX_TXN_DONE } ubx_txn_state_t;
+
+struct control_client;
+struct ubx_txn {
+    ubx_txn_state_t state;
+    uint32_t seq;                   // FIFO order
+    struct control_client *client;  // who asked, and which connection
+    uint32_t client_gen;
+    uint8_t frame[UBX_MAX_MSG_SIZE];
+    size_t  len;
+    char    result[UBX_TXN_RESULT_SIZE];
+};
+static struct ubx_txn ubx_txns[UBX_TXN_QUEUE];
+static uint32_t ubx_txn_seq = 0;
+static atomic_int ubx_txn_queued = 0;
+static atomic_int ubx_txn_done = 0;
+static bool ubx_txn_closed = false;     // GPS thread gone, nothing would run them
 
 static atomic_int debug_trace = 0;
 static atomic_int begin_shutdown = 0;
 static atomic_int stop = 0;
-static pthread_mutex_t trace_mutex = PTHREAD_MUTEX_INITIALIZER;
 static pthread_mutex_t shared_state_mutex = PTHREAD_MUTEX_INITIALIZER;
 
-// performance counters
-atomic_uint_fast64_t loop_counter_gps = 0;
-atomic_uint_fast64_t loop_counter_socket = 0;
-uint64_t nmea_rmc_count = 0;
-uint64_t nmea_zda_count = 0;
-uint64_t nmea_zdg_count = 0;
-uint64_t nmea_gll_count = 0;
-uint64_t nmea_gga_count = 0;
-uint64_t nmea_other_count = 0;
-uint64_t nmea_badcs_count = 0;
-uint64_t shm_write_count = 0;
-uint64_t parse_nmea_fail = 0;
+// The trace thread waits here while tracing is off, rather than polling
+static pthread_mutex_t trace_wake_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t trace_wake_cond = PTHREAD_COND_INITIALIZER;
+
+static inline bool trace_enabled(void)
+{
+#ifdef DEBUG_TRACE
+    return true;
+#else
+    return atomic_load(&debug_trace);
+#endif
+}
+
+// After turning tracing on, and at shutdown
+static void trace_wake(void)
+{
+    pthread_mutex_lock(&trace_wake_mutex);
+    pthread_cond_broadcast(&trace_wake_cond);
+    pthread_mutex_unlock(&trace_wake_mutex);
+}
+
+// performance counters, mapped from /run/ntpgps/shmwriter<unit>.stats
+// (falls back to process-local memory if the stats file cannot be created)
+static ntpgps_stats_t stats_local;
+ntpgps_stats_t *stats = &stats_local;
 
 /* Check if year is a leap year */
 static inline int is_leap(const int year) {
@@ -385,29 +492,49 @@ int adjust_date_mcu(int *year, int *month, int *day,
     return 0;
 }
 
-// Get monotonic time in nanoseconds
-static inline uint64_t monotonic_now_ns(void) {
+/*
+ * Where the pipeline reads the time: the system clocks, or with --replay
+ * a virtual clock standing at the timestamps recorded with each chunk, so
+ * that a replay does not depend on when or how fast it runs.
+ */
+typedef struct {
+    uint64_t (*mono_ns)(void);                  // CLOCK_MONOTONIC in ns
+    void     (*realtime)(struct timespec *t);   // CLOCK_REALTIME
+} gps_clock_t;
+
+static uint64_t system_mono_ns(void) {
     struct timespec t;
     if (clock_gettime(CLOCK_MONOTONIC, &t) != 0) {
         return 0; // or handle error
     }
     return (uint64_t)t.tv_sec * 1000000000ULL + t.tv_nsec;
 }
+static void system_realtime(struct timespec *t) {
+    if (clock_gettime(CLOCK_REALTIME, t) != 0) {
+        t->tv_sec = 0; // or handle error
+        t->tv_nsec = 0;
+    }
+}
+static const gps_clock_t system_clock = { system_mono_ns, system_realtime };
+
+// Switched before any thread starts, never after
+static const gps_clock_t *gps_clock = &system_clock;
+
+// Get monotonic time in nanoseconds
+static inline uint64_t monotonic_now_ns(void) {
+    return gps_clock->mono_ns();
+}
 // Get monotonic time in microseconds
 static inline uint64_t monotonic_now_us(void) {
-    struct timespec t;
-    if (clock_gettime(CLOCK_MONOTONIC, &t) != 0) {
-        return 0; // or handle error
-    }
-    return (uint64_t)t.tv_sec * 1000000ULL + t.tv_nsec / 1000ULL;
+    return monotonic_now_ns() / 1000ULL;
 }
 // Get monotonic time in milliseconds
 static inline uint64_t monotonic_now_ms(void) {
-    struct timespec t;
-    if (clock_gettime(CLOCK_MONOTONIC, &t) != 0) {
-        return 0; // or handle error
-    }
-    return (uint64_t)t.tv_sec * 1000ULL + t.tv_nsec / 1000000ULL;
+    return monotonic_now_ns() / 1000000ULL;
+}
+// Get wall-clock time as a timespec
+static inline void realtime_now(struct timespec *t) {
+    gps_clock->realtime(t);
 }
 
 /**
@@ -578,7 +705,7 @@ int parse_nmea_time(const char *line, struct timespec *ts) {
         return -1;
 
     if (sum != expected) {
-        nmea_badcs_count++;
+        STAT_INC(stats, nmea_badcs_count);
         fprintf(stderr, "Checksum mismatch: got %02X need %02X\n", sum, expected);
         return -1;
     }
@@ -615,6 +742,7 @@ int parse_nmea_time(const char *line, struct timespec *ts) {
     char *time_str = NULL;
     int date_present = 0;
     int data_invalid = 0; // for RMC,GLL,GGA
+    int status_present = 0;
 
     if (strcmp(tok, "ZDA") == 0 ||
         strcmp(tok, "ZDG") == 0) {
@@ -622,8 +750,8 @@ int parse_nmea_time(const char *line, struct timespec *ts) {
         if (nmea_filter_mask && ((nmea_filter_mask & NMEA_ZDA) == 0))
             return -1;
 
-        if (tok[2] == 'A') nmea_zda_count++;
-        if (tok[2] == 'G') nmea_zdg_count++;
+        if (tok[2] == 'A') STAT_INC(stats, nmea_zda_count);
+        if (tok[2] == 'G') STAT_INC(stats, nmea_zdg_count);
         time_str = strtok_empty_r(NULL, ",", &saveptr); // hhmmss.ff
         char *day_str  = strtok_empty_r(NULL, ",", &saveptr);
         char *month_str  = strtok_empty_r(NULL, ",", &saveptr);
@@ -652,10 +780,11 @@ int parse_nmea_time(const char *line, struct timespec *ts) {
         if (nmea_filter_mask && ((nmea_filter_mask & NMEA_RMC) == 0))
             return -1;
 
-        nmea_rmc_count++;
+        STAT_INC(stats, nmea_rmc_count);
         time_str = strtok_empty_r(NULL, ",", &saveptr); // hhmmss.ff
         char *pos_stat_str = strtok_empty_r(NULL, ",", &saveptr);
         data_invalid = (pos_stat_str && strlen(pos_stat_str) == 1 && pos_stat_str[0] == 'V');
+        status_present = 1;
         strtok_empty_r(NULL, ",", &saveptr);
         strtok_empty_r(NULL, ",", &saveptr);
         strtok_empty_r(NULL, ",", &saveptr);
@@ -690,7 +819,7 @@ int parse_nmea_time(const char *line, struct timespec *ts) {
         if (nmea_filter_mask && ((nmea_filter_mask & NMEA_GLL) == 0))
             return -1;
 
-        nmea_gll_count++;
+        STAT_INC(stats, nmea_gll_count);
         // time-only line, only valid if a stored date exists
         if (stored_day == 0) 
             return -1;
@@ -701,13 +830,14 @@ int parse_nmea_time(const char *line, struct timespec *ts) {
         time_str = strtok_empty_r(NULL, ",", &saveptr); // hhmmss.ff
         char *pos_stat_str = strtok_empty_r(NULL, ",", &saveptr);
         data_invalid = (pos_stat_str && strlen(pos_stat_str) == 1 && pos_stat_str[0] == 'V');
+        status_present = 1;
     }
     else if (strcmp(tok, "GGA") == 0) {
 
         if (nmea_filter_mask && ((nmea_filter_mask & NMEA_GGA) == 0))
             return -1;
 
-        nmea_gga_count++;
+        STAT_INC(stats, nmea_gga_count);
         // time-only line, only valid if a stored date exists
         if (stored_day == 0) 
             return -1;
@@ -718,12 +848,13 @@ int parse_nmea_time(const char *line, struct timespec *ts) {
         strtok_empty_r(NULL, ",", &saveptr);
         char *fix_mode_str = strtok_empty_r(NULL, ",", &saveptr);
         data_invalid = (fix_mode_str && strlen(fix_mode_str) == 1 && fix_mode_str[0] == '0');
+        status_present = 1;
     }
     else {
         if (nmea_filter_mask)
             return -1;
 
-        nmea_other_count++;
+        STAT_INC(stats, nmea_other_count);
         TRACE(">>>>>> %s\n", line);
         return -1; // unknown line type
     }
@@ -806,6 +937,10 @@ int parse_nmea_time(const char *line, struct timespec *ts) {
         gpslatest_seconds = t;
     }
 
+    // ZDA/ZDG carry no status, so they keep the last RMC/GLL/GGA verdict
+    if (status_present)
+        nmea_data_invalid = data_invalid;
+
     // Exit here if the user has chosen to require a GPS position fix and
     // the GPS does not yet have a position fix.  This ensures high reliability
     // for valid date/time.  You definitely need a clear view of the open sky
@@ -931,6 +1066,17 @@ int trim_spaces(const char *s, const char **pbegin) {
     return (end - begin + 1);
 }
 
+// Whole decimal number within [min, max]
+static bool parse_int_arg(const char *s, long min, long max, int *out) {
+    char *end;
+    errno = 0;
+    long v = strtol(s, &end, 10);
+    if (*s == '\0' || *end != '\0' || errno || v < min || v > max)
+        return false;
+    *out = (int)v;
+    return true;
+}
+
 int parse_date(const char *input, int *year, int *month, int *day) {
     if (!input || !year || !month || !day)
         return -1;
@@ -1029,6 +1175,158 @@ int parse_time(const char *input, int *hour, int *minute, int *second) {
     return 0;
 }
 
+// Mask of the listed sentence types; '*unknown' (if given) counts the
+// tokens that are not one
+unsigned parse_nmea_filter(const char *arg, int *unknown)
+{
+    unsigned mask = 0;
+    if (unknown)
+        *unknown = 0;
+    if (!arg || !*arg)
+        return 0;
+
+    const char *p = arg;
+    while (*p) {
+        char word[8];
+        int i = 0;
+
+        // Extract token up to comma
+        while (*p && *p != ',' && i < (int)sizeof(word) - 1)
+            word[i++] = *p++;
+        word[i] = '\0';
+        if (*p == ',')
+            p++;
+
+        // Uppercase for robustness
+        for (int j = 0; word[j]; j++)
+            word[j] = toupper((unsigned char)word[j]);
+
+        if      (strcmp(word, "RMC") == 0) mask |= NMEA_RMC;
+        else if (strcmp(word, "GGA") == 0) mask |= NMEA_GGA;
+        else if (strcmp(word, "GLL") == 0) mask |= NMEA_GLL;
+        else if (strcmp(word, "ZDA") == 0) mask |= NMEA_ZDA;
+        else {
+            fprintf(stderr, "Unknown NMEA filter type: %s\n", word);
+            if (unknown)
+                (*unknown)++;
+        }
+    }
+
+    return mask;
+}
+
+// Inverse of parse_nmea_filter(), e.g. "RMC,ZDA" or "ALL"
+void format_nmea_filter(unsigned mask, char *buf, size_t size)
+{
+    static const struct { unsigned bit; const char *name; } names[] = {
+        { NMEA_RMC, "RMC" }, { NMEA_GGA, "GGA" }, { NMEA_GLL, "GLL" }, { NMEA_ZDA, "ZDA" },
+    };
+
+    size_t len = 0;
+    buf[0] = '\0';
+    if (mask == 0) {
+        snprintf(buf, size, "ALL");
+        return;
+    }
+    for (size_t i = 0; i < SIZEOF(names); i++) {
+        if ((mask & names[i].bit) && len < size)
+            len += snprintf(buf + len, size - len, "%s%s", len ? "," : "", names[i].name);
+    }
+}
+
+/*
+ * parse_ubx_hex()
+ * ---------------
+ * Converts the argument of the UBX command into a frame.  Bytes are hex
+ * pairs, optionally separated by spaces, commas or colons.  Input starting
+ * with B5 62 must be a complete frame with a valid length and checksum;
+ * anything else is taken as class, id and payload and framed here.
+ *
+ * Returns the frame length, or 0 with *err set.
+ */
+size_t parse_ubx_hex(const char *s, uint8_t *out, size_t size, const char **err)
+{
+    uint8_t raw[UBX_MAX_MSG_SIZE];
+    size_t n = 0;
+
+    while (*s) {
+        if (isspace((unsigned char)*s) || *s == ',' || *s == ':') {
+            s++;
+            continue;
+        }
+        if (!isxdigit((unsigned char)s[0]) || !isxdigit((unsigned char)s[1])) {
+            *err = "bad hex";
+            return 0;
+        }
+        if (n == sizeof(raw)) {
+            *err = "too long";
+            return 0;
+        }
+        unsigned byte;
+        sscanf(s, "%2x", &byte);
+        raw[n++] = (uint8_t)byte;
+        s += 2;
+    }
+
+    if (n >= 2 && raw[0] == UBX_SYNC1 && raw[1] == UBX_SYNC2) {
+        if (n < UBX_MIN_MSG_SIZE || n != UBX_MIN_MSG_SIZE + (raw[4] | (raw[5] << 8))) {
+            *err = "bad length";
+            return 0;
+        }
+        size_t len = ubx_frame_build(out, size, raw[2], raw[3], &raw[6], n - UBX_MIN_MSG_SIZE);
+        if (len == 0 || out[len - 2] != raw[n - 2] || out[len - 1] != raw[n - 1]) {
+            *err = "bad checksum";
+            return 0;
+        }
+        return len;
+    }
+
+    if (n < 2) {
+        *err = "need class and id";
+        return 0;
+    }
+    size_t len = ubx_frame_build(out, size, raw[0], raw[1], &raw[2], n - 2);
+    if (len == 0)
+        *err = "too long";
+    return len;
+}
+
+// Receiver health values as GETHEALTH and the trace print them
+static const char *health_gate_text(uint32_t gate)
+{
+    static const char * const text[8] = { "none", "jamming", "antenna", "jamming,antenna",
+                                          "utc", "jamming,utc", "antenna,utc", "jamming,antenna,utc" };
+    return text[gate & (NTPGPS_HEALTH_JAMMING | NTPGPS_HEALTH_ANTENNA | NTPGPS_HEALTH_UTC)];
+}
+
+static const char *jamming_state_text(uint32_t state)
+{
+    static const char * const text[4] = { "unknown", "ok", "warning", "critical" };
+    return text[state & 3];
+}
+
+static const char *antenna_status_text(uint32_t status)
+{
+    static const char * const text[5] = { "init", "unknown", "ok", "short", "open" };
+    return status < SIZEOF(text) ? text[status] : "?";
+}
+
+// Supported SETBAUD rates; B0 = unsupported
+static speed_t baud_to_speed(int baud)
+{
+    switch (baud) {
+    case 4800:   return B4800;
+    case 9600:   return B9600;
+    case 19200:  return B19200;
+    case 38400:  return B38400;
+    case 57600:  return B57600;
+    case 115200: return B115200;
+    case 230400: return B230400;
+    case 460800: return B460800;
+    default:     return B0;
+    }
+}
+
 void write_printf(int fd, const char *fmt, ...) {
     char buf[512];   // adjust size as needed
     va_list args;
@@ -1042,13 +1340,67 @@ void write_printf(int fd, const char *fmt, ...) {
     }
 }
 
-int update_stored_date_from_command(const char *input, int client_fd) {
+// Write the whole buffer, retrying on short writes
+int write_all(int fd, const char *buf, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, buf, len);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+        buf += n;
+        len -= n;
+    }
+    return 0;
+}
+
+#define MAX_CMD_LEN 1024         // room for "UBX" plus a few hundred hex bytes
+#define MAX_CLIENTS 16
+#define CLIENT_OUTBUF_SIZE  (NTPGPS_METRICS_BUFSIZE * 2)
+#define CLIENT_OUT_RESERVE  (NTPGPS_METRICS_BUFSIZE + 1024)  // worst-case single response
+
+// --- Control socket client ---
+struct control_client {
+    int    fd;                      // -1 = slot unused
+    uint32_t gen;                   // bumped on every accept
+    char   in[MAX_CMD_LEN];         // partial command line
+    size_t in_len;
+    bool   in_overflow;             // discarding an over-long line
+    bool   eof;                     // peer closed its write side
+    char   out[CLIENT_OUTBUF_SIZE]; // queued responses
+    size_t out_len;
+    int    watch;                   // WATCH_MODE_*
+    uint32_t watch_next;            // next watch ring record to send
+    uint32_t watch_dropped;         // records lost since the last DROPPED event
+    uint64_t watch_progress_ms;     // last time the subscriber took any output
+    bool   ubx_wait;                // UBX transaction outstanding
+};
+
+enum { WATCH_MODE_OFF = 0, WATCH_MODE_TEXT, WATCH_MODE_BINARY };
+
+// Queue formatted output for a client, truncating if the buffer is full
+void client_printf(struct control_client *client, const char *fmt, ...) {
+    size_t room = sizeof(client->out) - client->out_len;
+    if (room <= 1)
+        return;
+
+    va_list args;
+    va_start(args, fmt);
+    int len = vsnprintf(client->out + client->out_len, room, fmt, args);
+    va_end(args);
+
+    if (len > 0)
+        client->out_len += ((size_t)len < room) ? (size_t)len : room - 1;
+}
+
+int update_stored_date_from_command(const char *input, struct control_client *client) {
     if (!input)
         return -1;
     int result = 0;
 
     if (stored_date_source == 1) { // Stored date is NMEA
-        write_printf(client_fd, 
+        client_printf(client, 
                      "ERROR: date locked (NMEA:%04d-%02d-%02d)\n", 
                      stored_year, 
                      stored_month, 
@@ -1062,16 +1414,17 @@ int update_stored_date_from_command(const char *input, int client_fd) {
             stored_year = yy;
             stored_month = mm;
             stored_day = dd;
-            write_printf(client_fd, "UPDATED:%04d-%02d-%02d\n", stored_year, stored_month, stored_day);
+            client_printf(client, "UPDATED:%04d-%02d-%02d\n", stored_year, stored_month, stored_day);
         }
         else {
-            write_printf(client_fd, "ERROR:%s\n", input);
+            client_printf(client, "ERROR:%s\n", input);
         }
     }
     return result;
 }
 
-#define MAX_CMD_LEN 128
+// Preallocated so that scrapes never allocate (socket thread only)
+static char metrics_buf[NTPGPS_METRICS_BUFSIZE];
 
 static int setup_unix_socket(int unit)
 {
@@ -1115,6 +1468,160 @@ static int setup_unix_socket(int unit)
     return listen_fd;
 }
 
+/*
+ * setup_stats_file()
+ * ------------------
+ * Creates /run/ntpgps/shmwriter<unit>.stats and maps it as the live counter
+ * block (see shm_stats.h).  Returns the mapping, or the process-local block
+ * if the file could not be created, so counters keep working either way.
+ */
+static ntpgps_stats_t *setup_stats_file(int unit)
+{
+    ntpgps_stats_t *st = &stats_local;
+
+    snprintf(stats_path, sizeof(stats_path), stats_path_fmt, unit);
+    unlink(stats_path);  // readers holding the old file keep their mapping
+
+    int fd = open(stats_path, O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0) {
+        perror("open stats");
+        stats_path[0] = '\0';
+    } else if (ftruncate(fd, sizeof(ntpgps_stats_t)) < 0) {
+        perror("ftruncate stats");
+        close(fd);
+        unlink(stats_path);
+        stats_path[0] = '\0';
+    } else {
+        void *p = mmap(NULL, sizeof(ntpgps_stats_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if (p == MAP_FAILED) {
+            perror("mmap stats");
+            unlink(stats_path);
+            stats_path[0] = '\0';
+        } else {
+            st = p;
+        }
+    }
+
+    memset(st, 0, sizeof(*st));
+    st->version = NTPGPS_STATS_VERSION;
+    st->size = sizeof(ntpgps_stats_t);
+    st->unit = unit;
+    st->pid = getpid();
+    st->start_mono_ns = monotonic_now_ns();
+    atomic_thread_fence(memory_order_release);
+    st->magic = NTPGPS_STATS_MAGIC;  // header complete
+
+    if (stats_path[0] != '\0')
+        TRACE("Statistics exported to %s\n", stats_path);
+    return st;
+}
+
+static void cleanup_stats_file(void)
+{
+    if (stats != &stats_local) {
+        munmap(stats, sizeof(ntpgps_stats_t));
+        stats = &stats_local;
+    }
+    if (stats_path[0] != '\0') {
+        if (unlink(stats_path) == 0) {
+            TRACE("Removed stats: %s\n", stats_path);
+        } else if (errno != ENOENT) {
+            perror("unlink");
+        }
+    }
+}
+
+// eventfd the GPS thread uses to wake the socket thread when it has
+// something for clients (watch records, UBX transaction results)
+static int socket_wake_fd = -1;
+
+static void wake_socket_thread(void)
+{
+    uint64_t one = 1;
+    if (socket_wake_fd >= 0 && write(socket_wake_fd, &one, sizeof(one)) < 0 && errno != EAGAIN)
+        perror("eventfd write");
+}
+
+// --- WATCH ring ---
+// The GPS thread appends samples and events here; the socket thread copies
+// them to subscribers.  Both sides hold shared_state_mutex, which the GPS
+// thread already owns while it publishes, so a subscriber never makes the
+// publisher wait on a socket.
+#define WATCH_RING_SIZE     256     // records, power of two
+#define WATCH_RECORD_ROOM   NTPGPS_WATCH_TEXT_MAX
+#define WATCH_STALL_MS      30000   // drop a subscriber that reads nothing for this long
+
+static ntpgps_watch_record_t watch_ring[WATCH_RING_SIZE];
+static uint32_t watch_head = 0;             // records published so far
+static atomic_int watch_subscribers = 0;
+
+// Called with shared_state_mutex held
+static void watch_publish(const ntpgps_watch_record_t *r)
+{
+    if (atomic_load(&watch_subscribers) == 0)
+        return;  // nobody listening, skip the wakeup
+
+    watch_ring[watch_head & (WATCH_RING_SIZE - 1)] = *r;
+    watch_head++;
+    wake_socket_thread();
+}
+
+// Called with shared_state_mutex held
+static void watch_event(ntpgps_watch_type_t type, int32_t arg)
+{
+    ntpgps_watch_record_t r = { .type = type, .arg = arg };
+    watch_publish(&r);
+}
+
+// Publish the last-sample block and update the latency histograms
+static void record_sample(const char *line, const struct timespec *ts,
+                          const struct timespec *rx_rt, uint64_t rx_mono_ns)
+{
+    static uint64_t prev_write_ns = 0;
+    uint64_t now_ns = monotonic_now_ns();
+    ntpgps_sample_t *s = &stats->last;
+
+    int32_t sentence = 0;
+    if (strlen(line) >= 6)
+        sentence = line[3] | (line[4] << 8) | (line[5] << 16);
+
+    int64_t offset_ns = ((int64_t)rx_rt->tv_sec - (int64_t)ts->tv_sec) * 1000000000LL +
+                        ((int64_t)rx_rt->tv_nsec - (int64_t)ts->tv_nsec);
+
+    uint32_t seq = atomic_load_explicit(&s->seq, memory_order_relaxed);
+    atomic_store_explicit(&s->seq, seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&s->valid, nmea_data_invalid ? 0 : 1, memory_order_relaxed);
+    atomic_store_explicit(&s->gps_sec, ts->tv_sec, memory_order_relaxed);
+    atomic_store_explicit(&s->gps_nsec, ts->tv_nsec, memory_order_relaxed);
+    atomic_store_explicit(&s->sentence, sentence, memory_order_relaxed);
+    atomic_store_explicit(&s->recv_sec, rx_rt->tv_sec, memory_order_relaxed);
+    atomic_store_explicit(&s->recv_nsec, rx_rt->tv_nsec, memory_order_relaxed);
+    atomic_store_explicit(&s->recv_mono_ns, rx_mono_ns, memory_order_relaxed);
+    atomic_store_explicit(&s->offset_ns, offset_ns, memory_order_relaxed);
+    atomic_store_explicit(&s->seq, seq + 2, memory_order_release);
+
+    ntpgps_offset_add(&stats->offset, offset_ns);
+    ntpgps_hist_add(&stats->publish_latency, now_ns - rx_mono_ns);
+    if (prev_write_ns)
+        ntpgps_hist_add(&stats->sample_interval, now_ns - prev_write_ns);
+    prev_write_ns = now_ns;
+
+    ntpgps_watch_record_t r = {
+        .type      = WATCH_SAMPLE,
+        .valid     = nmea_data_invalid ? 0 : 1,
+        .gps_sec   = ts->tv_sec,
+        .gps_nsec  = ts->tv_nsec,
+        .recv_sec  = rx_rt->tv_sec,
+        .recv_nsec = rx_rt->tv_nsec,
+        .offset_ns = offset_ns,
+    };
+    if (strlen(line) >= 6)
+        memcpy(r.sentence, line + 3, 3);
+    watch_publish(&r);
+}
+
 static void cleanup_unix_socket(void)
 {
     if (sock_path[0] != '\0') {
@@ -1140,22 +1647,99 @@ static int starts_with(const char *buf, const char *prefix) {
     return strncmp(buf, prefix, len) == 0;
 }
 
+/*
+ * setup_metrics_socket()
+ * ----------------------
+ * Opens a TCP listener on 127.0.0.1:<port> that serves the OpenMetrics text
+ * over plain HTTP, e.g.:
+ *     curl http://127.0.0.1:9120/metrics
+ */
+static int setup_metrics_socket(int port)
+{
+    struct sockaddr_in addr;
+
+    int listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+        perror("socket");
+        return -1;
+    }
+
+    int one = 1;
+    setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    if (bind(listen_fd, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+        perror("bind");
+        close(listen_fd);
+        return -1;
+    }
+
+    if (listen(listen_fd, 5) < 0) {
+        perror("listen");
+        close(listen_fd);
+        return -1;
+    }
+
+    // Set non-blocking mode
+    int flags = fcntl(listen_fd, F_GETFL, 0);
+    fcntl(listen_fd, F_SETFL, flags | O_NONBLOCK);
+
+    printf("Serving metrics on http://127.0.0.1:%d/metrics\n", port);
+    return listen_fd;
+}
+
+// Answer one HTTP scrape and close the connection
+static void handle_metrics_client(int client_fd)
+{
+    char req[256] = {0};
+
+    // don't let a silent client hold up the socket thread
+    struct timeval tv = {1, 0};
+    setsockopt(client_fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    setsockopt(client_fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+
+    ssize_t len = read(client_fd, req, sizeof(req) - 1);
+    if (len > 0) {
+        if (starts_with(req, "GET /metrics ") || starts_with(req, "GET / ")) {
+            size_t mlen = ntpgps_render_openmetrics(stats, metrics_buf, sizeof(metrics_buf));
+            write_printf(client_fd,
+                         "HTTP/1.0 200 OK\r\n"
+                         "Content-Type: " NTPGPS_METRICS_CONTENT_TYPE "\r\n"
+                         "Content-Length: %zu\r\n"
+                         "Connection: close\r\n\r\n", mlen);
+            write_all(client_fd, metrics_buf, mlen);
+        } else {
+            write_printf(client_fd,
+                         "HTTP/1.0 404 Not Found\r\n"
+                         "Content-Length: 0\r\n"
+                         "Connection: close\r\n\r\n");
+        }
+    }
+
+    close(client_fd);
+}
+
 /*
  * handle_client_command()
  * ------------------------
- * Handles a single command received from a connected UNIX domain socket client.
+ * Handles a single command line received from a UNIX domain socket client.
  *
- * This function is called whenever a client connects to the SHM writer’s control socket,
- * typically located at:
+ * This function is called by the control server for each complete line read
+ * from a client of the SHM writer’s control socket, typically located at:
  *     /run/ntpgps/shmwriter<unit>.sock
  *
  * Commands are sent as simple text lines terminated by newline.
  * Example usage from the shell:
  *     echo SHOWCOUNTERS | sudo socat -t1 - UNIX-CONNECT:/run/ntpgps/shmwriter120.sock
  *
- * The function reads one command line, trims any trailing newline, and executes
- * the associated action.  After responding to the client (if applicable),
- * the socket is closed.
+ * Clients may keep the connection open and send any number of commands, one
+ * per line; responses are returned in order.  The function trims any trailing
+ * newline and executes the associated action, queuing the response in the
+ * client's output buffer.
  *
  * Supported commands:
  *   SETDATE YYYY-MM-DD      - Manually sets stored date (used if GPS date is invalid)
@@ -1167,119 +1751,478 @@ static int starts_with(const char *buf, const char *prefix) {
  *   SETTRACEOFF             - Disables debug tracing
  *   GETTRACE                - Returns current trace mode
  *   SHOWCOUNTERS            - Prints counters for GPS, socket, and NMEA activity
+ *   METRICS                 - Prints all counters and histograms in OpenMetrics format
  *   RESETCOUNTERS           - Resets all counters to zero
+ *   SETFILTER MSG[,MSG...]  - Only process the given NMEA sentence types (or ALL)
+ *   SETZDAONLY ON|OFF       - Queues ZDA-only / default NMEA configuration of the receiver
+ *   SETBAUD RATE            - Queues a receiver and serial port baud rate change
+ *   GETCONFIG               - Returns the active filter, receiver and serial settings
+ *   GETHEALTH               - Returns the last receiver health poll and NAV-TIMEUTC
+ *                             results and the SHM gate
+ *   GETSURVEY               - Returns the position survey state and the surveyed position
+ *   RESTARTSURVEY           - Queues a new survey, dropping the stored position
+ *   UBX HEX...              - Sends a UBX frame (or class, id, payload) to the
+ *                             receiver and returns the ACK/NAK or poll response
+ *   VALGET [LAYER] KEY...   - Reads configuration items of a generation 9+
+ *                             receiver (LAYER is RAM, BBR, FLASH or DEFAULT)
+ *   VALSET [LAYERS] KEY=VAL...
+ *                           - Writes configuration items in one CFG-VALSET
+ *                             (LAYERS is e.g. RAM or RAM,BBR,FLASH)
+ *   WATCH [TEXT|BINARY]     - Streams every SHM sample and event (see shm_watch.h)
+ *   UNWATCH                 - Stops a text WATCH stream
  *   SHUTDOWN                - Signals the main loop to begin a clean shutdown
  *
  * Unknown commands return an error message of the form:
  *     ERROR:<command>
  *
  * Parameters:
- *   client_fd  - File descriptor for the connected client socket.
+ *   client  - Connected client; responses are queued in client->out.
+ *   buf     - NUL-terminated command line (modified in place).
  *
  * Notes:
- *   - The function is designed for single-command, short-lived client connections.
+ *   - Called with shared_state_mutex held.
  *   - Atomic variables are used for counters and shutdown signaling.
- *   - Output is written back to the client using write_printf().
+ *   - Output is queued with client_printf() and flushed by the server loop.
  */
-static void handle_client_command(int client_fd)
+// Free UBX transaction slot, or NULL (with an error sent) if the queue is full
+static struct ubx_txn *ubx_txn_alloc(struct control_client *client)
 {
-    char buf[MAX_CMD_LEN] = {0};
-    ssize_t len = read(client_fd, buf, sizeof(buf) - 1);
-
-    if (len > 0) {
-        buf[len] = '\0';
-        trim_trailing_newline(buf);
-
-        printf("Received command: [%s]\n", buf);
+    if (ubx_txn_closed) {
+        client_printf(client, "ERROR:GPS thread not running\n");
+        return NULL;
+    }
+    for (int i = 0; i < UBX_TXN_QUEUE; i++) {
+        if (ubx_txns[i].state == UBX_TXN_FREE)
+            return &ubx_txns[i];
+    }
+    client_printf(client, "ERROR:UBX queue full\n");
+    return NULL;
+}
 
-        if (starts_with(buf, "SETDATE ")) {
-            const char *new_date = buf + 8;
-            if (update_stored_date_from_command(new_date, client_fd) == 0)
-                printf("Updated stored date to: %s\n", new_date);
+// Hand a filled-in transaction to the GPS thread
+static void ubx_txn_queue(struct control_client *client, struct ubx_txn *txn)
+{
+    txn->client = client;
+    txn->client_gen = client->gen;
+    txn->seq = ubx_txn_seq++;
+    txn->state = UBX_TXN_QUEUED;
+    client->ubx_wait = true;  // answered once the GPS thread is done
+    atomic_fetch_add(&ubx_txn_queued, 1);
+}
 
-        } else if (starts_with(buf, "GETDATE")) {
-            write_printf(client_fd, "%04d-%02d-%02d (%s)\n",
-                stored_year, stored_month, stored_day,
-                (stored_date_source == 1) ? "NMEA" : "User");
+static void handle_client_command(struct control_client *client, char *buf)
+{
+    trim_trailing_newline(buf);
+    if (buf[0] == '\0')
+        return;  // ignore blank lines
+
+    printf("Received command: [%s]\n", buf);
+
+    if (starts_with(buf, "SETDATE ")) {
+        const char *new_date = buf + 8;
+        int prev_date = stored_year * 10000 + stored_month * 100 + stored_day;
+        if (update_stored_date_from_command(new_date, client) == 0) {
+            printf("Updated stored date to: %s\n", new_date);
+            int date = stored_year * 10000 + stored_month * 100 + stored_day;
+            if (date != prev_date)
+                watch_event(WATCH_ROLLOVER, date);
+        }
 
-        } else if (starts_with(buf, "SETALLOWINVALID")) {
-            if (require_valid_nmea == 0) {
-                write_printf(client_fd, "OK\n");
-            } else {
-                require_valid_nmea = 0;
-                write_printf(client_fd, "UPDATED:require_valid_nmea=false\n");
-            }
+    } else if (starts_with(buf, "GETDATE")) {
+        client_printf(client, "%04d-%02d-%02d (%s)\n",
+            stored_year, stored_month, stored_day,
+            (stored_date_source == 1) ? "NMEA" : "User");
 
-        } else if (starts_with(buf, "SETREQUIREVALID")) {
-            if (require_valid_nmea == 1) {
-                write_printf(client_fd, "OK\n");
-            } else {
-                require_valid_nmea = 1;
-                write_printf(client_fd, "UPDATED:require_valid_nmea=true\n");
-            }
+    } else if (starts_with(buf, "SETALLOWINVALID")) {
+        if (require_valid_nmea == 0) {
+            client_printf(client, "OK\n");
+        } else {
+            require_valid_nmea = 0;
+            client_printf(client, "UPDATED:require_valid_nmea=false\n");
+        }
 
-        } else if (starts_with(buf, "GETVALID")) {
-            write_printf(client_fd, "UPDATED:require_valid_nmea=%s\n",
-                (require_valid_nmea == 1) ? "true" : "false");
+    } else if (starts_with(buf, "SETREQUIREVALID")) {
+        if (require_valid_nmea == 1) {
+            client_printf(client, "OK\n");
+        } else {
+            require_valid_nmea = 1;
+            client_printf(client, "UPDATED:require_valid_nmea=true\n");
+        }
 
-        } else if (starts_with(buf, "SETTRACEON")) {
-            if (debug_trace == 1) {
-                write_printf(client_fd, "OK\n");
-            } else {
-                debug_trace = 1;
-                write_printf(client_fd, "UPDATED:debug_trace=true\n");
-            }
+    } else if (starts_with(buf, "GETVALID")) {
+        client_printf(client, "UPDATED:require_valid_nmea=%s\n",
+            (require_valid_nmea == 1) ? "true" : "false");
 
-        } else if (starts_with(buf, "SETTRACEOFF")) {
-            if (debug_trace == 0) {
-                write_printf(client_fd, "OK\n");
-            } else {
-                debug_trace = 0;
-                write_printf(client_fd, "UPDATED:debug_trace=false\n");
-            }
+    } else if (starts_with(buf, "SETTRACEON")) {
+        if (debug_trace == 1) {
+            client_printf(client, "OK\n");
+        } else {
+            debug_trace = 1;
+            trace_wake();
+            client_printf(client, "UPDATED:debug_trace=true\n");
+        }
 
-        } else if (starts_with(buf, "GETTRACE")) {
-            write_printf(client_fd, "debug_trace=%s\n",
-                (debug_trace == 1) ? "true" : "false");
-
-        } else if (starts_with(buf, "SHOWCOUNTERS")) {
-            write_printf(client_fd, "GPS thread loop:    %lu\n", atomic_load(&loop_counter_gps));
-            write_printf(client_fd, "Socket thread loop: %lu\n", atomic_load(&loop_counter_socket));
-            write_printf(client_fd, "NMEA GxRMC count:   %lu\n", nmea_rmc_count);
-            write_printf(client_fd, "NMEA GxZDA count:   %lu\n", nmea_zda_count);
-            write_printf(client_fd, "NMEA GxZDG count:   %lu\n", nmea_zdg_count);
-            write_printf(client_fd, "NMEA GxGLL count:   %lu\n", nmea_gll_count);
-            write_printf(client_fd, "NMEA GxGGA count:   %lu\n", nmea_gga_count);
-            write_printf(client_fd, "NMEA OTHER count:   %lu\n", nmea_other_count);
-            write_printf(client_fd, "NMEA bad cksum:     %lu\n", nmea_badcs_count);
-            write_printf(client_fd, "SHM write count:    %lu\n", shm_write_count);
-            write_printf(client_fd, "Parse NMEA fail:    %lu\n", parse_nmea_fail);
-
-        } else if (starts_with(buf, "RESETCOUNTERS")) {
-            atomic_store(&loop_counter_gps, 0);
-            atomic_store(&loop_counter_socket, 0);
-            nmea_rmc_count = 0;
-            nmea_zda_count = 0;
-            nmea_zdg_count = 0;
-            nmea_gll_count = 0;
-            nmea_gga_count = 0;
-            nmea_other_count = 0;
-            nmea_badcs_count = 0;
-            shm_write_count = 0;
-            parse_nmea_fail = 0;
-            write_printf(client_fd, "OK\n");
-
-        } else if (starts_with(buf, "SHUTDOWN")) {
-            atomic_store(&begin_shutdown, 1);
-            write_printf(client_fd, "OK\n");
+    } else if (starts_with(buf, "SETTRACEOFF")) {
+        if (debug_trace == 0) {
+            client_printf(client, "OK\n");
+        } else {
+            debug_trace = 0;
+            client_printf(client, "UPDATED:debug_trace=false\n");
+        }
 
+    } else if (starts_with(buf, "GETTRACE")) {
+        client_printf(client, "debug_trace=%s\n",
+            (debug_trace == 1) ? "true" : "false");
+
+    } else if (starts_with(buf, "SETFILTER ")) {
+        const char *arg = buf + 10;
+        int unknown = 0;
+        unsigned mask = (strcasecmp(arg, "ALL") == 0) ? 0 : parse_nmea_filter(arg, &unknown);
+        if ((mask == 0 || unknown) && strcasecmp(arg, "ALL") != 0) {
+            client_printf(client, "ERROR:%s\n", buf);
+            return;
+        }
+        // parse_nmea_time() runs under the same mutex, so this lands between sentences
+        nmea_filter_mask = mask;
+        char names[32];
+        format_nmea_filter(mask, names, sizeof(names));
+        client_printf(client, "UPDATED:filter=%s\n", names);
+
+    } else if (starts_with(buf, "SETZDAONLY ")) {
+        const char *arg = buf + 11;
+        int on;
+        if (strcasecmp(arg, "ON") == 0)
+            on = 1;
+        else if (strcasecmp(arg, "OFF") == 0)
+            on = 0;
+        else {
+            client_printf(client, "ERROR:%s\n", buf);
+            return;
+        }
+        if (atomic_load(&receiver_family) == GPS_FAMILY_NMEA) {
+            client_printf(client, "ERROR:unidentified receiver has no command set\n");
+        } else if (on == ublox_zda_only && pending_zda_only < 0) {
+            client_printf(client, "OK\n");
         } else {
-            write_printf(client_fd, "ERROR:%s\n", buf);
+            pending_zda_only = on;
+            reconfig_state = "pending";
+            atomic_store(&reconfig_pending, 1);
+            client_printf(client, "QUEUED:zda_only=%s\n", on ? "on" : "off");
         }
-    }
 
-    close(client_fd);
-}
+    } else if (starts_with(buf, "SETBAUD ")) {
+        int baud = atoi(buf + 8);
+        if (!serial_raw) {
+            client_printf(client, "ERROR:serial port not in raw mode\n");
+        } else if (baud_to_speed(baud) == B0) {
+            client_printf(client, "ERROR:%s\n", buf);
+        } else if (baud == serial_baud && pending_baud == 0) {
+            client_printf(client, "OK\n");
+        } else {
+            pending_baud = baud;
+            reconfig_state = "pending";
+            atomic_store(&reconfig_pending, 1);
+            client_printf(client, "QUEUED:baud=%d\n", baud);
+        }
+
+    } else if (starts_with(buf, "GETCONFIG")) {
+        char names[32];
+        format_nmea_filter(nmea_filter_mask, names, sizeof(names));
+        client_printf(client, "filter=%s\n", names);
+        client_printf(client, "receiver=%s\n", gps_family_name(atomic_load(&receiver_family)));
+        client_printf(client, "zda_only=%s\n", ublox_zda_only ? "on" : "off");
+        client_printf(client, "require_valid_nmea=%s\n", require_valid_nmea ? "true" : "false");
+        client_printf(client, "raw=%s\n", serial_raw ? "on" : "off");
+        client_printf(client, "baud=%d\n", serial_baud);
+        client_printf(client, "reconfig=%s\n", reconfig_state);
+        client_printf(client, "profile=%s\n", profile_list ? ubx_profile.path : "builtin");
+        client_printf(client, "ubx_config=%s\n", atomic_load(&ubx_valcfg_mode) ? "key-value" : "legacy");
+        if (pps_config)
+            client_printf(client, "pps=width=%u,period=%u,grid=%s\n", pps_width_us, pps_period_us,
+                          pps_utc ? "UTC" : "GPS");
+        else
+            client_printf(client, "pps=receiver\n");
+        if (nav_rate_ms)
+            client_printf(client, "nav_rate=%u\n", nav_rate_ms);
+        else
+            client_printf(client, "nav_rate=receiver\n");
+        client_printf(client, "ubx_timeout=%d\n", ubx_timeout_ms);
+        client_printf(client, "ubx_retries=%d\n", ubx_attempts);
+        client_printf(client, "ubx_backoff=%d\n", ubx_backoff_ms);
+
+    } else if (starts_with(buf, "GETHEALTH")) {
+        bool ublox = atomic_load(&receiver_family) == GPS_FAMILY_UBLOX;
+        bool polls = ublox && health_interval_s != 0;
+        bool utc = ublox && utc_tacc_max_ns != 0;
+        if (!polls && !utc) {
+            client_printf(client, "health=off\n");
+            return;
+        }
+        uint64_t now_ns = monotonic_now_ns();
+        uint64_t last_ns = STAT_LOAD(stats, health_last_mono_ns);
+        client_printf(client, "health=%s\n", !polls ? "off" : last_ns ? "on" : "pending");
+        if (polls) {
+            client_printf(client, "interval=%d\n", health_interval_s);
+            client_printf(client, "polls=%lu\n", STAT_LOAD(stats, health_polls));
+            client_printf(client, "timeouts=%lu\n", STAT_LOAD(stats, health_timeouts));
+            if (last_ns)
+                client_printf(client, "last=%.1f\n", (now_ns - last_ns) / 1e9);
+        }
+        client_printf(client, "gate=%s\n", health_gate_text(STAT_LOAD(stats, health_gate)));
+        client_printf(client, "gated_samples=%lu\n", STAT_LOAD(stats, health_gated));
+        if (polls) {
+            client_printf(client, "jamming=%s\n", jamming_state_text(STAT_LOAD(stats, health_jam_state)));
+            client_printf(client, "jam_ind=%u\n", STAT_LOAD(stats, health_jam_ind));
+            client_printf(client, "jam_limit=%d\n", jam_limit);
+            client_printf(client, "antenna=%s\n", antenna_status_text(STAT_LOAD(stats, health_ant_status)));
+            client_printf(client, "noise=%u\n", STAT_LOAD(stats, health_noise));
+            client_printf(client, "agc=%u\n", STAT_LOAD(stats, health_agc));
+            client_printf(client, "tx_usage=%u\n", STAT_LOAD(stats, health_tx_usage));
+            client_printf(client, "tx_peak=%u\n", STAT_LOAD(stats, health_tx_peak));
+            client_printf(client, "rx_peak=%u\n", STAT_LOAD(stats, health_rx_peak));
+            client_printf(client, "tx_errors=%lu\n", STAT_LOAD(stats, health_tx_errors));
+        }
+        if (utc) {
+            uint64_t utc_ns = STAT_LOAD(stats, utc_last_mono_ns);
+            uint32_t valid = STAT_LOAD(stats, utc_valid);
+            client_printf(client, "utc=%s\n", utc_ns ? "on" : "pending");
+            client_printf(client, "utc_reports=%lu\n", STAT_LOAD(stats, utc_reports));
+            if (utc_ns)
+                client_printf(client, "utc_last=%.1f\n", (now_ns - utc_ns) / 1e9);
+            client_printf(client, "utc_valid=tow:%u,wkn:%u,utc:%u\n", valid & 1, (valid >> 1) & 1,
+                          (valid >> 2) & 1);
+            client_printf(client, "utc_tacc=%u\n", STAT_LOAD(stats, utc_tacc_ns));
+            client_printf(client, "utc_tacc_limit=%u\n", utc_tacc_max_ns);
+        }
+
+    } else if (starts_with(buf, "GETSURVEY")) {
+        client_printf(client, "survey=%s\n", survey_state_names[survey.state]);
+        if (survey.state == SURVEY_OFF)
+            return;
+        client_printf(client, "source=%s\n", survey_source_names[survey.source]);
+        client_printf(client, "min_duration=%d\n", survey_min_s);
+        client_printf(client, "acc_limit=%.3f\n", survey_acc_m);
+        if (survey.source != SURVEY_SRC_FILE) {
+            const gps_survey_t *sv = &survey.s;
+            client_printf(client, "samples=%llu\n", (unsigned long long)sv->n);
+            client_printf(client, "elapsed=%.1f\n", sv->n ? (survey.last_ns - survey.start_ns) / 1e9 : 0.0);
+            if (sv->n > 1) {
+                client_printf(client, "mean_acc=%.3f\n", gps_survey_mean_acc(sv));
+                client_printf(client, "sigma=e:%.3f,n:%.3f,u:%.3f\n", gps_survey_sigma(sv, 0),
+                              gps_survey_sigma(sv, 1), gps_survey_sigma(sv, 2));
+                client_printf(client, "residual=e:%.3f,n:%.3f,u:%.3f\n", sv->resid[0], sv->resid[1],
+                              sv->resid[2]);
+            }
+        }
+        double pos[3], lat, lon, h;
+        if (survey.state == SURVEY_RUNNING && survey.s.n > 0)
+            gps_survey_ecef(&survey.s, pos);
+        else if (survey.state != SURVEY_RUNNING)
+            memcpy(pos, survey.pos, sizeof(pos));
+        else
+            return;
+        gps_ecef_to_llh(pos, &lat, &lon, &h);
+        client_printf(client, "position=%.8f,%.8f,%.3f\n", lat, lon, h);
+        client_printf(client, "ecef=%.4f,%.4f,%.4f\n", pos[0], pos[1], pos[2]);
+        if (survey.state != SURVEY_RUNNING)
+            client_printf(client, "position_acc=%.3f\n", survey.acc);
+
+    } else if (starts_with(buf, "RESTARTSURVEY")) {
+        if (survey.state == SURVEY_OFF) {
+            client_printf(client, "ERROR:%s\n", buf);
+            return;
+        }
+        atomic_store(&survey_restart_pending, 1);
+        client_printf(client, "QUEUED:survey=running\n");
+
+    } else if (starts_with(buf, "SHOWCOUNTERS")) {
+        client_printf(client, "GPS thread loop:    %lu\n", STAT_LOAD(stats, loop_counter_gps));
+        client_printf(client, "Socket thread loop: %lu\n", STAT_LOAD(stats, loop_counter_socket));
+        client_printf(client, "NMEA GxRMC count:   %lu\n", STAT_LOAD(stats, nmea_rmc_count));
+        client_printf(client, "NMEA GxZDA count:   %lu\n", STAT_LOAD(stats, nmea_zda_count));
+        client_printf(client, "NMEA GxZDG count:   %lu\n", STAT_LOAD(stats, nmea_zdg_count));
+        client_printf(client, "NMEA GxGLL count:   %lu\n", STAT_LOAD(stats, nmea_gll_count));
+        client_printf(client, "NMEA GxGGA count:   %lu\n", STAT_LOAD(stats, nmea_gga_count));
+        client_printf(client, "NMEA OTHER count:   %lu\n", STAT_LOAD(stats, nmea_other_count));
+        client_printf(client, "NMEA bad cksum:     %lu\n", STAT_LOAD(stats, nmea_badcs_count));
+        client_printf(client, "SHM write count:    %lu\n", STAT_LOAD(stats, shm_write_count));
+        client_printf(client, "Parse NMEA fail:    %lu\n", STAT_LOAD(stats, parse_nmea_fail));
+        client_printf(client, "UBX config runs:    %lu\n", STAT_LOAD(stats, ubx_cfg_runs));
+        client_printf(client, "UBX config frames:  %lu\n", STAT_LOAD(stats, ubx_cfg_sent));
+        client_printf(client, "UBX config retries: %lu\n", STAT_LOAD(stats, ubx_cfg_retries));
+        client_printf(client, "UBX config NAKs:    %lu\n", STAT_LOAD(stats, ubx_cfg_naks));
+        client_printf(client, "UBX config failed:  %lu\n", STAT_LOAD(stats, ubx_cfg_failures));
+        client_printf(client, "UBX cfg unchanged:  %lu\n", STAT_LOAD(stats, ubx_cfg_unchanged));
+        client_printf(client, "UBX cfg cache hits: %lu\n", STAT_LOAD(stats, ubx_cfg_cache_hits));
+        client_printf(client, "UBX cfg saves:      %lu\n", STAT_LOAD(stats, ubx_cfg_saves));
+        client_printf(client, "UBX config time:    %.3f ms\n", STAT_LOAD(stats, ubx_cfg_last_ns) / 1e6);
+        uint64_t rtt_n = STAT_LOAD(stats, ubx_ack_rtt.count);
+        client_printf(client, "UBX reply RTT:      %lu, mean %.3f ms, max %.3f ms\n", rtt_n,
+                      rtt_n ? STAT_LOAD(stats, ubx_ack_rtt.sum_ns) / 1e6 / rtt_n : 0.0,
+                      STAT_LOAD(stats, ubx_ack_rtt.max_ns) / 1e6);
+        client_printf(client, "Health polls:       %lu\n", STAT_LOAD(stats, health_polls));
+        client_printf(client, "Health timeouts:    %lu\n", STAT_LOAD(stats, health_timeouts));
+        client_printf(client, "Health gated:       %lu\n", STAT_LOAD(stats, health_gated));
+        client_printf(client, "Health TX errors:   %lu\n", STAT_LOAD(stats, health_tx_errors));
+        client_printf(client, "UTC reports:        %lu\n", STAT_LOAD(stats, utc_reports));
+
+    } else if (starts_with(buf, "METRICS")) {
+        // render straight into the client's output buffer
+        client->out_len += ntpgps_render_openmetrics(stats, client->out + client->out_len,
+                                                     sizeof(client->out) - client->out_len);
+
+    } else if (starts_with(buf, "RESETCOUNTERS")) {
+        STAT_STORE(stats, loop_counter_gps, 0);
+        STAT_STORE(stats, loop_counter_socket, 0);
+        STAT_STORE(stats, nmea_rmc_count, 0);
+        STAT_STORE(stats, nmea_zda_count, 0);
+        STAT_STORE(stats, nmea_zdg_count, 0);
+        STAT_STORE(stats, nmea_gll_count, 0);
+        STAT_STORE(stats, nmea_gga_count, 0);
+        STAT_STORE(stats, nmea_other_count, 0);
+        STAT_STORE(stats, nmea_badcs_count, 0);
+        STAT_STORE(stats, shm_write_count, 0);
+        STAT_STORE(stats, parse_nmea_fail, 0);
+        STAT_STORE(stats, ubx_cfg_runs, 0);
+        STAT_STORE(stats, ubx_cfg_sent, 0);
+        STAT_STORE(stats, ubx_cfg_retries, 0);
+        STAT_STORE(stats, ubx_cfg_naks, 0);
+        STAT_STORE(stats, ubx_cfg_failures, 0);
+        STAT_STORE(stats, ubx_cfg_last_ns, 0);
+        STAT_STORE(stats, ubx_cfg_unchanged, 0);
+        STAT_STORE(stats, ubx_cfg_cache_hits, 0);
+        STAT_STORE(stats, ubx_cfg_saves, 0);
+        STAT_STORE(stats, health_polls, 0);
+        STAT_STORE(stats, health_timeouts, 0);
+        STAT_STORE(stats, health_gated, 0);
+        STAT_STORE(stats, health_tx_errors, 0);
+        STAT_STORE(stats, utc_reports, 0);
+        ntpgps_hist_reset(&stats->publish_latency);
+        ntpgps_hist_reset(&stats->sample_interval);
+        ntpgps_hist_reset(&stats->ubx_ack_rtt);
+        ntpgps_offset_reset(&stats->offset);
+        client_printf(client, "OK\n");
+
+    } else if (starts_with(buf, "UBX ")) {
+        struct ubx_txn *txn = ubx_txn_alloc(client);
+        if (!txn)
+            return;
+        const char *err = NULL;
+        txn->len = parse_ubx_hex(buf + 4, txn->frame, sizeof(txn->frame), &err);
+        if (txn->len == 0) {
+            client_printf(client, "ERROR:UBX %s\n", err);
+            return;
+        }
+        ubx_txn_queue(client, txn);
+
+    } else if (starts_with(buf, "VALGET ")) {
+        uint32_t keys[UBX_VALGET_MAX_KEYS];
+        size_t n = 0;
+        uint8_t layer = UBX_VALGET_RAM;
+        char *save = NULL;
+        bool first = true;
+        for (char *tok = strtok_r(buf + 7, " ", &save); tok; tok = strtok_r(NULL, " ", &save)) {
+            uint32_t key = ubx_valcfg_lookup(tok);
+            if (!key && first) {
+                first = false;
+                if (!strcasecmp(tok, "RAM"))            layer = UBX_VALGET_RAM;
+                else if (!strcasecmp(tok, "BBR"))       layer = UBX_VALGET_BBR;
+                else if (!strcasecmp(tok, "FLASH"))     layer = UBX_VALGET_FLASH;
+                else if (!strcasecmp(tok, "DEFAULT"))   layer = UBX_VALGET_DEFAULT;
+                else {
+                    client_printf(client, "ERROR:VALGET unknown key or layer: %s\n", tok);
+                    return;
+                }
+                continue;
+            }
+            first = false;
+            if (!key) {
+                client_printf(client, "ERROR:VALGET unknown key: %s\n", tok);
+                return;
+            }
+            if (n == UBX_VALGET_MAX_KEYS) {
+                client_printf(client, "ERROR:VALGET more than %d keys\n", UBX_VALGET_MAX_KEYS);
+                return;
+            }
+            keys[n++] = key;
+        }
+        if (n == 0) {
+            client_printf(client, "ERROR:VALGET no keys\n");
+            return;
+        }
+        struct ubx_txn *txn = ubx_txn_alloc(client);
+        if (!txn)
+            return;
+        txn->len = ubx_valget_build(txn->frame, sizeof(txn->frame), layer, 0, keys, n);
+        ubx_txn_queue(client, txn);
+
+    } else if (starts_with(buf, "VALSET ")) {
+        ubx_valcfg_kv_t kv[UBX_VALSET_MAX_KEYS];
+        size_t n = 0;
+        uint8_t layers = UBX_VAL_LAYER_RAM;
+        char *save = NULL;
+        char err[160];
+        for (char *tok = strtok_r(buf + 7, " ", &save); tok; tok = strtok_r(NULL, " ", &save)) {
+            if (n == 0 && !strchr(tok, '=')) {
+                layers = ubx_valcfg_parse_layers(tok);
+                if (!layers) {
+                    client_printf(client, "ERROR:VALSET unknown layers: %s\n", tok);
+                    return;
+                }
+                continue;
+            }
+            if (n == UBX_VALSET_MAX_KEYS) {
+                client_printf(client, "ERROR:VALSET more than %d keys\n", UBX_VALSET_MAX_KEYS);
+                return;
+            }
+            if (ubx_valcfg_parse(tok, &kv[n], err, sizeof(err)) != 0) {
+                client_printf(client, "ERROR:VALSET %s\n", err);
+                return;
+            }
+            n++;
+        }
+        if (n == 0) {
+            client_printf(client, "ERROR:VALSET no items\n");
+            return;
+        }
+        struct ubx_txn *txn = ubx_txn_alloc(client);
+        if (!txn)
+            return;
+        txn->len = ubx_valset_build(txn->frame, sizeof(txn->frame), layers, UBX_VALSET_TXN_NONE, kv, n);
+        ubx_txn_queue(client, txn);
+
+    } else if (starts_with(buf, "WATCH")) {
+        int mode = WATCH_MODE_TEXT;
+        if (strcmp(buf, "WATCH BINARY") == 0)
+            mode = WATCH_MODE_BINARY;
+        else if (strcmp(buf, "WATCH") != 0 && strcmp(buf, "WATCH TEXT") != 0) {
+            client_printf(client, "ERROR:%s\n", buf);
+            return;
+        }
+        if (client->watch == WATCH_MODE_OFF) {
+            atomic_fetch_add(&watch_subscribers, 1);
+            client->watch_next = watch_head;
+            client->watch_dropped = 0;
+            client->watch_progress_ms = monotonic_now_ms();
+        }
+        client->watch = mode;
+        client_printf(client, "OK\n");
+
+    } else if (starts_with(buf, "UNWATCH")) {
+        if (client->watch != WATCH_MODE_OFF) {
+            atomic_fetch_sub(&watch_subscribers, 1);
+            client->watch = WATCH_MODE_OFF;
+        }
+        client_printf(client, "OK\n");
+
+    } else if (starts_with(buf, "SHUTDOWN")) {
+        atomic_store(&begin_shutdown, 1);
+        client_printf(client, "OK\n");
+
+    } else {
+        client_printf(client, "ERROR:%s\n", buf);
+    }
+}
 
 static int read_date_seed(void) {
     FILE *f = fopen(date_seed_path, "r");
@@ -1336,6 +2279,118 @@ int write_date_seed(void) {
     return status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+ * Position survey (--survey)
+ * --------------------------
+ * A timing receiver that knows its antenna position solves for time alone,
+ * which keeps the timepulse usable down to a single satellite and removes
+ * the position noise from it.  The fixes of a stationary receiver are
+ * averaged (gps_survey.h): from GGA, or from NAV-PVT once that arrives,
+ * since it carries the ellipsoidal height directly.  After --survey seconds
+ * and with the mean within --survey-acc, the position is stored as
+ * position<unit>.seed next to the date seed and queued for the receiver.
+ * At the next start the stored position is sent straight away.
+ */
+static void survey_path(char *path, size_t size)
+{
+    snprintf(path, size, "%s/position%d.seed", date_seed_dir, stats->unit);
+}
+
+static int read_survey_seed(double pos[3], double *acc)
+{
+    char path[PATH_MAX_LEN + 32];
+    survey_path(path, sizeof(path));
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        TRACE("Position seed file '%s' not found, surveying.\n", path);
+        return -1;
+    }
+    int n = fscanf(f, "%lf %lf %lf %lf", &pos[0], &pos[1], &pos[2], acc);
+    fclose(f);
+    if (n != 4 || !isfinite(pos[0]) || !isfinite(pos[1]) || !isfinite(pos[2]) || !(*acc >= 0)) {
+        TRACE("Failed to parse position from file '%s'\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+static int write_survey_seed(const double pos[3], double acc)
+{
+    char path[PATH_MAX_LEN + 32];
+    survey_path(path, sizeof(path));
+    if (mkdir_p(date_seed_dir, 0755) != 0) {
+        TRACE("Failed to create directory %s: %s\n", date_seed_dir, strerror(errno));
+    }
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        fprintf(stderr, "Failed to write %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+    fprintf(f, "%.4f %.4f %.4f %.4f\n", pos[0], pos[1], pos[2], acc);
+    fclose(f);
+    TRACE("Updated %s\n", path);
+    return 0;
+}
+
+// Add one fix, ECEF [m], to a running survey (shared_state_mutex held)
+static void survey_add_fix(const double xyz[3], survey_source_t source)
+{
+    uint64_t now_ns = monotonic_now_ns();
+    if (survey.s.n == 0)
+        survey.start_ns = now_ns;
+    survey.last_ns = now_ns;
+    survey.source = source;
+    gps_survey_add_ecef(&survey.s, xyz);
+
+    double acc = gps_survey_mean_acc(&survey.s);
+    if (now_ns - survey.start_ns < (uint64_t)survey_min_s * 1000000000ULL || acc > survey_acc_m)
+        return;
+
+    gps_survey_ecef(&survey.s, survey.pos);
+    survey.acc = acc;
+    survey.state = SURVEY_CONVERGED;
+    atomic_store(&survey_push_pending, 1);
+    fprintf(stderr, "Position survey converged: %llu fixes, mean within %.3f m\n",
+            (unsigned long long)survey.s.n, acc);
+}
+
+// GGA sentence from capture_nmea_line() (shared_state_mutex held)
+static void survey_nmea_line(const char *line)
+{
+    if (survey.state != SURVEY_RUNNING || survey.source == SURVEY_SRC_NAV_PVT)
+        return;
+    double lat, lon, h, xyz[3];
+    if (gps_nmea_gga_position(line, &lat, &lon, &h) <= 0)
+        return;
+    gps_llh_to_ecef(lat, lon, h, xyz);
+    survey_add_fix(xyz, SURVEY_SRC_GGA);
+}
+
+// UBX-NAV-PVT from the receiver stream; supersedes GGA for the rest of the survey
+static void survey_nav_pvt(const uint8_t *payload, size_t len)
+{
+    if (len < sizeof(ubx_nav_pvt_t))
+        return;
+    const ubx_nav_pvt_t *pvt = (const ubx_nav_pvt_t *)payload;
+    if (pvt->fixType != 3 || !pvt->gnssFixOK)
+        return;
+
+    double xyz[3];
+    gps_llh_to_ecef(pvt->lat * 1e-7, pvt->lon * 1e-7, pvt->height * 1e-3, xyz);
+
+    pthread_mutex_lock(&shared_state_mutex);
+    if (survey.state == SURVEY_RUNNING) {
+        if (survey.source == SURVEY_SRC_GGA) {
+            TRACE("NAV-PVT available: restarting the survey from it\n");
+            gps_survey_reset(&survey.s);
+        }
+        survey_add_fix(xyz, SURVEY_SRC_NAV_PVT);
+    }
+    pthread_mutex_unlock(&shared_state_mutex);
+}
+
 static void print_usage(FILE *out, const char *progname)
 {
     fprintf(out,
@@ -1355,8 +2410,28 @@ static void print_usage(FILE *out, const char *progname)
         "  -r, --require-valid        Require valid NMEA sentences (default)\n"
         "  -a, --allow-invalid        Allow invalid NMEA sentences to update SHM\n"
         "  -s, --date-seed-dir DIR    Directory for date-seed file storage\n"
-        "  -u, --ublox-zda-only       Configure u-blox GPS to output only ZDA messages\n"
+        "  -u, --ublox-zda-only       Configure the receiver to output only ZDA messages\n"
+        "  -g, --receiver FAMILY      Skip the probe: ublox, mtk, quectel, sirf or nmea (leave alone)\n"
+        "  -F, --force-config         Send the whole u-blox profile even if the receiver already matches\n"
+        "  -P, --persist-config       Save the applied u-blox profile to BBR/flash (unless already saved)\n"
+        "  -p, --profile NAME|FILE    Configure u-blox from a profile (NAME = /etc/ntpgps/profiles/NAME.profile)\n"
+        "  -w, --pps-width US         Timepulse length once locked, in microseconds (default 100000)\n"
+        "  -t, --pps-period US        Timepulse period, in microseconds (default 1000000)\n"
+        "  -U, --pps-utc              Align the timepulse (and --nav-rate) to UTC instead of GPS time\n"
+        "  -N, --nav-rate MS          u-blox measurement rate, in milliseconds (e.g. 1000 = 1 Hz)\n"
+        "  -T, --ubx-timeout MS       Wait for a UBX reply this long after sending (default 500)\n"
+        "  -R, --ubx-retries N        Attempts per UBX frame (default 3)\n"
+        "  -B, --ubx-backoff MS       Pause before retry n is n times this (default 20)\n"
+        "  -I, --health-interval S    Poll u-blox jamming/antenna/buffer state this often, 0 = never (default 30)\n"
+        "  -J, --jam-limit N          Withhold samples while the jamming indicator exceeds N (1-255)\n"
+        "  -V, --utc-valid NS         Withhold samples until u-blox NAV-TIMEUTC has valid UTC within NS ns\n"
+        "  -S, --survey S             Survey the antenna position for at least S s, then fix it (u-blox timing)\n"
+        "  -A, --survey-acc M         Accuracy the surveyed position must reach, in metres (default 2.0)\n"
         "  -f, --filter MSG[,MSG...]  Only process specified NMEA sentence types (e.g. RMC,GGA,GLL,ZDA)\n"
+        "  -m, --metrics-port PORT    Serve OpenMetrics on http://127.0.0.1:PORT/metrics\n"
+        "  -c, --record FILE          Capture every chunk read from the receiver, with timestamps, to FILE\n"
+        "  -C, --record-size MB       Start a new FILE (the old one kept as FILE.1) every MB MiB (default 16)\n"
+        "  -y, --replay FILE          Run captures (repeat for FILE.1 FILE) without a device, list SHM writes\n"
         "\n"
         "Examples:\n"
         "  %s --debug-trace /dev/ttyUSB0\n"
@@ -1377,359 +2452,254 @@ static void usage_short(const char *progname)
         progname, progname);
 }
 
-unsigned parse_nmea_filter(const char *arg)
-{
-    unsigned mask = 0;
-    if (!arg || !*arg)
-        return 0;
+////////////////////////////////////////////////////////////////////////////////
 
-    const char *p = arg;
-    while (*p) {
-        char word[8];
-        int i = 0;
+// Where complete NMEA lines go: the SHM segment plus the time the chunk
+// holding them was read
+struct nmea_capture {
+    struct shmTime *shm;
+    struct timespec rx_rt;      // CLOCK_REALTIME of the read()
+    uint64_t rx_mono_ns;        // CLOCK_MONOTONIC of the read()
+};
 
-        // Extract token up to comma
-        while (*p && *p != ',' && i < (int)sizeof(word) - 1)
-            word[i++] = *p++;
-        word[i] = '\0';
-        if (*p == ',')
-            p++;
+// Set by the GPS thread while it runs UBX exchanges at run time, so NMEA
+// read by wait_for_ubx_msg() still reaches SHM instead of being skipped
+static struct nmea_capture *ubx_nmea_capture = NULL;
 
-        // Uppercase for robustness
-        for (int j = 0; word[j]; j++)
-            word[j] = toupper((unsigned char)word[j]);
+// --replay: where each SHM write is listed, NULL when live
+static FILE *replay_out = NULL;
 
-        if      (strcmp(word, "RMC") == 0) mask |= NMEA_RMC;
-        else if (strcmp(word, "GGA") == 0) mask |= NMEA_GGA;
-        else if (strcmp(word, "GLL") == 0) mask |= NMEA_GLL;
-        else if (strcmp(word, "ZDA") == 0) mask |= NMEA_ZDA;
-        else fprintf(stderr, "Unknown NMEA filter type: %s\n", word);
+// Parse one NMEA line and publish it to SHM
+static void capture_nmea_line(struct nmea_capture *cap, const char *line)
+{
+    struct shmTime *shm = cap->shm;
+    struct timespec ts = {0};
+
+    pthread_mutex_lock(&shared_state_mutex);
+    int prev_invalid = nmea_data_invalid;
+    int prev_date = stored_year * 10000 + stored_month * 100 + stored_day;
+    if (parse_nmea_time(line, &ts) == 0) {
+
+        // Safe update to shared memory, unless the receiver reported itself unhealthy
+        if (STAT_LOAD(stats, health_gate)) {
+            STAT_INC(stats, health_gated);
+        } else if (shm != NULL) {
+            struct shmTime tmp = *shm;  // copy old values
+            tmp.clockTimeStampSec = ts.tv_sec;
+            tmp.clockTimeStampUSec = ts.tv_nsec / 1000;
+            tmp.receiveTimeStampSec = ts.tv_sec;
+            tmp.receiveTimeStampUSec = ts.tv_nsec / 1000;
+
+            shm->valid = 0;          // mark old data invalid
+            shm->count++;            // bump count before write
+            *shm = tmp;              // copy all fields at once
+            shm->count++;            // bump count after write
+            shm->valid = 1;          // mark new data valid
+
+            TRACE("Wrote GPS time: %ld.%09ld\n", (long)ts.tv_sec, ts.tv_nsec);
+            STAT_INC(stats, shm_write_count);
+            record_sample(line, &ts, &cap->rx_rt, cap->rx_mono_ns);
+            if (replay_out)
+                fprintf(replay_out, "%d %d %lld.%06d %lld.%06d %d %d %d %d %d %d %.3s\n",
+                        shm->mode, shm->count,
+                        (long long)shm->clockTimeStampSec, shm->clockTimeStampUSec,
+                        (long long)shm->receiveTimeStampSec, shm->receiveTimeStampUSec,
+                        shm->leap, shm->precision, shm->nsamples, shm->valid,
+                        shm->clockTimeStampNSec, shm->receiveTimeStampNSec, line + 3);
+        }
+    } else
+        STAT_INC(stats, parse_nmea_fail);
+
+    if (nmea_data_invalid != prev_invalid)
+        watch_event(nmea_data_invalid ? WATCH_FIX_LOSS : WATCH_FIX_OK, 0);
+    int date = stored_year * 10000 + stored_month * 100 + stored_day;
+    if (stored_day && prev_date && date != prev_date)   // not the first date seen
+        watch_event(WATCH_ROLLOVER, date);
+
+    if (stored_date_changed) {
+        stored_date_changed = 0;
+        if (!replay_out)        // a replay leaves the live writer's seed alone
+            write_date_seed();
     }
-
-    return mask;
+    survey_nmea_line(line);
+    pthread_mutex_unlock(&shared_state_mutex);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
-typedef enum {
-    UBX_FILTER_NONE = 0,
-    UBX_FILTER_CLS_ID,              // match cls, id
-    UBX_FILTER_ACK                  // match cls, id and payload bytes
-} ubx_filter_t;
+// What gps_listen() is looking for in the NMEA the parser hands over
+static struct {
+    bool         active;
+    gps_family_t family;        // out: family identified, GPS_FAMILY_NMEA if none yet
+    gps_family_t ack_family;    // in: count acknowledgements from this family
+    int          lines;         // out: NMEA lines seen
+    int          acks, naks;    // out: acknowledgements seen
+} gps_listen_state;
 
-typedef struct {
-    uint8_t raw[UBX_MAX_MSG_SIZE];  // full message (0xB5..checksum)
-    size_t  length;                 // number of bytes currently in msg[]
-    uint8_t *payload;               // pointer to msg[6], the payload
-    size_t  payload_len;            // extracted payload length (L field)
-    size_t  state;                  // current parser state
-    uint8_t cls, id;                // class and ID
-    uint8_t ck_a, ck_b;             // running checksum
-    ubx_filter_t filter_type;       // what filter to apply
-    uint8_t filter_cls;             // CLS we are waiting for
-    uint8_t filter_id;              // ID we are waiting for
-    uint8_t *filter_payload;        // Payload we are waiting for
-    size_t filter_payload_len;      // Payload length we are waiting for
-    bool filter_active;             // flag: true = filter active
-} ubx_parser_t;
+static void gps_listen_line(const char *line)
+{
+    gps_listen_state.lines++;
+    if (gps_listen_state.family == GPS_FAMILY_NMEA) {
+        gps_listen_state.family = gps_family_from_nmea(line);
+        if (gps_listen_state.family != GPS_FAMILY_NMEA)
+            TRACE("Identified %s receiver from: %s\n", gps_family_name(gps_listen_state.family), line);
+    }
+    int ack = gps_vendor_ack(gps_listen_state.ack_family, line);
+    if (ack > 0)
+        gps_listen_state.acks++;
+    else if (ack < 0) {
+        gps_listen_state.naks++;
+        TRACE("Command rejected: %s\n", line);
+    }
+}
 
-typedef enum {
-    UBX_STATE_SYNC1 = 0,
-    UBX_STATE_SYNC2 = 1,
-    UBX_STATE_CLASS = 2,
-    UBX_STATE_ID = 3,
-    UBX_STATE_LEN_LO = 4,
-    UBX_STATE_LEN_HI = 5,
-    UBX_STATE_PAYLOAD = 6,
-    UBX_STATE_CK_A = 7,
-    UBX_STATE_CK_B = 8,
-    UBX_STATE_NMEA = 100
-} ubx_state_t;
-
-void ubx_parser_init(ubx_parser_t *p)
-{
-    p->length = 0;
-    p->payload = NULL;
-    p->payload_len = 0;
-    p->state = UBX_STATE_SYNC1;
-    p->cls = 0;
-    p->id = 0;
-    p->ck_a = 0;
-    p->ck_b = 0;
-    p->filter_type = UBX_FILTER_NONE;
-    p->filter_cls = 0;
-    p->filter_id = 0;
-    p->filter_payload = NULL;
-    p->filter_payload_len = 0;
-    p->filter_active = false;
-}
-
-typedef enum ubx_parse_result {
-    UBX_PARSE_INCOMPLETE = 0,  // still accumulating bytes
-    UBX_PARSE_OK,              // message complete and checksum OK
-    UBX_PARSE_CKSUM_ERR,       // checksum failed
-    UBX_PARSE_SYNC_ERR,        // lost sync or invalid structure
-    UBX_PARSE_FILTER_ERR,      // bad filter type
-    UBX_PARSE_TIMEOUT,         // timeout while parsing data
-    UBX_SELECT_TIMEOUT,        // timeout while reading data
-    UBX_SELECT_ERROR,
-    UBX_READ_ERROR,
-    UBX_WRITE_ERROR,
-    UBX_RECEIVED_NAK,
-    UBX_ARG_ERROR,
-    UBX_STOP,
-    UBX_UNEXPECTED
-} ubx_parse_result_t;
-
-static const char * const result_text(ubx_parse_result_t res)
-{
-    switch(res) {
-    case UBX_PARSE_INCOMPLETE:  return "Parse incomplete";
-    case UBX_PARSE_OK:          return "Success";
-    case UBX_PARSE_CKSUM_ERR:   return "Parse checksum error";
-    case UBX_PARSE_SYNC_ERR:    return "Parse sync error";
-    case UBX_PARSE_FILTER_ERR:  return "Unknown filter type";
-    case UBX_PARSE_TIMEOUT:     return "Timeout waiting for ACK or response";
-    case UBX_SELECT_TIMEOUT:    return "Timeout waiting for select()";
-    case UBX_SELECT_ERROR:      return "Error returned by select()";
-    case UBX_READ_ERROR:        return "Error returned by read()";
-    case UBX_WRITE_ERROR:       return "Error returned by write()";
-    case UBX_RECEIVED_NAK:      return "Device rejected the message";
-    case UBX_ARG_ERROR:         return "Bad argument passed to function";
-    case UBX_STOP:              return "Stop signal received";
-    case UBX_UNEXPECTED:        return "Unexpected error occurred";
-    default: {
-        static _Thread_local char buf[64];
-        snprintf(buf, sizeof(buf), "Unknown result code (%d)", res);
-        return buf;
-    }}
-}
-
-// state machine for parsing UBX response
-ubx_parse_result_t ubx_parser_feed(ubx_parser_t *p, uint8_t byte)
-{
-    static char nmea_buf[128];
-    static size_t nmea_pos = 0;
-
-    switch (p->state) {
-    case UBX_STATE_SYNC1: // waiting for sync char 1 (0xB5)
-        if (byte == UBX_SYNC1) {
-            p->raw[0] = byte;
-            p->length = 1;
-            p->state = UBX_STATE_SYNC2;
-        } else if (byte == '$') {
-            // Begin skipping an NMEA sentence
-            nmea_pos = 0;
-            nmea_buf[nmea_pos++] = byte;
-            p->state = UBX_STATE_NMEA;
-        }
-        return UBX_PARSE_INCOMPLETE;
-
-    case UBX_STATE_NMEA:
-        if (nmea_pos < sizeof(nmea_buf) - 1)
-            nmea_buf[nmea_pos++] = byte;
-        if (byte == '\n') {
-            nmea_buf[nmea_pos] = '\0';
-            TRACE("Skipped NMEA: %s", nmea_buf);
-            nmea_pos = 0;
-            p->state = UBX_STATE_SYNC1;
-        }
-        return UBX_PARSE_INCOMPLETE;
-
-    case UBX_STATE_SYNC2: // waiting for sync char 2 (0x62)
-        if (byte == UBX_SYNC2) {
-            p->raw[p->length++] = byte;
-            p->state = UBX_STATE_CLASS;
-            p->ck_a = 0;
-            p->ck_b = 0;
-        } else {
-            p->state = UBX_STATE_SYNC1;
-            p->length = 0;
-        }
-        return UBX_PARSE_INCOMPLETE;
-
-    case UBX_STATE_CLASS: // reading class
-        p->raw[p->length++] = byte;
-        p->cls = byte;
-        p->ck_a += byte;
-        p->ck_b += p->ck_a;
-        p->state = UBX_STATE_ID;
-        return UBX_PARSE_INCOMPLETE;
-
-    case UBX_STATE_ID: // reading ID
-        p->raw[p->length++] = byte;
-        p->id = byte;
-        p->ck_a += byte;
-        p->ck_b += p->ck_a;
-        p->state = UBX_STATE_LEN_LO;
-        return UBX_PARSE_INCOMPLETE;
-
-    case UBX_STATE_LEN_LO: // reading length LSB
-        p->raw[p->length++] = byte;
-        p->payload_len = byte;
-        p->ck_a += byte;
-        p->ck_b += p->ck_a;
-        p->state = UBX_STATE_LEN_HI;
-        return UBX_PARSE_INCOMPLETE;
-
-    case UBX_STATE_LEN_HI: // reading length MSB
-        p->raw[p->length++] = byte;
-        p->payload_len |= ((size_t)byte << 8);
-        p->ck_a += byte;
-        p->ck_b += p->ck_a;
-
-        if (p->payload_len > UBX_MAX_PAYLOAD_SIZE) {
-            // sanity check (too large)
-            p->state = UBX_STATE_SYNC1;
-            p->length = 0;
-            return UBX_PARSE_SYNC_ERR;
-        }
-
-        if (p->payload_len == 0)
-            p->state = UBX_STATE_CK_A;  // go directly to checksum
-        else
-            p->state = UBX_STATE_PAYLOAD;
-        return UBX_PARSE_INCOMPLETE;
-
-    case UBX_STATE_PAYLOAD: // reading payload
-        if (p->length >= UBX_MAX_MSG_SIZE) {
-            p->state = UBX_STATE_SYNC1;
-            return UBX_PARSE_SYNC_ERR;
-        }
-        p->raw[p->length++] = byte;
-        p->ck_a += byte;
-        p->ck_b += p->ck_a;
-
-        if (p->length == 6 + p->payload_len) {
-            p->payload = &p->raw[6];
-            p->state = UBX_STATE_CK_A;
-        }
-        return UBX_PARSE_INCOMPLETE;
-
-    case UBX_STATE_CK_A: // checksum A
-        p->raw[p->length++] = byte;
-        if (byte != p->ck_a) {
-            p->state = UBX_STATE_SYNC1;
-            p->length = 0;
-            return UBX_PARSE_CKSUM_ERR;
-        }
-        p->state = UBX_STATE_CK_B;
-        return UBX_PARSE_INCOMPLETE;
-
-    case UBX_STATE_CK_B: // checksum B
-        p->raw[p->length++] = byte;
-        if (byte != p->ck_b) {
-            p->state = UBX_STATE_SYNC1;
-            p->length = 0;
-            return UBX_PARSE_CKSUM_ERR;
-        }
-
-        // message complete and verified
-        p->state = UBX_STATE_SYNC1;
-        if (p->filter_active) {
-            bool ignore_message = false;
-            switch (p->filter_type) {
-            case UBX_FILTER_CLS_ID:
-                if (p->cls != p->filter_cls || p->id != p->filter_id)
-                    ignore_message = true;
-                break;
-            case UBX_FILTER_ACK:
-                if (p->cls != UBX_CLS_ACK || (p->id != UBX_ID_ACK_ACK && p->id != UBX_ID_ACK_NAK))
-                    ignore_message = true;
-                if (p->payload_len != p->filter_payload_len)
-                    ignore_message = true;
-                if (p->payload[0] != p->filter_payload[0] || p->payload[1] != p->filter_payload[1])
-                    ignore_message = true;
-                break;
-            default:
-                return UBX_PARSE_FILTER_ERR;
-            }
-            if (ignore_message) {
-                TRACE("Skipped %s\n", disassemble_ubx_bytes(p->raw, p->length));
-                return UBX_PARSE_INCOMPLETE;
-            }
-            p->filter_active = false; // filter satisfied
-        }
-        return UBX_PARSE_OK;
+static void ubx_parser_nmea_line(const char *line)
+{
+    if (gps_listen_state.active)
+        gps_listen_line(line);
+    if (ubx_nmea_capture)
+        capture_nmea_line(ubx_nmea_capture, line);
+    else
+        TRACE("Skipped NMEA: %s\n", line);
+}
 
-    default:
-        p->state = UBX_STATE_SYNC1;
-        p->length = 0;
-        return UBX_PARSE_SYNC_ERR;
-    }
+// A frame nobody was waiting for.  NAV-TIMEUTC and NAV-PVT still reach the
+// UTC gate and the survey when they stream in during a UBX exchange.
+static void ubx_parser_skipped(const uint8_t *raw, size_t len)
+{
+    if (raw[2] == UBX_CLS_NAV && raw[3] == UBX_ID_NAV_TIMEUTC)
+        utc_report(&raw[6], len - UBX_MIN_MSG_SIZE);
+    else if (raw[2] == UBX_CLS_NAV && raw[3] == UBX_ID_NAV_PVT)
+        survey_nav_pvt(&raw[6], len - UBX_MIN_MSG_SIZE);
+    else
+        TRACE_UBX("Skipped ", raw, len);
+}
+
+// Receiver input not yet parsed.  A reply can end in the middle of a read;
+// the bytes after it are kept for the next exchange instead of being lost.
+#define UBX_READ_CHUNK 1024
+static struct {
+    uint8_t buf[UBX_READ_CHUNK];
+    size_t  off, len;
+} ubx_rx;
+
+// --record: everything read into ubx_rx, GPS thread only
+static gps_record_t gps_rec;
+
+// Discard pending input, unless it is NMEA we still need
+static void ubx_rx_flush(int fd)
+{
+    if (ubx_nmea_capture)
+        return;
+    tcflush(fd, TCIFLUSH);
+    ubx_rx.off = ubx_rx.len = 0;
 }
 
-#define UBX_PARSE_TIMEOUT_MS 500
-ubx_parse_result_t wait_for_ubx_msg(int fd, ubx_parser_t *parser, int timeout_sec)
+// Read the next chunk once everything before it has been parsed.
+// Returns the number of bytes read, or -1 on a read error.
+static ssize_t ubx_rx_read(int fd)
 {
-    fd_set rfds;
-    struct timeval tv;
-    uint8_t buf[256];
-    uint64_t start_ms = monotonic_now_ms();
+    ssize_t n = read(fd, ubx_rx.buf, sizeof(ubx_rx.buf));
+    if (n < 0) {
+        if (errno == EAGAIN || errno == EINTR)
+            return 0;
+        perror("read");
+        return -1;
+    }
+    ubx_rx.off = 0;
+    ubx_rx.len = (size_t)n;
+    if (n > 0 && (ubx_nmea_capture || gps_rec.map)) {
+        struct timespec rt;
+        realtime_now(&rt);
+        uint64_t mono_ns = monotonic_now_ns();
+        if (ubx_nmea_capture) {
+            ubx_nmea_capture->rx_rt = rt;
+            ubx_nmea_capture->rx_mono_ns = mono_ns;
+        }
+        gps_record_write(&gps_rec, mono_ns, &rt, ubx_rx.buf, (size_t)n);
+    }
+    return n;
+}
 
-    while (!atomic_load(&stop)) {
-        // ---- Check for ACK/NAK timeout ----
-        uint64_t elapsed_ms = monotonic_now_ms() - start_ms;
-        if (elapsed_ms > UBX_PARSE_TIMEOUT_MS)
-            return UBX_PARSE_TIMEOUT;
+// select() on 'fd' until 'deadline_ns' (CLOCK_MONOTONIC).
+// Returns >0 if readable, 0 once the deadline has passed, -1 on error.
+static int ubx_rx_wait(int fd, uint64_t deadline_ns)
+{
+    for (;;) {
+        uint64_t now_ns = monotonic_now_ns();
+        if (now_ns >= deadline_ns)
+            return 0;
+        uint64_t wait_us = (deadline_ns - now_ns + 999) / 1000;
 
-        // ---- Wait for incoming data ----
+        fd_set rfds;
         FD_ZERO(&rfds);
         FD_SET(fd, &rfds);
+        struct timeval tv = { (time_t)(wait_us / 1000000), (suseconds_t)(wait_us % 1000000) };
+        int ret = select(fd + 1, &rfds, NULL, NULL, &tv);
+        if (ret >= 0 || errno != EINTR)
+            return ret;
+        if (atomic_load(&stop))
+            return -1;
+    }
+}
 
-        tv.tv_sec = timeout_sec;
-        tv.tv_usec = 0;
+// Feed receiver input to 'parser' until it completes a message or
+// 'deadline_ns' passes.  NMEA arriving meanwhile does not extend the wait.
+ubx_parse_result_t wait_for_ubx_msg(int fd, ubx_parser_t *parser, uint64_t deadline_ns)
+{
+    while (!atomic_load(&stop)) {
+        if (ubx_rx.off < ubx_rx.len) {
+            size_t used;
+            ubx_parse_result_t result = ubx_parser_feed_buf(parser, &ubx_rx.buf[ubx_rx.off],
+                                                            ubx_rx.len - ubx_rx.off, &used);
+            ubx_rx.off += used;
+            if (result != UBX_PARSE_INCOMPLETE)
+                return result; // success or checksum/error
+        }
 
-        int retval = select(fd + 1, &rfds, NULL, NULL, &tv);
-        if (retval < 0) {
-            if (errno == EINTR)
-                continue; // interrupted by signal — retry
+        int ret = ubx_rx_wait(fd, deadline_ns);
+        if (ret < 0) {
+            if (atomic_load(&stop))
+                break;
             perror("select");
             return UBX_SELECT_ERROR;
-        } else if (retval == 0) {
-            return UBX_SELECT_TIMEOUT; // I/O timeout
-        }
-
-        // only proceed if data is available
-        if (FD_ISSET(fd, &rfds)) {
-            ssize_t n = read(fd, buf, sizeof(buf));
-            if (n > 0) {
-                //TRACE("Read:  %s\n", format_ubx_bytes(buf, n));
-                for (ssize_t i = 0; i < n; i++) {
-                    ubx_parse_result_t result = ubx_parser_feed(parser, buf[i]);
-                    if (result != UBX_PARSE_INCOMPLETE)
-                        return result; // success or checksum/error
-                }
-            } else if (n < 0 && errno != EAGAIN) {
-                perror("read");
-                return UBX_READ_ERROR;
-            }
         }
+        if (ret == 0)
+            return UBX_PARSE_TIMEOUT;
+        if (ubx_rx_read(fd) < 0)
+            return UBX_READ_ERROR;
     }
     return UBX_STOP;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
+// ACK/NAK or poll response time, from the frame leaving the UART
+static void ubx_rtt_add(uint64_t sent_ns)
+{
+    uint64_t now_ns = monotonic_now_ns();
+    ntpgps_hist_add(&stats->ubx_ack_rtt, now_ns > sent_ns ? now_ns - sent_ns : 0);
+}
+
 // Send UBX message and wait for ACK/NAK
-#define UBX_MAX_RETRIES 3
-static ubx_parse_result_t send_ubx(int fd, const ubx_msg_t * const msg, ubx_parser_t *parser)
+static ubx_parse_result_t send_ubx_attempts(int fd, const ubx_msg_t * const msg,
+                                            ubx_parser_t *parser, int max_attempts)
 {
     if (!msg) return UBX_ARG_ERROR;
 
     ubx_parser_t parser_starting_state = {0};
     if (parser) parser_starting_state = *parser;
 
-    for (int attempt = 1; attempt <= UBX_MAX_RETRIES; attempt++) {
+    for (int attempt = 1; attempt <= max_attempts; attempt++) {
         // reset parser
         if (parser) *parser = parser_starting_state;
 
-        // clear input before sending
-        tcflush(fd, TCIFLUSH);
+        // clear input before sending (unless it is NMEA we still need)
+        ubx_rx_flush(fd);
 
         // send message
         //TRACE("Write: %s\n", format_ubx(msg));
-        TRACE("Write   %s\n", disassemble_ubx(msg));
+        TRACE_UBX("Write   ", msg->data, msg->length);
         ssize_t written = write(fd, msg->data, msg->length);
         if (written != (ssize_t)msg->length) {
             perror("write");
@@ -1742,9 +2712,11 @@ static ubx_parse_result_t send_ubx(int fd, const ubx_msg_t * const msg, ubx_pars
         if (!parser)
             return UBX_PARSE_OK; // ignore UBX response
 
-        ubx_parse_result_t res = wait_for_ubx_msg(fd, parser, 1);
+        uint64_t sent_ns = monotonic_now_ns();
+        ubx_parse_result_t res = wait_for_ubx_msg(fd, parser, sent_ns + (uint64_t)ubx_timeout_ms * 1000000ULL);
 
         if (res == UBX_PARSE_OK) {
+            ubx_rtt_add(sent_ns);
             if (parser->cls == UBX_CLS_ACK && parser->id == UBX_ID_ACK_NAK)
                 return UBX_RECEIVED_NAK;
             return UBX_PARSE_OK;
@@ -1754,21 +2726,58 @@ static ubx_parse_result_t send_ubx(int fd, const ubx_msg_t * const msg, ubx_pars
             return UBX_PARSE_CKSUM_ERR; // hard failure
 
         TRACE("No ACK for cls=0x%02X id=0x%02X (attempt %d/%d)\n",
-              msg->cls, msg->id, attempt, UBX_MAX_RETRIES);
+              msg->cls, msg->id, attempt, max_attempts);
 
-        // small delay before retry
-        usleep(20000 * attempt);
+        // back off before the retry
+        if (attempt < max_attempts && ubx_backoff_ms > 0)
+            usleep((useconds_t)ubx_backoff_ms * 1000 * attempt);
     }
 
     TRACE("Gave up after %d retries waiting for ACK 0x%02X/0x%02X\n",
-          UBX_MAX_RETRIES, msg->cls, msg->id);
+          max_attempts, msg->cls, msg->id);
 
     return UBX_PARSE_TIMEOUT;
 }
 
+static ubx_parse_result_t send_ubx(int fd, const ubx_msg_t * const msg, ubx_parser_t *parser)
+{
+    return send_ubx_attempts(fd, msg, parser, ubx_attempts);
+}
+
+/*
+ * ubx_port_switch()
+ * -----------------
+ * A UART1 CFG-PRT sets the baud rate along with the protocols, so the
+ * port switches of the built-in lists (9600 baud in ubx_defs.h) and of
+ * profile PORT lines are re-made with serial_baud, and with the character
+ * framing the receiver reported for UART1.  Sending them as they are
+ * after a SETBAUD would drop the receiver back to 9600 under our tty.
+ * Returns 'msg' itself when it is not a UART1 port switch.
+ */
+static const ubx_msg_t *ubx_port_switch(const ubx_msg_t *msg, uint8_t *frame, size_t size, ubx_msg_t *out)
+{
+    ubx_cfg_prt_t prt;
+    if (msg->cls != UBX_CLS_CFG || msg->id != UBX_ID_CFG_PRT || msg->payload_len != sizeof(prt) ||
+        msg->payload[0] != UBX_PORT_UART1)
+        return msg;
+    memcpy(&prt, msg->payload, sizeof(prt));
+    if (cfg_prt_valid && cfg_prt.portID == UBX_PORT_UART1)
+        prt.mode = cfg_prt.mode;
+    prt.baudRate = (uint32_t)serial_baud;
+    if (memcmp(&prt, msg->payload, sizeof(prt)) == 0)
+        return msg;
+
+    size_t len = ubx_frame_build(frame, size, UBX_CLS_CFG, UBX_ID_CFG_PRT, &prt, sizeof(prt));
+    memcpy(out, &(ubx_msg_t){ frame, len, &frame[6], sizeof(prt), UBX_CLS_CFG, UBX_ID_CFG_PRT },
+           sizeof(*out));
+    return out;
+}
+
 static ubx_parse_result_t send_ubx_no_wait(int fd, const ubx_msg_t * const msg)
 {
-    return send_ubx(fd, msg, NULL);
+    uint8_t frame[UBX_MIN_MSG_SIZE + sizeof(ubx_cfg_prt_t)];
+    ubx_msg_t port;
+    return send_ubx(fd, ubx_port_switch(msg, frame, sizeof(frame), &port), NULL);
 }
 
 static ubx_parse_result_t send_ubx_handle_ack(int fd, const ubx_msg_t * const msg)
@@ -1787,7 +2796,7 @@ static ubx_parse_result_t send_ubx_handle_ack(int fd, const ubx_msg_t * const ms
     switch (result) {
         case UBX_PARSE_OK:
         case UBX_RECEIVED_NAK:
-            TRACE("Read    %s\n", disassemble_ubx_bytes(parser.raw, parser.length));
+            TRACE_UBX("Read    ", parser.raw, parser.length);
             if (parser.length == 10 && parser.cls == UBX_CLS_ACK &&
               parser.payload_len == 2 &&
               parser.payload[0] == msg->cls && parser.payload[1] == msg->id) {
@@ -1799,7 +2808,7 @@ static ubx_parse_result_t send_ubx_handle_ack(int fd, const ubx_msg_t * const ms
                     TRACE("Unexpected message ID.\n");
                 }
             } else {
-                TRACE("Unexpected message length (%d).\n", parser.length);
+                TRACE("Unexpected message length (%zu).\n", parser.length);
             }
             break;
         default:
@@ -1824,7 +2833,7 @@ static ubx_parse_result_t send_ubx_handle_mon_ver(int fd, const ubx_msg_t * cons
 
     switch (result) {
         case UBX_PARSE_OK:
-            TRACE("Read    %s\n", disassemble_ubx_bytes(parser.raw, parser.length));
+            TRACE_UBX("Read    ", parser.raw, parser.length);
             if (parser.cls == UBX_CLS_MON && parser.id == UBX_ID_MON_VER) { // UBX-MON-VER
                 memset(mon_ver.raw, 0, sizeof(mon_ver.raw));
                 mon_ver.payload_len = parser.payload_len;
@@ -1853,6 +2862,42 @@ static ubx_parse_result_t send_ubx_handle_mon_ver(int fd, const ubx_msg_t * cons
     return result;
 }
 
+static ubx_parse_result_t send_ubx_handle_sec_uniqid(int fd, const ubx_msg_t * const msg)
+{
+    ubx_parser_t parser = {0};
+    ubx_parser_init(&parser);
+
+    parser.filter_type = UBX_FILTER_CLS_ID;
+    parser.filter_cls = msg->cls;
+    parser.filter_id = msg->id;
+    parser.filter_active = true;
+
+    ubx_unique_id_len = 0;
+    ubx_parse_result_t result = send_ubx(fd, msg, &parser);
+
+    switch (result) {
+        case UBX_PARSE_OK:
+            TRACE_UBX("Read    ", parser.raw, parser.length);
+            if (parser.cls == UBX_CLS_SEC && parser.id == UBX_ID_SEC_UNIQID) { // UBX-SEC-UNIQID
+                // version 1: 5-byte id, version 2 (generation 10): 6 bytes
+                if (parser.payload && parser.payload_len > 4 &&
+                    parser.payload_len - 4 <= sizeof(ubx_unique_id)) {
+                    ubx_unique_id_len = parser.payload_len - 4;
+                    memcpy(ubx_unique_id, &parser.payload[4], ubx_unique_id_len);
+                }
+            } else {
+                TRACE("Unexpected message ID.\n");
+                result = UBX_UNEXPECTED;
+            }
+            break;
+        default:
+            TRACE("%s\n", result_text(result));
+            break;
+    }
+
+    return result;
+}
+
 static ubx_parse_result_t send_ubx_handle_cfg_prt(int fd, const ubx_msg_t * const msg)
 {
     ubx_parser_t parser = {0};
@@ -1867,12 +2912,14 @@ static ubx_parse_result_t send_ubx_handle_cfg_prt(int fd, const ubx_msg_t * cons
 
     switch (result) {
         case UBX_PARSE_OK:
-            TRACE("Read    %s\n", disassemble_ubx_bytes(parser.raw, parser.length));
+            TRACE_UBX("Read    ", parser.raw, parser.length);
             if (parser.cls == UBX_CLS_CFG && parser.id == UBX_ID_CFG_PRT) { // UBX-CFG-PRT
                 memset(&cfg_prt, 0, sizeof(cfg_prt));
+                cfg_prt_valid = false;
 
                 if (parser.payload && parser.payload_len == sizeof(cfg_prt)) {
                     memcpy(&cfg_prt, parser.payload, sizeof(cfg_prt));
+                    cfg_prt_valid = true;
                 }
             } else {
                 TRACE("Unexpected message ID.\n");
@@ -1887,169 +2934,2356 @@ static ubx_parse_result_t send_ubx_handle_cfg_prt(int fd, const ubx_msg_t * cons
     return result;
 }
 
-static ubx_parse_result_t send_ubx_handle_generic(int fd, const ubx_msg_t * const msg)
-{
-    ubx_parser_t parser = {0};
-    ubx_parser_init(&parser);
+static ubx_parse_result_t send_ubx_handle_generic(int fd, const ubx_msg_t * const msg)
+{
+    ubx_parser_t parser = {0};
+    ubx_parser_init(&parser);
+
+    parser.filter_type = UBX_FILTER_CLS_ID;
+    parser.filter_cls = msg->cls;
+    parser.filter_id = msg->id;
+    parser.filter_active = true;
+
+    ubx_parse_result_t result = send_ubx(fd, msg, &parser);
+
+    switch (result) {
+        case UBX_PARSE_OK:
+            TRACE_UBX("Read    ", parser.raw, parser.length);
+            break;
+        default:
+            TRACE("%s\n", result_text(result));
+            break;
+    }
+
+    return result;
+}
+
+/*
+ * send_ubx_list()
+ * ---------------
+ * Pipelined replacement for UBX_INVOKE.  Entries handled by
+ * send_ubx_handle_ack are written back-to-back, at most UBX_PIPE_SLOTS frames
+ * and UBX_PIPE_MAX_INFLIGHT bytes ahead of the receiver, and their ACK/NAKs
+ * are matched as they arrive.  An ACK names only the class and id of what
+ * it answers, so at most one frame of each class and id is outstanding: a
+ * frame the receiver dropped cannot be credited with the ACK of the next
+ * CFG-MSG.  Polls are answered with the key they asked for and are not
+ * limited that way.  Only frames that are NAKed or time out are resent, up
+ * to --ubx-retries times.
+ *
+ * With UBX_LIST_DIFF the current setting behind every CFG entry is polled
+ * first (pipelined the same way) and entries the receiver already matches
+ * are not sent.  UBX_LIST_BARRIERS runs only the non-ACK entries.
+ *
+ * Any other entry (port switches, polls) is a barrier: everything before it
+ * is settled first, then it runs through its own handler as before.
+ *
+ * Runs the first 'count' entries of 'list'.  Returns the number of entries
+ * that failed; '*written' (if given) receives the number of CFG frames sent.
+ */
+#define UBX_LIST_MAX            64
+#define UBX_PIPE_SLOTS          8
+#define UBX_PIPE_MAX_INFLIGHT   256     // bytes, well inside a u-blox RX buffer
+
+typedef enum { UBX_LIST_FULL = 0, UBX_LIST_DIFF, UBX_LIST_BARRIERS } ubx_list_mode_t;
+
+typedef enum { UBX_PIPE_PENDING = 0, UBX_PIPE_INFLIGHT, UBX_PIPE_DONE, UBX_PIPE_FAILED } ubx_pipe_state_t;
+
+struct ubx_pipe_entry {
+    const uint8_t *frame;       // what is written
+    size_t   len;
+    uint8_t  cls, id;
+    int      key_len;           // poll: payload bytes echoed in the response
+    const ubx_msg_t *target;    // poll: the CFG message being checked
+    bool     unchanged;         // poll: receiver already matches target
+    ubx_pipe_state_t state;
+    int      attempts;
+    uint32_t sent_seq;          // send order, for in-order ACK matching
+    uint64_t sent_ns;           // expected end of transmission (CLOCK_MONOTONIC)
+    uint64_t deadline_ns;
+};
+
+// Payload bytes of a CFG message that select what a poll returns,
+// or -1 if the setting cannot be polled
+static int ubx_cfg_poll_key_len(const ubx_msg_t *msg)
+{
+    if (msg->cls != UBX_CLS_CFG)
+        return -1;
+
+    switch (msg->id) {
+        case UBX_ID_CFG_MSG:  return 2;     // msgClass, msgID
+        case UBX_ID_CFG_INF:  return 1;     // protocolID
+        case UBX_ID_CFG_PRT:  return 1;     // portID
+        case UBX_ID_CFG_GNSS: return 0;
+        case UBX_ID_CFG_TP5:  return 1;     // tpIdx
+        case UBX_ID_CFG_RATE: return 0;
+        default:              return -1;
+    }
+}
+
+// True if the polled payload 'cur' already has everything 'want' would set
+static bool ubx_cfg_matches(const ubx_msg_t *want, const uint8_t *cur, size_t cur_len)
+{
+    const uint8_t *p = want->payload;
+    size_t len = want->payload_len;
+
+    switch (want->id) {
+        case UBX_ID_CFG_MSG:
+            if (len == 3)   // rate on the current port only
+                return cur_len == 8 && cfg_prt.portID < 6 && cur[2 + cfg_prt.portID] == p[2];
+            return cur_len == len && memcmp(cur, p, len) == 0;
+
+        case UBX_ID_CFG_INF:
+            // one 10-byte block per protocol
+            for (size_t off = 0; off + 10 <= cur_len; off += 10) {
+                if (cur[off] == p[0])
+                    return len == 10 && memcmp(&cur[off], p, len) == 0;
+            }
+            return false;
+
+        case UBX_ID_CFG_PRT:
+            return cur_len == len && memcmp(cur, p, len) == 0;
+
+        case UBX_ID_CFG_GNSS:
+            // 4-byte header, then 8-byte blocks keyed by gnssId; the header
+            // and blocks we do not mention are left alone by the receiver
+            if (len < 4 || cur_len < 4)
+                return false;
+            for (size_t off = 4; off + 8 <= len; off += 8) {
+                bool found = false;
+                for (size_t c = 4; c + 8 <= cur_len && !found; c += 8) {
+                    if (cur[c] == p[off]) {
+                        if (memcmp(&cur[c], &p[off], 8) != 0)
+                            return false;
+                        found = true;
+                    }
+                }
+                if (!found)
+                    return false;
+            }
+            return true;
+
+        case UBX_ID_CFG_TP5: {
+            // delays, periods and lengths as written; flag bits above
+            // syncMode are reserved and not echoed reliably
+            if (cur_len != len || len != sizeof(ubx_cfg_tp5_data1_t) || cur[0] != p[0])
+                return false;
+            const ubx_cfg_tp5_data1_t *c = (const void *)cur, *w = (const void *)p;
+            return memcmp(&cur[4], &p[4], offsetof(ubx_cfg_tp5_data1_t, flags) - 4) == 0 &&
+                   (c->flags.raw & 0x3FFF) == (w->flags.raw & 0x3FFF);
+        }
+
+        case UBX_ID_CFG_RATE:
+            return cur_len == len && memcmp(cur, p, len) == 0;
+
+        default:
+            return false;
+    }
+}
+
+// Write one frame of the pipeline and start its ACK timer
+static int ubx_pipe_send(int fd, struct ubx_pipe_entry *e, uint32_t seq, size_t bytes_ahead)
+{
+    TRACE_UBX("Write   ", e->frame, e->len);
+    if (write_all(fd, (const char *)e->frame, e->len) != 0) {
+        perror("write");
+        return -1;
+    }
+    STAT_INC(stats, ubx_cfg_sent);
+
+    // the reply cannot arrive before everything queued ahead has been sent
+    uint64_t tx_ns = (bytes_ahead + e->len) * 10 * 1000000000ULL / (serial_baud ? serial_baud : 9600);
+    e->state = UBX_PIPE_INFLIGHT;
+    e->attempts++;
+    e->sent_seq = seq;
+    e->sent_ns = monotonic_now_ns() + tx_ns;
+    e->deadline_ns = e->sent_ns + (uint64_t)ubx_timeout_ms * 1000000ULL;
+    return 0;
+}
+
+// Frame gets another go, or is given up on
+static void ubx_pipe_retry(struct ubx_pipe_entry *e, bool poll, const char *why)
+{
+    if (e->attempts < ubx_attempts) {
+        TRACE("%s for cls=0x%02X id=0x%02X (attempt %d/%d)\n",
+              why, e->cls, e->id, e->attempts, ubx_attempts);
+        STAT_INC(stats, ubx_cfg_retries);
+        e->state = UBX_PIPE_PENDING;
+    } else {
+        TRACE("Gave up on cls=0x%02X id=0x%02X after %d attempts\n",
+              e->cls, e->id, e->attempts);
+        if (!poll)
+            STAT_INC(stats, ubx_cfg_failures);
+        e->state = UBX_PIPE_FAILED;
+    }
+}
+
+// True if a frame with this class and id is already waiting for its ACK
+static bool ubx_pipe_busy(const struct ubx_pipe_entry *pipe, size_t count, uint8_t cls, uint8_t id)
+{
+    for (size_t i = 0; i < count; i++) {
+        if (pipe[i].state == UBX_PIPE_INFLIGHT && pipe[i].cls == cls && pipe[i].id == id)
+            return true;
+    }
+    return false;
+}
+
+// Oldest in-flight entry the received message answers, or 'count' if none
+static size_t ubx_pipe_match(struct ubx_pipe_entry *pipe, size_t count, bool poll,
+                             const ubx_parser_t *parser)
+{
+    size_t match = count;
+    bool ack = (parser->cls == UBX_CLS_ACK && parser->payload_len == 2);
+
+    for (size_t i = 0; i < count; i++) {
+        const struct ubx_pipe_entry *e = &pipe[i];
+        if (e->state != UBX_PIPE_INFLIGHT)
+            continue;
+
+        bool answers;
+        if (ack) {
+            // a poll is answered by its response; only a NAK refuses it
+            answers = e->cls == parser->payload[0] && e->id == parser->payload[1] &&
+                      (!poll || parser->id == UBX_ID_ACK_NAK);
+        } else {
+            answers = poll && e->cls == parser->cls && e->id == parser->id &&
+                      parser->payload_len >= (size_t)e->key_len &&
+                      memcmp(parser->payload, &e->frame[6], e->key_len) == 0;
+        }
+
+        if (answers && (match == count || (int32_t)(e->sent_seq - pipe[match].sent_seq) < 0))
+            match = i;
+    }
+    return match;
+}
+
+// Run a batch of frames as one pipeline.  With 'poll' set the frames are
+// polls and each response is compared with the entry's target.
+static int ubx_pipe_run(int fd, struct ubx_pipe_entry *pipe, size_t count, bool poll)
+{
+    ubx_parser_t parser = {0};
+    ubx_parser_init(&parser);
+    uint32_t seq = 0;
+    int inflight = 0;
+    size_t inflight_bytes = 0;
+
+    // clear input before sending (unless it is NMEA we still need)
+    ubx_rx_flush(fd);
+
+    for (;;) {
+        // fill the pipeline, lowest index first
+        for (size_t i = 0; i < count && inflight < UBX_PIPE_SLOTS; i++) {
+            if (pipe[i].state != UBX_PIPE_PENDING)
+                continue;
+            if (!poll && ubx_pipe_busy(pipe, count, pipe[i].cls, pipe[i].id))
+                continue;   // its ACK would be ambiguous
+            if (inflight && inflight_bytes + pipe[i].len > UBX_PIPE_MAX_INFLIGHT)
+                break;
+            if (ubx_pipe_send(fd, &pipe[i], seq++, inflight_bytes) != 0)
+                return -1;
+            inflight++;
+            inflight_bytes += pipe[i].len;
+        }
+        if (inflight == 0)
+            break;  // everything settled
+
+        // wait until the next reply deadline, unless input is already waiting
+        if (ubx_rx.off == ubx_rx.len) {
+            uint64_t deadline_ns = UINT64_MAX;
+            for (size_t i = 0; i < count; i++) {
+                if (pipe[i].state == UBX_PIPE_INFLIGHT && pipe[i].deadline_ns < deadline_ns)
+                    deadline_ns = pipe[i].deadline_ns;
+            }
+
+            int ret = ubx_rx_wait(fd, deadline_ns);
+            if (atomic_load(&stop))
+                return -1;
+            if (ret < 0) {
+                perror("select");
+                return -1;
+            }
+            if (ret > 0 && ubx_rx_read(fd) < 0)
+                return -1;
+        }
+
+        // several replies can share one read, so feed the whole chunk
+        while (ubx_rx.off < ubx_rx.len) {
+            size_t used;
+            ubx_parse_result_t res = ubx_parser_feed_buf(&parser, &ubx_rx.buf[ubx_rx.off],
+                                                         ubx_rx.len - ubx_rx.off, &used);
+            ubx_rx.off += used;
+            if (res != UBX_PARSE_OK)
+                continue;
+
+            size_t match = ubx_pipe_match(pipe, count, poll, &parser);
+            if (match == count) {
+                TRACE_UBX("Skipped ", parser.raw, parser.length);
+                continue;
+            }
+
+            struct ubx_pipe_entry *e = &pipe[match];
+            TRACE_UBX("Read    ", parser.raw, parser.length);
+            ubx_rtt_add(e->sent_ns);
+            inflight--;
+            inflight_bytes -= e->len;
+
+            if (poll) {
+                // a NAKed poll means the setting cannot be read back
+                e->state = UBX_PIPE_DONE;
+                e->unchanged = parser.cls != UBX_CLS_ACK &&
+                               ubx_cfg_matches(e->target, parser.payload, parser.payload_len);
+            } else if (parser.id == UBX_ID_ACK_ACK) {
+                e->state = UBX_PIPE_DONE;
+            } else {
+                STAT_INC(stats, ubx_cfg_naks);
+                ubx_pipe_retry(e, poll, "NAK");
+            }
+        }
+
+        // expire frames whose reply is overdue
+        uint64_t now_ns = monotonic_now_ns();
+        for (size_t i = 0; i < count; i++) {
+            if (pipe[i].state == UBX_PIPE_INFLIGHT && pipe[i].deadline_ns <= now_ns) {
+                inflight--;
+                inflight_bytes -= pipe[i].len;
+                ubx_pipe_retry(&pipe[i], poll, poll ? "No response" : "No ACK");
+            }
+        }
+    }
+
+    int failed = 0;
+    for (size_t i = 0; i < count; i++)
+        failed += (pipe[i].state == UBX_PIPE_FAILED);
+    return failed;
+}
+
+// Poll the current value behind each pending CFG entry and mark the ones the
+// receiver already matches as done.  Returns the number left to send.
+static size_t ubx_pipe_diff(int fd, struct ubx_pipe_entry *sets, const ubx_entry_t *list, size_t count)
+{
+    struct ubx_pipe_entry polls[UBX_LIST_MAX] = {0};
+    uint8_t frames[UBX_LIST_MAX][UBX_MIN_MSG_SIZE + 2];
+    size_t pending = count;
+
+    for (size_t i = 0; i < count; i++) {
+        const ubx_msg_t *msg = list[i].msg;
+        int key_len = ubx_cfg_poll_key_len(msg);
+        polls[i].state = UBX_PIPE_DONE;     // not pollable: always send
+        if (key_len < 0 || (size_t)key_len > msg->payload_len)
+            continue;
+
+        polls[i].frame = frames[i];
+        polls[i].len = ubx_frame_build(frames[i], sizeof(frames[i]), msg->cls, msg->id,
+                                       msg->payload, key_len);
+        polls[i].cls = msg->cls;
+        polls[i].id = msg->id;
+        polls[i].key_len = key_len;
+        polls[i].target = msg;
+        polls[i].state = UBX_PIPE_PENDING;
+    }
+
+    if (ubx_pipe_run(fd, polls, count, true) < 0)
+        return count;
+
+    for (size_t i = 0; i < count; i++) {
+        if (polls[i].unchanged) {
+            TRACE_UBX("Unchanged ", list[i].msg->data, list[i].msg->length);
+            STAT_INC(stats, ubx_cfg_unchanged);
+            sets[i].state = UBX_PIPE_DONE;
+            pending--;
+        }
+    }
+    return pending;
+}
+
+static size_t ubx_list_len(const ubx_entry_t *list)
+{
+    size_t count = 0;
+    while (list[count].msg)
+        count++;
+    return count;
+}
+
+static int send_ubx_list(int fd, const ubx_entry_t *list, size_t count, ubx_list_mode_t mode,
+                         size_t *written)
+{
+    if (written)
+        *written = 0;
+    if (count > UBX_LIST_MAX) {
+        fprintf(stderr, "UBX list too long (%zu > %d)\n", count, UBX_LIST_MAX);
+        return -1;
+    }
+
+    int failed = 0;
+    size_t i = 0;
+    while (i < count) {
+        if (list[i].invoke == send_ubx_handle_ack) {
+            size_t end = i;
+            while (end < count && list[end].invoke == send_ubx_handle_ack)
+                end++;
+
+            if (mode != UBX_LIST_BARRIERS) {
+                struct ubx_pipe_entry pipe[UBX_LIST_MAX] = {0};
+                for (size_t k = i; k < end; k++) {
+                    const ubx_msg_t *msg = list[k].msg;
+                    pipe[k - i] = (struct ubx_pipe_entry){
+                        .frame = msg->data, .len = msg->length, .cls = msg->cls, .id = msg->id,
+                    };
+                }
+
+                size_t pending = end - i;
+                if (mode == UBX_LIST_DIFF)
+                    pending = ubx_pipe_diff(fd, pipe, &list[i], end - i);
+                if (pending) {
+                    int res = ubx_pipe_run(fd, pipe, end - i, false);
+                    if (res < 0)
+                        return -1;
+                    failed += res;
+                }
+                if (written)
+                    *written += pending;
+            }
+            i = end;
+        } else {
+            if (list[i].invoke) {
+                ubx_parse_result_t res = list[i].invoke(fd, list[i].msg);
+                failed += (res != UBX_PARSE_OK);
+                usleep(5000);  // let port switches settle
+            }
+            i++;
+        }
+    }
+    return failed;
+}
+
+/*
+ * Timepulse and navigation rate
+ * -----------------------------
+ * --pps-width, --pps-period, --pps-utc and --nav-rate are compiled once at
+ * startup into CFG-TP5 and CFG-RATE frames.  configure_ublox_profile() runs
+ * them with whatever list it is given, just before the trailing port
+ * switches, so they are diffed, fingerprinted and persisted like the rest.
+ * If they had to be written they are polled back before UBX output goes off.
+ */
+#define UBX_TIMING_MAX          2       // CFG-TP5, CFG-RATE
+#define UBX_TIMING_MAX_ITEMS    14      // their generation 9+ items
+
+static uint8_t ubx_timing_frame[UBX_TIMING_MAX][UBX_MIN_MSG_SIZE + sizeof(ubx_cfg_tp5_data1_t)];
+static ubx_msg_t ubx_timing_msg[UBX_TIMING_MAX];
+static ubx_entry_t ubx_timing_list[UBX_TIMING_MAX];
+static size_t ubx_timing_count = 0;
+
+static void ubx_timing_add(uint8_t id, const void *payload, size_t len)
+{
+    uint8_t *frame = ubx_timing_frame[ubx_timing_count];
+    size_t flen = ubx_frame_build(frame, sizeof(ubx_timing_frame[0]), UBX_CLS_CFG, id, payload, len);
+    ubx_msg_t *msg = &ubx_timing_msg[ubx_timing_count];
+
+    memcpy(msg, &(ubx_msg_t){ frame, flen, &frame[6], len, UBX_CLS_CFG, id }, sizeof(ubx_msg_t));
+    memcpy(&ubx_timing_list[ubx_timing_count], &(ubx_entry_t){ msg, send_ubx_handle_ack }, sizeof(ubx_entry_t));
+    ubx_timing_count++;
+}
+
+static void build_ublox_timing(void)
+{
+    if (pps_config) {
+        // timepulse 1, silent until the receiver has a fix, then a pulse of
+        // pps_width_us whose rising edge is on the second of the chosen grid
+        ubx_cfg_tp5_data1_t tp5 = {
+            .tpIdx = 0,
+            .version = 1,
+            .antCableDelay = 50,            // receiver default, as set_cfg_tp5
+            .freqPeriod = pps_period_us,
+            .freqPeriodLock = pps_period_us,
+            .pulseLenRatio = 0,
+            .pulseLenRatioLock = pps_width_us,
+            .flags.active = 1,
+            .flags.lockGnssFreq = 1,
+            .flags.lockedOtherSet = 1,
+            .flags.isLength = 1,
+            .flags.alignToTow = 1,
+            .flags.polarity = 1,
+            .flags.gridUtcGnss = pps_utc ? UBX_TIME_REF_UTC : UBX_TIME_REF_GPS,
+        };
+        ubx_timing_add(UBX_ID_CFG_TP5, &tp5, sizeof(tp5));
+    }
+
+    if (nav_rate_ms) {
+        ubx_cfg_rate_data0_t rate = {
+            .measRate = (uint16_t)nav_rate_ms,
+            .navRate = 1,
+            .timeRef = pps_utc ? UBX_TIME_REF_UTC : UBX_TIME_REF_GPS,
+        };
+        ubx_timing_add(UBX_ID_CFG_RATE, &rate, sizeof(rate));
+    }
+}
+
+// Generation 9+ items for the same settings.  Returns the number added.
+static size_t ubx_timing_valcfg(ubx_valcfg_kv_t *kv)
+{
+    size_t n = 0;
+
+    if (pps_config) {
+        uint64_t grid = pps_utc ? UBX_TIME_REF_UTC : UBX_TIME_REF_GPS;
+        kv[n++] = (ubx_valcfg_kv_t){ UBX_KEY_CFG_TP_PULSE_DEF, 0 };         // period
+        kv[n++] = (ubx_valcfg_kv_t){ UBX_KEY_CFG_TP_PULSE_LENGTH_DEF, 1 };  // length
+        kv[n++] = (ubx_valcfg_kv_t){ UBX_KEY_CFG_TP_PERIOD_TP1, pps_period_us };
+        kv[n++] = (ubx_valcfg_kv_t){ UBX_KEY_CFG_TP_PERIOD_LOCK_TP1, pps_period_us };
+        kv[n++] = (ubx_valcfg_kv_t){ UBX_KEY_CFG_TP_LEN_TP1, 0 };
+        kv[n++] = (ubx_valcfg_kv_t){ UBX_KEY_CFG_TP_LEN_LOCK_TP1, pps_width_us };
+        kv[n++] = (ubx_valcfg_kv_t){ UBX_KEY_CFG_TP_USE_LOCKED_TP1, 1 };
+        kv[n++] = (ubx_valcfg_kv_t){ UBX_KEY_CFG_TP_ALIGN_TO_TOW_TP1, 1 };
+        kv[n++] = (ubx_valcfg_kv_t){ UBX_KEY_CFG_TP_POL_TP1, 1 };
+        kv[n++] = (ubx_valcfg_kv_t){ UBX_KEY_CFG_TP_TIMEGRID_TP1, grid };
+        kv[n++] = (ubx_valcfg_kv_t){ UBX_KEY_CFG_TP_TP1_ENA, 1 };
+    }
+
+    if (nav_rate_ms) {
+        kv[n++] = (ubx_valcfg_kv_t){ UBX_KEY_CFG_RATE_MEAS, nav_rate_ms };
+        kv[n++] = (ubx_valcfg_kv_t){ UBX_KEY_CFG_RATE_NAV, 1 };
+        kv[n++] = (ubx_valcfg_kv_t){ UBX_KEY_CFG_RATE_TIMEREF, pps_utc ? UBX_TIME_REF_UTC : UBX_TIME_REF_GPS };
+    }
+    return n;
+}
+
+// Poll the timing settings back.  Returns the number the receiver did not take.
+static int ubx_timing_verify(int fd)
+{
+    int failed = 0;
+
+    for (size_t i = 0; i < ubx_timing_count; i++) {
+        const ubx_msg_t *msg = &ubx_timing_msg[i];
+        int key_len = ubx_cfg_poll_key_len(msg);
+        uint8_t frame[UBX_MIN_MSG_SIZE + 2];
+        size_t len = ubx_frame_build(frame, sizeof(frame), msg->cls, msg->id, msg->payload, key_len);
+        ubx_msg_t poll = { frame, len, &frame[6], (size_t)key_len, msg->cls, msg->id };
+
+        ubx_parser_t parser = {0};
+        ubx_parser_init(&parser);
+        parser.filter_type = UBX_FILTER_CLS_ID;
+        parser.filter_cls = msg->cls;
+        parser.filter_id = msg->id;
+        parser.filter_active = true;
+
+        if (send_ubx(fd, &poll, &parser) == UBX_PARSE_OK &&
+            ubx_cfg_matches(msg, parser.payload, parser.payload_len)) {
+            TRACE_UBX("Confirmed ", parser.raw, parser.length);
+        } else {
+            fprintf(stderr, "Receiver did not confirm %s\n", disassemble_ubx(msg));
+            failed++;
+        }
+    }
+    return failed;
+}
+
+/*
+ * configure_ublox_profile()
+ * -------------------------
+ * Brings the receiver to the settings in 'list'.  A fingerprint of the
+ * receiver's MON-VER, its SEC-UNIQID chip id and the profile is kept in
+ * /run/ntpgps/shmwriter<unit>.ubxcfg after a clean run; if it matches on the
+ * next start and a spot check of the last setting agrees, nothing but the
+ * port switches is sent.  Otherwise only settings that differ are written.
+ *
+ * With --persist-config a CFG-CFG save to BBR and flash follows, before the
+ * final port switches so its ACK can still be seen.  The fingerprint of
+ * what was saved is kept in ubxcfg<unit>.saved next to the date seed,
+ * which outlives a reboot when --date-seed-dir is on persistent storage
+ * (/run is not).  The configuration is saved again only when it changed,
+ * the receiver's RAM had to be corrected, or no save of it is recorded.
+ *
+ * The --pps-* and --nav-rate settings are inserted before the trailing port
+ * switches of every list run here.
+ */
+static uint64_t ubx_cfg_fingerprint(const ubx_entry_t *list)
+{
+    // FNV-1a over the receiver identity and every frame of the profile
+    uint64_t h = 0xcbf29ce484222325ULL;
+#define FNV_BYTES(p, n) \
+    for (size_t _i = 0; _i < (n); _i++) { h ^= ((const uint8_t *)(p))[_i]; h *= 0x100000001b3ULL; }
+
+    FNV_BYTES(mon_ver.raw, mon_ver.payload_len < sizeof(mon_ver.raw) ? mon_ver.payload_len : sizeof(mon_ver.raw));
+    // MON-VER only names the model and firmware; without a chip id (before
+    // protocol 18) a swap for the same model needs --force-config
+    FNV_BYTES(ubx_unique_id, ubx_unique_id_len);
+    FNV_BYTES(&cfg_prt.portID, sizeof(cfg_prt.portID));
+    for (const ubx_entry_t *e = list; e->msg; e++)
+        FNV_BYTES(e->msg->data, e->msg->length);
+#undef FNV_BYTES
+    return h;
+}
+
+// 'saved' selects ubxcfg<unit>.saved in the date seed directory, else the
+// /run cache of what the receiver's RAM holds
+static void ubx_cfg_cache_path(char *path, size_t size, bool saved)
+{
+    if (saved)
+        snprintf(path, size, "%s/ubxcfg%d.saved", date_seed_dir, stats->unit);
+    else
+        snprintf(path, size, ubxcfg_path_fmt, stats->unit);
+}
+
+static uint64_t read_ubx_cfg_cache(bool saved)
+{
+    char path[PATH_MAX_LEN + 32];
+    ubx_cfg_cache_path(path, sizeof(path), saved);
+
+    FILE *f = fopen(path, "r");
+    if (!f)
+        return 0;
+    unsigned long long fp = 0;
+    if (fscanf(f, "%llx", &fp) != 1)
+        fp = 0;
+    fclose(f);
+    return fp;
+}
+
+static void write_ubx_cfg_cache(uint64_t fp, bool saved)
+{
+    char path[PATH_MAX_LEN + 32];
+    ubx_cfg_cache_path(path, sizeof(path), saved);
+
+    if (fp == 0) {
+        unlink(path);
+        return;
+    }
+    const char *dir = saved ? date_seed_dir : socket_dir;
+    if (mkdir_p(dir, 0755) != 0)
+        TRACE("Failed to create directory %s: %s\n", dir, strerror(errno));
+
+    FILE *f = fopen(path, "w");
+    if (f) {
+        fprintf(f, "%016llx\n", (unsigned long long)fp);
+        fclose(f);
+        TRACE("Updated %s\n", path);
+    } else {
+        TRACE("Failed to write %s: %s\n", path, strerror(errno));
+    }
+}
+
+// Save the running configuration to BBR and flash, verified by its ACK
+static int save_ublox_config(int fd)
+{
+    TRACE("Saving u-blox configuration to BBR/flash...\n");
+    if (send_ubx_handle_ack(fd, &set_cfg_cfg_bbr_flash) != UBX_PARSE_OK) {
+        fprintf(stderr, "Receiver did not confirm saving its configuration\n");
+        return -1;
+    }
+    STAT_INC(stats, ubx_cfg_saves);
+    return 0;
+}
+
+// Index of the trailing port switches, which turn UBX output off again
+static size_t ubx_list_tail(const ubx_entry_t *list, size_t count)
+{
+    size_t tail = count;
+    while (tail > 0 && list[tail - 1].invoke != send_ubx_handle_ack)
+        tail--;
+    return tail;
+}
+
+static int configure_ublox_list(int fd, const ubx_entry_t *list)
+{
+    uint64_t fp = (mon_ver.payload_len > 0) ? ubx_cfg_fingerprint(list) : 0;
+    uint64_t cached = fp ? read_ubx_cfg_cache(false) : 0;
+
+    size_t count = ubx_list_len(list);
+    size_t tail = ubx_list_tail(list, count);
+
+    ubx_list_mode_t mode = force_config ? UBX_LIST_FULL : UBX_LIST_DIFF;
+    if (fp && !force_config && cached == fp) {
+        // spot check: the last CFG setting of the profile is still in place
+        struct ubx_pipe_entry check = {0};
+        if (tail == 0 || ubx_pipe_diff(fd, &check, &list[tail - 1], 1) == 0) {
+            TRACE("Receiver already configured (fingerprint %016llx)\n", (unsigned long long)fp);
+            STAT_INC(stats, ubx_cfg_cache_hits);
+            mode = UBX_LIST_BARRIERS;
+        } else {
+            TRACE("Receiver lost its configuration, checking every setting\n");
+        }
+    }
+
+    size_t written = 0;
+    int failed = send_ubx_list(fd, list, tail, mode, &written);
+    if (failed == 0 && written > 0)
+        failed += ubx_timing_verify(fd);
+    if (failed == 0 && persist_config) {
+        // only a recorded CFG-CFG of this fingerprint counts: RAM matching
+        // the profile says nothing about what BBR/flash hold, and RAM that
+        // had to be corrected may have been loaded from a different save
+        if (fp == 0 || written > 0 || read_ubx_cfg_cache(true) != fp) {
+            if (save_ublox_config(fd) == 0)
+                write_ubx_cfg_cache(fp, true);
+            else
+                write_ubx_cfg_cache(0, true);
+        }
+    }
+    failed += send_ubx_list(fd, &list[tail], count - tail, UBX_LIST_FULL, NULL);
+
+    write_ubx_cfg_cache(failed == 0 ? fp : 0, false);
+    return failed == 0 ? 0 : -1;
+}
+
+// Run 'list' with the timing settings inserted at index 'at'
+static int configure_ublox_list_timing(int fd, const ubx_entry_t *list, size_t at)
+{
+    if (ubx_timing_count == 0)
+        return configure_ublox_list(fd, list);
+
+    ubx_entry_t merged[UBX_LIST_MAX + UBX_TIMING_MAX + 1];
+    size_t count = ubx_list_len(list);
+    if (count > UBX_LIST_MAX) {
+        fprintf(stderr, "UBX list too long (%zu > %d)\n", count, UBX_LIST_MAX);
+        return -1;
+    }
+
+    // ubx_entry_t has const members, so the copy is made bytewise
+    memcpy(merged, list, at * sizeof(ubx_entry_t));
+    memcpy(&merged[at], ubx_timing_list, ubx_timing_count * sizeof(ubx_entry_t));
+    memcpy(&merged[at + ubx_timing_count], &list[at], (count - at + 1) * sizeof(ubx_entry_t));
+    return configure_ublox_list(fd, merged);
+}
+
+static int configure_ublox_profile(int fd, const ubx_entry_t *list)
+{
+    return configure_ublox_list_timing(fd, list, ubx_list_tail(list, ubx_list_len(list)));
+}
+
+// Publish the time-to-configured of one configuration run
+static void ubx_config_done(uint64_t start_ns)
+{
+    uint64_t elapsed_ns = monotonic_now_ns() - start_ns;
+    STAT_STORE(stats, ubx_cfg_last_ns, elapsed_ns);
+    STAT_INC(stats, ubx_cfg_runs);
+    TRACE("Receiver configured in %.1f ms\n", elapsed_ns / 1e6);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+ * configure_ublox_valcfg()
+ * ------------------------
+ * Generation 9+ counterpart of configure_ublox_profile().  Those receivers
+ * deprecate (M9/F9) or drop (M10) CFG-PRT, CFG-MSG and CFG-INF in favour of
+ * key-value items, see ubx_valcfg.h.
+ *
+ * One CFG-VALGET reads back up to 64 items, so the diff against the
+ * receiver's RAM layer costs a single round trip and makes the fingerprint
+ * cache unnecessary.  The items that differ go out in one CFG-VALSET, or in
+ * a VALSET transaction when there are more than 64.  With --persist-config
+ * the flash layer is compared the same way and only items that differ there
+ * are written to BBR and flash; no CFG-CFG save is needed.
+ */
+#define UBX_VALCFG_MIN_PROTVER  2700    // PROTVER 27.00, the first generation 9 firmware
+#define UBX_VALCFG_MAX_ITEMS    128
+#define UBX_VALCFG_KEEP         0xFF    // list entry leaves the rate alone
+
+// Protocol version from the MON-VER extensions ("PROTVER=27.11" or
+// "PROTVER 14.00") times 100, or 0 if the receiver does not report it
+static int ubx_protocol_version(void)
+{
+    for (size_t i = 0; i < mon_ver.ext_count; i++) {
+        char ext[sizeof(mon_ver.fields.extensions[0]) + 1];
+        int major, minor;
+        copy_ubx_string((const uint8_t *)mon_ver.fields.extensions[i], sizeof(mon_ver.fields.extensions[0]), ext);
+        if (sscanf(ext, "PROTVER%*[ =]%d.%d", &major, &minor) == 2)
+            return major * 100 + minor;
+    }
+    return 0;
+}
+
+// Port we talk to the receiver on.  Generation 10 parts no longer answer
+// CFG-PRT; they have no USB port, so UART1 is the safe guess.
+static uint8_t ubx_current_port(void)
+{
+    return (cfg_prt_valid && cfg_prt.portID <= UBX_PORT_SPI) ? cfg_prt.portID : UBX_PORT_UART1;
+}
+
+// Read 'n' items from one layer.  cur[i] receives the value and have[i]
+// whether the layer holds the key at all.  Returns 0, or -1 if a poll was
+// refused or not answered.
+static int ubx_valget(int fd, uint8_t layer, const ubx_valcfg_kv_t *kv, size_t n,
+                      uint64_t *cur, bool *have)
+{
+    for (size_t i = 0; i < n; i += UBX_VALGET_MAX_KEYS) {
+        size_t chunk = (n - i < UBX_VALGET_MAX_KEYS) ? n - i : UBX_VALGET_MAX_KEYS;
+        uint32_t keys[UBX_VALGET_MAX_KEYS];
+        for (size_t k = 0; k < chunk; k++)
+            keys[k] = kv[i + k].key;
+
+        uint8_t frame[UBX_MIN_MSG_SIZE + UBX_VALCFG_HDR_LEN + 4 * UBX_VALGET_MAX_KEYS];
+        size_t len = ubx_valget_build(frame, sizeof(frame), layer, 0, keys, chunk);
+        ubx_msg_t msg = { frame, len, &frame[6], len - UBX_MIN_MSG_SIZE, UBX_CLS_CFG, UBX_ID_CFG_VALGET };
+
+        ubx_parser_t parser = {0};
+        ubx_parser_init(&parser);
+        parser.filter_type = UBX_FILTER_RESPONSE_OR_ACK;
+        parser.filter_cls = msg.cls;
+        parser.filter_id = msg.id;
+        parser.filter_active = true;
+
+        ubx_parse_result_t res = send_ubx(fd, &msg, &parser);
+        if (res != UBX_PARSE_OK || parser.cls != UBX_CLS_CFG) {
+            TRACE("VALGET layer %u: %s\n", layer,
+                  res == UBX_PARSE_OK ? "unexpected ACK" : result_text(res));
+            return -1;
+        }
+        TRACE_UBX("Read    ", parser.raw, parser.length);
+        for (size_t k = 0; k < chunk; k++)
+            have[i + k] = ubx_valget_find(parser.payload, parser.payload_len, keys[k], &cur[i + k]);
+    }
+    return 0;
+}
+
+// Write 'n' items to 'layers'.  Frames of a transaction must be applied in
+// order, so they go one at a time rather than through a deeper pipeline.
+// Returns the number of frames that failed.
+static int ubx_valset(int fd, uint8_t layers, const ubx_valcfg_kv_t *kv, size_t n)
+{
+    size_t frames = (n + UBX_VALSET_MAX_KEYS - 1) / UBX_VALSET_MAX_KEYS;
+
+    for (size_t f = 0; f < frames; f++) {
+        size_t off = f * UBX_VALSET_MAX_KEYS;
+        size_t chunk = (n - off < UBX_VALSET_MAX_KEYS) ? n - off : UBX_VALSET_MAX_KEYS;
+        uint8_t txn = (frames == 1)          ? UBX_VALSET_TXN_NONE :
+                      (f == 0)               ? UBX_VALSET_TXN_BEGIN :
+                      (f == frames - 1)      ? UBX_VALSET_TXN_APPLY : UBX_VALSET_TXN_CONTINUE;
+
+        uint8_t frame[UBX_MAX_MSG_SIZE];
+        struct ubx_pipe_entry e = { .frame = frame, .cls = UBX_CLS_CFG, .id = UBX_ID_CFG_VALSET };
+        e.len = ubx_valset_build(frame, sizeof(frame), layers, txn, &kv[off], chunk);
+        if (e.len == 0) {
+            fprintf(stderr, "VALSET frame too long\n");
+            return 1;
+        }
+
+        int res = ubx_pipe_run(fd, &e, 1, false);
+        if (res != 0)
+            return res < 0 ? 1 : res;   // the receiver drops the unfinished transaction
+    }
+    return 0;
+}
+
+// Items of 'kv' whose value differs from cur/have, copied to 'out'
+static size_t ubx_valcfg_diff(const ubx_valcfg_kv_t *kv, size_t n, const uint64_t *cur,
+                              const bool *have, ubx_valcfg_kv_t *out, bool count_unchanged)
+{
+    size_t ndiff = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (have[i] && cur[i] == kv[i].value) {
+            if (count_unchanged) {
+                TRACE("Unchanged %s\n", ubx_valcfg_name(kv[i].key));
+                STAT_INC(stats, ubx_cfg_unchanged);
+            }
+            continue;
+        }
+        out[ndiff++] = kv[i];
+    }
+    return ndiff;
+}
+
+// Read 'n' items back from RAM.  Returns the number that do not hold 'kv'.
+static int ubx_valcfg_verify(int fd, const ubx_valcfg_kv_t *kv, size_t n)
+{
+    uint64_t cur[UBX_VALCFG_MAX_ITEMS];
+    bool have[UBX_VALCFG_MAX_ITEMS] = {0};
+    int failed = 0;
+
+    if (ubx_valget(fd, UBX_VALGET_RAM, kv, n, cur, have) != 0)
+        memset(have, 0, sizeof(have));
+    for (size_t i = 0; i < n; i++) {
+        if (!have[i] || cur[i] != kv[i].value) {
+            fprintf(stderr, "Receiver did not confirm %s=%llu\n", ubx_valcfg_name(kv[i].key),
+                    (unsigned long long)kv[i].value);
+            failed++;
+        }
+    }
+    return failed;
+}
+
+static int configure_ublox_valcfg(int fd, const ubx_valcfg_kv_t *list, size_t nlist)
+{
+    uint64_t cur[UBX_VALCFG_MAX_ITEMS];
+    bool have[UBX_VALCFG_MAX_ITEMS] = {0};
+    ubx_valcfg_kv_t diff[UBX_VALCFG_MAX_ITEMS];
+    ubx_valcfg_kv_t timing[UBX_TIMING_MAX_ITEMS];
+    ubx_valcfg_kv_t kv[UBX_VALCFG_MAX_ITEMS];
+
+    size_t ntiming = ubx_timing_valcfg(timing);
+    size_t n = nlist + ntiming;
+    if (n > UBX_VALCFG_MAX_ITEMS) {
+        fprintf(stderr, "Too many u-blox configuration items (%zu > %d)\n", n, UBX_VALCFG_MAX_ITEMS);
+        return -1;
+    }
+    if (nlist)
+        memcpy(kv, list, nlist * sizeof(kv[0]));
+    memcpy(&kv[nlist], timing, ntiming * sizeof(kv[0]));
+
+    // UBX output on, like the PORT switches at the head of the legacy lists
+    send_ubx_no_wait(fd, &set_valset_usb_ubxnmea);
+    send_ubx_no_wait(fd, &set_valset_uart1_ubxnmea);
+    usleep(5000);
+
+    if (!force_config && ubx_valget(fd, UBX_VALGET_RAM, kv, n, cur, have) != 0)
+        memset(have, 0, sizeof(have));      // cannot read back: write everything
+    size_t ndiff = ubx_valcfg_diff(kv, n, cur, have, diff, true);
+
+    int failed = 0;
+    if (ndiff)
+        failed = ubx_valset(fd, UBX_VAL_LAYER_RAM, diff, ndiff);
+    if (failed == 0 && ndiff && ntiming)
+        failed = ubx_valcfg_verify(fd, &kv[nlist], ntiming);
+
+    if (failed == 0 && persist_config) {
+        // a flash layer that holds none of the keys refuses the poll
+        memset(have, 0, sizeof(have));
+        ubx_valget(fd, UBX_VALGET_FLASH, kv, n, cur, have);
+        ndiff = ubx_valcfg_diff(kv, n, cur, have, diff, false);
+        if (ndiff) {
+            TRACE("Saving %zu u-blox settings to BBR/flash...\n", ndiff);
+            failed = ubx_valset(fd, UBX_VAL_LAYER_BBR | UBX_VAL_LAYER_FLASH, diff, ndiff);
+            if (failed == 0)
+                STAT_INC(stats, ubx_cfg_saves);
+        }
+    }
+
+    send_ubx_no_wait(fd, &set_valset_usb_nmea);
+    send_ubx_no_wait(fd, &set_valset_uart1_nmea);
+    usleep(5000);
+
+    return failed == 0 ? 0 : -1;
+}
+
+// Generation 9+ equivalents of the built-in NMEA lists below, on the port in use
+static const struct {
+    uint32_t key_i2c;           // CFG-MSGOUT-NMEA_ID_<msg>_I2C, + port ID for the others
+    uint8_t  zda_only;
+    uint8_t  nmea_default;
+} ubx_valcfg_nmea_rates[] = {
+    { UBX_KEY_CFG_MSGOUT_NMEA_ID_ZDA_I2C, 1, 0 },
+    { UBX_KEY_CFG_MSGOUT_NMEA_ID_GGA_I2C, 0, 1 },
+    { UBX_KEY_CFG_MSGOUT_NMEA_ID_GLL_I2C, 0, 1 },
+    { UBX_KEY_CFG_MSGOUT_NMEA_ID_GSA_I2C, 0, 1 },
+    { UBX_KEY_CFG_MSGOUT_NMEA_ID_GSV_I2C, 0, 1 },
+    { UBX_KEY_CFG_MSGOUT_NMEA_ID_RMC_I2C, 0, 1 },
+    { UBX_KEY_CFG_MSGOUT_NMEA_ID_VTG_I2C, 0, 1 },
+    { UBX_KEY_CFG_MSGOUT_NMEA_ID_GRS_I2C, 0, UBX_VALCFG_KEEP },
+    { UBX_KEY_CFG_MSGOUT_NMEA_ID_GST_I2C, 0, UBX_VALCFG_KEEP },
+    { UBX_KEY_CFG_MSGOUT_NMEA_ID_GBS_I2C, 0, UBX_VALCFG_KEEP },
+    { UBX_KEY_CFG_MSGOUT_NMEA_ID_DTM_I2C, 0, UBX_VALCFG_KEEP },
+    { UBX_KEY_CFG_MSGOUT_NMEA_ID_GNS_I2C, 0, UBX_VALCFG_KEEP },
+};
+
+static size_t ubx_valcfg_nmea_list(bool zda_only, ubx_valcfg_kv_t *kv)
+{
+    uint8_t port = ubx_current_port();
+    size_t n = 0;
+
+    for (size_t i = 0; i < SIZEOF(ubx_valcfg_nmea_rates); i++) {
+        uint8_t rate = zda_only ? ubx_valcfg_nmea_rates[i].zda_only : ubx_valcfg_nmea_rates[i].nmea_default;
+        if (rate != UBX_VALCFG_KEEP)
+            kv[n++] = (ubx_valcfg_kv_t){ ubx_valcfg_nmea_rates[i].key_i2c + port, rate };
+    }
+    if (zda_only)
+        kv[n++] = (ubx_valcfg_kv_t){ UBX_KEY_CFG_INFMSG_NMEA_I2C + port, 0 };
+    kv[n++] = (ubx_valcfg_kv_t){ UBX_KEY_CFG_SIGNAL_GLO_ENA, zda_only ? 0 : 1 };
+    return n;
+}
+
+static int configure_ublox_zda_only(int fd)
+{
+    if (atomic_load(&ubx_valcfg_mode)) {
+        ubx_valcfg_kv_t kv[UBX_VALCFG_MAX_ITEMS];
+        return configure_ublox_valcfg(fd, kv, ubx_valcfg_nmea_list(true, kv));
+    }
+
+    UBX_BEGIN_LIST
+        UBX_FUNCTION(set_cfg_prt_usb_ubxnmea,   send_ubx_no_wait)
+        UBX_FUNCTION(set_cfg_prt_uart1_ubxnmea, send_ubx_no_wait)
+        UBX_FUNCTION(set_cfg_inf_off,           send_ubx_handle_ack)
+        UBX_FUNCTION(set_cfg_msg_nmea_zda_on,   send_ubx_handle_ack)
+        UBX_FUNCTION(set_cfg_gnss_glonass_configure_off, send_ubx_handle_ack)
+        UBX_FUNCTION(set_cfg_msg_nmea_gga_off,  send_ubx_handle_ack)
+        UBX_FUNCTION(set_cfg_msg_nmea_gll_off,  send_ubx_handle_ack)
+        UBX_FUNCTION(set_cfg_msg_nmea_gsa_off,  send_ubx_handle_ack)
+        UBX_FUNCTION(set_cfg_msg_nmea_gsv_off,  send_ubx_handle_ack)
+        UBX_FUNCTION(set_cfg_msg_nmea_rmc_off,  send_ubx_handle_ack)
+        UBX_FUNCTION(set_cfg_msg_nmea_vtg_off,  send_ubx_handle_ack)
+        UBX_FUNCTION(set_cfg_msg_nmea_grs_off,  send_ubx_handle_ack)
+        UBX_FUNCTION(set_cfg_msg_nmea_gst_off,  send_ubx_handle_ack)
+        UBX_FUNCTION(set_cfg_msg_nmea_gbs_off,  send_ubx_handle_ack)
+        UBX_FUNCTION(set_cfg_msg_nmea_dtm_off,  send_ubx_handle_ack)
+        UBX_FUNCTION(set_cfg_msg_nmea_gns_off,  send_ubx_handle_ack)
+        UBX_FUNCTION(set_cfg_prt_usb_nmea,      send_ubx_no_wait)
+        UBX_FUNCTION(set_cfg_prt_uart1_nmea,    send_ubx_no_wait)
+    UBX_END_LIST
+
+    return configure_ublox_profile(fd, ubxArrayList);
+}
+
+// Wait for UBX-MON-VER message
+int get_ublox_version(int fd)
+{
+    UBX_BEGIN_LIST
+        UBX_FUNCTION(set_cfg_prt_usb_ubxnmea,   send_ubx_no_wait)
+        UBX_FUNCTION(set_cfg_prt_uart1_ubxnmea, send_ubx_no_wait)
+        UBX_FUNCTION(set_valset_usb_ubxnmea,    send_ubx_no_wait)
+        UBX_FUNCTION(set_valset_uart1_ubxnmea,  send_ubx_no_wait)
+        UBX_FUNCTION(get_cfg_gnss,              send_ubx_handle_generic)
+        UBX_FUNCTION(get_cfg_inf_nmea,          send_ubx_handle_generic)
+        UBX_FUNCTION(get_cfg_prt,               send_ubx_handle_cfg_prt)
+        UBX_FUNCTION(get_mon_ver,               send_ubx_handle_mon_ver)
+    UBX_END_LIST
+    UBX_INVOKE(fd);
+
+    const ubx_mon_ver_t *ver = &mon_ver.fields;
+    TRACE("u-blox Device Port: %u(%s)\n", cfg_prt.portID, ubx_port_str(cfg_prt.portID));
+    TRACE("u-blox Software Version: %s\n", ver->swVersion);
+    TRACE("u-blox Hardware Version: %s\n", ver->hwVersion);
+    for (int i = 0; i < mon_ver.ext_count; i++)
+        TRACE("u-blox Extension[%d]: %s\n", i, ver->extensions[i]);
+
+    int protver = ubx_protocol_version();
+    atomic_store(&ubx_valcfg_mode, protver >= UBX_VALCFG_MIN_PROTVER);
+    if (protver)
+        TRACE("u-blox Protocol Version: %d.%02d (%s configuration)\n", protver / 100, protver % 100,
+              protver >= UBX_VALCFG_MIN_PROTVER ? "key-value" : "legacy");
+
+    // the chip id tells two receivers of the same model apart (fingerprint)
+    ubx_unique_id_len = 0;
+    if (protver >= 1800 && send_ubx_handle_sec_uniqid(fd, &get_sec_uniqid) == UBX_PARSE_OK &&
+        ubx_unique_id_len)
+        TRACE("u-blox Unique ID: %s\n", format_ubx_bytes(ubx_unique_id, ubx_unique_id_len));
+
+    return 1;
+}
+
+// Undo configure_ublox_zda_only(): restore the u-blox default NMEA set
+int configure_ublox_nmea_default(int fd)
+{
+    if (atomic_load(&ubx_valcfg_mode)) {
+        ubx_valcfg_kv_t kv[UBX_VALCFG_MAX_ITEMS];
+        return configure_ublox_valcfg(fd, kv, ubx_valcfg_nmea_list(false, kv));
+    }
+
+    UBX_BEGIN_LIST
+        UBX_FUNCTION(set_cfg_prt_usb_ubxnmea,   send_ubx_no_wait)
+        UBX_FUNCTION(set_cfg_prt_uart1_ubxnmea, send_ubx_no_wait)
+        UBX_FUNCTION(set_cfg_gnss_glonass_configure_on, send_ubx_handle_ack)
+        UBX_FUNCTION(set_cfg_msg_nmea_gga_on,   send_ubx_handle_ack)
+        UBX_FUNCTION(set_cfg_msg_nmea_gll_on,   send_ubx_handle_ack)
+        UBX_FUNCTION(set_cfg_msg_nmea_gsa_on,   send_ubx_handle_ack)
+        UBX_FUNCTION(set_cfg_msg_nmea_gsv_on,   send_ubx_handle_ack)
+        UBX_FUNCTION(set_cfg_msg_nmea_rmc_on,   send_ubx_handle_ack)
+        UBX_FUNCTION(set_cfg_msg_nmea_vtg_on,   send_ubx_handle_ack)
+        UBX_FUNCTION(set_cfg_msg_nmea_zda_off,  send_ubx_handle_ack)
+        UBX_FUNCTION(set_cfg_prt_usb_nmea,      send_ubx_no_wait)
+        UBX_FUNCTION(set_cfg_prt_uart1_nmea,    send_ubx_no_wait)
+    UBX_END_LIST
+
+    return configure_ublox_profile(fd, ubxArrayList);
+}
+
+// Timing settings alone, for a receiver otherwise left on its own NMEA set
+static int configure_ublox_timing(int fd)
+{
+    if (atomic_load(&ubx_valcfg_mode))
+        return configure_ublox_valcfg(fd, NULL, 0);
+
+    UBX_BEGIN_LIST
+        UBX_FUNCTION(set_cfg_prt_usb_ubxnmea,   send_ubx_no_wait)
+        UBX_FUNCTION(set_cfg_prt_uart1_ubxnmea, send_ubx_no_wait)
+        UBX_FUNCTION(set_cfg_prt_usb_nmea,      send_ubx_no_wait)
+        UBX_FUNCTION(set_cfg_prt_uart1_nmea,    send_ubx_no_wait)
+    UBX_END_LIST
+
+    return configure_ublox_list_timing(fd, ubxArrayList, 2);
+}
+
+int configure_ublox_nmea_only(int fd)
+{
+    UBX_BEGIN_LIST
+        UBX_FUNCTION(set_cfg_inf_off,           send_ubx_no_wait)
+        UBX_FUNCTION(set_cfg_prt_usb_nmea,      send_ubx_no_wait)
+        UBX_FUNCTION(set_cfg_prt_uart1_nmea,    send_ubx_no_wait)
+    UBX_END_LIST
+    UBX_INVOKE(fd);
+
+    return 1;
+}
+
+// UBX output on our port and USB, or back to NMEA only
+static void ubx_output_set(int fd, bool ubx)
+{
+    if (atomic_load(&ubx_valcfg_mode)) {
+        send_ubx_no_wait(fd, ubx ? &set_valset_usb_ubxnmea : &set_valset_usb_nmea);
+        send_ubx_no_wait(fd, ubx ? &set_valset_uart1_ubxnmea : &set_valset_uart1_nmea);
+    } else {
+        send_ubx_no_wait(fd, ubx ? &set_cfg_prt_usb_ubxnmea : &set_cfg_prt_usb_nmea);
+        send_ubx_no_wait(fd, ubx ? &set_cfg_prt_uart1_ubxnmea : &set_cfg_prt_uart1_nmea);
+    }
+    usleep(5000);
+}
+
+// True if ubx_output_resume() keeps UBX output on
+static bool ubx_output_kept(void)
+{
+    return health_interval_s != 0 || utc_tacc_max_ns != 0 || survey_min_s != 0;
+}
+
+/*
+ * ubx_output_resume()
+ * -------------------
+ * The configuration lists end by switching the port to NMEA-only output,
+ * which would leave health polls unanswered and NAV-TIMEUTC and NAV-PVT
+ * unsent.  Turns UBX output back on when any of them is enabled, and with
+ * --utc-valid enables NAV-TIMEUTC once per navigation epoch on our port.
+ */
+static void ubx_output_resume(int fd)
+{
+    if (!ubx_output_kept())
+        return;
+    ubx_output_set(fd, true);
+
+    if (utc_tacc_max_ns == 0)
+        return;
+    int failed;
+    if (atomic_load(&ubx_valcfg_mode)) {
+        ubx_valcfg_kv_t kv = { UBX_KEY_CFG_MSGOUT_UBX_NAV_TIMEUTC_I2C + ubx_current_port(), 1 };
+        failed = ubx_valset(fd, UBX_VAL_LAYER_RAM, &kv, 1) != 0;
+    } else {
+        failed = send_ubx_handle_ack(fd, &set_cfg_msg_nav_timeutc_on) != UBX_PARSE_OK;
+    }
+    if (failed)
+        fprintf(stderr, "Failed to enable UBX-NAV-TIMEUTC output\n");
+}
+
+/*
+ * survey_send_tmode()
+ * -------------------
+ * Puts a u-blox timing receiver in fixed-position mode at 'pos' (ECEF [m])
+ * with 3D accuracy 'acc' [m], or back to navigation with pos == NULL, and
+ * switches the NAV-PVT survey feed off or on to match.  CFG-TMODE-* keys
+ * from generation 9, UBX-CFG-TMODE2 before.  Returns 0 if acknowledged.
+ */
+static int survey_send_tmode(int fd, const double *pos, double acc)
+{
+    bool valcfg = atomic_load(&ubx_valcfg_mode);
+    int rc;
+
+    if (valcfg) {
+        // whole centimetres plus a 0.1 mm remainder of the same sign
+        int32_t cm[3] = {0};
+        int8_t hp[3] = {0};
+        for (int i = 0; pos && i < 3; i++) {
+            long long t = llround(pos[i] * 10000.0);
+            cm[i] = (int32_t)(t / 100);
+            hp[i] = (int8_t)(t % 100);
+        }
+        ubx_valcfg_kv_t kv[] = {
+            { UBX_KEY_CFG_TMODE_MODE,          pos ? UBX_TMODE_FIXED : UBX_TMODE_DISABLED },
+            { UBX_KEY_CFG_TMODE_POS_TYPE,      0 },    // ECEF
+            { UBX_KEY_CFG_TMODE_ECEF_X,        (uint64_t)(int64_t)cm[0] },
+            { UBX_KEY_CFG_TMODE_ECEF_Y,        (uint64_t)(int64_t)cm[1] },
+            { UBX_KEY_CFG_TMODE_ECEF_Z,        (uint64_t)(int64_t)cm[2] },
+            { UBX_KEY_CFG_TMODE_ECEF_X_HP,     (uint64_t)(int64_t)hp[0] },
+            { UBX_KEY_CFG_TMODE_ECEF_Y_HP,     (uint64_t)(int64_t)hp[1] },
+            { UBX_KEY_CFG_TMODE_ECEF_Z_HP,     (uint64_t)(int64_t)hp[2] },
+            { UBX_KEY_CFG_TMODE_FIXED_POS_ACC, (uint64_t)llround(acc * 10000.0) },
+        };
+        rc = ubx_valset(fd, UBX_VAL_LAYER_RAM, kv, pos ? SIZEOF(kv) : 1);
+    } else {
+        ubx_cfg_tmode2_t tm = {0};
+        if (pos) {
+            tm.timeMode = UBX_TMODE_FIXED;
+            tm.ecefXOrLat = (int32_t)llround(pos[0] * 100.0);
+            tm.ecefYOrLon = (int32_t)llround(pos[1] * 100.0);
+            tm.ecefZOrAlt = (int32_t)llround(pos[2] * 100.0);
+            tm.fixedPosAcc = (uint32_t)llround(acc * 1000.0);
+        }
+        uint8_t frame[UBX_MIN_MSG_SIZE + sizeof(tm)];
+        size_t len = ubx_frame_build(frame, sizeof(frame), UBX_CLS_CFG, UBX_ID_CFG_TMODE2, &tm, sizeof(tm));
+        ubx_msg_t msg = { frame, len, &frame[6], sizeof(tm), UBX_CLS_CFG, UBX_ID_CFG_TMODE2 };
+        rc = send_ubx_handle_ack(fd, &msg) == UBX_PARSE_OK ? 0 : -1;
+    }
+
+    int failed;
+    if (valcfg) {
+        ubx_valcfg_kv_t kv = { UBX_KEY_CFG_MSGOUT_UBX_NAV_PVT_I2C + ubx_current_port(), pos ? 0 : 1 };
+        failed = ubx_valset(fd, UBX_VAL_LAYER_RAM, &kv, 1) != 0;
+    } else {
+        failed = send_ubx_handle_ack(fd, pos ? &set_cfg_msg_nav_pvt_off : &set_cfg_msg_nav_pvt_on) != UBX_PARSE_OK;
+    }
+    if (failed)
+        TRACE("Failed to switch UBX-NAV-PVT output %s\n", pos ? "off" : "on");
+    return rc;
+}
+
+// Send the surveyed or stored position to the receiver and keep it for the next start
+static void survey_push(int fd)
+{
+    atomic_store(&survey_push_pending, 0);
+    pthread_mutex_lock(&shared_state_mutex);
+    double pos[3] = { survey.pos[0], survey.pos[1], survey.pos[2] };
+    double acc = survey.acc;
+    survey_source_t source = survey.source;
+    pthread_mutex_unlock(&shared_state_mutex);
+
+    if (source != SURVEY_SRC_FILE)
+        write_survey_seed(pos, acc);
+
+    // fixes are correlated, so the limit is the more honest accuracy figure
+    survey_state_t state = SURVEY_STORED;
+    if (atomic_load(&receiver_family) == GPS_FAMILY_UBLOX) {
+        if (survey_send_tmode(fd, pos, acc > survey_acc_m ? acc : survey_acc_m) == 0) {
+            fprintf(stderr, "Receiver in fixed-position timing mode\n");
+            state = SURVEY_FIXED;
+        } else {
+            fprintf(stderr, "Receiver rejected fixed-position mode: position stored only\n");
+        }
+    }
+
+    pthread_mutex_lock(&shared_state_mutex);
+    survey.state = state;
+    pthread_mutex_unlock(&shared_state_mutex);
+}
+
+// Start surveying from scratch, dropping any stored position
+static void survey_restart(int fd)
+{
+    atomic_store(&survey_restart_pending, 0);
+    char path[PATH_MAX_LEN + 32];
+    survey_path(path, sizeof(path));
+    if (unlink(path) == 0)
+        TRACE("Removed %s\n", path);
+
+    if (atomic_load(&receiver_family) == GPS_FAMILY_UBLOX && survey_send_tmode(fd, NULL, 0) != 0)
+        fprintf(stderr, "Failed to take the receiver out of fixed-position mode\n");
+
+    pthread_mutex_lock(&shared_state_mutex);
+    gps_survey_reset(&survey.s);
+    survey.state = SURVEY_RUNNING;
+    survey.source = SURVEY_SRC_NONE;
+    survey.start_ns = survey.last_ns = 0;
+    pthread_mutex_unlock(&shared_state_mutex);
+    TRACE("Position survey started\n");
+}
+
+// At start: resume from the stored position, or begin surveying
+static void survey_init(int fd)
+{
+    double pos[3], acc;
+    if (survey_min_s == 0)
+        return;
+    if (read_survey_seed(pos, &acc) != 0) {
+        survey_restart(fd);
+        return;
+    }
+
+    pthread_mutex_lock(&shared_state_mutex);
+    memcpy(survey.pos, pos, sizeof(survey.pos));
+    survey.acc = acc;
+    survey.source = SURVEY_SRC_FILE;
+    survey.state = SURVEY_CONVERGED;
+    pthread_mutex_unlock(&shared_state_mutex);
+    TRACE("Loaded stored position: %.4f %.4f %.4f (%.3f m)\n", pos[0], pos[1], pos[2], acc);
+    survey_push(fd);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+ * load_ublox_profile()
+ * --------------------
+ * Compiles --profile into ubx_profile once at startup and builds the
+ * ubx_entry_t list the configuration engine runs.  Port switches are sent
+ * without waiting; every other frame is ACK-checked and pipelined.
+ */
+static int load_ublox_profile(const char *name)
+{
+    char err[512];
+    if (ubx_profile_load(name, &ubx_profile, err, sizeof(err)) != 0) {
+        fprintf(stderr, "Invalid u-blox profile: %s\n", err);
+        return -1;
+    }
+    if (ubx_profile.count > UBX_LIST_MAX) {
+        fprintf(stderr, "Invalid u-blox profile: %s: more than %d settings\n", ubx_profile.path, UBX_LIST_MAX);
+        return -1;
+    }
+
+    // ubx_msg_t and ubx_entry_t have const members, so they are built in
+    // place rather than assigned
+    ubx_msg_t *msgs = calloc(ubx_profile.count, sizeof(ubx_msg_t));
+    ubx_entry_t *list = calloc(ubx_profile.count + 1, sizeof(ubx_entry_t));
+    if (!msgs || !list) {
+        perror("calloc");
+        free(msgs);
+        free(list);
+        return -1;
+    }
+    for (size_t i = 0; i < ubx_profile.count; i++) {
+        const uint8_t *frame = ubx_profile.frame[i];
+        size_t len = ubx_profile.len[i];
+        memcpy(&msgs[i], &(ubx_msg_t){ frame, len, &frame[6], len - UBX_MIN_MSG_SIZE, frame[2], frame[3] },
+               sizeof(ubx_msg_t));
+        memcpy(&list[i], &(ubx_entry_t){ &msgs[i], ubx_profile.no_wait[i] ? send_ubx_no_wait : send_ubx_handle_ack },
+               sizeof(ubx_entry_t));
+    }
+
+    profile_list = list;
+    TRACE("Loaded u-blox profile %s (%zu frames)\n", ubx_profile.path, ubx_profile.count);
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+#define GPS_PROBE_MS    1200    // one 1 Hz output cycle plus margin
+
+/*
+ * gps_listen()
+ * ------------
+ * Parses receiver input until 'deadline_ns', or until the receiver has been
+ * identified ('want_acks' < 0) or has answered 'want_acks' vendor commands.
+ * Any complete UBX frame identifies a u-blox.  Returns 0, or -1 on a read
+ * error.
+ */
+static int gps_listen(int fd, uint64_t deadline_ns, int want_acks)
+{
+    ubx_parser_t parser;
+    ubx_parser_init(&parser);
+    int rc = 0;
+
+    gps_listen_state.active = true;
+    while (!atomic_load(&stop)) {
+        if (want_acks < 0 ? gps_listen_state.family != GPS_FAMILY_NMEA
+                          : gps_listen_state.acks + gps_listen_state.naks >= want_acks)
+            break;
+
+        if (ubx_rx.off < ubx_rx.len) {
+            size_t used;
+            ubx_parse_result_t res = ubx_parser_feed_buf(&parser, &ubx_rx.buf[ubx_rx.off],
+                                                         ubx_rx.len - ubx_rx.off, &used);
+            ubx_rx.off += used;
+            if (res == UBX_PARSE_OK && gps_listen_state.family == GPS_FAMILY_NMEA) {
+                gps_listen_state.family = GPS_FAMILY_UBLOX;
+                TRACE_UBX("Identified u-blox receiver from ", parser.raw, parser.length);
+            }
+            continue;
+        }
+
+        int ret = ubx_rx_wait(fd, deadline_ns);
+        if (ret == 0)
+            break;
+        if (ret < 0 || ubx_rx_read(fd) < 0) {
+            rc = -1;
+            break;
+        }
+    }
+    gps_listen_state.active = false;
+    return rc;
+}
+
+/*
+ * probe_receiver_family()
+ * -----------------------
+ * Identifies the receiver before anything is configured.  One burst of
+ * queries goes out at once: the frames get_ublox_version() starts with
+ * (UBX output back on for USB and UART1, then MON-VER) and the NMEA version
+ * query of every other family.  The first reply, or an identifying sentence
+ * in the normal output, decides, so a non-u-blox receiver costs one short
+ * listen instead of a UBX timeout per frame.  A receiver that stays silent
+ * is still tried as a u-blox with NMEA switched off.
+ */
+static gps_family_t probe_receiver_family(int fd)
+{
+    static const ubx_msg_t * const ubx_probe[] = {
+        &set_cfg_prt_usb_ubxnmea,
+        &set_cfg_prt_uart1_ubxnmea,
+        &set_valset_usb_ubxnmea,
+        &set_valset_uart1_ubxnmea,
+        &get_mon_ver,
+    };
+    char nmea[128];
+    size_t len = 0;
+    for (size_t i = 0; i < SIZEOF(gps_vendor_probe); i++) {
+        len = gps_nmea_append(nmea, len, sizeof(nmea), gps_vendor_probe[i]);
+        TRACE("Write   $%s\n", gps_vendor_probe[i]);
+    }
+
+    TRACE("Probing receiver family...\n");
+    gps_listen_state.family = GPS_FAMILY_NMEA;
+    gps_listen_state.ack_family = GPS_FAMILY_NMEA;
+    gps_listen_state.lines = 0;
+    ubx_rx_flush(fd);
+    uint64_t start_ns = monotonic_now_ns();
+
+    for (size_t i = 0; i < SIZEOF(ubx_probe); i++) {
+        TRACE_UBX("Write   ", ubx_probe[i]->data, ubx_probe[i]->length);
+        if (write_all(fd, (const char *)ubx_probe[i]->data, ubx_probe[i]->length) != 0)
+            perror("write");
+        tcdrain(fd);
+        usleep(5000);
+    }
+    if (write_all(fd, nmea, len) != 0)
+        perror("write");
+    tcdrain(fd);
+
+    uint64_t listen_ms = ubx_timeout_ms > GPS_PROBE_MS ? (uint64_t)ubx_timeout_ms : GPS_PROBE_MS;
+    gps_listen(fd, start_ns + listen_ms * 1000000ULL, -1);
+
+    gps_family_t family = gps_listen_state.family;
+    if (family == GPS_FAMILY_NMEA && gps_listen_state.lines == 0) {
+        TRACE("No output from receiver, trying UBX anyway\n");
+        family = GPS_FAMILY_UBLOX;
+    }
+    TRACE("Receiver family: %s (probe took %" PRIu64 " ms)\n", gps_family_name(family),
+          (monotonic_now_ns() - start_ns) / 1000000);
+    return family;
+}
+
+/*
+ * configure_vendor_nmea()
+ * -----------------------
+ * Selects an NMEA output set on an MTK, Quectel or SiRF receiver and waits
+ * for the commands to be acknowledged where the family does so.  Retries
+ * like a UBX frame.  Returns 0 on success.
+ */
+static int configure_vendor_nmea(int fd, gps_family_t family, gps_nmea_set_t set)
+{
+    char buf[512];
+    int acks;
+    size_t len = gps_vendor_nmea_config(family, set, buf, sizeof(buf), &acks);
+    if (len == 0 || len >= sizeof(buf)) {
+        fprintf(stderr, "No NMEA command set for %s receivers\n", gps_family_name(family));
+        return -1;
+    }
+
+    for (int attempt = 1; attempt <= ubx_attempts; attempt++) {
+        ubx_rx_flush(fd);
+        gps_listen_state.ack_family = family;
+        gps_listen_state.acks = gps_listen_state.naks = 0;
+
+        for (const char *line = buf; line < buf + len; ) {
+            const char *end = strchr(line, '\r');
+            TRACE("Write   %.*s\n", (int)(end - line), line);
+            line = end + 2;
+        }
+        if (write_all(fd, buf, len) != 0) {
+            perror("write");
+            return -1;
+        }
+        tcdrain(fd);
+        if (acks == 0)
+            return 0;   // SiRF does not acknowledge
+
+        if (gps_listen(fd, monotonic_now_ns() + (uint64_t)ubx_timeout_ms * 1000000ULL, acks) != 0)
+            return -1;
+        if (gps_listen_state.acks == acks)
+            return 0;
+        if (gps_listen_state.naks > 0)
+            return -1;  // rejected: repeating will not help
+
+        TRACE("No acknowledgement from %s receiver (attempt %d/%d)\n",
+              gps_family_name(family), attempt, ubx_attempts);
+        if (attempt < ubx_attempts && ubx_backoff_ms > 0)
+            usleep((useconds_t)ubx_backoff_ms * 1000 * attempt);
+    }
+    return -1;
+}
+
+int gps_init(int fd)
+{
+    // Determine GPS type and optionally configure it
+    gps_family_t family = receiver_opt >= 0 ? (gps_family_t)receiver_opt : probe_receiver_family(fd);
+    atomic_store(&receiver_family, family);
+
+    if (family != GPS_FAMILY_UBLOX) {
+        if (profile_list || ubx_timing_count > 0 || utc_tacc_max_ns > 0)
+            fprintf(stderr, "Ignoring u-blox settings for a %s receiver\n", gps_family_name(family));
+        if (family == GPS_FAMILY_NMEA) {
+            TRACE("Unidentified receiver: leaving its NMEA output alone\n");
+        } else {
+            TRACE("Configuring %s receiver for %s output...\n", gps_family_name(family),
+                  ublox_zda_only ? "ZDA-only" : "RMC+ZDA");
+            if (configure_vendor_nmea(fd, family, ublox_zda_only ? GPS_NMEA_ZDA_ONLY : GPS_NMEA_TIME) != 0)
+                fprintf(stderr, "Failed to configure %s receiver NMEA output\n", gps_family_name(family));
+        }
+    } else if (get_ublox_version(fd)) {
+
+        // nothing reaches SHM until NAV-TIMEUTC vouches for the time
+        if (utc_tacc_max_ns > 0)
+            health_set_gate(NTPGPS_HEALTH_UTC, NTPGPS_HEALTH_UTC);
+
+        if (profile_list) {
+            TRACE("Applying u-blox profile %s...\n", ubx_profile.path);
+            uint64_t start_ns = monotonic_now_ns();
+            if (configure_ublox_profile(fd, profile_list) != 0) {
+                fprintf(stderr, "Failed to apply u-blox profile %s\n", ubx_profile.path);
+            }
+            ubx_config_done(start_ns);
+
+        // Configure u-blox GPS to output ZDA only
+        } else if (ublox_zda_only) {
+            TRACE("Configuring u-blox for ZDA-only output...\n");
+            uint64_t start_ns = monotonic_now_ns();
+            if (configure_ublox_zda_only(fd) != 0) {
+                fprintf(stderr, "Failed to configure u-blox ZDA-only mode\n");
+            }
+            ubx_config_done(start_ns);
+        } else {
+            if (ubx_timing_count > 0) {
+                TRACE("Configuring u-blox timepulse and navigation rate...\n");
+                uint64_t start_ns = monotonic_now_ns();
+                if (configure_ublox_timing(fd) != 0) {
+                    fprintf(stderr, "Failed to configure u-blox timepulse/navigation rate\n");
+                }
+                ubx_config_done(start_ns);
+            }
+            if (!configure_ublox_nmea_only(fd)) {
+                fprintf(stderr, "Failed to enable NMEA output\n");
+            }
+        }
+        ubx_output_resume(fd);
+    } else {
+        fprintf(stderr, "Failed to get UBX-MON-VER\n");
+    }
+    survey_init(fd);
+
+    return 1;
+}
+
+// The rate SETBAUD left the receiver at, kept in /run as long as its RAM
+// settings last, so a restarted writer opens the tty at that rate
+static int read_serial_baud(int unit)
+{
+    char path[108];
+    snprintf(path, sizeof(path), baud_path_fmt, unit);
+    FILE *f = fopen(path, "r");
+    if (!f)
+        return 9600;
+    int baud = 0;
+    if (fscanf(f, "%d", &baud) != 1 || baud_to_speed(baud) == B0)
+        baud = 9600;
+    fclose(f);
+    TRACE("Serial rate %d baud from %s\n", baud, path);
+    return baud;
+}
+
+// Remember 'baud' for read_serial_baud(); 0 (receiver gone) forgets it
+static void write_serial_baud(int baud)
+{
+    char path[108];
+    snprintf(path, sizeof(path), baud_path_fmt, stats->unit);
+    if (baud == 0 || baud == 9600) {
+        if (unlink(path) < 0 && errno != ENOENT)
+            perror("unlink");
+        return;
+    }
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        TRACE("Failed to write %s: %s\n", path, strerror(errno));
+        return;
+    }
+    fprintf(f, "%d\n", baud);
+    fclose(f);
+}
+
+static int set_serial_speed(int fd, int baud)
+{
+    struct termios tio;
+    if (tcgetattr(fd, &tio) < 0) { perror("tcgetattr"); return -1; }
+    cfsetispeed(&tio, baud_to_speed(baud));
+    cfsetospeed(&tio, baud_to_speed(baud));
+    if (tcsetattr(fd, TCSADRAIN, &tio) < 0) { perror("tcsetattr"); return -1; }
+    return 0;
+}
+
+// Move the receiver's UART1 and our tty to a new baud rate.  The receiver
+// switches first; the new rate is then confirmed by polling UBX-CFG-PRT, or
+// CFG-UART1-BAUDRATE on generation 9+.  A receiver on USB (or one that is
+// not a u-blox) only needs the tty change.
+static int configure_baud(int fd, int baud)
+{
+    int old_baud = serial_baud;
+    bool valcfg = atomic_load(&ubx_valcfg_mode);
+    bool uart = valcfg ? ubx_current_port() == UBX_PORT_UART1 : cfg_prt.portID == UBX_PORT_UART1;
+    ubx_valcfg_kv_t kv = { UBX_KEY_CFG_UART1_BAUDRATE, (uint64_t)baud };
+
+    if (uart && valcfg) {
+        uint8_t frame[UBX_MIN_MSG_SIZE + UBX_VALCFG_HDR_LEN + 8];
+        size_t len = ubx_valset_build(frame, sizeof(frame), UBX_VAL_LAYER_RAM, UBX_VALSET_TXN_NONE, &kv, 1);
+        ubx_msg_t msg = { frame, len, &frame[6], len - UBX_MIN_MSG_SIZE, UBX_CLS_CFG, UBX_ID_CFG_VALSET };
+        send_ubx_no_wait(fd, &msg);
+        usleep(100000);  // the receiver answers at the old rate, then switches
+    } else if (uart) {
+        ubx_cfg_prt_t prt = cfg_prt;
+        prt.baudRate = baud;
+
+        uint8_t frame[UBX_MIN_MSG_SIZE + sizeof(prt)];
+        size_t len = ubx_frame_build(frame, sizeof(frame), UBX_CLS_CFG, UBX_ID_CFG_PRT, &prt, sizeof(prt));
+        ubx_msg_t msg = { frame, len, &frame[6], sizeof(prt), UBX_CLS_CFG, UBX_ID_CFG_PRT };
+        send_ubx(fd, &msg, NULL);   // not send_ubx_no_wait(), which keeps the old rate
+        usleep(100000);  // the receiver answers at the old rate, then switches
+    }
+
+    if (set_serial_speed(fd, baud) != 0)
+        return -1;
+    tcflush(fd, TCIFLUSH);  // bytes straddling the switch are garbage
+    ubx_rx.off = ubx_rx.len = 0;
+
+    if (uart) {
+        uint64_t cur = 0;
+        bool have = false;
+        bool confirmed = valcfg ?
+            ubx_valget(fd, UBX_VALGET_RAM, &kv, 1, &cur, &have) == 0 && have && cur == (uint64_t)baud :
+            send_ubx_handle_cfg_prt(fd, &get_cfg_prt_uart1) == UBX_PARSE_OK && cfg_prt.baudRate == (uint32_t)baud;
+        if (!confirmed) {
+            fprintf(stderr, "Receiver did not confirm %d baud, staying at %d\n", baud, old_baud);
+            set_serial_speed(fd, old_baud);
+            return -1;
+        }
+    }
+
+    TRACE("Serial port now at %d baud\n", baud);
+    return 0;
+}
+
+/*
+ * apply_pending_reconfig()
+ * ------------------------
+ * Carries out changes queued by SETZDAONLY and SETBAUD.  Runs in the GPS
+ * thread between sentences, without shared_state_mutex held; NMEA that
+ * arrives during the UBX exchange is still parsed and written to SHM.
+ */
+static void apply_pending_reconfig(int fd, struct nmea_capture *cap)
+{
+    pthread_mutex_lock(&shared_state_mutex);
+    int zda_only = pending_zda_only;
+    int baud = pending_baud;
+    pending_zda_only = -1;
+    pending_baud = 0;
+    atomic_store(&reconfig_pending, 0);
+    reconfig_state = "running";
+    pthread_mutex_unlock(&shared_state_mutex);
+
+    int failed = 0;
+    ubx_nmea_capture = cap;
+
+    gps_family_t family = atomic_load(&receiver_family);
+    if (zda_only >= 0 && family != GPS_FAMILY_UBLOX) {
+        TRACE("Reconfiguring %s receiver for %s output...\n", gps_family_name(family),
+              zda_only ? "ZDA-only" : "default NMEA");
+        failed |= configure_vendor_nmea(fd, family, zda_only ? GPS_NMEA_ZDA_ONLY : GPS_NMEA_DEFAULT) != 0;
+    } else if (zda_only >= 0) {
+        TRACE("Reconfiguring u-blox for %s output...\n", zda_only ? "ZDA-only" : "default NMEA");
+        uint64_t start_ns = monotonic_now_ns();
+        if (zda_only)
+            failed |= configure_ublox_zda_only(fd) != 0;
+        else
+            failed |= configure_ublox_nmea_default(fd) != 0;
+        ubx_config_done(start_ns);
+        ubx_output_resume(fd);
+    }
+    if (baud && configure_baud(fd, baud) != 0)
+        failed = 1;
+
+    ubx_nmea_capture = NULL;
+
+    pthread_mutex_lock(&shared_state_mutex);
+    if (zda_only >= 0)
+        ublox_zda_only = zda_only;
+    if (baud && !failed)
+        serial_baud = baud;
+    if (!atomic_load(&reconfig_pending))
+        reconfig_state = failed ? "failed" : "done";
+    pthread_mutex_unlock(&shared_state_mutex);
+    if (baud && !failed)
+        write_serial_baud(baud);
+}
+
+/*
+ * run_ubx_transactions()
+ * ----------------------
+ * Sends the frames queued by the UBX command, oldest first, and leaves the
+ * disassembled reply for the socket thread.  Each frame is written only
+ * once, since an arbitrary command (e.g. UBX-CFG-RST) may not be safe to
+ * repeat.  Runs in the GPS thread between sentences, like
+ * apply_pending_reconfig().
+ *
+ * A u-blox port left at NMEA-only output by the configuration would not
+ * answer, so UBX output is switched on for the batch and off again after
+ * it, unless ubx_output_resume() keeps it on or a command of the batch set
+ * the port protocols itself (CFG-PRT, CFG-VALSET).
+ */
+static void run_ubx_transactions(int fd, struct nmea_capture *cap)
+{
+    bool ublox = atomic_load(&receiver_family) == GPS_FAMILY_UBLOX;
+    bool switched = ublox && !ubx_output_kept();
+    if (switched)
+        ubx_output_set(fd, true);
+
+    for (;;) {
+        uint8_t frame[UBX_MAX_MSG_SIZE];
+        size_t len = 0;
+        struct ubx_txn *txn = NULL;
+
+        pthread_mutex_lock(&shared_state_mutex);
+        for (int i = 0; i < UBX_TXN_QUEUE; i++) {
+            if (ubx_txns[i].state == UBX_TXN_QUEUED &&
+                (!txn || (int32_t)(ubx_txns[i].seq - txn->seq) < 0))
+                txn = &ubx_txns[i];
+        }
+        if (txn) {
+            txn->state = UBX_TXN_RUNNING;
+            len = txn->len;
+            memcpy(frame, txn->frame, len);
+            atomic_fetch_sub(&ubx_txn_queued, 1);
+        }
+        pthread_mutex_unlock(&shared_state_mutex);
+
+        if (!txn)
+            break;
+        if (frame[2] == UBX_CLS_CFG && (frame[3] == UBX_ID_CFG_PRT || frame[3] == UBX_ID_CFG_VALSET))
+            switched = false;   // leave the port as the command set it
+
+        size_t payload_len = len - UBX_MIN_MSG_SIZE;
+        ubx_msg_t msg = { frame, len, payload_len ? &frame[6] : NULL, payload_len, frame[2], frame[3] };
+
+        ubx_parser_t parser = {0};
+        ubx_parser_init(&parser);
+        parser.filter_type = UBX_FILTER_RESPONSE_OR_ACK;
+        parser.filter_cls = msg.cls;
+        parser.filter_id = msg.id;
+        parser.filter_active = true;
+
+        char result[UBX_TXN_RESULT_SIZE];
+        int pos = snprintf(result, sizeof(result), "SENT %s\n", disassemble_ubx(&msg));
+        if (pos < 0 || pos >= (int)sizeof(result))
+            pos = sizeof(result) - 1;
+
+        ubx_nmea_capture = cap;
+        ubx_parse_result_t res = send_ubx_attempts(fd, &msg, &parser, 1);
+        ubx_nmea_capture = NULL;
+
+        if (res == UBX_PARSE_OK || res == UBX_RECEIVED_NAK) {
+            const char *kind = (parser.cls != UBX_CLS_ACK) ? "RESPONSE" :
+                               (parser.id == UBX_ID_ACK_ACK) ? "ACK" : "NAK";
+            snprintf(result + pos, sizeof(result) - pos, "%s %s\n", kind,
+                     disassemble_ubx_bytes(parser.raw, parser.length));
+        } else {
+            snprintf(result + pos, sizeof(result) - pos, "ERROR:%s\n", result_text(res));
+        }
+
+        pthread_mutex_lock(&shared_state_mutex);
+        memcpy(txn->result, result, sizeof(result));
+        txn->state = UBX_TXN_DONE;
+        atomic_fetch_add(&ubx_txn_done, 1);
+        pthread_mutex_unlock(&shared_state_mutex);
+        wake_socket_thread();
+    }
+
+    if (switched)
+        ubx_output_set(fd, false);
+}
+
+// The GPS thread is exiting: answer what is still queued and take no more
+static void fail_ubx_transactions(void)
+{
+    pthread_mutex_lock(&shared_state_mutex);
+    ubx_txn_closed = true;
+    for (int i = 0; i < UBX_TXN_QUEUE; i++) {
+        struct ubx_txn *txn = &ubx_txns[i];
+        if (txn->state != UBX_TXN_QUEUED)
+            continue;
+        snprintf(txn->result, sizeof(txn->result), "ERROR:GPS thread not running\n");
+        txn->state = UBX_TXN_DONE;
+        atomic_fetch_sub(&ubx_txn_queued, 1);
+        atomic_fetch_add(&ubx_txn_done, 1);
+    }
+    pthread_mutex_unlock(&shared_state_mutex);
+    wake_socket_thread();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+ * Receiver health
+ * ---------------
+ * Every --health-interval seconds the GPS thread polls the u-blox monitor
+ * messages, one per gap between sentences so NMEA keeps flowing: MON-HW,
+ * MON-TXBUF and MON-RXBUF up to generation 8, MON-RF and MON-COMMS from
+ * generation 9.  A critical jamming state, a CW jamming indicator above
+ * --jam-limit or a shorted/open antenna withholds samples from SHM until a
+ * later poll finds the receiver healthy again.
+ */
+static const ubx_msg_t * const health_polls_legacy[] = { &get_mon_hw, &get_mon_txbuf, &get_mon_rxbuf };
+static const ubx_msg_t * const health_polls_valcfg[] = { &get_mon_rf, &get_mon_comms };
+static uint64_t health_due_ns = 0;      // next poll (GPS thread only)
+static size_t health_step = 0;          // next poll of the current round
+
+static bool health_poll_due(void)
+{
+    return health_interval_s > 0 && atomic_load(&receiver_family) == GPS_FAMILY_UBLOX &&
+           monotonic_now_ns() >= health_due_ns;
+}
+
+// Replace the 'mask' bits of the gate; the RF and UTC checks own separate bits
+static void health_set_gate(uint32_t mask, uint32_t bits)
+{
+    uint32_t old = STAT_LOAD(stats, health_gate);
+    uint32_t gate = (old & ~mask) | (bits & mask);
+    if (gate == old)
+        return;
+    STAT_STORE(stats, health_gate, gate);
+    if (gate)
+        fprintf(stderr, "Receiver not trusted (%s): withholding samples from SHM\n", health_gate_text(gate));
+    else
+        fprintf(stderr, "Receiver trusted again: publishing samples to SHM\n");
+
+    pthread_mutex_lock(&shared_state_mutex);
+    watch_event(WATCH_HEALTH, (int32_t)gate);
+    pthread_mutex_unlock(&shared_state_mutex);
+}
+
+// RF front end state from MON-HW or the worst block of MON-RF
+static void health_update_rf(uint8_t jam_state, uint8_t jam_ind, uint8_t ant,
+                             uint16_t noise, uint16_t agc)
+{
+    STAT_STORE(stats, health_jam_state, jam_state);
+    STAT_STORE(stats, health_jam_ind, jam_ind);
+    STAT_STORE(stats, health_ant_status, ant);
+    STAT_STORE(stats, health_noise, noise);
+    STAT_STORE(stats, health_agc, agc);
+    TRACE("Health: jamming=%s jam_ind=%u antenna=%s noise=%u agc=%u\n", jamming_state_text(jam_state),
+          jam_ind, antenna_status_text(ant), noise, agc);
+
+    uint32_t gate = 0;
+    if (jam_state == UBX_JAM_CRITICAL || (jam_limit > 0 && jam_ind > jam_limit))
+        gate |= NTPGPS_HEALTH_JAMMING;
+    if (ant == UBX_ANT_SHORT || ant == UBX_ANT_OPEN)
+        gate |= NTPGPS_HEALTH_ANTENNA;
+    health_set_gate(NTPGPS_HEALTH_JAMMING | NTPGPS_HEALTH_ANTENNA, gate);
+}
+
+static void health_decode(const ubx_parser_t *p)
+{
+    const uint8_t *payload = p->payload;
+    size_t len = p->payload_len;
+
+    switch (p->id) {
+    case UBX_ID_MON_HW: {
+        if (len < sizeof(ubx_mon_hw_t))
+            break;
+        const ubx_mon_hw_t *hw = (const ubx_mon_hw_t *)payload;
+        health_update_rf(hw->jammingState, hw->jamInd, hw->aStatus, hw->noisePerMS, hw->agcCnt);
+        return;
+    }
+    case UBX_ID_MON_RF: {
+        const ubx_mon_rf_t *rf = (const ubx_mon_rf_t *)payload;
+        if (len < sizeof(*rf) || rf->nBlocks == 0 ||
+            len < sizeof(*rf) + rf->nBlocks * sizeof(ubx_mon_rf_block_t))
+            break;
+        uint8_t jam_state = 0, jam_ind = 0, ant = rf->blocks[0].antStatus;
+        uint16_t noise = 0, agc = 0;
+        for (int i = 0; i < rf->nBlocks; i++) {
+            const ubx_mon_rf_block_t *b = &rf->blocks[i];
+            if (b->jammingState > jam_state) jam_state = b->jammingState;
+            if (b->jamInd > jam_ind)         jam_ind = b->jamInd;
+            if (b->noisePerMS > noise)       noise = b->noisePerMS;
+            if (b->agcCnt > agc)             agc = b->agcCnt;
+            if (b->antStatus == UBX_ANT_SHORT || b->antStatus == UBX_ANT_OPEN)
+                ant = b->antStatus;
+        }
+        health_update_rf(jam_state, jam_ind, ant, noise, agc);
+        return;
+    }
+    case UBX_ID_MON_COMMS: {
+        const ubx_mon_comms_t *comms = (const ubx_mon_comms_t *)payload;
+        if (len < sizeof(*comms) || len < sizeof(*comms) + comms->nPorts * sizeof(ubx_mon_comms_port_t))
+            break;
+        uint8_t tx_usage = 0, tx_peak = 0, rx_peak = 0;
+        for (int i = 0; i < comms->nPorts; i++) {
+            const ubx_mon_comms_port_t *port = &comms->ports[i];
+            if (port->txUsage > tx_usage)     tx_usage = port->txUsage;
+            if (port->txPeakUsage > tx_peak)  tx_peak = port->txPeakUsage;
+            if (port->rxPeakUsage > rx_peak)  rx_peak = port->rxPeakUsage;
+        }
+        STAT_STORE(stats, health_tx_usage, tx_usage);
+        STAT_STORE(stats, health_tx_peak, tx_peak);
+        STAT_STORE(stats, health_rx_peak, rx_peak);
+        if (comms->txErrors)
+            STAT_INC(stats, health_tx_errors);
+        TRACE("Health: tx_usage=%u%% tx_peak=%u%% rx_peak=%u%% tx_errors=0x%02X\n",
+              tx_usage, tx_peak, rx_peak, comms->txErrors);
+        return;
+    }
+    case UBX_ID_MON_TXBUF: {
+        if (len < sizeof(ubx_mon_txbuf_t))
+            break;
+        const ubx_mon_txbuf_t *tx = (const ubx_mon_txbuf_t *)payload;
+        STAT_STORE(stats, health_tx_usage, tx->tUsage);
+        STAT_STORE(stats, health_tx_peak, tx->tPeakusage);
+        if (tx->mem || tx->alloc)
+            STAT_INC(stats, health_tx_errors);
+        TRACE("Health: tx_usage=%u%% tx_peak=%u%% tx_errors=0x%02X\n", tx->tUsage, tx->tPeakusage, tx->errors);
+        return;
+    }
+    case UBX_ID_MON_RXBUF: {
+        if (len < sizeof(ubx_mon_rxbuf_t))
+            break;
+        const ubx_mon_rxbuf_t *rx = (const ubx_mon_rxbuf_t *)payload;
+        uint8_t rx_peak = 0;
+        for (int i = 0; i < 6; i++)
+            if (rx->peakUsage[i] > rx_peak)
+                rx_peak = rx->peakUsage[i];
+        STAT_STORE(stats, health_rx_peak, rx_peak);
+        return;
+    }
+    }
+    TRACE_UBX("Health: unexpected ", p->raw, p->length);
+}
+
+// Send the next health poll of the round and decode the answer
+static void run_health_poll(int fd, struct nmea_capture *cap)
+{
+    bool gen9 = atomic_load(&ubx_valcfg_mode);
+    const ubx_msg_t * const *polls = gen9 ? health_polls_valcfg : health_polls_legacy;
+    size_t count = gen9 ? SIZEOF(health_polls_valcfg) : SIZEOF(health_polls_legacy);
+    const ubx_msg_t *msg = polls[health_step % count];
+
+    ubx_parser_t parser;
+    ubx_parser_init(&parser);
+    parser.filter_type = UBX_FILTER_CLS_ID;
+    parser.filter_cls = msg->cls;
+    parser.filter_id = msg->id;
+    parser.filter_active = true;
+
+    ubx_nmea_capture = cap;
+    ubx_parse_result_t res = send_ubx_attempts(fd, msg, &parser, 1);
+    ubx_nmea_capture = NULL;
+
+    uint64_t now_ns = monotonic_now_ns();
+    if (res == UBX_PARSE_OK) {
+        STAT_INC(stats, health_polls);
+        STAT_STORE(stats, health_last_mono_ns, now_ns);
+        health_decode(&parser);
+    } else {
+        STAT_INC(stats, health_timeouts);
+        TRACE("Health poll 0x%02X/0x%02X: %s\n", msg->cls, msg->id, result_text(res));
+    }
+
+    // the rest of the round goes out in the next gaps between sentences
+    if (++health_step >= count) {
+        health_step = 0;
+        health_due_ns = now_ns + (uint64_t)health_interval_s * 1000000000ULL;
+    } else {
+        health_due_ns = now_ns;
+    }
+}
+
+/*
+ * UTC validity gate (--utc-valid)
+ * -------------------------------
+ * RMC/GLL status and GGA fix quality describe the position, not the time:
+ * a receiver reports a fix before it knows the week number or the UTC leap
+ * second offset.  With --utc-valid the u-blox sends NAV-TIMEUTC every
+ * navigation epoch, and samples are withheld from SHM until it reports
+ * validTOW, validWKN and validUTC with tAcc within the limit, and again
+ * whenever a report fails those checks or none arrives for three epochs.
+ */
+static bool utc_gate_on(void)
+{
+    return utc_tacc_max_ns > 0 && atomic_load(&receiver_family) == GPS_FAMILY_UBLOX;
+}
+
+static void utc_report(const uint8_t *payload, size_t len)
+{
+    if (!utc_gate_on() || len < sizeof(ubx_nav_timeutc_t))
+        return;
+    const ubx_nav_timeutc_t *t = (const ubx_nav_timeutc_t *)payload;
+    uint8_t valid = t->valid & UBX_TIMEUTC_VALID_ALL;
+
+    STAT_INC(stats, utc_reports);
+    STAT_STORE(stats, utc_last_mono_ns, monotonic_now_ns());
+    STAT_STORE(stats, utc_valid, valid);
+    STAT_STORE(stats, utc_tacc_ns, t->tAcc);
+    TRACE("NAV-TIMEUTC: %04u-%02u-%02u %02u:%02u:%02u valid=0x%02X tAcc=%u ns\n", t->year, t->month,
+          t->day, t->hour, t->min, t->sec, t->valid, t->tAcc);
+
+    bool trusted = valid == UBX_TIMEUTC_VALID_ALL && t->tAcc <= utc_tacc_max_ns;
+    health_set_gate(NTPGPS_HEALTH_UTC, trusted ? 0 : NTPGPS_HEALTH_UTC);
+}
+
+// Close the gate once NAV-TIMEUTC stops arriving
+static void utc_check_stale(void)
+{
+    if (!utc_gate_on() || (STAT_LOAD(stats, health_gate) & NTPGPS_HEALTH_UTC))
+        return;
+    uint64_t epoch_ms = nav_rate_ms > 1000 ? nav_rate_ms : 1000;
+    if (monotonic_now_ns() - STAT_LOAD(stats, utc_last_mono_ns) > 3 * epoch_ms * 1000000ULL) {
+        TRACE("NAV-TIMEUTC overdue\n");
+        health_set_gate(NTPGPS_HEALTH_UTC, NTPGPS_HEALTH_UTC);
+    }
+}
+
+// Work the control socket queued for the GPS thread, health polls and the survey
+static bool gps_work_pending(void)
+{
+    return atomic_load(&reconfig_pending) || atomic_load(&ubx_txn_queued) || health_poll_due() ||
+           atomic_load(&survey_restart_pending) || atomic_load(&survey_push_pending);
+}
+
+static void run_gps_work(int fd, struct nmea_capture *cap)
+{
+    if (atomic_load(&reconfig_pending))
+        apply_pending_reconfig(fd, cap);
+    if (atomic_load(&ubx_txn_queued))
+        run_ubx_transactions(fd, cap);
+    if (health_poll_due())
+        run_health_poll(fd, cap);
+    if (atomic_load(&survey_restart_pending) || atomic_load(&survey_push_pending)) {
+        ubx_nmea_capture = cap;
+        if (atomic_load(&survey_restart_pending))
+            survey_restart(fd);
+        if (atomic_load(&survey_push_pending))
+            survey_push(fd);
+        ubx_nmea_capture = NULL;
+    }
+}
+
+static void handle_signal(int sig)
+{
+    if (sig == SIGINT || sig == SIGTERM || sig == SIGUSR1)
+        atomic_store(&stop, 1);
+}
+
+// --- Control server ---
+// Every client keeps its own line buffer and output queue, so many monitoring
+// tools can stay connected and pipeline commands without blocking each other.
+static struct control_client clients[MAX_CLIENTS];
 
-    parser.filter_type = UBX_FILTER_CLS_ID;
-    parser.filter_cls = msg->cls;
-    parser.filter_id = msg->id;
-    parser.filter_active = true;
+static void client_close(struct control_client *c)
+{
+    if (c->fd >= 0) {
+        close(c->fd);
+        TRACE("Control client fd=%d closed\n", c->fd);
+    }
+    c->fd = -1;
+    c->in_len = 0;
+    c->in_overflow = false;
+    c->eof = false;
+    c->out_len = 0;
+    c->ubx_wait = false;
+    if (c->watch != WATCH_MODE_OFF)
+        atomic_fetch_sub(&watch_subscribers, 1);
+    c->watch = WATCH_MODE_OFF;
+}
 
-    ubx_parse_result_t result = send_ubx(fd, msg, &parser);
+static void client_accept(int listen_fd)
+{
+    struct sockaddr_un client_addr;
+    socklen_t client_len = sizeof(client_addr);
+    int client_fd = accept(listen_fd, (struct sockaddr*)&client_addr, &client_len);
+    if (client_fd < 0) {
+        if (errno != EINTR && errno != EAGAIN)
+            perror("accept");
+        return;
+    }
 
-    switch (result) {
-        case UBX_PARSE_OK:
-            TRACE("Read    %s\n", disassemble_ubx_bytes(parser.raw, parser.length));
-            break;
-        default:
-            TRACE("%s\n", result_text(result));
-            break;
+    for (int i = 0; i < MAX_CLIENTS; i++) {
+        if (clients[i].fd < 0) {
+            int flags = fcntl(client_fd, F_GETFL, 0);
+            fcntl(client_fd, F_SETFL, flags | O_NONBLOCK);
+            clients[i].fd = client_fd;
+            clients[i].gen++;
+            TRACE("Control client fd=%d connected (slot %d)\n", client_fd, i);
+            return;
+        }
     }
 
-    return result;
+    write_printf(client_fd, "ERROR:too many clients\n");
+    close(client_fd);
 }
 
-static int configure_ublox_zda_only(int fd)
+// Room for a worst-case response?  If not, stop reading until output drains.
+// Nothing is answered while a UBX transaction is outstanding, so responses
+// stay in command order.
+static bool client_can_respond(const struct control_client *c)
 {
-    UBX_BEGIN_LIST
-        UBX_FUNCTION(set_cfg_prt_usb_ubxnmea,   send_ubx_no_wait)
-        UBX_FUNCTION(set_cfg_prt_uart1_ubxnmea, send_ubx_no_wait)
-        UBX_FUNCTION(set_cfg_inf_off,           send_ubx_handle_ack)
-        UBX_FUNCTION(set_cfg_msg_nmea_zda_on,   send_ubx_handle_ack)
-        UBX_FUNCTION(set_cfg_gnss_glonass_configure_off, send_ubx_handle_ack)
-        UBX_FUNCTION(set_cfg_msg_nmea_gga_off,  send_ubx_handle_ack)
-        UBX_FUNCTION(set_cfg_msg_nmea_gll_off,  send_ubx_handle_ack)
-        UBX_FUNCTION(set_cfg_msg_nmea_gsa_off,  send_ubx_handle_ack)
-        UBX_FUNCTION(set_cfg_msg_nmea_gsv_off,  send_ubx_handle_ack)
-        UBX_FUNCTION(set_cfg_msg_nmea_rmc_off,  send_ubx_handle_ack)
-        UBX_FUNCTION(set_cfg_msg_nmea_vtg_off,  send_ubx_handle_ack)
-        UBX_FUNCTION(set_cfg_msg_nmea_grs_off,  send_ubx_handle_ack)
-        UBX_FUNCTION(set_cfg_msg_nmea_gst_off,  send_ubx_handle_ack)
-        UBX_FUNCTION(set_cfg_msg_nmea_gbs_off,  send_ubx_handle_ack)
-        UBX_FUNCTION(set_cfg_msg_nmea_dtm_off,  send_ubx_handle_ack)
-        UBX_FUNCTION(set_cfg_msg_nmea_gns_off,  send_ubx_handle_ack)
-        UBX_FUNCTION(set_cfg_prt_usb_nmea,      send_ubx_no_wait)
-        UBX_FUNCTION(set_cfg_prt_uart1_nmea,    send_ubx_no_wait)
-    UBX_END_LIST
-    UBX_INVOKE(fd);
-
-    return 0;
+    return !c->ubx_wait && sizeof(c->out) - c->out_len >= CLIENT_OUT_RESERVE;
 }
 
-// Wait for UBX-MON-VER message
-int get_ublox_version(int fd)
+// Execute every complete line in the input buffer
+static void client_process_input(struct control_client *c)
 {
-    UBX_BEGIN_LIST
-        UBX_FUNCTION(set_cfg_prt_usb_ubxnmea,   send_ubx_no_wait)
-        UBX_FUNCTION(set_cfg_prt_uart1_ubxnmea, send_ubx_no_wait)
-        UBX_FUNCTION(get_cfg_gnss,              send_ubx_handle_generic)
-        UBX_FUNCTION(get_cfg_inf_nmea,          send_ubx_handle_generic)
-        UBX_FUNCTION(get_cfg_prt,               send_ubx_handle_cfg_prt)
-        UBX_FUNCTION(get_mon_ver,               send_ubx_handle_mon_ver)
-    UBX_END_LIST
-    UBX_INVOKE(fd);
+    while (c->in_len > 0 && client_can_respond(c)) {
+        if (c->watch == WATCH_MODE_BINARY) {
+            c->in_len = 0;  // binary stream only, nothing else can be answered
+            return;
+        }
 
-    const ubx_mon_ver_t *ver = &mon_ver.fields;
-    TRACE("u-blox Device Port: %u(%s)\n", cfg_prt.portID, ubx_port_str(cfg_prt.portID));
-    TRACE("u-blox Software Version: %s\n", ver->swVersion);
-    TRACE("u-blox Hardware Version: %s\n", ver->hwVersion);
-    for (int i = 0; i < mon_ver.ext_count; i++)
-        TRACE("u-blox Extension[%d]: %s\n", i, ver->extensions[i]);
+        char *nl = memchr(c->in, '\n', c->in_len);
+        if (!nl) {
+            if (c->in_len == sizeof(c->in) || c->in_overflow) {
+                c->in_overflow = true;  // drop until the next newline
+                c->in_len = 0;
+                return;
+            }
+            if (!c->eof)
+                return;  // wait for the rest of the line
+            nl = c->in + c->in_len;  // final unterminated line at EOF
+        }
 
-    return 1;
+        char cmd[MAX_CMD_LEN + 1];
+        size_t line_len = nl - c->in;
+        memcpy(cmd, c->in, line_len);
+        cmd[line_len] = '\0';
+
+        size_t consumed = (line_len < c->in_len) ? line_len + 1 : line_len;
+        memmove(c->in, c->in + consumed, c->in_len - consumed);
+        c->in_len -= consumed;
+
+        if (c->in_overflow) {
+            c->in_overflow = false;
+            client_printf(c, "ERROR:command too long\n");
+            continue;
+        }
+
+        pthread_mutex_lock(&shared_state_mutex);
+        handle_client_command(c, cmd);
+        pthread_mutex_unlock(&shared_state_mutex);
+    }
 }
 
-int configure_ublox_nmea_only(int fd)
+static void client_read(struct control_client *c)
 {
-    UBX_BEGIN_LIST
-        UBX_FUNCTION(set_cfg_inf_off,           send_ubx_no_wait)
-        UBX_FUNCTION(set_cfg_prt_usb_nmea,      send_ubx_no_wait)
-        UBX_FUNCTION(set_cfg_prt_uart1_nmea,    send_ubx_no_wait)
-    UBX_END_LIST
-    UBX_INVOKE(fd);
+    ssize_t n = read(c->fd, c->in + c->in_len, sizeof(c->in) - c->in_len);
+    if (n > 0) {
+        c->in_len += n;
+    } else if (n == 0) {
+        c->eof = true;
+    } else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+        client_close(c);
+        return;
+    }
+    client_process_input(c);
+}
 
-    return 1;
+// Send as much queued output as the socket accepts without blocking
+static void client_flush(struct control_client *c)
+{
+    if (c->out_len == 0)
+        return;
+
+    ssize_t n = write(c->fd, c->out, c->out_len);
+    if (n > 0) {
+        memmove(c->out, c->out + n, c->out_len - n);
+        c->out_len -= n;
+        c->watch_progress_ms = monotonic_now_ms();
+    } else if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+        client_close(c);
+        return;
+    }
+
+    // output drained: resume any commands held back by backpressure
+    if (c->in_len > 0)
+        client_process_input(c);
 }
 
-////////////////////////////////////////////////////////////////////////////////
+static void client_watch_emit(struct control_client *c, const ntpgps_watch_record_t *r,
+                              uint32_t seq)
+{
+    if (c->watch == WATCH_MODE_BINARY) {
+        ntpgps_watch_frame_t f;
+        ntpgps_watch_to_frame(r, seq, &f);
+        memcpy(c->out + c->out_len, &f, sizeof(f));
+        c->out_len += sizeof(f);
+    } else {
+        c->out_len += ntpgps_watch_format_text(r, seq, c->out + c->out_len,
+                                               sizeof(c->out) - c->out_len);
+    }
+}
 
-int gps_init(int fd)
+// Queue pending watch records for a subscriber.  Called with
+// shared_state_mutex held.  Records are only queued while a worst-case
+// command response still fits; a subscriber that falls further behind loses
+// the oldest records (reported with a DROPPED event) and is disconnected if
+// it takes no output at all for WATCH_STALL_MS.
+static void client_watch_deliver(struct control_client *c, uint64_t now_ms)
 {
-    // Determine GPS type and optionally configure it
-    if (get_ublox_version(fd)) {
+    uint32_t behind = watch_head - c->watch_next;
+    if (behind > WATCH_RING_SIZE) {
+        c->watch_dropped += behind - WATCH_RING_SIZE;
+        c->watch_next = watch_head - WATCH_RING_SIZE;
+    }
 
-        // Configure u-blox GPS to output ZDA only
-        if (ublox_zda_only) {
-            TRACE("Configuring u-blox for ZDA-only output...\n");
-            if (configure_ublox_zda_only(fd) != 0) {
-                fprintf(stderr, "Failed to configure u-blox ZDA-only mode\n");
-            }
-        } else {
-            if (!configure_ublox_nmea_only(fd)) {
-                fprintf(stderr, "Failed to enable NMEA output\n");
+    while (c->watch_next != watch_head) {
+        if (sizeof(c->out) - c->out_len < CLIENT_OUT_RESERVE + 2 * WATCH_RECORD_ROOM) {
+            if (now_ms - c->watch_progress_ms > WATCH_STALL_MS) {
+                TRACE("Watch subscriber fd=%d stalled, dropping\n", c->fd);
+                client_close(c);
             }
+            return;
         }
-    } else {
-        fprintf(stderr, "Failed to get UBX-MON-VER\n");
+        if (c->watch_dropped) {
+            ntpgps_watch_record_t d = { .type = WATCH_DROPPED, .arg = (int32_t)c->watch_dropped };
+            client_watch_emit(c, &d, 0);
+            c->watch_dropped = 0;
+        }
+        client_watch_emit(c, &watch_ring[c->watch_next & (WATCH_RING_SIZE - 1)], c->watch_next);
+        c->watch_next++;
     }
+}
 
-    return 1;
+static void clients_watch_deliver(void)
+{
+    if (atomic_load(&watch_subscribers) == 0)
+        return;
+
+    uint64_t now_ms = monotonic_now_ms();
+    pthread_mutex_lock(&shared_state_mutex);
+    for (int i = 0; i < MAX_CLIENTS; i++) {
+        if (clients[i].fd >= 0 && clients[i].watch != WATCH_MODE_OFF)
+            client_watch_deliver(&clients[i], now_ms);
+    }
+    pthread_mutex_unlock(&shared_state_mutex);
 }
 
-static void handle_signal(int sig)
+// Hand finished UBX transactions back to the clients that asked
+static void clients_ubx_deliver(void)
 {
-    if (sig == SIGINT || sig == SIGTERM || sig == SIGUSR1)
-        atomic_store(&stop, 1);
+    if (atomic_load(&ubx_txn_done) == 0)
+        return;
+
+    pthread_mutex_lock(&shared_state_mutex);
+    for (int i = 0; i < UBX_TXN_QUEUE; i++) {
+        struct ubx_txn *txn = &ubx_txns[i];
+        if (txn->state != UBX_TXN_DONE)
+            continue;
+        struct control_client *c = txn->client;
+        if (c->fd >= 0 && c->gen == txn->client_gen) {
+            client_printf(c, "%s", txn->result);
+            c->ubx_wait = false;
+        }
+        txn->state = UBX_TXN_FREE;
+        atomic_fetch_sub(&ubx_txn_done, 1);
+    }
+    pthread_mutex_unlock(&shared_state_mutex);
+
+    // resume commands pipelined behind the transaction
+    for (int i = 0; i < MAX_CLIENTS; i++) {
+        if (clients[i].fd >= 0 && clients[i].in_len > 0)
+            client_process_input(&clients[i]);
+    }
 }
 
 // --- Socket thread ---
 struct socket_thread_args {
     int listen_fd;
+    int metrics_fd;     // -1 = no metrics listener
 };
 
 static void* socket_thread_func(void *arg)
 {
-    int listen_fd = *(int*)arg;
+    struct socket_thread_args *args = arg;
+    int listen_fd = args->listen_fd;
+    int metrics_fd = args->metrics_fd;
 
     TRACE("Socket thread started\n");
 
+    for (int i = 0; i < MAX_CLIENTS; i++)
+        clients[i].fd = -1;
+
     while (!atomic_load(&stop)) {
-        fd_set readfds;
+        fd_set readfds, writefds;
         FD_ZERO(&readfds);
+        FD_ZERO(&writefds);
         FD_SET(listen_fd, &readfds);
+        if (metrics_fd >= 0)
+            FD_SET(metrics_fd, &readfds);
+        int maxfd = (metrics_fd > listen_fd) ? metrics_fd : listen_fd;
+        if (socket_wake_fd >= 0) {
+            FD_SET(socket_wake_fd, &readfds);
+            if (socket_wake_fd > maxfd)
+                maxfd = socket_wake_fd;
+        }
+
+        for (int i = 0; i < MAX_CLIENTS; i++) {
+            struct control_client *c = &clients[i];
+            if (c->fd < 0)
+                continue;
+            if (!c->eof && c->in_len < sizeof(c->in) && client_can_respond(c))
+                FD_SET(c->fd, &readfds);
+            if (c->out_len > 0)
+                FD_SET(c->fd, &writefds);
+            if (c->fd > maxfd)
+                maxfd = c->fd;
+        }
+
         struct timeval tv = {1, 0};  // 1 sec
 
-        int ret = select(listen_fd + 1, &readfds, NULL, NULL, &tv);
+        int ret = select(maxfd + 1, &readfds, &writefds, NULL, &tv);
         if (ret < 0) {
             if (errno == EINTR) continue; // interrupted by signal
             perror("select");
             break;
         } else if (ret == 0) {
-            // timeout, check stop flag again
+            // timeout, check stop flag again (and catch up without an eventfd)
+            clients_ubx_deliver();
+            clients_watch_deliver();
             continue;
         }
 
-        if (FD_ISSET(listen_fd, &readfds)) {
-            struct sockaddr_un client_addr;
-            socklen_t client_len = sizeof(client_addr);
-            int client_fd = accept(listen_fd, (struct sockaddr*)&client_addr, &client_len);
-            if (client_fd < 0) {
-                if (errno == EINTR) continue;
-                perror("accept");
+        if (FD_ISSET(listen_fd, &readfds))
+            client_accept(listen_fd);
+
+        if (socket_wake_fd >= 0 && FD_ISSET(socket_wake_fd, &readfds)) {
+            uint64_t pending;
+            if (read(socket_wake_fd, &pending, sizeof(pending)) < 0 && errno != EAGAIN)
+                perror("eventfd read");
+        }
+        clients_ubx_deliver();
+        clients_watch_deliver();
+
+        for (int i = 0; i < MAX_CLIENTS; i++) {
+            struct control_client *c = &clients[i];
+            if (c->fd < 0)
                 continue;
-            }
+            int fd = c->fd;
+            if (FD_ISSET(fd, &readfds))
+                client_read(c);
+            if (c->fd >= 0 && (c->out_len > 0 || FD_ISSET(fd, &writefds)))
+                client_flush(c);
+            if (c->fd >= 0 && c->eof && c->in_len == 0 && c->out_len == 0 &&
+                !c->ubx_wait && c->watch == WATCH_MODE_OFF)
+                client_close(c);  // peer is done and has all its answers
+        }
 
-            pthread_mutex_lock(&shared_state_mutex);
-            handle_client_command(client_fd);
-            pthread_mutex_unlock(&shared_state_mutex);
+        // metrics only read atomics, so scrapes skip shared_state_mutex
+        if (metrics_fd >= 0 && FD_ISSET(metrics_fd, &readfds)) {
+            int client_fd = accept(metrics_fd, NULL, NULL);
+            if (client_fd >= 0)
+                handle_metrics_client(client_fd);
+            else if (errno != EINTR && errno != EAGAIN)
+                perror("accept");
         }
 
         if (atomic_load(&begin_shutdown) == 1)
             kill(getpid(), SIGUSR1);   // wake pause() in main thread
 
-        atomic_fetch_add(&loop_counter_socket, 1);
+        STAT_INC(stats, loop_counter_socket);
+    }
+
+    // best effort: deliver pending answers (e.g. to SHUTDOWN, or UBX requests
+    // failed by an exiting GPS thread) and the last watch events (e.g. a
+    // device error) before closing
+    clients_ubx_deliver();
+    clients_watch_deliver();
+    for (int i = 0; i < MAX_CLIENTS; i++) {
+        if (clients[i].fd >= 0) {
+            client_flush(&clients[i]);
+            client_close(&clients[i]);
+        }
     }
 
     TRACE("Socket thread exiting\n");
@@ -2062,15 +5296,45 @@ struct gps_thread_args {
     struct shmTime *shm;
 };
 
+// Tell watch subscribers why the GPS thread is about to stop (0 = EOF)
+static void report_device_error(int err)
+{
+    pthread_mutex_lock(&shared_state_mutex);
+    watch_event(WATCH_DEVICE_ERROR, err);
+    pthread_mutex_unlock(&shared_state_mutex);
+}
+
+/*
+ * gps_stream_feed()
+ * -----------------
+ * Parses the receiver input in ubx_rx: NMEA lines go to SHM through the
+ * parser hook, NAV-TIMEUTC to the UTC gate, other frames are skipped.
+ * 'stream' carries a partial line or frame over to the next read().
+ */
+static void gps_stream_feed(ubx_parser_t *stream, struct nmea_capture *cap)
+{
+    ubx_nmea_capture = cap;
+    while (ubx_rx.off < ubx_rx.len) {
+        size_t used;
+        ubx_parse_result_t res = ubx_parser_feed_buf(stream, &ubx_rx.buf[ubx_rx.off],
+                                                     ubx_rx.len - ubx_rx.off, &used);
+        ubx_rx.off += used;
+        if (res == UBX_PARSE_OK)
+            ubx_parser_skipped(stream->raw, stream->length);
+        else if (res != UBX_PARSE_INCOMPLETE)
+            TRACE("Receiver stream: %s\n", result_text(res));
+    }
+    ubx_nmea_capture = NULL;
+}
+
 void* gps_thread_func(void *arg) {
     struct gps_thread_args *args = arg;
     int fd = args->fd;
-    struct shmTime *shm = args->shm;
+    struct nmea_capture cap = { .shm = args->shm };
 
-    char buf[512];
-    char line[512];
-    int n = 0;
-    int line_pos = 0;
+    ubx_parser_t stream;        // receiver output between UBX exchanges
+    ubx_parser_init(&stream);
+    ssize_t n = 0;
     fd_set rfds;
 
     TRACE("GPS thread started\n");
@@ -2078,6 +5342,10 @@ void* gps_thread_func(void *arg) {
     gps_init(fd);
 
     while (!atomic_load(&stop)) {
+        // input left over from the last UBX exchange
+        gps_stream_feed(&stream, &cap);
+        utc_check_stale();
+
         FD_ZERO(&rfds);
         FD_SET(fd, &rfds);
 
@@ -2088,13 +5356,23 @@ void* gps_thread_func(void *arg) {
             if (errno == EINTR)
                 continue;   // interrupted by signal, retry
             perror("select");
+            report_device_error(errno);
             break;
         } else if (ret == 0) {
+            // idle line: a good moment for queued receiver work
+            if (gps_work_pending()) {
+                ubx_parser_init(&stream);
+                run_gps_work(fd, &cap);
+            }
             continue;       // timeout, no data
         }
 
         if (FD_ISSET(fd, &rfds)) {
-            n = read(fd, buf, sizeof(buf));
+            n = read(fd, ubx_rx.buf, sizeof(ubx_rx.buf));
+
+            // timestamp the chunk as close to read() as possible
+            realtime_now(&cap.rx_rt);
+            cap.rx_mono_ns = monotonic_now_ns();
             if (n < 0) {
                 if (errno == EAGAIN || errno == EWOULDBLOCK)
                     continue; // nothing to read
@@ -2102,76 +5380,138 @@ void* gps_thread_func(void *arg) {
                     continue; // signal
                 else if (errno == EIO || errno == ENODEV) {
                     TRACE("GPS device disconnected (errno=%d: %s)\n", errno, strerror(errno));
+                    write_serial_baud(0);   // a replugged receiver starts at its saved rate
+                    report_device_error(errno);
                     break;
                 } else {
                     perror("read");
+                    report_device_error(errno);
                     break;
                 }
             } else if (n == 0) {
                 TRACE("GPS device returned EOF – exiting thread\n");
+                report_device_error(0);
                 break;
             } else {
-                buf[n] = '\0';
-                for (int i = 0; i < n; i++) {
-                    if (buf[i] == '\n' || line_pos >= (int)sizeof(line) - 1) {
-                        line[line_pos] = '\0';
-
-//                        TRACE(">>> %s\n", line);
-                        struct timespec ts = {0};
-
-                        pthread_mutex_lock(&shared_state_mutex);
-                        if (parse_nmea_time(line, &ts) == 0) {
-
-                            // Safe update to shared memory
-                            if (shm != NULL) {
-                                struct shmTime tmp = *shm;  // copy old values
-                                tmp.clockTimeStampSec = ts.tv_sec;
-                                tmp.clockTimeStampUSec = ts.tv_nsec / 1000;
-                                tmp.receiveTimeStampSec = ts.tv_sec;
-                                tmp.receiveTimeStampUSec = ts.tv_nsec / 1000;
-
-                                shm->valid = 0;          // mark old data invalid
-                                shm->count++;            // bump count before write
-                                *shm = tmp;              // copy all fields at once
-                                shm->count++;            // bump count after write
-                                shm->valid = 1;          // mark new data valid
-
-                                TRACE("Wrote GPS time: %ld.%09ld\n", (long)ts.tv_sec, ts.tv_nsec);
-                                shm_write_count++;
-                            }
-                        } else
-                            parse_nmea_fail++;
-
-                        if (stored_date_changed) {
-                            stored_date_changed = 0;
-                            write_date_seed();
-                        }
-                        pthread_mutex_unlock(&shared_state_mutex);
-
-                        line_pos = 0;  // reset for next line
-                    } else if (buf[i] != '\r') {
-                        line[line_pos++] = buf[i];
-                    }
+                gps_record_write(&gps_rec, cap.rx_mono_ns, &cap.rx_rt, ubx_rx.buf, (size_t)n);
+                ubx_rx.off = 0;
+                ubx_rx.len = (size_t)n;
+                gps_stream_feed(&stream, &cap);
+
+                // between sentences: run any queued receiver work
+                if (stream.state == UBX_STATE_SYNC1 && gps_work_pending()) {
+                    ubx_parser_init(&stream);
+                    run_gps_work(fd, &cap);
                 }
             }
         }
 
-        atomic_fetch_add(&loop_counter_gps, 1);
+        STAT_INC(stats, loop_counter_gps);
     }
 
+    fail_ubx_transactions();
     kill(getpid(), SIGUSR1);   // wake pause() in main thread
     TRACE("GPS thread exiting\n");
     return NULL;
 }
 
+#define REPLAY_FILES_MAX 16     // --replay options
+
+// The clock during a replay: the timestamps of the chunk being fed
+static struct {
+    uint64_t        mono_ns;
+    struct timespec rt;
+} replay_now;
+
+static uint64_t replay_mono_ns(void) { return replay_now.mono_ns; }
+static void replay_realtime(struct timespec *t) { *t = replay_now.rt; }
+static const gps_clock_t replay_clock = { replay_mono_ns, replay_realtime };
+
+/*
+ * replay_run()
+ * ------------
+ * --replay: feeds the chunks of --record captures, in the order given,
+ * through the parser, gates and SHM update of the GPS thread, with the
+ * clock standing at the time each chunk was read, as fast as they parse.
+ * Nothing is sent to a receiver (no configuration, health polls or
+ * survey) and the date seed is neither read nor written, so a capture
+ * always gives the same samples.  Each SHM write is listed on 'out' with
+ * the struct shmTime fields as written, in struct order, and the sentence
+ * that gave it:
+ *   <mode> <count> <clockTimeStamp sec.usec> <receiveTimeStamp sec.usec>
+ *   <leap> <precision> <nsamples> <valid> <clockTimeStampNSec>
+ *   <receiveTimeStampNSec> <sentence>
+ * for diffing against a known good run (test/replay-check.py).  Returns 0, or -1 if a capture
+ * could not be read.
+ */
+static int replay_run(char *const *paths, int npaths, FILE *out)
+{
+    static struct shmTime shm_replay;   // stands in for the SHM segment
+    struct nmea_capture cap = { .shm = &shm_replay };
+    ubx_parser_t stream;
+    uint64_t chunks = 0, bytes = 0;
+    int ret = 0;
+
+    shm_replay.mode = 1;
+    shm_replay.precision = -1;     // as main() sets up the segment
+    shm_replay.leap = 0;
+    shm_replay.nsamples = 3;
+    ubx_parser_init(&stream);
+    gps_clock = &replay_clock;
+    replay_out = out;
+
+    for (int i = 0; i < npaths && ret == 0; i++) {
+        gps_record_reader_t rd;
+        if (gps_record_reader_open(&rd, paths[i]) < 0) {
+            ret = -1;
+            break;
+        }
+        TRACE("Replaying %s, recorded from %.32s\n", paths[i], rd.hdr.device);
+
+        const gps_record_hdr_t *h;
+        while ((h = gps_record_next(&rd)) != NULL) {
+            const uint8_t *data = (const uint8_t *)(h + 1);
+            replay_now.mono_ns = h->mono_ns;
+            replay_now.rt.tv_sec = (time_t)(h->real_ns / 1000000000ULL);
+            replay_now.rt.tv_nsec = (long)(h->real_ns % 1000000000ULL);
+            realtime_now(&cap.rx_rt);
+            cap.rx_mono_ns = monotonic_now_ns();
+
+            // chunks were read into ubx_rx, so they fit; split them anyway
+            for (size_t off = 0; off < h->len; off += ubx_rx.len) {
+                ubx_rx.off = 0;
+                ubx_rx.len = h->len - off < sizeof(ubx_rx.buf) ? h->len - off : sizeof(ubx_rx.buf);
+                memcpy(ubx_rx.buf, data + off, ubx_rx.len);
+                gps_stream_feed(&stream, &cap);
+            }
+            utc_check_stale();
+
+            chunks++;
+            bytes += h->len;
+            if ((chunks & 255) == 0)
+                trace_drain(stderr);    // no trace thread here
+        }
+        gps_record_reader_close(&rd);
+    }
+
+    fflush(out);
+    trace_drain(stderr);
+    replay_out = NULL;
+    gps_clock = &system_clock;
+    fprintf(stderr, "replay: %llu chunks, %llu bytes, %llu SHM samples\n",
+            (unsigned long long)chunks, (unsigned long long)bytes,
+            (unsigned long long)STAT_LOAD(stats, shm_write_count));
+    return ret;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 int configure_serial_raw(int fd) {
     if (tcgetattr(fd, &orig_tio) < 0) { perror("tcgetattr"); return 1; }
 
     struct termios tio = orig_tio;  // start from original settings
-    cfsetispeed(&tio, B9600);
-    cfsetospeed(&tio, B9600);
+    cfsetispeed(&tio, baud_to_speed(serial_baud));
+    cfsetospeed(&tio, baud_to_speed(serial_baud));
     cfmakeraw(&tio);
     tio.c_cc[VMIN]  = 0;
     tio.c_cc[VTIME] = 0;
@@ -2188,15 +5528,50 @@ void restore_serial(int fd) {
 
 ////////////////////////////////////////////////////////////////////////////////
 
+// Formats the other threads' trace records onto stderr, off their hot paths.
+// Sleeps while tracing is off, after draining what was recorded until then.
+static void* trace_thread_func(void *arg)
+{
+    (void)arg;
+    const struct timespec period = { 0, 20 * 1000000L };
+    while (!atomic_load(&stop)) {
+        trace_drain(stderr);
+        if (trace_enabled()) {
+            nanosleep(&period, NULL);
+            continue;
+        }
+        pthread_mutex_lock(&trace_wake_mutex);
+        while (!trace_enabled() && !atomic_load(&stop))
+            pthread_cond_wait(&trace_wake_cond, &trace_wake_mutex);
+        pthread_mutex_unlock(&trace_wake_mutex);
+    }
+    return NULL;
+}
+
+// Records still in the rings when the process exits
+static void trace_flush(void)
+{
+    trace_drain(stderr);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 int main(int argc, char *argv[]) {
     const char *devname = NULL;
     int unit = -1;
     int no_raw = 0;
+    int metrics_port = 0;
+    const char *record_path = NULL;
+    size_t record_size = GPS_RECORD_SIZE_DEFAULT;
+    char *replay_paths[REPLAY_FILES_MAX];
+    int replay_count = 0;
 
     // Initialize default date seed directory
     strncpy(date_seed_dir, date_seed_dir_default, PATH_MAX_LEN - 1);
     date_seed_dir[PATH_MAX_LEN - 1] = '\0';
 
+    atexit(trace_flush);
+
     if (argc < 2) {
         usage_short(argv[0]);
         return 1;
@@ -2211,12 +5586,32 @@ int main(int argc, char *argv[]) {
         {"allow-invalid",  no_argument,       0, 'a'},
         {"date-seed-dir",  required_argument, 0, 's'},
         {"ublox-zda-only", no_argument,       0, 'u'},
+        {"receiver",       required_argument, 0, 'g'},
+        {"force-config",   no_argument,       0, 'F'},
+        {"persist-config", no_argument,       0, 'P'},
+        {"profile",        required_argument, 0, 'p'},
+        {"pps-width",      required_argument, 0, 'w'},
+        {"pps-period",     required_argument, 0, 't'},
+        {"pps-utc",        no_argument,       0, 'U'},
+        {"nav-rate",       required_argument, 0, 'N'},
+        {"ubx-timeout",    required_argument, 0, 'T'},
+        {"ubx-retries",    required_argument, 0, 'R'},
+        {"ubx-backoff",    required_argument, 0, 'B'},
+        {"health-interval", required_argument, 0, 'I'},
+        {"jam-limit",      required_argument, 0, 'J'},
+        {"utc-valid",      required_argument, 0, 'V'},
+        {"survey",         required_argument, 0, 'S'},
+        {"survey-acc",     required_argument, 0, 'A'},
         {"filter",         required_argument, 0, 'f'},
+        {"metrics-port",   required_argument, 0, 'm'},
+        {"record",         required_argument, 0, 'c'},
+        {"record-size",    required_argument, 0, 'C'},
+        {"replay",         required_argument, 0, 'y'},
         {0, 0, 0, 0}
     };
 
     int opt, opt_index = 0;
-    while ((opt = getopt_long(argc, argv, "hdnras:uf:", long_opts, &opt_index)) != -1) {
+    while ((opt = getopt_long(argc, argv, "hdnras:ug:FPp:w:t:UN:T:R:B:I:J:V:S:A:f:m:c:C:y:", long_opts, &opt_index)) != -1) {
         switch (opt) {
             case 'h':
                 print_usage(stdout, argv[0]);
@@ -2252,13 +5647,157 @@ int main(int argc, char *argv[]) {
                 ublox_zda_only = 1;
                 break;
 
+            case 'g':
+                receiver_opt = gps_family_parse(optarg);
+                if (receiver_opt < 0) {
+                    fprintf(stderr, "Unknown receiver family: %s\n", optarg);
+                    return 1;
+                }
+                break;
+
+            case 'F':
+                force_config = 1;
+                break;
+
+            case 'P':
+                persist_config = 1;
+                break;
+
+            case 'p':
+                profile_name = optarg;
+                break;
+
+            case 'w':
+            case 't': {
+                char *end;
+                unsigned long us = strtoul(optarg, &end, 10);
+                if (*optarg == '\0' || *end != '\0' || us > UINT32_MAX || (opt == 't' && us == 0)) {
+                    fprintf(stderr, "Invalid timepulse %s: %s\n", opt == 'w' ? "width" : "period", optarg);
+                    return 1;
+                }
+                if (opt == 'w')
+                    pps_width_us = (uint32_t)us;
+                else
+                    pps_period_us = (uint32_t)us;
+                pps_config = 1;
+                break;
+            }
+
+            case 'U':
+                pps_utc = 1;
+                pps_config = 1;
+                break;
+
+            case 'N': {
+                char *end;
+                unsigned long ms = strtoul(optarg, &end, 10);
+                if (*optarg == '\0' || *end != '\0' || ms < 25 || ms > 65535) {
+                    fprintf(stderr, "Invalid navigation rate (25-65535 ms): %s\n", optarg);
+                    return 1;
+                }
+                nav_rate_ms = (uint32_t)ms;
+                break;
+            }
+
+            case 'T':
+                if (!parse_int_arg(optarg, 10, 10000, &ubx_timeout_ms)) {
+                    fprintf(stderr, "Invalid UBX timeout (10-10000 ms): %s\n", optarg);
+                    return 1;
+                }
+                break;
+
+            case 'R':
+                if (!parse_int_arg(optarg, 1, 10, &ubx_attempts)) {
+                    fprintf(stderr, "Invalid UBX retries (1-10): %s\n", optarg);
+                    return 1;
+                }
+                break;
+
+            case 'B':
+                if (!parse_int_arg(optarg, 0, 1000, &ubx_backoff_ms)) {
+                    fprintf(stderr, "Invalid UBX backoff (0-1000 ms): %s\n", optarg);
+                    return 1;
+                }
+                break;
+
+            case 'I':
+                if (!parse_int_arg(optarg, 0, 86400, &health_interval_s)) {
+                    fprintf(stderr, "Invalid health interval (0-86400 s): %s\n", optarg);
+                    return 1;
+                }
+                break;
+
+            case 'J':
+                if (!parse_int_arg(optarg, 1, 255, &jam_limit)) {
+                    fprintf(stderr, "Invalid jamming limit (1-255): %s\n", optarg);
+                    return 1;
+                }
+                break;
+
+            case 'V': {
+                int ns;
+                if (!parse_int_arg(optarg, 1, 1000000000, &ns)) {
+                    fprintf(stderr, "Invalid UTC accuracy limit (1-1000000000 ns): %s\n", optarg);
+                    return 1;
+                }
+                utc_tacc_max_ns = (uint32_t)ns;
+                break;
+            }
+
+            case 'S':
+                if (!parse_int_arg(optarg, 1, 604800, &survey_min_s)) {
+                    fprintf(stderr, "Invalid survey duration (1-604800 s): %s\n", optarg);
+                    return 1;
+                }
+                break;
+
+            case 'A': {
+                char *end;
+                survey_acc_m = strtod(optarg, &end);
+                if (end == optarg || *end || !(survey_acc_m >= 0.01 && survey_acc_m <= 100.0)) {
+                    fprintf(stderr, "Invalid survey accuracy (0.01-100 m): %s\n", optarg);
+                    return 1;
+                }
+                break;
+            }
+
             case 'f':
-                nmea_filter_mask = parse_nmea_filter(optarg);
+                nmea_filter_mask = parse_nmea_filter(optarg, NULL);
                 if (nmea_filter_mask == 0) {
                     fprintf(stderr, "Warning: invalid or empty NMEA filter string: '%s'\n", optarg);
                 }
                 break;
 
+            case 'm':
+                metrics_port = atoi(optarg);
+                if (metrics_port <= 0 || metrics_port > 65535) {
+                    fprintf(stderr, "Invalid metrics port: %s\n", optarg);
+                    return 1;
+                }
+                break;
+
+            case 'c':
+                record_path = optarg;
+                break;
+
+            case 'y':
+                if (replay_count == REPLAY_FILES_MAX) {
+                    fprintf(stderr, "At most %d --replay files\n", REPLAY_FILES_MAX);
+                    return 1;
+                }
+                replay_paths[replay_count++] = optarg;
+                break;
+
+            case 'C': {
+                long mb = atol(optarg);
+                if (mb <= 0 || mb > 4095) {
+                    fprintf(stderr, "Invalid record size: %s\n", optarg);
+                    return 1;
+                }
+                record_size = (size_t)mb << 20;
+                break;
+            }
+
             case '?':  // getopt_long already printed an error
                 usage_short(argv[0]);
                 return 1;
@@ -2268,6 +5807,13 @@ int main(int argc, char *argv[]) {
         }
     }
 
+    // A replay needs neither a device nor a unit
+    if (replay_count > 0) {
+        if (optind < argc)
+            fprintf(stderr, "Ignoring device arguments with --replay\n");
+        return replay_run(replay_paths, replay_count, stdout) < 0 ? 2 : 0;
+    }
+
     // --- Positional arguments ---
     if (optind >= argc) {
         fprintf(stderr, "Missing device name\n");
@@ -2295,6 +5841,17 @@ int main(int argc, char *argv[]) {
     append_filename_to_dir(date_seed_dir, date_seed_file, date_seed_path);
     read_date_seed();
 
+    // Compile the receiver profile before touching the device
+    if (profile_name && load_ublox_profile(profile_name) != 0)
+        return 1;
+
+    if (pps_config && pps_width_us >= pps_period_us) {
+        fprintf(stderr, "Timepulse width (%u us) must be shorter than its period (%u us)\n",
+                pps_width_us, pps_period_us);
+        return 1;
+    }
+    build_ublox_timing();
+
     /***************************************************************************/
 
     // Respond to CTRL+C, kill -SIGTERM, and our SHUTDOWN socket command 
@@ -2322,9 +5879,17 @@ int main(int argc, char *argv[]) {
     int fd = open(dev_path, O_RDWR | O_NOCTTY);
     if (fd < 0) { perror("open"); return 1; }
 
+    // Raw capture of the receiver output, for later inspection and replay
+    if (record_path) {
+        if (gps_record_open(&gps_rec, record_path, record_size, devname) < 0) return 1;
+        TRACE("Recording %s to %s\n", dev_path, record_path);
+    }
+
     // Configure raw mode
     if (!no_raw) {
+        serial_baud = read_serial_baud(unit);
         if (configure_serial_raw(fd)) return 1;
+        serial_raw = 1;
         TRACE("Raw mode enabled on %s\n", dev_path);
     } else {
         TRACE("Raw mode skipped on %s\n", dev_path);
@@ -2334,6 +5899,22 @@ int main(int argc, char *argv[]) {
     int listen_fd = setup_unix_socket(unit);
     if (listen_fd < 0) return 1;
 
+    // Export counters for zero-syscall monitoring
+    stats = setup_stats_file(unit);
+
+    // Wakes the socket thread when the GPS thread has output for clients;
+    // without it they are still served, only on the 1 s select() timeout
+    socket_wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (socket_wake_fd < 0)
+        perror("eventfd");
+
+    // Optional loopback OpenMetrics listener
+    int metrics_fd = -1;
+    if (metrics_port) {
+        metrics_fd = setup_metrics_socket(metrics_port);
+        if (metrics_fd < 0) return 1;
+    }
+
     // Shared memory segment (destination)
     int shmid = shmget(NTPD_BASE + unit, sizeof(struct shmTime), IPC_CREAT | 0666);
     if (shmid < 0) { perror("shmget"); return 1; }
@@ -2346,12 +5927,19 @@ int main(int argc, char *argv[]) {
     shm->leap = 0;
     shm->nsamples = 3;
 
+    pthread_t trace_thread = 0;
     pthread_t gps_thread = 0;
     pthread_t sock_thread = 0;
     struct gps_thread_args gargs = {fd, shm};
-    struct socket_thread_args sargs = {listen_fd};
+    struct socket_thread_args sargs = {listen_fd, metrics_fd};
+
+    int ret = pthread_create(&trace_thread, NULL, trace_thread_func, NULL);
+    if (ret != 0) {
+        fprintf(stderr, "pthread_create failed: %s\n", strerror(ret));
+        return 1;
+    }
 
-    int ret = pthread_create(&gps_thread, NULL, gps_thread_func, &gargs);
+    ret = pthread_create(&gps_thread, NULL, gps_thread_func, &gargs);
     if (ret != 0) {
         fprintf(stderr, "pthread_create failed: %s\n", strerror(ret));
         return 1;
@@ -2366,15 +5954,27 @@ int main(int argc, char *argv[]) {
     while (!atomic_load(&stop))
         pause();  // main thread waits for CTRL+C
 
+    trace_wake();   // may be waiting for tracing to be turned on
     pthread_join(gps_thread, NULL);
     pthread_join(sock_thread, NULL);
+    pthread_join(trace_thread, NULL);
+    if (gps_rec.map || gps_rec.records) {
+        TRACE("Recorded %llu reads, %llu bytes, %llu rotations to %s\n",
+              (unsigned long long)gps_rec.records, (unsigned long long)gps_rec.bytes,
+              (unsigned long long)gps_rec.rotations, record_path);
+        gps_record_close(&gps_rec);
+    }
+    trace_flush();
 
     close(listen_fd);
+    if (metrics_fd >= 0) close(metrics_fd);
+    if (socket_wake_fd >= 0) close(socket_wake_fd);
     if (shm != (void*)-1) if (shmdt(shm) < 0) perror("shmdt");
     restore_serial(fd);
     close(fd);
 
     cleanup_unix_socket();
+    cleanup_stats_file();
     fprintf(stderr, "shm_writer: terminated cleanly\n");
     return 0;
 }
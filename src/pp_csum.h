@@ -3,6 +3,8 @@
 /*******************************************************************************
  pp_csum.h - Preprocessor macros for cumulative sum expansion
 
+ Generated by test/gen-csum-macros.py, do not edit.
+
  Defines macros that expand each argument into a cumulative sum of the arguments
 
  Example:
@@ -12,6 +14,11 @@
    But, we expand a simplified expression here:
      4*a + 3*b + 2*c + 1*d
 
+   which PP_CSUM evaluates as 4*(a+b+c+d) - (0*a + 1*b + 2*c + 3*d), so the
+   weight of an argument depends only on its position, not on the length
+   of the list.  The PP_CSUM_Lk macros below produce the second term,
+   32 arguments per level, chained like the PP_SUM_Lk macros.
+
    PP_CSUM(1, 2, 3, 4)   ->  20
 
  Copyright (C) 2025 Richard Elwell
@@ -31,261 +38,70 @@
 
 *******************************************************************************/
 
-#define PP_CSUM_1(a1) (1*a1)
-#define PP_CSUM_2(a1,a2) (2*a1+1*a2)
-#define PP_CSUM_3(a1,a2,a3) (3*a1+2*a2+1*a3)
-#define PP_CSUM_4(a1,a2,a3,a4) (4*a1+3*a2+2*a3+1*a4)
-#define PP_CSUM_5(a1,a2,a3,a4,a5) (5*a1+4*a2+3*a3+2*a4+1*a5)
-#define PP_CSUM_6(a1,a2,a3,a4,a5,a6) (6*a1+5*a2+4*a3+3*a4+2*a5+1*a6)
-#define PP_CSUM_7(a1,a2,a3,a4,a5,a6,a7) (7*a1+6*a2+5*a3+4*a4+3*a5+2*a6+1*a7)
-#define PP_CSUM_8(a1,a2,a3,a4,a5,a6,a7,a8) (8*a1+7*a2+6*a3+5*a4+4*a5+3*a6+2*a7+1*a8)
-#define PP_CSUM_9(a1,a2,a3,a4,a5,a6,a7,a8,a9) (9*a1+8*a2+7*a3+6*a4+5*a5+4*a6+3*a7+2*a8+1*a9)
-#define PP_CSUM_10(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10) (10*a1+9*a2+8*a3+7*a4+6*a5+5*a6+4*a7+3*a8+2*a9+1*a10)
-#define PP_CSUM_11(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11) (11*a1+10*a2+9*a3+8*a4+7*a5+6*a6+5*a7+4*a8+3*a9+2*a10+1*a11)
-#define PP_CSUM_12(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12) (12*a1+11*a2+10*a3+9*a4+8*a5+7*a6+6*a7+5*a8+4*a9+3*a10+2*a11+1*a12)
-#define PP_CSUM_13(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13) (13*a1+12*a2+11*a3+10*a4+9*a5+8*a6+7*a7+6*a8+5*a9+4*a10+3*a11+2*a12+1*a13)
-#define PP_CSUM_14(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14) (14*a1+13*a2+12*a3+11*a4+10*a5+9*a6+8*a7+7*a8+6*a9+5*a10+4*a11+3*a12+2*a13+1*a14)
-#define PP_CSUM_15(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15) (15*a1+14*a2+13*a3+12*a4+11*a5+10*a6+9*a7+8*a8+7*a9+6*a10+5*a11+4*a12+3*a13+2*a14+1*a15)
-#define PP_CSUM_16(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16) (16*a1+15*a2+14*a3+13*a4+12*a5+11*a6+10*a7+9*a8+8*a9+7*a10+6*a11+5*a12+4*a13+3*a14+2*a15+1*a16)
-#define PP_CSUM_17(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17) (17*a1+16*a2+15*a3+14*a4+13*a5+12*a6+11*a7+10*a8+9*a9+8*a10+7*a11+6*a12+5*a13+4*a14+3*a15+2*a16+1*a17)
-#define PP_CSUM_18(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18) (18*a1+17*a2+16*a3+15*a4+14*a5+13*a6+12*a7+11*a8+10*a9+9*a10+8*a11+7*a12+6*a13+5*a14+4*a15+3*a16+2*a17+1*a18)
-#define PP_CSUM_19(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19) (19*a1+18*a2+17*a3+16*a4+15*a5+14*a6+13*a7+12*a8+11*a9+10*a10+9*a11+8*a12+7*a13+6*a14+5*a15+4*a16+3*a17+2*a18+1*a19)
-#define PP_CSUM_20(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20) (20*a1+19*a2+18*a3+17*a4+16*a5+15*a6+14*a7+13*a8+12*a9+11*a10+10*a11+9*a12+8*a13+7*a14+6*a15+5*a16+4*a17+3*a18+2*a19+1*a20)
-#define PP_CSUM_21(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21) (21*a1+20*a2+19*a3+18*a4+17*a5+16*a6+15*a7+14*a8+13*a9+12*a10+11*a11+10*a12+9*a13+8*a14+7*a15+6*a16+5*a17+4*a18+3*a19+2*a20+1*a21)
-#define PP_CSUM_22(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22) (22*a1+21*a2+20*a3+19*a4+18*a5+17*a6+16*a7+15*a8+14*a9+13*a10+12*a11+11*a12+10*a13+9*a14+8*a15+7*a16+6*a17+5*a18+4*a19+3*a20+2*a21+1*a22)
-#define PP_CSUM_23(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23) (23*a1+22*a2+21*a3+20*a4+19*a5+18*a6+17*a7+16*a8+15*a9+14*a10+13*a11+12*a12+11*a13+10*a14+9*a15+8*a16+7*a17+6*a18+5*a19+4*a20+3*a21+2*a22+1*a23)
-#define PP_CSUM_24(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24) (24*a1+23*a2+22*a3+21*a4+20*a5+19*a6+18*a7+17*a8+16*a9+15*a10+14*a11+13*a12+12*a13+11*a14+10*a15+9*a16+8*a17+7*a18+6*a19+5*a20+4*a21+3*a22+2*a23+1*a24)
-#define PP_CSUM_25(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25) (25*a1+24*a2+23*a3+22*a4+21*a5+20*a6+19*a7+18*a8+17*a9+16*a10+15*a11+14*a12+13*a13+12*a14+11*a15+10*a16+9*a17+8*a18+7*a19+6*a20+5*a21+4*a22+3*a23+2*a24+1*a25)
-#define PP_CSUM_26(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26) (26*a1+25*a2+24*a3+23*a4+22*a5+21*a6+20*a7+19*a8+18*a9+17*a10+16*a11+15*a12+14*a13+13*a14+12*a15+11*a16+10*a17+9*a18+8*a19+7*a20+6*a21+5*a22+4*a23+3*a24+2*a25+1*a26)
-#define PP_CSUM_27(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27) (27*a1+26*a2+25*a3+24*a4+23*a5+22*a6+21*a7+20*a8+19*a9+18*a10+17*a11+16*a12+15*a13+14*a14+13*a15+12*a16+11*a17+10*a18+9*a19+8*a20+7*a21+6*a22+5*a23+4*a24+3*a25+2*a26+1*a27)
-#define PP_CSUM_28(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28) (28*a1+27*a2+26*a3+25*a4+24*a5+23*a6+22*a7+21*a8+20*a9+19*a10+18*a11+17*a12+16*a13+15*a14+14*a15+13*a16+12*a17+11*a18+10*a19+9*a20+8*a21+7*a22+6*a23+5*a24+4*a25+3*a26+2*a27+1*a28)
-#define PP_CSUM_29(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29) (29*a1+28*a2+27*a3+26*a4+25*a5+24*a6+23*a7+22*a8+21*a9+20*a10+19*a11+18*a12+17*a13+16*a14+15*a15+14*a16+13*a17+12*a18+11*a19+10*a20+9*a21+8*a22+7*a23+6*a24+5*a25+4*a26+3*a27+2*a28+1*a29)
-#define PP_CSUM_30(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30) (30*a1+29*a2+28*a3+27*a4+26*a5+25*a6+24*a7+23*a8+22*a9+21*a10+20*a11+19*a12+18*a13+17*a14+16*a15+15*a16+14*a17+13*a18+12*a19+11*a20+10*a21+9*a22+8*a23+7*a24+6*a25+5*a26+4*a27+3*a28+2*a29+1*a30)
-#define PP_CSUM_31(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31) (31*a1+30*a2+29*a3+28*a4+27*a5+26*a6+25*a7+24*a8+23*a9+22*a10+21*a11+20*a12+19*a13+18*a14+17*a15+16*a16+15*a17+14*a18+13*a19+12*a20+11*a21+10*a22+9*a23+8*a24+7*a25+6*a26+5*a27+4*a28+3*a29+2*a30+1*a31)
-#define PP_CSUM_32(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32) (32*a1+31*a2+30*a3+29*a4+28*a5+27*a6+26*a7+25*a8+24*a9+23*a10+22*a11+21*a12+20*a13+19*a14+18*a15+17*a16+16*a17+15*a18+14*a19+13*a20+12*a21+11*a22+10*a23+9*a24+8*a25+7*a26+6*a27+5*a28+4*a29+3*a30+2*a31+1*a32)
-#define PP_CSUM_33(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33) (33*a1+32*a2+31*a3+30*a4+29*a5+28*a6+27*a7+26*a8+25*a9+24*a10+23*a11+22*a12+21*a13+20*a14+19*a15+18*a16+17*a17+16*a18+15*a19+14*a20+13*a21+12*a22+11*a23+10*a24+9*a25+8*a26+7*a27+6*a28+5*a29+4*a30+3*a31+2*a32+1*a33)
-#define PP_CSUM_34(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34) (34*a1+33*a2+32*a3+31*a4+30*a5+29*a6+28*a7+27*a8+26*a9+25*a10+24*a11+23*a12+22*a13+21*a14+20*a15+19*a16+18*a17+17*a18+16*a19+15*a20+14*a21+13*a22+12*a23+11*a24+10*a25+9*a26+8*a27+7*a28+6*a29+5*a30+4*a31+3*a32+2*a33+1*a34)
-#define PP_CSUM_35(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35) (35*a1+34*a2+33*a3+32*a4+31*a5+30*a6+29*a7+28*a8+27*a9+26*a10+25*a11+24*a12+23*a13+22*a14+21*a15+20*a16+19*a17+18*a18+17*a19+16*a20+15*a21+14*a22+13*a23+12*a24+11*a25+10*a26+9*a27+8*a28+7*a29+6*a30+5*a31+4*a32+3*a33+2*a34+1*a35)
-#define PP_CSUM_36(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36) (36*a1+35*a2+34*a3+33*a4+32*a5+31*a6+30*a7+29*a8+28*a9+27*a10+26*a11+25*a12+24*a13+23*a14+22*a15+21*a16+20*a17+19*a18+18*a19+17*a20+16*a21+15*a22+14*a23+13*a24+12*a25+11*a26+10*a27+9*a28+8*a29+7*a30+6*a31+5*a32+4*a33+3*a34+2*a35+1*a36)
-#define PP_CSUM_37(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37) (37*a1+36*a2+35*a3+34*a4+33*a5+32*a6+31*a7+30*a8+29*a9+28*a10+27*a11+26*a12+25*a13+24*a14+23*a15+22*a16+21*a17+20*a18+19*a19+18*a20+17*a21+16*a22+15*a23+14*a24+13*a25+12*a26+11*a27+10*a28+9*a29+8*a30+7*a31+6*a32+5*a33+4*a34+3*a35+2*a36+1*a37)
-#define PP_CSUM_38(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38) (38*a1+37*a2+36*a3+35*a4+34*a5+33*a6+32*a7+31*a8+30*a9+29*a10+28*a11+27*a12+26*a13+25*a14+24*a15+23*a16+22*a17+21*a18+20*a19+19*a20+18*a21+17*a22+16*a23+15*a24+14*a25+13*a26+12*a27+11*a28+10*a29+9*a30+8*a31+7*a32+6*a33+5*a34+4*a35+3*a36+2*a37+1*a38)
-#define PP_CSUM_39(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39) (39*a1+38*a2+37*a3+36*a4+35*a5+34*a6+33*a7+32*a8+31*a9+30*a10+29*a11+28*a12+27*a13+26*a14+25*a15+24*a16+23*a17+22*a18+21*a19+20*a20+19*a21+18*a22+17*a23+16*a24+15*a25+14*a26+13*a27+12*a28+11*a29+10*a30+9*a31+8*a32+7*a33+6*a34+5*a35+4*a36+3*a37+2*a38+1*a39)
-#define PP_CSUM_40(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40) (40*a1+39*a2+38*a3+37*a4+36*a5+35*a6+34*a7+33*a8+32*a9+31*a10+30*a11+29*a12+28*a13+27*a14+26*a15+25*a16+24*a17+23*a18+22*a19+21*a20+20*a21+19*a22+18*a23+17*a24+16*a25+15*a26+14*a27+13*a28+12*a29+11*a30+10*a31+9*a32+8*a33+7*a34+6*a35+5*a36+4*a37+3*a38+2*a39+1*a40)
-#define PP_CSUM_41(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41) (41*a1+40*a2+39*a3+38*a4+37*a5+36*a6+35*a7+34*a8+33*a9+32*a10+31*a11+30*a12+29*a13+28*a14+27*a15+26*a16+25*a17+24*a18+23*a19+22*a20+21*a21+20*a22+19*a23+18*a24+17*a25+16*a26+15*a27+14*a28+13*a29+12*a30+11*a31+10*a32+9*a33+8*a34+7*a35+6*a36+5*a37+4*a38+3*a39+2*a40+1*a41)
-#define PP_CSUM_42(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42) (42*a1+41*a2+40*a3+39*a4+38*a5+37*a6+36*a7+35*a8+34*a9+33*a10+32*a11+31*a12+30*a13+29*a14+28*a15+27*a16+26*a17+25*a18+24*a19+23*a20+22*a21+21*a22+20*a23+19*a24+18*a25+17*a26+16*a27+15*a28+14*a29+13*a30+12*a31+11*a32+10*a33+9*a34+8*a35+7*a36+6*a37+5*a38+4*a39+3*a40+2*a41+1*a42)
-#define PP_CSUM_43(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43) (43*a1+42*a2+41*a3+40*a4+39*a5+38*a6+37*a7+36*a8+35*a9+34*a10+33*a11+32*a12+31*a13+30*a14+29*a15+28*a16+27*a17+26*a18+25*a19+24*a20+23*a21+22*a22+21*a23+20*a24+19*a25+18*a26+17*a27+16*a28+15*a29+14*a30+13*a31+12*a32+11*a33+10*a34+9*a35+8*a36+7*a37+6*a38+5*a39+4*a40+3*a41+2*a42+1*a43)
-#define PP_CSUM_44(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44) (44*a1+43*a2+42*a3+41*a4+40*a5+39*a6+38*a7+37*a8+36*a9+35*a10+34*a11+33*a12+32*a13+31*a14+30*a15+29*a16+28*a17+27*a18+26*a19+25*a20+24*a21+23*a22+22*a23+21*a24+20*a25+19*a26+18*a27+17*a28+16*a29+15*a30+14*a31+13*a32+12*a33+11*a34+10*a35+9*a36+8*a37+7*a38+6*a39+5*a40+4*a41+3*a42+2*a43+1*a44)
-#define PP_CSUM_45(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45) (45*a1+44*a2+43*a3+42*a4+41*a5+40*a6+39*a7+38*a8+37*a9+36*a10+35*a11+34*a12+33*a13+32*a14+31*a15+30*a16+29*a17+28*a18+27*a19+26*a20+25*a21+24*a22+23*a23+22*a24+21*a25+20*a26+19*a27+18*a28+17*a29+16*a30+15*a31+14*a32+13*a33+12*a34+11*a35+10*a36+9*a37+8*a38+7*a39+6*a40+5*a41+4*a42+3*a43+2*a44+1*a45)
-#define PP_CSUM_46(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46) (46*a1+45*a2+44*a3+43*a4+42*a5+41*a6+40*a7+39*a8+38*a9+37*a10+36*a11+35*a12+34*a13+33*a14+32*a15+31*a16+30*a17+29*a18+28*a19+27*a20+26*a21+25*a22+24*a23+23*a24+22*a25+21*a26+20*a27+19*a28+18*a29+17*a30+16*a31+15*a32+14*a33+13*a34+12*a35+11*a36+10*a37+9*a38+8*a39+7*a40+6*a41+5*a42+4*a43+3*a44+2*a45+1*a46)
-#define PP_CSUM_47(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47) (47*a1+46*a2+45*a3+44*a4+43*a5+42*a6+41*a7+40*a8+39*a9+38*a10+37*a11+36*a12+35*a13+34*a14+33*a15+32*a16+31*a17+30*a18+29*a19+28*a20+27*a21+26*a22+25*a23+24*a24+23*a25+22*a26+21*a27+20*a28+19*a29+18*a30+17*a31+16*a32+15*a33+14*a34+13*a35+12*a36+11*a37+10*a38+9*a39+8*a40+7*a41+6*a42+5*a43+4*a44+3*a45+2*a46+1*a47)
-#define PP_CSUM_48(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48) (48*a1+47*a2+46*a3+45*a4+44*a5+43*a6+42*a7+41*a8+40*a9+39*a10+38*a11+37*a12+36*a13+35*a14+34*a15+33*a16+32*a17+31*a18+30*a19+29*a20+28*a21+27*a22+26*a23+25*a24+24*a25+23*a26+22*a27+21*a28+20*a29+19*a30+18*a31+17*a32+16*a33+15*a34+14*a35+13*a36+12*a37+11*a38+10*a39+9*a40+8*a41+7*a42+6*a43+5*a44+4*a45+3*a46+2*a47+1*a48)
-#define PP_CSUM_49(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49) (49*a1+48*a2+47*a3+46*a4+45*a5+44*a6+43*a7+42*a8+41*a9+40*a10+39*a11+38*a12+37*a13+36*a14+35*a15+34*a16+33*a17+32*a18+31*a19+30*a20+29*a21+28*a22+27*a23+26*a24+25*a25+24*a26+23*a27+22*a28+21*a29+20*a30+19*a31+18*a32+17*a33+16*a34+15*a35+14*a36+13*a37+12*a38+11*a39+10*a40+9*a41+8*a42+7*a43+6*a44+5*a45+4*a46+3*a47+2*a48+1*a49)
-#define PP_CSUM_50(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50) (50*a1+49*a2+48*a3+47*a4+46*a5+45*a6+44*a7+43*a8+42*a9+41*a10+40*a11+39*a12+38*a13+37*a14+36*a15+35*a16+34*a17+33*a18+32*a19+31*a20+30*a21+29*a22+28*a23+27*a24+26*a25+25*a26+24*a27+23*a28+22*a29+21*a30+20*a31+19*a32+18*a33+17*a34+16*a35+15*a36+14*a37+13*a38+12*a39+11*a40+10*a41+9*a42+8*a43+7*a44+6*a45+5*a46+4*a47+3*a48+2*a49+1*a50)
-#define PP_CSUM_51(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51) (51*a1+50*a2+49*a3+48*a4+47*a5+46*a6+45*a7+44*a8+43*a9+42*a10+41*a11+40*a12+39*a13+38*a14+37*a15+36*a16+35*a17+34*a18+33*a19+32*a20+31*a21+30*a22+29*a23+28*a24+27*a25+26*a26+25*a27+24*a28+23*a29+22*a30+21*a31+20*a32+19*a33+18*a34+17*a35+16*a36+15*a37+14*a38+13*a39+12*a40+11*a41+10*a42+9*a43+8*a44+7*a45+6*a46+5*a47+4*a48+3*a49+2*a50+1*a51)
-#define PP_CSUM_52(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52) (52*a1+51*a2+50*a3+49*a4+48*a5+47*a6+46*a7+45*a8+44*a9+43*a10+42*a11+41*a12+40*a13+39*a14+38*a15+37*a16+36*a17+35*a18+34*a19+33*a20+32*a21+31*a22+30*a23+29*a24+28*a25+27*a26+26*a27+25*a28+24*a29+23*a30+22*a31+21*a32+20*a33+19*a34+18*a35+17*a36+16*a37+15*a38+14*a39+13*a40+12*a41+11*a42+10*a43+9*a44+8*a45+7*a46+6*a47+5*a48+4*a49+3*a50+2*a51+1*a52)
-#define PP_CSUM_53(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53) (53*a1+52*a2+51*a3+50*a4+49*a5+48*a6+47*a7+46*a8+45*a9+44*a10+43*a11+42*a12+41*a13+40*a14+39*a15+38*a16+37*a17+36*a18+35*a19+34*a20+33*a21+32*a22+31*a23+30*a24+29*a25+28*a26+27*a27+26*a28+25*a29+24*a30+23*a31+22*a32+21*a33+20*a34+19*a35+18*a36+17*a37+16*a38+15*a39+14*a40+13*a41+12*a42+11*a43+10*a44+9*a45+8*a46+7*a47+6*a48+5*a49+4*a50+3*a51+2*a52+1*a53)
-#define PP_CSUM_54(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54) (54*a1+53*a2+52*a3+51*a4+50*a5+49*a6+48*a7+47*a8+46*a9+45*a10+44*a11+43*a12+42*a13+41*a14+40*a15+39*a16+38*a17+37*a18+36*a19+35*a20+34*a21+33*a22+32*a23+31*a24+30*a25+29*a26+28*a27+27*a28+26*a29+25*a30+24*a31+23*a32+22*a33+21*a34+20*a35+19*a36+18*a37+17*a38+16*a39+15*a40+14*a41+13*a42+12*a43+11*a44+10*a45+9*a46+8*a47+7*a48+6*a49+5*a50+4*a51+3*a52+2*a53+1*a54)
-#define PP_CSUM_55(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55) (55*a1+54*a2+53*a3+52*a4+51*a5+50*a6+49*a7+48*a8+47*a9+46*a10+45*a11+44*a12+43*a13+42*a14+41*a15+40*a16+39*a17+38*a18+37*a19+36*a20+35*a21+34*a22+33*a23+32*a24+31*a25+30*a26+29*a27+28*a28+27*a29+26*a30+25*a31+24*a32+23*a33+22*a34+21*a35+20*a36+19*a37+18*a38+17*a39+16*a40+15*a41+14*a42+13*a43+12*a44+11*a45+10*a46+9*a47+8*a48+7*a49+6*a50+5*a51+4*a52+3*a53+2*a54+1*a55)
-#define PP_CSUM_56(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56) (56*a1+55*a2+54*a3+53*a4+52*a5+51*a6+50*a7+49*a8+48*a9+47*a10+46*a11+45*a12+44*a13+43*a14+42*a15+41*a16+40*a17+39*a18+38*a19+37*a20+36*a21+35*a22+34*a23+33*a24+32*a25+31*a26+30*a27+29*a28+28*a29+27*a30+26*a31+25*a32+24*a33+23*a34+22*a35+21*a36+20*a37+19*a38+18*a39+17*a40+16*a41+15*a42+14*a43+13*a44+12*a45+11*a46+10*a47+9*a48+8*a49+7*a50+6*a51+5*a52+4*a53+3*a54+2*a55+1*a56)
-#define PP_CSUM_57(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57) (57*a1+56*a2+55*a3+54*a4+53*a5+52*a6+51*a7+50*a8+49*a9+48*a10+47*a11+46*a12+45*a13+44*a14+43*a15+42*a16+41*a17+40*a18+39*a19+38*a20+37*a21+36*a22+35*a23+34*a24+33*a25+32*a26+31*a27+30*a28+29*a29+28*a30+27*a31+26*a32+25*a33+24*a34+23*a35+22*a36+21*a37+20*a38+19*a39+18*a40+17*a41+16*a42+15*a43+14*a44+13*a45+12*a46+11*a47+10*a48+9*a49+8*a50+7*a51+6*a52+5*a53+4*a54+3*a55+2*a56+1*a57)
-#define PP_CSUM_58(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58) (58*a1+57*a2+56*a3+55*a4+54*a5+53*a6+52*a7+51*a8+50*a9+49*a10+48*a11+47*a12+46*a13+45*a14+44*a15+43*a16+42*a17+41*a18+40*a19+39*a20+38*a21+37*a22+36*a23+35*a24+34*a25+33*a26+32*a27+31*a28+30*a29+29*a30+28*a31+27*a32+26*a33+25*a34+24*a35+23*a36+22*a37+21*a38+20*a39+19*a40+18*a41+17*a42+16*a43+15*a44+14*a45+13*a46+12*a47+11*a48+10*a49+9*a50+8*a51+7*a52+6*a53+5*a54+4*a55+3*a56+2*a57+1*a58)
-#define PP_CSUM_59(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59) (59*a1+58*a2+57*a3+56*a4+55*a5+54*a6+53*a7+52*a8+51*a9+50*a10+49*a11+48*a12+47*a13+46*a14+45*a15+44*a16+43*a17+42*a18+41*a19+40*a20+39*a21+38*a22+37*a23+36*a24+35*a25+34*a26+33*a27+32*a28+31*a29+30*a30+29*a31+28*a32+27*a33+26*a34+25*a35+24*a36+23*a37+22*a38+21*a39+20*a40+19*a41+18*a42+17*a43+16*a44+15*a45+14*a46+13*a47+12*a48+11*a49+10*a50+9*a51+8*a52+7*a53+6*a54+5*a55+4*a56+3*a57+2*a58+1*a59)
-#define PP_CSUM_60(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60) (60*a1+59*a2+58*a3+57*a4+56*a5+55*a6+54*a7+53*a8+52*a9+51*a10+50*a11+49*a12+48*a13+47*a14+46*a15+45*a16+44*a17+43*a18+42*a19+41*a20+40*a21+39*a22+38*a23+37*a24+36*a25+35*a26+34*a27+33*a28+32*a29+31*a30+30*a31+29*a32+28*a33+27*a34+26*a35+25*a36+24*a37+23*a38+22*a39+21*a40+20*a41+19*a42+18*a43+17*a44+16*a45+15*a46+14*a47+13*a48+12*a49+11*a50+10*a51+9*a52+8*a53+7*a54+6*a55+5*a56+4*a57+3*a58+2*a59+1*a60)
-#define PP_CSUM_61(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61) (61*a1+60*a2+59*a3+58*a4+57*a5+56*a6+55*a7+54*a8+53*a9+52*a10+51*a11+50*a12+49*a13+48*a14+47*a15+46*a16+45*a17+44*a18+43*a19+42*a20+41*a21+40*a22+39*a23+38*a24+37*a25+36*a26+35*a27+34*a28+33*a29+32*a30+31*a31+30*a32+29*a33+28*a34+27*a35+26*a36+25*a37+24*a38+23*a39+22*a40+21*a41+20*a42+19*a43+18*a44+17*a45+16*a46+15*a47+14*a48+13*a49+12*a50+11*a51+10*a52+9*a53+8*a54+7*a55+6*a56+5*a57+4*a58+3*a59+2*a60+1*a61)
-#define PP_CSUM_62(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62) (62*a1+61*a2+60*a3+59*a4+58*a5+57*a6+56*a7+55*a8+54*a9+53*a10+52*a11+51*a12+50*a13+49*a14+48*a15+47*a16+46*a17+45*a18+44*a19+43*a20+42*a21+41*a22+40*a23+39*a24+38*a25+37*a26+36*a27+35*a28+34*a29+33*a30+32*a31+31*a32+30*a33+29*a34+28*a35+27*a36+26*a37+25*a38+24*a39+23*a40+22*a41+21*a42+20*a43+19*a44+18*a45+17*a46+16*a47+15*a48+14*a49+13*a50+12*a51+11*a52+10*a53+9*a54+8*a55+7*a56+6*a57+5*a58+4*a59+3*a60+2*a61+1*a62)
-#define PP_CSUM_63(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63) (63*a1+62*a2+61*a3+60*a4+59*a5+58*a6+57*a7+56*a8+55*a9+54*a10+53*a11+52*a12+51*a13+50*a14+49*a15+48*a16+47*a17+46*a18+45*a19+44*a20+43*a21+42*a22+41*a23+40*a24+39*a25+38*a26+37*a27+36*a28+35*a29+34*a30+33*a31+32*a32+31*a33+30*a34+29*a35+28*a36+27*a37+26*a38+25*a39+24*a40+23*a41+22*a42+21*a43+20*a44+19*a45+18*a46+17*a47+16*a48+15*a49+14*a50+13*a51+12*a52+11*a53+10*a54+9*a55+8*a56+7*a57+6*a58+5*a59+4*a60+3*a61+2*a62+1*a63)
-#define PP_CSUM_64(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64) (64*a1+63*a2+62*a3+61*a4+60*a5+59*a6+58*a7+57*a8+56*a9+55*a10+54*a11+53*a12+52*a13+51*a14+50*a15+49*a16+48*a17+47*a18+46*a19+45*a20+44*a21+43*a22+42*a23+41*a24+40*a25+39*a26+38*a27+37*a28+36*a29+35*a30+34*a31+33*a32+32*a33+31*a34+30*a35+29*a36+28*a37+27*a38+26*a39+25*a40+24*a41+23*a42+22*a43+21*a44+20*a45+19*a46+18*a47+17*a48+16*a49+15*a50+14*a51+13*a52+12*a53+11*a54+10*a55+9*a56+8*a57+7*a58+6*a59+5*a60+4*a61+3*a62+2*a63+1*a64)
-#define PP_CSUM_65(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65) (65*a1+64*a2+63*a3+62*a4+61*a5+60*a6+59*a7+58*a8+57*a9+56*a10+55*a11+54*a12+53*a13+52*a14+51*a15+50*a16+49*a17+48*a18+47*a19+46*a20+45*a21+44*a22+43*a23+42*a24+41*a25+40*a26+39*a27+38*a28+37*a29+36*a30+35*a31+34*a32+33*a33+32*a34+31*a35+30*a36+29*a37+28*a38+27*a39+26*a40+25*a41+24*a42+23*a43+22*a44+21*a45+20*a46+19*a47+18*a48+17*a49+16*a50+15*a51+14*a52+13*a53+12*a54+11*a55+10*a56+9*a57+8*a58+7*a59+6*a60+5*a61+4*a62+3*a63+2*a64+1*a65)
-#define PP_CSUM_66(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66) (66*a1+65*a2+64*a3+63*a4+62*a5+61*a6+60*a7+59*a8+58*a9+57*a10+56*a11+55*a12+54*a13+53*a14+52*a15+51*a16+50*a17+49*a18+48*a19+47*a20+46*a21+45*a22+44*a23+43*a24+42*a25+41*a26+40*a27+39*a28+38*a29+37*a30+36*a31+35*a32+34*a33+33*a34+32*a35+31*a36+30*a37+29*a38+28*a39+27*a40+26*a41+25*a42+24*a43+23*a44+22*a45+21*a46+20*a47+19*a48+18*a49+17*a50+16*a51+15*a52+14*a53+13*a54+12*a55+11*a56+10*a57+9*a58+8*a59+7*a60+6*a61+5*a62+4*a63+3*a64+2*a65+1*a66)
-#define PP_CSUM_67(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67) (67*a1+66*a2+65*a3+64*a4+63*a5+62*a6+61*a7+60*a8+59*a9+58*a10+57*a11+56*a12+55*a13+54*a14+53*a15+52*a16+51*a17+50*a18+49*a19+48*a20+47*a21+46*a22+45*a23+44*a24+43*a25+42*a26+41*a27+40*a28+39*a29+38*a30+37*a31+36*a32+35*a33+34*a34+33*a35+32*a36+31*a37+30*a38+29*a39+28*a40+27*a41+26*a42+25*a43+24*a44+23*a45+22*a46+21*a47+20*a48+19*a49+18*a50+17*a51+16*a52+15*a53+14*a54+13*a55+12*a56+11*a57+10*a58+9*a59+8*a60+7*a61+6*a62+5*a63+4*a64+3*a65+2*a66+1*a67)
-#define PP_CSUM_68(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68) (68*a1+67*a2+66*a3+65*a4+64*a5+63*a6+62*a7+61*a8+60*a9+59*a10+58*a11+57*a12+56*a13+55*a14+54*a15+53*a16+52*a17+51*a18+50*a19+49*a20+48*a21+47*a22+46*a23+45*a24+44*a25+43*a26+42*a27+41*a28+40*a29+39*a30+38*a31+37*a32+36*a33+35*a34+34*a35+33*a36+32*a37+31*a38+30*a39+29*a40+28*a41+27*a42+26*a43+25*a44+24*a45+23*a46+22*a47+21*a48+20*a49+19*a50+18*a51+17*a52+16*a53+15*a54+14*a55+13*a56+12*a57+11*a58+10*a59+9*a60+8*a61+7*a62+6*a63+5*a64+4*a65+3*a66+2*a67+1*a68)
-#define PP_CSUM_69(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69) (69*a1+68*a2+67*a3+66*a4+65*a5+64*a6+63*a7+62*a8+61*a9+60*a10+59*a11+58*a12+57*a13+56*a14+55*a15+54*a16+53*a17+52*a18+51*a19+50*a20+49*a21+48*a22+47*a23+46*a24+45*a25+44*a26+43*a27+42*a28+41*a29+40*a30+39*a31+38*a32+37*a33+36*a34+35*a35+34*a36+33*a37+32*a38+31*a39+30*a40+29*a41+28*a42+27*a43+26*a44+25*a45+24*a46+23*a47+22*a48+21*a49+20*a50+19*a51+18*a52+17*a53+16*a54+15*a55+14*a56+13*a57+12*a58+11*a59+10*a60+9*a61+8*a62+7*a63+6*a64+5*a65+4*a66+3*a67+2*a68+1*a69)
-#define PP_CSUM_70(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70) (70*a1+69*a2+68*a3+67*a4+66*a5+65*a6+64*a7+63*a8+62*a9+61*a10+60*a11+59*a12+58*a13+57*a14+56*a15+55*a16+54*a17+53*a18+52*a19+51*a20+50*a21+49*a22+48*a23+47*a24+46*a25+45*a26+44*a27+43*a28+42*a29+41*a30+40*a31+39*a32+38*a33+37*a34+36*a35+35*a36+34*a37+33*a38+32*a39+31*a40+30*a41+29*a42+28*a43+27*a44+26*a45+25*a46+24*a47+23*a48+22*a49+21*a50+20*a51+19*a52+18*a53+17*a54+16*a55+15*a56+14*a57+13*a58+12*a59+11*a60+10*a61+9*a62+8*a63+7*a64+6*a65+5*a66+4*a67+3*a68+2*a69+1*a70)
-#define PP_CSUM_71(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71) (71*a1+70*a2+69*a3+68*a4+67*a5+66*a6+65*a7+64*a8+63*a9+62*a10+61*a11+60*a12+59*a13+58*a14+57*a15+56*a16+55*a17+54*a18+53*a19+52*a20+51*a21+50*a22+49*a23+48*a24+47*a25+46*a26+45*a27+44*a28+43*a29+42*a30+41*a31+40*a32+39*a33+38*a34+37*a35+36*a36+35*a37+34*a38+33*a39+32*a40+31*a41+30*a42+29*a43+28*a44+27*a45+26*a46+25*a47+24*a48+23*a49+22*a50+21*a51+20*a52+19*a53+18*a54+17*a55+16*a56+15*a57+14*a58+13*a59+12*a60+11*a61+10*a62+9*a63+8*a64+7*a65+6*a66+5*a67+4*a68+3*a69+2*a70+1*a71)
-#define PP_CSUM_72(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72) (72*a1+71*a2+70*a3+69*a4+68*a5+67*a6+66*a7+65*a8+64*a9+63*a10+62*a11+61*a12+60*a13+59*a14+58*a15+57*a16+56*a17+55*a18+54*a19+53*a20+52*a21+51*a22+50*a23+49*a24+48*a25+47*a26+46*a27+45*a28+44*a29+43*a30+42*a31+41*a32+40*a33+39*a34+38*a35+37*a36+36*a37+35*a38+34*a39+33*a40+32*a41+31*a42+30*a43+29*a44+28*a45+27*a46+26*a47+25*a48+24*a49+23*a50+22*a51+21*a52+20*a53+19*a54+18*a55+17*a56+16*a57+15*a58+14*a59+13*a60+12*a61+11*a62+10*a63+9*a64+8*a65+7*a66+6*a67+5*a68+4*a69+3*a70+2*a71+1*a72)
-#define PP_CSUM_73(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73) (73*a1+72*a2+71*a3+70*a4+69*a5+68*a6+67*a7+66*a8+65*a9+64*a10+63*a11+62*a12+61*a13+60*a14+59*a15+58*a16+57*a17+56*a18+55*a19+54*a20+53*a21+52*a22+51*a23+50*a24+49*a25+48*a26+47*a27+46*a28+45*a29+44*a30+43*a31+42*a32+41*a33+40*a34+39*a35+38*a36+37*a37+36*a38+35*a39+34*a40+33*a41+32*a42+31*a43+30*a44+29*a45+28*a46+27*a47+26*a48+25*a49+24*a50+23*a51+22*a52+21*a53+20*a54+19*a55+18*a56+17*a57+16*a58+15*a59+14*a60+13*a61+12*a62+11*a63+10*a64+9*a65+8*a66+7*a67+6*a68+5*a69+4*a70+3*a71+2*a72+1*a73)
-#define PP_CSUM_74(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74) (74*a1+73*a2+72*a3+71*a4+70*a5+69*a6+68*a7+67*a8+66*a9+65*a10+64*a11+63*a12+62*a13+61*a14+60*a15+59*a16+58*a17+57*a18+56*a19+55*a20+54*a21+53*a22+52*a23+51*a24+50*a25+49*a26+48*a27+47*a28+46*a29+45*a30+44*a31+43*a32+42*a33+41*a34+40*a35+39*a36+38*a37+37*a38+36*a39+35*a40+34*a41+33*a42+32*a43+31*a44+30*a45+29*a46+28*a47+27*a48+26*a49+25*a50+24*a51+23*a52+22*a53+21*a54+20*a55+19*a56+18*a57+17*a58+16*a59+15*a60+14*a61+13*a62+12*a63+11*a64+10*a65+9*a66+8*a67+7*a68+6*a69+5*a70+4*a71+3*a72+2*a73+1*a74)
-#define PP_CSUM_75(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75) (75*a1+74*a2+73*a3+72*a4+71*a5+70*a6+69*a7+68*a8+67*a9+66*a10+65*a11+64*a12+63*a13+62*a14+61*a15+60*a16+59*a17+58*a18+57*a19+56*a20+55*a21+54*a22+53*a23+52*a24+51*a25+50*a26+49*a27+48*a28+47*a29+46*a30+45*a31+44*a32+43*a33+42*a34+41*a35+40*a36+39*a37+38*a38+37*a39+36*a40+35*a41+34*a42+33*a43+32*a44+31*a45+30*a46+29*a47+28*a48+27*a49+26*a50+25*a51+24*a52+23*a53+22*a54+21*a55+20*a56+19*a57+18*a58+17*a59+16*a60+15*a61+14*a62+13*a63+12*a64+11*a65+10*a66+9*a67+8*a68+7*a69+6*a70+5*a71+4*a72+3*a73+2*a74+1*a75)
-#define PP_CSUM_76(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76) (76*a1+75*a2+74*a3+73*a4+72*a5+71*a6+70*a7+69*a8+68*a9+67*a10+66*a11+65*a12+64*a13+63*a14+62*a15+61*a16+60*a17+59*a18+58*a19+57*a20+56*a21+55*a22+54*a23+53*a24+52*a25+51*a26+50*a27+49*a28+48*a29+47*a30+46*a31+45*a32+44*a33+43*a34+42*a35+41*a36+40*a37+39*a38+38*a39+37*a40+36*a41+35*a42+34*a43+33*a44+32*a45+31*a46+30*a47+29*a48+28*a49+27*a50+26*a51+25*a52+24*a53+23*a54+22*a55+21*a56+20*a57+19*a58+18*a59+17*a60+16*a61+15*a62+14*a63+13*a64+12*a65+11*a66+10*a67+9*a68+8*a69+7*a70+6*a71+5*a72+4*a73+3*a74+2*a75+1*a76)
-#define PP_CSUM_77(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77) (77*a1+76*a2+75*a3+74*a4+73*a5+72*a6+71*a7+70*a8+69*a9+68*a10+67*a11+66*a12+65*a13+64*a14+63*a15+62*a16+61*a17+60*a18+59*a19+58*a20+57*a21+56*a22+55*a23+54*a24+53*a25+52*a26+51*a27+50*a28+49*a29+48*a30+47*a31+46*a32+45*a33+44*a34+43*a35+42*a36+41*a37+40*a38+39*a39+38*a40+37*a41+36*a42+35*a43+34*a44+33*a45+32*a46+31*a47+30*a48+29*a49+28*a50+27*a51+26*a52+25*a53+24*a54+23*a55+22*a56+21*a57+20*a58+19*a59+18*a60+17*a61+16*a62+15*a63+14*a64+13*a65+12*a66+11*a67+10*a68+9*a69+8*a70+7*a71+6*a72+5*a73+4*a74+3*a75+2*a76+1*a77)
-#define PP_CSUM_78(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78) (78*a1+77*a2+76*a3+75*a4+74*a5+73*a6+72*a7+71*a8+70*a9+69*a10+68*a11+67*a12+66*a13+65*a14+64*a15+63*a16+62*a17+61*a18+60*a19+59*a20+58*a21+57*a22+56*a23+55*a24+54*a25+53*a26+52*a27+51*a28+50*a29+49*a30+48*a31+47*a32+46*a33+45*a34+44*a35+43*a36+42*a37+41*a38+40*a39+39*a40+38*a41+37*a42+36*a43+35*a44+34*a45+33*a46+32*a47+31*a48+30*a49+29*a50+28*a51+27*a52+26*a53+25*a54+24*a55+23*a56+22*a57+21*a58+20*a59+19*a60+18*a61+17*a62+16*a63+15*a64+14*a65+13*a66+12*a67+11*a68+10*a69+9*a70+8*a71+7*a72+6*a73+5*a74+4*a75+3*a76+2*a77+1*a78)
-#define PP_CSUM_79(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79) (79*a1+78*a2+77*a3+76*a4+75*a5+74*a6+73*a7+72*a8+71*a9+70*a10+69*a11+68*a12+67*a13+66*a14+65*a15+64*a16+63*a17+62*a18+61*a19+60*a20+59*a21+58*a22+57*a23+56*a24+55*a25+54*a26+53*a27+52*a28+51*a29+50*a30+49*a31+48*a32+47*a33+46*a34+45*a35+44*a36+43*a37+42*a38+41*a39+40*a40+39*a41+38*a42+37*a43+36*a44+35*a45+34*a46+33*a47+32*a48+31*a49+30*a50+29*a51+28*a52+27*a53+26*a54+25*a55+24*a56+23*a57+22*a58+21*a59+20*a60+19*a61+18*a62+17*a63+16*a64+15*a65+14*a66+13*a67+12*a68+11*a69+10*a70+9*a71+8*a72+7*a73+6*a74+5*a75+4*a76+3*a77+2*a78+1*a79)
-#define PP_CSUM_80(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80) (80*a1+79*a2+78*a3+77*a4+76*a5+75*a6+74*a7+73*a8+72*a9+71*a10+70*a11+69*a12+68*a13+67*a14+66*a15+65*a16+64*a17+63*a18+62*a19+61*a20+60*a21+59*a22+58*a23+57*a24+56*a25+55*a26+54*a27+53*a28+52*a29+51*a30+50*a31+49*a32+48*a33+47*a34+46*a35+45*a36+44*a37+43*a38+42*a39+41*a40+40*a41+39*a42+38*a43+37*a44+36*a45+35*a46+34*a47+33*a48+32*a49+31*a50+30*a51+29*a52+28*a53+27*a54+26*a55+25*a56+24*a57+23*a58+22*a59+21*a60+20*a61+19*a62+18*a63+17*a64+16*a65+15*a66+14*a67+13*a68+12*a69+11*a70+10*a71+9*a72+8*a73+7*a74+6*a75+5*a76+4*a77+3*a78+2*a79+1*a80)
-#define PP_CSUM_81(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81) (81*a1+80*a2+79*a3+78*a4+77*a5+76*a6+75*a7+74*a8+73*a9+72*a10+71*a11+70*a12+69*a13+68*a14+67*a15+66*a16+65*a17+64*a18+63*a19+62*a20+61*a21+60*a22+59*a23+58*a24+57*a25+56*a26+55*a27+54*a28+53*a29+52*a30+51*a31+50*a32+49*a33+48*a34+47*a35+46*a36+45*a37+44*a38+43*a39+42*a40+41*a41+40*a42+39*a43+38*a44+37*a45+36*a46+35*a47+34*a48+33*a49+32*a50+31*a51+30*a52+29*a53+28*a54+27*a55+26*a56+25*a57+24*a58+23*a59+22*a60+21*a61+20*a62+19*a63+18*a64+17*a65+16*a66+15*a67+14*a68+13*a69+12*a70+11*a71+10*a72+9*a73+8*a74+7*a75+6*a76+5*a77+4*a78+3*a79+2*a80+1*a81)
-#define PP_CSUM_82(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82) (82*a1+81*a2+80*a3+79*a4+78*a5+77*a6+76*a7+75*a8+74*a9+73*a10+72*a11+71*a12+70*a13+69*a14+68*a15+67*a16+66*a17+65*a18+64*a19+63*a20+62*a21+61*a22+60*a23+59*a24+58*a25+57*a26+56*a27+55*a28+54*a29+53*a30+52*a31+51*a32+50*a33+49*a34+48*a35+47*a36+46*a37+45*a38+44*a39+43*a40+42*a41+41*a42+40*a43+39*a44+38*a45+37*a46+36*a47+35*a48+34*a49+33*a50+32*a51+31*a52+30*a53+29*a54+28*a55+27*a56+26*a57+25*a58+24*a59+23*a60+22*a61+21*a62+20*a63+19*a64+18*a65+17*a66+16*a67+15*a68+14*a69+13*a70+12*a71+11*a72+10*a73+9*a74+8*a75+7*a76+6*a77+5*a78+4*a79+3*a80+2*a81+1*a82)
-#define PP_CSUM_83(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83) (83*a1+82*a2+81*a3+80*a4+79*a5+78*a6+77*a7+76*a8+75*a9+74*a10+73*a11+72*a12+71*a13+70*a14+69*a15+68*a16+67*a17+66*a18+65*a19+64*a20+63*a21+62*a22+61*a23+60*a24+59*a25+58*a26+57*a27+56*a28+55*a29+54*a30+53*a31+52*a32+51*a33+50*a34+49*a35+48*a36+47*a37+46*a38+45*a39+44*a40+43*a41+42*a42+41*a43+40*a44+39*a45+38*a46+37*a47+36*a48+35*a49+34*a50+33*a51+32*a52+31*a53+30*a54+29*a55+28*a56+27*a57+26*a58+25*a59+24*a60+23*a61+22*a62+21*a63+20*a64+19*a65+18*a66+17*a67+16*a68+15*a69+14*a70+13*a71+12*a72+11*a73+10*a74+9*a75+8*a76+7*a77+6*a78+5*a79+4*a80+3*a81+2*a82+1*a83)
-#define PP_CSUM_84(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84) (84*a1+83*a2+82*a3+81*a4+80*a5+79*a6+78*a7+77*a8+76*a9+75*a10+74*a11+73*a12+72*a13+71*a14+70*a15+69*a16+68*a17+67*a18+66*a19+65*a20+64*a21+63*a22+62*a23+61*a24+60*a25+59*a26+58*a27+57*a28+56*a29+55*a30+54*a31+53*a32+52*a33+51*a34+50*a35+49*a36+48*a37+47*a38+46*a39+45*a40+44*a41+43*a42+42*a43+41*a44+40*a45+39*a46+38*a47+37*a48+36*a49+35*a50+34*a51+33*a52+32*a53+31*a54+30*a55+29*a56+28*a57+27*a58+26*a59+25*a60+24*a61+23*a62+22*a63+21*a64+20*a65+19*a66+18*a67+17*a68+16*a69+15*a70+14*a71+13*a72+12*a73+11*a74+10*a75+9*a76+8*a77+7*a78+6*a79+5*a80+4*a81+3*a82+2*a83+1*a84)
-#define PP_CSUM_85(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85) (85*a1+84*a2+83*a3+82*a4+81*a5+80*a6+79*a7+78*a8+77*a9+76*a10+75*a11+74*a12+73*a13+72*a14+71*a15+70*a16+69*a17+68*a18+67*a19+66*a20+65*a21+64*a22+63*a23+62*a24+61*a25+60*a26+59*a27+58*a28+57*a29+56*a30+55*a31+54*a32+53*a33+52*a34+51*a35+50*a36+49*a37+48*a38+47*a39+46*a40+45*a41+44*a42+43*a43+42*a44+41*a45+40*a46+39*a47+38*a48+37*a49+36*a50+35*a51+34*a52+33*a53+32*a54+31*a55+30*a56+29*a57+28*a58+27*a59+26*a60+25*a61+24*a62+23*a63+22*a64+21*a65+20*a66+19*a67+18*a68+17*a69+16*a70+15*a71+14*a72+13*a73+12*a74+11*a75+10*a76+9*a77+8*a78+7*a79+6*a80+5*a81+4*a82+3*a83+2*a84+1*a85)
-#define PP_CSUM_86(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86) (86*a1+85*a2+84*a3+83*a4+82*a5+81*a6+80*a7+79*a8+78*a9+77*a10+76*a11+75*a12+74*a13+73*a14+72*a15+71*a16+70*a17+69*a18+68*a19+67*a20+66*a21+65*a22+64*a23+63*a24+62*a25+61*a26+60*a27+59*a28+58*a29+57*a30+56*a31+55*a32+54*a33+53*a34+52*a35+51*a36+50*a37+49*a38+48*a39+47*a40+46*a41+45*a42+44*a43+43*a44+42*a45+41*a46+40*a47+39*a48+38*a49+37*a50+36*a51+35*a52+34*a53+33*a54+32*a55+31*a56+30*a57+29*a58+28*a59+27*a60+26*a61+25*a62+24*a63+23*a64+22*a65+21*a66+20*a67+19*a68+18*a69+17*a70+16*a71+15*a72+14*a73+13*a74+12*a75+11*a76+10*a77+9*a78+8*a79+7*a80+6*a81+5*a82+4*a83+3*a84+2*a85+1*a86)
-#define PP_CSUM_87(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87) (87*a1+86*a2+85*a3+84*a4+83*a5+82*a6+81*a7+80*a8+79*a9+78*a10+77*a11+76*a12+75*a13+74*a14+73*a15+72*a16+71*a17+70*a18+69*a19+68*a20+67*a21+66*a22+65*a23+64*a24+63*a25+62*a26+61*a27+60*a28+59*a29+58*a30+57*a31+56*a32+55*a33+54*a34+53*a35+52*a36+51*a37+50*a38+49*a39+48*a40+47*a41+46*a42+45*a43+44*a44+43*a45+42*a46+41*a47+40*a48+39*a49+38*a50+37*a51+36*a52+35*a53+34*a54+33*a55+32*a56+31*a57+30*a58+29*a59+28*a60+27*a61+26*a62+25*a63+24*a64+23*a65+22*a66+21*a67+20*a68+19*a69+18*a70+17*a71+16*a72+15*a73+14*a74+13*a75+12*a76+11*a77+10*a78+9*a79+8*a80+7*a81+6*a82+5*a83+4*a84+3*a85+2*a86+1*a87)
-#define PP_CSUM_88(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88) (88*a1+87*a2+86*a3+85*a4+84*a5+83*a6+82*a7+81*a8+80*a9+79*a10+78*a11+77*a12+76*a13+75*a14+74*a15+73*a16+72*a17+71*a18+70*a19+69*a20+68*a21+67*a22+66*a23+65*a24+64*a25+63*a26+62*a27+61*a28+60*a29+59*a30+58*a31+57*a32+56*a33+55*a34+54*a35+53*a36+52*a37+51*a38+50*a39+49*a40+48*a41+47*a42+46*a43+45*a44+44*a45+43*a46+42*a47+41*a48+40*a49+39*a50+38*a51+37*a52+36*a53+35*a54+34*a55+33*a56+32*a57+31*a58+30*a59+29*a60+28*a61+27*a62+26*a63+25*a64+24*a65+23*a66+22*a67+21*a68+20*a69+19*a70+18*a71+17*a72+16*a73+15*a74+14*a75+13*a76+12*a77+11*a78+10*a79+9*a80+8*a81+7*a82+6*a83+5*a84+4*a85+3*a86+2*a87+1*a88)
-#define PP_CSUM_89(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89) (89*a1+88*a2+87*a3+86*a4+85*a5+84*a6+83*a7+82*a8+81*a9+80*a10+79*a11+78*a12+77*a13+76*a14+75*a15+74*a16+73*a17+72*a18+71*a19+70*a20+69*a21+68*a22+67*a23+66*a24+65*a25+64*a26+63*a27+62*a28+61*a29+60*a30+59*a31+58*a32+57*a33+56*a34+55*a35+54*a36+53*a37+52*a38+51*a39+50*a40+49*a41+48*a42+47*a43+46*a44+45*a45+44*a46+43*a47+42*a48+41*a49+40*a50+39*a51+38*a52+37*a53+36*a54+35*a55+34*a56+33*a57+32*a58+31*a59+30*a60+29*a61+28*a62+27*a63+26*a64+25*a65+24*a66+23*a67+22*a68+21*a69+20*a70+19*a71+18*a72+17*a73+16*a74+15*a75+14*a76+13*a77+12*a78+11*a79+10*a80+9*a81+8*a82+7*a83+6*a84+5*a85+4*a86+3*a87+2*a88+1*a89)
-#define PP_CSUM_90(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90) (90*a1+89*a2+88*a3+87*a4+86*a5+85*a6+84*a7+83*a8+82*a9+81*a10+80*a11+79*a12+78*a13+77*a14+76*a15+75*a16+74*a17+73*a18+72*a19+71*a20+70*a21+69*a22+68*a23+67*a24+66*a25+65*a26+64*a27+63*a28+62*a29+61*a30+60*a31+59*a32+58*a33+57*a34+56*a35+55*a36+54*a37+53*a38+52*a39+51*a40+50*a41+49*a42+48*a43+47*a44+46*a45+45*a46+44*a47+43*a48+42*a49+41*a50+40*a51+39*a52+38*a53+37*a54+36*a55+35*a56+34*a57+33*a58+32*a59+31*a60+30*a61+29*a62+28*a63+27*a64+26*a65+25*a66+24*a67+23*a68+22*a69+21*a70+20*a71+19*a72+18*a73+17*a74+16*a75+15*a76+14*a77+13*a78+12*a79+11*a80+10*a81+9*a82+8*a83+7*a84+6*a85+5*a86+4*a87+3*a88+2*a89+1*a90)
-#define PP_CSUM_91(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91) (91*a1+90*a2+89*a3+88*a4+87*a5+86*a6+85*a7+84*a8+83*a9+82*a10+81*a11+80*a12+79*a13+78*a14+77*a15+76*a16+75*a17+74*a18+73*a19+72*a20+71*a21+70*a22+69*a23+68*a24+67*a25+66*a26+65*a27+64*a28+63*a29+62*a30+61*a31+60*a32+59*a33+58*a34+57*a35+56*a36+55*a37+54*a38+53*a39+52*a40+51*a41+50*a42+49*a43+48*a44+47*a45+46*a46+45*a47+44*a48+43*a49+42*a50+41*a51+40*a52+39*a53+38*a54+37*a55+36*a56+35*a57+34*a58+33*a59+32*a60+31*a61+30*a62+29*a63+28*a64+27*a65+26*a66+25*a67+24*a68+23*a69+22*a70+21*a71+20*a72+19*a73+18*a74+17*a75+16*a76+15*a77+14*a78+13*a79+12*a80+11*a81+10*a82+9*a83+8*a84+7*a85+6*a86+5*a87+4*a88+3*a89+2*a90+1*a91)
-#define PP_CSUM_92(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92) (92*a1+91*a2+90*a3+89*a4+88*a5+87*a6+86*a7+85*a8+84*a9+83*a10+82*a11+81*a12+80*a13+79*a14+78*a15+77*a16+76*a17+75*a18+74*a19+73*a20+72*a21+71*a22+70*a23+69*a24+68*a25+67*a26+66*a27+65*a28+64*a29+63*a30+62*a31+61*a32+60*a33+59*a34+58*a35+57*a36+56*a37+55*a38+54*a39+53*a40+52*a41+51*a42+50*a43+49*a44+48*a45+47*a46+46*a47+45*a48+44*a49+43*a50+42*a51+41*a52+40*a53+39*a54+38*a55+37*a56+36*a57+35*a58+34*a59+33*a60+32*a61+31*a62+30*a63+29*a64+28*a65+27*a66+26*a67+25*a68+24*a69+23*a70+22*a71+21*a72+20*a73+19*a74+18*a75+17*a76+16*a77+15*a78+14*a79+13*a80+12*a81+11*a82+10*a83+9*a84+8*a85+7*a86+6*a87+5*a88+4*a89+3*a90+2*a91+1*a92)
-#define PP_CSUM_93(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93) (93*a1+92*a2+91*a3+90*a4+89*a5+88*a6+87*a7+86*a8+85*a9+84*a10+83*a11+82*a12+81*a13+80*a14+79*a15+78*a16+77*a17+76*a18+75*a19+74*a20+73*a21+72*a22+71*a23+70*a24+69*a25+68*a26+67*a27+66*a28+65*a29+64*a30+63*a31+62*a32+61*a33+60*a34+59*a35+58*a36+57*a37+56*a38+55*a39+54*a40+53*a41+52*a42+51*a43+50*a44+49*a45+48*a46+47*a47+46*a48+45*a49+44*a50+43*a51+42*a52+41*a53+40*a54+39*a55+38*a56+37*a57+36*a58+35*a59+34*a60+33*a61+32*a62+31*a63+30*a64+29*a65+28*a66+27*a67+26*a68+25*a69+24*a70+23*a71+22*a72+21*a73+20*a74+19*a75+18*a76+17*a77+16*a78+15*a79+14*a80+13*a81+12*a82+11*a83+10*a84+9*a85+8*a86+7*a87+6*a88+5*a89+4*a90+3*a91+2*a92+1*a93)
-#define PP_CSUM_94(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94) (94*a1+93*a2+92*a3+91*a4+90*a5+89*a6+88*a7+87*a8+86*a9+85*a10+84*a11+83*a12+82*a13+81*a14+80*a15+79*a16+78*a17+77*a18+76*a19+75*a20+74*a21+73*a22+72*a23+71*a24+70*a25+69*a26+68*a27+67*a28+66*a29+65*a30+64*a31+63*a32+62*a33+61*a34+60*a35+59*a36+58*a37+57*a38+56*a39+55*a40+54*a41+53*a42+52*a43+51*a44+50*a45+49*a46+48*a47+47*a48+46*a49+45*a50+44*a51+43*a52+42*a53+41*a54+40*a55+39*a56+38*a57+37*a58+36*a59+35*a60+34*a61+33*a62+32*a63+31*a64+30*a65+29*a66+28*a67+27*a68+26*a69+25*a70+24*a71+23*a72+22*a73+21*a74+20*a75+19*a76+18*a77+17*a78+16*a79+15*a80+14*a81+13*a82+12*a83+11*a84+10*a85+9*a86+8*a87+7*a88+6*a89+5*a90+4*a91+3*a92+2*a93+1*a94)
-#define PP_CSUM_95(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95) (95*a1+94*a2+93*a3+92*a4+91*a5+90*a6+89*a7+88*a8+87*a9+86*a10+85*a11+84*a12+83*a13+82*a14+81*a15+80*a16+79*a17+78*a18+77*a19+76*a20+75*a21+74*a22+73*a23+72*a24+71*a25+70*a26+69*a27+68*a28+67*a29+66*a30+65*a31+64*a32+63*a33+62*a34+61*a35+60*a36+59*a37+58*a38+57*a39+56*a40+55*a41+54*a42+53*a43+52*a44+51*a45+50*a46+49*a47+48*a48+47*a49+46*a50+45*a51+44*a52+43*a53+42*a54+41*a55+40*a56+39*a57+38*a58+37*a59+36*a60+35*a61+34*a62+33*a63+32*a64+31*a65+30*a66+29*a67+28*a68+27*a69+26*a70+25*a71+24*a72+23*a73+22*a74+21*a75+20*a76+19*a77+18*a78+17*a79+16*a80+15*a81+14*a82+13*a83+12*a84+11*a85+10*a86+9*a87+8*a88+7*a89+6*a90+5*a91+4*a92+3*a93+2*a94+1*a95)
-#define PP_CSUM_96(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96) (96*a1+95*a2+94*a3+93*a4+92*a5+91*a6+90*a7+89*a8+88*a9+87*a10+86*a11+85*a12+84*a13+83*a14+82*a15+81*a16+80*a17+79*a18+78*a19+77*a20+76*a21+75*a22+74*a23+73*a24+72*a25+71*a26+70*a27+69*a28+68*a29+67*a30+66*a31+65*a32+64*a33+63*a34+62*a35+61*a36+60*a37+59*a38+58*a39+57*a40+56*a41+55*a42+54*a43+53*a44+52*a45+51*a46+50*a47+49*a48+48*a49+47*a50+46*a51+45*a52+44*a53+43*a54+42*a55+41*a56+40*a57+39*a58+38*a59+37*a60+36*a61+35*a62+34*a63+33*a64+32*a65+31*a66+30*a67+29*a68+28*a69+27*a70+26*a71+25*a72+24*a73+23*a74+22*a75+21*a76+20*a77+19*a78+18*a79+17*a80+16*a81+15*a82+14*a83+13*a84+12*a85+11*a86+10*a87+9*a88+8*a89+7*a90+6*a91+5*a92+4*a93+3*a94+2*a95+1*a96)
-#define PP_CSUM_97(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97) (97*a1+96*a2+95*a3+94*a4+93*a5+92*a6+91*a7+90*a8+89*a9+88*a10+87*a11+86*a12+85*a13+84*a14+83*a15+82*a16+81*a17+80*a18+79*a19+78*a20+77*a21+76*a22+75*a23+74*a24+73*a25+72*a26+71*a27+70*a28+69*a29+68*a30+67*a31+66*a32+65*a33+64*a34+63*a35+62*a36+61*a37+60*a38+59*a39+58*a40+57*a41+56*a42+55*a43+54*a44+53*a45+52*a46+51*a47+50*a48+49*a49+48*a50+47*a51+46*a52+45*a53+44*a54+43*a55+42*a56+41*a57+40*a58+39*a59+38*a60+37*a61+36*a62+35*a63+34*a64+33*a65+32*a66+31*a67+30*a68+29*a69+28*a70+27*a71+26*a72+25*a73+24*a74+23*a75+22*a76+21*a77+20*a78+19*a79+18*a80+17*a81+16*a82+15*a83+14*a84+13*a85+12*a86+11*a87+10*a88+9*a89+8*a90+7*a91+6*a92+5*a93+4*a94+3*a95+2*a96+1*a97)
-#define PP_CSUM_98(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98) (98*a1+97*a2+96*a3+95*a4+94*a5+93*a6+92*a7+91*a8+90*a9+89*a10+88*a11+87*a12+86*a13+85*a14+84*a15+83*a16+82*a17+81*a18+80*a19+79*a20+78*a21+77*a22+76*a23+75*a24+74*a25+73*a26+72*a27+71*a28+70*a29+69*a30+68*a31+67*a32+66*a33+65*a34+64*a35+63*a36+62*a37+61*a38+60*a39+59*a40+58*a41+57*a42+56*a43+55*a44+54*a45+53*a46+52*a47+51*a48+50*a49+49*a50+48*a51+47*a52+46*a53+45*a54+44*a55+43*a56+42*a57+41*a58+40*a59+39*a60+38*a61+37*a62+36*a63+35*a64+34*a65+33*a66+32*a67+31*a68+30*a69+29*a70+28*a71+27*a72+26*a73+25*a74+24*a75+23*a76+22*a77+21*a78+20*a79+19*a80+18*a81+17*a82+16*a83+15*a84+14*a85+13*a86+12*a87+11*a88+10*a89+9*a90+8*a91+7*a92+6*a93+5*a94+4*a95+3*a96+2*a97+1*a98)
-#define PP_CSUM_99(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99) (99*a1+98*a2+97*a3+96*a4+95*a5+94*a6+93*a7+92*a8+91*a9+90*a10+89*a11+88*a12+87*a13+86*a14+85*a15+84*a16+83*a17+82*a18+81*a19+80*a20+79*a21+78*a22+77*a23+76*a24+75*a25+74*a26+73*a27+72*a28+71*a29+70*a30+69*a31+68*a32+67*a33+66*a34+65*a35+64*a36+63*a37+62*a38+61*a39+60*a40+59*a41+58*a42+57*a43+56*a44+55*a45+54*a46+53*a47+52*a48+51*a49+50*a50+49*a51+48*a52+47*a53+46*a54+45*a55+44*a56+43*a57+42*a58+41*a59+40*a60+39*a61+38*a62+37*a63+36*a64+35*a65+34*a66+33*a67+32*a68+31*a69+30*a70+29*a71+28*a72+27*a73+26*a74+25*a75+24*a76+23*a77+22*a78+21*a79+20*a80+19*a81+18*a82+17*a83+16*a84+15*a85+14*a86+13*a87+12*a88+11*a89+10*a90+9*a91+8*a92+7*a93+6*a94+5*a95+4*a96+3*a97+2*a98+1*a99)
-#define PP_CSUM_100(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100) (100*a1+99*a2+98*a3+97*a4+96*a5+95*a6+94*a7+93*a8+92*a9+91*a10+90*a11+89*a12+88*a13+87*a14+86*a15+85*a16+84*a17+83*a18+82*a19+81*a20+80*a21+79*a22+78*a23+77*a24+76*a25+75*a26+74*a27+73*a28+72*a29+71*a30+70*a31+69*a32+68*a33+67*a34+66*a35+65*a36+64*a37+63*a38+62*a39+61*a40+60*a41+59*a42+58*a43+57*a44+56*a45+55*a46+54*a47+53*a48+52*a49+51*a50+50*a51+49*a52+48*a53+47*a54+46*a55+45*a56+44*a57+43*a58+42*a59+41*a60+40*a61+39*a62+38*a63+37*a64+36*a65+35*a66+34*a67+33*a68+32*a69+31*a70+30*a71+29*a72+28*a73+27*a74+26*a75+25*a76+24*a77+23*a78+22*a79+21*a80+20*a81+19*a82+18*a83+17*a84+16*a85+15*a86+14*a87+13*a88+12*a89+11*a90+10*a91+9*a92+8*a93+7*a94+6*a95+5*a96+4*a97+3*a98+2*a99+1*a100)
-#define PP_CSUM_101(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101) (101*a1+100*a2+99*a3+98*a4+97*a5+96*a6+95*a7+94*a8+93*a9+92*a10+91*a11+90*a12+89*a13+88*a14+87*a15+86*a16+85*a17+84*a18+83*a19+82*a20+81*a21+80*a22+79*a23+78*a24+77*a25+76*a26+75*a27+74*a28+73*a29+72*a30+71*a31+70*a32+69*a33+68*a34+67*a35+66*a36+65*a37+64*a38+63*a39+62*a40+61*a41+60*a42+59*a43+58*a44+57*a45+56*a46+55*a47+54*a48+53*a49+52*a50+51*a51+50*a52+49*a53+48*a54+47*a55+46*a56+45*a57+44*a58+43*a59+42*a60+41*a61+40*a62+39*a63+38*a64+37*a65+36*a66+35*a67+34*a68+33*a69+32*a70+31*a71+30*a72+29*a73+28*a74+27*a75+26*a76+25*a77+24*a78+23*a79+22*a80+21*a81+20*a82+19*a83+18*a84+17*a85+16*a86+15*a87+14*a88+13*a89+12*a90+11*a91+10*a92+9*a93+8*a94+7*a95+6*a96+5*a97+4*a98+3*a99+2*a100+1*a101)
-#define PP_CSUM_102(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102) (102*a1+101*a2+100*a3+99*a4+98*a5+97*a6+96*a7+95*a8+94*a9+93*a10+92*a11+91*a12+90*a13+89*a14+88*a15+87*a16+86*a17+85*a18+84*a19+83*a20+82*a21+81*a22+80*a23+79*a24+78*a25+77*a26+76*a27+75*a28+74*a29+73*a30+72*a31+71*a32+70*a33+69*a34+68*a35+67*a36+66*a37+65*a38+64*a39+63*a40+62*a41+61*a42+60*a43+59*a44+58*a45+57*a46+56*a47+55*a48+54*a49+53*a50+52*a51+51*a52+50*a53+49*a54+48*a55+47*a56+46*a57+45*a58+44*a59+43*a60+42*a61+41*a62+40*a63+39*a64+38*a65+37*a66+36*a67+35*a68+34*a69+33*a70+32*a71+31*a72+30*a73+29*a74+28*a75+27*a76+26*a77+25*a78+24*a79+23*a80+22*a81+21*a82+20*a83+19*a84+18*a85+17*a86+16*a87+15*a88+14*a89+13*a90+12*a91+11*a92+10*a93+9*a94+8*a95+7*a96+6*a97+5*a98+4*a99+3*a100+2*a101+1*a102)
-#define PP_CSUM_103(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103) (103*a1+102*a2+101*a3+100*a4+99*a5+98*a6+97*a7+96*a8+95*a9+94*a10+93*a11+92*a12+91*a13+90*a14+89*a15+88*a16+87*a17+86*a18+85*a19+84*a20+83*a21+82*a22+81*a23+80*a24+79*a25+78*a26+77*a27+76*a28+75*a29+74*a30+73*a31+72*a32+71*a33+70*a34+69*a35+68*a36+67*a37+66*a38+65*a39+64*a40+63*a41+62*a42+61*a43+60*a44+59*a45+58*a46+57*a47+56*a48+55*a49+54*a50+53*a51+52*a52+51*a53+50*a54+49*a55+48*a56+47*a57+46*a58+45*a59+44*a60+43*a61+42*a62+41*a63+40*a64+39*a65+38*a66+37*a67+36*a68+35*a69+34*a70+33*a71+32*a72+31*a73+30*a74+29*a75+28*a76+27*a77+26*a78+25*a79+24*a80+23*a81+22*a82+21*a83+20*a84+19*a85+18*a86+17*a87+16*a88+15*a89+14*a90+13*a91+12*a92+11*a93+10*a94+9*a95+8*a96+7*a97+6*a98+5*a99+4*a100+3*a101+2*a102+1*a103)
-#define PP_CSUM_104(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104) (104*a1+103*a2+102*a3+101*a4+100*a5+99*a6+98*a7+97*a8+96*a9+95*a10+94*a11+93*a12+92*a13+91*a14+90*a15+89*a16+88*a17+87*a18+86*a19+85*a20+84*a21+83*a22+82*a23+81*a24+80*a25+79*a26+78*a27+77*a28+76*a29+75*a30+74*a31+73*a32+72*a33+71*a34+70*a35+69*a36+68*a37+67*a38+66*a39+65*a40+64*a41+63*a42+62*a43+61*a44+60*a45+59*a46+58*a47+57*a48+56*a49+55*a50+54*a51+53*a52+52*a53+51*a54+50*a55+49*a56+48*a57+47*a58+46*a59+45*a60+44*a61+43*a62+42*a63+41*a64+40*a65+39*a66+38*a67+37*a68+36*a69+35*a70+34*a71+33*a72+32*a73+31*a74+30*a75+29*a76+28*a77+27*a78+26*a79+25*a80+24*a81+23*a82+22*a83+21*a84+20*a85+19*a86+18*a87+17*a88+16*a89+15*a90+14*a91+13*a92+12*a93+11*a94+10*a95+9*a96+8*a97+7*a98+6*a99+5*a100+4*a101+3*a102+2*a103+1*a104)
-#define PP_CSUM_105(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105) (105*a1+104*a2+103*a3+102*a4+101*a5+100*a6+99*a7+98*a8+97*a9+96*a10+95*a11+94*a12+93*a13+92*a14+91*a15+90*a16+89*a17+88*a18+87*a19+86*a20+85*a21+84*a22+83*a23+82*a24+81*a25+80*a26+79*a27+78*a28+77*a29+76*a30+75*a31+74*a32+73*a33+72*a34+71*a35+70*a36+69*a37+68*a38+67*a39+66*a40+65*a41+64*a42+63*a43+62*a44+61*a45+60*a46+59*a47+58*a48+57*a49+56*a50+55*a51+54*a52+53*a53+52*a54+51*a55+50*a56+49*a57+48*a58+47*a59+46*a60+45*a61+44*a62+43*a63+42*a64+41*a65+40*a66+39*a67+38*a68+37*a69+36*a70+35*a71+34*a72+33*a73+32*a74+31*a75+30*a76+29*a77+28*a78+27*a79+26*a80+25*a81+24*a82+23*a83+22*a84+21*a85+20*a86+19*a87+18*a88+17*a89+16*a90+15*a91+14*a92+13*a93+12*a94+11*a95+10*a96+9*a97+8*a98+7*a99+6*a100+5*a101+4*a102+3*a103+2*a104+1*a105)
-#define PP_CSUM_106(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106) (106*a1+105*a2+104*a3+103*a4+102*a5+101*a6+100*a7+99*a8+98*a9+97*a10+96*a11+95*a12+94*a13+93*a14+92*a15+91*a16+90*a17+89*a18+88*a19+87*a20+86*a21+85*a22+84*a23+83*a24+82*a25+81*a26+80*a27+79*a28+78*a29+77*a30+76*a31+75*a32+74*a33+73*a34+72*a35+71*a36+70*a37+69*a38+68*a39+67*a40+66*a41+65*a42+64*a43+63*a44+62*a45+61*a46+60*a47+59*a48+58*a49+57*a50+56*a51+55*a52+54*a53+53*a54+52*a55+51*a56+50*a57+49*a58+48*a59+47*a60+46*a61+45*a62+44*a63+43*a64+42*a65+41*a66+40*a67+39*a68+38*a69+37*a70+36*a71+35*a72+34*a73+33*a74+32*a75+31*a76+30*a77+29*a78+28*a79+27*a80+26*a81+25*a82+24*a83+23*a84+22*a85+21*a86+20*a87+19*a88+18*a89+17*a90+16*a91+15*a92+14*a93+13*a94+12*a95+11*a96+10*a97+9*a98+8*a99+7*a100+6*a101+5*a102+4*a103+3*a104+2*a105+1*a106)
-#define PP_CSUM_107(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107) (107*a1+106*a2+105*a3+104*a4+103*a5+102*a6+101*a7+100*a8+99*a9+98*a10+97*a11+96*a12+95*a13+94*a14+93*a15+92*a16+91*a17+90*a18+89*a19+88*a20+87*a21+86*a22+85*a23+84*a24+83*a25+82*a26+81*a27+80*a28+79*a29+78*a30+77*a31+76*a32+75*a33+74*a34+73*a35+72*a36+71*a37+70*a38+69*a39+68*a40+67*a41+66*a42+65*a43+64*a44+63*a45+62*a46+61*a47+60*a48+59*a49+58*a50+57*a51+56*a52+55*a53+54*a54+53*a55+52*a56+51*a57+50*a58+49*a59+48*a60+47*a61+46*a62+45*a63+44*a64+43*a65+42*a66+41*a67+40*a68+39*a69+38*a70+37*a71+36*a72+35*a73+34*a74+33*a75+32*a76+31*a77+30*a78+29*a79+28*a80+27*a81+26*a82+25*a83+24*a84+23*a85+22*a86+21*a87+20*a88+19*a89+18*a90+17*a91+16*a92+15*a93+14*a94+13*a95+12*a96+11*a97+10*a98+9*a99+8*a100+7*a101+6*a102+5*a103+4*a104+3*a105+2*a106+1*a107)
-#define PP_CSUM_108(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108) (108*a1+107*a2+106*a3+105*a4+104*a5+103*a6+102*a7+101*a8+100*a9+99*a10+98*a11+97*a12+96*a13+95*a14+94*a15+93*a16+92*a17+91*a18+90*a19+89*a20+88*a21+87*a22+86*a23+85*a24+84*a25+83*a26+82*a27+81*a28+80*a29+79*a30+78*a31+77*a32+76*a33+75*a34+74*a35+73*a36+72*a37+71*a38+70*a39+69*a40+68*a41+67*a42+66*a43+65*a44+64*a45+63*a46+62*a47+61*a48+60*a49+59*a50+58*a51+57*a52+56*a53+55*a54+54*a55+53*a56+52*a57+51*a58+50*a59+49*a60+48*a61+47*a62+46*a63+45*a64+44*a65+43*a66+42*a67+41*a68+40*a69+39*a70+38*a71+37*a72+36*a73+35*a74+34*a75+33*a76+32*a77+31*a78+30*a79+29*a80+28*a81+27*a82+26*a83+25*a84+24*a85+23*a86+22*a87+21*a88+20*a89+19*a90+18*a91+17*a92+16*a93+15*a94+14*a95+13*a96+12*a97+11*a98+10*a99+9*a100+8*a101+7*a102+6*a103+5*a104+4*a105+3*a106+2*a107+1*a108)
-#define PP_CSUM_109(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109) (109*a1+108*a2+107*a3+106*a4+105*a5+104*a6+103*a7+102*a8+101*a9+100*a10+99*a11+98*a12+97*a13+96*a14+95*a15+94*a16+93*a17+92*a18+91*a19+90*a20+89*a21+88*a22+87*a23+86*a24+85*a25+84*a26+83*a27+82*a28+81*a29+80*a30+79*a31+78*a32+77*a33+76*a34+75*a35+74*a36+73*a37+72*a38+71*a39+70*a40+69*a41+68*a42+67*a43+66*a44+65*a45+64*a46+63*a47+62*a48+61*a49+60*a50+59*a51+58*a52+57*a53+56*a54+55*a55+54*a56+53*a57+52*a58+51*a59+50*a60+49*a61+48*a62+47*a63+46*a64+45*a65+44*a66+43*a67+42*a68+41*a69+40*a70+39*a71+38*a72+37*a73+36*a74+35*a75+34*a76+33*a77+32*a78+31*a79+30*a80+29*a81+28*a82+27*a83+26*a84+25*a85+24*a86+23*a87+22*a88+21*a89+20*a90+19*a91+18*a92+17*a93+16*a94+15*a95+14*a96+13*a97+12*a98+11*a99+10*a100+9*a101+8*a102+7*a103+6*a104+5*a105+4*a106+3*a107+2*a108+1*a109)
-#define PP_CSUM_110(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110) (110*a1+109*a2+108*a3+107*a4+106*a5+105*a6+104*a7+103*a8+102*a9+101*a10+100*a11+99*a12+98*a13+97*a14+96*a15+95*a16+94*a17+93*a18+92*a19+91*a20+90*a21+89*a22+88*a23+87*a24+86*a25+85*a26+84*a27+83*a28+82*a29+81*a30+80*a31+79*a32+78*a33+77*a34+76*a35+75*a36+74*a37+73*a38+72*a39+71*a40+70*a41+69*a42+68*a43+67*a44+66*a45+65*a46+64*a47+63*a48+62*a49+61*a50+60*a51+59*a52+58*a53+57*a54+56*a55+55*a56+54*a57+53*a58+52*a59+51*a60+50*a61+49*a62+48*a63+47*a64+46*a65+45*a66+44*a67+43*a68+42*a69+41*a70+40*a71+39*a72+38*a73+37*a74+36*a75+35*a76+34*a77+33*a78+32*a79+31*a80+30*a81+29*a82+28*a83+27*a84+26*a85+25*a86+24*a87+23*a88+22*a89+21*a90+20*a91+19*a92+18*a93+17*a94+16*a95+15*a96+14*a97+13*a98+12*a99+11*a100+10*a101+9*a102+8*a103+7*a104+6*a105+5*a106+4*a107+3*a108+2*a109+1*a110)
-#define PP_CSUM_111(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111) (111*a1+110*a2+109*a3+108*a4+107*a5+106*a6+105*a7+104*a8+103*a9+102*a10+101*a11+100*a12+99*a13+98*a14+97*a15+96*a16+95*a17+94*a18+93*a19+92*a20+91*a21+90*a22+89*a23+88*a24+87*a25+86*a26+85*a27+84*a28+83*a29+82*a30+81*a31+80*a32+79*a33+78*a34+77*a35+76*a36+75*a37+74*a38+73*a39+72*a40+71*a41+70*a42+69*a43+68*a44+67*a45+66*a46+65*a47+64*a48+63*a49+62*a50+61*a51+60*a52+59*a53+58*a54+57*a55+56*a56+55*a57+54*a58+53*a59+52*a60+51*a61+50*a62+49*a63+48*a64+47*a65+46*a66+45*a67+44*a68+43*a69+42*a70+41*a71+40*a72+39*a73+38*a74+37*a75+36*a76+35*a77+34*a78+33*a79+32*a80+31*a81+30*a82+29*a83+28*a84+27*a85+26*a86+25*a87+24*a88+23*a89+22*a90+21*a91+20*a92+19*a93+18*a94+17*a95+16*a96+15*a97+14*a98+13*a99+12*a100+11*a101+10*a102+9*a103+8*a104+7*a105+6*a106+5*a107+4*a108+3*a109+2*a110+1*a111)
-#define PP_CSUM_112(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112) (112*a1+111*a2+110*a3+109*a4+108*a5+107*a6+106*a7+105*a8+104*a9+103*a10+102*a11+101*a12+100*a13+99*a14+98*a15+97*a16+96*a17+95*a18+94*a19+93*a20+92*a21+91*a22+90*a23+89*a24+88*a25+87*a26+86*a27+85*a28+84*a29+83*a30+82*a31+81*a32+80*a33+79*a34+78*a35+77*a36+76*a37+75*a38+74*a39+73*a40+72*a41+71*a42+70*a43+69*a44+68*a45+67*a46+66*a47+65*a48+64*a49+63*a50+62*a51+61*a52+60*a53+59*a54+58*a55+57*a56+56*a57+55*a58+54*a59+53*a60+52*a61+51*a62+50*a63+49*a64+48*a65+47*a66+46*a67+45*a68+44*a69+43*a70+42*a71+41*a72+40*a73+39*a74+38*a75+37*a76+36*a77+35*a78+34*a79+33*a80+32*a81+31*a82+30*a83+29*a84+28*a85+27*a86+26*a87+25*a88+24*a89+23*a90+22*a91+21*a92+20*a93+19*a94+18*a95+17*a96+16*a97+15*a98+14*a99+13*a100+12*a101+11*a102+10*a103+9*a104+8*a105+7*a106+6*a107+5*a108+4*a109+3*a110+2*a111+1*a112)
-#define PP_CSUM_113(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113) (113*a1+112*a2+111*a3+110*a4+109*a5+108*a6+107*a7+106*a8+105*a9+104*a10+103*a11+102*a12+101*a13+100*a14+99*a15+98*a16+97*a17+96*a18+95*a19+94*a20+93*a21+92*a22+91*a23+90*a24+89*a25+88*a26+87*a27+86*a28+85*a29+84*a30+83*a31+82*a32+81*a33+80*a34+79*a35+78*a36+77*a37+76*a38+75*a39+74*a40+73*a41+72*a42+71*a43+70*a44+69*a45+68*a46+67*a47+66*a48+65*a49+64*a50+63*a51+62*a52+61*a53+60*a54+59*a55+58*a56+57*a57+56*a58+55*a59+54*a60+53*a61+52*a62+51*a63+50*a64+49*a65+48*a66+47*a67+46*a68+45*a69+44*a70+43*a71+42*a72+41*a73+40*a74+39*a75+38*a76+37*a77+36*a78+35*a79+34*a80+33*a81+32*a82+31*a83+30*a84+29*a85+28*a86+27*a87+26*a88+25*a89+24*a90+23*a91+22*a92+21*a93+20*a94+19*a95+18*a96+17*a97+16*a98+15*a99+14*a100+13*a101+12*a102+11*a103+10*a104+9*a105+8*a106+7*a107+6*a108+5*a109+4*a110+3*a111+2*a112+1*a113)
-#define PP_CSUM_114(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114) (114*a1+113*a2+112*a3+111*a4+110*a5+109*a6+108*a7+107*a8+106*a9+105*a10+104*a11+103*a12+102*a13+101*a14+100*a15+99*a16+98*a17+97*a18+96*a19+95*a20+94*a21+93*a22+92*a23+91*a24+90*a25+89*a26+88*a27+87*a28+86*a29+85*a30+84*a31+83*a32+82*a33+81*a34+80*a35+79*a36+78*a37+77*a38+76*a39+75*a40+74*a41+73*a42+72*a43+71*a44+70*a45+69*a46+68*a47+67*a48+66*a49+65*a50+64*a51+63*a52+62*a53+61*a54+60*a55+59*a56+58*a57+57*a58+56*a59+55*a60+54*a61+53*a62+52*a63+51*a64+50*a65+49*a66+48*a67+47*a68+46*a69+45*a70+44*a71+43*a72+42*a73+41*a74+40*a75+39*a76+38*a77+37*a78+36*a79+35*a80+34*a81+33*a82+32*a83+31*a84+30*a85+29*a86+28*a87+27*a88+26*a89+25*a90+24*a91+23*a92+22*a93+21*a94+20*a95+19*a96+18*a97+17*a98+16*a99+15*a100+14*a101+13*a102+12*a103+11*a104+10*a105+9*a106+8*a107+7*a108+6*a109+5*a110+4*a111+3*a112+2*a113+1*a114)
-#define PP_CSUM_115(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115) (115*a1+114*a2+113*a3+112*a4+111*a5+110*a6+109*a7+108*a8+107*a9+106*a10+105*a11+104*a12+103*a13+102*a14+101*a15+100*a16+99*a17+98*a18+97*a19+96*a20+95*a21+94*a22+93*a23+92*a24+91*a25+90*a26+89*a27+88*a28+87*a29+86*a30+85*a31+84*a32+83*a33+82*a34+81*a35+80*a36+79*a37+78*a38+77*a39+76*a40+75*a41+74*a42+73*a43+72*a44+71*a45+70*a46+69*a47+68*a48+67*a49+66*a50+65*a51+64*a52+63*a53+62*a54+61*a55+60*a56+59*a57+58*a58+57*a59+56*a60+55*a61+54*a62+53*a63+52*a64+51*a65+50*a66+49*a67+48*a68+47*a69+46*a70+45*a71+44*a72+43*a73+42*a74+41*a75+40*a76+39*a77+38*a78+37*a79+36*a80+35*a81+34*a82+33*a83+32*a84+31*a85+30*a86+29*a87+28*a88+27*a89+26*a90+25*a91+24*a92+23*a93+22*a94+21*a95+20*a96+19*a97+18*a98+17*a99+16*a100+15*a101+14*a102+13*a103+12*a104+11*a105+10*a106+9*a107+8*a108+7*a109+6*a110+5*a111+4*a112+3*a113+2*a114+1*a115)
-#define PP_CSUM_116(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116) (116*a1+115*a2+114*a3+113*a4+112*a5+111*a6+110*a7+109*a8+108*a9+107*a10+106*a11+105*a12+104*a13+103*a14+102*a15+101*a16+100*a17+99*a18+98*a19+97*a20+96*a21+95*a22+94*a23+93*a24+92*a25+91*a26+90*a27+89*a28+88*a29+87*a30+86*a31+85*a32+84*a33+83*a34+82*a35+81*a36+80*a37+79*a38+78*a39+77*a40+76*a41+75*a42+74*a43+73*a44+72*a45+71*a46+70*a47+69*a48+68*a49+67*a50+66*a51+65*a52+64*a53+63*a54+62*a55+61*a56+60*a57+59*a58+58*a59+57*a60+56*a61+55*a62+54*a63+53*a64+52*a65+51*a66+50*a67+49*a68+48*a69+47*a70+46*a71+45*a72+44*a73+43*a74+42*a75+41*a76+40*a77+39*a78+38*a79+37*a80+36*a81+35*a82+34*a83+33*a84+32*a85+31*a86+30*a87+29*a88+28*a89+27*a90+26*a91+25*a92+24*a93+23*a94+22*a95+21*a96+20*a97+19*a98+18*a99+17*a100+16*a101+15*a102+14*a103+13*a104+12*a105+11*a106+10*a107+9*a108+8*a109+7*a110+6*a111+5*a112+4*a113+3*a114+2*a115+1*a116)
-#define PP_CSUM_117(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117) (117*a1+116*a2+115*a3+114*a4+113*a5+112*a6+111*a7+110*a8+109*a9+108*a10+107*a11+106*a12+105*a13+104*a14+103*a15+102*a16+101*a17+100*a18+99*a19+98*a20+97*a21+96*a22+95*a23+94*a24+93*a25+92*a26+91*a27+90*a28+89*a29+88*a30+87*a31+86*a32+85*a33+84*a34+83*a35+82*a36+81*a37+80*a38+79*a39+78*a40+77*a41+76*a42+75*a43+74*a44+73*a45+72*a46+71*a47+70*a48+69*a49+68*a50+67*a51+66*a52+65*a53+64*a54+63*a55+62*a56+61*a57+60*a58+59*a59+58*a60+57*a61+56*a62+55*a63+54*a64+53*a65+52*a66+51*a67+50*a68+49*a69+48*a70+47*a71+46*a72+45*a73+44*a74+43*a75+42*a76+41*a77+40*a78+39*a79+38*a80+37*a81+36*a82+35*a83+34*a84+33*a85+32*a86+31*a87+30*a88+29*a89+28*a90+27*a91+26*a92+25*a93+24*a94+23*a95+22*a96+21*a97+20*a98+19*a99+18*a100+17*a101+16*a102+15*a103+14*a104+13*a105+12*a106+11*a107+10*a108+9*a109+8*a110+7*a111+6*a112+5*a113+4*a114+3*a115+2*a116+1*a117)
-#define PP_CSUM_118(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118) (118*a1+117*a2+116*a3+115*a4+114*a5+113*a6+112*a7+111*a8+110*a9+109*a10+108*a11+107*a12+106*a13+105*a14+104*a15+103*a16+102*a17+101*a18+100*a19+99*a20+98*a21+97*a22+96*a23+95*a24+94*a25+93*a26+92*a27+91*a28+90*a29+89*a30+88*a31+87*a32+86*a33+85*a34+84*a35+83*a36+82*a37+81*a38+80*a39+79*a40+78*a41+77*a42+76*a43+75*a44+74*a45+73*a46+72*a47+71*a48+70*a49+69*a50+68*a51+67*a52+66*a53+65*a54+64*a55+63*a56+62*a57+61*a58+60*a59+59*a60+58*a61+57*a62+56*a63+55*a64+54*a65+53*a66+52*a67+51*a68+50*a69+49*a70+48*a71+47*a72+46*a73+45*a74+44*a75+43*a76+42*a77+41*a78+40*a79+39*a80+38*a81+37*a82+36*a83+35*a84+34*a85+33*a86+32*a87+31*a88+30*a89+29*a90+28*a91+27*a92+26*a93+25*a94+24*a95+23*a96+22*a97+21*a98+20*a99+19*a100+18*a101+17*a102+16*a103+15*a104+14*a105+13*a106+12*a107+11*a108+10*a109+9*a110+8*a111+7*a112+6*a113+5*a114+4*a115+3*a116+2*a117+1*a118)
-#define PP_CSUM_119(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119) (119*a1+118*a2+117*a3+116*a4+115*a5+114*a6+113*a7+112*a8+111*a9+110*a10+109*a11+108*a12+107*a13+106*a14+105*a15+104*a16+103*a17+102*a18+101*a19+100*a20+99*a21+98*a22+97*a23+96*a24+95*a25+94*a26+93*a27+92*a28+91*a29+90*a30+89*a31+88*a32+87*a33+86*a34+85*a35+84*a36+83*a37+82*a38+81*a39+80*a40+79*a41+78*a42+77*a43+76*a44+75*a45+74*a46+73*a47+72*a48+71*a49+70*a50+69*a51+68*a52+67*a53+66*a54+65*a55+64*a56+63*a57+62*a58+61*a59+60*a60+59*a61+58*a62+57*a63+56*a64+55*a65+54*a66+53*a67+52*a68+51*a69+50*a70+49*a71+48*a72+47*a73+46*a74+45*a75+44*a76+43*a77+42*a78+41*a79+40*a80+39*a81+38*a82+37*a83+36*a84+35*a85+34*a86+33*a87+32*a88+31*a89+30*a90+29*a91+28*a92+27*a93+26*a94+25*a95+24*a96+23*a97+22*a98+21*a99+20*a100+19*a101+18*a102+17*a103+16*a104+15*a105+14*a106+13*a107+12*a108+11*a109+10*a110+9*a111+8*a112+7*a113+6*a114+5*a115+4*a116+3*a117+2*a118+1*a119)
-#define PP_CSUM_120(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120) (120*a1+119*a2+118*a3+117*a4+116*a5+115*a6+114*a7+113*a8+112*a9+111*a10+110*a11+109*a12+108*a13+107*a14+106*a15+105*a16+104*a17+103*a18+102*a19+101*a20+100*a21+99*a22+98*a23+97*a24+96*a25+95*a26+94*a27+93*a28+92*a29+91*a30+90*a31+89*a32+88*a33+87*a34+86*a35+85*a36+84*a37+83*a38+82*a39+81*a40+80*a41+79*a42+78*a43+77*a44+76*a45+75*a46+74*a47+73*a48+72*a49+71*a50+70*a51+69*a52+68*a53+67*a54+66*a55+65*a56+64*a57+63*a58+62*a59+61*a60+60*a61+59*a62+58*a63+57*a64+56*a65+55*a66+54*a67+53*a68+52*a69+51*a70+50*a71+49*a72+48*a73+47*a74+46*a75+45*a76+44*a77+43*a78+42*a79+41*a80+40*a81+39*a82+38*a83+37*a84+36*a85+35*a86+34*a87+33*a88+32*a89+31*a90+30*a91+29*a92+28*a93+27*a94+26*a95+25*a96+24*a97+23*a98+22*a99+21*a100+20*a101+19*a102+18*a103+17*a104+16*a105+15*a106+14*a107+13*a108+12*a109+11*a110+10*a111+9*a112+8*a113+7*a114+6*a115+5*a116+4*a117+3*a118+2*a119+1*a120)
-#define PP_CSUM_121(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121) (121*a1+120*a2+119*a3+118*a4+117*a5+116*a6+115*a7+114*a8+113*a9+112*a10+111*a11+110*a12+109*a13+108*a14+107*a15+106*a16+105*a17+104*a18+103*a19+102*a20+101*a21+100*a22+99*a23+98*a24+97*a25+96*a26+95*a27+94*a28+93*a29+92*a30+91*a31+90*a32+89*a33+88*a34+87*a35+86*a36+85*a37+84*a38+83*a39+82*a40+81*a41+80*a42+79*a43+78*a44+77*a45+76*a46+75*a47+74*a48+73*a49+72*a50+71*a51+70*a52+69*a53+68*a54+67*a55+66*a56+65*a57+64*a58+63*a59+62*a60+61*a61+60*a62+59*a63+58*a64+57*a65+56*a66+55*a67+54*a68+53*a69+52*a70+51*a71+50*a72+49*a73+48*a74+47*a75+46*a76+45*a77+44*a78+43*a79+42*a80+41*a81+40*a82+39*a83+38*a84+37*a85+36*a86+35*a87+34*a88+33*a89+32*a90+31*a91+30*a92+29*a93+28*a94+27*a95+26*a96+25*a97+24*a98+23*a99+22*a100+21*a101+20*a102+19*a103+18*a104+17*a105+16*a106+15*a107+14*a108+13*a109+12*a110+11*a111+10*a112+9*a113+8*a114+7*a115+6*a116+5*a117+4*a118+3*a119+2*a120+1*a121)
-#define PP_CSUM_122(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122) (122*a1+121*a2+120*a3+119*a4+118*a5+117*a6+116*a7+115*a8+114*a9+113*a10+112*a11+111*a12+110*a13+109*a14+108*a15+107*a16+106*a17+105*a18+104*a19+103*a20+102*a21+101*a22+100*a23+99*a24+98*a25+97*a26+96*a27+95*a28+94*a29+93*a30+92*a31+91*a32+90*a33+89*a34+88*a35+87*a36+86*a37+85*a38+84*a39+83*a40+82*a41+81*a42+80*a43+79*a44+78*a45+77*a46+76*a47+75*a48+74*a49+73*a50+72*a51+71*a52+70*a53+69*a54+68*a55+67*a56+66*a57+65*a58+64*a59+63*a60+62*a61+61*a62+60*a63+59*a64+58*a65+57*a66+56*a67+55*a68+54*a69+53*a70+52*a71+51*a72+50*a73+49*a74+48*a75+47*a76+46*a77+45*a78+44*a79+43*a80+42*a81+41*a82+40*a83+39*a84+38*a85+37*a86+36*a87+35*a88+34*a89+33*a90+32*a91+31*a92+30*a93+29*a94+28*a95+27*a96+26*a97+25*a98+24*a99+23*a100+22*a101+21*a102+20*a103+19*a104+18*a105+17*a106+16*a107+15*a108+14*a109+13*a110+12*a111+11*a112+10*a113+9*a114+8*a115+7*a116+6*a117+5*a118+4*a119+3*a120+2*a121+1*a122)
-#define PP_CSUM_123(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123) (123*a1+122*a2+121*a3+120*a4+119*a5+118*a6+117*a7+116*a8+115*a9+114*a10+113*a11+112*a12+111*a13+110*a14+109*a15+108*a16+107*a17+106*a18+105*a19+104*a20+103*a21+102*a22+101*a23+100*a24+99*a25+98*a26+97*a27+96*a28+95*a29+94*a30+93*a31+92*a32+91*a33+90*a34+89*a35+88*a36+87*a37+86*a38+85*a39+84*a40+83*a41+82*a42+81*a43+80*a44+79*a45+78*a46+77*a47+76*a48+75*a49+74*a50+73*a51+72*a52+71*a53+70*a54+69*a55+68*a56+67*a57+66*a58+65*a59+64*a60+63*a61+62*a62+61*a63+60*a64+59*a65+58*a66+57*a67+56*a68+55*a69+54*a70+53*a71+52*a72+51*a73+50*a74+49*a75+48*a76+47*a77+46*a78+45*a79+44*a80+43*a81+42*a82+41*a83+40*a84+39*a85+38*a86+37*a87+36*a88+35*a89+34*a90+33*a91+32*a92+31*a93+30*a94+29*a95+28*a96+27*a97+26*a98+25*a99+24*a100+23*a101+22*a102+21*a103+20*a104+19*a105+18*a106+17*a107+16*a108+15*a109+14*a110+13*a111+12*a112+11*a113+10*a114+9*a115+8*a116+7*a117+6*a118+5*a119+4*a120+3*a121+2*a122+1*a123)
-#define PP_CSUM_124(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124) (124*a1+123*a2+122*a3+121*a4+120*a5+119*a6+118*a7+117*a8+116*a9+115*a10+114*a11+113*a12+112*a13+111*a14+110*a15+109*a16+108*a17+107*a18+106*a19+105*a20+104*a21+103*a22+102*a23+101*a24+100*a25+99*a26+98*a27+97*a28+96*a29+95*a30+94*a31+93*a32+92*a33+91*a34+90*a35+89*a36+88*a37+87*a38+86*a39+85*a40+84*a41+83*a42+82*a43+81*a44+80*a45+79*a46+78*a47+77*a48+76*a49+75*a50+74*a51+73*a52+72*a53+71*a54+70*a55+69*a56+68*a57+67*a58+66*a59+65*a60+64*a61+63*a62+62*a63+61*a64+60*a65+59*a66+58*a67+57*a68+56*a69+55*a70+54*a71+53*a72+52*a73+51*a74+50*a75+49*a76+48*a77+47*a78+46*a79+45*a80+44*a81+43*a82+42*a83+41*a84+40*a85+39*a86+38*a87+37*a88+36*a89+35*a90+34*a91+33*a92+32*a93+31*a94+30*a95+29*a96+28*a97+27*a98+26*a99+25*a100+24*a101+23*a102+22*a103+21*a104+20*a105+19*a106+18*a107+17*a108+16*a109+15*a110+14*a111+13*a112+12*a113+11*a114+10*a115+9*a116+8*a117+7*a118+6*a119+5*a120+4*a121+3*a122+2*a123+1*a124)
-#define PP_CSUM_125(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125) (125*a1+124*a2+123*a3+122*a4+121*a5+120*a6+119*a7+118*a8+117*a9+116*a10+115*a11+114*a12+113*a13+112*a14+111*a15+110*a16+109*a17+108*a18+107*a19+106*a20+105*a21+104*a22+103*a23+102*a24+101*a25+100*a26+99*a27+98*a28+97*a29+96*a30+95*a31+94*a32+93*a33+92*a34+91*a35+90*a36+89*a37+88*a38+87*a39+86*a40+85*a41+84*a42+83*a43+82*a44+81*a45+80*a46+79*a47+78*a48+77*a49+76*a50+75*a51+74*a52+73*a53+72*a54+71*a55+70*a56+69*a57+68*a58+67*a59+66*a60+65*a61+64*a62+63*a63+62*a64+61*a65+60*a66+59*a67+58*a68+57*a69+56*a70+55*a71+54*a72+53*a73+52*a74+51*a75+50*a76+49*a77+48*a78+47*a79+46*a80+45*a81+44*a82+43*a83+42*a84+41*a85+40*a86+39*a87+38*a88+37*a89+36*a90+35*a91+34*a92+33*a93+32*a94+31*a95+30*a96+29*a97+28*a98+27*a99+26*a100+25*a101+24*a102+23*a103+22*a104+21*a105+20*a106+19*a107+18*a108+17*a109+16*a110+15*a111+14*a112+13*a113+12*a114+11*a115+10*a116+9*a117+8*a118+7*a119+6*a120+5*a121+4*a122+3*a123+2*a124+1*a125)
-#define PP_CSUM_126(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126) (126*a1+125*a2+124*a3+123*a4+122*a5+121*a6+120*a7+119*a8+118*a9+117*a10+116*a11+115*a12+114*a13+113*a14+112*a15+111*a16+110*a17+109*a18+108*a19+107*a20+106*a21+105*a22+104*a23+103*a24+102*a25+101*a26+100*a27+99*a28+98*a29+97*a30+96*a31+95*a32+94*a33+93*a34+92*a35+91*a36+90*a37+89*a38+88*a39+87*a40+86*a41+85*a42+84*a43+83*a44+82*a45+81*a46+80*a47+79*a48+78*a49+77*a50+76*a51+75*a52+74*a53+73*a54+72*a55+71*a56+70*a57+69*a58+68*a59+67*a60+66*a61+65*a62+64*a63+63*a64+62*a65+61*a66+60*a67+59*a68+58*a69+57*a70+56*a71+55*a72+54*a73+53*a74+52*a75+51*a76+50*a77+49*a78+48*a79+47*a80+46*a81+45*a82+44*a83+43*a84+42*a85+41*a86+40*a87+39*a88+38*a89+37*a90+36*a91+35*a92+34*a93+33*a94+32*a95+31*a96+30*a97+29*a98+28*a99+27*a100+26*a101+25*a102+24*a103+23*a104+22*a105+21*a106+20*a107+19*a108+18*a109+17*a110+16*a111+15*a112+14*a113+13*a114+12*a115+11*a116+10*a117+9*a118+8*a119+7*a120+6*a121+5*a122+4*a123+3*a124+2*a125+1*a126)
-#define PP_CSUM_127(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127) (127*a1+126*a2+125*a3+124*a4+123*a5+122*a6+121*a7+120*a8+119*a9+118*a10+117*a11+116*a12+115*a13+114*a14+113*a15+112*a16+111*a17+110*a18+109*a19+108*a20+107*a21+106*a22+105*a23+104*a24+103*a25+102*a26+101*a27+100*a28+99*a29+98*a30+97*a31+96*a32+95*a33+94*a34+93*a35+92*a36+91*a37+90*a38+89*a39+88*a40+87*a41+86*a42+85*a43+84*a44+83*a45+82*a46+81*a47+80*a48+79*a49+78*a50+77*a51+76*a52+75*a53+74*a54+73*a55+72*a56+71*a57+70*a58+69*a59+68*a60+67*a61+66*a62+65*a63+64*a64+63*a65+62*a66+61*a67+60*a68+59*a69+58*a70+57*a71+56*a72+55*a73+54*a74+53*a75+52*a76+51*a77+50*a78+49*a79+48*a80+47*a81+46*a82+45*a83+44*a84+43*a85+42*a86+41*a87+40*a88+39*a89+38*a90+37*a91+36*a92+35*a93+34*a94+33*a95+32*a96+31*a97+30*a98+29*a99+28*a100+27*a101+26*a102+25*a103+24*a104+23*a105+22*a106+21*a107+20*a108+19*a109+18*a110+17*a111+16*a112+15*a113+14*a114+13*a115+12*a116+11*a117+10*a118+9*a119+8*a120+7*a121+6*a122+5*a123+4*a124+3*a125+2*a126+1*a127)
-#define PP_CSUM_128(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128) (128*a1+127*a2+126*a3+125*a4+124*a5+123*a6+122*a7+121*a8+120*a9+119*a10+118*a11+117*a12+116*a13+115*a14+114*a15+113*a16+112*a17+111*a18+110*a19+109*a20+108*a21+107*a22+106*a23+105*a24+104*a25+103*a26+102*a27+101*a28+100*a29+99*a30+98*a31+97*a32+96*a33+95*a34+94*a35+93*a36+92*a37+91*a38+90*a39+89*a40+88*a41+87*a42+86*a43+85*a44+84*a45+83*a46+82*a47+81*a48+80*a49+79*a50+78*a51+77*a52+76*a53+75*a54+74*a55+73*a56+72*a57+71*a58+70*a59+69*a60+68*a61+67*a62+66*a63+65*a64+64*a65+63*a66+62*a67+61*a68+60*a69+59*a70+58*a71+57*a72+56*a73+55*a74+54*a75+53*a76+52*a77+51*a78+50*a79+49*a80+48*a81+47*a82+46*a83+45*a84+44*a85+43*a86+42*a87+41*a88+40*a89+39*a90+38*a91+37*a92+36*a93+35*a94+34*a95+33*a96+32*a97+31*a98+30*a99+29*a100+28*a101+27*a102+26*a103+25*a104+24*a105+23*a106+22*a107+21*a108+20*a109+19*a110+18*a111+17*a112+16*a113+15*a114+14*a115+13*a116+12*a117+11*a118+10*a119+9*a120+8*a121+7*a122+6*a123+5*a124+4*a125+3*a126+2*a127+1*a128)
-#define PP_CSUM_129(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129) (129*a1+128*a2+127*a3+126*a4+125*a5+124*a6+123*a7+122*a8+121*a9+120*a10+119*a11+118*a12+117*a13+116*a14+115*a15+114*a16+113*a17+112*a18+111*a19+110*a20+109*a21+108*a22+107*a23+106*a24+105*a25+104*a26+103*a27+102*a28+101*a29+100*a30+99*a31+98*a32+97*a33+96*a34+95*a35+94*a36+93*a37+92*a38+91*a39+90*a40+89*a41+88*a42+87*a43+86*a44+85*a45+84*a46+83*a47+82*a48+81*a49+80*a50+79*a51+78*a52+77*a53+76*a54+75*a55+74*a56+73*a57+72*a58+71*a59+70*a60+69*a61+68*a62+67*a63+66*a64+65*a65+64*a66+63*a67+62*a68+61*a69+60*a70+59*a71+58*a72+57*a73+56*a74+55*a75+54*a76+53*a77+52*a78+51*a79+50*a80+49*a81+48*a82+47*a83+46*a84+45*a85+44*a86+43*a87+42*a88+41*a89+40*a90+39*a91+38*a92+37*a93+36*a94+35*a95+34*a96+33*a97+32*a98+31*a99+30*a100+29*a101+28*a102+27*a103+26*a104+25*a105+24*a106+23*a107+22*a108+21*a109+20*a110+19*a111+18*a112+17*a113+16*a114+15*a115+14*a116+13*a117+12*a118+11*a119+10*a120+9*a121+8*a122+7*a123+6*a124+5*a125+4*a126+3*a127+2*a128+1*a129)
-#define PP_CSUM_130(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130) (130*a1+129*a2+128*a3+127*a4+126*a5+125*a6+124*a7+123*a8+122*a9+121*a10+120*a11+119*a12+118*a13+117*a14+116*a15+115*a16+114*a17+113*a18+112*a19+111*a20+110*a21+109*a22+108*a23+107*a24+106*a25+105*a26+104*a27+103*a28+102*a29+101*a30+100*a31+99*a32+98*a33+97*a34+96*a35+95*a36+94*a37+93*a38+92*a39+91*a40+90*a41+89*a42+88*a43+87*a44+86*a45+85*a46+84*a47+83*a48+82*a49+81*a50+80*a51+79*a52+78*a53+77*a54+76*a55+75*a56+74*a57+73*a58+72*a59+71*a60+70*a61+69*a62+68*a63+67*a64+66*a65+65*a66+64*a67+63*a68+62*a69+61*a70+60*a71+59*a72+58*a73+57*a74+56*a75+55*a76+54*a77+53*a78+52*a79+51*a80+50*a81+49*a82+48*a83+47*a84+46*a85+45*a86+44*a87+43*a88+42*a89+41*a90+40*a91+39*a92+38*a93+37*a94+36*a95+35*a96+34*a97+33*a98+32*a99+31*a100+30*a101+29*a102+28*a103+27*a104+26*a105+25*a106+24*a107+23*a108+22*a109+21*a110+20*a111+19*a112+18*a113+17*a114+16*a115+15*a116+14*a117+13*a118+12*a119+11*a120+10*a121+9*a122+8*a123+7*a124+6*a125+5*a126+4*a127+3*a128+2*a129+1*a130)
-#define PP_CSUM_131(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131) (131*a1+130*a2+129*a3+128*a4+127*a5+126*a6+125*a7+124*a8+123*a9+122*a10+121*a11+120*a12+119*a13+118*a14+117*a15+116*a16+115*a17+114*a18+113*a19+112*a20+111*a21+110*a22+109*a23+108*a24+107*a25+106*a26+105*a27+104*a28+103*a29+102*a30+101*a31+100*a32+99*a33+98*a34+97*a35+96*a36+95*a37+94*a38+93*a39+92*a40+91*a41+90*a42+89*a43+88*a44+87*a45+86*a46+85*a47+84*a48+83*a49+82*a50+81*a51+80*a52+79*a53+78*a54+77*a55+76*a56+75*a57+74*a58+73*a59+72*a60+71*a61+70*a62+69*a63+68*a64+67*a65+66*a66+65*a67+64*a68+63*a69+62*a70+61*a71+60*a72+59*a73+58*a74+57*a75+56*a76+55*a77+54*a78+53*a79+52*a80+51*a81+50*a82+49*a83+48*a84+47*a85+46*a86+45*a87+44*a88+43*a89+42*a90+41*a91+40*a92+39*a93+38*a94+37*a95+36*a96+35*a97+34*a98+33*a99+32*a100+31*a101+30*a102+29*a103+28*a104+27*a105+26*a106+25*a107+24*a108+23*a109+22*a110+21*a111+20*a112+19*a113+18*a114+17*a115+16*a116+15*a117+14*a118+13*a119+12*a120+11*a121+10*a122+9*a123+8*a124+7*a125+6*a126+5*a127+4*a128+3*a129+2*a130+1*a131)
-#define PP_CSUM_132(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132) (132*a1+131*a2+130*a3+129*a4+128*a5+127*a6+126*a7+125*a8+124*a9+123*a10+122*a11+121*a12+120*a13+119*a14+118*a15+117*a16+116*a17+115*a18+114*a19+113*a20+112*a21+111*a22+110*a23+109*a24+108*a25+107*a26+106*a27+105*a28+104*a29+103*a30+102*a31+101*a32+100*a33+99*a34+98*a35+97*a36+96*a37+95*a38+94*a39+93*a40+92*a41+91*a42+90*a43+89*a44+88*a45+87*a46+86*a47+85*a48+84*a49+83*a50+82*a51+81*a52+80*a53+79*a54+78*a55+77*a56+76*a57+75*a58+74*a59+73*a60+72*a61+71*a62+70*a63+69*a64+68*a65+67*a66+66*a67+65*a68+64*a69+63*a70+62*a71+61*a72+60*a73+59*a74+58*a75+57*a76+56*a77+55*a78+54*a79+53*a80+52*a81+51*a82+50*a83+49*a84+48*a85+47*a86+46*a87+45*a88+44*a89+43*a90+42*a91+41*a92+40*a93+39*a94+38*a95+37*a96+36*a97+35*a98+34*a99+33*a100+32*a101+31*a102+30*a103+29*a104+28*a105+27*a106+26*a107+25*a108+24*a109+23*a110+22*a111+21*a112+20*a113+19*a114+18*a115+17*a116+16*a117+15*a118+14*a119+13*a120+12*a121+11*a122+10*a123+9*a124+8*a125+7*a126+6*a127+5*a128+4*a129+3*a130+2*a131+1*a132)
-#define PP_CSUM_133(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133) (133*a1+132*a2+131*a3+130*a4+129*a5+128*a6+127*a7+126*a8+125*a9+124*a10+123*a11+122*a12+121*a13+120*a14+119*a15+118*a16+117*a17+116*a18+115*a19+114*a20+113*a21+112*a22+111*a23+110*a24+109*a25+108*a26+107*a27+106*a28+105*a29+104*a30+103*a31+102*a32+101*a33+100*a34+99*a35+98*a36+97*a37+96*a38+95*a39+94*a40+93*a41+92*a42+91*a43+90*a44+89*a45+88*a46+87*a47+86*a48+85*a49+84*a50+83*a51+82*a52+81*a53+80*a54+79*a55+78*a56+77*a57+76*a58+75*a59+74*a60+73*a61+72*a62+71*a63+70*a64+69*a65+68*a66+67*a67+66*a68+65*a69+64*a70+63*a71+62*a72+61*a73+60*a74+59*a75+58*a76+57*a77+56*a78+55*a79+54*a80+53*a81+52*a82+51*a83+50*a84+49*a85+48*a86+47*a87+46*a88+45*a89+44*a90+43*a91+42*a92+41*a93+40*a94+39*a95+38*a96+37*a97+36*a98+35*a99+34*a100+33*a101+32*a102+31*a103+30*a104+29*a105+28*a106+27*a107+26*a108+25*a109+24*a110+23*a111+22*a112+21*a113+20*a114+19*a115+18*a116+17*a117+16*a118+15*a119+14*a120+13*a121+12*a122+11*a123+10*a124+9*a125+8*a126+7*a127+6*a128+5*a129+4*a130+3*a131+2*a132+1*a133)
-#define PP_CSUM_134(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134) (134*a1+133*a2+132*a3+131*a4+130*a5+129*a6+128*a7+127*a8+126*a9+125*a10+124*a11+123*a12+122*a13+121*a14+120*a15+119*a16+118*a17+117*a18+116*a19+115*a20+114*a21+113*a22+112*a23+111*a24+110*a25+109*a26+108*a27+107*a28+106*a29+105*a30+104*a31+103*a32+102*a33+101*a34+100*a35+99*a36+98*a37+97*a38+96*a39+95*a40+94*a41+93*a42+92*a43+91*a44+90*a45+89*a46+88*a47+87*a48+86*a49+85*a50+84*a51+83*a52+82*a53+81*a54+80*a55+79*a56+78*a57+77*a58+76*a59+75*a60+74*a61+73*a62+72*a63+71*a64+70*a65+69*a66+68*a67+67*a68+66*a69+65*a70+64*a71+63*a72+62*a73+61*a74+60*a75+59*a76+58*a77+57*a78+56*a79+55*a80+54*a81+53*a82+52*a83+51*a84+50*a85+49*a86+48*a87+47*a88+46*a89+45*a90+44*a91+43*a92+42*a93+41*a94+40*a95+39*a96+38*a97+37*a98+36*a99+35*a100+34*a101+33*a102+32*a103+31*a104+30*a105+29*a106+28*a107+27*a108+26*a109+25*a110+24*a111+23*a112+22*a113+21*a114+20*a115+19*a116+18*a117+17*a118+16*a119+15*a120+14*a121+13*a122+12*a123+11*a124+10*a125+9*a126+8*a127+7*a128+6*a129+5*a130+4*a131+3*a132+2*a133+1*a134)
-#define PP_CSUM_135(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135) (135*a1+134*a2+133*a3+132*a4+131*a5+130*a6+129*a7+128*a8+127*a9+126*a10+125*a11+124*a12+123*a13+122*a14+121*a15+120*a16+119*a17+118*a18+117*a19+116*a20+115*a21+114*a22+113*a23+112*a24+111*a25+110*a26+109*a27+108*a28+107*a29+106*a30+105*a31+104*a32+103*a33+102*a34+101*a35+100*a36+99*a37+98*a38+97*a39+96*a40+95*a41+94*a42+93*a43+92*a44+91*a45+90*a46+89*a47+88*a48+87*a49+86*a50+85*a51+84*a52+83*a53+82*a54+81*a55+80*a56+79*a57+78*a58+77*a59+76*a60+75*a61+74*a62+73*a63+72*a64+71*a65+70*a66+69*a67+68*a68+67*a69+66*a70+65*a71+64*a72+63*a73+62*a74+61*a75+60*a76+59*a77+58*a78+57*a79+56*a80+55*a81+54*a82+53*a83+52*a84+51*a85+50*a86+49*a87+48*a88+47*a89+46*a90+45*a91+44*a92+43*a93+42*a94+41*a95+40*a96+39*a97+38*a98+37*a99+36*a100+35*a101+34*a102+33*a103+32*a104+31*a105+30*a106+29*a107+28*a108+27*a109+26*a110+25*a111+24*a112+23*a113+22*a114+21*a115+20*a116+19*a117+18*a118+17*a119+16*a120+15*a121+14*a122+13*a123+12*a124+11*a125+10*a126+9*a127+8*a128+7*a129+6*a130+5*a131+4*a132+3*a133+2*a134+1*a135)
-#define PP_CSUM_136(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136) (136*a1+135*a2+134*a3+133*a4+132*a5+131*a6+130*a7+129*a8+128*a9+127*a10+126*a11+125*a12+124*a13+123*a14+122*a15+121*a16+120*a17+119*a18+118*a19+117*a20+116*a21+115*a22+114*a23+113*a24+112*a25+111*a26+110*a27+109*a28+108*a29+107*a30+106*a31+105*a32+104*a33+103*a34+102*a35+101*a36+100*a37+99*a38+98*a39+97*a40+96*a41+95*a42+94*a43+93*a44+92*a45+91*a46+90*a47+89*a48+88*a49+87*a50+86*a51+85*a52+84*a53+83*a54+82*a55+81*a56+80*a57+79*a58+78*a59+77*a60+76*a61+75*a62+74*a63+73*a64+72*a65+71*a66+70*a67+69*a68+68*a69+67*a70+66*a71+65*a72+64*a73+63*a74+62*a75+61*a76+60*a77+59*a78+58*a79+57*a80+56*a81+55*a82+54*a83+53*a84+52*a85+51*a86+50*a87+49*a88+48*a89+47*a90+46*a91+45*a92+44*a93+43*a94+42*a95+41*a96+40*a97+39*a98+38*a99+37*a100+36*a101+35*a102+34*a103+33*a104+32*a105+31*a106+30*a107+29*a108+28*a109+27*a110+26*a111+25*a112+24*a113+23*a114+22*a115+21*a116+20*a117+19*a118+18*a119+17*a120+16*a121+15*a122+14*a123+13*a124+12*a125+11*a126+10*a127+9*a128+8*a129+7*a130+6*a131+5*a132+4*a133+3*a134+2*a135+1*a136)
-#define PP_CSUM_137(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137) (137*a1+136*a2+135*a3+134*a4+133*a5+132*a6+131*a7+130*a8+129*a9+128*a10+127*a11+126*a12+125*a13+124*a14+123*a15+122*a16+121*a17+120*a18+119*a19+118*a20+117*a21+116*a22+115*a23+114*a24+113*a25+112*a26+111*a27+110*a28+109*a29+108*a30+107*a31+106*a32+105*a33+104*a34+103*a35+102*a36+101*a37+100*a38+99*a39+98*a40+97*a41+96*a42+95*a43+94*a44+93*a45+92*a46+91*a47+90*a48+89*a49+88*a50+87*a51+86*a52+85*a53+84*a54+83*a55+82*a56+81*a57+80*a58+79*a59+78*a60+77*a61+76*a62+75*a63+74*a64+73*a65+72*a66+71*a67+70*a68+69*a69+68*a70+67*a71+66*a72+65*a73+64*a74+63*a75+62*a76+61*a77+60*a78+59*a79+58*a80+57*a81+56*a82+55*a83+54*a84+53*a85+52*a86+51*a87+50*a88+49*a89+48*a90+47*a91+46*a92+45*a93+44*a94+43*a95+42*a96+41*a97+40*a98+39*a99+38*a100+37*a101+36*a102+35*a103+34*a104+33*a105+32*a106+31*a107+30*a108+29*a109+28*a110+27*a111+26*a112+25*a113+24*a114+23*a115+22*a116+21*a117+20*a118+19*a119+18*a120+17*a121+16*a122+15*a123+14*a124+13*a125+12*a126+11*a127+10*a128+9*a129+8*a130+7*a131+6*a132+5*a133+4*a134+3*a135+2*a136+1*a137)
-#define PP_CSUM_138(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138) (138*a1+137*a2+136*a3+135*a4+134*a5+133*a6+132*a7+131*a8+130*a9+129*a10+128*a11+127*a12+126*a13+125*a14+124*a15+123*a16+122*a17+121*a18+120*a19+119*a20+118*a21+117*a22+116*a23+115*a24+114*a25+113*a26+112*a27+111*a28+110*a29+109*a30+108*a31+107*a32+106*a33+105*a34+104*a35+103*a36+102*a37+101*a38+100*a39+99*a40+98*a41+97*a42+96*a43+95*a44+94*a45+93*a46+92*a47+91*a48+90*a49+89*a50+88*a51+87*a52+86*a53+85*a54+84*a55+83*a56+82*a57+81*a58+80*a59+79*a60+78*a61+77*a62+76*a63+75*a64+74*a65+73*a66+72*a67+71*a68+70*a69+69*a70+68*a71+67*a72+66*a73+65*a74+64*a75+63*a76+62*a77+61*a78+60*a79+59*a80+58*a81+57*a82+56*a83+55*a84+54*a85+53*a86+52*a87+51*a88+50*a89+49*a90+48*a91+47*a92+46*a93+45*a94+44*a95+43*a96+42*a97+41*a98+40*a99+39*a100+38*a101+37*a102+36*a103+35*a104+34*a105+33*a106+32*a107+31*a108+30*a109+29*a110+28*a111+27*a112+26*a113+25*a114+24*a115+23*a116+22*a117+21*a118+20*a119+19*a120+18*a121+17*a122+16*a123+15*a124+14*a125+13*a126+12*a127+11*a128+10*a129+9*a130+8*a131+7*a132+6*a133+5*a134+4*a135+3*a136+2*a137+1*a138)
-#define PP_CSUM_139(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139) (139*a1+138*a2+137*a3+136*a4+135*a5+134*a6+133*a7+132*a8+131*a9+130*a10+129*a11+128*a12+127*a13+126*a14+125*a15+124*a16+123*a17+122*a18+121*a19+120*a20+119*a21+118*a22+117*a23+116*a24+115*a25+114*a26+113*a27+112*a28+111*a29+110*a30+109*a31+108*a32+107*a33+106*a34+105*a35+104*a36+103*a37+102*a38+101*a39+100*a40+99*a41+98*a42+97*a43+96*a44+95*a45+94*a46+93*a47+92*a48+91*a49+90*a50+89*a51+88*a52+87*a53+86*a54+85*a55+84*a56+83*a57+82*a58+81*a59+80*a60+79*a61+78*a62+77*a63+76*a64+75*a65+74*a66+73*a67+72*a68+71*a69+70*a70+69*a71+68*a72+67*a73+66*a74+65*a75+64*a76+63*a77+62*a78+61*a79+60*a80+59*a81+58*a82+57*a83+56*a84+55*a85+54*a86+53*a87+52*a88+51*a89+50*a90+49*a91+48*a92+47*a93+46*a94+45*a95+44*a96+43*a97+42*a98+41*a99+40*a100+39*a101+38*a102+37*a103+36*a104+35*a105+34*a106+33*a107+32*a108+31*a109+30*a110+29*a111+28*a112+27*a113+26*a114+25*a115+24*a116+23*a117+22*a118+21*a119+20*a120+19*a121+18*a122+17*a123+16*a124+15*a125+14*a126+13*a127+12*a128+11*a129+10*a130+9*a131+8*a132+7*a133+6*a134+5*a135+4*a136+3*a137+2*a138+1*a139)
-#define PP_CSUM_140(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140) (140*a1+139*a2+138*a3+137*a4+136*a5+135*a6+134*a7+133*a8+132*a9+131*a10+130*a11+129*a12+128*a13+127*a14+126*a15+125*a16+124*a17+123*a18+122*a19+121*a20+120*a21+119*a22+118*a23+117*a24+116*a25+115*a26+114*a27+113*a28+112*a29+111*a30+110*a31+109*a32+108*a33+107*a34+106*a35+105*a36+104*a37+103*a38+102*a39+101*a40+100*a41+99*a42+98*a43+97*a44+96*a45+95*a46+94*a47+93*a48+92*a49+91*a50+90*a51+89*a52+88*a53+87*a54+86*a55+85*a56+84*a57+83*a58+82*a59+81*a60+80*a61+79*a62+78*a63+77*a64+76*a65+75*a66+74*a67+73*a68+72*a69+71*a70+70*a71+69*a72+68*a73+67*a74+66*a75+65*a76+64*a77+63*a78+62*a79+61*a80+60*a81+59*a82+58*a83+57*a84+56*a85+55*a86+54*a87+53*a88+52*a89+51*a90+50*a91+49*a92+48*a93+47*a94+46*a95+45*a96+44*a97+43*a98+42*a99+41*a100+40*a101+39*a102+38*a103+37*a104+36*a105+35*a106+34*a107+33*a108+32*a109+31*a110+30*a111+29*a112+28*a113+27*a114+26*a115+25*a116+24*a117+23*a118+22*a119+21*a120+20*a121+19*a122+18*a123+17*a124+16*a125+15*a126+14*a127+13*a128+12*a129+11*a130+10*a131+9*a132+8*a133+7*a134+6*a135+5*a136+4*a137+3*a138+2*a139+1*a140)
-#define PP_CSUM_141(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141) (141*a1+140*a2+139*a3+138*a4+137*a5+136*a6+135*a7+134*a8+133*a9+132*a10+131*a11+130*a12+129*a13+128*a14+127*a15+126*a16+125*a17+124*a18+123*a19+122*a20+121*a21+120*a22+119*a23+118*a24+117*a25+116*a26+115*a27+114*a28+113*a29+112*a30+111*a31+110*a32+109*a33+108*a34+107*a35+106*a36+105*a37+104*a38+103*a39+102*a40+101*a41+100*a42+99*a43+98*a44+97*a45+96*a46+95*a47+94*a48+93*a49+92*a50+91*a51+90*a52+89*a53+88*a54+87*a55+86*a56+85*a57+84*a58+83*a59+82*a60+81*a61+80*a62+79*a63+78*a64+77*a65+76*a66+75*a67+74*a68+73*a69+72*a70+71*a71+70*a72+69*a73+68*a74+67*a75+66*a76+65*a77+64*a78+63*a79+62*a80+61*a81+60*a82+59*a83+58*a84+57*a85+56*a86+55*a87+54*a88+53*a89+52*a90+51*a91+50*a92+49*a93+48*a94+47*a95+46*a96+45*a97+44*a98+43*a99+42*a100+41*a101+40*a102+39*a103+38*a104+37*a105+36*a106+35*a107+34*a108+33*a109+32*a110+31*a111+30*a112+29*a113+28*a114+27*a115+26*a116+25*a117+24*a118+23*a119+22*a120+21*a121+20*a122+19*a123+18*a124+17*a125+16*a126+15*a127+14*a128+13*a129+12*a130+11*a131+10*a132+9*a133+8*a134+7*a135+6*a136+5*a137+4*a138+3*a139+2*a140+1*a141)
-#define PP_CSUM_142(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142) (142*a1+141*a2+140*a3+139*a4+138*a5+137*a6+136*a7+135*a8+134*a9+133*a10+132*a11+131*a12+130*a13+129*a14+128*a15+127*a16+126*a17+125*a18+124*a19+123*a20+122*a21+121*a22+120*a23+119*a24+118*a25+117*a26+116*a27+115*a28+114*a29+113*a30+112*a31+111*a32+110*a33+109*a34+108*a35+107*a36+106*a37+105*a38+104*a39+103*a40+102*a41+101*a42+100*a43+99*a44+98*a45+97*a46+96*a47+95*a48+94*a49+93*a50+92*a51+91*a52+90*a53+89*a54+88*a55+87*a56+86*a57+85*a58+84*a59+83*a60+82*a61+81*a62+80*a63+79*a64+78*a65+77*a66+76*a67+75*a68+74*a69+73*a70+72*a71+71*a72+70*a73+69*a74+68*a75+67*a76+66*a77+65*a78+64*a79+63*a80+62*a81+61*a82+60*a83+59*a84+58*a85+57*a86+56*a87+55*a88+54*a89+53*a90+52*a91+51*a92+50*a93+49*a94+48*a95+47*a96+46*a97+45*a98+44*a99+43*a100+42*a101+41*a102+40*a103+39*a104+38*a105+37*a106+36*a107+35*a108+34*a109+33*a110+32*a111+31*a112+30*a113+29*a114+28*a115+27*a116+26*a117+25*a118+24*a119+23*a120+22*a121+21*a122+20*a123+19*a124+18*a125+17*a126+16*a127+15*a128+14*a129+13*a130+12*a131+11*a132+10*a133+9*a134+8*a135+7*a136+6*a137+5*a138+4*a139+3*a140+2*a141+1*a142)
-#define PP_CSUM_143(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143) (143*a1+142*a2+141*a3+140*a4+139*a5+138*a6+137*a7+136*a8+135*a9+134*a10+133*a11+132*a12+131*a13+130*a14+129*a15+128*a16+127*a17+126*a18+125*a19+124*a20+123*a21+122*a22+121*a23+120*a24+119*a25+118*a26+117*a27+116*a28+115*a29+114*a30+113*a31+112*a32+111*a33+110*a34+109*a35+108*a36+107*a37+106*a38+105*a39+104*a40+103*a41+102*a42+101*a43+100*a44+99*a45+98*a46+97*a47+96*a48+95*a49+94*a50+93*a51+92*a52+91*a53+90*a54+89*a55+88*a56+87*a57+86*a58+85*a59+84*a60+83*a61+82*a62+81*a63+80*a64+79*a65+78*a66+77*a67+76*a68+75*a69+74*a70+73*a71+72*a72+71*a73+70*a74+69*a75+68*a76+67*a77+66*a78+65*a79+64*a80+63*a81+62*a82+61*a83+60*a84+59*a85+58*a86+57*a87+56*a88+55*a89+54*a90+53*a91+52*a92+51*a93+50*a94+49*a95+48*a96+47*a97+46*a98+45*a99+44*a100+43*a101+42*a102+41*a103+40*a104+39*a105+38*a106+37*a107+36*a108+35*a109+34*a110+33*a111+32*a112+31*a113+30*a114+29*a115+28*a116+27*a117+26*a118+25*a119+24*a120+23*a121+22*a122+21*a123+20*a124+19*a125+18*a126+17*a127+16*a128+15*a129+14*a130+13*a131+12*a132+11*a133+10*a134+9*a135+8*a136+7*a137+6*a138+5*a139+4*a140+3*a141+2*a142+1*a143)
-#define PP_CSUM_144(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144) (144*a1+143*a2+142*a3+141*a4+140*a5+139*a6+138*a7+137*a8+136*a9+135*a10+134*a11+133*a12+132*a13+131*a14+130*a15+129*a16+128*a17+127*a18+126*a19+125*a20+124*a21+123*a22+122*a23+121*a24+120*a25+119*a26+118*a27+117*a28+116*a29+115*a30+114*a31+113*a32+112*a33+111*a34+110*a35+109*a36+108*a37+107*a38+106*a39+105*a40+104*a41+103*a42+102*a43+101*a44+100*a45+99*a46+98*a47+97*a48+96*a49+95*a50+94*a51+93*a52+92*a53+91*a54+90*a55+89*a56+88*a57+87*a58+86*a59+85*a60+84*a61+83*a62+82*a63+81*a64+80*a65+79*a66+78*a67+77*a68+76*a69+75*a70+74*a71+73*a72+72*a73+71*a74+70*a75+69*a76+68*a77+67*a78+66*a79+65*a80+64*a81+63*a82+62*a83+61*a84+60*a85+59*a86+58*a87+57*a88+56*a89+55*a90+54*a91+53*a92+52*a93+51*a94+50*a95+49*a96+48*a97+47*a98+46*a99+45*a100+44*a101+43*a102+42*a103+41*a104+40*a105+39*a106+38*a107+37*a108+36*a109+35*a110+34*a111+33*a112+32*a113+31*a114+30*a115+29*a116+28*a117+27*a118+26*a119+25*a120+24*a121+23*a122+22*a123+21*a124+20*a125+19*a126+18*a127+17*a128+16*a129+15*a130+14*a131+13*a132+12*a133+11*a134+10*a135+9*a136+8*a137+7*a138+6*a139+5*a140+4*a141+3*a142+2*a143+1*a144)
-#define PP_CSUM_145(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145) (145*a1+144*a2+143*a3+142*a4+141*a5+140*a6+139*a7+138*a8+137*a9+136*a10+135*a11+134*a12+133*a13+132*a14+131*a15+130*a16+129*a17+128*a18+127*a19+126*a20+125*a21+124*a22+123*a23+122*a24+121*a25+120*a26+119*a27+118*a28+117*a29+116*a30+115*a31+114*a32+113*a33+112*a34+111*a35+110*a36+109*a37+108*a38+107*a39+106*a40+105*a41+104*a42+103*a43+102*a44+101*a45+100*a46+99*a47+98*a48+97*a49+96*a50+95*a51+94*a52+93*a53+92*a54+91*a55+90*a56+89*a57+88*a58+87*a59+86*a60+85*a61+84*a62+83*a63+82*a64+81*a65+80*a66+79*a67+78*a68+77*a69+76*a70+75*a71+74*a72+73*a73+72*a74+71*a75+70*a76+69*a77+68*a78+67*a79+66*a80+65*a81+64*a82+63*a83+62*a84+61*a85+60*a86+59*a87+58*a88+57*a89+56*a90+55*a91+54*a92+53*a93+52*a94+51*a95+50*a96+49*a97+48*a98+47*a99+46*a100+45*a101+44*a102+43*a103+42*a104+41*a105+40*a106+39*a107+38*a108+37*a109+36*a110+35*a111+34*a112+33*a113+32*a114+31*a115+30*a116+29*a117+28*a118+27*a119+26*a120+25*a121+24*a122+23*a123+22*a124+21*a125+20*a126+19*a127+18*a128+17*a129+16*a130+15*a131+14*a132+13*a133+12*a134+11*a135+10*a136+9*a137+8*a138+7*a139+6*a140+5*a141+4*a142+3*a143+2*a144+1*a145)
-#define PP_CSUM_146(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146) (146*a1+145*a2+144*a3+143*a4+142*a5+141*a6+140*a7+139*a8+138*a9+137*a10+136*a11+135*a12+134*a13+133*a14+132*a15+131*a16+130*a17+129*a18+128*a19+127*a20+126*a21+125*a22+124*a23+123*a24+122*a25+121*a26+120*a27+119*a28+118*a29+117*a30+116*a31+115*a32+114*a33+113*a34+112*a35+111*a36+110*a37+109*a38+108*a39+107*a40+106*a41+105*a42+104*a43+103*a44+102*a45+101*a46+100*a47+99*a48+98*a49+97*a50+96*a51+95*a52+94*a53+93*a54+92*a55+91*a56+90*a57+89*a58+88*a59+87*a60+86*a61+85*a62+84*a63+83*a64+82*a65+81*a66+80*a67+79*a68+78*a69+77*a70+76*a71+75*a72+74*a73+73*a74+72*a75+71*a76+70*a77+69*a78+68*a79+67*a80+66*a81+65*a82+64*a83+63*a84+62*a85+61*a86+60*a87+59*a88+58*a89+57*a90+56*a91+55*a92+54*a93+53*a94+52*a95+51*a96+50*a97+49*a98+48*a99+47*a100+46*a101+45*a102+44*a103+43*a104+42*a105+41*a106+40*a107+39*a108+38*a109+37*a110+36*a111+35*a112+34*a113+33*a114+32*a115+31*a116+30*a117+29*a118+28*a119+27*a120+26*a121+25*a122+24*a123+23*a124+22*a125+21*a126+20*a127+19*a128+18*a129+17*a130+16*a131+15*a132+14*a133+13*a134+12*a135+11*a136+10*a137+9*a138+8*a139+7*a140+6*a141+5*a142+4*a143+3*a144+2*a145+1*a146)
-#define PP_CSUM_147(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147) (147*a1+146*a2+145*a3+144*a4+143*a5+142*a6+141*a7+140*a8+139*a9+138*a10+137*a11+136*a12+135*a13+134*a14+133*a15+132*a16+131*a17+130*a18+129*a19+128*a20+127*a21+126*a22+125*a23+124*a24+123*a25+122*a26+121*a27+120*a28+119*a29+118*a30+117*a31+116*a32+115*a33+114*a34+113*a35+112*a36+111*a37+110*a38+109*a39+108*a40+107*a41+106*a42+105*a43+104*a44+103*a45+102*a46+101*a47+100*a48+99*a49+98*a50+97*a51+96*a52+95*a53+94*a54+93*a55+92*a56+91*a57+90*a58+89*a59+88*a60+87*a61+86*a62+85*a63+84*a64+83*a65+82*a66+81*a67+80*a68+79*a69+78*a70+77*a71+76*a72+75*a73+74*a74+73*a75+72*a76+71*a77+70*a78+69*a79+68*a80+67*a81+66*a82+65*a83+64*a84+63*a85+62*a86+61*a87+60*a88+59*a89+58*a90+57*a91+56*a92+55*a93+54*a94+53*a95+52*a96+51*a97+50*a98+49*a99+48*a100+47*a101+46*a102+45*a103+44*a104+43*a105+42*a106+41*a107+40*a108+39*a109+38*a110+37*a111+36*a112+35*a113+34*a114+33*a115+32*a116+31*a117+30*a118+29*a119+28*a120+27*a121+26*a122+25*a123+24*a124+23*a125+22*a126+21*a127+20*a128+19*a129+18*a130+17*a131+16*a132+15*a133+14*a134+13*a135+12*a136+11*a137+10*a138+9*a139+8*a140+7*a141+6*a142+5*a143+4*a144+3*a145+2*a146+1*a147)
-#define PP_CSUM_148(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148) (148*a1+147*a2+146*a3+145*a4+144*a5+143*a6+142*a7+141*a8+140*a9+139*a10+138*a11+137*a12+136*a13+135*a14+134*a15+133*a16+132*a17+131*a18+130*a19+129*a20+128*a21+127*a22+126*a23+125*a24+124*a25+123*a26+122*a27+121*a28+120*a29+119*a30+118*a31+117*a32+116*a33+115*a34+114*a35+113*a36+112*a37+111*a38+110*a39+109*a40+108*a41+107*a42+106*a43+105*a44+104*a45+103*a46+102*a47+101*a48+100*a49+99*a50+98*a51+97*a52+96*a53+95*a54+94*a55+93*a56+92*a57+91*a58+90*a59+89*a60+88*a61+87*a62+86*a63+85*a64+84*a65+83*a66+82*a67+81*a68+80*a69+79*a70+78*a71+77*a72+76*a73+75*a74+74*a75+73*a76+72*a77+71*a78+70*a79+69*a80+68*a81+67*a82+66*a83+65*a84+64*a85+63*a86+62*a87+61*a88+60*a89+59*a90+58*a91+57*a92+56*a93+55*a94+54*a95+53*a96+52*a97+51*a98+50*a99+49*a100+48*a101+47*a102+46*a103+45*a104+44*a105+43*a106+42*a107+41*a108+40*a109+39*a110+38*a111+37*a112+36*a113+35*a114+34*a115+33*a116+32*a117+31*a118+30*a119+29*a120+28*a121+27*a122+26*a123+25*a124+24*a125+23*a126+22*a127+21*a128+20*a129+19*a130+18*a131+17*a132+16*a133+15*a134+14*a135+13*a136+12*a137+11*a138+10*a139+9*a140+8*a141+7*a142+6*a143+5*a144+4*a145+3*a146+2*a147+1*a148)
-#define PP_CSUM_149(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149) (149*a1+148*a2+147*a3+146*a4+145*a5+144*a6+143*a7+142*a8+141*a9+140*a10+139*a11+138*a12+137*a13+136*a14+135*a15+134*a16+133*a17+132*a18+131*a19+130*a20+129*a21+128*a22+127*a23+126*a24+125*a25+124*a26+123*a27+122*a28+121*a29+120*a30+119*a31+118*a32+117*a33+116*a34+115*a35+114*a36+113*a37+112*a38+111*a39+110*a40+109*a41+108*a42+107*a43+106*a44+105*a45+104*a46+103*a47+102*a48+101*a49+100*a50+99*a51+98*a52+97*a53+96*a54+95*a55+94*a56+93*a57+92*a58+91*a59+90*a60+89*a61+88*a62+87*a63+86*a64+85*a65+84*a66+83*a67+82*a68+81*a69+80*a70+79*a71+78*a72+77*a73+76*a74+75*a75+74*a76+73*a77+72*a78+71*a79+70*a80+69*a81+68*a82+67*a83+66*a84+65*a85+64*a86+63*a87+62*a88+61*a89+60*a90+59*a91+58*a92+57*a93+56*a94+55*a95+54*a96+53*a97+52*a98+51*a99+50*a100+49*a101+48*a102+47*a103+46*a104+45*a105+44*a106+43*a107+42*a108+41*a109+40*a110+39*a111+38*a112+37*a113+36*a114+35*a115+34*a116+33*a117+32*a118+31*a119+30*a120+29*a121+28*a122+27*a123+26*a124+25*a125+24*a126+23*a127+22*a128+21*a129+20*a130+19*a131+18*a132+17*a133+16*a134+15*a135+14*a136+13*a137+12*a138+11*a139+10*a140+9*a141+8*a142+7*a143+6*a144+5*a145+4*a146+3*a147+2*a148+1*a149)
-#define PP_CSUM_150(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150) (150*a1+149*a2+148*a3+147*a4+146*a5+145*a6+144*a7+143*a8+142*a9+141*a10+140*a11+139*a12+138*a13+137*a14+136*a15+135*a16+134*a17+133*a18+132*a19+131*a20+130*a21+129*a22+128*a23+127*a24+126*a25+125*a26+124*a27+123*a28+122*a29+121*a30+120*a31+119*a32+118*a33+117*a34+116*a35+115*a36+114*a37+113*a38+112*a39+111*a40+110*a41+109*a42+108*a43+107*a44+106*a45+105*a46+104*a47+103*a48+102*a49+101*a50+100*a51+99*a52+98*a53+97*a54+96*a55+95*a56+94*a57+93*a58+92*a59+91*a60+90*a61+89*a62+88*a63+87*a64+86*a65+85*a66+84*a67+83*a68+82*a69+81*a70+80*a71+79*a72+78*a73+77*a74+76*a75+75*a76+74*a77+73*a78+72*a79+71*a80+70*a81+69*a82+68*a83+67*a84+66*a85+65*a86+64*a87+63*a88+62*a89+61*a90+60*a91+59*a92+58*a93+57*a94+56*a95+55*a96+54*a97+53*a98+52*a99+51*a100+50*a101+49*a102+48*a103+47*a104+46*a105+45*a106+44*a107+43*a108+42*a109+41*a110+40*a111+39*a112+38*a113+37*a114+36*a115+35*a116+34*a117+33*a118+32*a119+31*a120+30*a121+29*a122+28*a123+27*a124+26*a125+25*a126+24*a127+23*a128+22*a129+21*a130+20*a131+19*a132+18*a133+17*a134+16*a135+15*a136+14*a137+13*a138+12*a139+11*a140+10*a141+9*a142+8*a143+7*a144+6*a145+5*a146+4*a147+3*a148+2*a149+1*a150)
-#define PP_CSUM_151(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151) (151*a1+150*a2+149*a3+148*a4+147*a5+146*a6+145*a7+144*a8+143*a9+142*a10+141*a11+140*a12+139*a13+138*a14+137*a15+136*a16+135*a17+134*a18+133*a19+132*a20+131*a21+130*a22+129*a23+128*a24+127*a25+126*a26+125*a27+124*a28+123*a29+122*a30+121*a31+120*a32+119*a33+118*a34+117*a35+116*a36+115*a37+114*a38+113*a39+112*a40+111*a41+110*a42+109*a43+108*a44+107*a45+106*a46+105*a47+104*a48+103*a49+102*a50+101*a51+100*a52+99*a53+98*a54+97*a55+96*a56+95*a57+94*a58+93*a59+92*a60+91*a61+90*a62+89*a63+88*a64+87*a65+86*a66+85*a67+84*a68+83*a69+82*a70+81*a71+80*a72+79*a73+78*a74+77*a75+76*a76+75*a77+74*a78+73*a79+72*a80+71*a81+70*a82+69*a83+68*a84+67*a85+66*a86+65*a87+64*a88+63*a89+62*a90+61*a91+60*a92+59*a93+58*a94+57*a95+56*a96+55*a97+54*a98+53*a99+52*a100+51*a101+50*a102+49*a103+48*a104+47*a105+46*a106+45*a107+44*a108+43*a109+42*a110+41*a111+40*a112+39*a113+38*a114+37*a115+36*a116+35*a117+34*a118+33*a119+32*a120+31*a121+30*a122+29*a123+28*a124+27*a125+26*a126+25*a127+24*a128+23*a129+22*a130+21*a131+20*a132+19*a133+18*a134+17*a135+16*a136+15*a137+14*a138+13*a139+12*a140+11*a141+10*a142+9*a143+8*a144+7*a145+6*a146+5*a147+4*a148+3*a149+2*a150+1*a151)
-#define PP_CSUM_152(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152) (152*a1+151*a2+150*a3+149*a4+148*a5+147*a6+146*a7+145*a8+144*a9+143*a10+142*a11+141*a12+140*a13+139*a14+138*a15+137*a16+136*a17+135*a18+134*a19+133*a20+132*a21+131*a22+130*a23+129*a24+128*a25+127*a26+126*a27+125*a28+124*a29+123*a30+122*a31+121*a32+120*a33+119*a34+118*a35+117*a36+116*a37+115*a38+114*a39+113*a40+112*a41+111*a42+110*a43+109*a44+108*a45+107*a46+106*a47+105*a48+104*a49+103*a50+102*a51+101*a52+100*a53+99*a54+98*a55+97*a56+96*a57+95*a58+94*a59+93*a60+92*a61+91*a62+90*a63+89*a64+88*a65+87*a66+86*a67+85*a68+84*a69+83*a70+82*a71+81*a72+80*a73+79*a74+78*a75+77*a76+76*a77+75*a78+74*a79+73*a80+72*a81+71*a82+70*a83+69*a84+68*a85+67*a86+66*a87+65*a88+64*a89+63*a90+62*a91+61*a92+60*a93+59*a94+58*a95+57*a96+56*a97+55*a98+54*a99+53*a100+52*a101+51*a102+50*a103+49*a104+48*a105+47*a106+46*a107+45*a108+44*a109+43*a110+42*a111+41*a112+40*a113+39*a114+38*a115+37*a116+36*a117+35*a118+34*a119+33*a120+32*a121+31*a122+30*a123+29*a124+28*a125+27*a126+26*a127+25*a128+24*a129+23*a130+22*a131+21*a132+20*a133+19*a134+18*a135+17*a136+16*a137+15*a138+14*a139+13*a140+12*a141+11*a142+10*a143+9*a144+8*a145+7*a146+6*a147+5*a148+4*a149+3*a150+2*a151+1*a152)
-#define PP_CSUM_153(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153) (153*a1+152*a2+151*a3+150*a4+149*a5+148*a6+147*a7+146*a8+145*a9+144*a10+143*a11+142*a12+141*a13+140*a14+139*a15+138*a16+137*a17+136*a18+135*a19+134*a20+133*a21+132*a22+131*a23+130*a24+129*a25+128*a26+127*a27+126*a28+125*a29+124*a30+123*a31+122*a32+121*a33+120*a34+119*a35+118*a36+117*a37+116*a38+115*a39+114*a40+113*a41+112*a42+111*a43+110*a44+109*a45+108*a46+107*a47+106*a48+105*a49+104*a50+103*a51+102*a52+101*a53+100*a54+99*a55+98*a56+97*a57+96*a58+95*a59+94*a60+93*a61+92*a62+91*a63+90*a64+89*a65+88*a66+87*a67+86*a68+85*a69+84*a70+83*a71+82*a72+81*a73+80*a74+79*a75+78*a76+77*a77+76*a78+75*a79+74*a80+73*a81+72*a82+71*a83+70*a84+69*a85+68*a86+67*a87+66*a88+65*a89+64*a90+63*a91+62*a92+61*a93+60*a94+59*a95+58*a96+57*a97+56*a98+55*a99+54*a100+53*a101+52*a102+51*a103+50*a104+49*a105+48*a106+47*a107+46*a108+45*a109+44*a110+43*a111+42*a112+41*a113+40*a114+39*a115+38*a116+37*a117+36*a118+35*a119+34*a120+33*a121+32*a122+31*a123+30*a124+29*a125+28*a126+27*a127+26*a128+25*a129+24*a130+23*a131+22*a132+21*a133+20*a134+19*a135+18*a136+17*a137+16*a138+15*a139+14*a140+13*a141+12*a142+11*a143+10*a144+9*a145+8*a146+7*a147+6*a148+5*a149+4*a150+3*a151+2*a152+1*a153)
-#define PP_CSUM_154(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154) (154*a1+153*a2+152*a3+151*a4+150*a5+149*a6+148*a7+147*a8+146*a9+145*a10+144*a11+143*a12+142*a13+141*a14+140*a15+139*a16+138*a17+137*a18+136*a19+135*a20+134*a21+133*a22+132*a23+131*a24+130*a25+129*a26+128*a27+127*a28+126*a29+125*a30+124*a31+123*a32+122*a33+121*a34+120*a35+119*a36+118*a37+117*a38+116*a39+115*a40+114*a41+113*a42+112*a43+111*a44+110*a45+109*a46+108*a47+107*a48+106*a49+105*a50+104*a51+103*a52+102*a53+101*a54+100*a55+99*a56+98*a57+97*a58+96*a59+95*a60+94*a61+93*a62+92*a63+91*a64+90*a65+89*a66+88*a67+87*a68+86*a69+85*a70+84*a71+83*a72+82*a73+81*a74+80*a75+79*a76+78*a77+77*a78+76*a79+75*a80+74*a81+73*a82+72*a83+71*a84+70*a85+69*a86+68*a87+67*a88+66*a89+65*a90+64*a91+63*a92+62*a93+61*a94+60*a95+59*a96+58*a97+57*a98+56*a99+55*a100+54*a101+53*a102+52*a103+51*a104+50*a105+49*a106+48*a107+47*a108+46*a109+45*a110+44*a111+43*a112+42*a113+41*a114+40*a115+39*a116+38*a117+37*a118+36*a119+35*a120+34*a121+33*a122+32*a123+31*a124+30*a125+29*a126+28*a127+27*a128+26*a129+25*a130+24*a131+23*a132+22*a133+21*a134+20*a135+19*a136+18*a137+17*a138+16*a139+15*a140+14*a141+13*a142+12*a143+11*a144+10*a145+9*a146+8*a147+7*a148+6*a149+5*a150+4*a151+3*a152+2*a153+1*a154)
-#define PP_CSUM_155(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155) (155*a1+154*a2+153*a3+152*a4+151*a5+150*a6+149*a7+148*a8+147*a9+146*a10+145*a11+144*a12+143*a13+142*a14+141*a15+140*a16+139*a17+138*a18+137*a19+136*a20+135*a21+134*a22+133*a23+132*a24+131*a25+130*a26+129*a27+128*a28+127*a29+126*a30+125*a31+124*a32+123*a33+122*a34+121*a35+120*a36+119*a37+118*a38+117*a39+116*a40+115*a41+114*a42+113*a43+112*a44+111*a45+110*a46+109*a47+108*a48+107*a49+106*a50+105*a51+104*a52+103*a53+102*a54+101*a55+100*a56+99*a57+98*a58+97*a59+96*a60+95*a61+94*a62+93*a63+92*a64+91*a65+90*a66+89*a67+88*a68+87*a69+86*a70+85*a71+84*a72+83*a73+82*a74+81*a75+80*a76+79*a77+78*a78+77*a79+76*a80+75*a81+74*a82+73*a83+72*a84+71*a85+70*a86+69*a87+68*a88+67*a89+66*a90+65*a91+64*a92+63*a93+62*a94+61*a95+60*a96+59*a97+58*a98+57*a99+56*a100+55*a101+54*a102+53*a103+52*a104+51*a105+50*a106+49*a107+48*a108+47*a109+46*a110+45*a111+44*a112+43*a113+42*a114+41*a115+40*a116+39*a117+38*a118+37*a119+36*a120+35*a121+34*a122+33*a123+32*a124+31*a125+30*a126+29*a127+28*a128+27*a129+26*a130+25*a131+24*a132+23*a133+22*a134+21*a135+20*a136+19*a137+18*a138+17*a139+16*a140+15*a141+14*a142+13*a143+12*a144+11*a145+10*a146+9*a147+8*a148+7*a149+6*a150+5*a151+4*a152+3*a153+2*a154+1*a155)
-#define PP_CSUM_156(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156) (156*a1+155*a2+154*a3+153*a4+152*a5+151*a6+150*a7+149*a8+148*a9+147*a10+146*a11+145*a12+144*a13+143*a14+142*a15+141*a16+140*a17+139*a18+138*a19+137*a20+136*a21+135*a22+134*a23+133*a24+132*a25+131*a26+130*a27+129*a28+128*a29+127*a30+126*a31+125*a32+124*a33+123*a34+122*a35+121*a36+120*a37+119*a38+118*a39+117*a40+116*a41+115*a42+114*a43+113*a44+112*a45+111*a46+110*a47+109*a48+108*a49+107*a50+106*a51+105*a52+104*a53+103*a54+102*a55+101*a56+100*a57+99*a58+98*a59+97*a60+96*a61+95*a62+94*a63+93*a64+92*a65+91*a66+90*a67+89*a68+88*a69+87*a70+86*a71+85*a72+84*a73+83*a74+82*a75+81*a76+80*a77+79*a78+78*a79+77*a80+76*a81+75*a82+74*a83+73*a84+72*a85+71*a86+70*a87+69*a88+68*a89+67*a90+66*a91+65*a92+64*a93+63*a94+62*a95+61*a96+60*a97+59*a98+58*a99+57*a100+56*a101+55*a102+54*a103+53*a104+52*a105+51*a106+50*a107+49*a108+48*a109+47*a110+46*a111+45*a112+44*a113+43*a114+42*a115+41*a116+40*a117+39*a118+38*a119+37*a120+36*a121+35*a122+34*a123+33*a124+32*a125+31*a126+30*a127+29*a128+28*a129+27*a130+26*a131+25*a132+24*a133+23*a134+22*a135+21*a136+20*a137+19*a138+18*a139+17*a140+16*a141+15*a142+14*a143+13*a144+12*a145+11*a146+10*a147+9*a148+8*a149+7*a150+6*a151+5*a152+4*a153+3*a154+2*a155+1*a156)
-#define PP_CSUM_157(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157) (157*a1+156*a2+155*a3+154*a4+153*a5+152*a6+151*a7+150*a8+149*a9+148*a10+147*a11+146*a12+145*a13+144*a14+143*a15+142*a16+141*a17+140*a18+139*a19+138*a20+137*a21+136*a22+135*a23+134*a24+133*a25+132*a26+131*a27+130*a28+129*a29+128*a30+127*a31+126*a32+125*a33+124*a34+123*a35+122*a36+121*a37+120*a38+119*a39+118*a40+117*a41+116*a42+115*a43+114*a44+113*a45+112*a46+111*a47+110*a48+109*a49+108*a50+107*a51+106*a52+105*a53+104*a54+103*a55+102*a56+101*a57+100*a58+99*a59+98*a60+97*a61+96*a62+95*a63+94*a64+93*a65+92*a66+91*a67+90*a68+89*a69+88*a70+87*a71+86*a72+85*a73+84*a74+83*a75+82*a76+81*a77+80*a78+79*a79+78*a80+77*a81+76*a82+75*a83+74*a84+73*a85+72*a86+71*a87+70*a88+69*a89+68*a90+67*a91+66*a92+65*a93+64*a94+63*a95+62*a96+61*a97+60*a98+59*a99+58*a100+57*a101+56*a102+55*a103+54*a104+53*a105+52*a106+51*a107+50*a108+49*a109+48*a110+47*a111+46*a112+45*a113+44*a114+43*a115+42*a116+41*a117+40*a118+39*a119+38*a120+37*a121+36*a122+35*a123+34*a124+33*a125+32*a126+31*a127+30*a128+29*a129+28*a130+27*a131+26*a132+25*a133+24*a134+23*a135+22*a136+21*a137+20*a138+19*a139+18*a140+17*a141+16*a142+15*a143+14*a144+13*a145+12*a146+11*a147+10*a148+9*a149+8*a150+7*a151+6*a152+5*a153+4*a154+3*a155+2*a156+1*a157)
-#define PP_CSUM_158(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158) (158*a1+157*a2+156*a3+155*a4+154*a5+153*a6+152*a7+151*a8+150*a9+149*a10+148*a11+147*a12+146*a13+145*a14+144*a15+143*a16+142*a17+141*a18+140*a19+139*a20+138*a21+137*a22+136*a23+135*a24+134*a25+133*a26+132*a27+131*a28+130*a29+129*a30+128*a31+127*a32+126*a33+125*a34+124*a35+123*a36+122*a37+121*a38+120*a39+119*a40+118*a41+117*a42+116*a43+115*a44+114*a45+113*a46+112*a47+111*a48+110*a49+109*a50+108*a51+107*a52+106*a53+105*a54+104*a55+103*a56+102*a57+101*a58+100*a59+99*a60+98*a61+97*a62+96*a63+95*a64+94*a65+93*a66+92*a67+91*a68+90*a69+89*a70+88*a71+87*a72+86*a73+85*a74+84*a75+83*a76+82*a77+81*a78+80*a79+79*a80+78*a81+77*a82+76*a83+75*a84+74*a85+73*a86+72*a87+71*a88+70*a89+69*a90+68*a91+67*a92+66*a93+65*a94+64*a95+63*a96+62*a97+61*a98+60*a99+59*a100+58*a101+57*a102+56*a103+55*a104+54*a105+53*a106+52*a107+51*a108+50*a109+49*a110+48*a111+47*a112+46*a113+45*a114+44*a115+43*a116+42*a117+41*a118+40*a119+39*a120+38*a121+37*a122+36*a123+35*a124+34*a125+33*a126+32*a127+31*a128+30*a129+29*a130+28*a131+27*a132+26*a133+25*a134+24*a135+23*a136+22*a137+21*a138+20*a139+19*a140+18*a141+17*a142+16*a143+15*a144+14*a145+13*a146+12*a147+11*a148+10*a149+9*a150+8*a151+7*a152+6*a153+5*a154+4*a155+3*a156+2*a157+1*a158)
-#define PP_CSUM_159(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159) (159*a1+158*a2+157*a3+156*a4+155*a5+154*a6+153*a7+152*a8+151*a9+150*a10+149*a11+148*a12+147*a13+146*a14+145*a15+144*a16+143*a17+142*a18+141*a19+140*a20+139*a21+138*a22+137*a23+136*a24+135*a25+134*a26+133*a27+132*a28+131*a29+130*a30+129*a31+128*a32+127*a33+126*a34+125*a35+124*a36+123*a37+122*a38+121*a39+120*a40+119*a41+118*a42+117*a43+116*a44+115*a45+114*a46+113*a47+112*a48+111*a49+110*a50+109*a51+108*a52+107*a53+106*a54+105*a55+104*a56+103*a57+102*a58+101*a59+100*a60+99*a61+98*a62+97*a63+96*a64+95*a65+94*a66+93*a67+92*a68+91*a69+90*a70+89*a71+88*a72+87*a73+86*a74+85*a75+84*a76+83*a77+82*a78+81*a79+80*a80+79*a81+78*a82+77*a83+76*a84+75*a85+74*a86+73*a87+72*a88+71*a89+70*a90+69*a91+68*a92+67*a93+66*a94+65*a95+64*a96+63*a97+62*a98+61*a99+60*a100+59*a101+58*a102+57*a103+56*a104+55*a105+54*a106+53*a107+52*a108+51*a109+50*a110+49*a111+48*a112+47*a113+46*a114+45*a115+44*a116+43*a117+42*a118+41*a119+40*a120+39*a121+38*a122+37*a123+36*a124+35*a125+34*a126+33*a127+32*a128+31*a129+30*a130+29*a131+28*a132+27*a133+26*a134+25*a135+24*a136+23*a137+22*a138+21*a139+20*a140+19*a141+18*a142+17*a143+16*a144+15*a145+14*a146+13*a147+12*a148+11*a149+10*a150+9*a151+8*a152+7*a153+6*a154+5*a155+4*a156+3*a157+2*a158+1*a159)
-#define PP_CSUM_160(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160) (160*a1+159*a2+158*a3+157*a4+156*a5+155*a6+154*a7+153*a8+152*a9+151*a10+150*a11+149*a12+148*a13+147*a14+146*a15+145*a16+144*a17+143*a18+142*a19+141*a20+140*a21+139*a22+138*a23+137*a24+136*a25+135*a26+134*a27+133*a28+132*a29+131*a30+130*a31+129*a32+128*a33+127*a34+126*a35+125*a36+124*a37+123*a38+122*a39+121*a40+120*a41+119*a42+118*a43+117*a44+116*a45+115*a46+114*a47+113*a48+112*a49+111*a50+110*a51+109*a52+108*a53+107*a54+106*a55+105*a56+104*a57+103*a58+102*a59+101*a60+100*a61+99*a62+98*a63+97*a64+96*a65+95*a66+94*a67+93*a68+92*a69+91*a70+90*a71+89*a72+88*a73+87*a74+86*a75+85*a76+84*a77+83*a78+82*a79+81*a80+80*a81+79*a82+78*a83+77*a84+76*a85+75*a86+74*a87+73*a88+72*a89+71*a90+70*a91+69*a92+68*a93+67*a94+66*a95+65*a96+64*a97+63*a98+62*a99+61*a100+60*a101+59*a102+58*a103+57*a104+56*a105+55*a106+54*a107+53*a108+52*a109+51*a110+50*a111+49*a112+48*a113+47*a114+46*a115+45*a116+44*a117+43*a118+42*a119+41*a120+40*a121+39*a122+38*a123+37*a124+36*a125+35*a126+34*a127+33*a128+32*a129+31*a130+30*a131+29*a132+28*a133+27*a134+26*a135+25*a136+24*a137+23*a138+22*a139+21*a140+20*a141+19*a142+18*a143+17*a144+16*a145+15*a146+14*a147+13*a148+12*a149+11*a150+10*a151+9*a152+8*a153+7*a154+6*a155+5*a156+4*a157+3*a158+2*a159+1*a160)
-#define PP_CSUM_161(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161) (161*a1+160*a2+159*a3+158*a4+157*a5+156*a6+155*a7+154*a8+153*a9+152*a10+151*a11+150*a12+149*a13+148*a14+147*a15+146*a16+145*a17+144*a18+143*a19+142*a20+141*a21+140*a22+139*a23+138*a24+137*a25+136*a26+135*a27+134*a28+133*a29+132*a30+131*a31+130*a32+129*a33+128*a34+127*a35+126*a36+125*a37+124*a38+123*a39+122*a40+121*a41+120*a42+119*a43+118*a44+117*a45+116*a46+115*a47+114*a48+113*a49+112*a50+111*a51+110*a52+109*a53+108*a54+107*a55+106*a56+105*a57+104*a58+103*a59+102*a60+101*a61+100*a62+99*a63+98*a64+97*a65+96*a66+95*a67+94*a68+93*a69+92*a70+91*a71+90*a72+89*a73+88*a74+87*a75+86*a76+85*a77+84*a78+83*a79+82*a80+81*a81+80*a82+79*a83+78*a84+77*a85+76*a86+75*a87+74*a88+73*a89+72*a90+71*a91+70*a92+69*a93+68*a94+67*a95+66*a96+65*a97+64*a98+63*a99+62*a100+61*a101+60*a102+59*a103+58*a104+57*a105+56*a106+55*a107+54*a108+53*a109+52*a110+51*a111+50*a112+49*a113+48*a114+47*a115+46*a116+45*a117+44*a118+43*a119+42*a120+41*a121+40*a122+39*a123+38*a124+37*a125+36*a126+35*a127+34*a128+33*a129+32*a130+31*a131+30*a132+29*a133+28*a134+27*a135+26*a136+25*a137+24*a138+23*a139+22*a140+21*a141+20*a142+19*a143+18*a144+17*a145+16*a146+15*a147+14*a148+13*a149+12*a150+11*a151+10*a152+9*a153+8*a154+7*a155+6*a156+5*a157+4*a158+3*a159+2*a160+1*a161)
-#define PP_CSUM_162(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162) (162*a1+161*a2+160*a3+159*a4+158*a5+157*a6+156*a7+155*a8+154*a9+153*a10+152*a11+151*a12+150*a13+149*a14+148*a15+147*a16+146*a17+145*a18+144*a19+143*a20+142*a21+141*a22+140*a23+139*a24+138*a25+137*a26+136*a27+135*a28+134*a29+133*a30+132*a31+131*a32+130*a33+129*a34+128*a35+127*a36+126*a37+125*a38+124*a39+123*a40+122*a41+121*a42+120*a43+119*a44+118*a45+117*a46+116*a47+115*a48+114*a49+113*a50+112*a51+111*a52+110*a53+109*a54+108*a55+107*a56+106*a57+105*a58+104*a59+103*a60+102*a61+101*a62+100*a63+99*a64+98*a65+97*a66+96*a67+95*a68+94*a69+93*a70+92*a71+91*a72+90*a73+89*a74+88*a75+87*a76+86*a77+85*a78+84*a79+83*a80+82*a81+81*a82+80*a83+79*a84+78*a85+77*a86+76*a87+75*a88+74*a89+73*a90+72*a91+71*a92+70*a93+69*a94+68*a95+67*a96+66*a97+65*a98+64*a99+63*a100+62*a101+61*a102+60*a103+59*a104+58*a105+57*a106+56*a107+55*a108+54*a109+53*a110+52*a111+51*a112+50*a113+49*a114+48*a115+47*a116+46*a117+45*a118+44*a119+43*a120+42*a121+41*a122+40*a123+39*a124+38*a125+37*a126+36*a127+35*a128+34*a129+33*a130+32*a131+31*a132+30*a133+29*a134+28*a135+27*a136+26*a137+25*a138+24*a139+23*a140+22*a141+21*a142+20*a143+19*a144+18*a145+17*a146+16*a147+15*a148+14*a149+13*a150+12*a151+11*a152+10*a153+9*a154+8*a155+7*a156+6*a157+5*a158+4*a159+3*a160+2*a161+1*a162)
-#define PP_CSUM_163(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163) (163*a1+162*a2+161*a3+160*a4+159*a5+158*a6+157*a7+156*a8+155*a9+154*a10+153*a11+152*a12+151*a13+150*a14+149*a15+148*a16+147*a17+146*a18+145*a19+144*a20+143*a21+142*a22+141*a23+140*a24+139*a25+138*a26+137*a27+136*a28+135*a29+134*a30+133*a31+132*a32+131*a33+130*a34+129*a35+128*a36+127*a37+126*a38+125*a39+124*a40+123*a41+122*a42+121*a43+120*a44+119*a45+118*a46+117*a47+116*a48+115*a49+114*a50+113*a51+112*a52+111*a53+110*a54+109*a55+108*a56+107*a57+106*a58+105*a59+104*a60+103*a61+102*a62+101*a63+100*a64+99*a65+98*a66+97*a67+96*a68+95*a69+94*a70+93*a71+92*a72+91*a73+90*a74+89*a75+88*a76+87*a77+86*a78+85*a79+84*a80+83*a81+82*a82+81*a83+80*a84+79*a85+78*a86+77*a87+76*a88+75*a89+74*a90+73*a91+72*a92+71*a93+70*a94+69*a95+68*a96+67*a97+66*a98+65*a99+64*a100+63*a101+62*a102+61*a103+60*a104+59*a105+58*a106+57*a107+56*a108+55*a109+54*a110+53*a111+52*a112+51*a113+50*a114+49*a115+48*a116+47*a117+46*a118+45*a119+44*a120+43*a121+42*a122+41*a123+40*a124+39*a125+38*a126+37*a127+36*a128+35*a129+34*a130+33*a131+32*a132+31*a133+30*a134+29*a135+28*a136+27*a137+26*a138+25*a139+24*a140+23*a141+22*a142+21*a143+20*a144+19*a145+18*a146+17*a147+16*a148+15*a149+14*a150+13*a151+12*a152+11*a153+10*a154+9*a155+8*a156+7*a157+6*a158+5*a159+4*a160+3*a161+2*a162+1*a163)
-#define PP_CSUM_164(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164) (164*a1+163*a2+162*a3+161*a4+160*a5+159*a6+158*a7+157*a8+156*a9+155*a10+154*a11+153*a12+152*a13+151*a14+150*a15+149*a16+148*a17+147*a18+146*a19+145*a20+144*a21+143*a22+142*a23+141*a24+140*a25+139*a26+138*a27+137*a28+136*a29+135*a30+134*a31+133*a32+132*a33+131*a34+130*a35+129*a36+128*a37+127*a38+126*a39+125*a40+124*a41+123*a42+122*a43+121*a44+120*a45+119*a46+118*a47+117*a48+116*a49+115*a50+114*a51+113*a52+112*a53+111*a54+110*a55+109*a56+108*a57+107*a58+106*a59+105*a60+104*a61+103*a62+102*a63+101*a64+100*a65+99*a66+98*a67+97*a68+96*a69+95*a70+94*a71+93*a72+92*a73+91*a74+90*a75+89*a76+88*a77+87*a78+86*a79+85*a80+84*a81+83*a82+82*a83+81*a84+80*a85+79*a86+78*a87+77*a88+76*a89+75*a90+74*a91+73*a92+72*a93+71*a94+70*a95+69*a96+68*a97+67*a98+66*a99+65*a100+64*a101+63*a102+62*a103+61*a104+60*a105+59*a106+58*a107+57*a108+56*a109+55*a110+54*a111+53*a112+52*a113+51*a114+50*a115+49*a116+48*a117+47*a118+46*a119+45*a120+44*a121+43*a122+42*a123+41*a124+40*a125+39*a126+38*a127+37*a128+36*a129+35*a130+34*a131+33*a132+32*a133+31*a134+30*a135+29*a136+28*a137+27*a138+26*a139+25*a140+24*a141+23*a142+22*a143+21*a144+20*a145+19*a146+18*a147+17*a148+16*a149+15*a150+14*a151+13*a152+12*a153+11*a154+10*a155+9*a156+8*a157+7*a158+6*a159+5*a160+4*a161+3*a162+2*a163+1*a164)
-#define PP_CSUM_165(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165) (165*a1+164*a2+163*a3+162*a4+161*a5+160*a6+159*a7+158*a8+157*a9+156*a10+155*a11+154*a12+153*a13+152*a14+151*a15+150*a16+149*a17+148*a18+147*a19+146*a20+145*a21+144*a22+143*a23+142*a24+141*a25+140*a26+139*a27+138*a28+137*a29+136*a30+135*a31+134*a32+133*a33+132*a34+131*a35+130*a36+129*a37+128*a38+127*a39+126*a40+125*a41+124*a42+123*a43+122*a44+121*a45+120*a46+119*a47+118*a48+117*a49+116*a50+115*a51+114*a52+113*a53+112*a54+111*a55+110*a56+109*a57+108*a58+107*a59+106*a60+105*a61+104*a62+103*a63+102*a64+101*a65+100*a66+99*a67+98*a68+97*a69+96*a70+95*a71+94*a72+93*a73+92*a74+91*a75+90*a76+89*a77+88*a78+87*a79+86*a80+85*a81+84*a82+83*a83+82*a84+81*a85+80*a86+79*a87+78*a88+77*a89+76*a90+75*a91+74*a92+73*a93+72*a94+71*a95+70*a96+69*a97+68*a98+67*a99+66*a100+65*a101+64*a102+63*a103+62*a104+61*a105+60*a106+59*a107+58*a108+57*a109+56*a110+55*a111+54*a112+53*a113+52*a114+51*a115+50*a116+49*a117+48*a118+47*a119+46*a120+45*a121+44*a122+43*a123+42*a124+41*a125+40*a126+39*a127+38*a128+37*a129+36*a130+35*a131+34*a132+33*a133+32*a134+31*a135+30*a136+29*a137+28*a138+27*a139+26*a140+25*a141+24*a142+23*a143+22*a144+21*a145+20*a146+19*a147+18*a148+17*a149+16*a150+15*a151+14*a152+13*a153+12*a154+11*a155+10*a156+9*a157+8*a158+7*a159+6*a160+5*a161+4*a162+3*a163+2*a164+1*a165)
-#define PP_CSUM_166(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166) (166*a1+165*a2+164*a3+163*a4+162*a5+161*a6+160*a7+159*a8+158*a9+157*a10+156*a11+155*a12+154*a13+153*a14+152*a15+151*a16+150*a17+149*a18+148*a19+147*a20+146*a21+145*a22+144*a23+143*a24+142*a25+141*a26+140*a27+139*a28+138*a29+137*a30+136*a31+135*a32+134*a33+133*a34+132*a35+131*a36+130*a37+129*a38+128*a39+127*a40+126*a41+125*a42+124*a43+123*a44+122*a45+121*a46+120*a47+119*a48+118*a49+117*a50+116*a51+115*a52+114*a53+113*a54+112*a55+111*a56+110*a57+109*a58+108*a59+107*a60+106*a61+105*a62+104*a63+103*a64+102*a65+101*a66+100*a67+99*a68+98*a69+97*a70+96*a71+95*a72+94*a73+93*a74+92*a75+91*a76+90*a77+89*a78+88*a79+87*a80+86*a81+85*a82+84*a83+83*a84+82*a85+81*a86+80*a87+79*a88+78*a89+77*a90+76*a91+75*a92+74*a93+73*a94+72*a95+71*a96+70*a97+69*a98+68*a99+67*a100+66*a101+65*a102+64*a103+63*a104+62*a105+61*a106+60*a107+59*a108+58*a109+57*a110+56*a111+55*a112+54*a113+53*a114+52*a115+51*a116+50*a117+49*a118+48*a119+47*a120+46*a121+45*a122+44*a123+43*a124+42*a125+41*a126+40*a127+39*a128+38*a129+37*a130+36*a131+35*a132+34*a133+33*a134+32*a135+31*a136+30*a137+29*a138+28*a139+27*a140+26*a141+25*a142+24*a143+23*a144+22*a145+21*a146+20*a147+19*a148+18*a149+17*a150+16*a151+15*a152+14*a153+13*a154+12*a155+11*a156+10*a157+9*a158+8*a159+7*a160+6*a161+5*a162+4*a163+3*a164+2*a165+1*a166)
-#define PP_CSUM_167(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167) (167*a1+166*a2+165*a3+164*a4+163*a5+162*a6+161*a7+160*a8+159*a9+158*a10+157*a11+156*a12+155*a13+154*a14+153*a15+152*a16+151*a17+150*a18+149*a19+148*a20+147*a21+146*a22+145*a23+144*a24+143*a25+142*a26+141*a27+140*a28+139*a29+138*a30+137*a31+136*a32+135*a33+134*a34+133*a35+132*a36+131*a37+130*a38+129*a39+128*a40+127*a41+126*a42+125*a43+124*a44+123*a45+122*a46+121*a47+120*a48+119*a49+118*a50+117*a51+116*a52+115*a53+114*a54+113*a55+112*a56+111*a57+110*a58+109*a59+108*a60+107*a61+106*a62+105*a63+104*a64+103*a65+102*a66+101*a67+100*a68+99*a69+98*a70+97*a71+96*a72+95*a73+94*a74+93*a75+92*a76+91*a77+90*a78+89*a79+88*a80+87*a81+86*a82+85*a83+84*a84+83*a85+82*a86+81*a87+80*a88+79*a89+78*a90+77*a91+76*a92+75*a93+74*a94+73*a95+72*a96+71*a97+70*a98+69*a99+68*a100+67*a101+66*a102+65*a103+64*a104+63*a105+62*a106+61*a107+60*a108+59*a109+58*a110+57*a111+56*a112+55*a113+54*a114+53*a115+52*a116+51*a117+50*a118+49*a119+48*a120+47*a121+46*a122+45*a123+44*a124+43*a125+42*a126+41*a127+40*a128+39*a129+38*a130+37*a131+36*a132+35*a133+34*a134+33*a135+32*a136+31*a137+30*a138+29*a139+28*a140+27*a141+26*a142+25*a143+24*a144+23*a145+22*a146+21*a147+20*a148+19*a149+18*a150+17*a151+16*a152+15*a153+14*a154+13*a155+12*a156+11*a157+10*a158+9*a159+8*a160+7*a161+6*a162+5*a163+4*a164+3*a165+2*a166+1*a167)
-#define PP_CSUM_168(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168) (168*a1+167*a2+166*a3+165*a4+164*a5+163*a6+162*a7+161*a8+160*a9+159*a10+158*a11+157*a12+156*a13+155*a14+154*a15+153*a16+152*a17+151*a18+150*a19+149*a20+148*a21+147*a22+146*a23+145*a24+144*a25+143*a26+142*a27+141*a28+140*a29+139*a30+138*a31+137*a32+136*a33+135*a34+134*a35+133*a36+132*a37+131*a38+130*a39+129*a40+128*a41+127*a42+126*a43+125*a44+124*a45+123*a46+122*a47+121*a48+120*a49+119*a50+118*a51+117*a52+116*a53+115*a54+114*a55+113*a56+112*a57+111*a58+110*a59+109*a60+108*a61+107*a62+106*a63+105*a64+104*a65+103*a66+102*a67+101*a68+100*a69+99*a70+98*a71+97*a72+96*a73+95*a74+94*a75+93*a76+92*a77+91*a78+90*a79+89*a80+88*a81+87*a82+86*a83+85*a84+84*a85+83*a86+82*a87+81*a88+80*a89+79*a90+78*a91+77*a92+76*a93+75*a94+74*a95+73*a96+72*a97+71*a98+70*a99+69*a100+68*a101+67*a102+66*a103+65*a104+64*a105+63*a106+62*a107+61*a108+60*a109+59*a110+58*a111+57*a112+56*a113+55*a114+54*a115+53*a116+52*a117+51*a118+50*a119+49*a120+48*a121+47*a122+46*a123+45*a124+44*a125+43*a126+42*a127+41*a128+40*a129+39*a130+38*a131+37*a132+36*a133+35*a134+34*a135+33*a136+32*a137+31*a138+30*a139+29*a140+28*a141+27*a142+26*a143+25*a144+24*a145+23*a146+22*a147+21*a148+20*a149+19*a150+18*a151+17*a152+16*a153+15*a154+14*a155+13*a156+12*a157+11*a158+10*a159+9*a160+8*a161+7*a162+6*a163+5*a164+4*a165+3*a166+2*a167+1*a168)
-#define PP_CSUM_169(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169) (169*a1+168*a2+167*a3+166*a4+165*a5+164*a6+163*a7+162*a8+161*a9+160*a10+159*a11+158*a12+157*a13+156*a14+155*a15+154*a16+153*a17+152*a18+151*a19+150*a20+149*a21+148*a22+147*a23+146*a24+145*a25+144*a26+143*a27+142*a28+141*a29+140*a30+139*a31+138*a32+137*a33+136*a34+135*a35+134*a36+133*a37+132*a38+131*a39+130*a40+129*a41+128*a42+127*a43+126*a44+125*a45+124*a46+123*a47+122*a48+121*a49+120*a50+119*a51+118*a52+117*a53+116*a54+115*a55+114*a56+113*a57+112*a58+111*a59+110*a60+109*a61+108*a62+107*a63+106*a64+105*a65+104*a66+103*a67+102*a68+101*a69+100*a70+99*a71+98*a72+97*a73+96*a74+95*a75+94*a76+93*a77+92*a78+91*a79+90*a80+89*a81+88*a82+87*a83+86*a84+85*a85+84*a86+83*a87+82*a88+81*a89+80*a90+79*a91+78*a92+77*a93+76*a94+75*a95+74*a96+73*a97+72*a98+71*a99+70*a100+69*a101+68*a102+67*a103+66*a104+65*a105+64*a106+63*a107+62*a108+61*a109+60*a110+59*a111+58*a112+57*a113+56*a114+55*a115+54*a116+53*a117+52*a118+51*a119+50*a120+49*a121+48*a122+47*a123+46*a124+45*a125+44*a126+43*a127+42*a128+41*a129+40*a130+39*a131+38*a132+37*a133+36*a134+35*a135+34*a136+33*a137+32*a138+31*a139+30*a140+29*a141+28*a142+27*a143+26*a144+25*a145+24*a146+23*a147+22*a148+21*a149+20*a150+19*a151+18*a152+17*a153+16*a154+15*a155+14*a156+13*a157+12*a158+11*a159+10*a160+9*a161+8*a162+7*a163+6*a164+5*a165+4*a166+3*a167+2*a168+1*a169)
-#define PP_CSUM_170(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170) (170*a1+169*a2+168*a3+167*a4+166*a5+165*a6+164*a7+163*a8+162*a9+161*a10+160*a11+159*a12+158*a13+157*a14+156*a15+155*a16+154*a17+153*a18+152*a19+151*a20+150*a21+149*a22+148*a23+147*a24+146*a25+145*a26+144*a27+143*a28+142*a29+141*a30+140*a31+139*a32+138*a33+137*a34+136*a35+135*a36+134*a37+133*a38+132*a39+131*a40+130*a41+129*a42+128*a43+127*a44+126*a45+125*a46+124*a47+123*a48+122*a49+121*a50+120*a51+119*a52+118*a53+117*a54+116*a55+115*a56+114*a57+113*a58+112*a59+111*a60+110*a61+109*a62+108*a63+107*a64+106*a65+105*a66+104*a67+103*a68+102*a69+101*a70+100*a71+99*a72+98*a73+97*a74+96*a75+95*a76+94*a77+93*a78+92*a79+91*a80+90*a81+89*a82+88*a83+87*a84+86*a85+85*a86+84*a87+83*a88+82*a89+81*a90+80*a91+79*a92+78*a93+77*a94+76*a95+75*a96+74*a97+73*a98+72*a99+71*a100+70*a101+69*a102+68*a103+67*a104+66*a105+65*a106+64*a107+63*a108+62*a109+61*a110+60*a111+59*a112+58*a113+57*a114+56*a115+55*a116+54*a117+53*a118+52*a119+51*a120+50*a121+49*a122+48*a123+47*a124+46*a125+45*a126+44*a127+43*a128+42*a129+41*a130+40*a131+39*a132+38*a133+37*a134+36*a135+35*a136+34*a137+33*a138+32*a139+31*a140+30*a141+29*a142+28*a143+27*a144+26*a145+25*a146+24*a147+23*a148+22*a149+21*a150+20*a151+19*a152+18*a153+17*a154+16*a155+15*a156+14*a157+13*a158+12*a159+11*a160+10*a161+9*a162+8*a163+7*a164+6*a165+5*a166+4*a167+3*a168+2*a169+1*a170)
-#define PP_CSUM_171(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171) (171*a1+170*a2+169*a3+168*a4+167*a5+166*a6+165*a7+164*a8+163*a9+162*a10+161*a11+160*a12+159*a13+158*a14+157*a15+156*a16+155*a17+154*a18+153*a19+152*a20+151*a21+150*a22+149*a23+148*a24+147*a25+146*a26+145*a27+144*a28+143*a29+142*a30+141*a31+140*a32+139*a33+138*a34+137*a35+136*a36+135*a37+134*a38+133*a39+132*a40+131*a41+130*a42+129*a43+128*a44+127*a45+126*a46+125*a47+124*a48+123*a49+122*a50+121*a51+120*a52+119*a53+118*a54+117*a55+116*a56+115*a57+114*a58+113*a59+112*a60+111*a61+110*a62+109*a63+108*a64+107*a65+106*a66+105*a67+104*a68+103*a69+102*a70+101*a71+100*a72+99*a73+98*a74+97*a75+96*a76+95*a77+94*a78+93*a79+92*a80+91*a81+90*a82+89*a83+88*a84+87*a85+86*a86+85*a87+84*a88+83*a89+82*a90+81*a91+80*a92+79*a93+78*a94+77*a95+76*a96+75*a97+74*a98+73*a99+72*a100+71*a101+70*a102+69*a103+68*a104+67*a105+66*a106+65*a107+64*a108+63*a109+62*a110+61*a111+60*a112+59*a113+58*a114+57*a115+56*a116+55*a117+54*a118+53*a119+52*a120+51*a121+50*a122+49*a123+48*a124+47*a125+46*a126+45*a127+44*a128+43*a129+42*a130+41*a131+40*a132+39*a133+38*a134+37*a135+36*a136+35*a137+34*a138+33*a139+32*a140+31*a141+30*a142+29*a143+28*a144+27*a145+26*a146+25*a147+24*a148+23*a149+22*a150+21*a151+20*a152+19*a153+18*a154+17*a155+16*a156+15*a157+14*a158+13*a159+12*a160+11*a161+10*a162+9*a163+8*a164+7*a165+6*a166+5*a167+4*a168+3*a169+2*a170+1*a171)
-#define PP_CSUM_172(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172) (172*a1+171*a2+170*a3+169*a4+168*a5+167*a6+166*a7+165*a8+164*a9+163*a10+162*a11+161*a12+160*a13+159*a14+158*a15+157*a16+156*a17+155*a18+154*a19+153*a20+152*a21+151*a22+150*a23+149*a24+148*a25+147*a26+146*a27+145*a28+144*a29+143*a30+142*a31+141*a32+140*a33+139*a34+138*a35+137*a36+136*a37+135*a38+134*a39+133*a40+132*a41+131*a42+130*a43+129*a44+128*a45+127*a46+126*a47+125*a48+124*a49+123*a50+122*a51+121*a52+120*a53+119*a54+118*a55+117*a56+116*a57+115*a58+114*a59+113*a60+112*a61+111*a62+110*a63+109*a64+108*a65+107*a66+106*a67+105*a68+104*a69+103*a70+102*a71+101*a72+100*a73+99*a74+98*a75+97*a76+96*a77+95*a78+94*a79+93*a80+92*a81+91*a82+90*a83+89*a84+88*a85+87*a86+86*a87+85*a88+84*a89+83*a90+82*a91+81*a92+80*a93+79*a94+78*a95+77*a96+76*a97+75*a98+74*a99+73*a100+72*a101+71*a102+70*a103+69*a104+68*a105+67*a106+66*a107+65*a108+64*a109+63*a110+62*a111+61*a112+60*a113+59*a114+58*a115+57*a116+56*a117+55*a118+54*a119+53*a120+52*a121+51*a122+50*a123+49*a124+48*a125+47*a126+46*a127+45*a128+44*a129+43*a130+42*a131+41*a132+40*a133+39*a134+38*a135+37*a136+36*a137+35*a138+34*a139+33*a140+32*a141+31*a142+30*a143+29*a144+28*a145+27*a146+26*a147+25*a148+24*a149+23*a150+22*a151+21*a152+20*a153+19*a154+18*a155+17*a156+16*a157+15*a158+14*a159+13*a160+12*a161+11*a162+10*a163+9*a164+8*a165+7*a166+6*a167+5*a168+4*a169+3*a170+2*a171+1*a172)
-#define PP_CSUM_173(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173) (173*a1+172*a2+171*a3+170*a4+169*a5+168*a6+167*a7+166*a8+165*a9+164*a10+163*a11+162*a12+161*a13+160*a14+159*a15+158*a16+157*a17+156*a18+155*a19+154*a20+153*a21+152*a22+151*a23+150*a24+149*a25+148*a26+147*a27+146*a28+145*a29+144*a30+143*a31+142*a32+141*a33+140*a34+139*a35+138*a36+137*a37+136*a38+135*a39+134*a40+133*a41+132*a42+131*a43+130*a44+129*a45+128*a46+127*a47+126*a48+125*a49+124*a50+123*a51+122*a52+121*a53+120*a54+119*a55+118*a56+117*a57+116*a58+115*a59+114*a60+113*a61+112*a62+111*a63+110*a64+109*a65+108*a66+107*a67+106*a68+105*a69+104*a70+103*a71+102*a72+101*a73+100*a74+99*a75+98*a76+97*a77+96*a78+95*a79+94*a80+93*a81+92*a82+91*a83+90*a84+89*a85+88*a86+87*a87+86*a88+85*a89+84*a90+83*a91+82*a92+81*a93+80*a94+79*a95+78*a96+77*a97+76*a98+75*a99+74*a100+73*a101+72*a102+71*a103+70*a104+69*a105+68*a106+67*a107+66*a108+65*a109+64*a110+63*a111+62*a112+61*a113+60*a114+59*a115+58*a116+57*a117+56*a118+55*a119+54*a120+53*a121+52*a122+51*a123+50*a124+49*a125+48*a126+47*a127+46*a128+45*a129+44*a130+43*a131+42*a132+41*a133+40*a134+39*a135+38*a136+37*a137+36*a138+35*a139+34*a140+33*a141+32*a142+31*a143+30*a144+29*a145+28*a146+27*a147+26*a148+25*a149+24*a150+23*a151+22*a152+21*a153+20*a154+19*a155+18*a156+17*a157+16*a158+15*a159+14*a160+13*a161+12*a162+11*a163+10*a164+9*a165+8*a166+7*a167+6*a168+5*a169+4*a170+3*a171+2*a172+1*a173)
-#define PP_CSUM_174(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174) (174*a1+173*a2+172*a3+171*a4+170*a5+169*a6+168*a7+167*a8+166*a9+165*a10+164*a11+163*a12+162*a13+161*a14+160*a15+159*a16+158*a17+157*a18+156*a19+155*a20+154*a21+153*a22+152*a23+151*a24+150*a25+149*a26+148*a27+147*a28+146*a29+145*a30+144*a31+143*a32+142*a33+141*a34+140*a35+139*a36+138*a37+137*a38+136*a39+135*a40+134*a41+133*a42+132*a43+131*a44+130*a45+129*a46+128*a47+127*a48+126*a49+125*a50+124*a51+123*a52+122*a53+121*a54+120*a55+119*a56+118*a57+117*a58+116*a59+115*a60+114*a61+113*a62+112*a63+111*a64+110*a65+109*a66+108*a67+107*a68+106*a69+105*a70+104*a71+103*a72+102*a73+101*a74+100*a75+99*a76+98*a77+97*a78+96*a79+95*a80+94*a81+93*a82+92*a83+91*a84+90*a85+89*a86+88*a87+87*a88+86*a89+85*a90+84*a91+83*a92+82*a93+81*a94+80*a95+79*a96+78*a97+77*a98+76*a99+75*a100+74*a101+73*a102+72*a103+71*a104+70*a105+69*a106+68*a107+67*a108+66*a109+65*a110+64*a111+63*a112+62*a113+61*a114+60*a115+59*a116+58*a117+57*a118+56*a119+55*a120+54*a121+53*a122+52*a123+51*a124+50*a125+49*a126+48*a127+47*a128+46*a129+45*a130+44*a131+43*a132+42*a133+41*a134+40*a135+39*a136+38*a137+37*a138+36*a139+35*a140+34*a141+33*a142+32*a143+31*a144+30*a145+29*a146+28*a147+27*a148+26*a149+25*a150+24*a151+23*a152+22*a153+21*a154+20*a155+19*a156+18*a157+17*a158+16*a159+15*a160+14*a161+13*a162+12*a163+11*a164+10*a165+9*a166+8*a167+7*a168+6*a169+5*a170+4*a171+3*a172+2*a173+1*a174)
-#define PP_CSUM_175(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175) (175*a1+174*a2+173*a3+172*a4+171*a5+170*a6+169*a7+168*a8+167*a9+166*a10+165*a11+164*a12+163*a13+162*a14+161*a15+160*a16+159*a17+158*a18+157*a19+156*a20+155*a21+154*a22+153*a23+152*a24+151*a25+150*a26+149*a27+148*a28+147*a29+146*a30+145*a31+144*a32+143*a33+142*a34+141*a35+140*a36+139*a37+138*a38+137*a39+136*a40+135*a41+134*a42+133*a43+132*a44+131*a45+130*a46+129*a47+128*a48+127*a49+126*a50+125*a51+124*a52+123*a53+122*a54+121*a55+120*a56+119*a57+118*a58+117*a59+116*a60+115*a61+114*a62+113*a63+112*a64+111*a65+110*a66+109*a67+108*a68+107*a69+106*a70+105*a71+104*a72+103*a73+102*a74+101*a75+100*a76+99*a77+98*a78+97*a79+96*a80+95*a81+94*a82+93*a83+92*a84+91*a85+90*a86+89*a87+88*a88+87*a89+86*a90+85*a91+84*a92+83*a93+82*a94+81*a95+80*a96+79*a97+78*a98+77*a99+76*a100+75*a101+74*a102+73*a103+72*a104+71*a105+70*a106+69*a107+68*a108+67*a109+66*a110+65*a111+64*a112+63*a113+62*a114+61*a115+60*a116+59*a117+58*a118+57*a119+56*a120+55*a121+54*a122+53*a123+52*a124+51*a125+50*a126+49*a127+48*a128+47*a129+46*a130+45*a131+44*a132+43*a133+42*a134+41*a135+40*a136+39*a137+38*a138+37*a139+36*a140+35*a141+34*a142+33*a143+32*a144+31*a145+30*a146+29*a147+28*a148+27*a149+26*a150+25*a151+24*a152+23*a153+22*a154+21*a155+20*a156+19*a157+18*a158+17*a159+16*a160+15*a161+14*a162+13*a163+12*a164+11*a165+10*a166+9*a167+8*a168+7*a169+6*a170+5*a171+4*a172+3*a173+2*a174+1*a175)
-#define PP_CSUM_176(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176) (176*a1+175*a2+174*a3+173*a4+172*a5+171*a6+170*a7+169*a8+168*a9+167*a10+166*a11+165*a12+164*a13+163*a14+162*a15+161*a16+160*a17+159*a18+158*a19+157*a20+156*a21+155*a22+154*a23+153*a24+152*a25+151*a26+150*a27+149*a28+148*a29+147*a30+146*a31+145*a32+144*a33+143*a34+142*a35+141*a36+140*a37+139*a38+138*a39+137*a40+136*a41+135*a42+134*a43+133*a44+132*a45+131*a46+130*a47+129*a48+128*a49+127*a50+126*a51+125*a52+124*a53+123*a54+122*a55+121*a56+120*a57+119*a58+118*a59+117*a60+116*a61+115*a62+114*a63+113*a64+112*a65+111*a66+110*a67+109*a68+108*a69+107*a70+106*a71+105*a72+104*a73+103*a74+102*a75+101*a76+100*a77+99*a78+98*a79+97*a80+96*a81+95*a82+94*a83+93*a84+92*a85+91*a86+90*a87+89*a88+88*a89+87*a90+86*a91+85*a92+84*a93+83*a94+82*a95+81*a96+80*a97+79*a98+78*a99+77*a100+76*a101+75*a102+74*a103+73*a104+72*a105+71*a106+70*a107+69*a108+68*a109+67*a110+66*a111+65*a112+64*a113+63*a114+62*a115+61*a116+60*a117+59*a118+58*a119+57*a120+56*a121+55*a122+54*a123+53*a124+52*a125+51*a126+50*a127+49*a128+48*a129+47*a130+46*a131+45*a132+44*a133+43*a134+42*a135+41*a136+40*a137+39*a138+38*a139+37*a140+36*a141+35*a142+34*a143+33*a144+32*a145+31*a146+30*a147+29*a148+28*a149+27*a150+26*a151+25*a152+24*a153+23*a154+22*a155+21*a156+20*a157+19*a158+18*a159+17*a160+16*a161+15*a162+14*a163+13*a164+12*a165+11*a166+10*a167+9*a168+8*a169+7*a170+6*a171+5*a172+4*a173+3*a174+2*a175+1*a176)
-#define PP_CSUM_177(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177) (177*a1+176*a2+175*a3+174*a4+173*a5+172*a6+171*a7+170*a8+169*a9+168*a10+167*a11+166*a12+165*a13+164*a14+163*a15+162*a16+161*a17+160*a18+159*a19+158*a20+157*a21+156*a22+155*a23+154*a24+153*a25+152*a26+151*a27+150*a28+149*a29+148*a30+147*a31+146*a32+145*a33+144*a34+143*a35+142*a36+141*a37+140*a38+139*a39+138*a40+137*a41+136*a42+135*a43+134*a44+133*a45+132*a46+131*a47+130*a48+129*a49+128*a50+127*a51+126*a52+125*a53+124*a54+123*a55+122*a56+121*a57+120*a58+119*a59+118*a60+117*a61+116*a62+115*a63+114*a64+113*a65+112*a66+111*a67+110*a68+109*a69+108*a70+107*a71+106*a72+105*a73+104*a74+103*a75+102*a76+101*a77+100*a78+99*a79+98*a80+97*a81+96*a82+95*a83+94*a84+93*a85+92*a86+91*a87+90*a88+89*a89+88*a90+87*a91+86*a92+85*a93+84*a94+83*a95+82*a96+81*a97+80*a98+79*a99+78*a100+77*a101+76*a102+75*a103+74*a104+73*a105+72*a106+71*a107+70*a108+69*a109+68*a110+67*a111+66*a112+65*a113+64*a114+63*a115+62*a116+61*a117+60*a118+59*a119+58*a120+57*a121+56*a122+55*a123+54*a124+53*a125+52*a126+51*a127+50*a128+49*a129+48*a130+47*a131+46*a132+45*a133+44*a134+43*a135+42*a136+41*a137+40*a138+39*a139+38*a140+37*a141+36*a142+35*a143+34*a144+33*a145+32*a146+31*a147+30*a148+29*a149+28*a150+27*a151+26*a152+25*a153+24*a154+23*a155+22*a156+21*a157+20*a158+19*a159+18*a160+17*a161+16*a162+15*a163+14*a164+13*a165+12*a166+11*a167+10*a168+9*a169+8*a170+7*a171+6*a172+5*a173+4*a174+3*a175+2*a176+1*a177)
-#define PP_CSUM_178(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178) (178*a1+177*a2+176*a3+175*a4+174*a5+173*a6+172*a7+171*a8+170*a9+169*a10+168*a11+167*a12+166*a13+165*a14+164*a15+163*a16+162*a17+161*a18+160*a19+159*a20+158*a21+157*a22+156*a23+155*a24+154*a25+153*a26+152*a27+151*a28+150*a29+149*a30+148*a31+147*a32+146*a33+145*a34+144*a35+143*a36+142*a37+141*a38+140*a39+139*a40+138*a41+137*a42+136*a43+135*a44+134*a45+133*a46+132*a47+131*a48+130*a49+129*a50+128*a51+127*a52+126*a53+125*a54+124*a55+123*a56+122*a57+121*a58+120*a59+119*a60+118*a61+117*a62+116*a63+115*a64+114*a65+113*a66+112*a67+111*a68+110*a69+109*a70+108*a71+107*a72+106*a73+105*a74+104*a75+103*a76+102*a77+101*a78+100*a79+99*a80+98*a81+97*a82+96*a83+95*a84+94*a85+93*a86+92*a87+91*a88+90*a89+89*a90+88*a91+87*a92+86*a93+85*a94+84*a95+83*a96+82*a97+81*a98+80*a99+79*a100+78*a101+77*a102+76*a103+75*a104+74*a105+73*a106+72*a107+71*a108+70*a109+69*a110+68*a111+67*a112+66*a113+65*a114+64*a115+63*a116+62*a117+61*a118+60*a119+59*a120+58*a121+57*a122+56*a123+55*a124+54*a125+53*a126+52*a127+51*a128+50*a129+49*a130+48*a131+47*a132+46*a133+45*a134+44*a135+43*a136+42*a137+41*a138+40*a139+39*a140+38*a141+37*a142+36*a143+35*a144+34*a145+33*a146+32*a147+31*a148+30*a149+29*a150+28*a151+27*a152+26*a153+25*a154+24*a155+23*a156+22*a157+21*a158+20*a159+19*a160+18*a161+17*a162+16*a163+15*a164+14*a165+13*a166+12*a167+11*a168+10*a169+9*a170+8*a171+7*a172+6*a173+5*a174+4*a175+3*a176+2*a177+1*a178)
-#define PP_CSUM_179(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179) (179*a1+178*a2+177*a3+176*a4+175*a5+174*a6+173*a7+172*a8+171*a9+170*a10+169*a11+168*a12+167*a13+166*a14+165*a15+164*a16+163*a17+162*a18+161*a19+160*a20+159*a21+158*a22+157*a23+156*a24+155*a25+154*a26+153*a27+152*a28+151*a29+150*a30+149*a31+148*a32+147*a33+146*a34+145*a35+144*a36+143*a37+142*a38+141*a39+140*a40+139*a41+138*a42+137*a43+136*a44+135*a45+134*a46+133*a47+132*a48+131*a49+130*a50+129*a51+128*a52+127*a53+126*a54+125*a55+124*a56+123*a57+122*a58+121*a59+120*a60+119*a61+118*a62+117*a63+116*a64+115*a65+114*a66+113*a67+112*a68+111*a69+110*a70+109*a71+108*a72+107*a73+106*a74+105*a75+104*a76+103*a77+102*a78+101*a79+100*a80+99*a81+98*a82+97*a83+96*a84+95*a85+94*a86+93*a87+92*a88+91*a89+90*a90+89*a91+88*a92+87*a93+86*a94+85*a95+84*a96+83*a97+82*a98+81*a99+80*a100+79*a101+78*a102+77*a103+76*a104+75*a105+74*a106+73*a107+72*a108+71*a109+70*a110+69*a111+68*a112+67*a113+66*a114+65*a115+64*a116+63*a117+62*a118+61*a119+60*a120+59*a121+58*a122+57*a123+56*a124+55*a125+54*a126+53*a127+52*a128+51*a129+50*a130+49*a131+48*a132+47*a133+46*a134+45*a135+44*a136+43*a137+42*a138+41*a139+40*a140+39*a141+38*a142+37*a143+36*a144+35*a145+34*a146+33*a147+32*a148+31*a149+30*a150+29*a151+28*a152+27*a153+26*a154+25*a155+24*a156+23*a157+22*a158+21*a159+20*a160+19*a161+18*a162+17*a163+16*a164+15*a165+14*a166+13*a167+12*a168+11*a169+10*a170+9*a171+8*a172+7*a173+6*a174+5*a175+4*a176+3*a177+2*a178+1*a179)
-#define PP_CSUM_180(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180) (180*a1+179*a2+178*a3+177*a4+176*a5+175*a6+174*a7+173*a8+172*a9+171*a10+170*a11+169*a12+168*a13+167*a14+166*a15+165*a16+164*a17+163*a18+162*a19+161*a20+160*a21+159*a22+158*a23+157*a24+156*a25+155*a26+154*a27+153*a28+152*a29+151*a30+150*a31+149*a32+148*a33+147*a34+146*a35+145*a36+144*a37+143*a38+142*a39+141*a40+140*a41+139*a42+138*a43+137*a44+136*a45+135*a46+134*a47+133*a48+132*a49+131*a50+130*a51+129*a52+128*a53+127*a54+126*a55+125*a56+124*a57+123*a58+122*a59+121*a60+120*a61+119*a62+118*a63+117*a64+116*a65+115*a66+114*a67+113*a68+112*a69+111*a70+110*a71+109*a72+108*a73+107*a74+106*a75+105*a76+104*a77+103*a78+102*a79+101*a80+100*a81+99*a82+98*a83+97*a84+96*a85+95*a86+94*a87+93*a88+92*a89+91*a90+90*a91+89*a92+88*a93+87*a94+86*a95+85*a96+84*a97+83*a98+82*a99+81*a100+80*a101+79*a102+78*a103+77*a104+76*a105+75*a106+74*a107+73*a108+72*a109+71*a110+70*a111+69*a112+68*a113+67*a114+66*a115+65*a116+64*a117+63*a118+62*a119+61*a120+60*a121+59*a122+58*a123+57*a124+56*a125+55*a126+54*a127+53*a128+52*a129+51*a130+50*a131+49*a132+48*a133+47*a134+46*a135+45*a136+44*a137+43*a138+42*a139+41*a140+40*a141+39*a142+38*a143+37*a144+36*a145+35*a146+34*a147+33*a148+32*a149+31*a150+30*a151+29*a152+28*a153+27*a154+26*a155+25*a156+24*a157+23*a158+22*a159+21*a160+20*a161+19*a162+18*a163+17*a164+16*a165+15*a166+14*a167+13*a168+12*a169+11*a170+10*a171+9*a172+8*a173+7*a174+6*a175+5*a176+4*a177+3*a178+2*a179+1*a180)
-#define PP_CSUM_181(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181) (181*a1+180*a2+179*a3+178*a4+177*a5+176*a6+175*a7+174*a8+173*a9+172*a10+171*a11+170*a12+169*a13+168*a14+167*a15+166*a16+165*a17+164*a18+163*a19+162*a20+161*a21+160*a22+159*a23+158*a24+157*a25+156*a26+155*a27+154*a28+153*a29+152*a30+151*a31+150*a32+149*a33+148*a34+147*a35+146*a36+145*a37+144*a38+143*a39+142*a40+141*a41+140*a42+139*a43+138*a44+137*a45+136*a46+135*a47+134*a48+133*a49+132*a50+131*a51+130*a52+129*a53+128*a54+127*a55+126*a56+125*a57+124*a58+123*a59+122*a60+121*a61+120*a62+119*a63+118*a64+117*a65+116*a66+115*a67+114*a68+113*a69+112*a70+111*a71+110*a72+109*a73+108*a74+107*a75+106*a76+105*a77+104*a78+103*a79+102*a80+101*a81+100*a82+99*a83+98*a84+97*a85+96*a86+95*a87+94*a88+93*a89+92*a90+91*a91+90*a92+89*a93+88*a94+87*a95+86*a96+85*a97+84*a98+83*a99+82*a100+81*a101+80*a102+79*a103+78*a104+77*a105+76*a106+75*a107+74*a108+73*a109+72*a110+71*a111+70*a112+69*a113+68*a114+67*a115+66*a116+65*a117+64*a118+63*a119+62*a120+61*a121+60*a122+59*a123+58*a124+57*a125+56*a126+55*a127+54*a128+53*a129+52*a130+51*a131+50*a132+49*a133+48*a134+47*a135+46*a136+45*a137+44*a138+43*a139+42*a140+41*a141+40*a142+39*a143+38*a144+37*a145+36*a146+35*a147+34*a148+33*a149+32*a150+31*a151+30*a152+29*a153+28*a154+27*a155+26*a156+25*a157+24*a158+23*a159+22*a160+21*a161+20*a162+19*a163+18*a164+17*a165+16*a166+15*a167+14*a168+13*a169+12*a170+11*a171+10*a172+9*a173+8*a174+7*a175+6*a176+5*a177+4*a178+3*a179+2*a180+1*a181)
-#define PP_CSUM_182(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182) (182*a1+181*a2+180*a3+179*a4+178*a5+177*a6+176*a7+175*a8+174*a9+173*a10+172*a11+171*a12+170*a13+169*a14+168*a15+167*a16+166*a17+165*a18+164*a19+163*a20+162*a21+161*a22+160*a23+159*a24+158*a25+157*a26+156*a27+155*a28+154*a29+153*a30+152*a31+151*a32+150*a33+149*a34+148*a35+147*a36+146*a37+145*a38+144*a39+143*a40+142*a41+141*a42+140*a43+139*a44+138*a45+137*a46+136*a47+135*a48+134*a49+133*a50+132*a51+131*a52+130*a53+129*a54+128*a55+127*a56+126*a57+125*a58+124*a59+123*a60+122*a61+121*a62+120*a63+119*a64+118*a65+117*a66+116*a67+115*a68+114*a69+113*a70+112*a71+111*a72+110*a73+109*a74+108*a75+107*a76+106*a77+105*a78+104*a79+103*a80+102*a81+101*a82+100*a83+99*a84+98*a85+97*a86+96*a87+95*a88+94*a89+93*a90+92*a91+91*a92+90*a93+89*a94+88*a95+87*a96+86*a97+85*a98+84*a99+83*a100+82*a101+81*a102+80*a103+79*a104+78*a105+77*a106+76*a107+75*a108+74*a109+73*a110+72*a111+71*a112+70*a113+69*a114+68*a115+67*a116+66*a117+65*a118+64*a119+63*a120+62*a121+61*a122+60*a123+59*a124+58*a125+57*a126+56*a127+55*a128+54*a129+53*a130+52*a131+51*a132+50*a133+49*a134+48*a135+47*a136+46*a137+45*a138+44*a139+43*a140+42*a141+41*a142+40*a143+39*a144+38*a145+37*a146+36*a147+35*a148+34*a149+33*a150+32*a151+31*a152+30*a153+29*a154+28*a155+27*a156+26*a157+25*a158+24*a159+23*a160+22*a161+21*a162+20*a163+19*a164+18*a165+17*a166+16*a167+15*a168+14*a169+13*a170+12*a171+11*a172+10*a173+9*a174+8*a175+7*a176+6*a177+5*a178+4*a179+3*a180+2*a181+1*a182)
-#define PP_CSUM_183(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183) (183*a1+182*a2+181*a3+180*a4+179*a5+178*a6+177*a7+176*a8+175*a9+174*a10+173*a11+172*a12+171*a13+170*a14+169*a15+168*a16+167*a17+166*a18+165*a19+164*a20+163*a21+162*a22+161*a23+160*a24+159*a25+158*a26+157*a27+156*a28+155*a29+154*a30+153*a31+152*a32+151*a33+150*a34+149*a35+148*a36+147*a37+146*a38+145*a39+144*a40+143*a41+142*a42+141*a43+140*a44+139*a45+138*a46+137*a47+136*a48+135*a49+134*a50+133*a51+132*a52+131*a53+130*a54+129*a55+128*a56+127*a57+126*a58+125*a59+124*a60+123*a61+122*a62+121*a63+120*a64+119*a65+118*a66+117*a67+116*a68+115*a69+114*a70+113*a71+112*a72+111*a73+110*a74+109*a75+108*a76+107*a77+106*a78+105*a79+104*a80+103*a81+102*a82+101*a83+100*a84+99*a85+98*a86+97*a87+96*a88+95*a89+94*a90+93*a91+92*a92+91*a93+90*a94+89*a95+88*a96+87*a97+86*a98+85*a99+84*a100+83*a101+82*a102+81*a103+80*a104+79*a105+78*a106+77*a107+76*a108+75*a109+74*a110+73*a111+72*a112+71*a113+70*a114+69*a115+68*a116+67*a117+66*a118+65*a119+64*a120+63*a121+62*a122+61*a123+60*a124+59*a125+58*a126+57*a127+56*a128+55*a129+54*a130+53*a131+52*a132+51*a133+50*a134+49*a135+48*a136+47*a137+46*a138+45*a139+44*a140+43*a141+42*a142+41*a143+40*a144+39*a145+38*a146+37*a147+36*a148+35*a149+34*a150+33*a151+32*a152+31*a153+30*a154+29*a155+28*a156+27*a157+26*a158+25*a159+24*a160+23*a161+22*a162+21*a163+20*a164+19*a165+18*a166+17*a167+16*a168+15*a169+14*a170+13*a171+12*a172+11*a173+10*a174+9*a175+8*a176+7*a177+6*a178+5*a179+4*a180+3*a181+2*a182+1*a183)
-#define PP_CSUM_184(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184) (184*a1+183*a2+182*a3+181*a4+180*a5+179*a6+178*a7+177*a8+176*a9+175*a10+174*a11+173*a12+172*a13+171*a14+170*a15+169*a16+168*a17+167*a18+166*a19+165*a20+164*a21+163*a22+162*a23+161*a24+160*a25+159*a26+158*a27+157*a28+156*a29+155*a30+154*a31+153*a32+152*a33+151*a34+150*a35+149*a36+148*a37+147*a38+146*a39+145*a40+144*a41+143*a42+142*a43+141*a44+140*a45+139*a46+138*a47+137*a48+136*a49+135*a50+134*a51+133*a52+132*a53+131*a54+130*a55+129*a56+128*a57+127*a58+126*a59+125*a60+124*a61+123*a62+122*a63+121*a64+120*a65+119*a66+118*a67+117*a68+116*a69+115*a70+114*a71+113*a72+112*a73+111*a74+110*a75+109*a76+108*a77+107*a78+106*a79+105*a80+104*a81+103*a82+102*a83+101*a84+100*a85+99*a86+98*a87+97*a88+96*a89+95*a90+94*a91+93*a92+92*a93+91*a94+90*a95+89*a96+88*a97+87*a98+86*a99+85*a100+84*a101+83*a102+82*a103+81*a104+80*a105+79*a106+78*a107+77*a108+76*a109+75*a110+74*a111+73*a112+72*a113+71*a114+70*a115+69*a116+68*a117+67*a118+66*a119+65*a120+64*a121+63*a122+62*a123+61*a124+60*a125+59*a126+58*a127+57*a128+56*a129+55*a130+54*a131+53*a132+52*a133+51*a134+50*a135+49*a136+48*a137+47*a138+46*a139+45*a140+44*a141+43*a142+42*a143+41*a144+40*a145+39*a146+38*a147+37*a148+36*a149+35*a150+34*a151+33*a152+32*a153+31*a154+30*a155+29*a156+28*a157+27*a158+26*a159+25*a160+24*a161+23*a162+22*a163+21*a164+20*a165+19*a166+18*a167+17*a168+16*a169+15*a170+14*a171+13*a172+12*a173+11*a174+10*a175+9*a176+8*a177+7*a178+6*a179+5*a180+4*a181+3*a182+2*a183+1*a184)
-#define PP_CSUM_185(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185) (185*a1+184*a2+183*a3+182*a4+181*a5+180*a6+179*a7+178*a8+177*a9+176*a10+175*a11+174*a12+173*a13+172*a14+171*a15+170*a16+169*a17+168*a18+167*a19+166*a20+165*a21+164*a22+163*a23+162*a24+161*a25+160*a26+159*a27+158*a28+157*a29+156*a30+155*a31+154*a32+153*a33+152*a34+151*a35+150*a36+149*a37+148*a38+147*a39+146*a40+145*a41+144*a42+143*a43+142*a44+141*a45+140*a46+139*a47+138*a48+137*a49+136*a50+135*a51+134*a52+133*a53+132*a54+131*a55+130*a56+129*a57+128*a58+127*a59+126*a60+125*a61+124*a62+123*a63+122*a64+121*a65+120*a66+119*a67+118*a68+117*a69+116*a70+115*a71+114*a72+113*a73+112*a74+111*a75+110*a76+109*a77+108*a78+107*a79+106*a80+105*a81+104*a82+103*a83+102*a84+101*a85+100*a86+99*a87+98*a88+97*a89+96*a90+95*a91+94*a92+93*a93+92*a94+91*a95+90*a96+89*a97+88*a98+87*a99+86*a100+85*a101+84*a102+83*a103+82*a104+81*a105+80*a106+79*a107+78*a108+77*a109+76*a110+75*a111+74*a112+73*a113+72*a114+71*a115+70*a116+69*a117+68*a118+67*a119+66*a120+65*a121+64*a122+63*a123+62*a124+61*a125+60*a126+59*a127+58*a128+57*a129+56*a130+55*a131+54*a132+53*a133+52*a134+51*a135+50*a136+49*a137+48*a138+47*a139+46*a140+45*a141+44*a142+43*a143+42*a144+41*a145+40*a146+39*a147+38*a148+37*a149+36*a150+35*a151+34*a152+33*a153+32*a154+31*a155+30*a156+29*a157+28*a158+27*a159+26*a160+25*a161+24*a162+23*a163+22*a164+21*a165+20*a166+19*a167+18*a168+17*a169+16*a170+15*a171+14*a172+13*a173+12*a174+11*a175+10*a176+9*a177+8*a178+7*a179+6*a180+5*a181+4*a182+3*a183+2*a184+1*a185)
-#define PP_CSUM_186(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186) (186*a1+185*a2+184*a3+183*a4+182*a5+181*a6+180*a7+179*a8+178*a9+177*a10+176*a11+175*a12+174*a13+173*a14+172*a15+171*a16+170*a17+169*a18+168*a19+167*a20+166*a21+165*a22+164*a23+163*a24+162*a25+161*a26+160*a27+159*a28+158*a29+157*a30+156*a31+155*a32+154*a33+153*a34+152*a35+151*a36+150*a37+149*a38+148*a39+147*a40+146*a41+145*a42+144*a43+143*a44+142*a45+141*a46+140*a47+139*a48+138*a49+137*a50+136*a51+135*a52+134*a53+133*a54+132*a55+131*a56+130*a57+129*a58+128*a59+127*a60+126*a61+125*a62+124*a63+123*a64+122*a65+121*a66+120*a67+119*a68+118*a69+117*a70+116*a71+115*a72+114*a73+113*a74+112*a75+111*a76+110*a77+109*a78+108*a79+107*a80+106*a81+105*a82+104*a83+103*a84+102*a85+101*a86+100*a87+99*a88+98*a89+97*a90+96*a91+95*a92+94*a93+93*a94+92*a95+91*a96+90*a97+89*a98+88*a99+87*a100+86*a101+85*a102+84*a103+83*a104+82*a105+81*a106+80*a107+79*a108+78*a109+77*a110+76*a111+75*a112+74*a113+73*a114+72*a115+71*a116+70*a117+69*a118+68*a119+67*a120+66*a121+65*a122+64*a123+63*a124+62*a125+61*a126+60*a127+59*a128+58*a129+57*a130+56*a131+55*a132+54*a133+53*a134+52*a135+51*a136+50*a137+49*a138+48*a139+47*a140+46*a141+45*a142+44*a143+43*a144+42*a145+41*a146+40*a147+39*a148+38*a149+37*a150+36*a151+35*a152+34*a153+33*a154+32*a155+31*a156+30*a157+29*a158+28*a159+27*a160+26*a161+25*a162+24*a163+23*a164+22*a165+21*a166+20*a167+19*a168+18*a169+17*a170+16*a171+15*a172+14*a173+13*a174+12*a175+11*a176+10*a177+9*a178+8*a179+7*a180+6*a181+5*a182+4*a183+3*a184+2*a185+1*a186)
-#define PP_CSUM_187(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187) (187*a1+186*a2+185*a3+184*a4+183*a5+182*a6+181*a7+180*a8+179*a9+178*a10+177*a11+176*a12+175*a13+174*a14+173*a15+172*a16+171*a17+170*a18+169*a19+168*a20+167*a21+166*a22+165*a23+164*a24+163*a25+162*a26+161*a27+160*a28+159*a29+158*a30+157*a31+156*a32+155*a33+154*a34+153*a35+152*a36+151*a37+150*a38+149*a39+148*a40+147*a41+146*a42+145*a43+144*a44+143*a45+142*a46+141*a47+140*a48+139*a49+138*a50+137*a51+136*a52+135*a53+134*a54+133*a55+132*a56+131*a57+130*a58+129*a59+128*a60+127*a61+126*a62+125*a63+124*a64+123*a65+122*a66+121*a67+120*a68+119*a69+118*a70+117*a71+116*a72+115*a73+114*a74+113*a75+112*a76+111*a77+110*a78+109*a79+108*a80+107*a81+106*a82+105*a83+104*a84+103*a85+102*a86+101*a87+100*a88+99*a89+98*a90+97*a91+96*a92+95*a93+94*a94+93*a95+92*a96+91*a97+90*a98+89*a99+88*a100+87*a101+86*a102+85*a103+84*a104+83*a105+82*a106+81*a107+80*a108+79*a109+78*a110+77*a111+76*a112+75*a113+74*a114+73*a115+72*a116+71*a117+70*a118+69*a119+68*a120+67*a121+66*a122+65*a123+64*a124+63*a125+62*a126+61*a127+60*a128+59*a129+58*a130+57*a131+56*a132+55*a133+54*a134+53*a135+52*a136+51*a137+50*a138+49*a139+48*a140+47*a141+46*a142+45*a143+44*a144+43*a145+42*a146+41*a147+40*a148+39*a149+38*a150+37*a151+36*a152+35*a153+34*a154+33*a155+32*a156+31*a157+30*a158+29*a159+28*a160+27*a161+26*a162+25*a163+24*a164+23*a165+22*a166+21*a167+20*a168+19*a169+18*a170+17*a171+16*a172+15*a173+14*a174+13*a175+12*a176+11*a177+10*a178+9*a179+8*a180+7*a181+6*a182+5*a183+4*a184+3*a185+2*a186+1*a187)
-#define PP_CSUM_188(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188) (188*a1+187*a2+186*a3+185*a4+184*a5+183*a6+182*a7+181*a8+180*a9+179*a10+178*a11+177*a12+176*a13+175*a14+174*a15+173*a16+172*a17+171*a18+170*a19+169*a20+168*a21+167*a22+166*a23+165*a24+164*a25+163*a26+162*a27+161*a28+160*a29+159*a30+158*a31+157*a32+156*a33+155*a34+154*a35+153*a36+152*a37+151*a38+150*a39+149*a40+148*a41+147*a42+146*a43+145*a44+144*a45+143*a46+142*a47+141*a48+140*a49+139*a50+138*a51+137*a52+136*a53+135*a54+134*a55+133*a56+132*a57+131*a58+130*a59+129*a60+128*a61+127*a62+126*a63+125*a64+124*a65+123*a66+122*a67+121*a68+120*a69+119*a70+118*a71+117*a72+116*a73+115*a74+114*a75+113*a76+112*a77+111*a78+110*a79+109*a80+108*a81+107*a82+106*a83+105*a84+104*a85+103*a86+102*a87+101*a88+100*a89+99*a90+98*a91+97*a92+96*a93+95*a94+94*a95+93*a96+92*a97+91*a98+90*a99+89*a100+88*a101+87*a102+86*a103+85*a104+84*a105+83*a106+82*a107+81*a108+80*a109+79*a110+78*a111+77*a112+76*a113+75*a114+74*a115+73*a116+72*a117+71*a118+70*a119+69*a120+68*a121+67*a122+66*a123+65*a124+64*a125+63*a126+62*a127+61*a128+60*a129+59*a130+58*a131+57*a132+56*a133+55*a134+54*a135+53*a136+52*a137+51*a138+50*a139+49*a140+48*a141+47*a142+46*a143+45*a144+44*a145+43*a146+42*a147+41*a148+40*a149+39*a150+38*a151+37*a152+36*a153+35*a154+34*a155+33*a156+32*a157+31*a158+30*a159+29*a160+28*a161+27*a162+26*a163+25*a164+24*a165+23*a166+22*a167+21*a168+20*a169+19*a170+18*a171+17*a172+16*a173+15*a174+14*a175+13*a176+12*a177+11*a178+10*a179+9*a180+8*a181+7*a182+6*a183+5*a184+4*a185+3*a186+2*a187+1*a188)
-#define PP_CSUM_189(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189) (189*a1+188*a2+187*a3+186*a4+185*a5+184*a6+183*a7+182*a8+181*a9+180*a10+179*a11+178*a12+177*a13+176*a14+175*a15+174*a16+173*a17+172*a18+171*a19+170*a20+169*a21+168*a22+167*a23+166*a24+165*a25+164*a26+163*a27+162*a28+161*a29+160*a30+159*a31+158*a32+157*a33+156*a34+155*a35+154*a36+153*a37+152*a38+151*a39+150*a40+149*a41+148*a42+147*a43+146*a44+145*a45+144*a46+143*a47+142*a48+141*a49+140*a50+139*a51+138*a52+137*a53+136*a54+135*a55+134*a56+133*a57+132*a58+131*a59+130*a60+129*a61+128*a62+127*a63+126*a64+125*a65+124*a66+123*a67+122*a68+121*a69+120*a70+119*a71+118*a72+117*a73+116*a74+115*a75+114*a76+113*a77+112*a78+111*a79+110*a80+109*a81+108*a82+107*a83+106*a84+105*a85+104*a86+103*a87+102*a88+101*a89+100*a90+99*a91+98*a92+97*a93+96*a94+95*a95+94*a96+93*a97+92*a98+91*a99+90*a100+89*a101+88*a102+87*a103+86*a104+85*a105+84*a106+83*a107+82*a108+81*a109+80*a110+79*a111+78*a112+77*a113+76*a114+75*a115+74*a116+73*a117+72*a118+71*a119+70*a120+69*a121+68*a122+67*a123+66*a124+65*a125+64*a126+63*a127+62*a128+61*a129+60*a130+59*a131+58*a132+57*a133+56*a134+55*a135+54*a136+53*a137+52*a138+51*a139+50*a140+49*a141+48*a142+47*a143+46*a144+45*a145+44*a146+43*a147+42*a148+41*a149+40*a150+39*a151+38*a152+37*a153+36*a154+35*a155+34*a156+33*a157+32*a158+31*a159+30*a160+29*a161+28*a162+27*a163+26*a164+25*a165+24*a166+23*a167+22*a168+21*a169+20*a170+19*a171+18*a172+17*a173+16*a174+15*a175+14*a176+13*a177+12*a178+11*a179+10*a180+9*a181+8*a182+7*a183+6*a184+5*a185+4*a186+3*a187+2*a188+1*a189)
-#define PP_CSUM_190(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190) (190*a1+189*a2+188*a3+187*a4+186*a5+185*a6+184*a7+183*a8+182*a9+181*a10+180*a11+179*a12+178*a13+177*a14+176*a15+175*a16+174*a17+173*a18+172*a19+171*a20+170*a21+169*a22+168*a23+167*a24+166*a25+165*a26+164*a27+163*a28+162*a29+161*a30+160*a31+159*a32+158*a33+157*a34+156*a35+155*a36+154*a37+153*a38+152*a39+151*a40+150*a41+149*a42+148*a43+147*a44+146*a45+145*a46+144*a47+143*a48+142*a49+141*a50+140*a51+139*a52+138*a53+137*a54+136*a55+135*a56+134*a57+133*a58+132*a59+131*a60+130*a61+129*a62+128*a63+127*a64+126*a65+125*a66+124*a67+123*a68+122*a69+121*a70+120*a71+119*a72+118*a73+117*a74+116*a75+115*a76+114*a77+113*a78+112*a79+111*a80+110*a81+109*a82+108*a83+107*a84+106*a85+105*a86+104*a87+103*a88+102*a89+101*a90+100*a91+99*a92+98*a93+97*a94+96*a95+95*a96+94*a97+93*a98+92*a99+91*a100+90*a101+89*a102+88*a103+87*a104+86*a105+85*a106+84*a107+83*a108+82*a109+81*a110+80*a111+79*a112+78*a113+77*a114+76*a115+75*a116+74*a117+73*a118+72*a119+71*a120+70*a121+69*a122+68*a123+67*a124+66*a125+65*a126+64*a127+63*a128+62*a129+61*a130+60*a131+59*a132+58*a133+57*a134+56*a135+55*a136+54*a137+53*a138+52*a139+51*a140+50*a141+49*a142+48*a143+47*a144+46*a145+45*a146+44*a147+43*a148+42*a149+41*a150+40*a151+39*a152+38*a153+37*a154+36*a155+35*a156+34*a157+33*a158+32*a159+31*a160+30*a161+29*a162+28*a163+27*a164+26*a165+25*a166+24*a167+23*a168+22*a169+21*a170+20*a171+19*a172+18*a173+17*a174+16*a175+15*a176+14*a177+13*a178+12*a179+11*a180+10*a181+9*a182+8*a183+7*a184+6*a185+5*a186+4*a187+3*a188+2*a189+1*a190)
-#define PP_CSUM_191(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191) (191*a1+190*a2+189*a3+188*a4+187*a5+186*a6+185*a7+184*a8+183*a9+182*a10+181*a11+180*a12+179*a13+178*a14+177*a15+176*a16+175*a17+174*a18+173*a19+172*a20+171*a21+170*a22+169*a23+168*a24+167*a25+166*a26+165*a27+164*a28+163*a29+162*a30+161*a31+160*a32+159*a33+158*a34+157*a35+156*a36+155*a37+154*a38+153*a39+152*a40+151*a41+150*a42+149*a43+148*a44+147*a45+146*a46+145*a47+144*a48+143*a49+142*a50+141*a51+140*a52+139*a53+138*a54+137*a55+136*a56+135*a57+134*a58+133*a59+132*a60+131*a61+130*a62+129*a63+128*a64+127*a65+126*a66+125*a67+124*a68+123*a69+122*a70+121*a71+120*a72+119*a73+118*a74+117*a75+116*a76+115*a77+114*a78+113*a79+112*a80+111*a81+110*a82+109*a83+108*a84+107*a85+106*a86+105*a87+104*a88+103*a89+102*a90+101*a91+100*a92+99*a93+98*a94+97*a95+96*a96+95*a97+94*a98+93*a99+92*a100+91*a101+90*a102+89*a103+88*a104+87*a105+86*a106+85*a107+84*a108+83*a109+82*a110+81*a111+80*a112+79*a113+78*a114+77*a115+76*a116+75*a117+74*a118+73*a119+72*a120+71*a121+70*a122+69*a123+68*a124+67*a125+66*a126+65*a127+64*a128+63*a129+62*a130+61*a131+60*a132+59*a133+58*a134+57*a135+56*a136+55*a137+54*a138+53*a139+52*a140+51*a141+50*a142+49*a143+48*a144+47*a145+46*a146+45*a147+44*a148+43*a149+42*a150+41*a151+40*a152+39*a153+38*a154+37*a155+36*a156+35*a157+34*a158+33*a159+32*a160+31*a161+30*a162+29*a163+28*a164+27*a165+26*a166+25*a167+24*a168+23*a169+22*a170+21*a171+20*a172+19*a173+18*a174+17*a175+16*a176+15*a177+14*a178+13*a179+12*a180+11*a181+10*a182+9*a183+8*a184+7*a185+6*a186+5*a187+4*a188+3*a189+2*a190+1*a191)
-#define PP_CSUM_192(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192) (192*a1+191*a2+190*a3+189*a4+188*a5+187*a6+186*a7+185*a8+184*a9+183*a10+182*a11+181*a12+180*a13+179*a14+178*a15+177*a16+176*a17+175*a18+174*a19+173*a20+172*a21+171*a22+170*a23+169*a24+168*a25+167*a26+166*a27+165*a28+164*a29+163*a30+162*a31+161*a32+160*a33+159*a34+158*a35+157*a36+156*a37+155*a38+154*a39+153*a40+152*a41+151*a42+150*a43+149*a44+148*a45+147*a46+146*a47+145*a48+144*a49+143*a50+142*a51+141*a52+140*a53+139*a54+138*a55+137*a56+136*a57+135*a58+134*a59+133*a60+132*a61+131*a62+130*a63+129*a64+128*a65+127*a66+126*a67+125*a68+124*a69+123*a70+122*a71+121*a72+120*a73+119*a74+118*a75+117*a76+116*a77+115*a78+114*a79+113*a80+112*a81+111*a82+110*a83+109*a84+108*a85+107*a86+106*a87+105*a88+104*a89+103*a90+102*a91+101*a92+100*a93+99*a94+98*a95+97*a96+96*a97+95*a98+94*a99+93*a100+92*a101+91*a102+90*a103+89*a104+88*a105+87*a106+86*a107+85*a108+84*a109+83*a110+82*a111+81*a112+80*a113+79*a114+78*a115+77*a116+76*a117+75*a118+74*a119+73*a120+72*a121+71*a122+70*a123+69*a124+68*a125+67*a126+66*a127+65*a128+64*a129+63*a130+62*a131+61*a132+60*a133+59*a134+58*a135+57*a136+56*a137+55*a138+54*a139+53*a140+52*a141+51*a142+50*a143+49*a144+48*a145+47*a146+46*a147+45*a148+44*a149+43*a150+42*a151+41*a152+40*a153+39*a154+38*a155+37*a156+36*a157+35*a158+34*a159+33*a160+32*a161+31*a162+30*a163+29*a164+28*a165+27*a166+26*a167+25*a168+24*a169+23*a170+22*a171+21*a172+20*a173+19*a174+18*a175+17*a176+16*a177+15*a178+14*a179+13*a180+12*a181+11*a182+10*a183+9*a184+8*a185+7*a186+6*a187+5*a188+4*a189+3*a190+2*a191+1*a192)
-#define PP_CSUM_193(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193) (193*a1+192*a2+191*a3+190*a4+189*a5+188*a6+187*a7+186*a8+185*a9+184*a10+183*a11+182*a12+181*a13+180*a14+179*a15+178*a16+177*a17+176*a18+175*a19+174*a20+173*a21+172*a22+171*a23+170*a24+169*a25+168*a26+167*a27+166*a28+165*a29+164*a30+163*a31+162*a32+161*a33+160*a34+159*a35+158*a36+157*a37+156*a38+155*a39+154*a40+153*a41+152*a42+151*a43+150*a44+149*a45+148*a46+147*a47+146*a48+145*a49+144*a50+143*a51+142*a52+141*a53+140*a54+139*a55+138*a56+137*a57+136*a58+135*a59+134*a60+133*a61+132*a62+131*a63+130*a64+129*a65+128*a66+127*a67+126*a68+125*a69+124*a70+123*a71+122*a72+121*a73+120*a74+119*a75+118*a76+117*a77+116*a78+115*a79+114*a80+113*a81+112*a82+111*a83+110*a84+109*a85+108*a86+107*a87+106*a88+105*a89+104*a90+103*a91+102*a92+101*a93+100*a94+99*a95+98*a96+97*a97+96*a98+95*a99+94*a100+93*a101+92*a102+91*a103+90*a104+89*a105+88*a106+87*a107+86*a108+85*a109+84*a110+83*a111+82*a112+81*a113+80*a114+79*a115+78*a116+77*a117+76*a118+75*a119+74*a120+73*a121+72*a122+71*a123+70*a124+69*a125+68*a126+67*a127+66*a128+65*a129+64*a130+63*a131+62*a132+61*a133+60*a134+59*a135+58*a136+57*a137+56*a138+55*a139+54*a140+53*a141+52*a142+51*a143+50*a144+49*a145+48*a146+47*a147+46*a148+45*a149+44*a150+43*a151+42*a152+41*a153+40*a154+39*a155+38*a156+37*a157+36*a158+35*a159+34*a160+33*a161+32*a162+31*a163+30*a164+29*a165+28*a166+27*a167+26*a168+25*a169+24*a170+23*a171+22*a172+21*a173+20*a174+19*a175+18*a176+17*a177+16*a178+15*a179+14*a180+13*a181+12*a182+11*a183+10*a184+9*a185+8*a186+7*a187+6*a188+5*a189+4*a190+3*a191+2*a192+1*a193)
-#define PP_CSUM_194(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194) (194*a1+193*a2+192*a3+191*a4+190*a5+189*a6+188*a7+187*a8+186*a9+185*a10+184*a11+183*a12+182*a13+181*a14+180*a15+179*a16+178*a17+177*a18+176*a19+175*a20+174*a21+173*a22+172*a23+171*a24+170*a25+169*a26+168*a27+167*a28+166*a29+165*a30+164*a31+163*a32+162*a33+161*a34+160*a35+159*a36+158*a37+157*a38+156*a39+155*a40+154*a41+153*a42+152*a43+151*a44+150*a45+149*a46+148*a47+147*a48+146*a49+145*a50+144*a51+143*a52+142*a53+141*a54+140*a55+139*a56+138*a57+137*a58+136*a59+135*a60+134*a61+133*a62+132*a63+131*a64+130*a65+129*a66+128*a67+127*a68+126*a69+125*a70+124*a71+123*a72+122*a73+121*a74+120*a75+119*a76+118*a77+117*a78+116*a79+115*a80+114*a81+113*a82+112*a83+111*a84+110*a85+109*a86+108*a87+107*a88+106*a89+105*a90+104*a91+103*a92+102*a93+101*a94+100*a95+99*a96+98*a97+97*a98+96*a99+95*a100+94*a101+93*a102+92*a103+91*a104+90*a105+89*a106+88*a107+87*a108+86*a109+85*a110+84*a111+83*a112+82*a113+81*a114+80*a115+79*a116+78*a117+77*a118+76*a119+75*a120+74*a121+73*a122+72*a123+71*a124+70*a125+69*a126+68*a127+67*a128+66*a129+65*a130+64*a131+63*a132+62*a133+61*a134+60*a135+59*a136+58*a137+57*a138+56*a139+55*a140+54*a141+53*a142+52*a143+51*a144+50*a145+49*a146+48*a147+47*a148+46*a149+45*a150+44*a151+43*a152+42*a153+41*a154+40*a155+39*a156+38*a157+37*a158+36*a159+35*a160+34*a161+33*a162+32*a163+31*a164+30*a165+29*a166+28*a167+27*a168+26*a169+25*a170+24*a171+23*a172+22*a173+21*a174+20*a175+19*a176+18*a177+17*a178+16*a179+15*a180+14*a181+13*a182+12*a183+11*a184+10*a185+9*a186+8*a187+7*a188+6*a189+5*a190+4*a191+3*a192+2*a193+1*a194)
-#define PP_CSUM_195(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195) (195*a1+194*a2+193*a3+192*a4+191*a5+190*a6+189*a7+188*a8+187*a9+186*a10+185*a11+184*a12+183*a13+182*a14+181*a15+180*a16+179*a17+178*a18+177*a19+176*a20+175*a21+174*a22+173*a23+172*a24+171*a25+170*a26+169*a27+168*a28+167*a29+166*a30+165*a31+164*a32+163*a33+162*a34+161*a35+160*a36+159*a37+158*a38+157*a39+156*a40+155*a41+154*a42+153*a43+152*a44+151*a45+150*a46+149*a47+148*a48+147*a49+146*a50+145*a51+144*a52+143*a53+142*a54+141*a55+140*a56+139*a57+138*a58+137*a59+136*a60+135*a61+134*a62+133*a63+132*a64+131*a65+130*a66+129*a67+128*a68+127*a69+126*a70+125*a71+124*a72+123*a73+122*a74+121*a75+120*a76+119*a77+118*a78+117*a79+116*a80+115*a81+114*a82+113*a83+112*a84+111*a85+110*a86+109*a87+108*a88+107*a89+106*a90+105*a91+104*a92+103*a93+102*a94+101*a95+100*a96+99*a97+98*a98+97*a99+96*a100+95*a101+94*a102+93*a103+92*a104+91*a105+90*a106+89*a107+88*a108+87*a109+86*a110+85*a111+84*a112+83*a113+82*a114+81*a115+80*a116+79*a117+78*a118+77*a119+76*a120+75*a121+74*a122+73*a123+72*a124+71*a125+70*a126+69*a127+68*a128+67*a129+66*a130+65*a131+64*a132+63*a133+62*a134+61*a135+60*a136+59*a137+58*a138+57*a139+56*a140+55*a141+54*a142+53*a143+52*a144+51*a145+50*a146+49*a147+48*a148+47*a149+46*a150+45*a151+44*a152+43*a153+42*a154+41*a155+40*a156+39*a157+38*a158+37*a159+36*a160+35*a161+34*a162+33*a163+32*a164+31*a165+30*a166+29*a167+28*a168+27*a169+26*a170+25*a171+24*a172+23*a173+22*a174+21*a175+20*a176+19*a177+18*a178+17*a179+16*a180+15*a181+14*a182+13*a183+12*a184+11*a185+10*a186+9*a187+8*a188+7*a189+6*a190+5*a191+4*a192+3*a193+2*a194+1*a195)
-#define PP_CSUM_196(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196) (196*a1+195*a2+194*a3+193*a4+192*a5+191*a6+190*a7+189*a8+188*a9+187*a10+186*a11+185*a12+184*a13+183*a14+182*a15+181*a16+180*a17+179*a18+178*a19+177*a20+176*a21+175*a22+174*a23+173*a24+172*a25+171*a26+170*a27+169*a28+168*a29+167*a30+166*a31+165*a32+164*a33+163*a34+162*a35+161*a36+160*a37+159*a38+158*a39+157*a40+156*a41+155*a42+154*a43+153*a44+152*a45+151*a46+150*a47+149*a48+148*a49+147*a50+146*a51+145*a52+144*a53+143*a54+142*a55+141*a56+140*a57+139*a58+138*a59+137*a60+136*a61+135*a62+134*a63+133*a64+132*a65+131*a66+130*a67+129*a68+128*a69+127*a70+126*a71+125*a72+124*a73+123*a74+122*a75+121*a76+120*a77+119*a78+118*a79+117*a80+116*a81+115*a82+114*a83+113*a84+112*a85+111*a86+110*a87+109*a88+108*a89+107*a90+106*a91+105*a92+104*a93+103*a94+102*a95+101*a96+100*a97+99*a98+98*a99+97*a100+96*a101+95*a102+94*a103+93*a104+92*a105+91*a106+90*a107+89*a108+88*a109+87*a110+86*a111+85*a112+84*a113+83*a114+82*a115+81*a116+80*a117+79*a118+78*a119+77*a120+76*a121+75*a122+74*a123+73*a124+72*a125+71*a126+70*a127+69*a128+68*a129+67*a130+66*a131+65*a132+64*a133+63*a134+62*a135+61*a136+60*a137+59*a138+58*a139+57*a140+56*a141+55*a142+54*a143+53*a144+52*a145+51*a146+50*a147+49*a148+48*a149+47*a150+46*a151+45*a152+44*a153+43*a154+42*a155+41*a156+40*a157+39*a158+38*a159+37*a160+36*a161+35*a162+34*a163+33*a164+32*a165+31*a166+30*a167+29*a168+28*a169+27*a170+26*a171+25*a172+24*a173+23*a174+22*a175+21*a176+20*a177+19*a178+18*a179+17*a180+16*a181+15*a182+14*a183+13*a184+12*a185+11*a186+10*a187+9*a188+8*a189+7*a190+6*a191+5*a192+4*a193+3*a194+2*a195+1*a196)
-#define PP_CSUM_197(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197) (197*a1+196*a2+195*a3+194*a4+193*a5+192*a6+191*a7+190*a8+189*a9+188*a10+187*a11+186*a12+185*a13+184*a14+183*a15+182*a16+181*a17+180*a18+179*a19+178*a20+177*a21+176*a22+175*a23+174*a24+173*a25+172*a26+171*a27+170*a28+169*a29+168*a30+167*a31+166*a32+165*a33+164*a34+163*a35+162*a36+161*a37+160*a38+159*a39+158*a40+157*a41+156*a42+155*a43+154*a44+153*a45+152*a46+151*a47+150*a48+149*a49+148*a50+147*a51+146*a52+145*a53+144*a54+143*a55+142*a56+141*a57+140*a58+139*a59+138*a60+137*a61+136*a62+135*a63+134*a64+133*a65+132*a66+131*a67+130*a68+129*a69+128*a70+127*a71+126*a72+125*a73+124*a74+123*a75+122*a76+121*a77+120*a78+119*a79+118*a80+117*a81+116*a82+115*a83+114*a84+113*a85+112*a86+111*a87+110*a88+109*a89+108*a90+107*a91+106*a92+105*a93+104*a94+103*a95+102*a96+101*a97+100*a98+99*a99+98*a100+97*a101+96*a102+95*a103+94*a104+93*a105+92*a106+91*a107+90*a108+89*a109+88*a110+87*a111+86*a112+85*a113+84*a114+83*a115+82*a116+81*a117+80*a118+79*a119+78*a120+77*a121+76*a122+75*a123+74*a124+73*a125+72*a126+71*a127+70*a128+69*a129+68*a130+67*a131+66*a132+65*a133+64*a134+63*a135+62*a136+61*a137+60*a138+59*a139+58*a140+57*a141+56*a142+55*a143+54*a144+53*a145+52*a146+51*a147+50*a148+49*a149+48*a150+47*a151+46*a152+45*a153+44*a154+43*a155+42*a156+41*a157+40*a158+39*a159+38*a160+37*a161+36*a162+35*a163+34*a164+33*a165+32*a166+31*a167+30*a168+29*a169+28*a170+27*a171+26*a172+25*a173+24*a174+23*a175+22*a176+21*a177+20*a178+19*a179+18*a180+17*a181+16*a182+15*a183+14*a184+13*a185+12*a186+11*a187+10*a188+9*a189+8*a190+7*a191+6*a192+5*a193+4*a194+3*a195+2*a196+1*a197)
-#define PP_CSUM_198(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198) (198*a1+197*a2+196*a3+195*a4+194*a5+193*a6+192*a7+191*a8+190*a9+189*a10+188*a11+187*a12+186*a13+185*a14+184*a15+183*a16+182*a17+181*a18+180*a19+179*a20+178*a21+177*a22+176*a23+175*a24+174*a25+173*a26+172*a27+171*a28+170*a29+169*a30+168*a31+167*a32+166*a33+165*a34+164*a35+163*a36+162*a37+161*a38+160*a39+159*a40+158*a41+157*a42+156*a43+155*a44+154*a45+153*a46+152*a47+151*a48+150*a49+149*a50+148*a51+147*a52+146*a53+145*a54+144*a55+143*a56+142*a57+141*a58+140*a59+139*a60+138*a61+137*a62+136*a63+135*a64+134*a65+133*a66+132*a67+131*a68+130*a69+129*a70+128*a71+127*a72+126*a73+125*a74+124*a75+123*a76+122*a77+121*a78+120*a79+119*a80+118*a81+117*a82+116*a83+115*a84+114*a85+113*a86+112*a87+111*a88+110*a89+109*a90+108*a91+107*a92+106*a93+105*a94+104*a95+103*a96+102*a97+101*a98+100*a99+99*a100+98*a101+97*a102+96*a103+95*a104+94*a105+93*a106+92*a107+91*a108+90*a109+89*a110+88*a111+87*a112+86*a113+85*a114+84*a115+83*a116+82*a117+81*a118+80*a119+79*a120+78*a121+77*a122+76*a123+75*a124+74*a125+73*a126+72*a127+71*a128+70*a129+69*a130+68*a131+67*a132+66*a133+65*a134+64*a135+63*a136+62*a137+61*a138+60*a139+59*a140+58*a141+57*a142+56*a143+55*a144+54*a145+53*a146+52*a147+51*a148+50*a149+49*a150+48*a151+47*a152+46*a153+45*a154+44*a155+43*a156+42*a157+41*a158+40*a159+39*a160+38*a161+37*a162+36*a163+35*a164+34*a165+33*a166+32*a167+31*a168+30*a169+29*a170+28*a171+27*a172+26*a173+25*a174+24*a175+23*a176+22*a177+21*a178+20*a179+19*a180+18*a181+17*a182+16*a183+15*a184+14*a185+13*a186+12*a187+11*a188+10*a189+9*a190+8*a191+7*a192+6*a193+5*a194+4*a195+3*a196+2*a197+1*a198)
-#define PP_CSUM_199(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199) (199*a1+198*a2+197*a3+196*a4+195*a5+194*a6+193*a7+192*a8+191*a9+190*a10+189*a11+188*a12+187*a13+186*a14+185*a15+184*a16+183*a17+182*a18+181*a19+180*a20+179*a21+178*a22+177*a23+176*a24+175*a25+174*a26+173*a27+172*a28+171*a29+170*a30+169*a31+168*a32+167*a33+166*a34+165*a35+164*a36+163*a37+162*a38+161*a39+160*a40+159*a41+158*a42+157*a43+156*a44+155*a45+154*a46+153*a47+152*a48+151*a49+150*a50+149*a51+148*a52+147*a53+146*a54+145*a55+144*a56+143*a57+142*a58+141*a59+140*a60+139*a61+138*a62+137*a63+136*a64+135*a65+134*a66+133*a67+132*a68+131*a69+130*a70+129*a71+128*a72+127*a73+126*a74+125*a75+124*a76+123*a77+122*a78+121*a79+120*a80+119*a81+118*a82+117*a83+116*a84+115*a85+114*a86+113*a87+112*a88+111*a89+110*a90+109*a91+108*a92+107*a93+106*a94+105*a95+104*a96+103*a97+102*a98+101*a99+100*a100+99*a101+98*a102+97*a103+96*a104+95*a105+94*a106+93*a107+92*a108+91*a109+90*a110+89*a111+88*a112+87*a113+86*a114+85*a115+84*a116+83*a117+82*a118+81*a119+80*a120+79*a121+78*a122+77*a123+76*a124+75*a125+74*a126+73*a127+72*a128+71*a129+70*a130+69*a131+68*a132+67*a133+66*a134+65*a135+64*a136+63*a137+62*a138+61*a139+60*a140+59*a141+58*a142+57*a143+56*a144+55*a145+54*a146+53*a147+52*a148+51*a149+50*a150+49*a151+48*a152+47*a153+46*a154+45*a155+44*a156+43*a157+42*a158+41*a159+40*a160+39*a161+38*a162+37*a163+36*a164+35*a165+34*a166+33*a167+32*a168+31*a169+30*a170+29*a171+28*a172+27*a173+26*a174+25*a175+24*a176+23*a177+22*a178+21*a179+20*a180+19*a181+18*a182+17*a183+16*a184+15*a185+14*a186+13*a187+12*a188+11*a189+10*a190+9*a191+8*a192+7*a193+6*a194+5*a195+4*a196+3*a197+2*a198+1*a199)
-#define PP_CSUM_200(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200) (200*a1+199*a2+198*a3+197*a4+196*a5+195*a6+194*a7+193*a8+192*a9+191*a10+190*a11+189*a12+188*a13+187*a14+186*a15+185*a16+184*a17+183*a18+182*a19+181*a20+180*a21+179*a22+178*a23+177*a24+176*a25+175*a26+174*a27+173*a28+172*a29+171*a30+170*a31+169*a32+168*a33+167*a34+166*a35+165*a36+164*a37+163*a38+162*a39+161*a40+160*a41+159*a42+158*a43+157*a44+156*a45+155*a46+154*a47+153*a48+152*a49+151*a50+150*a51+149*a52+148*a53+147*a54+146*a55+145*a56+144*a57+143*a58+142*a59+141*a60+140*a61+139*a62+138*a63+137*a64+136*a65+135*a66+134*a67+133*a68+132*a69+131*a70+130*a71+129*a72+128*a73+127*a74+126*a75+125*a76+124*a77+123*a78+122*a79+121*a80+120*a81+119*a82+118*a83+117*a84+116*a85+115*a86+114*a87+113*a88+112*a89+111*a90+110*a91+109*a92+108*a93+107*a94+106*a95+105*a96+104*a97+103*a98+102*a99+101*a100+100*a101+99*a102+98*a103+97*a104+96*a105+95*a106+94*a107+93*a108+92*a109+91*a110+90*a111+89*a112+88*a113+87*a114+86*a115+85*a116+84*a117+83*a118+82*a119+81*a120+80*a121+79*a122+78*a123+77*a124+76*a125+75*a126+74*a127+73*a128+72*a129+71*a130+70*a131+69*a132+68*a133+67*a134+66*a135+65*a136+64*a137+63*a138+62*a139+61*a140+60*a141+59*a142+58*a143+57*a144+56*a145+55*a146+54*a147+53*a148+52*a149+51*a150+50*a151+49*a152+48*a153+47*a154+46*a155+45*a156+44*a157+43*a158+42*a159+41*a160+40*a161+39*a162+38*a163+37*a164+36*a165+35*a166+34*a167+33*a168+32*a169+31*a170+30*a171+29*a172+28*a173+27*a174+26*a175+25*a176+24*a177+23*a178+22*a179+21*a180+20*a181+19*a182+18*a183+17*a184+16*a185+15*a186+14*a187+13*a188+12*a189+11*a190+10*a191+9*a192+8*a193+7*a194+6*a195+5*a196+4*a197+3*a198+2*a199+1*a200)
-#define PP_CSUM_201(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201) (201*a1+200*a2+199*a3+198*a4+197*a5+196*a6+195*a7+194*a8+193*a9+192*a10+191*a11+190*a12+189*a13+188*a14+187*a15+186*a16+185*a17+184*a18+183*a19+182*a20+181*a21+180*a22+179*a23+178*a24+177*a25+176*a26+175*a27+174*a28+173*a29+172*a30+171*a31+170*a32+169*a33+168*a34+167*a35+166*a36+165*a37+164*a38+163*a39+162*a40+161*a41+160*a42+159*a43+158*a44+157*a45+156*a46+155*a47+154*a48+153*a49+152*a50+151*a51+150*a52+149*a53+148*a54+147*a55+146*a56+145*a57+144*a58+143*a59+142*a60+141*a61+140*a62+139*a63+138*a64+137*a65+136*a66+135*a67+134*a68+133*a69+132*a70+131*a71+130*a72+129*a73+128*a74+127*a75+126*a76+125*a77+124*a78+123*a79+122*a80+121*a81+120*a82+119*a83+118*a84+117*a85+116*a86+115*a87+114*a88+113*a89+112*a90+111*a91+110*a92+109*a93+108*a94+107*a95+106*a96+105*a97+104*a98+103*a99+102*a100+101*a101+100*a102+99*a103+98*a104+97*a105+96*a106+95*a107+94*a108+93*a109+92*a110+91*a111+90*a112+89*a113+88*a114+87*a115+86*a116+85*a117+84*a118+83*a119+82*a120+81*a121+80*a122+79*a123+78*a124+77*a125+76*a126+75*a127+74*a128+73*a129+72*a130+71*a131+70*a132+69*a133+68*a134+67*a135+66*a136+65*a137+64*a138+63*a139+62*a140+61*a141+60*a142+59*a143+58*a144+57*a145+56*a146+55*a147+54*a148+53*a149+52*a150+51*a151+50*a152+49*a153+48*a154+47*a155+46*a156+45*a157+44*a158+43*a159+42*a160+41*a161+40*a162+39*a163+38*a164+37*a165+36*a166+35*a167+34*a168+33*a169+32*a170+31*a171+30*a172+29*a173+28*a174+27*a175+26*a176+25*a177+24*a178+23*a179+22*a180+21*a181+20*a182+19*a183+18*a184+17*a185+16*a186+15*a187+14*a188+13*a189+12*a190+11*a191+10*a192+9*a193+8*a194+7*a195+6*a196+5*a197+4*a198+3*a199+2*a200+1*a201)
-#define PP_CSUM_202(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202) (202*a1+201*a2+200*a3+199*a4+198*a5+197*a6+196*a7+195*a8+194*a9+193*a10+192*a11+191*a12+190*a13+189*a14+188*a15+187*a16+186*a17+185*a18+184*a19+183*a20+182*a21+181*a22+180*a23+179*a24+178*a25+177*a26+176*a27+175*a28+174*a29+173*a30+172*a31+171*a32+170*a33+169*a34+168*a35+167*a36+166*a37+165*a38+164*a39+163*a40+162*a41+161*a42+160*a43+159*a44+158*a45+157*a46+156*a47+155*a48+154*a49+153*a50+152*a51+151*a52+150*a53+149*a54+148*a55+147*a56+146*a57+145*a58+144*a59+143*a60+142*a61+141*a62+140*a63+139*a64+138*a65+137*a66+136*a67+135*a68+134*a69+133*a70+132*a71+131*a72+130*a73+129*a74+128*a75+127*a76+126*a77+125*a78+124*a79+123*a80+122*a81+121*a82+120*a83+119*a84+118*a85+117*a86+116*a87+115*a88+114*a89+113*a90+112*a91+111*a92+110*a93+109*a94+108*a95+107*a96+106*a97+105*a98+104*a99+103*a100+102*a101+101*a102+100*a103+99*a104+98*a105+97*a106+96*a107+95*a108+94*a109+93*a110+92*a111+91*a112+90*a113+89*a114+88*a115+87*a116+86*a117+85*a118+84*a119+83*a120+82*a121+81*a122+80*a123+79*a124+78*a125+77*a126+76*a127+75*a128+74*a129+73*a130+72*a131+71*a132+70*a133+69*a134+68*a135+67*a136+66*a137+65*a138+64*a139+63*a140+62*a141+61*a142+60*a143+59*a144+58*a145+57*a146+56*a147+55*a148+54*a149+53*a150+52*a151+51*a152+50*a153+49*a154+48*a155+47*a156+46*a157+45*a158+44*a159+43*a160+42*a161+41*a162+40*a163+39*a164+38*a165+37*a166+36*a167+35*a168+34*a169+33*a170+32*a171+31*a172+30*a173+29*a174+28*a175+27*a176+26*a177+25*a178+24*a179+23*a180+22*a181+21*a182+20*a183+19*a184+18*a185+17*a186+16*a187+15*a188+14*a189+13*a190+12*a191+11*a192+10*a193+9*a194+8*a195+7*a196+6*a197+5*a198+4*a199+3*a200+2*a201+1*a202)
-#define PP_CSUM_203(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203) (203*a1+202*a2+201*a3+200*a4+199*a5+198*a6+197*a7+196*a8+195*a9+194*a10+193*a11+192*a12+191*a13+190*a14+189*a15+188*a16+187*a17+186*a18+185*a19+184*a20+183*a21+182*a22+181*a23+180*a24+179*a25+178*a26+177*a27+176*a28+175*a29+174*a30+173*a31+172*a32+171*a33+170*a34+169*a35+168*a36+167*a37+166*a38+165*a39+164*a40+163*a41+162*a42+161*a43+160*a44+159*a45+158*a46+157*a47+156*a48+155*a49+154*a50+153*a51+152*a52+151*a53+150*a54+149*a55+148*a56+147*a57+146*a58+145*a59+144*a60+143*a61+142*a62+141*a63+140*a64+139*a65+138*a66+137*a67+136*a68+135*a69+134*a70+133*a71+132*a72+131*a73+130*a74+129*a75+128*a76+127*a77+126*a78+125*a79+124*a80+123*a81+122*a82+121*a83+120*a84+119*a85+118*a86+117*a87+116*a88+115*a89+114*a90+113*a91+112*a92+111*a93+110*a94+109*a95+108*a96+107*a97+106*a98+105*a99+104*a100+103*a101+102*a102+101*a103+100*a104+99*a105+98*a106+97*a107+96*a108+95*a109+94*a110+93*a111+92*a112+91*a113+90*a114+89*a115+88*a116+87*a117+86*a118+85*a119+84*a120+83*a121+82*a122+81*a123+80*a124+79*a125+78*a126+77*a127+76*a128+75*a129+74*a130+73*a131+72*a132+71*a133+70*a134+69*a135+68*a136+67*a137+66*a138+65*a139+64*a140+63*a141+62*a142+61*a143+60*a144+59*a145+58*a146+57*a147+56*a148+55*a149+54*a150+53*a151+52*a152+51*a153+50*a154+49*a155+48*a156+47*a157+46*a158+45*a159+44*a160+43*a161+42*a162+41*a163+40*a164+39*a165+38*a166+37*a167+36*a168+35*a169+34*a170+33*a171+32*a172+31*a173+30*a174+29*a175+28*a176+27*a177+26*a178+25*a179+24*a180+23*a181+22*a182+21*a183+20*a184+19*a185+18*a186+17*a187+16*a188+15*a189+14*a190+13*a191+12*a192+11*a193+10*a194+9*a195+8*a196+7*a197+6*a198+5*a199+4*a200+3*a201+2*a202+1*a203)
-#define PP_CSUM_204(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204) (204*a1+203*a2+202*a3+201*a4+200*a5+199*a6+198*a7+197*a8+196*a9+195*a10+194*a11+193*a12+192*a13+191*a14+190*a15+189*a16+188*a17+187*a18+186*a19+185*a20+184*a21+183*a22+182*a23+181*a24+180*a25+179*a26+178*a27+177*a28+176*a29+175*a30+174*a31+173*a32+172*a33+171*a34+170*a35+169*a36+168*a37+167*a38+166*a39+165*a40+164*a41+163*a42+162*a43+161*a44+160*a45+159*a46+158*a47+157*a48+156*a49+155*a50+154*a51+153*a52+152*a53+151*a54+150*a55+149*a56+148*a57+147*a58+146*a59+145*a60+144*a61+143*a62+142*a63+141*a64+140*a65+139*a66+138*a67+137*a68+136*a69+135*a70+134*a71+133*a72+132*a73+131*a74+130*a75+129*a76+128*a77+127*a78+126*a79+125*a80+124*a81+123*a82+122*a83+121*a84+120*a85+119*a86+118*a87+117*a88+116*a89+115*a90+114*a91+113*a92+112*a93+111*a94+110*a95+109*a96+108*a97+107*a98+106*a99+105*a100+104*a101+103*a102+102*a103+101*a104+100*a105+99*a106+98*a107+97*a108+96*a109+95*a110+94*a111+93*a112+92*a113+91*a114+90*a115+89*a116+88*a117+87*a118+86*a119+85*a120+84*a121+83*a122+82*a123+81*a124+80*a125+79*a126+78*a127+77*a128+76*a129+75*a130+74*a131+73*a132+72*a133+71*a134+70*a135+69*a136+68*a137+67*a138+66*a139+65*a140+64*a141+63*a142+62*a143+61*a144+60*a145+59*a146+58*a147+57*a148+56*a149+55*a150+54*a151+53*a152+52*a153+51*a154+50*a155+49*a156+48*a157+47*a158+46*a159+45*a160+44*a161+43*a162+42*a163+41*a164+40*a165+39*a166+38*a167+37*a168+36*a169+35*a170+34*a171+33*a172+32*a173+31*a174+30*a175+29*a176+28*a177+27*a178+26*a179+25*a180+24*a181+23*a182+22*a183+21*a184+20*a185+19*a186+18*a187+17*a188+16*a189+15*a190+14*a191+13*a192+12*a193+11*a194+10*a195+9*a196+8*a197+7*a198+6*a199+5*a200+4*a201+3*a202+2*a203+1*a204)
-#define PP_CSUM_205(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205) (205*a1+204*a2+203*a3+202*a4+201*a5+200*a6+199*a7+198*a8+197*a9+196*a10+195*a11+194*a12+193*a13+192*a14+191*a15+190*a16+189*a17+188*a18+187*a19+186*a20+185*a21+184*a22+183*a23+182*a24+181*a25+180*a26+179*a27+178*a28+177*a29+176*a30+175*a31+174*a32+173*a33+172*a34+171*a35+170*a36+169*a37+168*a38+167*a39+166*a40+165*a41+164*a42+163*a43+162*a44+161*a45+160*a46+159*a47+158*a48+157*a49+156*a50+155*a51+154*a52+153*a53+152*a54+151*a55+150*a56+149*a57+148*a58+147*a59+146*a60+145*a61+144*a62+143*a63+142*a64+141*a65+140*a66+139*a67+138*a68+137*a69+136*a70+135*a71+134*a72+133*a73+132*a74+131*a75+130*a76+129*a77+128*a78+127*a79+126*a80+125*a81+124*a82+123*a83+122*a84+121*a85+120*a86+119*a87+118*a88+117*a89+116*a90+115*a91+114*a92+113*a93+112*a94+111*a95+110*a96+109*a97+108*a98+107*a99+106*a100+105*a101+104*a102+103*a103+102*a104+101*a105+100*a106+99*a107+98*a108+97*a109+96*a110+95*a111+94*a112+93*a113+92*a114+91*a115+90*a116+89*a117+88*a118+87*a119+86*a120+85*a121+84*a122+83*a123+82*a124+81*a125+80*a126+79*a127+78*a128+77*a129+76*a130+75*a131+74*a132+73*a133+72*a134+71*a135+70*a136+69*a137+68*a138+67*a139+66*a140+65*a141+64*a142+63*a143+62*a144+61*a145+60*a146+59*a147+58*a148+57*a149+56*a150+55*a151+54*a152+53*a153+52*a154+51*a155+50*a156+49*a157+48*a158+47*a159+46*a160+45*a161+44*a162+43*a163+42*a164+41*a165+40*a166+39*a167+38*a168+37*a169+36*a170+35*a171+34*a172+33*a173+32*a174+31*a175+30*a176+29*a177+28*a178+27*a179+26*a180+25*a181+24*a182+23*a183+22*a184+21*a185+20*a186+19*a187+18*a188+17*a189+16*a190+15*a191+14*a192+13*a193+12*a194+11*a195+10*a196+9*a197+8*a198+7*a199+6*a200+5*a201+4*a202+3*a203+2*a204+1*a205)
-#define PP_CSUM_206(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206) (206*a1+205*a2+204*a3+203*a4+202*a5+201*a6+200*a7+199*a8+198*a9+197*a10+196*a11+195*a12+194*a13+193*a14+192*a15+191*a16+190*a17+189*a18+188*a19+187*a20+186*a21+185*a22+184*a23+183*a24+182*a25+181*a26+180*a27+179*a28+178*a29+177*a30+176*a31+175*a32+174*a33+173*a34+172*a35+171*a36+170*a37+169*a38+168*a39+167*a40+166*a41+165*a42+164*a43+163*a44+162*a45+161*a46+160*a47+159*a48+158*a49+157*a50+156*a51+155*a52+154*a53+153*a54+152*a55+151*a56+150*a57+149*a58+148*a59+147*a60+146*a61+145*a62+144*a63+143*a64+142*a65+141*a66+140*a67+139*a68+138*a69+137*a70+136*a71+135*a72+134*a73+133*a74+132*a75+131*a76+130*a77+129*a78+128*a79+127*a80+126*a81+125*a82+124*a83+123*a84+122*a85+121*a86+120*a87+119*a88+118*a89+117*a90+116*a91+115*a92+114*a93+113*a94+112*a95+111*a96+110*a97+109*a98+108*a99+107*a100+106*a101+105*a102+104*a103+103*a104+102*a105+101*a106+100*a107+99*a108+98*a109+97*a110+96*a111+95*a112+94*a113+93*a114+92*a115+91*a116+90*a117+89*a118+88*a119+87*a120+86*a121+85*a122+84*a123+83*a124+82*a125+81*a126+80*a127+79*a128+78*a129+77*a130+76*a131+75*a132+74*a133+73*a134+72*a135+71*a136+70*a137+69*a138+68*a139+67*a140+66*a141+65*a142+64*a143+63*a144+62*a145+61*a146+60*a147+59*a148+58*a149+57*a150+56*a151+55*a152+54*a153+53*a154+52*a155+51*a156+50*a157+49*a158+48*a159+47*a160+46*a161+45*a162+44*a163+43*a164+42*a165+41*a166+40*a167+39*a168+38*a169+37*a170+36*a171+35*a172+34*a173+33*a174+32*a175+31*a176+30*a177+29*a178+28*a179+27*a180+26*a181+25*a182+24*a183+23*a184+22*a185+21*a186+20*a187+19*a188+18*a189+17*a190+16*a191+15*a192+14*a193+13*a194+12*a195+11*a196+10*a197+9*a198+8*a199+7*a200+6*a201+5*a202+4*a203+3*a204+2*a205+1*a206)
-#define PP_CSUM_207(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207) (207*a1+206*a2+205*a3+204*a4+203*a5+202*a6+201*a7+200*a8+199*a9+198*a10+197*a11+196*a12+195*a13+194*a14+193*a15+192*a16+191*a17+190*a18+189*a19+188*a20+187*a21+186*a22+185*a23+184*a24+183*a25+182*a26+181*a27+180*a28+179*a29+178*a30+177*a31+176*a32+175*a33+174*a34+173*a35+172*a36+171*a37+170*a38+169*a39+168*a40+167*a41+166*a42+165*a43+164*a44+163*a45+162*a46+161*a47+160*a48+159*a49+158*a50+157*a51+156*a52+155*a53+154*a54+153*a55+152*a56+151*a57+150*a58+149*a59+148*a60+147*a61+146*a62+145*a63+144*a64+143*a65+142*a66+141*a67+140*a68+139*a69+138*a70+137*a71+136*a72+135*a73+134*a74+133*a75+132*a76+131*a77+130*a78+129*a79+128*a80+127*a81+126*a82+125*a83+124*a84+123*a85+122*a86+121*a87+120*a88+119*a89+118*a90+117*a91+116*a92+115*a93+114*a94+113*a95+112*a96+111*a97+110*a98+109*a99+108*a100+107*a101+106*a102+105*a103+104*a104+103*a105+102*a106+101*a107+100*a108+99*a109+98*a110+97*a111+96*a112+95*a113+94*a114+93*a115+92*a116+91*a117+90*a118+89*a119+88*a120+87*a121+86*a122+85*a123+84*a124+83*a125+82*a126+81*a127+80*a128+79*a129+78*a130+77*a131+76*a132+75*a133+74*a134+73*a135+72*a136+71*a137+70*a138+69*a139+68*a140+67*a141+66*a142+65*a143+64*a144+63*a145+62*a146+61*a147+60*a148+59*a149+58*a150+57*a151+56*a152+55*a153+54*a154+53*a155+52*a156+51*a157+50*a158+49*a159+48*a160+47*a161+46*a162+45*a163+44*a164+43*a165+42*a166+41*a167+40*a168+39*a169+38*a170+37*a171+36*a172+35*a173+34*a174+33*a175+32*a176+31*a177+30*a178+29*a179+28*a180+27*a181+26*a182+25*a183+24*a184+23*a185+22*a186+21*a187+20*a188+19*a189+18*a190+17*a191+16*a192+15*a193+14*a194+13*a195+12*a196+11*a197+10*a198+9*a199+8*a200+7*a201+6*a202+5*a203+4*a204+3*a205+2*a206+1*a207)
-#define PP_CSUM_208(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208) (208*a1+207*a2+206*a3+205*a4+204*a5+203*a6+202*a7+201*a8+200*a9+199*a10+198*a11+197*a12+196*a13+195*a14+194*a15+193*a16+192*a17+191*a18+190*a19+189*a20+188*a21+187*a22+186*a23+185*a24+184*a25+183*a26+182*a27+181*a28+180*a29+179*a30+178*a31+177*a32+176*a33+175*a34+174*a35+173*a36+172*a37+171*a38+170*a39+169*a40+168*a41+167*a42+166*a43+165*a44+164*a45+163*a46+162*a47+161*a48+160*a49+159*a50+158*a51+157*a52+156*a53+155*a54+154*a55+153*a56+152*a57+151*a58+150*a59+149*a60+148*a61+147*a62+146*a63+145*a64+144*a65+143*a66+142*a67+141*a68+140*a69+139*a70+138*a71+137*a72+136*a73+135*a74+134*a75+133*a76+132*a77+131*a78+130*a79+129*a80+128*a81+127*a82+126*a83+125*a84+124*a85+123*a86+122*a87+121*a88+120*a89+119*a90+118*a91+117*a92+116*a93+115*a94+114*a95+113*a96+112*a97+111*a98+110*a99+109*a100+108*a101+107*a102+106*a103+105*a104+104*a105+103*a106+102*a107+101*a108+100*a109+99*a110+98*a111+97*a112+96*a113+95*a114+94*a115+93*a116+92*a117+91*a118+90*a119+89*a120+88*a121+87*a122+86*a123+85*a124+84*a125+83*a126+82*a127+81*a128+80*a129+79*a130+78*a131+77*a132+76*a133+75*a134+74*a135+73*a136+72*a137+71*a138+70*a139+69*a140+68*a141+67*a142+66*a143+65*a144+64*a145+63*a146+62*a147+61*a148+60*a149+59*a150+58*a151+57*a152+56*a153+55*a154+54*a155+53*a156+52*a157+51*a158+50*a159+49*a160+48*a161+47*a162+46*a163+45*a164+44*a165+43*a166+42*a167+41*a168+40*a169+39*a170+38*a171+37*a172+36*a173+35*a174+34*a175+33*a176+32*a177+31*a178+30*a179+29*a180+28*a181+27*a182+26*a183+25*a184+24*a185+23*a186+22*a187+21*a188+20*a189+19*a190+18*a191+17*a192+16*a193+15*a194+14*a195+13*a196+12*a197+11*a198+10*a199+9*a200+8*a201+7*a202+6*a203+5*a204+4*a205+3*a206+2*a207+1*a208)
-#define PP_CSUM_209(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209) (209*a1+208*a2+207*a3+206*a4+205*a5+204*a6+203*a7+202*a8+201*a9+200*a10+199*a11+198*a12+197*a13+196*a14+195*a15+194*a16+193*a17+192*a18+191*a19+190*a20+189*a21+188*a22+187*a23+186*a24+185*a25+184*a26+183*a27+182*a28+181*a29+180*a30+179*a31+178*a32+177*a33+176*a34+175*a35+174*a36+173*a37+172*a38+171*a39+170*a40+169*a41+168*a42+167*a43+166*a44+165*a45+164*a46+163*a47+162*a48+161*a49+160*a50+159*a51+158*a52+157*a53+156*a54+155*a55+154*a56+153*a57+152*a58+151*a59+150*a60+149*a61+148*a62+147*a63+146*a64+145*a65+144*a66+143*a67+142*a68+141*a69+140*a70+139*a71+138*a72+137*a73+136*a74+135*a75+134*a76+133*a77+132*a78+131*a79+130*a80+129*a81+128*a82+127*a83+126*a84+125*a85+124*a86+123*a87+122*a88+121*a89+120*a90+119*a91+118*a92+117*a93+116*a94+115*a95+114*a96+113*a97+112*a98+111*a99+110*a100+109*a101+108*a102+107*a103+106*a104+105*a105+104*a106+103*a107+102*a108+101*a109+100*a110+99*a111+98*a112+97*a113+96*a114+95*a115+94*a116+93*a117+92*a118+91*a119+90*a120+89*a121+88*a122+87*a123+86*a124+85*a125+84*a126+83*a127+82*a128+81*a129+80*a130+79*a131+78*a132+77*a133+76*a134+75*a135+74*a136+73*a137+72*a138+71*a139+70*a140+69*a141+68*a142+67*a143+66*a144+65*a145+64*a146+63*a147+62*a148+61*a149+60*a150+59*a151+58*a152+57*a153+56*a154+55*a155+54*a156+53*a157+52*a158+51*a159+50*a160+49*a161+48*a162+47*a163+46*a164+45*a165+44*a166+43*a167+42*a168+41*a169+40*a170+39*a171+38*a172+37*a173+36*a174+35*a175+34*a176+33*a177+32*a178+31*a179+30*a180+29*a181+28*a182+27*a183+26*a184+25*a185+24*a186+23*a187+22*a188+21*a189+20*a190+19*a191+18*a192+17*a193+16*a194+15*a195+14*a196+13*a197+12*a198+11*a199+10*a200+9*a201+8*a202+7*a203+6*a204+5*a205+4*a206+3*a207+2*a208+1*a209)
-#define PP_CSUM_210(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210) (210*a1+209*a2+208*a3+207*a4+206*a5+205*a6+204*a7+203*a8+202*a9+201*a10+200*a11+199*a12+198*a13+197*a14+196*a15+195*a16+194*a17+193*a18+192*a19+191*a20+190*a21+189*a22+188*a23+187*a24+186*a25+185*a26+184*a27+183*a28+182*a29+181*a30+180*a31+179*a32+178*a33+177*a34+176*a35+175*a36+174*a37+173*a38+172*a39+171*a40+170*a41+169*a42+168*a43+167*a44+166*a45+165*a46+164*a47+163*a48+162*a49+161*a50+160*a51+159*a52+158*a53+157*a54+156*a55+155*a56+154*a57+153*a58+152*a59+151*a60+150*a61+149*a62+148*a63+147*a64+146*a65+145*a66+144*a67+143*a68+142*a69+141*a70+140*a71+139*a72+138*a73+137*a74+136*a75+135*a76+134*a77+133*a78+132*a79+131*a80+130*a81+129*a82+128*a83+127*a84+126*a85+125*a86+124*a87+123*a88+122*a89+121*a90+120*a91+119*a92+118*a93+117*a94+116*a95+115*a96+114*a97+113*a98+112*a99+111*a100+110*a101+109*a102+108*a103+107*a104+106*a105+105*a106+104*a107+103*a108+102*a109+101*a110+100*a111+99*a112+98*a113+97*a114+96*a115+95*a116+94*a117+93*a118+92*a119+91*a120+90*a121+89*a122+88*a123+87*a124+86*a125+85*a126+84*a127+83*a128+82*a129+81*a130+80*a131+79*a132+78*a133+77*a134+76*a135+75*a136+74*a137+73*a138+72*a139+71*a140+70*a141+69*a142+68*a143+67*a144+66*a145+65*a146+64*a147+63*a148+62*a149+61*a150+60*a151+59*a152+58*a153+57*a154+56*a155+55*a156+54*a157+53*a158+52*a159+51*a160+50*a161+49*a162+48*a163+47*a164+46*a165+45*a166+44*a167+43*a168+42*a169+41*a170+40*a171+39*a172+38*a173+37*a174+36*a175+35*a176+34*a177+33*a178+32*a179+31*a180+30*a181+29*a182+28*a183+27*a184+26*a185+25*a186+24*a187+23*a188+22*a189+21*a190+20*a191+19*a192+18*a193+17*a194+16*a195+15*a196+14*a197+13*a198+12*a199+11*a200+10*a201+9*a202+8*a203+7*a204+6*a205+5*a206+4*a207+3*a208+2*a209+1*a210)
-#define PP_CSUM_211(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211) (211*a1+210*a2+209*a3+208*a4+207*a5+206*a6+205*a7+204*a8+203*a9+202*a10+201*a11+200*a12+199*a13+198*a14+197*a15+196*a16+195*a17+194*a18+193*a19+192*a20+191*a21+190*a22+189*a23+188*a24+187*a25+186*a26+185*a27+184*a28+183*a29+182*a30+181*a31+180*a32+179*a33+178*a34+177*a35+176*a36+175*a37+174*a38+173*a39+172*a40+171*a41+170*a42+169*a43+168*a44+167*a45+166*a46+165*a47+164*a48+163*a49+162*a50+161*a51+160*a52+159*a53+158*a54+157*a55+156*a56+155*a57+154*a58+153*a59+152*a60+151*a61+150*a62+149*a63+148*a64+147*a65+146*a66+145*a67+144*a68+143*a69+142*a70+141*a71+140*a72+139*a73+138*a74+137*a75+136*a76+135*a77+134*a78+133*a79+132*a80+131*a81+130*a82+129*a83+128*a84+127*a85+126*a86+125*a87+124*a88+123*a89+122*a90+121*a91+120*a92+119*a93+118*a94+117*a95+116*a96+115*a97+114*a98+113*a99+112*a100+111*a101+110*a102+109*a103+108*a104+107*a105+106*a106+105*a107+104*a108+103*a109+102*a110+101*a111+100*a112+99*a113+98*a114+97*a115+96*a116+95*a117+94*a118+93*a119+92*a120+91*a121+90*a122+89*a123+88*a124+87*a125+86*a126+85*a127+84*a128+83*a129+82*a130+81*a131+80*a132+79*a133+78*a134+77*a135+76*a136+75*a137+74*a138+73*a139+72*a140+71*a141+70*a142+69*a143+68*a144+67*a145+66*a146+65*a147+64*a148+63*a149+62*a150+61*a151+60*a152+59*a153+58*a154+57*a155+56*a156+55*a157+54*a158+53*a159+52*a160+51*a161+50*a162+49*a163+48*a164+47*a165+46*a166+45*a167+44*a168+43*a169+42*a170+41*a171+40*a172+39*a173+38*a174+37*a175+36*a176+35*a177+34*a178+33*a179+32*a180+31*a181+30*a182+29*a183+28*a184+27*a185+26*a186+25*a187+24*a188+23*a189+22*a190+21*a191+20*a192+19*a193+18*a194+17*a195+16*a196+15*a197+14*a198+13*a199+12*a200+11*a201+10*a202+9*a203+8*a204+7*a205+6*a206+5*a207+4*a208+3*a209+2*a210+1*a211)
-#define PP_CSUM_212(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212) (212*a1+211*a2+210*a3+209*a4+208*a5+207*a6+206*a7+205*a8+204*a9+203*a10+202*a11+201*a12+200*a13+199*a14+198*a15+197*a16+196*a17+195*a18+194*a19+193*a20+192*a21+191*a22+190*a23+189*a24+188*a25+187*a26+186*a27+185*a28+184*a29+183*a30+182*a31+181*a32+180*a33+179*a34+178*a35+177*a36+176*a37+175*a38+174*a39+173*a40+172*a41+171*a42+170*a43+169*a44+168*a45+167*a46+166*a47+165*a48+164*a49+163*a50+162*a51+161*a52+160*a53+159*a54+158*a55+157*a56+156*a57+155*a58+154*a59+153*a60+152*a61+151*a62+150*a63+149*a64+148*a65+147*a66+146*a67+145*a68+144*a69+143*a70+142*a71+141*a72+140*a73+139*a74+138*a75+137*a76+136*a77+135*a78+134*a79+133*a80+132*a81+131*a82+130*a83+129*a84+128*a85+127*a86+126*a87+125*a88+124*a89+123*a90+122*a91+121*a92+120*a93+119*a94+118*a95+117*a96+116*a97+115*a98+114*a99+113*a100+112*a101+111*a102+110*a103+109*a104+108*a105+107*a106+106*a107+105*a108+104*a109+103*a110+102*a111+101*a112+100*a113+99*a114+98*a115+97*a116+96*a117+95*a118+94*a119+93*a120+92*a121+91*a122+90*a123+89*a124+88*a125+87*a126+86*a127+85*a128+84*a129+83*a130+82*a131+81*a132+80*a133+79*a134+78*a135+77*a136+76*a137+75*a138+74*a139+73*a140+72*a141+71*a142+70*a143+69*a144+68*a145+67*a146+66*a147+65*a148+64*a149+63*a150+62*a151+61*a152+60*a153+59*a154+58*a155+57*a156+56*a157+55*a158+54*a159+53*a160+52*a161+51*a162+50*a163+49*a164+48*a165+47*a166+46*a167+45*a168+44*a169+43*a170+42*a171+41*a172+40*a173+39*a174+38*a175+37*a176+36*a177+35*a178+34*a179+33*a180+32*a181+31*a182+30*a183+29*a184+28*a185+27*a186+26*a187+25*a188+24*a189+23*a190+22*a191+21*a192+20*a193+19*a194+18*a195+17*a196+16*a197+15*a198+14*a199+13*a200+12*a201+11*a202+10*a203+9*a204+8*a205+7*a206+6*a207+5*a208+4*a209+3*a210+2*a211+1*a212)
-#define PP_CSUM_213(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213) (213*a1+212*a2+211*a3+210*a4+209*a5+208*a6+207*a7+206*a8+205*a9+204*a10+203*a11+202*a12+201*a13+200*a14+199*a15+198*a16+197*a17+196*a18+195*a19+194*a20+193*a21+192*a22+191*a23+190*a24+189*a25+188*a26+187*a27+186*a28+185*a29+184*a30+183*a31+182*a32+181*a33+180*a34+179*a35+178*a36+177*a37+176*a38+175*a39+174*a40+173*a41+172*a42+171*a43+170*a44+169*a45+168*a46+167*a47+166*a48+165*a49+164*a50+163*a51+162*a52+161*a53+160*a54+159*a55+158*a56+157*a57+156*a58+155*a59+154*a60+153*a61+152*a62+151*a63+150*a64+149*a65+148*a66+147*a67+146*a68+145*a69+144*a70+143*a71+142*a72+141*a73+140*a74+139*a75+138*a76+137*a77+136*a78+135*a79+134*a80+133*a81+132*a82+131*a83+130*a84+129*a85+128*a86+127*a87+126*a88+125*a89+124*a90+123*a91+122*a92+121*a93+120*a94+119*a95+118*a96+117*a97+116*a98+115*a99+114*a100+113*a101+112*a102+111*a103+110*a104+109*a105+108*a106+107*a107+106*a108+105*a109+104*a110+103*a111+102*a112+101*a113+100*a114+99*a115+98*a116+97*a117+96*a118+95*a119+94*a120+93*a121+92*a122+91*a123+90*a124+89*a125+88*a126+87*a127+86*a128+85*a129+84*a130+83*a131+82*a132+81*a133+80*a134+79*a135+78*a136+77*a137+76*a138+75*a139+74*a140+73*a141+72*a142+71*a143+70*a144+69*a145+68*a146+67*a147+66*a148+65*a149+64*a150+63*a151+62*a152+61*a153+60*a154+59*a155+58*a156+57*a157+56*a158+55*a159+54*a160+53*a161+52*a162+51*a163+50*a164+49*a165+48*a166+47*a167+46*a168+45*a169+44*a170+43*a171+42*a172+41*a173+40*a174+39*a175+38*a176+37*a177+36*a178+35*a179+34*a180+33*a181+32*a182+31*a183+30*a184+29*a185+28*a186+27*a187+26*a188+25*a189+24*a190+23*a191+22*a192+21*a193+20*a194+19*a195+18*a196+17*a197+16*a198+15*a199+14*a200+13*a201+12*a202+11*a203+10*a204+9*a205+8*a206+7*a207+6*a208+5*a209+4*a210+3*a211+2*a212+1*a213)
-#define PP_CSUM_214(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214) (214*a1+213*a2+212*a3+211*a4+210*a5+209*a6+208*a7+207*a8+206*a9+205*a10+204*a11+203*a12+202*a13+201*a14+200*a15+199*a16+198*a17+197*a18+196*a19+195*a20+194*a21+193*a22+192*a23+191*a24+190*a25+189*a26+188*a27+187*a28+186*a29+185*a30+184*a31+183*a32+182*a33+181*a34+180*a35+179*a36+178*a37+177*a38+176*a39+175*a40+174*a41+173*a42+172*a43+171*a44+170*a45+169*a46+168*a47+167*a48+166*a49+165*a50+164*a51+163*a52+162*a53+161*a54+160*a55+159*a56+158*a57+157*a58+156*a59+155*a60+154*a61+153*a62+152*a63+151*a64+150*a65+149*a66+148*a67+147*a68+146*a69+145*a70+144*a71+143*a72+142*a73+141*a74+140*a75+139*a76+138*a77+137*a78+136*a79+135*a80+134*a81+133*a82+132*a83+131*a84+130*a85+129*a86+128*a87+127*a88+126*a89+125*a90+124*a91+123*a92+122*a93+121*a94+120*a95+119*a96+118*a97+117*a98+116*a99+115*a100+114*a101+113*a102+112*a103+111*a104+110*a105+109*a106+108*a107+107*a108+106*a109+105*a110+104*a111+103*a112+102*a113+101*a114+100*a115+99*a116+98*a117+97*a118+96*a119+95*a120+94*a121+93*a122+92*a123+91*a124+90*a125+89*a126+88*a127+87*a128+86*a129+85*a130+84*a131+83*a132+82*a133+81*a134+80*a135+79*a136+78*a137+77*a138+76*a139+75*a140+74*a141+73*a142+72*a143+71*a144+70*a145+69*a146+68*a147+67*a148+66*a149+65*a150+64*a151+63*a152+62*a153+61*a154+60*a155+59*a156+58*a157+57*a158+56*a159+55*a160+54*a161+53*a162+52*a163+51*a164+50*a165+49*a166+48*a167+47*a168+46*a169+45*a170+44*a171+43*a172+42*a173+41*a174+40*a175+39*a176+38*a177+37*a178+36*a179+35*a180+34*a181+33*a182+32*a183+31*a184+30*a185+29*a186+28*a187+27*a188+26*a189+25*a190+24*a191+23*a192+22*a193+21*a194+20*a195+19*a196+18*a197+17*a198+16*a199+15*a200+14*a201+13*a202+12*a203+11*a204+10*a205+9*a206+8*a207+7*a208+6*a209+5*a210+4*a211+3*a212+2*a213+1*a214)
-#define PP_CSUM_215(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215) (215*a1+214*a2+213*a3+212*a4+211*a5+210*a6+209*a7+208*a8+207*a9+206*a10+205*a11+204*a12+203*a13+202*a14+201*a15+200*a16+199*a17+198*a18+197*a19+196*a20+195*a21+194*a22+193*a23+192*a24+191*a25+190*a26+189*a27+188*a28+187*a29+186*a30+185*a31+184*a32+183*a33+182*a34+181*a35+180*a36+179*a37+178*a38+177*a39+176*a40+175*a41+174*a42+173*a43+172*a44+171*a45+170*a46+169*a47+168*a48+167*a49+166*a50+165*a51+164*a52+163*a53+162*a54+161*a55+160*a56+159*a57+158*a58+157*a59+156*a60+155*a61+154*a62+153*a63+152*a64+151*a65+150*a66+149*a67+148*a68+147*a69+146*a70+145*a71+144*a72+143*a73+142*a74+141*a75+140*a76+139*a77+138*a78+137*a79+136*a80+135*a81+134*a82+133*a83+132*a84+131*a85+130*a86+129*a87+128*a88+127*a89+126*a90+125*a91+124*a92+123*a93+122*a94+121*a95+120*a96+119*a97+118*a98+117*a99+116*a100+115*a101+114*a102+113*a103+112*a104+111*a105+110*a106+109*a107+108*a108+107*a109+106*a110+105*a111+104*a112+103*a113+102*a114+101*a115+100*a116+99*a117+98*a118+97*a119+96*a120+95*a121+94*a122+93*a123+92*a124+91*a125+90*a126+89*a127+88*a128+87*a129+86*a130+85*a131+84*a132+83*a133+82*a134+81*a135+80*a136+79*a137+78*a138+77*a139+76*a140+75*a141+74*a142+73*a143+72*a144+71*a145+70*a146+69*a147+68*a148+67*a149+66*a150+65*a151+64*a152+63*a153+62*a154+61*a155+60*a156+59*a157+58*a158+57*a159+56*a160+55*a161+54*a162+53*a163+52*a164+51*a165+50*a166+49*a167+48*a168+47*a169+46*a170+45*a171+44*a172+43*a173+42*a174+41*a175+40*a176+39*a177+38*a178+37*a179+36*a180+35*a181+34*a182+33*a183+32*a184+31*a185+30*a186+29*a187+28*a188+27*a189+26*a190+25*a191+24*a192+23*a193+22*a194+21*a195+20*a196+19*a197+18*a198+17*a199+16*a200+15*a201+14*a202+13*a203+12*a204+11*a205+10*a206+9*a207+8*a208+7*a209+6*a210+5*a211+4*a212+3*a213+2*a214+1*a215)
-#define PP_CSUM_216(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216) (216*a1+215*a2+214*a3+213*a4+212*a5+211*a6+210*a7+209*a8+208*a9+207*a10+206*a11+205*a12+204*a13+203*a14+202*a15+201*a16+200*a17+199*a18+198*a19+197*a20+196*a21+195*a22+194*a23+193*a24+192*a25+191*a26+190*a27+189*a28+188*a29+187*a30+186*a31+185*a32+184*a33+183*a34+182*a35+181*a36+180*a37+179*a38+178*a39+177*a40+176*a41+175*a42+174*a43+173*a44+172*a45+171*a46+170*a47+169*a48+168*a49+167*a50+166*a51+165*a52+164*a53+163*a54+162*a55+161*a56+160*a57+159*a58+158*a59+157*a60+156*a61+155*a62+154*a63+153*a64+152*a65+151*a66+150*a67+149*a68+148*a69+147*a70+146*a71+145*a72+144*a73+143*a74+142*a75+141*a76+140*a77+139*a78+138*a79+137*a80+136*a81+135*a82+134*a83+133*a84+132*a85+131*a86+130*a87+129*a88+128*a89+127*a90+126*a91+125*a92+124*a93+123*a94+122*a95+121*a96+120*a97+119*a98+118*a99+117*a100+116*a101+115*a102+114*a103+113*a104+112*a105+111*a106+110*a107+109*a108+108*a109+107*a110+106*a111+105*a112+104*a113+103*a114+102*a115+101*a116+100*a117+99*a118+98*a119+97*a120+96*a121+95*a122+94*a123+93*a124+92*a125+91*a126+90*a127+89*a128+88*a129+87*a130+86*a131+85*a132+84*a133+83*a134+82*a135+81*a136+80*a137+79*a138+78*a139+77*a140+76*a141+75*a142+74*a143+73*a144+72*a145+71*a146+70*a147+69*a148+68*a149+67*a150+66*a151+65*a152+64*a153+63*a154+62*a155+61*a156+60*a157+59*a158+58*a159+57*a160+56*a161+55*a162+54*a163+53*a164+52*a165+51*a166+50*a167+49*a168+48*a169+47*a170+46*a171+45*a172+44*a173+43*a174+42*a175+41*a176+40*a177+39*a178+38*a179+37*a180+36*a181+35*a182+34*a183+33*a184+32*a185+31*a186+30*a187+29*a188+28*a189+27*a190+26*a191+25*a192+24*a193+23*a194+22*a195+21*a196+20*a197+19*a198+18*a199+17*a200+16*a201+15*a202+14*a203+13*a204+12*a205+11*a206+10*a207+9*a208+8*a209+7*a210+6*a211+5*a212+4*a213+3*a214+2*a215+1*a216)
-#define PP_CSUM_217(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217) (217*a1+216*a2+215*a3+214*a4+213*a5+212*a6+211*a7+210*a8+209*a9+208*a10+207*a11+206*a12+205*a13+204*a14+203*a15+202*a16+201*a17+200*a18+199*a19+198*a20+197*a21+196*a22+195*a23+194*a24+193*a25+192*a26+191*a27+190*a28+189*a29+188*a30+187*a31+186*a32+185*a33+184*a34+183*a35+182*a36+181*a37+180*a38+179*a39+178*a40+177*a41+176*a42+175*a43+174*a44+173*a45+172*a46+171*a47+170*a48+169*a49+168*a50+167*a51+166*a52+165*a53+164*a54+163*a55+162*a56+161*a57+160*a58+159*a59+158*a60+157*a61+156*a62+155*a63+154*a64+153*a65+152*a66+151*a67+150*a68+149*a69+148*a70+147*a71+146*a72+145*a73+144*a74+143*a75+142*a76+141*a77+140*a78+139*a79+138*a80+137*a81+136*a82+135*a83+134*a84+133*a85+132*a86+131*a87+130*a88+129*a89+128*a90+127*a91+126*a92+125*a93+124*a94+123*a95+122*a96+121*a97+120*a98+119*a99+118*a100+117*a101+116*a102+115*a103+114*a104+113*a105+112*a106+111*a107+110*a108+109*a109+108*a110+107*a111+106*a112+105*a113+104*a114+103*a115+102*a116+101*a117+100*a118+99*a119+98*a120+97*a121+96*a122+95*a123+94*a124+93*a125+92*a126+91*a127+90*a128+89*a129+88*a130+87*a131+86*a132+85*a133+84*a134+83*a135+82*a136+81*a137+80*a138+79*a139+78*a140+77*a141+76*a142+75*a143+74*a144+73*a145+72*a146+71*a147+70*a148+69*a149+68*a150+67*a151+66*a152+65*a153+64*a154+63*a155+62*a156+61*a157+60*a158+59*a159+58*a160+57*a161+56*a162+55*a163+54*a164+53*a165+52*a166+51*a167+50*a168+49*a169+48*a170+47*a171+46*a172+45*a173+44*a174+43*a175+42*a176+41*a177+40*a178+39*a179+38*a180+37*a181+36*a182+35*a183+34*a184+33*a185+32*a186+31*a187+30*a188+29*a189+28*a190+27*a191+26*a192+25*a193+24*a194+23*a195+22*a196+21*a197+20*a198+19*a199+18*a200+17*a201+16*a202+15*a203+14*a204+13*a205+12*a206+11*a207+10*a208+9*a209+8*a210+7*a211+6*a212+5*a213+4*a214+3*a215+2*a216+1*a217)
-#define PP_CSUM_218(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218) (218*a1+217*a2+216*a3+215*a4+214*a5+213*a6+212*a7+211*a8+210*a9+209*a10+208*a11+207*a12+206*a13+205*a14+204*a15+203*a16+202*a17+201*a18+200*a19+199*a20+198*a21+197*a22+196*a23+195*a24+194*a25+193*a26+192*a27+191*a28+190*a29+189*a30+188*a31+187*a32+186*a33+185*a34+184*a35+183*a36+182*a37+181*a38+180*a39+179*a40+178*a41+177*a42+176*a43+175*a44+174*a45+173*a46+172*a47+171*a48+170*a49+169*a50+168*a51+167*a52+166*a53+165*a54+164*a55+163*a56+162*a57+161*a58+160*a59+159*a60+158*a61+157*a62+156*a63+155*a64+154*a65+153*a66+152*a67+151*a68+150*a69+149*a70+148*a71+147*a72+146*a73+145*a74+144*a75+143*a76+142*a77+141*a78+140*a79+139*a80+138*a81+137*a82+136*a83+135*a84+134*a85+133*a86+132*a87+131*a88+130*a89+129*a90+128*a91+127*a92+126*a93+125*a94+124*a95+123*a96+122*a97+121*a98+120*a99+119*a100+118*a101+117*a102+116*a103+115*a104+114*a105+113*a106+112*a107+111*a108+110*a109+109*a110+108*a111+107*a112+106*a113+105*a114+104*a115+103*a116+102*a117+101*a118+100*a119+99*a120+98*a121+97*a122+96*a123+95*a124+94*a125+93*a126+92*a127+91*a128+90*a129+89*a130+88*a131+87*a132+86*a133+85*a134+84*a135+83*a136+82*a137+81*a138+80*a139+79*a140+78*a141+77*a142+76*a143+75*a144+74*a145+73*a146+72*a147+71*a148+70*a149+69*a150+68*a151+67*a152+66*a153+65*a154+64*a155+63*a156+62*a157+61*a158+60*a159+59*a160+58*a161+57*a162+56*a163+55*a164+54*a165+53*a166+52*a167+51*a168+50*a169+49*a170+48*a171+47*a172+46*a173+45*a174+44*a175+43*a176+42*a177+41*a178+40*a179+39*a180+38*a181+37*a182+36*a183+35*a184+34*a185+33*a186+32*a187+31*a188+30*a189+29*a190+28*a191+27*a192+26*a193+25*a194+24*a195+23*a196+22*a197+21*a198+20*a199+19*a200+18*a201+17*a202+16*a203+15*a204+14*a205+13*a206+12*a207+11*a208+10*a209+9*a210+8*a211+7*a212+6*a213+5*a214+4*a215+3*a216+2*a217+1*a218)
-#define PP_CSUM_219(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219) (219*a1+218*a2+217*a3+216*a4+215*a5+214*a6+213*a7+212*a8+211*a9+210*a10+209*a11+208*a12+207*a13+206*a14+205*a15+204*a16+203*a17+202*a18+201*a19+200*a20+199*a21+198*a22+197*a23+196*a24+195*a25+194*a26+193*a27+192*a28+191*a29+190*a30+189*a31+188*a32+187*a33+186*a34+185*a35+184*a36+183*a37+182*a38+181*a39+180*a40+179*a41+178*a42+177*a43+176*a44+175*a45+174*a46+173*a47+172*a48+171*a49+170*a50+169*a51+168*a52+167*a53+166*a54+165*a55+164*a56+163*a57+162*a58+161*a59+160*a60+159*a61+158*a62+157*a63+156*a64+155*a65+154*a66+153*a67+152*a68+151*a69+150*a70+149*a71+148*a72+147*a73+146*a74+145*a75+144*a76+143*a77+142*a78+141*a79+140*a80+139*a81+138*a82+137*a83+136*a84+135*a85+134*a86+133*a87+132*a88+131*a89+130*a90+129*a91+128*a92+127*a93+126*a94+125*a95+124*a96+123*a97+122*a98+121*a99+120*a100+119*a101+118*a102+117*a103+116*a104+115*a105+114*a106+113*a107+112*a108+111*a109+110*a110+109*a111+108*a112+107*a113+106*a114+105*a115+104*a116+103*a117+102*a118+101*a119+100*a120+99*a121+98*a122+97*a123+96*a124+95*a125+94*a126+93*a127+92*a128+91*a129+90*a130+89*a131+88*a132+87*a133+86*a134+85*a135+84*a136+83*a137+82*a138+81*a139+80*a140+79*a141+78*a142+77*a143+76*a144+75*a145+74*a146+73*a147+72*a148+71*a149+70*a150+69*a151+68*a152+67*a153+66*a154+65*a155+64*a156+63*a157+62*a158+61*a159+60*a160+59*a161+58*a162+57*a163+56*a164+55*a165+54*a166+53*a167+52*a168+51*a169+50*a170+49*a171+48*a172+47*a173+46*a174+45*a175+44*a176+43*a177+42*a178+41*a179+40*a180+39*a181+38*a182+37*a183+36*a184+35*a185+34*a186+33*a187+32*a188+31*a189+30*a190+29*a191+28*a192+27*a193+26*a194+25*a195+24*a196+23*a197+22*a198+21*a199+20*a200+19*a201+18*a202+17*a203+16*a204+15*a205+14*a206+13*a207+12*a208+11*a209+10*a210+9*a211+8*a212+7*a213+6*a214+5*a215+4*a216+3*a217+2*a218+1*a219)
-#define PP_CSUM_220(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220) (220*a1+219*a2+218*a3+217*a4+216*a5+215*a6+214*a7+213*a8+212*a9+211*a10+210*a11+209*a12+208*a13+207*a14+206*a15+205*a16+204*a17+203*a18+202*a19+201*a20+200*a21+199*a22+198*a23+197*a24+196*a25+195*a26+194*a27+193*a28+192*a29+191*a30+190*a31+189*a32+188*a33+187*a34+186*a35+185*a36+184*a37+183*a38+182*a39+181*a40+180*a41+179*a42+178*a43+177*a44+176*a45+175*a46+174*a47+173*a48+172*a49+171*a50+170*a51+169*a52+168*a53+167*a54+166*a55+165*a56+164*a57+163*a58+162*a59+161*a60+160*a61+159*a62+158*a63+157*a64+156*a65+155*a66+154*a67+153*a68+152*a69+151*a70+150*a71+149*a72+148*a73+147*a74+146*a75+145*a76+144*a77+143*a78+142*a79+141*a80+140*a81+139*a82+138*a83+137*a84+136*a85+135*a86+134*a87+133*a88+132*a89+131*a90+130*a91+129*a92+128*a93+127*a94+126*a95+125*a96+124*a97+123*a98+122*a99+121*a100+120*a101+119*a102+118*a103+117*a104+116*a105+115*a106+114*a107+113*a108+112*a109+111*a110+110*a111+109*a112+108*a113+107*a114+106*a115+105*a116+104*a117+103*a118+102*a119+101*a120+100*a121+99*a122+98*a123+97*a124+96*a125+95*a126+94*a127+93*a128+92*a129+91*a130+90*a131+89*a132+88*a133+87*a134+86*a135+85*a136+84*a137+83*a138+82*a139+81*a140+80*a141+79*a142+78*a143+77*a144+76*a145+75*a146+74*a147+73*a148+72*a149+71*a150+70*a151+69*a152+68*a153+67*a154+66*a155+65*a156+64*a157+63*a158+62*a159+61*a160+60*a161+59*a162+58*a163+57*a164+56*a165+55*a166+54*a167+53*a168+52*a169+51*a170+50*a171+49*a172+48*a173+47*a174+46*a175+45*a176+44*a177+43*a178+42*a179+41*a180+40*a181+39*a182+38*a183+37*a184+36*a185+35*a186+34*a187+33*a188+32*a189+31*a190+30*a191+29*a192+28*a193+27*a194+26*a195+25*a196+24*a197+23*a198+22*a199+21*a200+20*a201+19*a202+18*a203+17*a204+16*a205+15*a206+14*a207+13*a208+12*a209+11*a210+10*a211+9*a212+8*a213+7*a214+6*a215+5*a216+4*a217+3*a218+2*a219+1*a220)
-#define PP_CSUM_221(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221) (221*a1+220*a2+219*a3+218*a4+217*a5+216*a6+215*a7+214*a8+213*a9+212*a10+211*a11+210*a12+209*a13+208*a14+207*a15+206*a16+205*a17+204*a18+203*a19+202*a20+201*a21+200*a22+199*a23+198*a24+197*a25+196*a26+195*a27+194*a28+193*a29+192*a30+191*a31+190*a32+189*a33+188*a34+187*a35+186*a36+185*a37+184*a38+183*a39+182*a40+181*a41+180*a42+179*a43+178*a44+177*a45+176*a46+175*a47+174*a48+173*a49+172*a50+171*a51+170*a52+169*a53+168*a54+167*a55+166*a56+165*a57+164*a58+163*a59+162*a60+161*a61+160*a62+159*a63+158*a64+157*a65+156*a66+155*a67+154*a68+153*a69+152*a70+151*a71+150*a72+149*a73+148*a74+147*a75+146*a76+145*a77+144*a78+143*a79+142*a80+141*a81+140*a82+139*a83+138*a84+137*a85+136*a86+135*a87+134*a88+133*a89+132*a90+131*a91+130*a92+129*a93+128*a94+127*a95+126*a96+125*a97+124*a98+123*a99+122*a100+121*a101+120*a102+119*a103+118*a104+117*a105+116*a106+115*a107+114*a108+113*a109+112*a110+111*a111+110*a112+109*a113+108*a114+107*a115+106*a116+105*a117+104*a118+103*a119+102*a120+101*a121+100*a122+99*a123+98*a124+97*a125+96*a126+95*a127+94*a128+93*a129+92*a130+91*a131+90*a132+89*a133+88*a134+87*a135+86*a136+85*a137+84*a138+83*a139+82*a140+81*a141+80*a142+79*a143+78*a144+77*a145+76*a146+75*a147+74*a148+73*a149+72*a150+71*a151+70*a152+69*a153+68*a154+67*a155+66*a156+65*a157+64*a158+63*a159+62*a160+61*a161+60*a162+59*a163+58*a164+57*a165+56*a166+55*a167+54*a168+53*a169+52*a170+51*a171+50*a172+49*a173+48*a174+47*a175+46*a176+45*a177+44*a178+43*a179+42*a180+41*a181+40*a182+39*a183+38*a184+37*a185+36*a186+35*a187+34*a188+33*a189+32*a190+31*a191+30*a192+29*a193+28*a194+27*a195+26*a196+25*a197+24*a198+23*a199+22*a200+21*a201+20*a202+19*a203+18*a204+17*a205+16*a206+15*a207+14*a208+13*a209+12*a210+11*a211+10*a212+9*a213+8*a214+7*a215+6*a216+5*a217+4*a218+3*a219+2*a220+1*a221)
-#define PP_CSUM_222(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222) (222*a1+221*a2+220*a3+219*a4+218*a5+217*a6+216*a7+215*a8+214*a9+213*a10+212*a11+211*a12+210*a13+209*a14+208*a15+207*a16+206*a17+205*a18+204*a19+203*a20+202*a21+201*a22+200*a23+199*a24+198*a25+197*a26+196*a27+195*a28+194*a29+193*a30+192*a31+191*a32+190*a33+189*a34+188*a35+187*a36+186*a37+185*a38+184*a39+183*a40+182*a41+181*a42+180*a43+179*a44+178*a45+177*a46+176*a47+175*a48+174*a49+173*a50+172*a51+171*a52+170*a53+169*a54+168*a55+167*a56+166*a57+165*a58+164*a59+163*a60+162*a61+161*a62+160*a63+159*a64+158*a65+157*a66+156*a67+155*a68+154*a69+153*a70+152*a71+151*a72+150*a73+149*a74+148*a75+147*a76+146*a77+145*a78+144*a79+143*a80+142*a81+141*a82+140*a83+139*a84+138*a85+137*a86+136*a87+135*a88+134*a89+133*a90+132*a91+131*a92+130*a93+129*a94+128*a95+127*a96+126*a97+125*a98+124*a99+123*a100+122*a101+121*a102+120*a103+119*a104+118*a105+117*a106+116*a107+115*a108+114*a109+113*a110+112*a111+111*a112+110*a113+109*a114+108*a115+107*a116+106*a117+105*a118+104*a119+103*a120+102*a121+101*a122+100*a123+99*a124+98*a125+97*a126+96*a127+95*a128+94*a129+93*a130+92*a131+91*a132+90*a133+89*a134+88*a135+87*a136+86*a137+85*a138+84*a139+83*a140+82*a141+81*a142+80*a143+79*a144+78*a145+77*a146+76*a147+75*a148+74*a149+73*a150+72*a151+71*a152+70*a153+69*a154+68*a155+67*a156+66*a157+65*a158+64*a159+63*a160+62*a161+61*a162+60*a163+59*a164+58*a165+57*a166+56*a167+55*a168+54*a169+53*a170+52*a171+51*a172+50*a173+49*a174+48*a175+47*a176+46*a177+45*a178+44*a179+43*a180+42*a181+41*a182+40*a183+39*a184+38*a185+37*a186+36*a187+35*a188+34*a189+33*a190+32*a191+31*a192+30*a193+29*a194+28*a195+27*a196+26*a197+25*a198+24*a199+23*a200+22*a201+21*a202+20*a203+19*a204+18*a205+17*a206+16*a207+15*a208+14*a209+13*a210+12*a211+11*a212+10*a213+9*a214+8*a215+7*a216+6*a217+5*a218+4*a219+3*a220+2*a221+1*a222)
-#define PP_CSUM_223(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223) (223*a1+222*a2+221*a3+220*a4+219*a5+218*a6+217*a7+216*a8+215*a9+214*a10+213*a11+212*a12+211*a13+210*a14+209*a15+208*a16+207*a17+206*a18+205*a19+204*a20+203*a21+202*a22+201*a23+200*a24+199*a25+198*a26+197*a27+196*a28+195*a29+194*a30+193*a31+192*a32+191*a33+190*a34+189*a35+188*a36+187*a37+186*a38+185*a39+184*a40+183*a41+182*a42+181*a43+180*a44+179*a45+178*a46+177*a47+176*a48+175*a49+174*a50+173*a51+172*a52+171*a53+170*a54+169*a55+168*a56+167*a57+166*a58+165*a59+164*a60+163*a61+162*a62+161*a63+160*a64+159*a65+158*a66+157*a67+156*a68+155*a69+154*a70+153*a71+152*a72+151*a73+150*a74+149*a75+148*a76+147*a77+146*a78+145*a79+144*a80+143*a81+142*a82+141*a83+140*a84+139*a85+138*a86+137*a87+136*a88+135*a89+134*a90+133*a91+132*a92+131*a93+130*a94+129*a95+128*a96+127*a97+126*a98+125*a99+124*a100+123*a101+122*a102+121*a103+120*a104+119*a105+118*a106+117*a107+116*a108+115*a109+114*a110+113*a111+112*a112+111*a113+110*a114+109*a115+108*a116+107*a117+106*a118+105*a119+104*a120+103*a121+102*a122+101*a123+100*a124+99*a125+98*a126+97*a127+96*a128+95*a129+94*a130+93*a131+92*a132+91*a133+90*a134+89*a135+88*a136+87*a137+86*a138+85*a139+84*a140+83*a141+82*a142+81*a143+80*a144+79*a145+78*a146+77*a147+76*a148+75*a149+74*a150+73*a151+72*a152+71*a153+70*a154+69*a155+68*a156+67*a157+66*a158+65*a159+64*a160+63*a161+62*a162+61*a163+60*a164+59*a165+58*a166+57*a167+56*a168+55*a169+54*a170+53*a171+52*a172+51*a173+50*a174+49*a175+48*a176+47*a177+46*a178+45*a179+44*a180+43*a181+42*a182+41*a183+40*a184+39*a185+38*a186+37*a187+36*a188+35*a189+34*a190+33*a191+32*a192+31*a193+30*a194+29*a195+28*a196+27*a197+26*a198+25*a199+24*a200+23*a201+22*a202+21*a203+20*a204+19*a205+18*a206+17*a207+16*a208+15*a209+14*a210+13*a211+12*a212+11*a213+10*a214+9*a215+8*a216+7*a217+6*a218+5*a219+4*a220+3*a221+2*a222+1*a223)
-#define PP_CSUM_224(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224) (224*a1+223*a2+222*a3+221*a4+220*a5+219*a6+218*a7+217*a8+216*a9+215*a10+214*a11+213*a12+212*a13+211*a14+210*a15+209*a16+208*a17+207*a18+206*a19+205*a20+204*a21+203*a22+202*a23+201*a24+200*a25+199*a26+198*a27+197*a28+196*a29+195*a30+194*a31+193*a32+192*a33+191*a34+190*a35+189*a36+188*a37+187*a38+186*a39+185*a40+184*a41+183*a42+182*a43+181*a44+180*a45+179*a46+178*a47+177*a48+176*a49+175*a50+174*a51+173*a52+172*a53+171*a54+170*a55+169*a56+168*a57+167*a58+166*a59+165*a60+164*a61+163*a62+162*a63+161*a64+160*a65+159*a66+158*a67+157*a68+156*a69+155*a70+154*a71+153*a72+152*a73+151*a74+150*a75+149*a76+148*a77+147*a78+146*a79+145*a80+144*a81+143*a82+142*a83+141*a84+140*a85+139*a86+138*a87+137*a88+136*a89+135*a90+134*a91+133*a92+132*a93+131*a94+130*a95+129*a96+128*a97+127*a98+126*a99+125*a100+124*a101+123*a102+122*a103+121*a104+120*a105+119*a106+118*a107+117*a108+116*a109+115*a110+114*a111+113*a112+112*a113+111*a114+110*a115+109*a116+108*a117+107*a118+106*a119+105*a120+104*a121+103*a122+102*a123+101*a124+100*a125+99*a126+98*a127+97*a128+96*a129+95*a130+94*a131+93*a132+92*a133+91*a134+90*a135+89*a136+88*a137+87*a138+86*a139+85*a140+84*a141+83*a142+82*a143+81*a144+80*a145+79*a146+78*a147+77*a148+76*a149+75*a150+74*a151+73*a152+72*a153+71*a154+70*a155+69*a156+68*a157+67*a158+66*a159+65*a160+64*a161+63*a162+62*a163+61*a164+60*a165+59*a166+58*a167+57*a168+56*a169+55*a170+54*a171+53*a172+52*a173+51*a174+50*a175+49*a176+48*a177+47*a178+46*a179+45*a180+44*a181+43*a182+42*a183+41*a184+40*a185+39*a186+38*a187+37*a188+36*a189+35*a190+34*a191+33*a192+32*a193+31*a194+30*a195+29*a196+28*a197+27*a198+26*a199+25*a200+24*a201+23*a202+22*a203+21*a204+20*a205+19*a206+18*a207+17*a208+16*a209+15*a210+14*a211+13*a212+12*a213+11*a214+10*a215+9*a216+8*a217+7*a218+6*a219+5*a220+4*a221+3*a222+2*a223+1*a224)
-#define PP_CSUM_225(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225) (225*a1+224*a2+223*a3+222*a4+221*a5+220*a6+219*a7+218*a8+217*a9+216*a10+215*a11+214*a12+213*a13+212*a14+211*a15+210*a16+209*a17+208*a18+207*a19+206*a20+205*a21+204*a22+203*a23+202*a24+201*a25+200*a26+199*a27+198*a28+197*a29+196*a30+195*a31+194*a32+193*a33+192*a34+191*a35+190*a36+189*a37+188*a38+187*a39+186*a40+185*a41+184*a42+183*a43+182*a44+181*a45+180*a46+179*a47+178*a48+177*a49+176*a50+175*a51+174*a52+173*a53+172*a54+171*a55+170*a56+169*a57+168*a58+167*a59+166*a60+165*a61+164*a62+163*a63+162*a64+161*a65+160*a66+159*a67+158*a68+157*a69+156*a70+155*a71+154*a72+153*a73+152*a74+151*a75+150*a76+149*a77+148*a78+147*a79+146*a80+145*a81+144*a82+143*a83+142*a84+141*a85+140*a86+139*a87+138*a88+137*a89+136*a90+135*a91+134*a92+133*a93+132*a94+131*a95+130*a96+129*a97+128*a98+127*a99+126*a100+125*a101+124*a102+123*a103+122*a104+121*a105+120*a106+119*a107+118*a108+117*a109+116*a110+115*a111+114*a112+113*a113+112*a114+111*a115+110*a116+109*a117+108*a118+107*a119+106*a120+105*a121+104*a122+103*a123+102*a124+101*a125+100*a126+99*a127+98*a128+97*a129+96*a130+95*a131+94*a132+93*a133+92*a134+91*a135+90*a136+89*a137+88*a138+87*a139+86*a140+85*a141+84*a142+83*a143+82*a144+81*a145+80*a146+79*a147+78*a148+77*a149+76*a150+75*a151+74*a152+73*a153+72*a154+71*a155+70*a156+69*a157+68*a158+67*a159+66*a160+65*a161+64*a162+63*a163+62*a164+61*a165+60*a166+59*a167+58*a168+57*a169+56*a170+55*a171+54*a172+53*a173+52*a174+51*a175+50*a176+49*a177+48*a178+47*a179+46*a180+45*a181+44*a182+43*a183+42*a184+41*a185+40*a186+39*a187+38*a188+37*a189+36*a190+35*a191+34*a192+33*a193+32*a194+31*a195+30*a196+29*a197+28*a198+27*a199+26*a200+25*a201+24*a202+23*a203+22*a204+21*a205+20*a206+19*a207+18*a208+17*a209+16*a210+15*a211+14*a212+13*a213+12*a214+11*a215+10*a216+9*a217+8*a218+7*a219+6*a220+5*a221+4*a222+3*a223+2*a224+1*a225)
-#define PP_CSUM_226(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226) (226*a1+225*a2+224*a3+223*a4+222*a5+221*a6+220*a7+219*a8+218*a9+217*a10+216*a11+215*a12+214*a13+213*a14+212*a15+211*a16+210*a17+209*a18+208*a19+207*a20+206*a21+205*a22+204*a23+203*a24+202*a25+201*a26+200*a27+199*a28+198*a29+197*a30+196*a31+195*a32+194*a33+193*a34+192*a35+191*a36+190*a37+189*a38+188*a39+187*a40+186*a41+185*a42+184*a43+183*a44+182*a45+181*a46+180*a47+179*a48+178*a49+177*a50+176*a51+175*a52+174*a53+173*a54+172*a55+171*a56+170*a57+169*a58+168*a59+167*a60+166*a61+165*a62+164*a63+163*a64+162*a65+161*a66+160*a67+159*a68+158*a69+157*a70+156*a71+155*a72+154*a73+153*a74+152*a75+151*a76+150*a77+149*a78+148*a79+147*a80+146*a81+145*a82+144*a83+143*a84+142*a85+141*a86+140*a87+139*a88+138*a89+137*a90+136*a91+135*a92+134*a93+133*a94+132*a95+131*a96+130*a97+129*a98+128*a99+127*a100+126*a101+125*a102+124*a103+123*a104+122*a105+121*a106+120*a107+119*a108+118*a109+117*a110+116*a111+115*a112+114*a113+113*a114+112*a115+111*a116+110*a117+109*a118+108*a119+107*a120+106*a121+105*a122+104*a123+103*a124+102*a125+101*a126+100*a127+99*a128+98*a129+97*a130+96*a131+95*a132+94*a133+93*a134+92*a135+91*a136+90*a137+89*a138+88*a139+87*a140+86*a141+85*a142+84*a143+83*a144+82*a145+81*a146+80*a147+79*a148+78*a149+77*a150+76*a151+75*a152+74*a153+73*a154+72*a155+71*a156+70*a157+69*a158+68*a159+67*a160+66*a161+65*a162+64*a163+63*a164+62*a165+61*a166+60*a167+59*a168+58*a169+57*a170+56*a171+55*a172+54*a173+53*a174+52*a175+51*a176+50*a177+49*a178+48*a179+47*a180+46*a181+45*a182+44*a183+43*a184+42*a185+41*a186+40*a187+39*a188+38*a189+37*a190+36*a191+35*a192+34*a193+33*a194+32*a195+31*a196+30*a197+29*a198+28*a199+27*a200+26*a201+25*a202+24*a203+23*a204+22*a205+21*a206+20*a207+19*a208+18*a209+17*a210+16*a211+15*a212+14*a213+13*a214+12*a215+11*a216+10*a217+9*a218+8*a219+7*a220+6*a221+5*a222+4*a223+3*a224+2*a225+1*a226)
-#define PP_CSUM_227(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227) (227*a1+226*a2+225*a3+224*a4+223*a5+222*a6+221*a7+220*a8+219*a9+218*a10+217*a11+216*a12+215*a13+214*a14+213*a15+212*a16+211*a17+210*a18+209*a19+208*a20+207*a21+206*a22+205*a23+204*a24+203*a25+202*a26+201*a27+200*a28+199*a29+198*a30+197*a31+196*a32+195*a33+194*a34+193*a35+192*a36+191*a37+190*a38+189*a39+188*a40+187*a41+186*a42+185*a43+184*a44+183*a45+182*a46+181*a47+180*a48+179*a49+178*a50+177*a51+176*a52+175*a53+174*a54+173*a55+172*a56+171*a57+170*a58+169*a59+168*a60+167*a61+166*a62+165*a63+164*a64+163*a65+162*a66+161*a67+160*a68+159*a69+158*a70+157*a71+156*a72+155*a73+154*a74+153*a75+152*a76+151*a77+150*a78+149*a79+148*a80+147*a81+146*a82+145*a83+144*a84+143*a85+142*a86+141*a87+140*a88+139*a89+138*a90+137*a91+136*a92+135*a93+134*a94+133*a95+132*a96+131*a97+130*a98+129*a99+128*a100+127*a101+126*a102+125*a103+124*a104+123*a105+122*a106+121*a107+120*a108+119*a109+118*a110+117*a111+116*a112+115*a113+114*a114+113*a115+112*a116+111*a117+110*a118+109*a119+108*a120+107*a121+106*a122+105*a123+104*a124+103*a125+102*a126+101*a127+100*a128+99*a129+98*a130+97*a131+96*a132+95*a133+94*a134+93*a135+92*a136+91*a137+90*a138+89*a139+88*a140+87*a141+86*a142+85*a143+84*a144+83*a145+82*a146+81*a147+80*a148+79*a149+78*a150+77*a151+76*a152+75*a153+74*a154+73*a155+72*a156+71*a157+70*a158+69*a159+68*a160+67*a161+66*a162+65*a163+64*a164+63*a165+62*a166+61*a167+60*a168+59*a169+58*a170+57*a171+56*a172+55*a173+54*a174+53*a175+52*a176+51*a177+50*a178+49*a179+48*a180+47*a181+46*a182+45*a183+44*a184+43*a185+42*a186+41*a187+40*a188+39*a189+38*a190+37*a191+36*a192+35*a193+34*a194+33*a195+32*a196+31*a197+30*a198+29*a199+28*a200+27*a201+26*a202+25*a203+24*a204+23*a205+22*a206+21*a207+20*a208+19*a209+18*a210+17*a211+16*a212+15*a213+14*a214+13*a215+12*a216+11*a217+10*a218+9*a219+8*a220+7*a221+6*a222+5*a223+4*a224+3*a225+2*a226+1*a227)
-#define PP_CSUM_228(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228) (228*a1+227*a2+226*a3+225*a4+224*a5+223*a6+222*a7+221*a8+220*a9+219*a10+218*a11+217*a12+216*a13+215*a14+214*a15+213*a16+212*a17+211*a18+210*a19+209*a20+208*a21+207*a22+206*a23+205*a24+204*a25+203*a26+202*a27+201*a28+200*a29+199*a30+198*a31+197*a32+196*a33+195*a34+194*a35+193*a36+192*a37+191*a38+190*a39+189*a40+188*a41+187*a42+186*a43+185*a44+184*a45+183*a46+182*a47+181*a48+180*a49+179*a50+178*a51+177*a52+176*a53+175*a54+174*a55+173*a56+172*a57+171*a58+170*a59+169*a60+168*a61+167*a62+166*a63+165*a64+164*a65+163*a66+162*a67+161*a68+160*a69+159*a70+158*a71+157*a72+156*a73+155*a74+154*a75+153*a76+152*a77+151*a78+150*a79+149*a80+148*a81+147*a82+146*a83+145*a84+144*a85+143*a86+142*a87+141*a88+140*a89+139*a90+138*a91+137*a92+136*a93+135*a94+134*a95+133*a96+132*a97+131*a98+130*a99+129*a100+128*a101+127*a102+126*a103+125*a104+124*a105+123*a106+122*a107+121*a108+120*a109+119*a110+118*a111+117*a112+116*a113+115*a114+114*a115+113*a116+112*a117+111*a118+110*a119+109*a120+108*a121+107*a122+106*a123+105*a124+104*a125+103*a126+102*a127+101*a128+100*a129+99*a130+98*a131+97*a132+96*a133+95*a134+94*a135+93*a136+92*a137+91*a138+90*a139+89*a140+88*a141+87*a142+86*a143+85*a144+84*a145+83*a146+82*a147+81*a148+80*a149+79*a150+78*a151+77*a152+76*a153+75*a154+74*a155+73*a156+72*a157+71*a158+70*a159+69*a160+68*a161+67*a162+66*a163+65*a164+64*a165+63*a166+62*a167+61*a168+60*a169+59*a170+58*a171+57*a172+56*a173+55*a174+54*a175+53*a176+52*a177+51*a178+50*a179+49*a180+48*a181+47*a182+46*a183+45*a184+44*a185+43*a186+42*a187+41*a188+40*a189+39*a190+38*a191+37*a192+36*a193+35*a194+34*a195+33*a196+32*a197+31*a198+30*a199+29*a200+28*a201+27*a202+26*a203+25*a204+24*a205+23*a206+22*a207+21*a208+20*a209+19*a210+18*a211+17*a212+16*a213+15*a214+14*a215+13*a216+12*a217+11*a218+10*a219+9*a220+8*a221+7*a222+6*a223+5*a224+4*a225+3*a226+2*a227+1*a228)
-#define PP_CSUM_229(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229) (229*a1+228*a2+227*a3+226*a4+225*a5+224*a6+223*a7+222*a8+221*a9+220*a10+219*a11+218*a12+217*a13+216*a14+215*a15+214*a16+213*a17+212*a18+211*a19+210*a20+209*a21+208*a22+207*a23+206*a24+205*a25+204*a26+203*a27+202*a28+201*a29+200*a30+199*a31+198*a32+197*a33+196*a34+195*a35+194*a36+193*a37+192*a38+191*a39+190*a40+189*a41+188*a42+187*a43+186*a44+185*a45+184*a46+183*a47+182*a48+181*a49+180*a50+179*a51+178*a52+177*a53+176*a54+175*a55+174*a56+173*a57+172*a58+171*a59+170*a60+169*a61+168*a62+167*a63+166*a64+165*a65+164*a66+163*a67+162*a68+161*a69+160*a70+159*a71+158*a72+157*a73+156*a74+155*a75+154*a76+153*a77+152*a78+151*a79+150*a80+149*a81+148*a82+147*a83+146*a84+145*a85+144*a86+143*a87+142*a88+141*a89+140*a90+139*a91+138*a92+137*a93+136*a94+135*a95+134*a96+133*a97+132*a98+131*a99+130*a100+129*a101+128*a102+127*a103+126*a104+125*a105+124*a106+123*a107+122*a108+121*a109+120*a110+119*a111+118*a112+117*a113+116*a114+115*a115+114*a116+113*a117+112*a118+111*a119+110*a120+109*a121+108*a122+107*a123+106*a124+105*a125+104*a126+103*a127+102*a128+101*a129+100*a130+99*a131+98*a132+97*a133+96*a134+95*a135+94*a136+93*a137+92*a138+91*a139+90*a140+89*a141+88*a142+87*a143+86*a144+85*a145+84*a146+83*a147+82*a148+81*a149+80*a150+79*a151+78*a152+77*a153+76*a154+75*a155+74*a156+73*a157+72*a158+71*a159+70*a160+69*a161+68*a162+67*a163+66*a164+65*a165+64*a166+63*a167+62*a168+61*a169+60*a170+59*a171+58*a172+57*a173+56*a174+55*a175+54*a176+53*a177+52*a178+51*a179+50*a180+49*a181+48*a182+47*a183+46*a184+45*a185+44*a186+43*a187+42*a188+41*a189+40*a190+39*a191+38*a192+37*a193+36*a194+35*a195+34*a196+33*a197+32*a198+31*a199+30*a200+29*a201+28*a202+27*a203+26*a204+25*a205+24*a206+23*a207+22*a208+21*a209+20*a210+19*a211+18*a212+17*a213+16*a214+15*a215+14*a216+13*a217+12*a218+11*a219+10*a220+9*a221+8*a222+7*a223+6*a224+5*a225+4*a226+3*a227+2*a228+1*a229)
-#define PP_CSUM_230(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230) (230*a1+229*a2+228*a3+227*a4+226*a5+225*a6+224*a7+223*a8+222*a9+221*a10+220*a11+219*a12+218*a13+217*a14+216*a15+215*a16+214*a17+213*a18+212*a19+211*a20+210*a21+209*a22+208*a23+207*a24+206*a25+205*a26+204*a27+203*a28+202*a29+201*a30+200*a31+199*a32+198*a33+197*a34+196*a35+195*a36+194*a37+193*a38+192*a39+191*a40+190*a41+189*a42+188*a43+187*a44+186*a45+185*a46+184*a47+183*a48+182*a49+181*a50+180*a51+179*a52+178*a53+177*a54+176*a55+175*a56+174*a57+173*a58+172*a59+171*a60+170*a61+169*a62+168*a63+167*a64+166*a65+165*a66+164*a67+163*a68+162*a69+161*a70+160*a71+159*a72+158*a73+157*a74+156*a75+155*a76+154*a77+153*a78+152*a79+151*a80+150*a81+149*a82+148*a83+147*a84+146*a85+145*a86+144*a87+143*a88+142*a89+141*a90+140*a91+139*a92+138*a93+137*a94+136*a95+135*a96+134*a97+133*a98+132*a99+131*a100+130*a101+129*a102+128*a103+127*a104+126*a105+125*a106+124*a107+123*a108+122*a109+121*a110+120*a111+119*a112+118*a113+117*a114+116*a115+115*a116+114*a117+113*a118+112*a119+111*a120+110*a121+109*a122+108*a123+107*a124+106*a125+105*a126+104*a127+103*a128+102*a129+101*a130+100*a131+99*a132+98*a133+97*a134+96*a135+95*a136+94*a137+93*a138+92*a139+91*a140+90*a141+89*a142+88*a143+87*a144+86*a145+85*a146+84*a147+83*a148+82*a149+81*a150+80*a151+79*a152+78*a153+77*a154+76*a155+75*a156+74*a157+73*a158+72*a159+71*a160+70*a161+69*a162+68*a163+67*a164+66*a165+65*a166+64*a167+63*a168+62*a169+61*a170+60*a171+59*a172+58*a173+57*a174+56*a175+55*a176+54*a177+53*a178+52*a179+51*a180+50*a181+49*a182+48*a183+47*a184+46*a185+45*a186+44*a187+43*a188+42*a189+41*a190+40*a191+39*a192+38*a193+37*a194+36*a195+35*a196+34*a197+33*a198+32*a199+31*a200+30*a201+29*a202+28*a203+27*a204+26*a205+25*a206+24*a207+23*a208+22*a209+21*a210+20*a211+19*a212+18*a213+17*a214+16*a215+15*a216+14*a217+13*a218+12*a219+11*a220+10*a221+9*a222+8*a223+7*a224+6*a225+5*a226+4*a227+3*a228+2*a229+1*a230)
-#define PP_CSUM_231(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231) (231*a1+230*a2+229*a3+228*a4+227*a5+226*a6+225*a7+224*a8+223*a9+222*a10+221*a11+220*a12+219*a13+218*a14+217*a15+216*a16+215*a17+214*a18+213*a19+212*a20+211*a21+210*a22+209*a23+208*a24+207*a25+206*a26+205*a27+204*a28+203*a29+202*a30+201*a31+200*a32+199*a33+198*a34+197*a35+196*a36+195*a37+194*a38+193*a39+192*a40+191*a41+190*a42+189*a43+188*a44+187*a45+186*a46+185*a47+184*a48+183*a49+182*a50+181*a51+180*a52+179*a53+178*a54+177*a55+176*a56+175*a57+174*a58+173*a59+172*a60+171*a61+170*a62+169*a63+168*a64+167*a65+166*a66+165*a67+164*a68+163*a69+162*a70+161*a71+160*a72+159*a73+158*a74+157*a75+156*a76+155*a77+154*a78+153*a79+152*a80+151*a81+150*a82+149*a83+148*a84+147*a85+146*a86+145*a87+144*a88+143*a89+142*a90+141*a91+140*a92+139*a93+138*a94+137*a95+136*a96+135*a97+134*a98+133*a99+132*a100+131*a101+130*a102+129*a103+128*a104+127*a105+126*a106+125*a107+124*a108+123*a109+122*a110+121*a111+120*a112+119*a113+118*a114+117*a115+116*a116+115*a117+114*a118+113*a119+112*a120+111*a121+110*a122+109*a123+108*a124+107*a125+106*a126+105*a127+104*a128+103*a129+102*a130+101*a131+100*a132+99*a133+98*a134+97*a135+96*a136+95*a137+94*a138+93*a139+92*a140+91*a141+90*a142+89*a143+88*a144+87*a145+86*a146+85*a147+84*a148+83*a149+82*a150+81*a151+80*a152+79*a153+78*a154+77*a155+76*a156+75*a157+74*a158+73*a159+72*a160+71*a161+70*a162+69*a163+68*a164+67*a165+66*a166+65*a167+64*a168+63*a169+62*a170+61*a171+60*a172+59*a173+58*a174+57*a175+56*a176+55*a177+54*a178+53*a179+52*a180+51*a181+50*a182+49*a183+48*a184+47*a185+46*a186+45*a187+44*a188+43*a189+42*a190+41*a191+40*a192+39*a193+38*a194+37*a195+36*a196+35*a197+34*a198+33*a199+32*a200+31*a201+30*a202+29*a203+28*a204+27*a205+26*a206+25*a207+24*a208+23*a209+22*a210+21*a211+20*a212+19*a213+18*a214+17*a215+16*a216+15*a217+14*a218+13*a219+12*a220+11*a221+10*a222+9*a223+8*a224+7*a225+6*a226+5*a227+4*a228+3*a229+2*a230+1*a231)
-#define PP_CSUM_232(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232) (232*a1+231*a2+230*a3+229*a4+228*a5+227*a6+226*a7+225*a8+224*a9+223*a10+222*a11+221*a12+220*a13+219*a14+218*a15+217*a16+216*a17+215*a18+214*a19+213*a20+212*a21+211*a22+210*a23+209*a24+208*a25+207*a26+206*a27+205*a28+204*a29+203*a30+202*a31+201*a32+200*a33+199*a34+198*a35+197*a36+196*a37+195*a38+194*a39+193*a40+192*a41+191*a42+190*a43+189*a44+188*a45+187*a46+186*a47+185*a48+184*a49+183*a50+182*a51+181*a52+180*a53+179*a54+178*a55+177*a56+176*a57+175*a58+174*a59+173*a60+172*a61+171*a62+170*a63+169*a64+168*a65+167*a66+166*a67+165*a68+164*a69+163*a70+162*a71+161*a72+160*a73+159*a74+158*a75+157*a76+156*a77+155*a78+154*a79+153*a80+152*a81+151*a82+150*a83+149*a84+148*a85+147*a86+146*a87+145*a88+144*a89+143*a90+142*a91+141*a92+140*a93+139*a94+138*a95+137*a96+136*a97+135*a98+134*a99+133*a100+132*a101+131*a102+130*a103+129*a104+128*a105+127*a106+126*a107+125*a108+124*a109+123*a110+122*a111+121*a112+120*a113+119*a114+118*a115+117*a116+116*a117+115*a118+114*a119+113*a120+112*a121+111*a122+110*a123+109*a124+108*a125+107*a126+106*a127+105*a128+104*a129+103*a130+102*a131+101*a132+100*a133+99*a134+98*a135+97*a136+96*a137+95*a138+94*a139+93*a140+92*a141+91*a142+90*a143+89*a144+88*a145+87*a146+86*a147+85*a148+84*a149+83*a150+82*a151+81*a152+80*a153+79*a154+78*a155+77*a156+76*a157+75*a158+74*a159+73*a160+72*a161+71*a162+70*a163+69*a164+68*a165+67*a166+66*a167+65*a168+64*a169+63*a170+62*a171+61*a172+60*a173+59*a174+58*a175+57*a176+56*a177+55*a178+54*a179+53*a180+52*a181+51*a182+50*a183+49*a184+48*a185+47*a186+46*a187+45*a188+44*a189+43*a190+42*a191+41*a192+40*a193+39*a194+38*a195+37*a196+36*a197+35*a198+34*a199+33*a200+32*a201+31*a202+30*a203+29*a204+28*a205+27*a206+26*a207+25*a208+24*a209+23*a210+22*a211+21*a212+20*a213+19*a214+18*a215+17*a216+16*a217+15*a218+14*a219+13*a220+12*a221+11*a222+10*a223+9*a224+8*a225+7*a226+6*a227+5*a228+4*a229+3*a230+2*a231+1*a232)
-#define PP_CSUM_233(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232,a233) (233*a1+232*a2+231*a3+230*a4+229*a5+228*a6+227*a7+226*a8+225*a9+224*a10+223*a11+222*a12+221*a13+220*a14+219*a15+218*a16+217*a17+216*a18+215*a19+214*a20+213*a21+212*a22+211*a23+210*a24+209*a25+208*a26+207*a27+206*a28+205*a29+204*a30+203*a31+202*a32+201*a33+200*a34+199*a35+198*a36+197*a37+196*a38+195*a39+194*a40+193*a41+192*a42+191*a43+190*a44+189*a45+188*a46+187*a47+186*a48+185*a49+184*a50+183*a51+182*a52+181*a53+180*a54+179*a55+178*a56+177*a57+176*a58+175*a59+174*a60+173*a61+172*a62+171*a63+170*a64+169*a65+168*a66+167*a67+166*a68+165*a69+164*a70+163*a71+162*a72+161*a73+160*a74+159*a75+158*a76+157*a77+156*a78+155*a79+154*a80+153*a81+152*a82+151*a83+150*a84+149*a85+148*a86+147*a87+146*a88+145*a89+144*a90+143*a91+142*a92+141*a93+140*a94+139*a95+138*a96+137*a97+136*a98+135*a99+134*a100+133*a101+132*a102+131*a103+130*a104+129*a105+128*a106+127*a107+126*a108+125*a109+124*a110+123*a111+122*a112+121*a113+120*a114+119*a115+118*a116+117*a117+116*a118+115*a119+114*a120+113*a121+112*a122+111*a123+110*a124+109*a125+108*a126+107*a127+106*a128+105*a129+104*a130+103*a131+102*a132+101*a133+100*a134+99*a135+98*a136+97*a137+96*a138+95*a139+94*a140+93*a141+92*a142+91*a143+90*a144+89*a145+88*a146+87*a147+86*a148+85*a149+84*a150+83*a151+82*a152+81*a153+80*a154+79*a155+78*a156+77*a157+76*a158+75*a159+74*a160+73*a161+72*a162+71*a163+70*a164+69*a165+68*a166+67*a167+66*a168+65*a169+64*a170+63*a171+62*a172+61*a173+60*a174+59*a175+58*a176+57*a177+56*a178+55*a179+54*a180+53*a181+52*a182+51*a183+50*a184+49*a185+48*a186+47*a187+46*a188+45*a189+44*a190+43*a191+42*a192+41*a193+40*a194+39*a195+38*a196+37*a197+36*a198+35*a199+34*a200+33*a201+32*a202+31*a203+30*a204+29*a205+28*a206+27*a207+26*a208+25*a209+24*a210+23*a211+22*a212+21*a213+20*a214+19*a215+18*a216+17*a217+16*a218+15*a219+14*a220+13*a221+12*a222+11*a223+10*a224+9*a225+8*a226+7*a227+6*a228+5*a229+4*a230+3*a231+2*a232+1*a233)
-#define PP_CSUM_234(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232,a233,a234) (234*a1+233*a2+232*a3+231*a4+230*a5+229*a6+228*a7+227*a8+226*a9+225*a10+224*a11+223*a12+222*a13+221*a14+220*a15+219*a16+218*a17+217*a18+216*a19+215*a20+214*a21+213*a22+212*a23+211*a24+210*a25+209*a26+208*a27+207*a28+206*a29+205*a30+204*a31+203*a32+202*a33+201*a34+200*a35+199*a36+198*a37+197*a38+196*a39+195*a40+194*a41+193*a42+192*a43+191*a44+190*a45+189*a46+188*a47+187*a48+186*a49+185*a50+184*a51+183*a52+182*a53+181*a54+180*a55+179*a56+178*a57+177*a58+176*a59+175*a60+174*a61+173*a62+172*a63+171*a64+170*a65+169*a66+168*a67+167*a68+166*a69+165*a70+164*a71+163*a72+162*a73+161*a74+160*a75+159*a76+158*a77+157*a78+156*a79+155*a80+154*a81+153*a82+152*a83+151*a84+150*a85+149*a86+148*a87+147*a88+146*a89+145*a90+144*a91+143*a92+142*a93+141*a94+140*a95+139*a96+138*a97+137*a98+136*a99+135*a100+134*a101+133*a102+132*a103+131*a104+130*a105+129*a106+128*a107+127*a108+126*a109+125*a110+124*a111+123*a112+122*a113+121*a114+120*a115+119*a116+118*a117+117*a118+116*a119+115*a120+114*a121+113*a122+112*a123+111*a124+110*a125+109*a126+108*a127+107*a128+106*a129+105*a130+104*a131+103*a132+102*a133+101*a134+100*a135+99*a136+98*a137+97*a138+96*a139+95*a140+94*a141+93*a142+92*a143+91*a144+90*a145+89*a146+88*a147+87*a148+86*a149+85*a150+84*a151+83*a152+82*a153+81*a154+80*a155+79*a156+78*a157+77*a158+76*a159+75*a160+74*a161+73*a162+72*a163+71*a164+70*a165+69*a166+68*a167+67*a168+66*a169+65*a170+64*a171+63*a172+62*a173+61*a174+60*a175+59*a176+58*a177+57*a178+56*a179+55*a180+54*a181+53*a182+52*a183+51*a184+50*a185+49*a186+48*a187+47*a188+46*a189+45*a190+44*a191+43*a192+42*a193+41*a194+40*a195+39*a196+38*a197+37*a198+36*a199+35*a200+34*a201+33*a202+32*a203+31*a204+30*a205+29*a206+28*a207+27*a208+26*a209+25*a210+24*a211+23*a212+22*a213+21*a214+20*a215+19*a216+18*a217+17*a218+16*a219+15*a220+14*a221+13*a222+12*a223+11*a224+10*a225+9*a226+8*a227+7*a228+6*a229+5*a230+4*a231+3*a232+2*a233+1*a234)
-#define PP_CSUM_235(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232,a233,a234,a235) (235*a1+234*a2+233*a3+232*a4+231*a5+230*a6+229*a7+228*a8+227*a9+226*a10+225*a11+224*a12+223*a13+222*a14+221*a15+220*a16+219*a17+218*a18+217*a19+216*a20+215*a21+214*a22+213*a23+212*a24+211*a25+210*a26+209*a27+208*a28+207*a29+206*a30+205*a31+204*a32+203*a33+202*a34+201*a35+200*a36+199*a37+198*a38+197*a39+196*a40+195*a41+194*a42+193*a43+192*a44+191*a45+190*a46+189*a47+188*a48+187*a49+186*a50+185*a51+184*a52+183*a53+182*a54+181*a55+180*a56+179*a57+178*a58+177*a59+176*a60+175*a61+174*a62+173*a63+172*a64+171*a65+170*a66+169*a67+168*a68+167*a69+166*a70+165*a71+164*a72+163*a73+162*a74+161*a75+160*a76+159*a77+158*a78+157*a79+156*a80+155*a81+154*a82+153*a83+152*a84+151*a85+150*a86+149*a87+148*a88+147*a89+146*a90+145*a91+144*a92+143*a93+142*a94+141*a95+140*a96+139*a97+138*a98+137*a99+136*a100+135*a101+134*a102+133*a103+132*a104+131*a105+130*a106+129*a107+128*a108+127*a109+126*a110+125*a111+124*a112+123*a113+122*a114+121*a115+120*a116+119*a117+118*a118+117*a119+116*a120+115*a121+114*a122+113*a123+112*a124+111*a125+110*a126+109*a127+108*a128+107*a129+106*a130+105*a131+104*a132+103*a133+102*a134+101*a135+100*a136+99*a137+98*a138+97*a139+96*a140+95*a141+94*a142+93*a143+92*a144+91*a145+90*a146+89*a147+88*a148+87*a149+86*a150+85*a151+84*a152+83*a153+82*a154+81*a155+80*a156+79*a157+78*a158+77*a159+76*a160+75*a161+74*a162+73*a163+72*a164+71*a165+70*a166+69*a167+68*a168+67*a169+66*a170+65*a171+64*a172+63*a173+62*a174+61*a175+60*a176+59*a177+58*a178+57*a179+56*a180+55*a181+54*a182+53*a183+52*a184+51*a185+50*a186+49*a187+48*a188+47*a189+46*a190+45*a191+44*a192+43*a193+42*a194+41*a195+40*a196+39*a197+38*a198+37*a199+36*a200+35*a201+34*a202+33*a203+32*a204+31*a205+30*a206+29*a207+28*a208+27*a209+26*a210+25*a211+24*a212+23*a213+22*a214+21*a215+20*a216+19*a217+18*a218+17*a219+16*a220+15*a221+14*a222+13*a223+12*a224+11*a225+10*a226+9*a227+8*a228+7*a229+6*a230+5*a231+4*a232+3*a233+2*a234+1*a235)
-#define PP_CSUM_236(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232,a233,a234,a235,a236) (236*a1+235*a2+234*a3+233*a4+232*a5+231*a6+230*a7+229*a8+228*a9+227*a10+226*a11+225*a12+224*a13+223*a14+222*a15+221*a16+220*a17+219*a18+218*a19+217*a20+216*a21+215*a22+214*a23+213*a24+212*a25+211*a26+210*a27+209*a28+208*a29+207*a30+206*a31+205*a32+204*a33+203*a34+202*a35+201*a36+200*a37+199*a38+198*a39+197*a40+196*a41+195*a42+194*a43+193*a44+192*a45+191*a46+190*a47+189*a48+188*a49+187*a50+186*a51+185*a52+184*a53+183*a54+182*a55+181*a56+180*a57+179*a58+178*a59+177*a60+176*a61+175*a62+174*a63+173*a64+172*a65+171*a66+170*a67+169*a68+168*a69+167*a70+166*a71+165*a72+164*a73+163*a74+162*a75+161*a76+160*a77+159*a78+158*a79+157*a80+156*a81+155*a82+154*a83+153*a84+152*a85+151*a86+150*a87+149*a88+148*a89+147*a90+146*a91+145*a92+144*a93+143*a94+142*a95+141*a96+140*a97+139*a98+138*a99+137*a100+136*a101+135*a102+134*a103+133*a104+132*a105+131*a106+130*a107+129*a108+128*a109+127*a110+126*a111+125*a112+124*a113+123*a114+122*a115+121*a116+120*a117+119*a118+118*a119+117*a120+116*a121+115*a122+114*a123+113*a124+112*a125+111*a126+110*a127+109*a128+108*a129+107*a130+106*a131+105*a132+104*a133+103*a134+102*a135+101*a136+100*a137+99*a138+98*a139+97*a140+96*a141+95*a142+94*a143+93*a144+92*a145+91*a146+90*a147+89*a148+88*a149+87*a150+86*a151+85*a152+84*a153+83*a154+82*a155+81*a156+80*a157+79*a158+78*a159+77*a160+76*a161+75*a162+74*a163+73*a164+72*a165+71*a166+70*a167+69*a168+68*a169+67*a170+66*a171+65*a172+64*a173+63*a174+62*a175+61*a176+60*a177+59*a178+58*a179+57*a180+56*a181+55*a182+54*a183+53*a184+52*a185+51*a186+50*a187+49*a188+48*a189+47*a190+46*a191+45*a192+44*a193+43*a194+42*a195+41*a196+40*a197+39*a198+38*a199+37*a200+36*a201+35*a202+34*a203+33*a204+32*a205+31*a206+30*a207+29*a208+28*a209+27*a210+26*a211+25*a212+24*a213+23*a214+22*a215+21*a216+20*a217+19*a218+18*a219+17*a220+16*a221+15*a222+14*a223+13*a224+12*a225+11*a226+10*a227+9*a228+8*a229+7*a230+6*a231+5*a232+4*a233+3*a234+2*a235+1*a236)
-#define PP_CSUM_237(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232,a233,a234,a235,a236,a237) (237*a1+236*a2+235*a3+234*a4+233*a5+232*a6+231*a7+230*a8+229*a9+228*a10+227*a11+226*a12+225*a13+224*a14+223*a15+222*a16+221*a17+220*a18+219*a19+218*a20+217*a21+216*a22+215*a23+214*a24+213*a25+212*a26+211*a27+210*a28+209*a29+208*a30+207*a31+206*a32+205*a33+204*a34+203*a35+202*a36+201*a37+200*a38+199*a39+198*a40+197*a41+196*a42+195*a43+194*a44+193*a45+192*a46+191*a47+190*a48+189*a49+188*a50+187*a51+186*a52+185*a53+184*a54+183*a55+182*a56+181*a57+180*a58+179*a59+178*a60+177*a61+176*a62+175*a63+174*a64+173*a65+172*a66+171*a67+170*a68+169*a69+168*a70+167*a71+166*a72+165*a73+164*a74+163*a75+162*a76+161*a77+160*a78+159*a79+158*a80+157*a81+156*a82+155*a83+154*a84+153*a85+152*a86+151*a87+150*a88+149*a89+148*a90+147*a91+146*a92+145*a93+144*a94+143*a95+142*a96+141*a97+140*a98+139*a99+138*a100+137*a101+136*a102+135*a103+134*a104+133*a105+132*a106+131*a107+130*a108+129*a109+128*a110+127*a111+126*a112+125*a113+124*a114+123*a115+122*a116+121*a117+120*a118+119*a119+118*a120+117*a121+116*a122+115*a123+114*a124+113*a125+112*a126+111*a127+110*a128+109*a129+108*a130+107*a131+106*a132+105*a133+104*a134+103*a135+102*a136+101*a137+100*a138+99*a139+98*a140+97*a141+96*a142+95*a143+94*a144+93*a145+92*a146+91*a147+90*a148+89*a149+88*a150+87*a151+86*a152+85*a153+84*a154+83*a155+82*a156+81*a157+80*a158+79*a159+78*a160+77*a161+76*a162+75*a163+74*a164+73*a165+72*a166+71*a167+70*a168+69*a169+68*a170+67*a171+66*a172+65*a173+64*a174+63*a175+62*a176+61*a177+60*a178+59*a179+58*a180+57*a181+56*a182+55*a183+54*a184+53*a185+52*a186+51*a187+50*a188+49*a189+48*a190+47*a191+46*a192+45*a193+44*a194+43*a195+42*a196+41*a197+40*a198+39*a199+38*a200+37*a201+36*a202+35*a203+34*a204+33*a205+32*a206+31*a207+30*a208+29*a209+28*a210+27*a211+26*a212+25*a213+24*a214+23*a215+22*a216+21*a217+20*a218+19*a219+18*a220+17*a221+16*a222+15*a223+14*a224+13*a225+12*a226+11*a227+10*a228+9*a229+8*a230+7*a231+6*a232+5*a233+4*a234+3*a235+2*a236+1*a237)
-#define PP_CSUM_238(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232,a233,a234,a235,a236,a237,a238) (238*a1+237*a2+236*a3+235*a4+234*a5+233*a6+232*a7+231*a8+230*a9+229*a10+228*a11+227*a12+226*a13+225*a14+224*a15+223*a16+222*a17+221*a18+220*a19+219*a20+218*a21+217*a22+216*a23+215*a24+214*a25+213*a26+212*a27+211*a28+210*a29+209*a30+208*a31+207*a32+206*a33+205*a34+204*a35+203*a36+202*a37+201*a38+200*a39+199*a40+198*a41+197*a42+196*a43+195*a44+194*a45+193*a46+192*a47+191*a48+190*a49+189*a50+188*a51+187*a52+186*a53+185*a54+184*a55+183*a56+182*a57+181*a58+180*a59+179*a60+178*a61+177*a62+176*a63+175*a64+174*a65+173*a66+172*a67+171*a68+170*a69+169*a70+168*a71+167*a72+166*a73+165*a74+164*a75+163*a76+162*a77+161*a78+160*a79+159*a80+158*a81+157*a82+156*a83+155*a84+154*a85+153*a86+152*a87+151*a88+150*a89+149*a90+148*a91+147*a92+146*a93+145*a94+144*a95+143*a96+142*a97+141*a98+140*a99+139*a100+138*a101+137*a102+136*a103+135*a104+134*a105+133*a106+132*a107+131*a108+130*a109+129*a110+128*a111+127*a112+126*a113+125*a114+124*a115+123*a116+122*a117+121*a118+120*a119+119*a120+118*a121+117*a122+116*a123+115*a124+114*a125+113*a126+112*a127+111*a128+110*a129+109*a130+108*a131+107*a132+106*a133+105*a134+104*a135+103*a136+102*a137+101*a138+100*a139+99*a140+98*a141+97*a142+96*a143+95*a144+94*a145+93*a146+92*a147+91*a148+90*a149+89*a150+88*a151+87*a152+86*a153+85*a154+84*a155+83*a156+82*a157+81*a158+80*a159+79*a160+78*a161+77*a162+76*a163+75*a164+74*a165+73*a166+72*a167+71*a168+70*a169+69*a170+68*a171+67*a172+66*a173+65*a174+64*a175+63*a176+62*a177+61*a178+60*a179+59*a180+58*a181+57*a182+56*a183+55*a184+54*a185+53*a186+52*a187+51*a188+50*a189+49*a190+48*a191+47*a192+46*a193+45*a194+44*a195+43*a196+42*a197+41*a198+40*a199+39*a200+38*a201+37*a202+36*a203+35*a204+34*a205+33*a206+32*a207+31*a208+30*a209+29*a210+28*a211+27*a212+26*a213+25*a214+24*a215+23*a216+22*a217+21*a218+20*a219+19*a220+18*a221+17*a222+16*a223+15*a224+14*a225+13*a226+12*a227+11*a228+10*a229+9*a230+8*a231+7*a232+6*a233+5*a234+4*a235+3*a236+2*a237+1*a238)
-#define PP_CSUM_239(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232,a233,a234,a235,a236,a237,a238,a239) (239*a1+238*a2+237*a3+236*a4+235*a5+234*a6+233*a7+232*a8+231*a9+230*a10+229*a11+228*a12+227*a13+226*a14+225*a15+224*a16+223*a17+222*a18+221*a19+220*a20+219*a21+218*a22+217*a23+216*a24+215*a25+214*a26+213*a27+212*a28+211*a29+210*a30+209*a31+208*a32+207*a33+206*a34+205*a35+204*a36+203*a37+202*a38+201*a39+200*a40+199*a41+198*a42+197*a43+196*a44+195*a45+194*a46+193*a47+192*a48+191*a49+190*a50+189*a51+188*a52+187*a53+186*a54+185*a55+184*a56+183*a57+182*a58+181*a59+180*a60+179*a61+178*a62+177*a63+176*a64+175*a65+174*a66+173*a67+172*a68+171*a69+170*a70+169*a71+168*a72+167*a73+166*a74+165*a75+164*a76+163*a77+162*a78+161*a79+160*a80+159*a81+158*a82+157*a83+156*a84+155*a85+154*a86+153*a87+152*a88+151*a89+150*a90+149*a91+148*a92+147*a93+146*a94+145*a95+144*a96+143*a97+142*a98+141*a99+140*a100+139*a101+138*a102+137*a103+136*a104+135*a105+134*a106+133*a107+132*a108+131*a109+130*a110+129*a111+128*a112+127*a113+126*a114+125*a115+124*a116+123*a117+122*a118+121*a119+120*a120+119*a121+118*a122+117*a123+116*a124+115*a125+114*a126+113*a127+112*a128+111*a129+110*a130+109*a131+108*a132+107*a133+106*a134+105*a135+104*a136+103*a137+102*a138+101*a139+100*a140+99*a141+98*a142+97*a143+96*a144+95*a145+94*a146+93*a147+92*a148+91*a149+90*a150+89*a151+88*a152+87*a153+86*a154+85*a155+84*a156+83*a157+82*a158+81*a159+80*a160+79*a161+78*a162+77*a163+76*a164+75*a165+74*a166+73*a167+72*a168+71*a169+70*a170+69*a171+68*a172+67*a173+66*a174+65*a175+64*a176+63*a177+62*a178+61*a179+60*a180+59*a181+58*a182+57*a183+56*a184+55*a185+54*a186+53*a187+52*a188+51*a189+50*a190+49*a191+48*a192+47*a193+46*a194+45*a195+44*a196+43*a197+42*a198+41*a199+40*a200+39*a201+38*a202+37*a203+36*a204+35*a205+34*a206+33*a207+32*a208+31*a209+30*a210+29*a211+28*a212+27*a213+26*a214+25*a215+24*a216+23*a217+22*a218+21*a219+20*a220+19*a221+18*a222+17*a223+16*a224+15*a225+14*a226+13*a227+12*a228+11*a229+10*a230+9*a231+8*a232+7*a233+6*a234+5*a235+4*a236+3*a237+2*a238+1*a239)
-#define PP_CSUM_240(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232,a233,a234,a235,a236,a237,a238,a239,a240) (240*a1+239*a2+238*a3+237*a4+236*a5+235*a6+234*a7+233*a8+232*a9+231*a10+230*a11+229*a12+228*a13+227*a14+226*a15+225*a16+224*a17+223*a18+222*a19+221*a20+220*a21+219*a22+218*a23+217*a24+216*a25+215*a26+214*a27+213*a28+212*a29+211*a30+210*a31+209*a32+208*a33+207*a34+206*a35+205*a36+204*a37+203*a38+202*a39+201*a40+200*a41+199*a42+198*a43+197*a44+196*a45+195*a46+194*a47+193*a48+192*a49+191*a50+190*a51+189*a52+188*a53+187*a54+186*a55+185*a56+184*a57+183*a58+182*a59+181*a60+180*a61+179*a62+178*a63+177*a64+176*a65+175*a66+174*a67+173*a68+172*a69+171*a70+170*a71+169*a72+168*a73+167*a74+166*a75+165*a76+164*a77+163*a78+162*a79+161*a80+160*a81+159*a82+158*a83+157*a84+156*a85+155*a86+154*a87+153*a88+152*a89+151*a90+150*a91+149*a92+148*a93+147*a94+146*a95+145*a96+144*a97+143*a98+142*a99+141*a100+140*a101+139*a102+138*a103+137*a104+136*a105+135*a106+134*a107+133*a108+132*a109+131*a110+130*a111+129*a112+128*a113+127*a114+126*a115+125*a116+124*a117+123*a118+122*a119+121*a120+120*a121+119*a122+118*a123+117*a124+116*a125+115*a126+114*a127+113*a128+112*a129+111*a130+110*a131+109*a132+108*a133+107*a134+106*a135+105*a136+104*a137+103*a138+102*a139+101*a140+100*a141+99*a142+98*a143+97*a144+96*a145+95*a146+94*a147+93*a148+92*a149+91*a150+90*a151+89*a152+88*a153+87*a154+86*a155+85*a156+84*a157+83*a158+82*a159+81*a160+80*a161+79*a162+78*a163+77*a164+76*a165+75*a166+74*a167+73*a168+72*a169+71*a170+70*a171+69*a172+68*a173+67*a174+66*a175+65*a176+64*a177+63*a178+62*a179+61*a180+60*a181+59*a182+58*a183+57*a184+56*a185+55*a186+54*a187+53*a188+52*a189+51*a190+50*a191+49*a192+48*a193+47*a194+46*a195+45*a196+44*a197+43*a198+42*a199+41*a200+40*a201+39*a202+38*a203+37*a204+36*a205+35*a206+34*a207+33*a208+32*a209+31*a210+30*a211+29*a212+28*a213+27*a214+26*a215+25*a216+24*a217+23*a218+22*a219+21*a220+20*a221+19*a222+18*a223+17*a224+16*a225+15*a226+14*a227+13*a228+12*a229+11*a230+10*a231+9*a232+8*a233+7*a234+6*a235+5*a236+4*a237+3*a238+2*a239+1*a240)
-#define PP_CSUM_241(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232,a233,a234,a235,a236,a237,a238,a239,a240,a241) (241*a1+240*a2+239*a3+238*a4+237*a5+236*a6+235*a7+234*a8+233*a9+232*a10+231*a11+230*a12+229*a13+228*a14+227*a15+226*a16+225*a17+224*a18+223*a19+222*a20+221*a21+220*a22+219*a23+218*a24+217*a25+216*a26+215*a27+214*a28+213*a29+212*a30+211*a31+210*a32+209*a33+208*a34+207*a35+206*a36+205*a37+204*a38+203*a39+202*a40+201*a41+200*a42+199*a43+198*a44+197*a45+196*a46+195*a47+194*a48+193*a49+192*a50+191*a51+190*a52+189*a53+188*a54+187*a55+186*a56+185*a57+184*a58+183*a59+182*a60+181*a61+180*a62+179*a63+178*a64+177*a65+176*a66+175*a67+174*a68+173*a69+172*a70+171*a71+170*a72+169*a73+168*a74+167*a75+166*a76+165*a77+164*a78+163*a79+162*a80+161*a81+160*a82+159*a83+158*a84+157*a85+156*a86+155*a87+154*a88+153*a89+152*a90+151*a91+150*a92+149*a93+148*a94+147*a95+146*a96+145*a97+144*a98+143*a99+142*a100+141*a101+140*a102+139*a103+138*a104+137*a105+136*a106+135*a107+134*a108+133*a109+132*a110+131*a111+130*a112+129*a113+128*a114+127*a115+126*a116+125*a117+124*a118+123*a119+122*a120+121*a121+120*a122+119*a123+118*a124+117*a125+116*a126+115*a127+114*a128+113*a129+112*a130+111*a131+110*a132+109*a133+108*a134+107*a135+106*a136+105*a137+104*a138+103*a139+102*a140+101*a141+100*a142+99*a143+98*a144+97*a145+96*a146+95*a147+94*a148+93*a149+92*a150+91*a151+90*a152+89*a153+88*a154+87*a155+86*a156+85*a157+84*a158+83*a159+82*a160+81*a161+80*a162+79*a163+78*a164+77*a165+76*a166+75*a167+74*a168+73*a169+72*a170+71*a171+70*a172+69*a173+68*a174+67*a175+66*a176+65*a177+64*a178+63*a179+62*a180+61*a181+60*a182+59*a183+58*a184+57*a185+56*a186+55*a187+54*a188+53*a189+52*a190+51*a191+50*a192+49*a193+48*a194+47*a195+46*a196+45*a197+44*a198+43*a199+42*a200+41*a201+40*a202+39*a203+38*a204+37*a205+36*a206+35*a207+34*a208+33*a209+32*a210+31*a211+30*a212+29*a213+28*a214+27*a215+26*a216+25*a217+24*a218+23*a219+22*a220+21*a221+20*a222+19*a223+18*a224+17*a225+16*a226+15*a227+14*a228+13*a229+12*a230+11*a231+10*a232+9*a233+8*a234+7*a235+6*a236+5*a237+4*a238+3*a239+2*a240+1*a241)
-#define PP_CSUM_242(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232,a233,a234,a235,a236,a237,a238,a239,a240,a241,a242) (242*a1+241*a2+240*a3+239*a4+238*a5+237*a6+236*a7+235*a8+234*a9+233*a10+232*a11+231*a12+230*a13+229*a14+228*a15+227*a16+226*a17+225*a18+224*a19+223*a20+222*a21+221*a22+220*a23+219*a24+218*a25+217*a26+216*a27+215*a28+214*a29+213*a30+212*a31+211*a32+210*a33+209*a34+208*a35+207*a36+206*a37+205*a38+204*a39+203*a40+202*a41+201*a42+200*a43+199*a44+198*a45+197*a46+196*a47+195*a48+194*a49+193*a50+192*a51+191*a52+190*a53+189*a54+188*a55+187*a56+186*a57+185*a58+184*a59+183*a60+182*a61+181*a62+180*a63+179*a64+178*a65+177*a66+176*a67+175*a68+174*a69+173*a70+172*a71+171*a72+170*a73+169*a74+168*a75+167*a76+166*a77+165*a78+164*a79+163*a80+162*a81+161*a82+160*a83+159*a84+158*a85+157*a86+156*a87+155*a88+154*a89+153*a90+152*a91+151*a92+150*a93+149*a94+148*a95+147*a96+146*a97+145*a98+144*a99+143*a100+142*a101+141*a102+140*a103+139*a104+138*a105+137*a106+136*a107+135*a108+134*a109+133*a110+132*a111+131*a112+130*a113+129*a114+128*a115+127*a116+126*a117+125*a118+124*a119+123*a120+122*a121+121*a122+120*a123+119*a124+118*a125+117*a126+116*a127+115*a128+114*a129+113*a130+112*a131+111*a132+110*a133+109*a134+108*a135+107*a136+106*a137+105*a138+104*a139+103*a140+102*a141+101*a142+100*a143+99*a144+98*a145+97*a146+96*a147+95*a148+94*a149+93*a150+92*a151+91*a152+90*a153+89*a154+88*a155+87*a156+86*a157+85*a158+84*a159+83*a160+82*a161+81*a162+80*a163+79*a164+78*a165+77*a166+76*a167+75*a168+74*a169+73*a170+72*a171+71*a172+70*a173+69*a174+68*a175+67*a176+66*a177+65*a178+64*a179+63*a180+62*a181+61*a182+60*a183+59*a184+58*a185+57*a186+56*a187+55*a188+54*a189+53*a190+52*a191+51*a192+50*a193+49*a194+48*a195+47*a196+46*a197+45*a198+44*a199+43*a200+42*a201+41*a202+40*a203+39*a204+38*a205+37*a206+36*a207+35*a208+34*a209+33*a210+32*a211+31*a212+30*a213+29*a214+28*a215+27*a216+26*a217+25*a218+24*a219+23*a220+22*a221+21*a222+20*a223+19*a224+18*a225+17*a226+16*a227+15*a228+14*a229+13*a230+12*a231+11*a232+10*a233+9*a234+8*a235+7*a236+6*a237+5*a238+4*a239+3*a240+2*a241+1*a242)
-#define PP_CSUM_243(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232,a233,a234,a235,a236,a237,a238,a239,a240,a241,a242,a243) (243*a1+242*a2+241*a3+240*a4+239*a5+238*a6+237*a7+236*a8+235*a9+234*a10+233*a11+232*a12+231*a13+230*a14+229*a15+228*a16+227*a17+226*a18+225*a19+224*a20+223*a21+222*a22+221*a23+220*a24+219*a25+218*a26+217*a27+216*a28+215*a29+214*a30+213*a31+212*a32+211*a33+210*a34+209*a35+208*a36+207*a37+206*a38+205*a39+204*a40+203*a41+202*a42+201*a43+200*a44+199*a45+198*a46+197*a47+196*a48+195*a49+194*a50+193*a51+192*a52+191*a53+190*a54+189*a55+188*a56+187*a57+186*a58+185*a59+184*a60+183*a61+182*a62+181*a63+180*a64+179*a65+178*a66+177*a67+176*a68+175*a69+174*a70+173*a71+172*a72+171*a73+170*a74+169*a75+168*a76+167*a77+166*a78+165*a79+164*a80+163*a81+162*a82+161*a83+160*a84+159*a85+158*a86+157*a87+156*a88+155*a89+154*a90+153*a91+152*a92+151*a93+150*a94+149*a95+148*a96+147*a97+146*a98+145*a99+144*a100+143*a101+142*a102+141*a103+140*a104+139*a105+138*a106+137*a107+136*a108+135*a109+134*a110+133*a111+132*a112+131*a113+130*a114+129*a115+128*a116+127*a117+126*a118+125*a119+124*a120+123*a121+122*a122+121*a123+120*a124+119*a125+118*a126+117*a127+116*a128+115*a129+114*a130+113*a131+112*a132+111*a133+110*a134+109*a135+108*a136+107*a137+106*a138+105*a139+104*a140+103*a141+102*a142+101*a143+100*a144+99*a145+98*a146+97*a147+96*a148+95*a149+94*a150+93*a151+92*a152+91*a153+90*a154+89*a155+88*a156+87*a157+86*a158+85*a159+84*a160+83*a161+82*a162+81*a163+80*a164+79*a165+78*a166+77*a167+76*a168+75*a169+74*a170+73*a171+72*a172+71*a173+70*a174+69*a175+68*a176+67*a177+66*a178+65*a179+64*a180+63*a181+62*a182+61*a183+60*a184+59*a185+58*a186+57*a187+56*a188+55*a189+54*a190+53*a191+52*a192+51*a193+50*a194+49*a195+48*a196+47*a197+46*a198+45*a199+44*a200+43*a201+42*a202+41*a203+40*a204+39*a205+38*a206+37*a207+36*a208+35*a209+34*a210+33*a211+32*a212+31*a213+30*a214+29*a215+28*a216+27*a217+26*a218+25*a219+24*a220+23*a221+22*a222+21*a223+20*a224+19*a225+18*a226+17*a227+16*a228+15*a229+14*a230+13*a231+12*a232+11*a233+10*a234+9*a235+8*a236+7*a237+6*a238+5*a239+4*a240+3*a241+2*a242+1*a243)
-#define PP_CSUM_244(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232,a233,a234,a235,a236,a237,a238,a239,a240,a241,a242,a243,a244) (244*a1+243*a2+242*a3+241*a4+240*a5+239*a6+238*a7+237*a8+236*a9+235*a10+234*a11+233*a12+232*a13+231*a14+230*a15+229*a16+228*a17+227*a18+226*a19+225*a20+224*a21+223*a22+222*a23+221*a24+220*a25+219*a26+218*a27+217*a28+216*a29+215*a30+214*a31+213*a32+212*a33+211*a34+210*a35+209*a36+208*a37+207*a38+206*a39+205*a40+204*a41+203*a42+202*a43+201*a44+200*a45+199*a46+198*a47+197*a48+196*a49+195*a50+194*a51+193*a52+192*a53+191*a54+190*a55+189*a56+188*a57+187*a58+186*a59+185*a60+184*a61+183*a62+182*a63+181*a64+180*a65+179*a66+178*a67+177*a68+176*a69+175*a70+174*a71+173*a72+172*a73+171*a74+170*a75+169*a76+168*a77+167*a78+166*a79+165*a80+164*a81+163*a82+162*a83+161*a84+160*a85+159*a86+158*a87+157*a88+156*a89+155*a90+154*a91+153*a92+152*a93+151*a94+150*a95+149*a96+148*a97+147*a98+146*a99+145*a100+144*a101+143*a102+142*a103+141*a104+140*a105+139*a106+138*a107+137*a108+136*a109+135*a110+134*a111+133*a112+132*a113+131*a114+130*a115+129*a116+128*a117+127*a118+126*a119+125*a120+124*a121+123*a122+122*a123+121*a124+120*a125+119*a126+118*a127+117*a128+116*a129+115*a130+114*a131+113*a132+112*a133+111*a134+110*a135+109*a136+108*a137+107*a138+106*a139+105*a140+104*a141+103*a142+102*a143+101*a144+100*a145+99*a146+98*a147+97*a148+96*a149+95*a150+94*a151+93*a152+92*a153+91*a154+90*a155+89*a156+88*a157+87*a158+86*a159+85*a160+84*a161+83*a162+82*a163+81*a164+80*a165+79*a166+78*a167+77*a168+76*a169+75*a170+74*a171+73*a172+72*a173+71*a174+70*a175+69*a176+68*a177+67*a178+66*a179+65*a180+64*a181+63*a182+62*a183+61*a184+60*a185+59*a186+58*a187+57*a188+56*a189+55*a190+54*a191+53*a192+52*a193+51*a194+50*a195+49*a196+48*a197+47*a198+46*a199+45*a200+44*a201+43*a202+42*a203+41*a204+40*a205+39*a206+38*a207+37*a208+36*a209+35*a210+34*a211+33*a212+32*a213+31*a214+30*a215+29*a216+28*a217+27*a218+26*a219+25*a220+24*a221+23*a222+22*a223+21*a224+20*a225+19*a226+18*a227+17*a228+16*a229+15*a230+14*a231+13*a232+12*a233+11*a234+10*a235+9*a236+8*a237+7*a238+6*a239+5*a240+4*a241+3*a242+2*a243+1*a244)
-#define PP_CSUM_245(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232,a233,a234,a235,a236,a237,a238,a239,a240,a241,a242,a243,a244,a245) (245*a1+244*a2+243*a3+242*a4+241*a5+240*a6+239*a7+238*a8+237*a9+236*a10+235*a11+234*a12+233*a13+232*a14+231*a15+230*a16+229*a17+228*a18+227*a19+226*a20+225*a21+224*a22+223*a23+222*a24+221*a25+220*a26+219*a27+218*a28+217*a29+216*a30+215*a31+214*a32+213*a33+212*a34+211*a35+210*a36+209*a37+208*a38+207*a39+206*a40+205*a41+204*a42+203*a43+202*a44+201*a45+200*a46+199*a47+198*a48+197*a49+196*a50+195*a51+194*a52+193*a53+192*a54+191*a55+190*a56+189*a57+188*a58+187*a59+186*a60+185*a61+184*a62+183*a63+182*a64+181*a65+180*a66+179*a67+178*a68+177*a69+176*a70+175*a71+174*a72+173*a73+172*a74+171*a75+170*a76+169*a77+168*a78+167*a79+166*a80+165*a81+164*a82+163*a83+162*a84+161*a85+160*a86+159*a87+158*a88+157*a89+156*a90+155*a91+154*a92+153*a93+152*a94+151*a95+150*a96+149*a97+148*a98+147*a99+146*a100+145*a101+144*a102+143*a103+142*a104+141*a105+140*a106+139*a107+138*a108+137*a109+136*a110+135*a111+134*a112+133*a113+132*a114+131*a115+130*a116+129*a117+128*a118+127*a119+126*a120+125*a121+124*a122+123*a123+122*a124+121*a125+120*a126+119*a127+118*a128+117*a129+116*a130+115*a131+114*a132+113*a133+112*a134+111*a135+110*a136+109*a137+108*a138+107*a139+106*a140+105*a141+104*a142+103*a143+102*a144+101*a145+100*a146+99*a147+98*a148+97*a149+96*a150+95*a151+94*a152+93*a153+92*a154+91*a155+90*a156+89*a157+88*a158+87*a159+86*a160+85*a161+84*a162+83*a163+82*a164+81*a165+80*a166+79*a167+78*a168+77*a169+76*a170+75*a171+74*a172+73*a173+72*a174+71*a175+70*a176+69*a177+68*a178+67*a179+66*a180+65*a181+64*a182+63*a183+62*a184+61*a185+60*a186+59*a187+58*a188+57*a189+56*a190+55*a191+54*a192+53*a193+52*a194+51*a195+50*a196+49*a197+48*a198+47*a199+46*a200+45*a201+44*a202+43*a203+42*a204+41*a205+40*a206+39*a207+38*a208+37*a209+36*a210+35*a211+34*a212+33*a213+32*a214+31*a215+30*a216+29*a217+28*a218+27*a219+26*a220+25*a221+24*a222+23*a223+22*a224+21*a225+20*a226+19*a227+18*a228+17*a229+16*a230+15*a231+14*a232+13*a233+12*a234+11*a235+10*a236+9*a237+8*a238+7*a239+6*a240+5*a241+4*a242+3*a243+2*a244+1*a245)
-#define PP_CSUM_246(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232,a233,a234,a235,a236,a237,a238,a239,a240,a241,a242,a243,a244,a245,a246) (246*a1+245*a2+244*a3+243*a4+242*a5+241*a6+240*a7+239*a8+238*a9+237*a10+236*a11+235*a12+234*a13+233*a14+232*a15+231*a16+230*a17+229*a18+228*a19+227*a20+226*a21+225*a22+224*a23+223*a24+222*a25+221*a26+220*a27+219*a28+218*a29+217*a30+216*a31+215*a32+214*a33+213*a34+212*a35+211*a36+210*a37+209*a38+208*a39+207*a40+206*a41+205*a42+204*a43+203*a44+202*a45+201*a46+200*a47+199*a48+198*a49+197*a50+196*a51+195*a52+194*a53+193*a54+192*a55+191*a56+190*a57+189*a58+188*a59+187*a60+186*a61+185*a62+184*a63+183*a64+182*a65+181*a66+180*a67+179*a68+178*a69+177*a70+176*a71+175*a72+174*a73+173*a74+172*a75+171*a76+170*a77+169*a78+168*a79+167*a80+166*a81+165*a82+164*a83+163*a84+162*a85+161*a86+160*a87+159*a88+158*a89+157*a90+156*a91+155*a92+154*a93+153*a94+152*a95+151*a96+150*a97+149*a98+148*a99+147*a100+146*a101+145*a102+144*a103+143*a104+142*a105+141*a106+140*a107+139*a108+138*a109+137*a110+136*a111+135*a112+134*a113+133*a114+132*a115+131*a116+130*a117+129*a118+128*a119+127*a120+126*a121+125*a122+124*a123+123*a124+122*a125+121*a126+120*a127+119*a128+118*a129+117*a130+116*a131+115*a132+114*a133+113*a134+112*a135+111*a136+110*a137+109*a138+108*a139+107*a140+106*a141+105*a142+104*a143+103*a144+102*a145+101*a146+100*a147+99*a148+98*a149+97*a150+96*a151+95*a152+94*a153+93*a154+92*a155+91*a156+90*a157+89*a158+88*a159+87*a160+86*a161+85*a162+84*a163+83*a164+82*a165+81*a166+80*a167+79*a168+78*a169+77*a170+76*a171+75*a172+74*a173+73*a174+72*a175+71*a176+70*a177+69*a178+68*a179+67*a180+66*a181+65*a182+64*a183+63*a184+62*a185+61*a186+60*a187+59*a188+58*a189+57*a190+56*a191+55*a192+54*a193+53*a194+52*a195+51*a196+50*a197+49*a198+48*a199+47*a200+46*a201+45*a202+44*a203+43*a204+42*a205+41*a206+40*a207+39*a208+38*a209+37*a210+36*a211+35*a212+34*a213+33*a214+32*a215+31*a216+30*a217+29*a218+28*a219+27*a220+26*a221+25*a222+24*a223+23*a224+22*a225+21*a226+20*a227+19*a228+18*a229+17*a230+16*a231+15*a232+14*a233+13*a234+12*a235+11*a236+10*a237+9*a238+8*a239+7*a240+6*a241+5*a242+4*a243+3*a244+2*a245+1*a246)
-#define PP_CSUM_247(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232,a233,a234,a235,a236,a237,a238,a239,a240,a241,a242,a243,a244,a245,a246,a247) (247*a1+246*a2+245*a3+244*a4+243*a5+242*a6+241*a7+240*a8+239*a9+238*a10+237*a11+236*a12+235*a13+234*a14+233*a15+232*a16+231*a17+230*a18+229*a19+228*a20+227*a21+226*a22+225*a23+224*a24+223*a25+222*a26+221*a27+220*a28+219*a29+218*a30+217*a31+216*a32+215*a33+214*a34+213*a35+212*a36+211*a37+210*a38+209*a39+208*a40+207*a41+206*a42+205*a43+204*a44+203*a45+202*a46+201*a47+200*a48+199*a49+198*a50+197*a51+196*a52+195*a53+194*a54+193*a55+192*a56+191*a57+190*a58+189*a59+188*a60+187*a61+186*a62+185*a63+184*a64+183*a65+182*a66+181*a67+180*a68+179*a69+178*a70+177*a71+176*a72+175*a73+174*a74+173*a75+172*a76+171*a77+170*a78+169*a79+168*a80+167*a81+166*a82+165*a83+164*a84+163*a85+162*a86+161*a87+160*a88+159*a89+158*a90+157*a91+156*a92+155*a93+154*a94+153*a95+152*a96+151*a97+150*a98+149*a99+148*a100+147*a101+146*a102+145*a103+144*a104+143*a105+142*a106+141*a107+140*a108+139*a109+138*a110+137*a111+136*a112+135*a113+134*a114+133*a115+132*a116+131*a117+130*a118+129*a119+128*a120+127*a121+126*a122+125*a123+124*a124+123*a125+122*a126+121*a127+120*a128+119*a129+118*a130+117*a131+116*a132+115*a133+114*a134+113*a135+112*a136+111*a137+110*a138+109*a139+108*a140+107*a141+106*a142+105*a143+104*a144+103*a145+102*a146+101*a147+100*a148+99*a149+98*a150+97*a151+96*a152+95*a153+94*a154+93*a155+92*a156+91*a157+90*a158+89*a159+88*a160+87*a161+86*a162+85*a163+84*a164+83*a165+82*a166+81*a167+80*a168+79*a169+78*a170+77*a171+76*a172+75*a173+74*a174+73*a175+72*a176+71*a177+70*a178+69*a179+68*a180+67*a181+66*a182+65*a183+64*a184+63*a185+62*a186+61*a187+60*a188+59*a189+58*a190+57*a191+56*a192+55*a193+54*a194+53*a195+52*a196+51*a197+50*a198+49*a199+48*a200+47*a201+46*a202+45*a203+44*a204+43*a205+42*a206+41*a207+40*a208+39*a209+38*a210+37*a211+36*a212+35*a213+34*a214+33*a215+32*a216+31*a217+30*a218+29*a219+28*a220+27*a221+26*a222+25*a223+24*a224+23*a225+22*a226+21*a227+20*a228+19*a229+18*a230+17*a231+16*a232+15*a233+14*a234+13*a235+12*a236+11*a237+10*a238+9*a239+8*a240+7*a241+6*a242+5*a243+4*a244+3*a245+2*a246+1*a247)
-#define PP_CSUM_248(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232,a233,a234,a235,a236,a237,a238,a239,a240,a241,a242,a243,a244,a245,a246,a247,a248) (248*a1+247*a2+246*a3+245*a4+244*a5+243*a6+242*a7+241*a8+240*a9+239*a10+238*a11+237*a12+236*a13+235*a14+234*a15+233*a16+232*a17+231*a18+230*a19+229*a20+228*a21+227*a22+226*a23+225*a24+224*a25+223*a26+222*a27+221*a28+220*a29+219*a30+218*a31+217*a32+216*a33+215*a34+214*a35+213*a36+212*a37+211*a38+210*a39+209*a40+208*a41+207*a42+206*a43+205*a44+204*a45+203*a46+202*a47+201*a48+200*a49+199*a50+198*a51+197*a52+196*a53+195*a54+194*a55+193*a56+192*a57+191*a58+190*a59+189*a60+188*a61+187*a62+186*a63+185*a64+184*a65+183*a66+182*a67+181*a68+180*a69+179*a70+178*a71+177*a72+176*a73+175*a74+174*a75+173*a76+172*a77+171*a78+170*a79+169*a80+168*a81+167*a82+166*a83+165*a84+164*a85+163*a86+162*a87+161*a88+160*a89+159*a90+158*a91+157*a92+156*a93+155*a94+154*a95+153*a96+152*a97+151*a98+150*a99+149*a100+148*a101+147*a102+146*a103+145*a104+144*a105+143*a106+142*a107+141*a108+140*a109+139*a110+138*a111+137*a112+136*a113+135*a114+134*a115+133*a116+132*a117+131*a118+130*a119+129*a120+128*a121+127*a122+126*a123+125*a124+124*a125+123*a126+122*a127+121*a128+120*a129+119*a130+118*a131+117*a132+116*a133+115*a134+114*a135+113*a136+112*a137+111*a138+110*a139+109*a140+108*a141+107*a142+106*a143+105*a144+104*a145+103*a146+102*a147+101*a148+100*a149+99*a150+98*a151+97*a152+96*a153+95*a154+94*a155+93*a156+92*a157+91*a158+90*a159+89*a160+88*a161+87*a162+86*a163+85*a164+84*a165+83*a166+82*a167+81*a168+80*a169+79*a170+78*a171+77*a172+76*a173+75*a174+74*a175+73*a176+72*a177+71*a178+70*a179+69*a180+68*a181+67*a182+66*a183+65*a184+64*a185+63*a186+62*a187+61*a188+60*a189+59*a190+58*a191+57*a192+56*a193+55*a194+54*a195+53*a196+52*a197+51*a198+50*a199+49*a200+48*a201+47*a202+46*a203+45*a204+44*a205+43*a206+42*a207+41*a208+40*a209+39*a210+38*a211+37*a212+36*a213+35*a214+34*a215+33*a216+32*a217+31*a218+30*a219+29*a220+28*a221+27*a222+26*a223+25*a224+24*a225+23*a226+22*a227+21*a228+20*a229+19*a230+18*a231+17*a232+16*a233+15*a234+14*a235+13*a236+12*a237+11*a238+10*a239+9*a240+8*a241+7*a242+6*a243+5*a244+4*a245+3*a246+2*a247+1*a248)
-#define PP_CSUM_249(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232,a233,a234,a235,a236,a237,a238,a239,a240,a241,a242,a243,a244,a245,a246,a247,a248,a249) (249*a1+248*a2+247*a3+246*a4+245*a5+244*a6+243*a7+242*a8+241*a9+240*a10+239*a11+238*a12+237*a13+236*a14+235*a15+234*a16+233*a17+232*a18+231*a19+230*a20+229*a21+228*a22+227*a23+226*a24+225*a25+224*a26+223*a27+222*a28+221*a29+220*a30+219*a31+218*a32+217*a33+216*a34+215*a35+214*a36+213*a37+212*a38+211*a39+210*a40+209*a41+208*a42+207*a43+206*a44+205*a45+204*a46+203*a47+202*a48+201*a49+200*a50+199*a51+198*a52+197*a53+196*a54+195*a55+194*a56+193*a57+192*a58+191*a59+190*a60+189*a61+188*a62+187*a63+186*a64+185*a65+184*a66+183*a67+182*a68+181*a69+180*a70+179*a71+178*a72+177*a73+176*a74+175*a75+174*a76+173*a77+172*a78+171*a79+170*a80+169*a81+168*a82+167*a83+166*a84+165*a85+164*a86+163*a87+162*a88+161*a89+160*a90+159*a91+158*a92+157*a93+156*a94+155*a95+154*a96+153*a97+152*a98+151*a99+150*a100+149*a101+148*a102+147*a103+146*a104+145*a105+144*a106+143*a107+142*a108+141*a109+140*a110+139*a111+138*a112+137*a113+136*a114+135*a115+134*a116+133*a117+132*a118+131*a119+130*a120+129*a121+128*a122+127*a123+126*a124+125*a125+124*a126+123*a127+122*a128+121*a129+120*a130+119*a131+118*a132+117*a133+116*a134+115*a135+114*a136+113*a137+112*a138+111*a139+110*a140+109*a141+108*a142+107*a143+106*a144+105*a145+104*a146+103*a147+102*a148+101*a149+100*a150+99*a151+98*a152+97*a153+96*a154+95*a155+94*a156+93*a157+92*a158+91*a159+90*a160+89*a161+88*a162+87*a163+86*a164+85*a165+84*a166+83*a167+82*a168+81*a169+80*a170+79*a171+78*a172+77*a173+76*a174+75*a175+74*a176+73*a177+72*a178+71*a179+70*a180+69*a181+68*a182+67*a183+66*a184+65*a185+64*a186+63*a187+62*a188+61*a189+60*a190+59*a191+58*a192+57*a193+56*a194+55*a195+54*a196+53*a197+52*a198+51*a199+50*a200+49*a201+48*a202+47*a203+46*a204+45*a205+44*a206+43*a207+42*a208+41*a209+40*a210+39*a211+38*a212+37*a213+36*a214+35*a215+34*a216+33*a217+32*a218+31*a219+30*a220+29*a221+28*a222+27*a223+26*a224+25*a225+24*a226+23*a227+22*a228+21*a229+20*a230+19*a231+18*a232+17*a233+16*a234+15*a235+14*a236+13*a237+12*a238+11*a239+10*a240+9*a241+8*a242+7*a243+6*a244+5*a245+4*a246+3*a247+2*a248+1*a249)
-#define PP_CSUM_250(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232,a233,a234,a235,a236,a237,a238,a239,a240,a241,a242,a243,a244,a245,a246,a247,a248,a249,a250) (250*a1+249*a2+248*a3+247*a4+246*a5+245*a6+244*a7+243*a8+242*a9+241*a10+240*a11+239*a12+238*a13+237*a14+236*a15+235*a16+234*a17+233*a18+232*a19+231*a20+230*a21+229*a22+228*a23+227*a24+226*a25+225*a26+224*a27+223*a28+222*a29+221*a30+220*a31+219*a32+218*a33+217*a34+216*a35+215*a36+214*a37+213*a38+212*a39+211*a40+210*a41+209*a42+208*a43+207*a44+206*a45+205*a46+204*a47+203*a48+202*a49+201*a50+200*a51+199*a52+198*a53+197*a54+196*a55+195*a56+194*a57+193*a58+192*a59+191*a60+190*a61+189*a62+188*a63+187*a64+186*a65+185*a66+184*a67+183*a68+182*a69+181*a70+180*a71+179*a72+178*a73+177*a74+176*a75+175*a76+174*a77+173*a78+172*a79+171*a80+170*a81+169*a82+168*a83+167*a84+166*a85+165*a86+164*a87+163*a88+162*a89+161*a90+160*a91+159*a92+158*a93+157*a94+156*a95+155*a96+154*a97+153*a98+152*a99+151*a100+150*a101+149*a102+148*a103+147*a104+146*a105+145*a106+144*a107+143*a108+142*a109+141*a110+140*a111+139*a112+138*a113+137*a114+136*a115+135*a116+134*a117+133*a118+132*a119+131*a120+130*a121+129*a122+128*a123+127*a124+126*a125+125*a126+124*a127+123*a128+122*a129+121*a130+120*a131+119*a132+118*a133+117*a134+116*a135+115*a136+114*a137+113*a138+112*a139+111*a140+110*a141+109*a142+108*a143+107*a144+106*a145+105*a146+104*a147+103*a148+102*a149+101*a150+100*a151+99*a152+98*a153+97*a154+96*a155+95*a156+94*a157+93*a158+92*a159+91*a160+90*a161+89*a162+88*a163+87*a164+86*a165+85*a166+84*a167+83*a168+82*a169+81*a170+80*a171+79*a172+78*a173+77*a174+76*a175+75*a176+74*a177+73*a178+72*a179+71*a180+70*a181+69*a182+68*a183+67*a184+66*a185+65*a186+64*a187+63*a188+62*a189+61*a190+60*a191+59*a192+58*a193+57*a194+56*a195+55*a196+54*a197+53*a198+52*a199+51*a200+50*a201+49*a202+48*a203+47*a204+46*a205+45*a206+44*a207+43*a208+42*a209+41*a210+40*a211+39*a212+38*a213+37*a214+36*a215+35*a216+34*a217+33*a218+32*a219+31*a220+30*a221+29*a222+28*a223+27*a224+26*a225+25*a226+24*a227+23*a228+22*a229+21*a230+20*a231+19*a232+18*a233+17*a234+16*a235+15*a236+14*a237+13*a238+12*a239+11*a240+10*a241+9*a242+8*a243+7*a244+6*a245+5*a246+4*a247+3*a248+2*a249+1*a250)
-#define PP_CSUM_251(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232,a233,a234,a235,a236,a237,a238,a239,a240,a241,a242,a243,a244,a245,a246,a247,a248,a249,a250,a251) (251*a1+250*a2+249*a3+248*a4+247*a5+246*a6+245*a7+244*a8+243*a9+242*a10+241*a11+240*a12+239*a13+238*a14+237*a15+236*a16+235*a17+234*a18+233*a19+232*a20+231*a21+230*a22+229*a23+228*a24+227*a25+226*a26+225*a27+224*a28+223*a29+222*a30+221*a31+220*a32+219*a33+218*a34+217*a35+216*a36+215*a37+214*a38+213*a39+212*a40+211*a41+210*a42+209*a43+208*a44+207*a45+206*a46+205*a47+204*a48+203*a49+202*a50+201*a51+200*a52+199*a53+198*a54+197*a55+196*a56+195*a57+194*a58+193*a59+192*a60+191*a61+190*a62+189*a63+188*a64+187*a65+186*a66+185*a67+184*a68+183*a69+182*a70+181*a71+180*a72+179*a73+178*a74+177*a75+176*a76+175*a77+174*a78+173*a79+172*a80+171*a81+170*a82+169*a83+168*a84+167*a85+166*a86+165*a87+164*a88+163*a89+162*a90+161*a91+160*a92+159*a93+158*a94+157*a95+156*a96+155*a97+154*a98+153*a99+152*a100+151*a101+150*a102+149*a103+148*a104+147*a105+146*a106+145*a107+144*a108+143*a109+142*a110+141*a111+140*a112+139*a113+138*a114+137*a115+136*a116+135*a117+134*a118+133*a119+132*a120+131*a121+130*a122+129*a123+128*a124+127*a125+126*a126+125*a127+124*a128+123*a129+122*a130+121*a131+120*a132+119*a133+118*a134+117*a135+116*a136+115*a137+114*a138+113*a139+112*a140+111*a141+110*a142+109*a143+108*a144+107*a145+106*a146+105*a147+104*a148+103*a149+102*a150+101*a151+100*a152+99*a153+98*a154+97*a155+96*a156+95*a157+94*a158+93*a159+92*a160+91*a161+90*a162+89*a163+88*a164+87*a165+86*a166+85*a167+84*a168+83*a169+82*a170+81*a171+80*a172+79*a173+78*a174+77*a175+76*a176+75*a177+74*a178+73*a179+72*a180+71*a181+70*a182+69*a183+68*a184+67*a185+66*a186+65*a187+64*a188+63*a189+62*a190+61*a191+60*a192+59*a193+58*a194+57*a195+56*a196+55*a197+54*a198+53*a199+52*a200+51*a201+50*a202+49*a203+48*a204+47*a205+46*a206+45*a207+44*a208+43*a209+42*a210+41*a211+40*a212+39*a213+38*a214+37*a215+36*a216+35*a217+34*a218+33*a219+32*a220+31*a221+30*a222+29*a223+28*a224+27*a225+26*a226+25*a227+24*a228+23*a229+22*a230+21*a231+20*a232+19*a233+18*a234+17*a235+16*a236+15*a237+14*a238+13*a239+12*a240+11*a241+10*a242+9*a243+8*a244+7*a245+6*a246+5*a247+4*a248+3*a249+2*a250+1*a251)
-#define PP_CSUM_252(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232,a233,a234,a235,a236,a237,a238,a239,a240,a241,a242,a243,a244,a245,a246,a247,a248,a249,a250,a251,a252) (252*a1+251*a2+250*a3+249*a4+248*a5+247*a6+246*a7+245*a8+244*a9+243*a10+242*a11+241*a12+240*a13+239*a14+238*a15+237*a16+236*a17+235*a18+234*a19+233*a20+232*a21+231*a22+230*a23+229*a24+228*a25+227*a26+226*a27+225*a28+224*a29+223*a30+222*a31+221*a32+220*a33+219*a34+218*a35+217*a36+216*a37+215*a38+214*a39+213*a40+212*a41+211*a42+210*a43+209*a44+208*a45+207*a46+206*a47+205*a48+204*a49+203*a50+202*a51+201*a52+200*a53+199*a54+198*a55+197*a56+196*a57+195*a58+194*a59+193*a60+192*a61+191*a62+190*a63+189*a64+188*a65+187*a66+186*a67+185*a68+184*a69+183*a70+182*a71+181*a72+180*a73+179*a74+178*a75+177*a76+176*a77+175*a78+174*a79+173*a80+172*a81+171*a82+170*a83+169*a84+168*a85+167*a86+166*a87+165*a88+164*a89+163*a90+162*a91+161*a92+160*a93+159*a94+158*a95+157*a96+156*a97+155*a98+154*a99+153*a100+152*a101+151*a102+150*a103+149*a104+148*a105+147*a106+146*a107+145*a108+144*a109+143*a110+142*a111+141*a112+140*a113+139*a114+138*a115+137*a116+136*a117+135*a118+134*a119+133*a120+132*a121+131*a122+130*a123+129*a124+128*a125+127*a126+126*a127+125*a128+124*a129+123*a130+122*a131+121*a132+120*a133+119*a134+118*a135+117*a136+116*a137+115*a138+114*a139+113*a140+112*a141+111*a142+110*a143+109*a144+108*a145+107*a146+106*a147+105*a148+104*a149+103*a150+102*a151+101*a152+100*a153+99*a154+98*a155+97*a156+96*a157+95*a158+94*a159+93*a160+92*a161+91*a162+90*a163+89*a164+88*a165+87*a166+86*a167+85*a168+84*a169+83*a170+82*a171+81*a172+80*a173+79*a174+78*a175+77*a176+76*a177+75*a178+74*a179+73*a180+72*a181+71*a182+70*a183+69*a184+68*a185+67*a186+66*a187+65*a188+64*a189+63*a190+62*a191+61*a192+60*a193+59*a194+58*a195+57*a196+56*a197+55*a198+54*a199+53*a200+52*a201+51*a202+50*a203+49*a204+48*a205+47*a206+46*a207+45*a208+44*a209+43*a210+42*a211+41*a212+40*a213+39*a214+38*a215+37*a216+36*a217+35*a218+34*a219+33*a220+32*a221+31*a222+30*a223+29*a224+28*a225+27*a226+26*a227+25*a228+24*a229+23*a230+22*a231+21*a232+20*a233+19*a234+18*a235+17*a236+16*a237+15*a238+14*a239+13*a240+12*a241+11*a242+10*a243+9*a244+8*a245+7*a246+6*a247+5*a248+4*a249+3*a250+2*a251+1*a252)
-#define PP_CSUM_253(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232,a233,a234,a235,a236,a237,a238,a239,a240,a241,a242,a243,a244,a245,a246,a247,a248,a249,a250,a251,a252,a253) (253*a1+252*a2+251*a3+250*a4+249*a5+248*a6+247*a7+246*a8+245*a9+244*a10+243*a11+242*a12+241*a13+240*a14+239*a15+238*a16+237*a17+236*a18+235*a19+234*a20+233*a21+232*a22+231*a23+230*a24+229*a25+228*a26+227*a27+226*a28+225*a29+224*a30+223*a31+222*a32+221*a33+220*a34+219*a35+218*a36+217*a37+216*a38+215*a39+214*a40+213*a41+212*a42+211*a43+210*a44+209*a45+208*a46+207*a47+206*a48+205*a49+204*a50+203*a51+202*a52+201*a53+200*a54+199*a55+198*a56+197*a57+196*a58+195*a59+194*a60+193*a61+192*a62+191*a63+190*a64+189*a65+188*a66+187*a67+186*a68+185*a69+184*a70+183*a71+182*a72+181*a73+180*a74+179*a75+178*a76+177*a77+176*a78+175*a79+174*a80+173*a81+172*a82+171*a83+170*a84+169*a85+168*a86+167*a87+166*a88+165*a89+164*a90+163*a91+162*a92+161*a93+160*a94+159*a95+158*a96+157*a97+156*a98+155*a99+154*a100+153*a101+152*a102+151*a103+150*a104+149*a105+148*a106+147*a107+146*a108+145*a109+144*a110+143*a111+142*a112+141*a113+140*a114+139*a115+138*a116+137*a117+136*a118+135*a119+134*a120+133*a121+132*a122+131*a123+130*a124+129*a125+128*a126+127*a127+126*a128+125*a129+124*a130+123*a131+122*a132+121*a133+120*a134+119*a135+118*a136+117*a137+116*a138+115*a139+114*a140+113*a141+112*a142+111*a143+110*a144+109*a145+108*a146+107*a147+106*a148+105*a149+104*a150+103*a151+102*a152+101*a153+100*a154+99*a155+98*a156+97*a157+96*a158+95*a159+94*a160+93*a161+92*a162+91*a163+90*a164+89*a165+88*a166+87*a167+86*a168+85*a169+84*a170+83*a171+82*a172+81*a173+80*a174+79*a175+78*a176+77*a177+76*a178+75*a179+74*a180+73*a181+72*a182+71*a183+70*a184+69*a185+68*a186+67*a187+66*a188+65*a189+64*a190+63*a191+62*a192+61*a193+60*a194+59*a195+58*a196+57*a197+56*a198+55*a199+54*a200+53*a201+52*a202+51*a203+50*a204+49*a205+48*a206+47*a207+46*a208+45*a209+44*a210+43*a211+42*a212+41*a213+40*a214+39*a215+38*a216+37*a217+36*a218+35*a219+34*a220+33*a221+32*a222+31*a223+30*a224+29*a225+28*a226+27*a227+26*a228+25*a229+24*a230+23*a231+22*a232+21*a233+20*a234+19*a235+18*a236+17*a237+16*a238+15*a239+14*a240+13*a241+12*a242+11*a243+10*a244+9*a245+8*a246+7*a247+6*a248+5*a249+4*a250+3*a251+2*a252+1*a253)
-#define PP_CSUM_254(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232,a233,a234,a235,a236,a237,a238,a239,a240,a241,a242,a243,a244,a245,a246,a247,a248,a249,a250,a251,a252,a253,a254) (254*a1+253*a2+252*a3+251*a4+250*a5+249*a6+248*a7+247*a8+246*a9+245*a10+244*a11+243*a12+242*a13+241*a14+240*a15+239*a16+238*a17+237*a18+236*a19+235*a20+234*a21+233*a22+232*a23+231*a24+230*a25+229*a26+228*a27+227*a28+226*a29+225*a30+224*a31+223*a32+222*a33+221*a34+220*a35+219*a36+218*a37+217*a38+216*a39+215*a40+214*a41+213*a42+212*a43+211*a44+210*a45+209*a46+208*a47+207*a48+206*a49+205*a50+204*a51+203*a52+202*a53+201*a54+200*a55+199*a56+198*a57+197*a58+196*a59+195*a60+194*a61+193*a62+192*a63+191*a64+190*a65+189*a66+188*a67+187*a68+186*a69+185*a70+184*a71+183*a72+182*a73+181*a74+180*a75+179*a76+178*a77+177*a78+176*a79+175*a80+174*a81+173*a82+172*a83+171*a84+170*a85+169*a86+168*a87+167*a88+166*a89+165*a90+164*a91+163*a92+162*a93+161*a94+160*a95+159*a96+158*a97+157*a98+156*a99+155*a100+154*a101+153*a102+152*a103+151*a104+150*a105+149*a106+148*a107+147*a108+146*a109+145*a110+144*a111+143*a112+142*a113+141*a114+140*a115+139*a116+138*a117+137*a118+136*a119+135*a120+134*a121+133*a122+132*a123+131*a124+130*a125+129*a126+128*a127+127*a128+126*a129+125*a130+124*a131+123*a132+122*a133+121*a134+120*a135+119*a136+118*a137+117*a138+116*a139+115*a140+114*a141+113*a142+112*a143+111*a144+110*a145+109*a146+108*a147+107*a148+106*a149+105*a150+104*a151+103*a152+102*a153+101*a154+100*a155+99*a156+98*a157+97*a158+96*a159+95*a160+94*a161+93*a162+92*a163+91*a164+90*a165+89*a166+88*a167+87*a168+86*a169+85*a170+84*a171+83*a172+82*a173+81*a174+80*a175+79*a176+78*a177+77*a178+76*a179+75*a180+74*a181+73*a182+72*a183+71*a184+70*a185+69*a186+68*a187+67*a188+66*a189+65*a190+64*a191+63*a192+62*a193+61*a194+60*a195+59*a196+58*a197+57*a198+56*a199+55*a200+54*a201+53*a202+52*a203+51*a204+50*a205+49*a206+48*a207+47*a208+46*a209+45*a210+44*a211+43*a212+42*a213+41*a214+40*a215+39*a216+38*a217+37*a218+36*a219+35*a220+34*a221+33*a222+32*a223+31*a224+30*a225+29*a226+28*a227+27*a228+26*a229+25*a230+24*a231+23*a232+22*a233+21*a234+20*a235+19*a236+18*a237+17*a238+16*a239+15*a240+14*a241+13*a242+12*a243+11*a244+10*a245+9*a246+8*a247+7*a248+6*a249+5*a250+4*a251+3*a252+2*a253+1*a254)
-#define PP_CSUM_255(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232,a233,a234,a235,a236,a237,a238,a239,a240,a241,a242,a243,a244,a245,a246,a247,a248,a249,a250,a251,a252,a253,a254,a255) (255*a1+254*a2+253*a3+252*a4+251*a5+250*a6+249*a7+248*a8+247*a9+246*a10+245*a11+244*a12+243*a13+242*a14+241*a15+240*a16+239*a17+238*a18+237*a19+236*a20+235*a21+234*a22+233*a23+232*a24+231*a25+230*a26+229*a27+228*a28+227*a29+226*a30+225*a31+224*a32+223*a33+222*a34+221*a35+220*a36+219*a37+218*a38+217*a39+216*a40+215*a41+214*a42+213*a43+212*a44+211*a45+210*a46+209*a47+208*a48+207*a49+206*a50+205*a51+204*a52+203*a53+202*a54+201*a55+200*a56+199*a57+198*a58+197*a59+196*a60+195*a61+194*a62+193*a63+192*a64+191*a65+190*a66+189*a67+188*a68+187*a69+186*a70+185*a71+184*a72+183*a73+182*a74+181*a75+180*a76+179*a77+178*a78+177*a79+176*a80+175*a81+174*a82+173*a83+172*a84+171*a85+170*a86+169*a87+168*a88+167*a89+166*a90+165*a91+164*a92+163*a93+162*a94+161*a95+160*a96+159*a97+158*a98+157*a99+156*a100+155*a101+154*a102+153*a103+152*a104+151*a105+150*a106+149*a107+148*a108+147*a109+146*a110+145*a111+144*a112+143*a113+142*a114+141*a115+140*a116+139*a117+138*a118+137*a119+136*a120+135*a121+134*a122+133*a123+132*a124+131*a125+130*a126+129*a127+128*a128+127*a129+126*a130+125*a131+124*a132+123*a133+122*a134+121*a135+120*a136+119*a137+118*a138+117*a139+116*a140+115*a141+114*a142+113*a143+112*a144+111*a145+110*a146+109*a147+108*a148+107*a149+106*a150+105*a151+104*a152+103*a153+102*a154+101*a155+100*a156+99*a157+98*a158+97*a159+96*a160+95*a161+94*a162+93*a163+92*a164+91*a165+90*a166+89*a167+88*a168+87*a169+86*a170+85*a171+84*a172+83*a173+82*a174+81*a175+80*a176+79*a177+78*a178+77*a179+76*a180+75*a181+74*a182+73*a183+72*a184+71*a185+70*a186+69*a187+68*a188+67*a189+66*a190+65*a191+64*a192+63*a193+62*a194+61*a195+60*a196+59*a197+58*a198+57*a199+56*a200+55*a201+54*a202+53*a203+52*a204+51*a205+50*a206+49*a207+48*a208+47*a209+46*a210+45*a211+44*a212+43*a213+42*a214+41*a215+40*a216+39*a217+38*a218+37*a219+36*a220+35*a221+34*a222+33*a223+32*a224+31*a225+30*a226+29*a227+28*a228+27*a229+26*a230+25*a231+24*a232+23*a233+22*a234+21*a235+20*a236+19*a237+18*a238+17*a239+16*a240+15*a241+14*a242+13*a243+12*a244+11*a245+10*a246+9*a247+8*a248+7*a249+6*a250+5*a251+4*a252+3*a253+2*a254+1*a255)
-#define PP_CSUM_256(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39,a40,a41,a42,a43,a44,a45,a46,a47,a48,a49,a50,a51,a52,a53,a54,a55,a56,a57,a58,a59,a60,a61,a62,a63,a64,a65,a66,a67,a68,a69,a70,a71,a72,a73,a74,a75,a76,a77,a78,a79,a80,a81,a82,a83,a84,a85,a86,a87,a88,a89,a90,a91,a92,a93,a94,a95,a96,a97,a98,a99,a100,a101,a102,a103,a104,a105,a106,a107,a108,a109,a110,a111,a112,a113,a114,a115,a116,a117,a118,a119,a120,a121,a122,a123,a124,a125,a126,a127,a128,a129,a130,a131,a132,a133,a134,a135,a136,a137,a138,a139,a140,a141,a142,a143,a144,a145,a146,a147,a148,a149,a150,a151,a152,a153,a154,a155,a156,a157,a158,a159,a160,a161,a162,a163,a164,a165,a166,a167,a168,a169,a170,a171,a172,a173,a174,a175,a176,a177,a178,a179,a180,a181,a182,a183,a184,a185,a186,a187,a188,a189,a190,a191,a192,a193,a194,a195,a196,a197,a198,a199,a200,a201,a202,a203,a204,a205,a206,a207,a208,a209,a210,a211,a212,a213,a214,a215,a216,a217,a218,a219,a220,a221,a222,a223,a224,a225,a226,a227,a228,a229,a230,a231,a232,a233,a234,a235,a236,a237,a238,a239,a240,a241,a242,a243,a244,a245,a246,a247,a248,a249,a250,a251,a252,a253,a254,a255,a256) (256*a1+255*a2+254*a3+253*a4+252*a5+251*a6+250*a7+249*a8+248*a9+247*a10+246*a11+245*a12+244*a13+243*a14+242*a15+241*a16+240*a17+239*a18+238*a19+237*a20+236*a21+235*a22+234*a23+233*a24+232*a25+231*a26+230*a27+229*a28+228*a29+227*a30+226*a31+225*a32+224*a33+223*a34+222*a35+221*a36+220*a37+219*a38+218*a39+217*a40+216*a41+215*a42+214*a43+213*a44+212*a45+211*a46+210*a47+209*a48+208*a49+207*a50+206*a51+205*a52+204*a53+203*a54+202*a55+201*a56+200*a57+199*a58+198*a59+197*a60+196*a61+195*a62+194*a63+193*a64+192*a65+191*a66+190*a67+189*a68+188*a69+187*a70+186*a71+185*a72+184*a73+183*a74+182*a75+181*a76+180*a77+179*a78+178*a79+177*a80+176*a81+175*a82+174*a83+173*a84+172*a85+171*a86+170*a87+169*a88+168*a89+167*a90+166*a91+165*a92+164*a93+163*a94+162*a95+161*a96+160*a97+159*a98+158*a99+157*a100+156*a101+155*a102+154*a103+153*a104+152*a105+151*a106+150*a107+149*a108+148*a109+147*a110+146*a111+145*a112+144*a113+143*a114+142*a115+141*a116+140*a117+139*a118+138*a119+137*a120+136*a121+135*a122+134*a123+133*a124+132*a125+131*a126+130*a127+129*a128+128*a129+127*a130+126*a131+125*a132+124*a133+123*a134+122*a135+121*a136+120*a137+119*a138+118*a139+117*a140+116*a141+115*a142+114*a143+113*a144+112*a145+111*a146+110*a147+109*a148+108*a149+107*a150+106*a151+105*a152+104*a153+103*a154+102*a155+101*a156+100*a157+99*a158+98*a159+97*a160+96*a161+95*a162+94*a163+93*a164+92*a165+91*a166+90*a167+89*a168+88*a169+87*a170+86*a171+85*a172+84*a173+83*a174+82*a175+81*a176+80*a177+79*a178+78*a179+77*a180+76*a181+75*a182+74*a183+73*a184+72*a185+71*a186+70*a187+69*a188+68*a189+67*a190+66*a191+65*a192+64*a193+63*a194+62*a195+61*a196+60*a197+59*a198+58*a199+57*a200+56*a201+55*a202+54*a203+53*a204+52*a205+51*a206+50*a207+49*a208+48*a209+47*a210+46*a211+45*a212+44*a213+43*a214+42*a215+41*a216+40*a217+39*a218+38*a219+37*a220+36*a221+35*a222+34*a223+33*a224+32*a225+31*a226+30*a227+29*a228+28*a229+27*a230+26*a231+25*a232+24*a233+23*a234+22*a235+21*a236+20*a237+19*a238+18*a239+17*a240+16*a241+15*a242+14*a243+13*a244+12*a245+11*a246+10*a247+9*a248+8*a249+7*a250+6*a251+5*a252+4*a253+3*a254+2*a255+1*a256)
+#define PP_CSUM_L0(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +0*(a0+0)+1*(a1+0)+2*(a2+0)+3*(a3+0)+4*(a4+0)+5*(a5+0)+6*(a6+0)+7*(a7+0)+8*(a8+0)+9*(a9+0)+10*(a10+0)+11*(a11+0)+12*(a12+0)+13*(a13+0)+14*(a14+0)+15*(a15+0)+16*(a16+0)+17*(a17+0)+18*(a18+0)+19*(a19+0)+20*(a20+0)+21*(a21+0)+22*(a22+0)+23*(a23+0)+24*(a24+0)+25*(a25+0)+26*(a26+0)+27*(a27+0)+28*(a28+0)+29*(a29+0)+30*(a30+0)+31*(a31+0) PP_JOIN(PP_CSUM_L1, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L1_END(...)
+#define PP_CSUM_L1(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +32*(a0+0)+33*(a1+0)+34*(a2+0)+35*(a3+0)+36*(a4+0)+37*(a5+0)+38*(a6+0)+39*(a7+0)+40*(a8+0)+41*(a9+0)+42*(a10+0)+43*(a11+0)+44*(a12+0)+45*(a13+0)+46*(a14+0)+47*(a15+0)+48*(a16+0)+49*(a17+0)+50*(a18+0)+51*(a19+0)+52*(a20+0)+53*(a21+0)+54*(a22+0)+55*(a23+0)+56*(a24+0)+57*(a25+0)+58*(a26+0)+59*(a27+0)+60*(a28+0)+61*(a29+0)+62*(a30+0)+63*(a31+0) PP_JOIN(PP_CSUM_L2, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L2_END(...)
+#define PP_CSUM_L2(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +64*(a0+0)+65*(a1+0)+66*(a2+0)+67*(a3+0)+68*(a4+0)+69*(a5+0)+70*(a6+0)+71*(a7+0)+72*(a8+0)+73*(a9+0)+74*(a10+0)+75*(a11+0)+76*(a12+0)+77*(a13+0)+78*(a14+0)+79*(a15+0)+80*(a16+0)+81*(a17+0)+82*(a18+0)+83*(a19+0)+84*(a20+0)+85*(a21+0)+86*(a22+0)+87*(a23+0)+88*(a24+0)+89*(a25+0)+90*(a26+0)+91*(a27+0)+92*(a28+0)+93*(a29+0)+94*(a30+0)+95*(a31+0) PP_JOIN(PP_CSUM_L3, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L3_END(...)
+#define PP_CSUM_L3(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +96*(a0+0)+97*(a1+0)+98*(a2+0)+99*(a3+0)+100*(a4+0)+101*(a5+0)+102*(a6+0)+103*(a7+0)+104*(a8+0)+105*(a9+0)+106*(a10+0)+107*(a11+0)+108*(a12+0)+109*(a13+0)+110*(a14+0)+111*(a15+0)+112*(a16+0)+113*(a17+0)+114*(a18+0)+115*(a19+0)+116*(a20+0)+117*(a21+0)+118*(a22+0)+119*(a23+0)+120*(a24+0)+121*(a25+0)+122*(a26+0)+123*(a27+0)+124*(a28+0)+125*(a29+0)+126*(a30+0)+127*(a31+0) PP_JOIN(PP_CSUM_L4, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L4_END(...)
+#define PP_CSUM_L4(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +128*(a0+0)+129*(a1+0)+130*(a2+0)+131*(a3+0)+132*(a4+0)+133*(a5+0)+134*(a6+0)+135*(a7+0)+136*(a8+0)+137*(a9+0)+138*(a10+0)+139*(a11+0)+140*(a12+0)+141*(a13+0)+142*(a14+0)+143*(a15+0)+144*(a16+0)+145*(a17+0)+146*(a18+0)+147*(a19+0)+148*(a20+0)+149*(a21+0)+150*(a22+0)+151*(a23+0)+152*(a24+0)+153*(a25+0)+154*(a26+0)+155*(a27+0)+156*(a28+0)+157*(a29+0)+158*(a30+0)+159*(a31+0) PP_JOIN(PP_CSUM_L5, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L5_END(...)
+#define PP_CSUM_L5(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +160*(a0+0)+161*(a1+0)+162*(a2+0)+163*(a3+0)+164*(a4+0)+165*(a5+0)+166*(a6+0)+167*(a7+0)+168*(a8+0)+169*(a9+0)+170*(a10+0)+171*(a11+0)+172*(a12+0)+173*(a13+0)+174*(a14+0)+175*(a15+0)+176*(a16+0)+177*(a17+0)+178*(a18+0)+179*(a19+0)+180*(a20+0)+181*(a21+0)+182*(a22+0)+183*(a23+0)+184*(a24+0)+185*(a25+0)+186*(a26+0)+187*(a27+0)+188*(a28+0)+189*(a29+0)+190*(a30+0)+191*(a31+0) PP_JOIN(PP_CSUM_L6, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L6_END(...)
+#define PP_CSUM_L6(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +192*(a0+0)+193*(a1+0)+194*(a2+0)+195*(a3+0)+196*(a4+0)+197*(a5+0)+198*(a6+0)+199*(a7+0)+200*(a8+0)+201*(a9+0)+202*(a10+0)+203*(a11+0)+204*(a12+0)+205*(a13+0)+206*(a14+0)+207*(a15+0)+208*(a16+0)+209*(a17+0)+210*(a18+0)+211*(a19+0)+212*(a20+0)+213*(a21+0)+214*(a22+0)+215*(a23+0)+216*(a24+0)+217*(a25+0)+218*(a26+0)+219*(a27+0)+220*(a28+0)+221*(a29+0)+222*(a30+0)+223*(a31+0) PP_JOIN(PP_CSUM_L7, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L7_END(...)
+#define PP_CSUM_L7(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +224*(a0+0)+225*(a1+0)+226*(a2+0)+227*(a3+0)+228*(a4+0)+229*(a5+0)+230*(a6+0)+231*(a7+0)+232*(a8+0)+233*(a9+0)+234*(a10+0)+235*(a11+0)+236*(a12+0)+237*(a13+0)+238*(a14+0)+239*(a15+0)+240*(a16+0)+241*(a17+0)+242*(a18+0)+243*(a19+0)+244*(a20+0)+245*(a21+0)+246*(a22+0)+247*(a23+0)+248*(a24+0)+249*(a25+0)+250*(a26+0)+251*(a27+0)+252*(a28+0)+253*(a29+0)+254*(a30+0)+255*(a31+0) PP_JOIN(PP_CSUM_L8, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L8_END(...)
+#define PP_CSUM_L8(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +256*(a0+0)+257*(a1+0)+258*(a2+0)+259*(a3+0)+260*(a4+0)+261*(a5+0)+262*(a6+0)+263*(a7+0)+264*(a8+0)+265*(a9+0)+266*(a10+0)+267*(a11+0)+268*(a12+0)+269*(a13+0)+270*(a14+0)+271*(a15+0)+272*(a16+0)+273*(a17+0)+274*(a18+0)+275*(a19+0)+276*(a20+0)+277*(a21+0)+278*(a22+0)+279*(a23+0)+280*(a24+0)+281*(a25+0)+282*(a26+0)+283*(a27+0)+284*(a28+0)+285*(a29+0)+286*(a30+0)+287*(a31+0) PP_JOIN(PP_CSUM_L9, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L9_END(...)
+#define PP_CSUM_L9(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +288*(a0+0)+289*(a1+0)+290*(a2+0)+291*(a3+0)+292*(a4+0)+293*(a5+0)+294*(a6+0)+295*(a7+0)+296*(a8+0)+297*(a9+0)+298*(a10+0)+299*(a11+0)+300*(a12+0)+301*(a13+0)+302*(a14+0)+303*(a15+0)+304*(a16+0)+305*(a17+0)+306*(a18+0)+307*(a19+0)+308*(a20+0)+309*(a21+0)+310*(a22+0)+311*(a23+0)+312*(a24+0)+313*(a25+0)+314*(a26+0)+315*(a27+0)+316*(a28+0)+317*(a29+0)+318*(a30+0)+319*(a31+0) PP_JOIN(PP_CSUM_L10, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L10_END(...)
+#define PP_CSUM_L10(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +320*(a0+0)+321*(a1+0)+322*(a2+0)+323*(a3+0)+324*(a4+0)+325*(a5+0)+326*(a6+0)+327*(a7+0)+328*(a8+0)+329*(a9+0)+330*(a10+0)+331*(a11+0)+332*(a12+0)+333*(a13+0)+334*(a14+0)+335*(a15+0)+336*(a16+0)+337*(a17+0)+338*(a18+0)+339*(a19+0)+340*(a20+0)+341*(a21+0)+342*(a22+0)+343*(a23+0)+344*(a24+0)+345*(a25+0)+346*(a26+0)+347*(a27+0)+348*(a28+0)+349*(a29+0)+350*(a30+0)+351*(a31+0) PP_JOIN(PP_CSUM_L11, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L11_END(...)
+#define PP_CSUM_L11(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +352*(a0+0)+353*(a1+0)+354*(a2+0)+355*(a3+0)+356*(a4+0)+357*(a5+0)+358*(a6+0)+359*(a7+0)+360*(a8+0)+361*(a9+0)+362*(a10+0)+363*(a11+0)+364*(a12+0)+365*(a13+0)+366*(a14+0)+367*(a15+0)+368*(a16+0)+369*(a17+0)+370*(a18+0)+371*(a19+0)+372*(a20+0)+373*(a21+0)+374*(a22+0)+375*(a23+0)+376*(a24+0)+377*(a25+0)+378*(a26+0)+379*(a27+0)+380*(a28+0)+381*(a29+0)+382*(a30+0)+383*(a31+0) PP_JOIN(PP_CSUM_L12, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L12_END(...)
+#define PP_CSUM_L12(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +384*(a0+0)+385*(a1+0)+386*(a2+0)+387*(a3+0)+388*(a4+0)+389*(a5+0)+390*(a6+0)+391*(a7+0)+392*(a8+0)+393*(a9+0)+394*(a10+0)+395*(a11+0)+396*(a12+0)+397*(a13+0)+398*(a14+0)+399*(a15+0)+400*(a16+0)+401*(a17+0)+402*(a18+0)+403*(a19+0)+404*(a20+0)+405*(a21+0)+406*(a22+0)+407*(a23+0)+408*(a24+0)+409*(a25+0)+410*(a26+0)+411*(a27+0)+412*(a28+0)+413*(a29+0)+414*(a30+0)+415*(a31+0) PP_JOIN(PP_CSUM_L13, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L13_END(...)
+#define PP_CSUM_L13(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +416*(a0+0)+417*(a1+0)+418*(a2+0)+419*(a3+0)+420*(a4+0)+421*(a5+0)+422*(a6+0)+423*(a7+0)+424*(a8+0)+425*(a9+0)+426*(a10+0)+427*(a11+0)+428*(a12+0)+429*(a13+0)+430*(a14+0)+431*(a15+0)+432*(a16+0)+433*(a17+0)+434*(a18+0)+435*(a19+0)+436*(a20+0)+437*(a21+0)+438*(a22+0)+439*(a23+0)+440*(a24+0)+441*(a25+0)+442*(a26+0)+443*(a27+0)+444*(a28+0)+445*(a29+0)+446*(a30+0)+447*(a31+0) PP_JOIN(PP_CSUM_L14, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L14_END(...)
+#define PP_CSUM_L14(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +448*(a0+0)+449*(a1+0)+450*(a2+0)+451*(a3+0)+452*(a4+0)+453*(a5+0)+454*(a6+0)+455*(a7+0)+456*(a8+0)+457*(a9+0)+458*(a10+0)+459*(a11+0)+460*(a12+0)+461*(a13+0)+462*(a14+0)+463*(a15+0)+464*(a16+0)+465*(a17+0)+466*(a18+0)+467*(a19+0)+468*(a20+0)+469*(a21+0)+470*(a22+0)+471*(a23+0)+472*(a24+0)+473*(a25+0)+474*(a26+0)+475*(a27+0)+476*(a28+0)+477*(a29+0)+478*(a30+0)+479*(a31+0) PP_JOIN(PP_CSUM_L15, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L15_END(...)
+#define PP_CSUM_L15(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +480*(a0+0)+481*(a1+0)+482*(a2+0)+483*(a3+0)+484*(a4+0)+485*(a5+0)+486*(a6+0)+487*(a7+0)+488*(a8+0)+489*(a9+0)+490*(a10+0)+491*(a11+0)+492*(a12+0)+493*(a13+0)+494*(a14+0)+495*(a15+0)+496*(a16+0)+497*(a17+0)+498*(a18+0)+499*(a19+0)+500*(a20+0)+501*(a21+0)+502*(a22+0)+503*(a23+0)+504*(a24+0)+505*(a25+0)+506*(a26+0)+507*(a27+0)+508*(a28+0)+509*(a29+0)+510*(a30+0)+511*(a31+0) PP_JOIN(PP_CSUM_L16, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L16_END(...)
+#define PP_CSUM_L16(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +512*(a0+0)+513*(a1+0)+514*(a2+0)+515*(a3+0)+516*(a4+0)+517*(a5+0)+518*(a6+0)+519*(a7+0)+520*(a8+0)+521*(a9+0)+522*(a10+0)+523*(a11+0)+524*(a12+0)+525*(a13+0)+526*(a14+0)+527*(a15+0)+528*(a16+0)+529*(a17+0)+530*(a18+0)+531*(a19+0)+532*(a20+0)+533*(a21+0)+534*(a22+0)+535*(a23+0)+536*(a24+0)+537*(a25+0)+538*(a26+0)+539*(a27+0)+540*(a28+0)+541*(a29+0)+542*(a30+0)+543*(a31+0) PP_JOIN(PP_CSUM_L17, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L17_END(...)
+#define PP_CSUM_L17(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +544*(a0+0)+545*(a1+0)+546*(a2+0)+547*(a3+0)+548*(a4+0)+549*(a5+0)+550*(a6+0)+551*(a7+0)+552*(a8+0)+553*(a9+0)+554*(a10+0)+555*(a11+0)+556*(a12+0)+557*(a13+0)+558*(a14+0)+559*(a15+0)+560*(a16+0)+561*(a17+0)+562*(a18+0)+563*(a19+0)+564*(a20+0)+565*(a21+0)+566*(a22+0)+567*(a23+0)+568*(a24+0)+569*(a25+0)+570*(a26+0)+571*(a27+0)+572*(a28+0)+573*(a29+0)+574*(a30+0)+575*(a31+0) PP_JOIN(PP_CSUM_L18, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L18_END(...)
+#define PP_CSUM_L18(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +576*(a0+0)+577*(a1+0)+578*(a2+0)+579*(a3+0)+580*(a4+0)+581*(a5+0)+582*(a6+0)+583*(a7+0)+584*(a8+0)+585*(a9+0)+586*(a10+0)+587*(a11+0)+588*(a12+0)+589*(a13+0)+590*(a14+0)+591*(a15+0)+592*(a16+0)+593*(a17+0)+594*(a18+0)+595*(a19+0)+596*(a20+0)+597*(a21+0)+598*(a22+0)+599*(a23+0)+600*(a24+0)+601*(a25+0)+602*(a26+0)+603*(a27+0)+604*(a28+0)+605*(a29+0)+606*(a30+0)+607*(a31+0) PP_JOIN(PP_CSUM_L19, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L19_END(...)
+#define PP_CSUM_L19(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +608*(a0+0)+609*(a1+0)+610*(a2+0)+611*(a3+0)+612*(a4+0)+613*(a5+0)+614*(a6+0)+615*(a7+0)+616*(a8+0)+617*(a9+0)+618*(a10+0)+619*(a11+0)+620*(a12+0)+621*(a13+0)+622*(a14+0)+623*(a15+0)+624*(a16+0)+625*(a17+0)+626*(a18+0)+627*(a19+0)+628*(a20+0)+629*(a21+0)+630*(a22+0)+631*(a23+0)+632*(a24+0)+633*(a25+0)+634*(a26+0)+635*(a27+0)+636*(a28+0)+637*(a29+0)+638*(a30+0)+639*(a31+0) PP_JOIN(PP_CSUM_L20, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L20_END(...)
+#define PP_CSUM_L20(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +640*(a0+0)+641*(a1+0)+642*(a2+0)+643*(a3+0)+644*(a4+0)+645*(a5+0)+646*(a6+0)+647*(a7+0)+648*(a8+0)+649*(a9+0)+650*(a10+0)+651*(a11+0)+652*(a12+0)+653*(a13+0)+654*(a14+0)+655*(a15+0)+656*(a16+0)+657*(a17+0)+658*(a18+0)+659*(a19+0)+660*(a20+0)+661*(a21+0)+662*(a22+0)+663*(a23+0)+664*(a24+0)+665*(a25+0)+666*(a26+0)+667*(a27+0)+668*(a28+0)+669*(a29+0)+670*(a30+0)+671*(a31+0) PP_JOIN(PP_CSUM_L21, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L21_END(...)
+#define PP_CSUM_L21(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +672*(a0+0)+673*(a1+0)+674*(a2+0)+675*(a3+0)+676*(a4+0)+677*(a5+0)+678*(a6+0)+679*(a7+0)+680*(a8+0)+681*(a9+0)+682*(a10+0)+683*(a11+0)+684*(a12+0)+685*(a13+0)+686*(a14+0)+687*(a15+0)+688*(a16+0)+689*(a17+0)+690*(a18+0)+691*(a19+0)+692*(a20+0)+693*(a21+0)+694*(a22+0)+695*(a23+0)+696*(a24+0)+697*(a25+0)+698*(a26+0)+699*(a27+0)+700*(a28+0)+701*(a29+0)+702*(a30+0)+703*(a31+0) PP_JOIN(PP_CSUM_L22, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L22_END(...)
+#define PP_CSUM_L22(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +704*(a0+0)+705*(a1+0)+706*(a2+0)+707*(a3+0)+708*(a4+0)+709*(a5+0)+710*(a6+0)+711*(a7+0)+712*(a8+0)+713*(a9+0)+714*(a10+0)+715*(a11+0)+716*(a12+0)+717*(a13+0)+718*(a14+0)+719*(a15+0)+720*(a16+0)+721*(a17+0)+722*(a18+0)+723*(a19+0)+724*(a20+0)+725*(a21+0)+726*(a22+0)+727*(a23+0)+728*(a24+0)+729*(a25+0)+730*(a26+0)+731*(a27+0)+732*(a28+0)+733*(a29+0)+734*(a30+0)+735*(a31+0) PP_JOIN(PP_CSUM_L23, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L23_END(...)
+#define PP_CSUM_L23(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +736*(a0+0)+737*(a1+0)+738*(a2+0)+739*(a3+0)+740*(a4+0)+741*(a5+0)+742*(a6+0)+743*(a7+0)+744*(a8+0)+745*(a9+0)+746*(a10+0)+747*(a11+0)+748*(a12+0)+749*(a13+0)+750*(a14+0)+751*(a15+0)+752*(a16+0)+753*(a17+0)+754*(a18+0)+755*(a19+0)+756*(a20+0)+757*(a21+0)+758*(a22+0)+759*(a23+0)+760*(a24+0)+761*(a25+0)+762*(a26+0)+763*(a27+0)+764*(a28+0)+765*(a29+0)+766*(a30+0)+767*(a31+0) PP_JOIN(PP_CSUM_L24, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L24_END(...)
+#define PP_CSUM_L24(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +768*(a0+0)+769*(a1+0)+770*(a2+0)+771*(a3+0)+772*(a4+0)+773*(a5+0)+774*(a6+0)+775*(a7+0)+776*(a8+0)+777*(a9+0)+778*(a10+0)+779*(a11+0)+780*(a12+0)+781*(a13+0)+782*(a14+0)+783*(a15+0)+784*(a16+0)+785*(a17+0)+786*(a18+0)+787*(a19+0)+788*(a20+0)+789*(a21+0)+790*(a22+0)+791*(a23+0)+792*(a24+0)+793*(a25+0)+794*(a26+0)+795*(a27+0)+796*(a28+0)+797*(a29+0)+798*(a30+0)+799*(a31+0) PP_JOIN(PP_CSUM_L25, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L25_END(...)
+#define PP_CSUM_L25(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +800*(a0+0)+801*(a1+0)+802*(a2+0)+803*(a3+0)+804*(a4+0)+805*(a5+0)+806*(a6+0)+807*(a7+0)+808*(a8+0)+809*(a9+0)+810*(a10+0)+811*(a11+0)+812*(a12+0)+813*(a13+0)+814*(a14+0)+815*(a15+0)+816*(a16+0)+817*(a17+0)+818*(a18+0)+819*(a19+0)+820*(a20+0)+821*(a21+0)+822*(a22+0)+823*(a23+0)+824*(a24+0)+825*(a25+0)+826*(a26+0)+827*(a27+0)+828*(a28+0)+829*(a29+0)+830*(a30+0)+831*(a31+0) PP_JOIN(PP_CSUM_L26, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L26_END(...)
+#define PP_CSUM_L26(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +832*(a0+0)+833*(a1+0)+834*(a2+0)+835*(a3+0)+836*(a4+0)+837*(a5+0)+838*(a6+0)+839*(a7+0)+840*(a8+0)+841*(a9+0)+842*(a10+0)+843*(a11+0)+844*(a12+0)+845*(a13+0)+846*(a14+0)+847*(a15+0)+848*(a16+0)+849*(a17+0)+850*(a18+0)+851*(a19+0)+852*(a20+0)+853*(a21+0)+854*(a22+0)+855*(a23+0)+856*(a24+0)+857*(a25+0)+858*(a26+0)+859*(a27+0)+860*(a28+0)+861*(a29+0)+862*(a30+0)+863*(a31+0) PP_JOIN(PP_CSUM_L27, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L27_END(...)
+#define PP_CSUM_L27(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +864*(a0+0)+865*(a1+0)+866*(a2+0)+867*(a3+0)+868*(a4+0)+869*(a5+0)+870*(a6+0)+871*(a7+0)+872*(a8+0)+873*(a9+0)+874*(a10+0)+875*(a11+0)+876*(a12+0)+877*(a13+0)+878*(a14+0)+879*(a15+0)+880*(a16+0)+881*(a17+0)+882*(a18+0)+883*(a19+0)+884*(a20+0)+885*(a21+0)+886*(a22+0)+887*(a23+0)+888*(a24+0)+889*(a25+0)+890*(a26+0)+891*(a27+0)+892*(a28+0)+893*(a29+0)+894*(a30+0)+895*(a31+0) PP_JOIN(PP_CSUM_L28, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L28_END(...)
+#define PP_CSUM_L28(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +896*(a0+0)+897*(a1+0)+898*(a2+0)+899*(a3+0)+900*(a4+0)+901*(a5+0)+902*(a6+0)+903*(a7+0)+904*(a8+0)+905*(a9+0)+906*(a10+0)+907*(a11+0)+908*(a12+0)+909*(a13+0)+910*(a14+0)+911*(a15+0)+912*(a16+0)+913*(a17+0)+914*(a18+0)+915*(a19+0)+916*(a20+0)+917*(a21+0)+918*(a22+0)+919*(a23+0)+920*(a24+0)+921*(a25+0)+922*(a26+0)+923*(a27+0)+924*(a28+0)+925*(a29+0)+926*(a30+0)+927*(a31+0) PP_JOIN(PP_CSUM_L29, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L29_END(...)
+#define PP_CSUM_L29(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +928*(a0+0)+929*(a1+0)+930*(a2+0)+931*(a3+0)+932*(a4+0)+933*(a5+0)+934*(a6+0)+935*(a7+0)+936*(a8+0)+937*(a9+0)+938*(a10+0)+939*(a11+0)+940*(a12+0)+941*(a13+0)+942*(a14+0)+943*(a15+0)+944*(a16+0)+945*(a17+0)+946*(a18+0)+947*(a19+0)+948*(a20+0)+949*(a21+0)+950*(a22+0)+951*(a23+0)+952*(a24+0)+953*(a25+0)+954*(a26+0)+955*(a27+0)+956*(a28+0)+957*(a29+0)+958*(a30+0)+959*(a31+0) PP_JOIN(PP_CSUM_L30, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L30_END(...)
+#define PP_CSUM_L30(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +960*(a0+0)+961*(a1+0)+962*(a2+0)+963*(a3+0)+964*(a4+0)+965*(a5+0)+966*(a6+0)+967*(a7+0)+968*(a8+0)+969*(a9+0)+970*(a10+0)+971*(a11+0)+972*(a12+0)+973*(a13+0)+974*(a14+0)+975*(a15+0)+976*(a16+0)+977*(a17+0)+978*(a18+0)+979*(a19+0)+980*(a20+0)+981*(a21+0)+982*(a22+0)+983*(a23+0)+984*(a24+0)+985*(a25+0)+986*(a26+0)+987*(a27+0)+988*(a28+0)+989*(a29+0)+990*(a30+0)+991*(a31+0) PP_JOIN(PP_CSUM_L31, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L31_END(...)
+#define PP_CSUM_L31(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,...) +992*(a0+0)+993*(a1+0)+994*(a2+0)+995*(a3+0)+996*(a4+0)+997*(a5+0)+998*(a6+0)+999*(a7+0)+1000*(a8+0)+1001*(a9+0)+1002*(a10+0)+1003*(a11+0)+1004*(a12+0)+1005*(a13+0)+1006*(a14+0)+1007*(a15+0)+1008*(a16+0)+1009*(a17+0)+1010*(a18+0)+1011*(a19+0)+1012*(a20+0)+1013*(a21+0)+1014*(a22+0)+1015*(a23+0)+1016*(a24+0)+1017*(a25+0)+1018*(a26+0)+1019*(a27+0)+1020*(a28+0)+1021*(a29+0)+1022*(a30+0)+1023*(a31+0) PP_JOIN(PP_CSUM_L32, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM_L32_END(...)
+#define PP_CSUM_L32(...) +PP_SUM_TOO_MANY_ARGUMENTS
 
 #endif // PP_CSUM_H_
@@ -6,10 +6,11 @@
  This header defines the core variadic preprocessor utilities:
    - Token concatenation (PP_JOIN)
    - Argument counting (PP_NARG)
-   - Argument transformation (PP_SUM, PP_CSUM)
+   - Argument transformation (PP_SUM, PP_CSUM, up to PP_SUM_MAX arguments)
+   - Per-argument expansion (PP_MAP)
 
  It includes:
-   - pp_arg.h      ->  argument counting helpers
+   - pp_arg.h      ->  argument counting helpers (PP_NARG, up to 256)
    - pp_sum.h      ->  summation macros
    - pp_csum.h     ->  cumulative summation macros
 
@@ -39,11 +40,62 @@
 #define PP_NARG_(...) PP_ARG_N(__VA_ARGS__)
 #include "pp_arg.h"
 
-// --- Transform macros ---
-#define PP_SUM(...) PP_JOIN(PP_SUM_, PP_NARG(__VA_ARGS__))(__VA_ARGS__)
-#define PP_CSUM(...) PP_JOIN(PP_CSUM_, PP_NARG(__VA_ARGS__))(__VA_ARGS__)
+// --- Test for an empty first argument ---
+//   PP_IF_END(a, ...)  ->  _END if 'a' is empty, nothing otherwise
+// Uses __VA_OPT__ (C23; GCC 8 and later accept it in every -std mode), as
+// the GNU ", ##__VA_ARGS__" comma elision does not apply with -std=c11.
+#define PP_IF_END(a, ...) PP_JOIN(PP_IF_END_, PP_IF_ARG_(a))()
+#define PP_IF_ARG_(...) __VA_OPT__(ARG)
+#define PP_IF_END_() _END
+#define PP_IF_END_ARG()
+
+// --- Transform macros (up to PP_SUM_MAX arguments) ---
+//   PP_SUM(a, b, c)   ->  a + b + c
+//   PP_CSUM(a, b, c)  ->  3*a + 2*b + 1*c
+// Both pad the list with 32 empty arguments (one chunk, see pp_sum.h) and
+// count them as 0.  PP_CSUM is N * PP_SUM less the index-weighted sum,
+// with N counted by the compiler rather than the preprocessor.
+#define PP_SUM(...) (0 PP_SUM_L0(__VA_ARGS__,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,))
+#define PP_CSUM(...) (PP_NVAL(__VA_ARGS__) * PP_SUM(__VA_ARGS__) - (0 PP_CSUM_L0(__VA_ARGS__,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,)))
+#define PP_NVAL(...) ((int)(sizeof((int[]){__VA_ARGS__}) / sizeof(int)))
 #include "pp_sum.h"
 #include "pp_csum.h"
 
+// --- Apply a macro to each argument (up to 32) ---
+//   PP_MAP(m, d, a, b, c)  ->  m(d, a) m(d, b) m(d, c)
+#define PP_MAP(m, d, ...) PP_JOIN(PP_MAP_, PP_NARG(__VA_ARGS__))(m, d, __VA_ARGS__)
+#define PP_MAP_1(m, d, a) m(d, a)
+#define PP_MAP_2(m, d, a, ...) m(d, a) PP_MAP_1(m, d, __VA_ARGS__)
+#define PP_MAP_3(m, d, a, ...) m(d, a) PP_MAP_2(m, d, __VA_ARGS__)
+#define PP_MAP_4(m, d, a, ...) m(d, a) PP_MAP_3(m, d, __VA_ARGS__)
+#define PP_MAP_5(m, d, a, ...) m(d, a) PP_MAP_4(m, d, __VA_ARGS__)
+#define PP_MAP_6(m, d, a, ...) m(d, a) PP_MAP_5(m, d, __VA_ARGS__)
+#define PP_MAP_7(m, d, a, ...) m(d, a) PP_MAP_6(m, d, __VA_ARGS__)
+#define PP_MAP_8(m, d, a, ...) m(d, a) PP_MAP_7(m, d, __VA_ARGS__)
+#define PP_MAP_9(m, d, a, ...) m(d, a) PP_MAP_8(m, d, __VA_ARGS__)
+#define PP_MAP_10(m, d, a, ...) m(d, a) PP_MAP_9(m, d, __VA_ARGS__)
+#define PP_MAP_11(m, d, a, ...) m(d, a) PP_MAP_10(m, d, __VA_ARGS__)
+#define PP_MAP_12(m, d, a, ...) m(d, a) PP_MAP_11(m, d, __VA_ARGS__)
+#define PP_MAP_13(m, d, a, ...) m(d, a) PP_MAP_12(m, d, __VA_ARGS__)
+#define PP_MAP_14(m, d, a, ...) m(d, a) PP_MAP_13(m, d, __VA_ARGS__)
+#define PP_MAP_15(m, d, a, ...) m(d, a) PP_MAP_14(m, d, __VA_ARGS__)
+#define PP_MAP_16(m, d, a, ...) m(d, a) PP_MAP_15(m, d, __VA_ARGS__)
+#define PP_MAP_17(m, d, a, ...) m(d, a) PP_MAP_16(m, d, __VA_ARGS__)
+#define PP_MAP_18(m, d, a, ...) m(d, a) PP_MAP_17(m, d, __VA_ARGS__)
+#define PP_MAP_19(m, d, a, ...) m(d, a) PP_MAP_18(m, d, __VA_ARGS__)
+#define PP_MAP_20(m, d, a, ...) m(d, a) PP_MAP_19(m, d, __VA_ARGS__)
+#define PP_MAP_21(m, d, a, ...) m(d, a) PP_MAP_20(m, d, __VA_ARGS__)
+#define PP_MAP_22(m, d, a, ...) m(d, a) PP_MAP_21(m, d, __VA_ARGS__)
+#define PP_MAP_23(m, d, a, ...) m(d, a) PP_MAP_22(m, d, __VA_ARGS__)
+#define PP_MAP_24(m, d, a, ...) m(d, a) PP_MAP_23(m, d, __VA_ARGS__)
+#define PP_MAP_25(m, d, a, ...) m(d, a) PP_MAP_24(m, d, __VA_ARGS__)
+#define PP_MAP_26(m, d, a, ...) m(d, a) PP_MAP_25(m, d, __VA_ARGS__)
+#define PP_MAP_27(m, d, a, ...) m(d, a) PP_MAP_26(m, d, __VA_ARGS__)
+#define PP_MAP_28(m, d, a, ...) m(d, a) PP_MAP_27(m, d, __VA_ARGS__)
+#define PP_MAP_29(m, d, a, ...) m(d, a) PP_MAP_28(m, d, __VA_ARGS__)
+#define PP_MAP_30(m, d, a, ...) m(d, a) PP_MAP_29(m, d, __VA_ARGS__)
+#define PP_MAP_31(m, d, a, ...) m(d, a) PP_MAP_30(m, d, __VA_ARGS__)
+#define PP_MAP_32(m, d, a, ...) m(d, a) PP_MAP_31(m, d, __VA_ARGS__)
+
 #endif // PP_UTILS_H_
 
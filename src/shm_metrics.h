@@ -0,0 +1,246 @@
+#ifndef SHM_METRICS_H
+#define SHM_METRICS_H
+/*******************************************************************************
+ shm_metrics.h
+
+ Renders an ntpgps_stats_t block (see shm_stats.h) in OpenMetrics text format.
+
+ The caller supplies the output buffer, so a scrape never allocates.  Every
+ value is read with relaxed atomics; nothing here takes a lock that the GPS
+ capture path could be waiting on.
+
+ Example:
+   static char buf[NTPGPS_METRICS_BUFSIZE];
+   size_t len = ntpgps_render_openmetrics(stats, buf, sizeof(buf));
+   write(fd, buf, len);
+
+ Copyright (C) 2025 Richard Elwell
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*******************************************************************************/
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include "shm_stats.h"
+
+#define NTPGPS_METRICS_BUFSIZE  16384
+#define NTPGPS_METRICS_CONTENT_TYPE \
+    "application/openmetrics-text; version=1.0.0; charset=utf-8"
+
+typedef struct {
+    char   *buf;
+    size_t  size;
+    size_t  len;
+} om_buf_t;
+
+// Append formatted text, silently truncating at the end of the buffer
+static void om_printf(om_buf_t *b, const char *fmt, ...)
+{
+    if (b->len + 1 >= b->size)
+        return;
+
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(b->buf + b->len, b->size - b->len, fmt, args);
+    va_end(args);
+
+    if (n < 0)
+        return;
+    if ((size_t)n >= b->size - b->len)
+        b->len = b->size - 1;  // truncated
+    else
+        b->len += n;
+}
+
+static void om_header(om_buf_t *b, const char *name, const char *type, const char *help)
+{
+    om_printf(b, "# TYPE %s %s\n# HELP %s %s\n", name, type, name, help);
+}
+
+static void om_counter(om_buf_t *b, int unit, const char *name, const char *help, uint64_t val)
+{
+    om_header(b, name, "counter", help);
+    om_printf(b, "%s_total{unit=\"%d\"} %" PRIu64 "\n", name, unit, val);
+}
+
+static void om_gauge(om_buf_t *b, int unit, const char *name, const char *help, uint64_t val)
+{
+    om_header(b, name, "gauge", help);
+    om_printf(b, "%s{unit=\"%d\"} %" PRIu64 "\n", name, unit, val);
+}
+
+static void om_histogram(om_buf_t *b, int unit, const char *name, const char *help,
+                         const ntpgps_hist_t *h)
+{
+    om_header(b, name, "histogram", help);
+
+    // bucket[i] holds values below 2^i microseconds
+    uint64_t cumulative = 0;
+    for (int i = 0; i < NTPGPS_HIST_BUCKETS - 1; i++) {
+        cumulative += atomic_load_explicit(&h->bucket[i], memory_order_relaxed);
+        om_printf(b, "%s_bucket{unit=\"%d\",le=\"%.6f\"} %" PRIu64 "\n",
+                  name, unit, (double)(1ULL << i) / 1e6, cumulative);
+    }
+    cumulative += atomic_load_explicit(&h->bucket[NTPGPS_HIST_BUCKETS - 1], memory_order_relaxed);
+    om_printf(b, "%s_bucket{unit=\"%d\",le=\"+Inf\"} %" PRIu64 "\n", name, unit, cumulative);
+    om_printf(b, "%s_count{unit=\"%d\"} %" PRIu64 "\n", name, unit, cumulative);
+    om_printf(b, "%s_sum{unit=\"%d\"} %.9f\n", name, unit,
+              (double)atomic_load_explicit(&h->sum_ns, memory_order_relaxed) / 1e9);
+}
+
+/*
+ * ntpgps_render_openmetrics()
+ * ---------------------------
+ * Writes all counters, histograms and offset statistics from 'st' into
+ * 'buf' (at most 'size' bytes, NUL-terminated) and returns the text length.
+ */
+static size_t ntpgps_render_openmetrics(const ntpgps_stats_t *st, char *buf, size_t size)
+{
+    if (!st || !buf || size == 0)
+        return 0;
+
+    om_buf_t b = { buf, size, 0 };
+    int unit = st->unit;
+    buf[0] = '\0';
+
+    om_counter(&b, unit, "ntpgps_gps_loop_iterations",
+               "GPS thread select() loop iterations.", STAT_LOAD(st, loop_counter_gps));
+    om_counter(&b, unit, "ntpgps_socket_loop_iterations",
+               "Control socket thread loop iterations.", STAT_LOAD(st, loop_counter_socket));
+
+    const char *name = "ntpgps_nmea_sentences";
+    om_header(&b, name, "counter", "NMEA sentences received, by sentence type.");
+    om_printf(&b, "%s_total{unit=\"%d\",type=\"RMC\"} %" PRIu64 "\n", name, unit, STAT_LOAD(st, nmea_rmc_count));
+    om_printf(&b, "%s_total{unit=\"%d\",type=\"ZDA\"} %" PRIu64 "\n", name, unit, STAT_LOAD(st, nmea_zda_count));
+    om_printf(&b, "%s_total{unit=\"%d\",type=\"ZDG\"} %" PRIu64 "\n", name, unit, STAT_LOAD(st, nmea_zdg_count));
+    om_printf(&b, "%s_total{unit=\"%d\",type=\"GLL\"} %" PRIu64 "\n", name, unit, STAT_LOAD(st, nmea_gll_count));
+    om_printf(&b, "%s_total{unit=\"%d\",type=\"GGA\"} %" PRIu64 "\n", name, unit, STAT_LOAD(st, nmea_gga_count));
+    om_printf(&b, "%s_total{unit=\"%d\",type=\"other\"} %" PRIu64 "\n", name, unit, STAT_LOAD(st, nmea_other_count));
+
+    om_counter(&b, unit, "ntpgps_nmea_checksum_errors",
+               "NMEA sentences with a bad checksum.", STAT_LOAD(st, nmea_badcs_count));
+    om_counter(&b, unit, "ntpgps_nmea_parse_failures",
+               "Lines that did not yield a usable time.", STAT_LOAD(st, parse_nmea_fail));
+    om_counter(&b, unit, "ntpgps_shm_writes",
+               "Samples published to the NTP SHM segment.", STAT_LOAD(st, shm_write_count));
+
+    om_histogram(&b, unit, "ntpgps_shm_publish_latency_seconds",
+                 "Time from read() of the serial chunk to the SHM write.", &st->publish_latency);
+    om_histogram(&b, unit, "ntpgps_shm_sample_interval_seconds",
+                 "Time between consecutive SHM writes.", &st->sample_interval);
+
+    ntpgps_sample_snapshot_t last;
+    if (ntpgps_sample_read(&st->last, &last) == 0 && last.gps_sec != 0) {
+        om_header(&b, "ntpgps_last_sample_timestamp_seconds", "gauge", "GPS time of the last published sample.");
+        om_printf(&b, "ntpgps_last_sample_timestamp_seconds{unit=\"%d\",type=\"%s\"} %" PRId64 ".%09" PRId32 "\n",
+                  unit, last.sentence, last.gps_sec, last.gps_nsec);
+        om_header(&b, "ntpgps_last_sample_valid", "gauge", "1 if the last sample reported a valid fix.");
+        om_printf(&b, "ntpgps_last_sample_valid{unit=\"%d\"} %" PRIu32 "\n", unit, last.valid);
+        om_header(&b, "ntpgps_last_offset_seconds", "gauge", "Receive time minus GPS time of the last sample.");
+        om_printf(&b, "ntpgps_last_offset_seconds{unit=\"%d\"} %.9f\n", unit, (double)last.offset_ns / 1e9);
+    }
+
+    uint64_t n = STAT_LOAD(st, offset.count);
+    if (n) {
+        // gauges, not a summary: the offset can be negative, and so can
+        // its sum, which OpenMetrics does not allow for a summary
+        om_counter(&b, unit, "ntpgps_offset_samples",
+                   "Samples in the offset statistics since the last reset.", n);
+        om_header(&b, "ntpgps_offset_mean_seconds", "gauge", "Mean receive time minus GPS time since the last reset.");
+        om_printf(&b, "ntpgps_offset_mean_seconds{unit=\"%d\"} %.9f\n", unit,
+                  (double)STAT_LOAD(st, offset.sum_ns) / 1e9 / (double)n);
+        om_header(&b, "ntpgps_offset_min_seconds", "gauge", "Smallest offset seen since the last reset.");
+        om_printf(&b, "ntpgps_offset_min_seconds{unit=\"%d\"} %.9f\n", unit,
+                  (double)STAT_LOAD(st, offset.min_ns) / 1e9);
+        om_header(&b, "ntpgps_offset_max_seconds", "gauge", "Largest offset seen since the last reset.");
+        om_printf(&b, "ntpgps_offset_max_seconds{unit=\"%d\"} %.9f\n", unit,
+                  (double)STAT_LOAD(st, offset.max_ns) / 1e9);
+    }
+
+    om_counter(&b, unit, "ntpgps_ubx_config_runs",
+               "Receiver configuration sequences completed.", STAT_LOAD(st, ubx_cfg_runs));
+    om_counter(&b, unit, "ntpgps_ubx_config_frames",
+               "Pipelined configuration frames written, including retries.", STAT_LOAD(st, ubx_cfg_sent));
+    om_counter(&b, unit, "ntpgps_ubx_config_retries",
+               "Configuration frames resent after a NAK or timeout.", STAT_LOAD(st, ubx_cfg_retries));
+    om_counter(&b, unit, "ntpgps_ubx_config_naks",
+               "Configuration frames rejected by the receiver.", STAT_LOAD(st, ubx_cfg_naks));
+    om_counter(&b, unit, "ntpgps_ubx_config_failures",
+               "Configuration frames given up on.", STAT_LOAD(st, ubx_cfg_failures));
+    om_counter(&b, unit, "ntpgps_ubx_config_unchanged",
+               "Configuration settings skipped because the receiver already matched.", STAT_LOAD(st, ubx_cfg_unchanged));
+    om_counter(&b, unit, "ntpgps_ubx_config_cache_hits",
+               "Configuration runs skipped for an already configured receiver.", STAT_LOAD(st, ubx_cfg_cache_hits));
+    om_counter(&b, unit, "ntpgps_ubx_config_saves",
+               "Configurations saved to receiver BBR/flash.", STAT_LOAD(st, ubx_cfg_saves));
+    om_header(&b, "ntpgps_ubx_config_duration_seconds", "gauge", "Time-to-configured of the last configuration run.");
+    om_printf(&b, "ntpgps_ubx_config_duration_seconds{unit=\"%d\"} %.9f\n", unit,
+              (double)STAT_LOAD(st, ubx_cfg_last_ns) / 1e9);
+    om_histogram(&b, unit, "ntpgps_ubx_reply_rtt_seconds",
+                 "Time from sending a UBX frame to its ACK/NAK or poll response.", &st->ubx_ack_rtt);
+
+    bool health = STAT_LOAD(st, health_polls) || STAT_LOAD(st, health_timeouts);
+    bool utc = STAT_LOAD(st, utc_reports) || (STAT_LOAD(st, health_gate) & NTPGPS_HEALTH_UTC);
+    if (health || utc) {
+        om_counter(&b, unit, "ntpgps_health_gated_samples",
+                   "Samples withheld from SHM while the receiver was unhealthy.", STAT_LOAD(st, health_gated));
+        om_gauge(&b, unit, "ntpgps_health_gate",
+                 "Reasons samples are withheld from SHM (1 = jamming, 2 = antenna, 4 = utc), 0 = publishing.",
+                 STAT_LOAD(st, health_gate));
+    }
+    if (utc) {
+        om_counter(&b, unit, "ntpgps_utc_reports",
+                   "UBX-NAV-TIMEUTC messages decoded.", STAT_LOAD(st, utc_reports));
+        om_gauge(&b, unit, "ntpgps_utc_valid_flags",
+                 "NAV-TIMEUTC validity (1 = time of week, 2 = week number, 4 = UTC).", STAT_LOAD(st, utc_valid));
+        om_header(&b, "ntpgps_utc_time_accuracy_seconds", "gauge", "NAV-TIMEUTC time accuracy estimate.");
+        om_printf(&b, "ntpgps_utc_time_accuracy_seconds{unit=\"%d\"} %.9f\n", unit,
+                  (double)STAT_LOAD(st, utc_tacc_ns) / 1e9);
+    }
+    if (health) {
+        om_counter(&b, unit, "ntpgps_health_polls",
+                   "Receiver health polls answered.", STAT_LOAD(st, health_polls));
+        om_counter(&b, unit, "ntpgps_health_poll_timeouts",
+                   "Receiver health polls not answered.", STAT_LOAD(st, health_timeouts));
+        om_counter(&b, unit, "ntpgps_health_tx_errors",
+                   "Health polls reporting a receiver TX buffer overrun.", STAT_LOAD(st, health_tx_errors));
+        om_gauge(&b, unit, "ntpgps_receiver_jamming_state",
+                 "Receiver jamming state (0 = unknown, 1 = ok, 2 = warning, 3 = critical).",
+                 STAT_LOAD(st, health_jam_state));
+        om_gauge(&b, unit, "ntpgps_receiver_jamming_indicator",
+                 "Receiver CW jamming indicator (0 = none, 255 = strong).", STAT_LOAD(st, health_jam_ind));
+        om_gauge(&b, unit, "ntpgps_receiver_antenna_status",
+                 "Antenna supervisor state (0 = init, 1 = unknown, 2 = ok, 3 = short, 4 = open).",
+                 STAT_LOAD(st, health_ant_status));
+        om_gauge(&b, unit, "ntpgps_receiver_noise_per_ms",
+                 "Noise level measured by the receiver.", STAT_LOAD(st, health_noise));
+        om_gauge(&b, unit, "ntpgps_receiver_agc_count",
+                 "Receiver AGC monitor (0..8191).", STAT_LOAD(st, health_agc));
+        om_gauge(&b, unit, "ntpgps_receiver_tx_buffer_usage_percent",
+                 "Highest receiver TX buffer usage over the last period.", STAT_LOAD(st, health_tx_usage));
+        om_gauge(&b, unit, "ntpgps_receiver_tx_buffer_peak_percent",
+                 "Highest receiver TX buffer peak usage.", STAT_LOAD(st, health_tx_peak));
+        om_gauge(&b, unit, "ntpgps_receiver_rx_buffer_peak_percent",
+                 "Highest receiver RX buffer peak usage.", STAT_LOAD(st, health_rx_peak));
+    }
+
+    om_printf(&b, "# EOF\n");
+    return b.len;
+}
+
+
+#endif // SHM_METRICS_H
@@ -0,0 +1,259 @@
+#ifndef SHM_STATS_H
+#define SHM_STATS_H
+/*******************************************************************************
+ shm_stats.h
+
+ Layout of the per-unit statistics block exported by ntpgps-shm-writer.
+
+ The writer maps this structure from /run/ntpgps/shmwriter<unit>.stats and
+ updates it in place with relaxed atomics.  Monitoring agents can mmap the
+ same file read-only and poll it without any syscalls or socket round-trips.
+
+ Example (reader side):
+   int fd = open("/run/ntpgps/shmwriter120.stats", O_RDONLY);
+   const ntpgps_stats_t *st = mmap(NULL, sizeof(*st), PROT_READ, MAP_SHARED, fd, 0);
+   if (st->magic == NTPGPS_STATS_MAGIC && st->version == NTPGPS_STATS_VERSION)
+       printf("%" PRIu64 "\n", atomic_load_explicit(&st->shm_write_count, memory_order_relaxed));
+
+ New fields are only ever appended; readers should check that 'size' covers
+ the fields they use.  'version' changes when existing fields move.
+
+ Copyright (C) 2025 Richard Elwell
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*******************************************************************************/
+#include <stdint.h>
+#include <stdatomic.h>
+
+#define NTPGPS_STATS_MAGIC      0x4e475053  /* "NGPS" */
+#define NTPGPS_STATS_VERSION    1
+#define NTPGPS_CACHELINE        64
+#define NTPGPS_HIST_BUCKETS     24          /* log2 buckets: <1us .. >=4s */
+
+#define NTPGPS_ALIGNED __attribute__((aligned(NTPGPS_CACHELINE)))
+
+// Latency histogram with power-of-two microsecond buckets.
+// bucket[0] counts values below 1 us, bucket[i] counts [2^(i-1), 2^i) us,
+// and the last bucket also absorbs everything larger.
+typedef struct {
+    _Atomic uint64_t count;
+    _Atomic uint64_t sum_ns;
+    _Atomic uint64_t max_ns;
+    _Atomic uint64_t bucket[NTPGPS_HIST_BUCKETS];
+} ntpgps_hist_t;
+
+// Running statistics of (receive time - GPS time)
+typedef struct {
+    _Atomic uint64_t count;
+    _Atomic int64_t  sum_ns;
+    _Atomic int64_t  min_ns;
+    _Atomic int64_t  max_ns;
+} ntpgps_offset_t;
+
+// Last published sample, guarded by a sequence counter.
+// seq is odd while the writer is updating the fields.
+typedef struct {
+    _Atomic uint32_t seq;
+    _Atomic uint32_t valid;         // 1 = sample passed validity checks
+    _Atomic int64_t  gps_sec;       // GPS time (seconds since epoch)
+    _Atomic int32_t  gps_nsec;      // GPS time (nanoseconds)
+    _Atomic int32_t  sentence;      // NMEA sentence type, e.g. 'Z','D','A' packed LSB first
+    _Atomic int64_t  recv_sec;      // CLOCK_REALTIME when the chunk was read
+    _Atomic int32_t  recv_nsec;
+    _Atomic int32_t  reserved0;
+    _Atomic uint64_t recv_mono_ns;  // CLOCK_MONOTONIC when the chunk was read
+    _Atomic int64_t  offset_ns;     // receive time - GPS time
+} ntpgps_sample_t;
+
+typedef struct {
+    // --- header (written once at startup) ---
+    uint32_t magic;                 // NTPGPS_STATS_MAGIC
+    uint32_t version;               // NTPGPS_STATS_VERSION
+    uint32_t size;                  // sizeof(ntpgps_stats_t)
+    int32_t  unit;                  // NTP SHM unit number
+    int32_t  pid;                   // writer process id
+    int32_t  reserved0;
+    uint64_t start_mono_ns;         // CLOCK_MONOTONIC at startup
+
+    // --- counters ---
+    NTPGPS_ALIGNED
+    _Atomic uint64_t loop_counter_gps;
+    _Atomic uint64_t loop_counter_socket;
+    _Atomic uint64_t nmea_rmc_count;
+    _Atomic uint64_t nmea_zda_count;
+    _Atomic uint64_t nmea_zdg_count;
+    _Atomic uint64_t nmea_gll_count;
+    _Atomic uint64_t nmea_gga_count;
+    _Atomic uint64_t nmea_other_count;
+    _Atomic uint64_t nmea_badcs_count;
+    _Atomic uint64_t shm_write_count;
+    _Atomic uint64_t parse_nmea_fail;
+
+    // --- last sample ---
+    NTPGPS_ALIGNED
+    ntpgps_sample_t last;
+
+    // --- histograms ---
+    NTPGPS_ALIGNED
+    ntpgps_hist_t publish_latency;  // read() of the chunk -> SHM write complete
+    NTPGPS_ALIGNED
+    ntpgps_hist_t sample_interval;  // time between consecutive SHM writes
+
+    // --- offset statistics ---
+    NTPGPS_ALIGNED
+    ntpgps_offset_t offset;
+
+    // --- receiver configuration ---
+    NTPGPS_ALIGNED
+    _Atomic uint64_t ubx_cfg_runs;       // configuration sequences completed
+    _Atomic uint64_t ubx_cfg_sent;       // pipelined frames written, incl. retries
+    _Atomic uint64_t ubx_cfg_retries;
+    _Atomic uint64_t ubx_cfg_naks;
+    _Atomic uint64_t ubx_cfg_failures;   // frames given up on
+    _Atomic uint64_t ubx_cfg_last_ns;    // time-to-configured of the last run
+    _Atomic uint64_t ubx_cfg_unchanged;  // settings not sent, receiver already matched
+    _Atomic uint64_t ubx_cfg_cache_hits; // runs skipped on a known fingerprint
+    _Atomic uint64_t ubx_cfg_saves;      // CFG-CFG saves to BBR/flash
+
+    NTPGPS_ALIGNED
+    ntpgps_hist_t ubx_ack_rtt;           // end of transmission -> ACK/NAK or poll response
+    // --- receiver health (UBX-MON-HW/RF/COMMS/TXBUF/RXBUF polls) ---
+    NTPGPS_ALIGNED
+    _Atomic uint64_t health_polls;       // health polls answered
+    _Atomic uint64_t health_timeouts;    // health polls not answered
+    _Atomic uint64_t health_gated;       // samples withheld from SHM by the health gate
+    _Atomic uint64_t health_tx_errors;   // polls reporting a TX buffer overrun/allocation error
+    _Atomic uint64_t health_last_mono_ns;// CLOCK_MONOTONIC of the last answered poll
+    _Atomic uint32_t health_gate;        // NTPGPS_HEALTH_* reasons, 0 = publishing
+    _Atomic uint32_t health_jam_state;   // 0 = unknown, 1 = ok, 2 = warning, 3 = critical
+    _Atomic uint32_t health_jam_ind;     // CW jamming indicator, 0..255
+    _Atomic uint32_t health_ant_status;  // 0 = init, 1 = unknown, 2 = ok, 3 = short, 4 = open
+    _Atomic uint32_t health_noise;       // noise level per ms
+    _Atomic uint32_t health_agc;         // AGC count, 0..8191
+    _Atomic uint32_t health_tx_usage;    // highest TX buffer usage over the last period [%]
+    _Atomic uint32_t health_tx_peak;     // highest TX buffer peak usage [%]
+    _Atomic uint32_t health_rx_peak;     // highest RX buffer peak usage [%]
+
+    // --- UTC validity (UBX-NAV-TIMEUTC, --utc-valid) ---
+    NTPGPS_ALIGNED
+    _Atomic uint64_t utc_reports;        // NAV-TIMEUTC messages decoded
+    _Atomic uint64_t utc_last_mono_ns;   // CLOCK_MONOTONIC of the last one
+    _Atomic uint32_t utc_valid;          // its valid flags: bit 0 TOW, bit 1 week, bit 2 UTC
+    _Atomic uint32_t utc_tacc_ns;        // its time accuracy estimate [ns]
+} ntpgps_stats_t;
+
+// ntpgps_stats_t.health_gate: why samples are withheld from SHM
+#define NTPGPS_HEALTH_JAMMING   (1u << 0)   // jamming state critical or indicator over --jam-limit
+#define NTPGPS_HEALTH_ANTENNA   (1u << 1)   // antenna short or open
+#define NTPGPS_HEALTH_UTC       (1u << 2)   // UTC not resolved or tAcc over --utc-valid
+
+#define STAT_INC(st, field) \
+    atomic_fetch_add_explicit(&(st)->field, 1, memory_order_relaxed)
+#define STAT_LOAD(st, field) \
+    atomic_load_explicit(&(st)->field, memory_order_relaxed)
+#define STAT_STORE(st, field, val) \
+    atomic_store_explicit(&(st)->field, (val), memory_order_relaxed)
+
+// Map a duration to its histogram bucket
+static inline unsigned ntpgps_hist_bucket(uint64_t ns)
+{
+    uint64_t us = ns / 1000ULL;
+    if (us == 0)
+        return 0;
+    unsigned b = 64 - __builtin_clzll(us);
+    return (b < NTPGPS_HIST_BUCKETS) ? b : NTPGPS_HIST_BUCKETS - 1;
+}
+
+// Record one duration (single writer, so max needs no CAS loop)
+static inline void ntpgps_hist_add(ntpgps_hist_t *h, uint64_t ns)
+{
+    atomic_fetch_add_explicit(&h->bucket[ntpgps_hist_bucket(ns)], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&h->sum_ns, ns, memory_order_relaxed);
+    atomic_fetch_add_explicit(&h->count, 1, memory_order_relaxed);
+    if (ns > atomic_load_explicit(&h->max_ns, memory_order_relaxed))
+        atomic_store_explicit(&h->max_ns, ns, memory_order_relaxed);
+}
+
+static inline void ntpgps_hist_reset(ntpgps_hist_t *h)
+{
+    atomic_store_explicit(&h->count, 0, memory_order_relaxed);
+    atomic_store_explicit(&h->sum_ns, 0, memory_order_relaxed);
+    atomic_store_explicit(&h->max_ns, 0, memory_order_relaxed);
+    for (int i = 0; i < NTPGPS_HIST_BUCKETS; i++)
+        atomic_store_explicit(&h->bucket[i], 0, memory_order_relaxed);
+}
+
+static inline void ntpgps_offset_add(ntpgps_offset_t *o, int64_t ns)
+{
+    uint64_t n = atomic_fetch_add_explicit(&o->count, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&o->sum_ns, ns, memory_order_relaxed);
+    if (n == 0 || ns < atomic_load_explicit(&o->min_ns, memory_order_relaxed))
+        atomic_store_explicit(&o->min_ns, ns, memory_order_relaxed);
+    if (n == 0 || ns > atomic_load_explicit(&o->max_ns, memory_order_relaxed))
+        atomic_store_explicit(&o->max_ns, ns, memory_order_relaxed);
+}
+
+static inline void ntpgps_offset_reset(ntpgps_offset_t *o)
+{
+    atomic_store_explicit(&o->count, 0, memory_order_relaxed);
+    atomic_store_explicit(&o->sum_ns, 0, memory_order_relaxed);
+    atomic_store_explicit(&o->min_ns, 0, memory_order_relaxed);
+    atomic_store_explicit(&o->max_ns, 0, memory_order_relaxed);
+}
+
+// Plain copy of ntpgps_sample_t for readers
+typedef struct {
+    uint32_t valid;
+    int64_t  gps_sec;
+    int32_t  gps_nsec;
+    char     sentence[4];
+    int64_t  recv_sec;
+    int32_t  recv_nsec;
+    uint64_t recv_mono_ns;
+    int64_t  offset_ns;
+} ntpgps_sample_snapshot_t;
+
+// Read a consistent copy of the last sample.
+// Returns 0 on success, -1 if the writer kept it busy for too long.
+static inline int ntpgps_sample_read(const ntpgps_sample_t *s, ntpgps_sample_snapshot_t *out)
+{
+    for (int tries = 0; tries < 100; tries++) {
+        uint32_t seq0 = atomic_load_explicit(&s->seq, memory_order_acquire);
+        if (seq0 & 1)
+            continue;
+
+        out->valid        = atomic_load_explicit(&s->valid, memory_order_relaxed);
+        out->gps_sec      = atomic_load_explicit(&s->gps_sec, memory_order_relaxed);
+        out->gps_nsec     = atomic_load_explicit(&s->gps_nsec, memory_order_relaxed);
+        int32_t sentence  = atomic_load_explicit(&s->sentence, memory_order_relaxed);
+        out->recv_sec     = atomic_load_explicit(&s->recv_sec, memory_order_relaxed);
+        out->recv_nsec    = atomic_load_explicit(&s->recv_nsec, memory_order_relaxed);
+        out->recv_mono_ns = atomic_load_explicit(&s->recv_mono_ns, memory_order_relaxed);
+        out->offset_ns    = atomic_load_explicit(&s->offset_ns, memory_order_relaxed);
+
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&s->seq, memory_order_relaxed) == seq0) {
+            out->sentence[0] = (char)(sentence & 0xFF);
+            out->sentence[1] = (char)((sentence >> 8) & 0xFF);
+            out->sentence[2] = (char)((sentence >> 16) & 0xFF);
+            out->sentence[3] = '\0';
+            return 0;
+        }
+    }
+    return -1;
+}
+
+
+#endif // SHM_STATS_H
@@ -0,0 +1,161 @@
+#ifndef SHM_WATCH_H
+#define SHM_WATCH_H
+/*******************************************************************************
+ shm_watch.h
+
+ Record formats for the WATCH subscription on the ntpgps-shm-writer control
+ socket.  After "WATCH TEXT" (the default) every published SHM sample and
+ every event is sent as one line:
+
+   SAMPLE seq=41 gps=1749297604.000000000 recv=1749297604.052311020 offset=+0.052311020 type=ZDA valid=1
+   EVENT seq=42 fixloss
+   EVENT seq=43 rollover date=2025-06-08
+   EVENT seq=44 deverror errno=5 (Input/output error)
+   EVENT seq=45 health gate=jamming
+   EVENT seq=0 dropped count=17
+
+ After "WATCH BINARY" the stream consists only of ntpgps_watch_frame_t
+ records (little-endian, fixed size) and further input is ignored.
+
+ 'seq' numbers consecutive records; a gap means records were dropped
+ because the subscriber did not keep up.
+
+ Copyright (C) 2025 Richard Elwell
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <inttypes.h>
+
+#define NTPGPS_WATCH_MAGIC      0x574E      /* "NW" little-endian */
+#define NTPGPS_WATCH_VERSION    1
+#define NTPGPS_WATCH_TEXT_MAX   192         /* longest text record incl. newline */
+
+typedef enum {
+    WATCH_SAMPLE = 0,       // SHM sample published
+    WATCH_FIX_LOSS,         // RMC/GLL/GGA status went invalid
+    WATCH_FIX_OK,           // RMC/GLL/GGA status became valid again
+    WATCH_ROLLOVER,         // stored date changed (midnight or SETDATE), arg = YYYYMMDD
+    WATCH_DEVICE_ERROR,     // read error or disconnect, arg = errno (0 = EOF)
+    WATCH_DROPPED,          // subscriber missed records, arg = count
+    WATCH_HEALTH            // receiver health gate changed, arg = NTPGPS_HEALTH_* bits
+} ntpgps_watch_type_t;
+
+// One entry of the writer's watch ring
+typedef struct {
+    uint8_t  type;          // ntpgps_watch_type_t
+    uint8_t  valid;         // sample: 1 = fix status valid
+    char     sentence[4];   // sample: NMEA sentence type, e.g. "ZDA"
+    int64_t  gps_sec;
+    int32_t  gps_nsec;
+    int64_t  recv_sec;      // CLOCK_REALTIME when the chunk was read
+    int32_t  recv_nsec;
+    int64_t  offset_ns;     // receive time - GPS time
+    int32_t  arg;           // event argument
+} ntpgps_watch_record_t;
+
+// Binary framing (WATCH BINARY)
+typedef struct __attribute__((packed)) {
+    uint16_t magic;         // NTPGPS_WATCH_MAGIC
+    uint8_t  version;       // NTPGPS_WATCH_VERSION
+    uint8_t  type;          // ntpgps_watch_type_t
+    uint32_t seq;
+    int64_t  gps_sec;
+    int32_t  gps_nsec;
+    int64_t  recv_sec;
+    int32_t  recv_nsec;
+    int64_t  offset_ns;
+    char     sentence[4];
+    uint8_t  valid;
+    uint8_t  reserved[3];
+    int32_t  arg;
+} ntpgps_watch_frame_t;
+
+_Static_assert(sizeof(ntpgps_watch_frame_t) == 52, "ntpgps_watch_frame_t must be 52 bytes");
+
+static inline void ntpgps_watch_to_frame(const ntpgps_watch_record_t *r, uint32_t seq,
+                                         ntpgps_watch_frame_t *f)
+{
+    memset(f, 0, sizeof(*f));
+    f->magic     = NTPGPS_WATCH_MAGIC;
+    f->version   = NTPGPS_WATCH_VERSION;
+    f->type      = r->type;
+    f->seq       = seq;
+    f->gps_sec   = r->gps_sec;
+    f->gps_nsec  = r->gps_nsec;
+    f->recv_sec  = r->recv_sec;
+    f->recv_nsec = r->recv_nsec;
+    f->offset_ns = r->offset_ns;
+    memcpy(f->sentence, r->sentence, sizeof(f->sentence));
+    f->valid     = r->valid;
+    f->arg       = r->arg;
+}
+
+// Format one text record; returns its length (always < size)
+static inline int ntpgps_watch_format_text(const ntpgps_watch_record_t *r, uint32_t seq,
+                                           char *buf, size_t size)
+{
+    int n = 0;
+
+    switch (r->type) {
+    case WATCH_SAMPLE: {
+        int64_t off = r->offset_ns;
+        char sign = '+';
+        if (off < 0) { sign = '-'; off = -off; }
+        n = snprintf(buf, size,
+                     "SAMPLE seq=%" PRIu32 " gps=%" PRId64 ".%09" PRId32 " recv=%" PRId64 ".%09" PRId32
+                     " offset=%c%" PRId64 ".%09" PRId64 " type=%.3s valid=%u\n",
+                     seq, r->gps_sec, r->gps_nsec, r->recv_sec, r->recv_nsec,
+                     sign, (int64_t)(off / 1000000000), (int64_t)(off % 1000000000), r->sentence, r->valid);
+        break;
+    }
+    case WATCH_FIX_LOSS:
+        n = snprintf(buf, size, "EVENT seq=%" PRIu32 " fixloss\n", seq);
+        break;
+    case WATCH_FIX_OK:
+        n = snprintf(buf, size, "EVENT seq=%" PRIu32 " fixok\n", seq);
+        break;
+    case WATCH_ROLLOVER:
+        n = snprintf(buf, size, "EVENT seq=%" PRIu32 " rollover date=%04d-%02d-%02d\n", seq,
+                     (int)(r->arg / 10000), (int)(r->arg / 100 % 100), (int)(r->arg % 100));
+        break;
+    case WATCH_DEVICE_ERROR:
+        n = snprintf(buf, size, "EVENT seq=%" PRIu32 " deverror errno=%d (%s)\n", seq,
+                     (int)r->arg, r->arg ? strerror(r->arg) : "EOF");
+        break;
+    case WATCH_DROPPED:
+        n = snprintf(buf, size, "EVENT seq=%" PRIu32 " dropped count=%d\n", seq, (int)r->arg);
+        break;
+    case WATCH_HEALTH: {
+        // bit 0 jamming, bit 1 antenna, bit 2 utc (NTPGPS_HEALTH_* in shm_stats.h)
+        static const char * const gate[8] = { "none", "jamming", "antenna", "jamming,antenna",
+                                              "utc", "jamming,utc", "antenna,utc", "jamming,antenna,utc" };
+        n = snprintf(buf, size, "EVENT seq=%" PRIu32 " health gate=%s\n", seq, gate[r->arg & 7]);
+        break;
+    }
+    default:
+        n = snprintf(buf, size, "EVENT seq=%" PRIu32 " unknown type=%u\n", seq, r->type);
+        break;
+    }
+
+    if (n < 0)
+        return 0;
+    return ((size_t)n < size) ? n : (int)size - 1;
+}
+
+
+#endif // SHM_WATCH_H
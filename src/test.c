@@ -24,6 +24,7 @@
 #include <stdbool.h>
 #include "ubx_defs.h"
 #include "ubx_disassemble.h"
+#include "ubx_profile.h"
 
 static void disassemble_msg_list()
 {
@@ -66,8 +67,41 @@ static void disassemble_msg_list()
     UBX_DISASSEMBLE();
 }
 
+// A raw UBX profile line is hex throughout: 06 31 is CFG-TP5, not class 6 id 31
+static int test_profile_raw_hex(void)
+{
+    const char *path = "/tmp/ntpgps-test-raw.profile";
+    static const uint8_t want[] = { 0xB5, 0x62, 0x06, 0x31, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00 };
+    static ubx_profile_t p;
+    char err[256];
+
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        perror(path);
+        return 1;
+    }
+    fputs("UBX 06 31 00 01 00 00\n", f);
+    fclose(f);
+    int rc = ubx_profile_load(path, &p, err, sizeof(err));
+    remove(path);
+    if (rc != 0) {
+        fprintf(stderr, "profile UBX line: %s\n", err);
+        return 1;
+    }
+    if (p.count != 1 || p.len[0] != sizeof(want) + 2 || memcmp(p.frame[0], want, sizeof(want)) != 0) {
+        fprintf(stderr, "profile UBX line: cls=%02X id=%02X len=%zu\n",
+                p.frame[0][2], p.frame[0][3], p.len[0]);
+        return 1;
+    }
+    printf("profile UBX line: %s\n", disassemble_ubx_bytes(p.frame[0], p.len[0]));
+    return 0;
+}
+
 int main()
 {
+    if (test_profile_raw_hex() != 0)
+        return 1;
+
     UBX_CFG_PRT(zzz, 0x01,0x00,0x5F,0x23,0xD0,0x08,0x00,0x00,0x80,0x25,0x00,0x00,0x23,0x00,0x03,0x00,0x02,0x00,0x00,0x00)
     printf("%s\n", format_ubx(&zzz));
     printf("payload_len=%u(%u)\n", zzz.payload_len, sizeof(ubx_cfg_prt_t));
@@ -0,0 +1,465 @@
+#ifndef TRACE_RING_H
+#define TRACE_RING_H
+/*******************************************************************************
+ trace_ring.h
+
+ Binary debug trace, formatted off the hot path.
+
+ TRACE_RECORD(fmt, args...) stores a record in a ring owned by the calling
+ thread: a CLOCK_MONOTONIC timestamp, the format string (its address, the
+ literal itself stays in .rodata) and the arguments, each tagged with its
+ type by _Generic.  Strings are copied, as the buffers they point to may
+ be reused before the record is read.  No formatting, no locks and no
+ system calls; a full ring drops the record and counts it.
+
+ trace_drain() is the one consumer.  It merges the rings by timestamp,
+ formats every record with the printf conversions of its format string
+ and writes the lines, followed by a note of any records dropped.
+
+ TRACE_RECORD_UBX(prefix, frame, len) stores a UBX frame as raw bytes;
+ trace_drain() disassembles it into "<prefix><disassembly>\n".
+
+ Example:
+   TRACE_RECORD("Read %zu bytes from %s\n", n, dev_path);
+   ...
+   trace_drain(stderr);     // from a background thread, every few ms
+
+ Copyright (C) 2025 Richard Elwell
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*******************************************************************************/
+#include <ctype.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "pp_utils.h"
+#include "ubx_disassemble.h"
+
+#define TRACE_RING_SIZE     (128 * 1024)    // bytes per thread, a power of 2
+#define TRACE_RINGS_MAX     16              // threads that can trace
+#define TRACE_RECORD_MAX    4096            // longest record; longer strings are cut
+#define TRACE_LINE_MAX      4096            // longest formatted line
+
+typedef enum {
+    TRACE_ARG_END,          // terminates the argument list of TRACE_RECORD
+    TRACE_ARG_INT,
+    TRACE_ARG_UINT,
+    TRACE_ARG_DOUBLE,
+    TRACE_ARG_PTR,
+    TRACE_ARG_STR           // 'len' bytes follow the argument slots
+} trace_arg_type_t;
+
+typedef struct {
+    uint32_t type;          // trace_arg_type_t
+    uint32_t len;           // TRACE_ARG_STR: bytes stored
+    union {
+        int64_t     i;
+        uint64_t    u;
+        double      d;
+        const void *p;
+    };
+} trace_arg_t;
+
+typedef enum {
+    TRACE_REC_PAD,          // skip to the start of the ring
+    TRACE_REC_PRINTF,
+    TRACE_REC_UBX           // one TRACE_ARG_STR holding the frame
+} trace_rec_kind_t;
+
+typedef struct {
+    uint32_t size;          // whole record, a multiple of 8
+    uint16_t nargs;
+    uint8_t  kind;          // trace_rec_kind_t
+    uint8_t  reserved;
+    uint64_t ts_ns;         // CLOCK_MONOTONIC
+    const char *fmt;        // or the UBX prefix
+    // trace_arg_t args[nargs], then the string bytes
+} trace_rec_t;
+
+typedef struct {
+    _Atomic uint32_t head;      // advanced by the owning thread
+    _Atomic uint32_t tail;      // advanced by trace_drain()
+    _Atomic uint32_t dropped;
+    uint8_t buf[TRACE_RING_SIZE] __attribute__((aligned(8)));
+} trace_ring_t;
+
+_Static_assert((TRACE_RING_SIZE & (TRACE_RING_SIZE - 1)) == 0, "TRACE_RING_SIZE must be a power of 2");
+
+static _Atomic(trace_ring_t *) trace_rings[TRACE_RINGS_MAX];
+static atomic_int trace_ring_count = 0;
+static _Atomic uint32_t trace_rings_lost = 0;       // records of threads without a ring
+static _Thread_local trace_ring_t *trace_ring_self = NULL;
+static _Thread_local bool trace_ring_none = false;      // TRACE_RINGS_MAX reached
+static pthread_mutex_t trace_drain_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+// --- Argument capture ---
+
+static inline trace_arg_t trace_arg_int(long long v)           { return (trace_arg_t){ .type = TRACE_ARG_INT, .i = v }; }
+static inline trace_arg_t trace_arg_uint(unsigned long long v) { return (trace_arg_t){ .type = TRACE_ARG_UINT, .u = v }; }
+static inline trace_arg_t trace_arg_double(double v)           { return (trace_arg_t){ .type = TRACE_ARG_DOUBLE, .d = v }; }
+static inline trace_arg_t trace_arg_ptr(const void *v)         { return (trace_arg_t){ .type = TRACE_ARG_PTR, .p = v }; }
+static inline trace_arg_t trace_arg_str(const char *v)         { return (trace_arg_t){ .type = TRACE_ARG_STR, .p = v }; }
+
+#define TRACE_ARG(d, x) _Generic((x),                                   \
+    _Bool: trace_arg_uint, char: trace_arg_int,                         \
+    signed char: trace_arg_int, unsigned char: trace_arg_uint,          \
+    short: trace_arg_int, unsigned short: trace_arg_uint,               \
+    int: trace_arg_int, unsigned int: trace_arg_uint,                   \
+    long: trace_arg_int, unsigned long: trace_arg_uint,                 \
+    long long: trace_arg_int, unsigned long long: trace_arg_uint,       \
+    float: trace_arg_double, double: trace_arg_double,                  \
+    char *: trace_arg_str, const char *: trace_arg_str,                 \
+    default: trace_arg_ptr)(x),
+
+// Never called: keeps the compiler's printf format checks on the arguments
+static inline void trace_format_check(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+static inline void trace_format_check(const char *fmt, ...) { (void)fmt; }
+
+#define TRACE_RECORD(fmt, ...)                                                  \
+    do {                                                                        \
+        if (0) trace_format_check(fmt __VA_OPT__(,) __VA_ARGS__);               \
+        trace_record(TRACE_REC_PRINTF, fmt, (const trace_arg_t[]){             \
+            __VA_OPT__(PP_MAP(TRACE_ARG, ~, __VA_ARGS__)) { .type = TRACE_ARG_END } }); \
+    } while (0)
+
+#define TRACE_RECORD_UBX(prefix, bytes, n)                                      \
+    trace_record(TRACE_REC_UBX, prefix, (const trace_arg_t[]){                 \
+        { .type = TRACE_ARG_STR, .len = (uint32_t)(n), .p = (bytes) },         \
+        { .type = TRACE_ARG_END } })
+
+// --- Producer ---
+
+static trace_ring_t *trace_ring_get(void)
+{
+    if (trace_ring_self || trace_ring_none)
+        return trace_ring_self;
+    // once per thread; the only allocation on the producer side
+    int idx = atomic_fetch_add(&trace_ring_count, 1);
+    if (idx >= TRACE_RINGS_MAX) {
+        trace_ring_none = true;
+        return NULL;
+    }
+    trace_ring_t *r = calloc(1, sizeof(*r));
+    if (r)
+        atomic_store_explicit(&trace_rings[idx], r, memory_order_release);
+    return trace_ring_self = r;
+}
+
+// Precision of each %s conversion of 'fmt' into 'limit[]' (SIZE_MAX where
+// there is none), so that "%.*s" of an unterminated buffer is not read past
+// its end.  Walks the conversions the same way as trace_format().
+static void trace_str_limits(const char *fmt, const trace_arg_t *args, size_t nargs, size_t *limit)
+{
+    size_t a = 0;
+    for (size_t i = 0; i < nargs; i++)
+        limit[i] = SIZE_MAX;
+    for (const char *f = fmt; (f = strchr(f, '%')) != NULL && a < nargs; ) {
+        long prec = -1;
+        f++;
+        while (*f && strchr("-+ #0", *f))
+            f++;
+        if (*f == '*')
+            f++, a++;
+        while (isdigit((unsigned char)*f))
+            f++;
+        if (*f == '.') {
+            f++;
+            if (*f == '*') {
+                f++;
+                prec = a < nargs ? (long)args[a++].i : -1;
+            } else {
+                for (prec = 0; isdigit((unsigned char)*f); f++)
+                    prec = prec * 10 + (*f - '0');
+            }
+        }
+        while (*f && strchr("hlLqjzt", *f))
+            f++;
+        char type = *f ? *f++ : '\0';
+        if (type == '%' || type == '\0' || type == 'n' || a >= nargs)
+            continue;
+        if (type == 's' && prec >= 0)
+            limit[a] = (size_t)prec;
+        a++;
+    }
+}
+
+static void trace_record(trace_rec_kind_t kind, const char *fmt, const trace_arg_t *args)
+{
+    trace_ring_t *r = trace_ring_get();
+    if (!r) {
+        atomic_fetch_add_explicit(&trace_rings_lost, 1, memory_order_relaxed);
+        return;
+    }
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    // sizes first: strings are cut so that the record fits TRACE_RECORD_MAX
+    size_t nargs = 0, size = sizeof(trace_rec_t);
+    while (args[nargs].type != TRACE_ARG_END)
+        nargs++;
+    size += nargs * sizeof(trace_arg_t);
+    uint32_t lens[nargs + 1];
+    size_t limit[nargs + 1];
+    if (kind != TRACE_REC_UBX)
+        trace_str_limits(fmt, args, nargs, limit);
+    for (size_t i = 0; i < nargs; i++) {
+        lens[i] = 0;
+        if (args[i].type != TRACE_ARG_STR || !args[i].p)
+            continue;
+        size_t room = TRACE_RECORD_MAX - size;
+        size_t n = args[i].len;
+        if (kind != TRACE_REC_UBX) {
+            // memchr() stops at the first NUL, so a short string is not overread
+            size_t max = limit[i] < room ? limit[i] : room;
+            const char *nul = memchr(args[i].p, '\0', max);
+            n = nul ? (size_t)(nul - (const char *)args[i].p) : max;
+        }
+        lens[i] = (uint32_t)(n < room ? n : room);
+        size += lens[i];
+    }
+    size = (size + 7) & ~(size_t)7;
+
+    uint32_t head = atomic_load_explicit(&r->head, memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(&r->tail, memory_order_acquire);
+    uint32_t pos = head & (TRACE_RING_SIZE - 1);
+    uint32_t gap = TRACE_RING_SIZE - pos;     // up to the end of the buffer
+    uint32_t need = (uint32_t)size + (gap < size ? gap : 0);
+    if (TRACE_RING_SIZE - (head - tail) < need) {
+        atomic_fetch_add_explicit(&r->dropped, 1, memory_order_relaxed);
+        return;
+    }
+    if (gap < size) {
+        // records never wrap: pad out the end and start over at 0
+        trace_rec_t *pad = (trace_rec_t *)&r->buf[pos];
+        pad->size = gap;
+        pad->kind = TRACE_REC_PAD;
+        head += gap;
+        pos = 0;
+    }
+
+    trace_rec_t *rec = (trace_rec_t *)&r->buf[pos];
+    rec->size = (uint32_t)size;
+    rec->nargs = (uint16_t)nargs;
+    rec->kind = (uint8_t)kind;
+    rec->ts_ns = (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+    rec->fmt = fmt;
+    trace_arg_t *slot = (trace_arg_t *)(rec + 1);
+    uint8_t *str = (uint8_t *)(slot + nargs);
+    for (size_t i = 0; i < nargs; i++) {
+        slot[i] = args[i];
+        if (args[i].type == TRACE_ARG_STR) {
+            slot[i].len = args[i].p ? lens[i] : UINT32_MAX;     // UINT32_MAX: NULL
+            if (args[i].p)
+                memcpy(str, args[i].p, lens[i]);
+            str += lens[i];
+        }
+    }
+    atomic_store_explicit(&r->head, head + (uint32_t)size, memory_order_release);
+}
+
+// --- Consumer ---
+
+/*
+ * trace_format()
+ * --------------
+ * Expands the printf conversions of 'rec->fmt' with the stored arguments,
+ * each conversion handed to snprintf() with an argument of the type its
+ * length modifier names.  Returns the length written into 'out'.
+ */
+static size_t trace_format(const trace_rec_t *rec, char *out, size_t size)
+{
+    const trace_arg_t *arg = (const trace_arg_t *)(rec + 1), *end = arg + rec->nargs;
+    const char *str = (const char *)end;
+    size_t len = 0;
+
+#define TRACE_PUT(...)                                                  \
+    do {                                                                \
+        if (len < size) {                                               \
+            int n_ = snprintf(out + len, size - len, __VA_ARGS__);      \
+            if (n_ > 0) len += (size_t)n_;                              \
+        }                                                               \
+    } while (0)
+
+    if (rec->kind == TRACE_REC_UBX) {
+        if (arg < end)
+            TRACE_PUT("%s%s\n", rec->fmt, disassemble_ubx_bytes((const uint8_t *)str, arg->len));
+        return len < size ? len : size - 1;
+    }
+
+    for (const char *f = rec->fmt; *f; ) {
+        if (*f != '%') {
+            const char *next = strchr(f, '%');
+            size_t n = next ? (size_t)(next - f) : strlen(f);
+            TRACE_PUT("%.*s", (int)n, f);
+            f += n;
+            continue;
+        }
+        // one conversion: %[flags][width][.precision][length]type
+        char spec[32];
+        size_t s = 0;
+        int star[2], nstar = 0;
+        spec[s++] = *f++;
+        while (*f && strchr("-+ #0", *f) && s < sizeof(spec) - 8)
+            spec[s++] = *f++;
+        while (*f && (isdigit((unsigned char)*f) || *f == '.' || *f == '*') && s < sizeof(spec) - 8) {
+            if (*f == '*' && nstar < 2)
+                star[nstar++] = (arg < end) ? (int)(arg++)->i : 0;
+            spec[s++] = *f++;
+        }
+        char length = 0;        // 'H': hh, 'q': ll
+        while (*f && strchr("hlLqjzt", *f)) {
+            length = (length == 'h' && *f == 'h') ? 'H' : (length == 'l' && *f == 'l') ? 'q' : *f;
+            f++;
+        }
+        char type = *f ? *f++ : '\0';
+        if (type == '%') {
+            TRACE_PUT("%%");
+            continue;
+        }
+        if (type == '\0' || type == 'n' || arg >= end)
+            continue;
+
+        // integers are passed on as long long, whatever the length modifier said
+        if (strchr("diuoxX", type))
+            spec[s++] = 'l', spec[s++] = 'l';
+        spec[s++] = type;
+        spec[s] = '\0';
+
+        const trace_arg_t *a = arg++;
+#define TRACE_PUT_SPEC(v)                                                      \
+        do {                                                                   \
+            if (nstar == 2)      TRACE_PUT(spec, star[0], star[1], v);         \
+            else if (nstar == 1) TRACE_PUT(spec, star[0], v);                  \
+            else                 TRACE_PUT(spec, v);                           \
+        } while (0)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+        switch (type) {
+        case 'd': case 'i':
+            // truncated as the original argument would have been
+            TRACE_PUT_SPEC(length == 'H' ? (long long)(signed char)a->i :
+                           length == 'h' ? (long long)(short)a->i :
+                           length == 0   ? (long long)(int)a->i : (long long)a->i);
+            break;
+        case 'u': case 'o': case 'x': case 'X':
+            TRACE_PUT_SPEC(length == 'H' ? (unsigned long long)(unsigned char)a->u :
+                           length == 'h' ? (unsigned long long)(unsigned short)a->u :
+                           length == 0   ? (unsigned long long)(unsigned int)a->u : (unsigned long long)a->u);
+            break;
+        case 'c':
+            TRACE_PUT_SPEC((int)a->i);
+            break;
+        case 'e': case 'E': case 'f': case 'F': case 'g': case 'G': case 'a': case 'A':
+            TRACE_PUT_SPEC(a->type == TRACE_ARG_DOUBLE ? a->d : (double)a->i);
+            break;
+        case 's': {
+            if (a->type != TRACE_ARG_STR || a->len == UINT32_MAX) {
+                TRACE_PUT_SPEC("(null)");
+                break;
+            }
+            // the copy has no terminating NUL
+            char sub[TRACE_RECORD_MAX + 1];
+            memcpy(sub, str, a->len);
+            sub[a->len] = '\0';
+            str += a->len;
+            TRACE_PUT_SPEC(sub);
+            break;
+        }
+        case 'p':
+            TRACE_PUT_SPEC(a->p);
+            break;
+        default:
+            TRACE_PUT("%s", spec);
+            break;
+        }
+#pragma GCC diagnostic pop
+#undef TRACE_PUT_SPEC
+    }
+#undef TRACE_PUT
+    return len < size ? len : size - 1;
+}
+
+/*
+ * trace_drain()
+ * -------------
+ * Writes every record stored so far to 'out', oldest first across all
+ * threads, and notes records dropped since the last call.  Returns the
+ * number of records written.  Safe to call from several threads, e.g. a
+ * background drain and an exit path; producers are never blocked.
+ */
+static size_t trace_drain(FILE *out)
+{
+    static char line[TRACE_LINE_MAX];
+    size_t written = 0;
+
+    pthread_mutex_lock(&trace_drain_mutex);
+    int count = atomic_load(&trace_ring_count);
+    if (count > TRACE_RINGS_MAX)
+        count = TRACE_RINGS_MAX;
+
+    for (;;) {
+        // the oldest record at the tail of any ring
+        trace_ring_t *best = NULL;
+        const trace_rec_t *best_rec = NULL;
+        for (int i = 0; i < count; i++) {
+            trace_ring_t *r = atomic_load_explicit(&trace_rings[i], memory_order_acquire);
+            if (!r)
+                continue;
+            uint32_t tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+            uint32_t head = atomic_load_explicit(&r->head, memory_order_acquire);
+            const trace_rec_t *rec = NULL;
+            while (tail != head) {
+                rec = (const trace_rec_t *)&r->buf[tail & (TRACE_RING_SIZE - 1)];
+                if (rec->kind != TRACE_REC_PAD)
+                    break;
+                tail += rec->size;
+                atomic_store_explicit(&r->tail, tail, memory_order_release);
+                rec = NULL;
+            }
+            if (rec && (!best_rec || rec->ts_ns < best_rec->ts_ns)) {
+                best = r;
+                best_rec = rec;
+            }
+        }
+        if (!best)
+            break;
+
+        size_t n = trace_format(best_rec, line, sizeof(line));
+        fwrite(line, 1, n, out);
+        written++;
+        atomic_fetch_add_explicit(&best->tail, best_rec->size, memory_order_release);
+    }
+
+    uint32_t dropped = atomic_exchange(&trace_rings_lost, 0);
+    for (int i = 0; i < count; i++) {
+        trace_ring_t *r = atomic_load_explicit(&trace_rings[i], memory_order_acquire);
+        if (r)
+            dropped += atomic_exchange_explicit(&r->dropped, 0, memory_order_relaxed);
+    }
+    if (dropped)
+        fprintf(out, "TRACE: %u records dropped, the trace ring was full\n", dropped);
+    if (written || dropped)
+        fflush(out);
+    pthread_mutex_unlock(&trace_drain_mutex);
+    return written;
+}
+
+#endif // TRACE_RING_H
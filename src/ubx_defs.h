@@ -22,6 +22,7 @@
 #include <stdint.h>
 #include <stdio.h>
 #include "ubx_message.h"
+#include "ubx_payload.h"
 
 
 // --- Define UBX messages ---
@@ -39,31 +40,44 @@ UBX_CFG_PRT(get_cfg_prt_uart1, 0x01)
 UBX_CFG_PRT(get_cfg_prt_usb, 0x03)
 
 // UBX-CFG-PRT Target=UART1 ProtocolIn=UBX+NMEA+RTCM2 ProtocolOut=UBX Baudrate=9600 Databits=8 Stopbits=1 Parity=None BitOrder=LsbFirst ExtendedTxTimeout=off TxReadyFeature=off
-UBX_CFG_PRT(set_cfg_prt_uart1_ubx, 0x01,0x00,0x00,0x00,0xD0,0x08,0x00,0x00,0x80,0x25,0x00,0x00,0x07,0x00,0x01,0x00,0x00,0x00,0x00,0x00)
+UBX_CFG_PRT_TYPED(set_cfg_prt_uart1_ubx,
+    (portID, UBX_PORT_UART1), (mode, 0x000008D0), (baudRate, 9600),
+    (protocolIn, UBX_PROTO_MASK_UBX | UBX_PROTO_MASK_NMEA | UBX_PROTO_MASK_RTCM2), (protocolOut, UBX_PROTO_MASK_UBX))
 
 // UBX-CFG-PRT Target=UART1 ProtocolIn=UBX+NMEA+RTCM2 ProtocolOut=NMEA Baudrate=9600 Databits=8 Stopbits=1 Parity=None BitOrder=LsbFirst ExtendedTxTimeout=off TxReadyFeature=off
-UBX_CFG_PRT(set_cfg_prt_uart1_nmea, 0x01,0x00,0x00,0x00,0xD0,0x08,0x00,0x00,0x80,0x25,0x00,0x00,0x07,0x00,0x02,0x00,0x00,0x00,0x00,0x00)
+UBX_CFG_PRT_TYPED(set_cfg_prt_uart1_nmea,
+    (portID, UBX_PORT_UART1), (mode, 0x000008D0), (baudRate, 9600),
+    (protocolIn, UBX_PROTO_MASK_UBX | UBX_PROTO_MASK_NMEA | UBX_PROTO_MASK_RTCM2), (protocolOut, UBX_PROTO_MASK_NMEA))
 
 // UBX-CFG-PRT Target=UART1 ProtocolIn=UBX+NMEA+RTCM2 ProtocolOut=UBX+NMEA Baudrate=9600 Databits=8 Stopbits=1 Parity=None BitOrder=LsbFirst ExtendedTxTimeout=off TxReadyFeature=off
-UBX_CFG_PRT(set_cfg_prt_uart1_ubxnmea, 0x01,0x00,0x00,0x00,0xD0,0x08,0x00,0x00,0x80,0x25,0x00,0x00,0x07,0x00,0x03,0x00,0x00,0x00,0x00,0x00)
+UBX_CFG_PRT_TYPED(set_cfg_prt_uart1_ubxnmea,
+    (portID, UBX_PORT_UART1), (mode, 0x000008D0), (baudRate, 9600),
+    (protocolIn, UBX_PROTO_MASK_UBX | UBX_PROTO_MASK_NMEA | UBX_PROTO_MASK_RTCM2), (protocolOut, UBX_PROTO_MASK_UBX | UBX_PROTO_MASK_NMEA))
 
 // UBX-CFG-PRT Target=USB ProtocolIn=UBX+NMEA+RTCM2 ProtocolOut=UBX ExtendedTxTimeout=off TxReadyFeature=off
-UBX_CFG_PRT(set_cfg_prt_usb_ubx, 0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x01,0x00,0x00,0x00,0x00,0x00)
+UBX_CFG_PRT_TYPED(set_cfg_prt_usb_ubx,
+    (portID, UBX_PORT_USB), (protocolIn, UBX_PROTO_MASK_UBX | UBX_PROTO_MASK_NMEA | UBX_PROTO_MASK_RTCM2), (protocolOut, UBX_PROTO_MASK_UBX))
 
 // UBX-CFG-PRT Target=USB ProtocolIn=UBX+NMEA+RTCM2 ProtocolOut=NMEA ExtendedTxTimeout=off TxReadyFeature=off
-UBX_CFG_PRT(set_cfg_prt_usb_nmea, 0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x02,0x00,0x00,0x00,0x00,0x00)
+UBX_CFG_PRT_TYPED(set_cfg_prt_usb_nmea,
+    (portID, UBX_PORT_USB), (protocolIn, UBX_PROTO_MASK_UBX | UBX_PROTO_MASK_NMEA | UBX_PROTO_MASK_RTCM2), (protocolOut, UBX_PROTO_MASK_NMEA))
 
 // UBX-CFG-PRT Target=USB ProtocolIn=UBX+NMEA+RTCM2 ProtocolOut=UBX+NMEA ExtendedTxTimeout=off TxReadyFeature=off
-UBX_CFG_PRT(set_cfg_prt_usb_ubxnmea, 0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x03,0x00,0x00,0x00,0x00,0x00)
+UBX_CFG_PRT_TYPED(set_cfg_prt_usb_ubxnmea,
+    (portID, UBX_PORT_USB), (protocolIn, UBX_PROTO_MASK_UBX | UBX_PROTO_MASK_NMEA | UBX_PROTO_MASK_RTCM2), (protocolOut, UBX_PROTO_MASK_UBX | UBX_PROTO_MASK_NMEA))
 
 // UBX-CFG-TP PulseMode=RisingEdge TimeSource=GPSTime
-UBX_CFG_TP(set_cfg_tp, 0x40,0x42,0x0F,0x00,0xA0,0x86,0x01,0x00,0x01,0x01,0x00,0x00,0x34,0x03,0x00,0x00,0x00,0x00,0x00,0x00)
+UBX_CFG_TP_TYPED(set_cfg_tp,
+    (interval, 1000000), (length, 100000), (status, 1), (timeRef, UBX_TIME_REF_GPS),
+    (antennaCableDelay, 820))
 
 // UBX-CFG-TP5 TimepulseSettings=TIMEPULSE TimeSource=GPSTime
-UBX_CFG_TP5(set_cfg_tp5, 0x00,0x01,0x00,0x00,0x32,0x00,0x00,0x00,0x40,0x42,0x0F,0x00,0x40,0x42,0x0F,0x00,0x00,0x00,0x00,0x00,0xA0,0x86,0x01,0x00,0x00,0x00,0x00,0x00,0xF7,0x00,0x00,0x00)
+UBX_CFG_TP5_TYPED(set_cfg_tp5,
+    (tpIdx, 0), (version, 1), (antCableDelay, 50), (freqPeriod, 1000000), (freqPeriodLock, 1000000),
+    (pulseLenRatioLock, 100000), (flags.raw, 0x000000F7))
 
 // UBX-CFG-RATE TimeSource=GPSTime MeasurementPeriod=1000 NavigationRate=1
-UBX_CFG_RATE(set_cfg_rate, 0xE8,0x03,0x01,0x00,0x01,0x00)
+UBX_CFG_RATE_TYPED(set_cfg_rate, (measRate, 1000), (navRate, 1), (timeRef, UBX_TIME_REF_GPS))
 
 // UBX-CFG-GNSS
 UBX_CFG_GNSS(get_cfg_gnss)
@@ -131,12 +145,72 @@ UBX_CFG_MSG(set_cfg_msg_nmea_utc_off, 0xF0,0x10,0x00,0x00,0x00,0x00,0x00,0x00)
 // UBX-CFG-MSG Message=F0-0B-NMEA-GxRLM I2C=off UART1=off UART2=off USB=off SPI=off
 UBX_CFG_MSG(set_cfg_msg_nmea_rlm_off, 0xF0,0x0B,0x00,0x00,0x00,0x00,0x00,0x00)
 
-// UBX-CFG-CFG SaveCurrentConfiguration Devices=BBR,FLASH
-UBX_CFG_CFG(set_cfg_cfg_bbr_flash, 0x00,0x05,0x00,0x00)
+// UBX-CFG-MSG Message=F0-00-NMEA-GxGGA I2C=on,1 UART1=on,1 UART2=on,1 USB=on,1 SPI=on,1
+UBX_CFG_MSG(set_cfg_msg_nmea_gga_on, 0xF0,0x00,0x01,0x01,0x01,0x01,0x01,0x00)
+
+// UBX-CFG-MSG Message=F0-01-NMEA-GxGLL I2C=on,1 UART1=on,1 UART2=on,1 USB=on,1 SPI=on,1
+UBX_CFG_MSG(set_cfg_msg_nmea_gll_on, 0xF0,0x01,0x01,0x01,0x01,0x01,0x01,0x00)
+
+// UBX-CFG-MSG Message=F0-02-NMEA-GxGSA I2C=on,1 UART1=on,1 UART2=on,1 USB=on,1 SPI=on,1
+UBX_CFG_MSG(set_cfg_msg_nmea_gsa_on, 0xF0,0x02,0x01,0x01,0x01,0x01,0x01,0x00)
+
+// UBX-CFG-MSG Message=F0-03-NMEA-GxGSV I2C=on,1 UART1=on,1 UART2=on,1 USB=on,1 SPI=on,1
+UBX_CFG_MSG(set_cfg_msg_nmea_gsv_on, 0xF0,0x03,0x01,0x01,0x01,0x01,0x01,0x00)
+
+// UBX-CFG-MSG Message=F0-04-NMEA-GxRMC I2C=on,1 UART1=on,1 UART2=on,1 USB=on,1 SPI=on,1
+UBX_CFG_MSG(set_cfg_msg_nmea_rmc_on, 0xF0,0x04,0x01,0x01,0x01,0x01,0x01,0x00)
+
+// UBX-CFG-MSG Message=F0-05-NMEA-GxVTG I2C=on,1 UART1=on,1 UART2=on,1 USB=on,1 SPI=on,1
+UBX_CFG_MSG(set_cfg_msg_nmea_vtg_on, 0xF0,0x05,0x01,0x01,0x01,0x01,0x01,0x00)
+
+// UBX-CFG-MSG Message=F0-08-NMEA-GxZDA I2C=off UART1=off UART2=off USB=off SPI=off
+UBX_CFG_MSG(set_cfg_msg_nmea_zda_off, 0xF0,0x08,0x00,0x00,0x00,0x00,0x00,0x00)
+
+// UBX-CFG-MSG Message=01-21-UBX-NAV-TIMEUTC I2C=off UART1=on,1 UART2=off USB=on,1 SPI=off
+UBX_CFG_MSG(set_cfg_msg_nav_timeutc_on, 0x01,0x21,0x00,0x01,0x00,0x01,0x00,0x00)
+
+// UBX-CFG-MSG Message=01-07-UBX-NAV-PVT I2C=off UART1=on,1 UART2=off USB=on,1 SPI=off
+UBX_CFG_MSG(set_cfg_msg_nav_pvt_on, 0x01,0x07,0x00,0x01,0x00,0x01,0x00,0x00)
+
+// UBX-CFG-MSG Message=01-07-UBX-NAV-PVT I2C=off UART1=off UART2=off USB=off SPI=off
+UBX_CFG_MSG(set_cfg_msg_nav_pvt_off, 0x01,0x07,0x00,0x00,0x00,0x00,0x00,0x00)
+
+// UBX-CFG-CFG ClearMask=none SaveMask=all LoadMask=none Devices=BBR,FLASH
+UBX_CFG_CFG_TYPED(set_cfg_cfg_bbr_flash, (saveMask, 0x0000FFFF), (deviceMask, 0x03))
+
+// UBX-CFG-VALSET Layers=RAM CFG-UART1OUTPROT-UBX=1 CFG-UART1OUTPROT-NMEA=1
+UBX_CFG_VALSET(set_valset_uart1_ubxnmea, 0x00,0x01,0x00,0x00,0x01,0x00,0x74,0x10,0x01,0x02,0x00,0x74,0x10,0x01)
+
+// UBX-CFG-VALSET Layers=RAM CFG-UART1OUTPROT-UBX=0 CFG-UART1OUTPROT-NMEA=1
+UBX_CFG_VALSET(set_valset_uart1_nmea, 0x00,0x01,0x00,0x00,0x01,0x00,0x74,0x10,0x00,0x02,0x00,0x74,0x10,0x01)
+
+// UBX-CFG-VALSET Layers=RAM CFG-USBOUTPROT-UBX=1 CFG-USBOUTPROT-NMEA=1
+UBX_CFG_VALSET(set_valset_usb_ubxnmea, 0x00,0x01,0x00,0x00,0x01,0x00,0x78,0x10,0x01,0x02,0x00,0x78,0x10,0x01)
+
+// UBX-CFG-VALSET Layers=RAM CFG-USBOUTPROT-UBX=0 CFG-USBOUTPROT-NMEA=1
+UBX_CFG_VALSET(set_valset_usb_nmea, 0x00,0x01,0x00,0x00,0x01,0x00,0x78,0x10,0x00,0x02,0x00,0x78,0x10,0x01)
 
 // UBX-MON-VER
 UBX_MON_VER(get_mon_ver)
 
+// UBX-SEC-UNIQID
+UBX_SEC_UNIQID(get_sec_uniqid)
+
+// UBX-MON-HW
+UBX_MON_HW(get_mon_hw)
+
+// UBX-MON-RF
+UBX_MON_RF(get_mon_rf)
+
+// UBX-MON-COMMS
+UBX_MON_COMMS(get_mon_comms)
+
+// UBX-MON-TXBUF
+UBX_MON_TXBUF(get_mon_txbuf)
+
+// UBX-MON-RXBUF
+UBX_MON_RXBUF(get_mon_rxbuf)
+
 
 #endif // UBX_DEFS_H
 
@@ -21,12 +21,14 @@
 *******************************************************************************/
 #include "pp_utils.h"
 #include "ubx_message.h"
+#include "ubx_msgdb.h"
 #include "ubx_payload.h"
+#include "ubx_valcfg.h"
 #include <inttypes.h>
 
 // --- Disassemble UBX message ---
 
-static const char * const ubx_name(uint8_t ubx1, uint8_t ubx2)
+static inline const char *ubx_name(uint8_t ubx1, uint8_t ubx2)
 {
     if (ubx1 == UBX_SYNC1 && ubx2 == UBX_SYNC2) {
         return "UBX";
@@ -35,113 +37,26 @@ static const char * const ubx_name(uint8_t ubx1, uint8_t ubx2)
     }
 }
 
-static const char * const ubx_class_name(uint8_t cls)
+// Class and message names come from the generated message database, which
+// covers every public class, NMEA (0xF0) and PUBX (0xF1) included
+static inline const char *ubx_class_name(uint8_t cls)
 {
-    switch(cls) {
-    case UBX_CLS_NAV: return "NAV";
-    case UBX_CLS_RXM: return "RXM";
-    case UBX_CLS_INF: return "INF";
-    case UBX_CLS_ACK: return "ACK";
-    case UBX_CLS_CFG: return "CFG";
-    case UBX_CLS_UPD: return "UPD";
-    case UBX_CLS_MON: return "MON";
-    case UBX_CLS_AID: return "AID";
-    case UBX_CLS_TIM: return "TIM";
-    case UBX_CLS_ESF: return "ESF";
-    case UBX_CLS_MGA: return "MGA";
-    case UBX_CLS_LOG: return "LOG";
-    case UBX_CLS_SEC: return "SEC";
-    case UBX_CLS_HNR: return "HNR";
-    case UBX_CLS_TRK: return "TRK";
-    default:          return "???";
-    }
+    const char *name = ubx_msgdb_class_name(cls);
+    return name ? name : "???";
 }
 
-static const char * const ubx_id_name(uint8_t cls, uint8_t id)
+static inline const char *ubx_id_name(uint8_t cls, uint8_t id)
 {
-    switch(cls) {
-    case UBX_CLS_NAV:
-        switch(id) {
-        case UBX_ID_NAV_PVT:       return "PVT";
-        case UBX_ID_NAV_HPPOSECEF: return "HPPOSECEF";
-        case UBX_ID_NAV_HPPOSLLH:  return "HPPOSLLH";
-        case UBX_ID_NAV_RELPOSNED: return "RELPOSNED";
-        default:                   return "???";
-        }
-    case UBX_CLS_RXM:              return "???";
-    case UBX_CLS_INF:              return "???";
-    case UBX_CLS_ACK:
-        switch(id) {
-        case UBX_ID_ACK_NAK:       return "NAK";
-        case UBX_ID_ACK_ACK:       return "ACK";
-        default:                   return "???";
-        }
-    case UBX_CLS_CFG:
-        switch(id) {
-        case UBX_ID_CFG_PRT:       return "PRT";
-        case UBX_ID_CFG_MSG:       return "MSG";
-        case UBX_ID_CFG_INF:       return "INF";
-        case UBX_ID_CFG_RST:       return "RST";
-        case UBX_ID_CFG_DAT:       return "DAT";
-        case UBX_ID_CFG_TP:        return "TP";
-        case UBX_ID_CFG_RATE:      return "RATE";
-        case UBX_ID_CFG_CFG:       return "CFG";
-        case UBX_ID_CFG_USB:       return "USB";
-        case UBX_ID_CFG_NAVX5:     return "NAVX5";
-        case UBX_ID_CFG_NAV5:      return "NAV5";
-        case UBX_ID_CFG_TP5:       return "TP5";
-        case UBX_ID_CFG_PM2:       return "PM2";
-        case UBX_ID_CFG_GNSS:      return "GNSS";
-        case UBX_ID_CFG_PWR:       return "PWR";
-        default:                   return "???";
-        }
-    case UBX_CLS_UPD:              return "???";
-    case UBX_CLS_MON:
-        switch(id) {
-        case UBX_ID_MON_VER:       return "VER";
-        case UBX_ID_MON_HW:        return "HW";
-        case UBX_ID_MON_RF:        return "RF";
-        case UBX_ID_MON_COMMS:     return "COMMS";
-        case UBX_ID_MON_TXBUF:     return "TXBUF";
-        case UBX_ID_MON_RXBUF:     return "RXBUF";
-        default:                   return "???";
-        }
-    case UBX_CLS_AID:              return "???";
-    case UBX_CLS_TIM:              return "???";
-    case UBX_CLS_ESF:              return "???";
-    case UBX_CLS_MGA:              return "???";
-    case UBX_CLS_LOG:              return "???";
-    case UBX_CLS_SEC:              return "???";
-    case UBX_CLS_HNR:              return "???";
-    case UBX_CLS_TRK:              return "???";
-    default:                       return "???";
-    }
+    const ubx_msgdb_msg_t *m = ubx_msgdb_find(cls, id, NULL);
+    return m ? m->name : "???";
 }
 
-static const char * const ubx_nmea_name(uint16_t id)
+static inline const char *ubx_nmea_name(uint16_t id)
 {
-    switch(id) {
-    case 0xF000: return "GGA";
-    case 0xF001: return "GLL";
-    case 0xF002: return "GSA";
-    case 0xF003: return "GSV";
-    case 0xF004: return "RMC";
-    case 0xF005: return "VTG";
-    case 0xF006: return "GRS";
-    case 0xF007: return "GST";
-    case 0xF008: return "ZDA";
-    case 0xF009: return "GBS";
-    case 0xF00A: return "DTM";
-    case 0xF00D: return "GNS";
-    case 0xF00E: return "THS";
-    case 0xF00F: return "VLW";
-    case 0xF010: return "UTC";
-    case 0xF00B: return "RLM";
-    default:     return "???";
-    }
+    return ubx_id_name(id >> 8, id & 0xFF);
 }
 
-static const char * const ubx_port_str(uint8_t portID)
+static inline const char *ubx_port_str(uint8_t portID)
 {
     switch(portID) {
     case UBX_PORT_I2C:    return "I2C";
@@ -153,7 +68,7 @@ static const char * const ubx_port_str(uint8_t portID)
     }
 }
 
-static const char * const ubx_protocol_str(uint16_t protocolID)
+static inline const char *ubx_protocol_str(uint16_t protocolID)
 {
     switch(protocolID) {
     case UBX_PROTO_UBX:      return "UBX";
@@ -170,66 +85,7 @@ static const char * const ubx_protocol_str(uint16_t protocolID)
     }
 }
 
-static const char * const ubx_protocols_str(uint16_t mask)
-{
-    if ((mask & UBX_PROTO_MASK_ALL) == 0) {
-        if (mask)
-            return "(invalid)";
-        else
-            return "(none)";
-    }
-
-    static _Thread_local char buffers[4][128];
-    static _Thread_local int index = 0;
-    char *output_str = buffers[index];
-    index = (index + 1) % (sizeof(buffers) / sizeof(buffers[0]));
-    *output_str = '\0';
-    char *p = output_str;
-
-    if (mask & UBX_PROTO_MASK_UBX)     p += sprintf(p, "UBX+");
-    if (mask & UBX_PROTO_MASK_NMEA)    p += sprintf(p, "NMEA+");
-    if (mask & UBX_PROTO_MASK_RTCM2)   p += sprintf(p, "RTCM2+");
-    if (mask & UBX_PROTO_MASK_RTCM3)   p += sprintf(p, "RTCM3+");
-    if (mask & UBX_PROTO_MASK_SPARTN)  p += sprintf(p, "SPARTN+");
-    if (mask & UBX_PROTO_MASK_USER0)   p += sprintf(p, "USER0+");
-    if (mask & UBX_PROTO_MASK_USER1)   p += sprintf(p, "USER1+");
-    if (mask & UBX_PROTO_MASK_USER2)   p += sprintf(p, "USER2+");
-    if (mask & UBX_PROTO_MASK_USER3)   p += sprintf(p, "USER3+");
-
-    if (p > output_str)
-        *(--p) = '\0';        // remove trailing '+'
-
-    return output_str;
-}
-
-static const char * const ubx_inf_str(uint16_t mask)
-{
-    if (mask == UBX_INF_MASK_ALL) return "All";
-    if (mask == UBX_INF_MASK_NONE) return "None";
-
-    static _Thread_local char buffers[4][128];
-    static _Thread_local int index = 0;
-    char *output_str = buffers[index];
-    index = (index + 1) % (sizeof(buffers) / sizeof(buffers[0]));
-    *output_str = '\0';
-    char *p = output_str;
-
-    if (mask & UBX_INF_MASK_ERROR)     p += sprintf(p, "Error+");
-    if (mask & UBX_INF_MASK_WARNING)   p += sprintf(p, "Warning+");
-    if (mask & UBX_INF_MASK_NOTICE)    p += sprintf(p, "Notice+");
-    if (mask & UBX_INF_MASK_TEST)      p += sprintf(p, "Test+");
-    if (mask & UBX_INF_MASK_DEBUG)     p += sprintf(p, "Debug+");
-    if (mask & UBX_INF_MASK_reserved5) p += sprintf(p, "Reserved5+");
-    if (mask & UBX_INF_MASK_reserved6) p += sprintf(p, "Reserved6+");
-    if (mask & UBX_INF_MASK_USER)      p += sprintf(p, "User+");
-
-    if (p > output_str)
-        *(--p) = '\0';        // remove trailing '+'
-
-    return output_str;
-}
-
-static const char * const ubx_databits_str(uint8_t val)
+static inline const char *ubx_databits_str(uint8_t val)
 {
     switch(val) {
     case 0:    return "5";
@@ -240,7 +96,7 @@ static const char * const ubx_databits_str(uint8_t val)
     }
 }
 
-static const char * const ubx_parity_str(uint8_t parity)
+static inline const char *ubx_parity_str(uint8_t parity)
 {
     if (parity == 0)                                  return "Even";
     else if (parity == 1)                             return "Odd";
@@ -249,7 +105,7 @@ static const char * const ubx_parity_str(uint8_t parity)
     else                                              return "(invalid)";
 }
 
-static const char * const ubx_stopbits_str(uint8_t val)
+static inline const char *ubx_stopbits_str(uint8_t val)
 {
     switch(val) {
     case 0:    return "1";
@@ -260,12 +116,12 @@ static const char * const ubx_stopbits_str(uint8_t val)
     }
 }
 
-static const char * const ubx_bitorder_str(uint8_t bitorder)
+static inline const char *ubx_bitorder_str(uint8_t bitorder)
 {
   return (bitorder == 0) ? "LSBfirst" : "MSBfirst";
 }
 
-static const char * const ubx_polarity_str(uint8_t val)
+static inline const char *ubx_polarity_str(uint8_t val)
 {
     static _Thread_local char output_str[30];
     *output_str = '\0';
@@ -273,7 +129,7 @@ static const char * const ubx_polarity_str(uint8_t val)
     return output_str;
 }
 
-static const char * const ubx_threshold_str(uint8_t val)
+static inline const char *ubx_threshold_str(uint8_t val)
 {
     static _Thread_local char output_str[20];
     *output_str = '\0';
@@ -281,24 +137,23 @@ static const char * const ubx_threshold_str(uint8_t val)
     return output_str;
 }
 
-static const char * const ubx_gnss_str(uint8_t gnssID)
+static inline const char *ubx_layers_str(uint8_t mask)
 {
-    switch(gnssID) {
-    case UBX_GNSS_GPS:      return "GPS";
-    case UBX_GNSS_SBAS:     return "SBAS";
-    case UBX_GNSS_GALILEO:  return "Galileo";
-    case UBX_GNSS_BEIDOU:   return "BeiDou";
-    case UBX_GNSS_IMES:     return "IMES";
-    case UBX_GNSS_QZSS:     return "QZSS";
-    case UBX_GNSS_GLONASS:  return "GLONASS";
-    case UBX_GNSS_NAVIC:    return "NAVIC";
-    default:                return "???";
-    }
-}
+    if (mask == 0)
+        return "(none)";
 
-static const char * const ubx_enabled_str(uint8_t val)
-{
-    return (val == 0) ? "off" : "on";
+    static _Thread_local char output_str[32];
+    *output_str = '\0';
+    char *p = output_str;
+
+    if (mask & UBX_VAL_LAYER_RAM)      p += sprintf(p, "RAM+");
+    if (mask & UBX_VAL_LAYER_BBR)      p += sprintf(p, "BBR+");
+    if (mask & UBX_VAL_LAYER_FLASH)    p += sprintf(p, "Flash+");
+
+    if (p > output_str)
+        *(--p) = '\0';        // remove trailing '+'
+
+    return output_str;
 }
 
 static char *disassemble_ubx_bytes(const uint8_t * const msg, size_t len) {
@@ -372,89 +227,52 @@ static char *disassemble_ubx_bytes(const uint8_t * const msg, size_t len) {
             if ((id == UBX_ID_ACK_NAK || id == UBX_ID_ACK_ACK) && payload_len == 2) {
                 p += sprintf(p, "UBX-%s-%s", ubx_class_name(payload[0]), ubx_id_name(payload[0], payload[1]));
             }
-        } else if (cls == UBX_CLS_CFG) {
-            if (id == UBX_ID_CFG_MSG) {
-                const uint16_t msg_id = payload[0] << 8 | payload[1];
-                if (msg_id >= 0xF000 && msg_id <= 0xF010) {
-                    p += sprintf(p, "NMEA-Gx%s I2C=%d UART1=%d UART2=%d USB=%d SPI=%d",
-                            ubx_nmea_name(msg_id), payload[2], payload[3], payload[4], payload[5], payload[6]);
-                }
-            } else if (id == UBX_ID_CFG_PRT) {
-                p += sprintf(p, "PortID=%s", ubx_port_str(payload[0]));
-
-                if (payload_len == sizeof(ubx_cfg_prt_t)) {
-                    const ubx_cfg_prt_t * const prt = (const ubx_cfg_prt_t * const)payload;
-
-                    p += sprintf(p, " ProtocolIn=%s ProtocolOut=%s",
-                                 ubx_protocols_str(prt->protocolIn),
-                                 ubx_protocols_str(prt->protocolOut));
-
-                    switch(prt->portID) {
-                    case UBX_PORT_I2C:
-                        p += sprintf(p, " SlaveAddr=0x%02X Clock=%u",
-                                     prt->i2c.i2c_slave_addr,
-                                     prt->baudRate);
-                        break;
-
-                    case UBX_PORT_UART1:
-                    case UBX_PORT_UART2:
-                        p += sprintf(p, " Baudrate=%u Databits=%s Stopbits=%s Parity=%s BitOrder=%s",
-                                     prt->baudRate,
-                                     ubx_databits_str(prt->uart.charLen),
-                                     ubx_stopbits_str(prt->uart.stopBits),
-                                     ubx_parity_str(prt->uart.parity),
-                                     ubx_bitorder_str(prt->uart.bitOrder));
-                        break;
-
-                    case UBX_PORT_USB:
-                        // nothing extra for USB
-                        break;
-
-                    case UBX_PORT_SPI:
-                        p += sprintf(p, " Clock=%u CPOL=%u CPHA=%u MSBfirst=%u",
-                                     prt->baudRate,
-                                     prt->spi.cpol,
-                                     prt->spi.cpha,
-                                     prt->spi.msbFirst);
+        } else if (cls == UBX_CLS_CFG && id == UBX_ID_CFG_MSG && payload_len >= 2) {
+            // name the message whose rate is set, then the rates themselves
+            const ubx_msgdb_msg_t *m = ubx_msgdb_select(cls, id, payload, payload_len);
+            p += sprintf(p, "%s-%s-%s", payload[0] >= 0xF0 ? "NMEA" : "UBX",
+                         ubx_class_name(payload[0]), ubx_id_name(payload[0], payload[1]));
+            if (m) {
+                *p++ = ' ';
+                p += ubx_msgdb_format(m, payload, payload_len, p, output_str_max - (size_t)(p - output_str) - 64);
+            }
+        } else if (cls == UBX_CLS_CFG && (id == UBX_ID_CFG_VALSET || id == UBX_ID_CFG_VALGET)) {
+            // key/value lists, which the message database cannot describe
+            if (payload_len >= UBX_VALCFG_HDR_LEN) {
+                // a VALGET poll carries bare keys, everything else key=value pairs
+                bool poll = (id == UBX_ID_CFG_VALGET && payload[0] == 0);
+                if (id == UBX_ID_CFG_VALSET)
+                    p += sprintf(p, "Version=%u Layers=%s Transaction=%u", payload[0],
+                                 ubx_layers_str(payload[1]), payload[2] & 3);
+                else
+                    p += sprintf(p, "Version=%u Layer=%u Position=%u", payload[0], payload[1],
+                                 payload[2] | payload[3] << 8);
+
+                const uint8_t *kp = payload + UBX_VALCFG_HDR_LEN, *end = payload + payload_len;
+                ubx_valcfg_kv_t kv;
+                while (kp < end) {
+                    if ((size_t)(p - output_str) + 160 > output_str_max) {
+                        p += sprintf(p, " ...");
                         break;
                     }
-
-                    // TX-ready / PIO
-                    p += sprintf(p, " TxReadyEnable=%u TxReadyPolarity=%u(%s) TxReadyGPIO=%u TxReadyThreshold=%u(%s)",
-                                 prt->en,
-                                 prt->pol, ubx_polarity_str(prt->pol),
-                                 prt->pin,
-                                 prt->thres, ubx_threshold_str(prt->thres));
-
-                    // Port flags
-                    p += sprintf(p, " ExtendedTxTimeout=%u", prt->extendedTxTimeout);
-                }
-            } else if (id == UBX_ID_CFG_GNSS) {
-                const ubx_cfg_gnss_t * const gnss = (const ubx_cfg_gnss_t * const)payload;
-
-                p += sprintf(p, "Version=%u ChannelsAvailable=%u ChannelsToUse=%u NumConfigBlocks=%u",
-                             gnss->msgVer, gnss->numTrkChHw, gnss->numTrkChUse, gnss->numConfigBlocks);
-
-                for (int i = 0; i < gnss->numConfigBlocks; i++) {
-                    const ubx_cfg_gnss_block_t * const b = &(gnss->blocks[i]);
-                    p += sprintf(p, " %u:[%s(%u)=%s min=%u max=%u signal=%u]", (i + 1),
-                                 ubx_gnss_str(b->gnssId), b->gnssId, ubx_enabled_str(b->enable),
-                                 b->resTrkCh, b->maxTrkCh, b->sigCfgMask);
-                }
-            } else if (id == UBX_ID_CFG_INF) {
-                const ubx_cfg_inf_t * const inf = (const ubx_cfg_inf_t * const)payload;
-
-                p += sprintf(p, "Protocol=%u(%s)", 
-                             inf->protocolID, ubx_protocol_str(inf->protocolID));
-
-                if (payload_len == sizeof(ubx_cfg_inf_t)) {
-                    for (int i = 0; i < 6; i++) {
-                        p += sprintf(p, " Target%u=%s:%s",
-                                     i, ubx_port_str(i),
-                                     ubx_inf_str(inf->infMsgMask[i].mask));
+                    if (poll) {
+                        if (end - kp < 4)
+                            break;
+                        p += sprintf(p, " %s", ubx_valcfg_name(kp[0] | kp[1] << 8 | kp[2] << 16 | (uint32_t)kp[3] << 24));
+                        kp += 4;
+                    } else {
+                        if (!ubx_valcfg_next(&kp, end, &kv))
+                            break;
+                        *p++ = ' ';
+                        p += ubx_valcfg_format(&kv, p, 120);
                     }
                 }
             }
+        } else {
+            // everything else field by field, from the message database
+            const ubx_msgdb_msg_t *m = ubx_msgdb_select(cls, id, payload, payload_len);
+            if (m)
+                p += ubx_msgdb_format(m, payload, payload_len, p, output_str_max - (size_t)(p - output_str) - 64);
         }
     }
 
@@ -21,6 +21,8 @@
 *******************************************************************************/
 #include "pp_utils.h"
 #include <inttypes.h>
+#include <stddef.h>
+#include <ctype.h>
 
 #define UBX_MIN_MSG_SIZE 8
 #define UBX_MAX_MSG_SIZE 1024
@@ -77,6 +79,119 @@ static const ubx_msg_t name = {                                \
     cls,                                                       \
     id };
 
+/*
+ * UBX_MESSAGE_TYPED(name, cls, id, type, (field, value)...)
+ * ---------------------------------------------------------
+ * Defines the same static const frame and ubx_msg_t as UBX_MESSAGE, but
+ * the payload is a 'type' from ubx_payload.h filled in by field name:
+ *
+ *   UBX_CFG_PRT_TYPED(set_cfg_prt_uart1_nmea,
+ *       (portID, UBX_PORT_UART1), (mode, 0x000008D0), (baudRate, 9600), ...)
+ *
+ * Each pair becomes the designated initializer '.field = (value)', and the
+ * checksum is summed from the little-endian bytes of every value at
+ * offsetof(type, field), so it is still a constant expression.  Fields not
+ * named are zero.  A field name that does not exist, a value that does not
+ * fit the field and a bit-field (set the word that contains it) are
+ * compile errors.  Name each byte once: overlapping union members would be
+ * counted twice in the checksum.  Up to 32 pairs.
+ */
+#define UBX_PP_STRIP(...) __VA_ARGS__
+
+#define UBX_FIELD_SIZE(type, field) sizeof(((type *)0)->field)
+#define UBX_FIELD_MAX(size)         (UINT64_MAX >> (64 - 8 * (size)))
+
+// Representable in 'size' bytes, as unsigned or as two's complement
+#define UBX_FIELD_FITS(value, size)                                          \
+    ((uint64_t)(value) <= UBX_FIELD_MAX(size) ||                             \
+     (uint64_t)(value) >= (uint64_t)0 - (UBX_FIELD_MAX(size) >> 1) - 1)
+
+// Little-endian byte k of a value, 0 past the end of the field
+#define UBX_FIELD_BYTE(value, k, size)                                       \
+    ((k) < (size) ? ((uint64_t)(value) >> (8 * (k))) & 0xFF : 0)
+
+// A field's share of CK_A, and of CK_B where the byte at payload offset o
+// is weighted by the payload_len - o bytes from it to the end of the frame
+#define UBX_FIELD_SUM(v, s)                                                  \
+    (UBX_FIELD_BYTE(v, 0, s) + UBX_FIELD_BYTE(v, 1, s) + UBX_FIELD_BYTE(v, 2, s) + \
+     UBX_FIELD_BYTE(v, 3, s) + UBX_FIELD_BYTE(v, 4, s) + UBX_FIELD_BYTE(v, 5, s) + \
+     UBX_FIELD_BYTE(v, 6, s) + UBX_FIELD_BYTE(v, 7, s))
+#define UBX_FIELD_CSUM(v, s, w)                                              \
+    ((w) * UBX_FIELD_BYTE(v, 0, s) + ((w) - 1) * UBX_FIELD_BYTE(v, 1, s) +   \
+     ((w) - 2) * UBX_FIELD_BYTE(v, 2, s) + ((w) - 3) * UBX_FIELD_BYTE(v, 3, s) + \
+     ((w) - 4) * UBX_FIELD_BYTE(v, 4, s) + ((w) - 5) * UBX_FIELD_BYTE(v, 5, s) + \
+     ((w) - 6) * UBX_FIELD_BYTE(v, 6, s) + ((w) - 7) * UBX_FIELD_BYTE(v, 7, s))
+
+// PP_MAP callbacks: 'fv' is one (field, value) pair
+#define UBX_FIELD_CHECK(type, fv)    UBX_FIELD_CHECK_(type, UBX_PP_STRIP fv)
+#define UBX_FIELD_CHECK_(...)        UBX_FIELD_CHECK__(__VA_ARGS__)
+#define UBX_FIELD_CHECK__(type, field, value)                                \
+    _Static_assert(UBX_FIELD_FITS(value, UBX_FIELD_SIZE(type, field)),       \
+                   #type "." #field ": value does not fit the field");
+#define UBX_FIELD_INIT(type, fv)     UBX_FIELD_INIT_(type, UBX_PP_STRIP fv)
+#define UBX_FIELD_INIT_(...)         UBX_FIELD_INIT__(__VA_ARGS__)
+#define UBX_FIELD_INIT__(type, field, value) .field = (value),
+#define UBX_FIELD_CK_A(type, fv)     UBX_FIELD_CK_A_(type, UBX_PP_STRIP fv)
+#define UBX_FIELD_CK_A_(...)         UBX_FIELD_CK_A__(__VA_ARGS__)
+#define UBX_FIELD_CK_A__(type, field, value)                                 \
+    + UBX_FIELD_SUM(value, UBX_FIELD_SIZE(type, field))
+#define UBX_FIELD_CK_B(type, fv)     UBX_FIELD_CK_B_(type, UBX_PP_STRIP fv)
+#define UBX_FIELD_CK_B_(...)         UBX_FIELD_CK_B__(__VA_ARGS__)
+#define UBX_FIELD_CK_B__(type, field, value)                                 \
+    + UBX_FIELD_CSUM(value, UBX_FIELD_SIZE(type, field), sizeof(type) - offsetof(type, field))
+
+#define UBX_MESSAGE_TYPED(name, cls, id, type, ...)                          \
+PP_MAP(UBX_FIELD_CHECK, type, __VA_ARGS__)                                   \
+static const struct __attribute__((packed)) {                                \
+    uint8_t head[6];                                                         \
+    type    payload;                                                         \
+    uint8_t ck[2];                                                           \
+} CONCAT(_,name) = {                                                         \
+    { UBX_SYNC1, UBX_SYNC2, cls, id, sizeof(type) & 0xFF, sizeof(type) >> 8 & 0xFF }, \
+    { PP_MAP(UBX_FIELD_INIT, type, __VA_ARGS__) },                           \
+    { (cls + id + (sizeof(type) & 0xFF) + (sizeof(type) >> 8 & 0xFF)        \
+       PP_MAP(UBX_FIELD_CK_A, type, __VA_ARGS__)) & 0xFF,                    \
+      ((sizeof(type) + 4) * cls + (sizeof(type) + 3) * id +                  \
+       (sizeof(type) + 2) * (sizeof(type) & 0xFF) + (sizeof(type) + 1) * (sizeof(type) >> 8 & 0xFF) \
+       PP_MAP(UBX_FIELD_CK_B, type, __VA_ARGS__)) & 0xFF } };                \
+_Static_assert(sizeof(CONCAT(_,name)) == UBX_MIN_MSG_SIZE + sizeof(type),    \
+               #name ": frame is not header, payload and checksum");         \
+static const ubx_msg_t name = {                                              \
+    (const uint8_t *)&CONCAT(_,name),                                        \
+    sizeof(CONCAT(_,name)),                                                  \
+    (const uint8_t *)&CONCAT(_,name).payload,                                \
+    sizeof(type),                                                            \
+    cls,                                                                     \
+    id };
+
+// Build a UBX frame at run time (for payloads not known at compile time).
+// Returns the frame length, or 0 if it does not fit in 'size' bytes.
+static inline size_t ubx_frame_build(uint8_t *out, size_t size, uint8_t cls, uint8_t id,
+                                     const void *payload, size_t payload_len)
+{
+    size_t len = payload_len + UBX_MIN_MSG_SIZE;
+    if (len > size || len > UBX_MAX_MSG_SIZE)
+        return 0;
+
+    out[0] = UBX_SYNC1;
+    out[1] = UBX_SYNC2;
+    out[2] = cls;
+    out[3] = id;
+    out[4] = payload_len & 0xFF;
+    out[5] = (payload_len >> 8) & 0xFF;
+    if (payload_len)
+        memcpy(&out[6], payload, payload_len);
+
+    uint8_t ck_a = 0, ck_b = 0;
+    for (size_t i = 2; i < len - 2; i++) {
+        ck_a += out[i];
+        ck_b += ck_a;
+    }
+    out[len - 2] = ck_a;
+    out[len - 1] = ck_b;
+    return len;
+}
+
 // --- Macros to create and invoke a list of UBX messages ---
 #define UBX_BEGIN_LIST static const ubx_entry_t ubxArrayList[] = {
 #define UBX_FUNCTION(name, func) { &name, func },
@@ -179,8 +294,12 @@ static const ubx_msg_t name = {                                \
 #define UBX_ID_CFG_NAV5          0x24
 #define UBX_ID_CFG_TP5           0x31
 #define UBX_ID_CFG_PM2           0x3B
+#define UBX_ID_CFG_TMODE2        0x3D
 #define UBX_ID_CFG_GNSS          0x3E
 #define UBX_ID_CFG_PWR           0x57
+#define UBX_ID_CFG_VALSET        0x8A
+#define UBX_ID_CFG_VALGET        0x8B
+#define UBX_ID_CFG_VALDEL        0x8C
 #define UBX_CFG_PRT(name, ...)   UBX_MESSAGE(name, CLS_CFG, UBX_ID_CFG_PRT,   ##__VA_ARGS__)
 #define UBX_CFG_MSG(name, ...)   UBX_MESSAGE(name, CLS_CFG, UBX_ID_CFG_MSG,   ##__VA_ARGS__)
 #define UBX_CFG_INF(name, ...)   UBX_MESSAGE(name, CLS_CFG, UBX_ID_CFG_INF,   ##__VA_ARGS__)
@@ -194,8 +313,19 @@ static const ubx_msg_t name = {                                \
 #define UBX_CFG_NAV5(name, ...)  UBX_MESSAGE(name, CLS_CFG, UBX_ID_CFG_NAV5,  ##__VA_ARGS__)
 #define UBX_CFG_TP5(name, ...)   UBX_MESSAGE(name, CLS_CFG, UBX_ID_CFG_TP5,   ##__VA_ARGS__)
 #define UBX_CFG_PM2(name, ...)   UBX_MESSAGE(name, CLS_CFG, UBX_ID_CFG_PM2,   ##__VA_ARGS__)
+#define UBX_CFG_TMODE2(name, ...) UBX_MESSAGE(name, CLS_CFG, UBX_ID_CFG_TMODE2, ##__VA_ARGS__)
 #define UBX_CFG_GNSS(name, ...)  UBX_MESSAGE(name, CLS_CFG, UBX_ID_CFG_GNSS,  ##__VA_ARGS__)
 #define UBX_CFG_PWR(name, ...)   UBX_MESSAGE(name, CLS_CFG, UBX_ID_CFG_PWR,   ##__VA_ARGS__)
+#define UBX_CFG_VALSET(name, ...) UBX_MESSAGE(name, CLS_CFG, UBX_ID_CFG_VALSET, ##__VA_ARGS__)
+#define UBX_CFG_VALGET(name, ...) UBX_MESSAGE(name, CLS_CFG, UBX_ID_CFG_VALGET, ##__VA_ARGS__)
+
+// Typed forms, payload fields by name (see UBX_MESSAGE_TYPED)
+#define UBX_CFG_PRT_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, CLS_CFG, UBX_ID_CFG_PRT,  ubx_cfg_prt_t,       __VA_ARGS__)
+#define UBX_CFG_TP_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, CLS_CFG, UBX_ID_CFG_TP,   ubx_cfg_tp_data0_t,  __VA_ARGS__)
+#define UBX_CFG_TP5_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, CLS_CFG, UBX_ID_CFG_TP5,  ubx_cfg_tp5_data1_t, __VA_ARGS__)
+#define UBX_CFG_RATE_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, CLS_CFG, UBX_ID_CFG_RATE, ubx_cfg_rate_data0_t, __VA_ARGS__)
+#define UBX_CFG_CFG_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, CLS_CFG, UBX_ID_CFG_CFG,  ubx_cfg_cfg_t,       __VA_ARGS__)
+#define UBX_CFG_TMODE2_TYPED(name, ...) UBX_MESSAGE_TYPED(name, CLS_CFG, UBX_ID_CFG_TMODE2, ubx_cfg_tmode2_t,  __VA_ARGS__)
 
 // UBX-CFG-PRT
 #define UBX_PORT_I2C             0
@@ -260,10 +390,12 @@ static const ubx_msg_t name = {                                \
 #define UBX_ID_NAV_PVT           0x07
 #define UBX_ID_NAV_HPPOSECEF     0x13
 #define UBX_ID_NAV_HPPOSLLH      0x14
+#define UBX_ID_NAV_TIMEUTC       0x21
 #define UBX_ID_NAV_RELPOSNED     0x3C
 #define UBX_NAV_PVT(name)        UBX_MESSAGE(name, CLS_NAV, UBX_ID_NAV_PVT)
 #define UBX_NAV_HPPOSECEF(name)  UBX_MESSAGE(name, CLS_NAV, UBX_ID_NAV_HPPOSECEF)
 #define UBX_NAV_HPPOSLLH(name)   UBX_MESSAGE(name, CLS_NAV, UBX_ID_NAV_HPPOSLLH)
+#define UBX_NAV_TIMEUTC(name)    UBX_MESSAGE(name, CLS_NAV, UBX_ID_NAV_TIMEUTC)
 #define UBX_NAV_RELPOSNED(name)  UBX_MESSAGE(name, CLS_NAV, UBX_ID_NAV_RELPOSNED)
 
 // Monitoring messages (MON)
@@ -280,6 +412,10 @@ static const ubx_msg_t name = {                                \
 #define UBX_MON_TXBUF(name)      UBX_MESSAGE(name, CLS_MON, UBX_ID_MON_TXBUF)
 #define UBX_MON_RXBUF(name)      UBX_MESSAGE(name, CLS_MON, UBX_ID_MON_RXBUF)
 
+// Security messages (SEC)
+#define UBX_ID_SEC_UNIQID        0x03
+#define UBX_SEC_UNIQID(name)     UBX_MESSAGE(name, CLS_SEC, UBX_ID_SEC_UNIQID)
+
 
 // Debug print helper
 
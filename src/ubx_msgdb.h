@@ -0,0 +1,419 @@
+#ifndef UBX_MSGDB_H
+#define UBX_MSGDB_H
+/*******************************************************************************
+ ubx_msgdb.h
+
+ Table-driven description of every public UBX message, for the disassembler.
+
+ The tables in ubx_msgdb_tables.h are generated by test/gen-ubx-msgdb.py
+ from the u-center 2 message database in test/ucenter2.  A descriptor is
+ one variant of a class/id (e.g. UBX-CFG-PRT-UART, UBX-NAV-PVT-DATA1) and
+ lists the payload as groups of fields, each group present once, optionally,
+ a constant number of times, as often as a count field says, or as often
+ as the remaining length allows.  Fields carry their offset within the
+ group, wire type, repeat count and bitfields.
+
+ The descriptors are sorted by class and id, so ubx_msgdb_find() is one
+ binary search.  ubx_msgdb_select() then picks the variant a payload is
+ an instance of, using the database's own rules (payload length, or a
+ version/type byte), and ubx_msgdb_format() prints it field by field.
+
+ Example:
+   const ubx_msgdb_msg_t *m = ubx_msgdb_select(0x01, 0x21, payload, 20);
+   ubx_msgdb_format(m, payload, 20, buf, sizeof(buf));
+     ->  "DATA0 iTOW=412345000 tAcc=22 nano=-187 ... valid=0x07(validTOW=1 ...)"
+
+ Copyright (C) 2025 Richard Elwell
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*******************************************************************************/
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+// Wire types, in the database's notation
+typedef enum {
+    UBX_MSGDB_U1, UBX_MSGDB_U2, UBX_MSGDB_U4,
+    UBX_MSGDB_I1, UBX_MSGDB_I2, UBX_MSGDB_I4,
+    UBX_MSGDB_X1, UBX_MSGDB_X2, UBX_MSGDB_X4,
+    UBX_MSGDB_R4, UBX_MSGDB_R8,
+    UBX_MSGDB_CH
+} ubx_msgdb_type_t;
+
+// How often a group occurs
+typedef enum {
+    UBX_MSGDB_ONCE,
+    UBX_MSGDB_OPTIONAL,         // once if the payload is long enough
+    UBX_MSGDB_BY_SIZE,          // until the end of the payload
+    UBX_MSGDB_BY_FIELD,         // 'count' is the payload offset of the count field
+    UBX_MSGDB_BY_CONST          // 'count' times
+} ubx_msgdb_repeat_t;
+
+typedef struct {
+    uint8_t cls;
+    const char *name;
+} ubx_msgdb_class_t;
+
+typedef struct {
+    const char *name;
+    uint8_t shift, width;
+    uint8_t is_signed;
+} ubx_msgdb_bits_t;
+
+typedef struct {
+    const char *name;
+    uint16_t offset;            // within the group
+    uint8_t  type;              // ubx_msgdb_type_t
+    uint16_t repeat;            // array length, 1 for a scalar
+    uint8_t  reserved;
+    uint16_t bits_first;        // into ubx_msgdb_bits[]
+    uint8_t  bits_count;
+} ubx_msgdb_field_t;
+
+typedef struct {
+    const char *name;
+    uint16_t size;
+    uint8_t  repeat;            // ubx_msgdb_repeat_t
+    uint16_t count;
+    uint8_t  count_type;        // type of the count field for UBX_MSGDB_BY_FIELD
+    uint16_t field_first;       // into ubx_msgdb_fields[]
+    uint8_t  field_count;
+} ubx_msgdb_group_t;
+
+typedef struct {
+    uint16_t key;               // class << 8 | id
+    const char *name;           // "PVT"
+    const char *variant;        // "DATA0", empty for NMEA names
+    uint16_t group_first;       // into ubx_msgdb_groups[]
+    uint8_t  group_count;
+} ubx_msgdb_msg_t;
+
+// Variant selection: a rule matches when each of its conditions does
+typedef struct {
+    int16_t  offset;            // payload offset of a U1/U2, -1 for the payload length
+    uint8_t  size;
+    uint16_t val_first;         // into ubx_msgdb_vals[]
+    uint8_t  val_count;
+} ubx_msgdb_cond_t;
+
+typedef struct {
+    uint16_t key;
+    uint16_t msg;               // into ubx_msgdb_msgs[]
+    uint16_t cond_first;        // into ubx_msgdb_conds[]
+    uint8_t  cond_count;
+} ubx_msgdb_rule_t;
+
+#include "ubx_msgdb_tables.h"
+
+#define UBX_MSGDB_KEY(cls, id) ((uint16_t)((cls) << 8 | (id)))
+#define UBX_MSGDB_COUNT(a) (sizeof(a) / sizeof((a)[0]))
+
+static inline size_t ubx_msgdb_type_size(uint8_t type)
+{
+    static const uint8_t size[] = { 1, 2, 4, 1, 2, 4, 1, 2, 4, 4, 8, 1 };
+    return type < sizeof(size) ? size[type] : 1;
+}
+
+// Little-endian value of 'type' at 'p', unsigned and zero-extended
+static inline uint64_t ubx_msgdb_get(const uint8_t *p, uint8_t type)
+{
+    uint64_t v = 0;
+    for (size_t i = ubx_msgdb_type_size(type); i-- > 0; )
+        v = v << 8 | p[i];
+    return v;
+}
+
+static inline const char *ubx_msgdb_class_name(uint8_t cls)
+{
+    size_t lo = 0, hi = UBX_MSGDB_COUNT(ubx_msgdb_classes);
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (ubx_msgdb_classes[mid].cls < cls)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return (lo < UBX_MSGDB_COUNT(ubx_msgdb_classes) && ubx_msgdb_classes[lo].cls == cls)
+           ? ubx_msgdb_classes[lo].name : NULL;
+}
+
+/*
+ * ubx_msgdb_find()
+ * ----------------
+ * First descriptor of class/id, or NULL.  The other variants follow it;
+ * *count (if not NULL) receives their number including the first.
+ */
+static inline const ubx_msgdb_msg_t *ubx_msgdb_find(uint8_t cls, uint8_t id, size_t *count)
+{
+    const uint16_t key = UBX_MSGDB_KEY(cls, id);
+    size_t lo = 0, hi = UBX_MSGDB_COUNT(ubx_msgdb_msgs);
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (ubx_msgdb_msgs[mid].key < key)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    size_t n = 0;
+    while (lo + n < UBX_MSGDB_COUNT(ubx_msgdb_msgs) && ubx_msgdb_msgs[lo + n].key == key)
+        n++;
+    if (count)
+        *count = n;
+    return n ? &ubx_msgdb_msgs[lo] : NULL;
+}
+
+static inline bool ubx_msgdb_cond_match(const ubx_msgdb_cond_t *c, const uint8_t *payload, size_t len)
+{
+    uint64_t v;
+    if (c->offset < 0) {
+        v = len;
+    } else {
+        if ((size_t)c->offset + c->size > len)
+            return false;
+        v = ubx_msgdb_get(&payload[c->offset], c->size == 2 ? UBX_MSGDB_U2 : UBX_MSGDB_U1);
+    }
+    for (size_t i = 0; i < c->val_count; i++)
+        if (ubx_msgdb_vals[c->val_first + i] == v)
+            return true;
+    return false;
+}
+
+// Instances of 'grp' starting at payload offset 'pos'
+static inline size_t ubx_msgdb_group_count(const ubx_msgdb_group_t *grp, const uint8_t *payload,
+                                           size_t len, size_t pos)
+{
+    switch (grp->repeat) {
+    case UBX_MSGDB_OPTIONAL:
+        return (pos + grp->size <= len) ? 1 : 0;
+    case UBX_MSGDB_BY_SIZE:
+        return (len > pos && grp->size) ? (len - pos) / grp->size : 0;
+    case UBX_MSGDB_BY_FIELD:
+        if (grp->count + ubx_msgdb_type_size(grp->count_type) > len)
+            return 0;
+        return (size_t)ubx_msgdb_get(&payload[grp->count], grp->count_type);
+    case UBX_MSGDB_BY_CONST:
+        return grp->count;
+    default:
+        return 1;
+    }
+}
+
+/*
+ * ubx_msgdb_layout()
+ * ------------------
+ * Payload length 'msg' describes for this payload, following count fields
+ * and filling by-size groups from 'len'.  Returns -1 if the payload is too
+ * short for it.
+ */
+static inline long ubx_msgdb_layout(const ubx_msgdb_msg_t *msg, const uint8_t *payload, size_t len)
+{
+    size_t pos = 0;
+    for (size_t g = 0; g < msg->group_count; g++) {
+        const ubx_msgdb_group_t *grp = &ubx_msgdb_groups[msg->group_first + g];
+        pos += ubx_msgdb_group_count(grp, payload, len, pos) * grp->size;
+        if (pos > len)
+            return -1;
+    }
+    return (long)pos;
+}
+
+/*
+ * ubx_msgdb_select()
+ * ------------------
+ * Descriptor of the variant of class/id that 'payload' is an instance of.
+ * The first matching variant rule wins; without one, the first variant
+ * whose layout fits 'len' exactly, then the only variant if there is just
+ * one.  NULL if the message is unknown or no variant fits.
+ */
+static inline const ubx_msgdb_msg_t *ubx_msgdb_select(uint8_t cls, uint8_t id,
+                                                      const uint8_t *payload, size_t len)
+{
+    size_t count;
+    const ubx_msgdb_msg_t *first = ubx_msgdb_find(cls, id, &count);
+    if (!first || first->variant[0] == '\0')
+        return NULL;
+
+    const uint16_t key = UBX_MSGDB_KEY(cls, id);
+    size_t lo = 0, hi = UBX_MSGDB_COUNT(ubx_msgdb_rules);
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (ubx_msgdb_rules[mid].key < key)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    for (; lo < UBX_MSGDB_COUNT(ubx_msgdb_rules) && ubx_msgdb_rules[lo].key == key; lo++) {
+        const ubx_msgdb_rule_t *r = &ubx_msgdb_rules[lo];
+        size_t c = 0;
+        while (c < r->cond_count && ubx_msgdb_cond_match(&ubx_msgdb_conds[r->cond_first + c], payload, len))
+            c++;
+        if (c == r->cond_count)
+            return &ubx_msgdb_msgs[r->msg];
+    }
+
+    for (size_t i = 0; i < count; i++)
+        if (ubx_msgdb_layout(&first[i], payload, len) == (long)len)
+            return &first[i];
+    return count == 1 ? first : NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+    char  *buf;
+    size_t size, len;
+    bool   full;
+} ubx_msgdb_out_t;
+
+static void ubx_msgdb_printf(ubx_msgdb_out_t *o, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+static void ubx_msgdb_printf(ubx_msgdb_out_t *o, const char *fmt, ...)
+{
+    if (o->full)
+        return;
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(&o->buf[o->len], o->size - o->len, fmt, ap);
+    va_end(ap);
+    if (n < 0 || (size_t)n >= o->size - o->len) {
+        o->len = o->size - 1;
+        o->full = true;
+    } else {
+        o->len += (size_t)n;
+    }
+}
+
+static void ubx_msgdb_put_value(ubx_msgdb_out_t *o, const uint8_t *p, uint8_t type)
+{
+    uint64_t v = ubx_msgdb_get(p, type);
+    switch (type) {
+    case UBX_MSGDB_I1: ubx_msgdb_printf(o, "%d", (int8_t)v); break;
+    case UBX_MSGDB_I2: ubx_msgdb_printf(o, "%d", (int16_t)v); break;
+    case UBX_MSGDB_I4: ubx_msgdb_printf(o, "%" PRId32, (int32_t)v); break;
+    case UBX_MSGDB_X1: ubx_msgdb_printf(o, "0x%02" PRIX64, v); break;
+    case UBX_MSGDB_X2: ubx_msgdb_printf(o, "0x%04" PRIX64, v); break;
+    case UBX_MSGDB_X4: ubx_msgdb_printf(o, "0x%08" PRIX64, v); break;
+    case UBX_MSGDB_R4: {
+        float f;
+        uint32_t u = (uint32_t)v;
+        memcpy(&f, &u, sizeof(f));
+        ubx_msgdb_printf(o, "%g", f);
+        break;
+    }
+    case UBX_MSGDB_R8: {
+        double d;
+        memcpy(&d, &v, sizeof(d));
+        ubx_msgdb_printf(o, "%.12g", d);
+        break;
+    }
+    default:
+        ubx_msgdb_printf(o, "%" PRIu64, v);
+        break;
+    }
+}
+
+#define UBX_MSGDB_ARRAY_MAX 16      // elements printed of an array field
+
+static void ubx_msgdb_put_field(ubx_msgdb_out_t *o, const ubx_msgdb_field_t *f, const uint8_t *p, size_t avail)
+{
+    const size_t size = ubx_msgdb_type_size(f->type);
+    size_t n = f->repeat;
+    if (n * size > avail)
+        n = avail / size;
+
+    if (f->type == UBX_MSGDB_CH) {
+        // text, up to the first NUL
+        const uint8_t *nul = memchr(p, '\0', n);
+        size_t l = nul ? (size_t)(nul - p) : n;
+        ubx_msgdb_printf(o, " %s=\"%.*s\"", f->name, (int)l, (const char *)p);
+        return;
+    }
+    if (f->repeat != 1) {
+        ubx_msgdb_printf(o, " %s=[", f->name);
+        for (size_t i = 0; i < n && i < UBX_MSGDB_ARRAY_MAX; i++) {
+            if (i)
+                ubx_msgdb_printf(o, " ");
+            ubx_msgdb_put_value(o, &p[i * size], f->type);
+        }
+        ubx_msgdb_printf(o, "%s]", n > UBX_MSGDB_ARRAY_MAX ? " ..." : "");
+        return;
+    }
+    if (n == 0)
+        return;
+
+    ubx_msgdb_printf(o, " %s=", f->name);
+    ubx_msgdb_put_value(o, p, f->type);
+    if (f->bits_count) {
+        uint64_t v = ubx_msgdb_get(p, f->type);
+        for (size_t b = 0; b < f->bits_count; b++) {
+            const ubx_msgdb_bits_t *bits = &ubx_msgdb_bits[f->bits_first + b];
+            uint64_t x = (v >> bits->shift) & ((UINT64_C(1) << bits->width) - 1);
+            if (bits->is_signed && bits->width < 64 && (x >> (bits->width - 1)))
+                ubx_msgdb_printf(o, "%s%s=%" PRId64, b ? " " : "(", bits->name,
+                                 (int64_t)(x | ~((UINT64_C(1) << bits->width) - 1)));
+            else
+                ubx_msgdb_printf(o, "%s%s=%" PRIu64, b ? " " : "(", bits->name, x);
+        }
+        ubx_msgdb_printf(o, ")");
+    }
+}
+
+/*
+ * ubx_msgdb_format()
+ * ------------------
+ * Writes the non-reserved fields of 'payload' as "name=value" pairs into
+ * 'buf', bitfields in parentheses after their field, arrays in brackets and
+ * each instance of a repeated group as " group[i]={...}".  Fields past the
+ * end of the payload are left out.  Returns the length written; a result
+ * that did not fit is cut short and ends in "...".
+ */
+static size_t ubx_msgdb_format(const ubx_msgdb_msg_t *msg, const uint8_t *payload, size_t len,
+                               char *buf, size_t size)
+{
+    ubx_msgdb_out_t o = { buf, size, 0, false };
+    if (size == 0)
+        return 0;
+    buf[0] = '\0';
+
+    ubx_msgdb_printf(&o, "%s", msg->variant);
+    size_t pos = 0;
+    for (size_t g = 0; g < msg->group_count && pos < len; g++) {
+        const ubx_msgdb_group_t *grp = &ubx_msgdb_groups[msg->group_first + g];
+        const size_t n = ubx_msgdb_group_count(grp, payload, len, pos);
+        const bool repeated = grp->repeat != UBX_MSGDB_ONCE && grp->repeat != UBX_MSGDB_OPTIONAL;
+
+        for (size_t i = 0; i < n && pos < len && !o.full; i++, pos += grp->size) {
+            if (repeated)
+                ubx_msgdb_printf(&o, " %s[%zu]={", grp->name, i);
+            for (size_t f = 0; f < grp->field_count; f++) {
+                const ubx_msgdb_field_t *fld = &ubx_msgdb_fields[grp->field_first + f];
+                if (fld->reserved || pos + fld->offset >= len)
+                    continue;
+                ubx_msgdb_put_field(&o, fld, &payload[pos + fld->offset], len - pos - fld->offset);
+            }
+            if (repeated)
+                ubx_msgdb_printf(&o, " }");
+        }
+    }
+
+    if (o.full && size >= 4)
+        memcpy(&buf[size - 4], "...", 4);
+    return o.len;
+}
+
+#endif // UBX_MSGDB_H
@@ -0,0 +1,6139 @@
+#ifndef UBX_MSGDB_TABLES_H
+#define UBX_MSGDB_TABLES_H
+/*******************************************************************************
+ ubx_msgdb_tables.h
+
+ Generated by test/gen-ubx-msgdb.py from test/ucenter2/ucenter2-messages.json
+ and ucenter2-variants.json, do not edit.  Types and lookups: ubx_msgdb.h.
+
+ 475 descriptors (438 UBX), 3044 fields, 1352 bitfields, 384 variant rules.
+
+ Copyright (C) 2025 Richard Elwell
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*******************************************************************************/
+
+static const ubx_msgdb_class_t ubx_msgdb_classes[] = {
+    { 0x01, "NAV" },
+    { 0x02, "RXM" },
+    { 0x03, "TRK" },
+    { 0x04, "INF" },
+    { 0x05, "ACK" },
+    { 0x06, "CFG" },
+    { 0x09, "UPD" },
+    { 0x0A, "MON" },
+    { 0x0B, "AID" },
+    { 0x0D, "TIM" },
+    { 0x10, "ESF" },
+    { 0x13, "MGA" },
+    { 0x21, "LOG" },
+    { 0x27, "SEC" },
+    { 0x28, "HNR" },
+    { 0x29, "NAV2" },
+    { 0xF0, "Standard" },
+    { 0xF1, "PUBX" },
+    { 0xF7, "NAV2" },
+};
+
+static const ubx_msgdb_bits_t ubx_msgdb_bits[] = {
+    { "gpsFixOk", 0, 1, 0 },  // 0
+    { "diffSoln", 1, 1, 0 },
+    { "wknSet", 2, 1, 0 },
+    { "towSet", 3, 1, 0 },
+    { "diffCorr", 0, 1, 0 },
+    { "carrSolnValid", 1, 1, 0 },
+    { "mapMatching", 6, 2, 0 },
+    { "psmState", 0, 2, 0 },
+    { "spoofDetState", 3, 2, 0 },
+    { "carrSoln", 6, 2, 0 },
+    { "GPSfixOK", 0, 1, 0 },
+    { "DiffSoln", 1, 1, 0 },
+    { "WKNSET", 2, 1, 0 },
+    { "TOWSET", 3, 1, 0 },
+    { "validDate", 0, 1, 0 },
+    { "validTime", 1, 1, 0 },
+    { "fullyResolved", 2, 1, 0 },
+    { "gnssFixOK", 0, 1, 0 },
+    { "diffSoln", 1, 1, 0 },
+    { "psmState", 2, 3, 0 },
+    { "validDate", 0, 1, 0 },
+    { "validTime", 1, 1, 0 },
+    { "fullyResolved", 2, 1, 0 },
+    { "validMag", 3, 1, 0 },
+    { "gnssFixOK", 0, 1, 0 },
+    { "diffSoln", 1, 1, 0 },
+    { "psmState", 2, 3, 0 },
+    { "headVehValid", 5, 1, 0 },
+    { "carrSoln", 6, 2, 0 },
+    { "confirmedAvai", 5, 1, 0 },
+    { "confirmedDate", 6, 1, 0 },
+    { "confirmedTime", 7, 1, 0 },
+    { "invalidLlh", 0, 1, 0 },
+    { "lastCorrectionAge", 1, 4, 0 },
+    { "authTime", 13, 1, 0 },
+    { "nmaFixStatus", 14, 1, 0 },
+    { "invalidEcef", 0, 1, 0 },
+    { "invalidLlh", 0, 1, 0 },
+    { "validDate", 0, 1, 0 },
+    { "validTime", 1, 1, 0 },
+    { "fullyResolved", 2, 1, 0 },
+    { "validMag", 3, 1, 0 },
+    { "gnssFixOK", 0, 1, 0 },
+    { "diffSoln", 1, 1, 0 },
+    { "vehRollValid", 3, 1, 0 },
+    { "vehPitchValid", 4, 1, 0 },
+    { "vehHeadingValid", 5, 1, 0 },
+    { "carrSoln", 6, 2, 0 },
+    { "confirmedAvai", 5, 1, 0 },
+    { "confirmedDate", 6, 1, 0 },
+    { "confirmedTime", 7, 1, 0 },  // 50
+    { "towValid", 0, 1, 0 },
+    { "weekValid", 1, 1, 0 },
+    { "leapSValid", 2, 1, 0 },
+    { "validTOW", 0, 1, 0 },
+    { "validWKN", 1, 1, 0 },
+    { "validUTC", 2, 1, 0 },
+    { "authStatus", 3, 1, 0 },
+    { "utcStandard", 4, 4, 0 },
+    { "todValid", 0, 1, 0 },
+    { "dateValid", 1, 1, 0 },
+    { "sowValid", 0, 1, 0 },
+    { "weekValid", 1, 1, 0 },
+    { "leapSValid", 2, 1, 0 },
+    { "galTowValid", 0, 1, 0 },
+    { "galWnoValid", 1, 1, 0 },
+    { "leapSValid", 2, 1, 0 },
+    { "validCurrLs", 0, 1, 0 },
+    { "validTimeToLsEvent", 1, 1, 0 },
+    { "qzssTowValid", 0, 1, 0 },
+    { "qzssWnoValid", 1, 1, 0 },
+    { "leapSValid", 2, 1, 0 },
+    { "wnoCheckedGPS", 0, 1, 0 },
+    { "wnoInvalidGPS", 1, 1, 0 },
+    { "UTCORefCheckedGPS", 2, 1, 0 },
+    { "UTCORefInvalidGPS", 3, 1, 0 },
+    { "lsValGPS", 0, 1, 0 },
+    { "dnRangeGPS", 1, 1, 0 },
+    { "totRangeGPS", 2, 1, 0 },
+    { "lsEventGPS", 3, 1, 0 },
+    { "recNowGPS", 4, 1, 0 },
+    { "wnoCheckedGAL", 0, 1, 0 },
+    { "wnoInvalidGAL", 1, 1, 0 },
+    { "lsValGAL", 0, 1, 0 },
+    { "dnRangeGAL", 1, 1, 0 },
+    { "totRangeGAL", 2, 1, 0 },
+    { "lsEventGAL", 3, 1, 0 },
+    { "recNowGAL", 4, 1, 0 },
+    { "wnoCheckedBDS", 0, 1, 0 },
+    { "wnoInvalidBDS", 1, 1, 0 },
+    { "lsValBDS", 0, 1, 0 },
+    { "dnRangeBDS", 1, 1, 0 },
+    { "totRangeBDS", 2, 1, 0 },
+    { "lsEventBDS", 3, 1, 0 },
+    { "recNowBDS", 4, 1, 0 },
+    { "wnoCheckedGLO", 0, 1, 0 },
+    { "wnoInvalidGLO", 1, 1, 0 },
+    { "chipGen", 0, 3, 0 },
+    { "svUsed", 0, 1, 0 },
+    { "diffCorr", 1, 1, 0 },
+    { "orbitAvail", 2, 1, 0 },  // 100
+    { "orbitEph", 3, 1, 0 },
+    { "unhealthy", 4, 1, 0 },
+    { "orbitAlm", 5, 1, 0 },
+    { "orbitAop", 6, 1, 0 },
+    { "smoothed", 7, 1, 0 },
+    { "qualityInd", 0, 4, 0 },
+    { "channel", 0, 4, 0 },
+    { "dgpsUsed", 4, 1, 0 },
+    { "Ranging", 0, 1, 0 },
+    { "Corrections", 1, 1, 0 },
+    { "Integrity", 2, 1, 0 },
+    { "Testmode", 3, 1, 0 },
+    { "Bad", 4, 1, 0 },
+    { "integrityUsed", 0, 2, 0 },
+    { "health", 0, 2, 0 },
+    { "visibility", 2, 2, 0 },
+    { "ephUsability", 0, 5, 0 },
+    { "ephSource", 5, 3, 0 },
+    { "almUsability", 0, 5, 0 },
+    { "almSource", 5, 3, 0 },
+    { "anoAopUsability", 0, 5, 0 },
+    { "type", 5, 3, 0 },
+    { "qualityInd", 0, 3, 0 },
+    { "svUsed", 3, 1, 0 },
+    { "health", 4, 2, 0 },
+    { "diffCorr", 6, 1, 0 },
+    { "smoothed", 7, 1, 0 },
+    { "orbitSource", 8, 3, 0 },
+    { "ephAvail", 11, 1, 0 },
+    { "almAvail", 12, 1, 0 },
+    { "anoAvail", 13, 1, 0 },
+    { "aopAvail", 14, 1, 0 },
+    { "sbasCorrUsed", 16, 1, 0 },
+    { "rtcmCorrUsed", 17, 1, 0 },
+    { "slasCorrUsed", 18, 1, 0 },
+    { "spartnCorrUsed", 19, 1, 0 },
+    { "prCorrUsed", 20, 1, 0 },
+    { "crCorrUsed", 21, 1, 0 },
+    { "doCorrUsed", 22, 1, 0 },
+    { "clasCorrUsed", 23, 1, 0 },
+    { "lppCorrUsed", 24, 1, 0 },
+    { "hasCorrUsed", 25, 1, 0 },
+    { "channel", 0, 4, 0 },
+    { "prUsed", 4, 1, 0 },
+    { "crUsed", 6, 1, 0 },
+    { "gnssFixOK", 0, 1, 0 },
+    { "diffSoln", 1, 1, 0 },
+    { "relPosValid", 2, 1, 0 },
+    { "carrSoln", 3, 2, 0 },
+    { "isMoving", 5, 1, 0 },  // 150
+    { "refPosMiss", 6, 1, 0 },
+    { "refObsMiss", 7, 1, 0 },
+    { "gnssFixOK", 0, 1, 0 },
+    { "diffSoln", 1, 1, 0 },
+    { "relPosValid", 2, 1, 0 },
+    { "carrSoln", 3, 2, 0 },
+    { "isMoving", 5, 1, 0 },
+    { "refPosMiss", 6, 1, 0 },
+    { "refObsMiss", 7, 1, 0 },
+    { "relPosHeadingValid", 8, 1, 0 },
+    { "relPosNormalized", 9, 1, 0 },
+    { "calibTacho", 0, 2, 0 },
+    { "calibGyro", 2, 2, 0 },
+    { "calibGyroB", 4, 2, 0 },
+    { "pulseUsed", 0, 1, 0 },
+    { "directionUsed", 1, 1, 0 },
+    { "gyroUsed", 2, 1, 0 },
+    { "tempUsed", 3, 1, 0 },
+    { "posUsed", 4, 1, 0 },
+    { "velUsed", 5, 1, 0 },
+    { "errGyro", 6, 1, 0 },
+    { "errPulse", 7, 1, 0 },
+    { "gmsAvailable", 0, 1, 0 },
+    { "qzssSvAvailable", 1, 1, 0 },
+    { "testMode", 2, 1, 0 },
+    { "health", 0, 2, 0 },
+    { "prSmoothed", 2, 1, 0 },
+    { "prUsed", 3, 1, 0 },
+    { "crUsed", 4, 1, 0 },
+    { "doUsed", 5, 1, 0 },
+    { "prCorrUsed", 6, 1, 0 },
+    { "crCorrUsed", 7, 1, 0 },
+    { "doCorrUsed", 8, 1, 0 },
+    { "authStatus", 9, 1, 0 },
+    { "qualityInd", 0, 4, 0 },
+    { "pos1Floor", 0, 8, 0 },
+    { "pos1Lat", 8, 23, 1 },
+    { "pos1Lon", 0, 24, 1 },
+    { "pos1Valid", 24, 1, 0 },
+    { "pos2Floor", 0, 9, 0 },
+    { "pos2Alt", 9, 12, 0 },
+    { "pos2Valid", 21, 1, 0 },
+    { "shortId", 0, 12, 0 },
+    { "shortValid", 12, 2, 0 },
+    { "shortBoundary", 14, 1, 0 },
+    { "mediumIdMSB", 0, 1, 0 },
+    { "mediumValid", 1, 1, 0 },
+    { "mediumboundary", 2, 1, 0 },
+    { "qualityInd", 0, 4, 0 },
+    { "pos1Floor", 0, 8, 0 },  // 200
+    { "pos1Lat", 8, 23, 1 },
+    { "pos1Lon", 0, 24, 1 },
+    { "pos1Valid", 24, 1, 0 },
+    { "pos2Floor", 0, 9, 0 },
+    { "pos2Alt", 9, 12, 0 },
+    { "pos2Acc", 21, 2, 0 },
+    { "pos2Valid", 23, 1, 0 },
+    { "shortId", 0, 12, 0 },
+    { "shortValid", 12, 1, 0 },
+    { "shortBoundary", 13, 1, 0 },
+    { "mediumIdMSB", 0, 1, 0 },
+    { "mediumValid", 1, 1, 0 },
+    { "mediumboundary", 2, 1, 0 },
+    { "useAOP", 0, 1, 0 },
+    { "useAOP", 0, 1, 0 },
+    { "NavICTowValid", 0, 1, 0 },
+    { "NavICWnoValid", 1, 1, 0 },
+    { "leapSValid", 2, 1, 0 },
+    { "trustedTimeValid", 0, 1, 0 },
+    { "deltaTimeValid", 1, 1, 0 },
+    { "validResult", 0, 1, 0 },
+    { "updatedValues", 1, 1, 0 },
+    { "towSet", 0, 2, 0 },
+    { "leapSec", 0, 1, 0 },
+    { "clkReset", 1, 1, 0 },
+    { "prStd", 0, 4, 0 },
+    { "cpStd", 0, 4, 0 },
+    { "doStd", 0, 4, 0 },
+    { "prValid", 0, 1, 0 },
+    { "cpValid", 1, 1, 0 },
+    { "halfCyc", 2, 1, 0 },
+    { "subHalfCyc", 3, 1, 0 },
+    { "leapSec", 0, 1, 0 },
+    { "clkReset", 1, 1, 0 },
+    { "prStd", 0, 4, 0 },
+    { "cpStd", 0, 4, 0 },
+    { "doStd", 0, 4, 0 },
+    { "prValid", 0, 1, 0 },
+    { "cpValid", 1, 1, 0 },
+    { "halfCyc", 2, 1, 0 },
+    { "subHalfCyc", 3, 1, 0 },
+    { "towSet", 0, 2, 0 },
+    { "ura", 0, 4, 0 },
+    { "healthy", 4, 1, 0 },
+    { "ephVal", 5, 1, 0 },
+    { "almVal", 6, 1, 0 },
+    { "notAvail", 7, 1, 0 },
+    { "almAge", 0, 4, 0 },
+    { "ephAge", 4, 4, 0 },
+    { "crcFailed", 0, 1, 0 },  // 250
+    { "msgUsed", 1, 2, 0 },
+    { "msgUsed", 1, 2, 0 },
+    { "protocol", 0, 5, 0 },
+    { "errStatus", 5, 2, 0 },
+    { "msgUsed", 7, 2, 0 },
+    { "correctionId", 9, 16, 0 },
+    { "msgTypeValid", 25, 1, 0 },
+    { "msgSubTypeValid", 26, 1, 0 },
+    { "msgInputHandle", 27, 1, 0 },
+    { "msgEncrypted", 28, 2, 0 },
+    { "msgDecrypted", 30, 2, 0 },
+    { "backup", 1, 1, 0 },
+    { "backup", 1, 1, 0 },
+    { "force", 2, 1, 0 },
+    { "uartrx", 3, 1, 0 },
+    { "extint0", 5, 1, 0 },
+    { "extint1", 6, 1, 0 },
+    { "spics", 7, 1, 0 },
+    { "pos1Floor", 0, 8, 0 },
+    { "pos1Lat", 8, 23, 1 },
+    { "pos1Lon", 0, 24, 1 },
+    { "pos1Valid", 24, 1, 0 },
+    { "pos2Floor", 0, 9, 0 },
+    { "pos2Alt", 9, 12, 0 },
+    { "pos2Acc", 21, 2, 0 },
+    { "pos2Valid", 23, 1, 0 },
+    { "shortId", 0, 12, 0 },
+    { "shortValid", 12, 1, 0 },
+    { "shortBoundary", 13, 1, 0 },
+    { "mediumIdMSB", 0, 1, 0 },
+    { "mediumValid", 1, 1, 0 },
+    { "mediumboundary", 2, 1, 0 },
+    { "chn", 8, 2, 0 },
+    { "msgName", 10, 1, 0 },
+    { "errStatus", 12, 2, 0 },
+    { "chName", 14, 2, 0 },
+    { "chn", 8, 2, 0 },
+    { "msgName", 10, 1, 0 },
+    { "errStatus", 12, 2, 0 },
+    { "chName", 14, 2, 0 },
+    { "channel", 0, 4, 0 },
+    { "edgeType", 4, 1, 0 },
+    { "en", 0, 1, 0 },
+    { "pol", 1, 1, 0 },
+    { "pin", 2, 5, 0 },
+    { "thres", 7, 9, 0 },
+    { "charLen", 6, 2, 0 },
+    { "parity", 9, 3, 0 },
+    { "nStopBits", 12, 2, 0 },
+    { "inUbx", 0, 1, 0 },  // 300
+    { "inNmea", 1, 1, 0 },
+    { "inRtcm", 2, 1, 0 },
+    { "inRtcm3", 5, 1, 0 },
+    { "outUbx", 0, 1, 0 },
+    { "outNmea", 1, 1, 0 },
+    { "outRtcm3", 5, 1, 0 },
+    { "extendedTxTimeout", 1, 1, 0 },
+    { "en", 0, 1, 0 },
+    { "pol", 1, 1, 0 },
+    { "pin", 2, 5, 0 },
+    { "thres", 7, 9, 0 },
+    { "inUbx", 0, 1, 0 },
+    { "inNmea", 1, 1, 0 },
+    { "inRtcm", 2, 1, 0 },
+    { "inRtcm3", 5, 1, 0 },
+    { "outUbx", 0, 1, 0 },
+    { "outNmea", 1, 1, 0 },
+    { "outRtcm3", 5, 1, 0 },
+    { "en", 0, 1, 0 },
+    { "pol", 1, 1, 0 },
+    { "pin", 2, 5, 0 },
+    { "thres", 7, 9, 0 },
+    { "spiMode", 1, 2, 0 },
+    { "ffCnt", 8, 6, 0 },
+    { "inUbx", 0, 1, 0 },
+    { "inNmea", 1, 1, 0 },
+    { "inRtcm", 2, 1, 0 },
+    { "inRtcm3", 5, 1, 0 },
+    { "outUbx", 0, 1, 0 },
+    { "outNmea", 1, 1, 0 },
+    { "outRtcm3", 5, 1, 0 },
+    { "extendedTxTimeout", 1, 1, 0 },
+    { "en", 0, 1, 0 },
+    { "pol", 1, 1, 0 },
+    { "pin", 2, 5, 0 },
+    { "thres", 7, 9, 0 },
+    { "slaveAddr", 1, 7, 0 },
+    { "inUbx", 0, 1, 0 },
+    { "inNmea", 1, 1, 0 },
+    { "inRtcm", 2, 1, 0 },
+    { "inRtcm3", 5, 1, 0 },
+    { "outUbx", 0, 1, 0 },
+    { "outNmea", 1, 1, 0 },
+    { "outRtcm3", 5, 1, 0 },
+    { "extendedTxTimeout", 1, 1, 0 },
+    { "ERROR", 0, 1, 0 },
+    { "WARNING", 1, 1, 0 },
+    { "NOTICE", 2, 1, 0 },
+    { "TEST", 3, 1, 0 },
+    { "DEBUG", 4, 1, 0 },  // 350
+    { "eph", 0, 1, 0 },
+    { "alm", 1, 1, 0 },
+    { "health", 2, 1, 0 },
+    { "klob", 3, 1, 0 },
+    { "pos", 4, 1, 0 },
+    { "clkd", 5, 1, 0 },
+    { "osc", 6, 1, 0 },
+    { "utc", 7, 1, 0 },
+    { "rtc", 8, 1, 0 },
+    { "sfdr", 11, 1, 0 },
+    { "vmon", 12, 1, 0 },
+    { "tct", 13, 1, 0 },
+    { "aop", 15, 1, 0 },
+    { "eph", 0, 1, 0 },
+    { "alm", 1, 1, 0 },
+    { "health", 2, 1, 0 },
+    { "klob", 3, 1, 0 },
+    { "pos", 4, 1, 0 },
+    { "clkd", 5, 1, 0 },
+    { "osc", 6, 1, 0 },
+    { "utc", 7, 1, 0 },
+    { "rtc", 8, 1, 0 },
+    { "sfdr", 11, 1, 0 },
+    { "vmon", 12, 1, 0 },
+    { "tct", 13, 1, 0 },
+    { "aop", 15, 1, 0 },
+    { "eph", 0, 1, 0 },
+    { "alm", 1, 1, 0 },
+    { "health", 2, 1, 0 },
+    { "klob", 3, 1, 0 },
+    { "pos", 4, 1, 0 },
+    { "clkd", 5, 1, 0 },
+    { "osc", 6, 1, 0 },
+    { "utc", 7, 1, 0 },
+    { "rtc", 8, 1, 0 },
+    { "sfdr", 11, 1, 0 },
+    { "vmon", 12, 1, 0 },
+    { "tct", 13, 1, 0 },
+    { "aop", 15, 1, 0 },
+    { "eph", 0, 1, 0 },
+    { "alm", 1, 1, 0 },
+    { "health", 2, 1, 0 },
+    { "klob", 3, 1, 0 },
+    { "pos", 4, 1, 0 },
+    { "clkd", 5, 1, 0 },
+    { "osc", 6, 1, 0 },
+    { "utc", 7, 1, 0 },
+    { "rtc", 8, 1, 0 },
+    { "sfdr", 11, 1, 0 },
+    { "vmon", 12, 1, 0 },  // 400
+    { "tct", 13, 1, 0 },
+    { "aop", 15, 1, 0 },
+    { "syncMode", 0, 1, 0 },
+    { "ioPort", 0, 1, 0 },
+    { "msgConf", 1, 1, 0 },
+    { "infMsg", 2, 1, 0 },
+    { "navConf", 3, 1, 0 },
+    { "rxmConf", 4, 1, 0 },
+    { "senConf", 8, 1, 0 },
+    { "rinvConf", 9, 1, 0 },
+    { "antConf", 10, 1, 0 },
+    { "logConf", 11, 1, 0 },
+    { "ftsConf", 12, 1, 0 },
+    { "devBBR", 0, 1, 0 },
+    { "devFlash", 1, 1, 0 },
+    { "devEEPROM", 2, 1, 0 },
+    { "devSpiFlash", 4, 1, 0 },
+    { "clearAll", 0, 32, 0 },
+    { "saveAll", 0, 32, 0 },
+    { "loadAll", 0, 32, 0 },
+    { "devBBR", 0, 1, 0 },
+    { "devFlash", 1, 1, 0 },
+    { "devEEPROM", 2, 1, 0 },
+    { "devSpiFlash", 4, 1, 0 },
+    { "sleep", 1, 1, 0 },
+    { "absAlign", 3, 1, 0 },
+    { "onOff", 4, 1, 0 },
+    { "clTab", 1, 1, 0 },
+    { "clCalib", 2, 1, 0 },
+    { "nomTacho", 4, 1, 0 },
+    { "nomGyro", 5, 1, 0 },
+    { "setTemp", 6, 1, 0 },
+    { "dir", 7, 1, 0 },
+    { "pulsesPerM", 0, 1, 0 },
+    { "useSerWt", 1, 1, 0 },
+    { "invDir", 0, 1, 0 },
+    { "invGyro", 1, 1, 0 },
+    { "clTab", 1, 1, 0 },
+    { "clCalib", 2, 1, 0 },
+    { "nomTacho", 4, 1, 0 },
+    { "nomGyro", 5, 1, 0 },
+    { "setTemp", 6, 1, 0 },
+    { "dir", 7, 1, 0 },
+    { "pulsesPerM", 0, 1, 0 },
+    { "useSerWt", 1, 1, 0 },
+    { "invDir", 0, 1, 0 },
+    { "invGyro", 1, 1, 0 },
+    { "svcs", 0, 1, 0 },
+    { "scd", 1, 1, 0 },
+    { "ocd", 2, 1, 0 },  // 450
+    { "pdwnOnSCD", 3, 1, 0 },
+    { "recovery", 4, 1, 0 },
+    { "pinSwitch", 0, 5, 0 },
+    { "pinSCD", 5, 5, 0 },
+    { "pinOCD", 10, 5, 0 },
+    { "reconfig", 15, 1, 0 },
+    { "svcs", 0, 1, 0 },
+    { "scd", 1, 1, 0 },
+    { "ocd", 2, 1, 0 },
+    { "pdwnOnSCD", 3, 1, 0 },
+    { "recovery", 4, 1, 0 },
+    { "pinSwitch", 0, 5, 0 },
+    { "pinSCD", 5, 5, 0 },
+    { "pinOCD", 10, 5, 0 },
+    { "enabled", 0, 1, 0 },
+    { "test", 1, 1, 0 },
+    { "range", 0, 1, 0 },
+    { "diffCorr", 1, 1, 0 },
+    { "integrity", 2, 1, 0 },
+    { "PRN152", 0, 1, 0 },
+    { "PRN153", 1, 1, 0 },
+    { "PRN154", 2, 1, 0 },
+    { "PRN155", 3, 1, 0 },
+    { "PRN156", 4, 1, 0 },
+    { "PRN157", 5, 1, 0 },
+    { "PRN158", 6, 1, 0 },
+    { "PRN120", 0, 1, 0 },
+    { "PRN121", 1, 1, 0 },
+    { "PRN122", 2, 1, 0 },
+    { "PRN123", 3, 1, 0 },
+    { "PRN124", 4, 1, 0 },
+    { "PRN125", 5, 1, 0 },
+    { "PRN126", 6, 1, 0 },
+    { "PRN127", 7, 1, 0 },
+    { "PRN128", 8, 1, 0 },
+    { "PRN129", 9, 1, 0 },
+    { "PRN130", 10, 1, 0 },
+    { "PRN131", 11, 1, 0 },
+    { "PRN132", 12, 1, 0 },
+    { "PRN133", 13, 1, 0 },
+    { "PRN134", 14, 1, 0 },
+    { "PRN135", 15, 1, 0 },
+    { "PRN136", 16, 1, 0 },
+    { "PRN137", 17, 1, 0 },
+    { "PRN138", 18, 1, 0 },
+    { "PRN139", 19, 1, 0 },
+    { "PRN140", 20, 1, 0 },
+    { "PRN141", 21, 1, 0 },
+    { "PRN142", 22, 1, 0 },
+    { "PRN143", 23, 1, 0 },  // 500
+    { "PRN144", 24, 1, 0 },
+    { "PRN145", 25, 1, 0 },
+    { "PRN146", 26, 1, 0 },
+    { "PRN147", 27, 1, 0 },
+    { "PRN148", 28, 1, 0 },
+    { "PRN149", 29, 1, 0 },
+    { "PRN150", 30, 1, 0 },
+    { "PRN151", 31, 1, 0 },
+    { "posFilt", 0, 1, 0 },
+    { "mskPosFilt", 1, 1, 0 },
+    { "timeFilt", 2, 1, 0 },
+    { "dateFilt", 3, 1, 0 },
+    { "gpsOnlyFilter", 4, 1, 0 },
+    { "trackFilt", 5, 1, 0 },
+    { "compat", 0, 1, 0 },
+    { "consider", 1, 1, 0 },
+    { "posFilt", 0, 1, 0 },
+    { "mskPosFilt", 1, 1, 0 },
+    { "timeFilt", 2, 1, 0 },
+    { "dateFilt", 3, 1, 0 },
+    { "gpsOnlyFilter", 4, 1, 0 },
+    { "trackFilt", 5, 1, 0 },
+    { "compat", 0, 1, 0 },
+    { "consider", 1, 1, 0 },
+    { "gps", 0, 1, 0 },
+    { "sbas", 1, 1, 0 },
+    { "galileo", 2, 1, 0 },
+    { "qzss", 4, 1, 0 },
+    { "glonass", 5, 1, 0 },
+    { "beidou", 6, 1, 0 },
+    { "posFilt", 0, 1, 0 },
+    { "mskPosFilt", 1, 1, 0 },
+    { "timeFilt", 2, 1, 0 },
+    { "dateFilt", 3, 1, 0 },
+    { "gpsOnlyFilter", 4, 1, 0 },
+    { "trackFilt", 5, 1, 0 },
+    { "compat", 0, 1, 0 },
+    { "consider", 1, 1, 0 },
+    { "limit82", 2, 1, 0 },
+    { "highPrec", 3, 1, 0 },
+    { "gps", 0, 1, 0 },
+    { "sbas", 1, 1, 0 },
+    { "galileo", 2, 1, 0 },
+    { "qzss", 4, 1, 0 },
+    { "glonass", 5, 1, 0 },
+    { "beidou", 6, 1, 0 },
+    { "reEnum", 0, 1, 0 },
+    { "powerMode", 1, 1, 0 },
+    { "useODO", 0, 1, 0 },
+    { "useCOG", 1, 1, 0 },  // 550
+    { "outLPVel", 2, 1, 0 },
+    { "outLPCog", 3, 1, 0 },
+    { "profile", 0, 3, 0 },
+    { "minMax", 2, 1, 0 },
+    { "minCno", 3, 1, 0 },
+    { "initial3dfix", 6, 1, 0 },
+    { "wknRoll", 9, 1, 0 },
+    { "ackAid", 10, 1, 0 },
+    { "ppp", 13, 1, 0 },
+    { "aop", 14, 1, 0 },
+    { "adr", 6, 1, 0 },
+    { "useAOP", 0, 1, 0 },
+    { "minMax", 2, 1, 0 },
+    { "minCno", 3, 1, 0 },
+    { "initial3dfix", 6, 1, 0 },
+    { "wknRoll", 9, 1, 0 },
+    { "ppp", 13, 1, 0 },
+    { "aop", 14, 1, 0 },
+    { "useAOP", 0, 1, 0 },
+    { "minMax", 2, 1, 0 },
+    { "minCno", 3, 1, 0 },
+    { "initial3dfix", 6, 1, 0 },
+    { "wknRoll", 9, 1, 0 },
+    { "ackAid", 10, 1, 0 },
+    { "ppp", 13, 1, 0 },
+    { "aop", 14, 1, 0 },
+    { "adr", 6, 1, 0 },
+    { "sigAttenComp", 7, 1, 0 },
+    { "useAOP", 0, 1, 0 },
+    { "minMax", 2, 1, 0 },
+    { "minCno", 3, 1, 0 },
+    { "initial3dfix", 6, 1, 0 },
+    { "wknRoll", 9, 1, 0 },
+    { "ackAid", 10, 1, 0 },
+    { "ppp", 13, 1, 0 },
+    { "aop", 14, 1, 0 },
+    { "adr", 6, 1, 0 },
+    { "sigAttenComp", 7, 1, 0 },
+    { "useAOP", 0, 1, 0 },
+    { "dyn", 0, 1, 0 },
+    { "minEl", 1, 1, 0 },
+    { "posFixMode", 2, 1, 0 },
+    { "drLim", 3, 1, 0 },
+    { "posMask", 4, 1, 0 },
+    { "timeMask", 5, 1, 0 },
+    { "staticHoldMask", 6, 1, 0 },
+    { "dgpsMask", 7, 1, 0 },
+    { "cnoThreshold", 8, 1, 0 },
+    { "utc", 10, 1, 0 },
+    { "setVehicle", 12, 1, 0 },  // 600
+    { "setTime", 13, 1, 0 },
+    { "setWt", 14, 1, 0 },
+    { "active", 0, 1, 0 },
+    { "lockGpsFreq", 1, 1, 0 },
+    { "lockedOtherSet", 2, 1, 0 },
+    { "isFreq", 3, 1, 0 },
+    { "isLength", 4, 1, 0 },
+    { "alignToTow", 5, 1, 0 },
+    { "polarity", 6, 1, 0 },
+    { "gridUtcGps", 7, 1, 0 },
+    { "active", 0, 1, 0 },
+    { "lockGnssFreq", 1, 1, 0 },
+    { "lockedOtherSet", 2, 1, 0 },
+    { "isFreq", 3, 1, 0 },
+    { "isLength", 4, 1, 0 },
+    { "alignToTow", 5, 1, 0 },
+    { "polarity", 6, 1, 0 },
+    { "gridUtcGnss", 7, 4, 0 },
+    { "syncMode", 11, 3, 0 },
+    { "internal", 2, 2, 0 },
+    { "extintSelect", 4, 1, 0 },
+    { "extintWake", 5, 1, 0 },
+    { "extintBackup", 6, 1, 0 },
+    { "limitPeakCurr", 8, 2, 0 },
+    { "WaitTimeFix", 10, 1, 0 },
+    { "updateRTC", 11, 1, 0 },
+    { "updateEPH", 12, 1, 0 },
+    { "dump", 0, 1, 0 },
+    { "binary", 1, 1, 0 },
+    { "bbThreshold", 0, 4, 0 },
+    { "cwThreshold", 4, 5, 0 },
+    { "algorithmBits", 9, 22, 0 },
+    { "enable", 31, 1, 0 },
+    { "generalBits", 0, 12, 0 },
+    { "antSetting", 12, 2, 0 },
+    { "enable2", 14, 1, 0 },
+    { "extintSel", 4, 1, 0 },
+    { "extintWake", 5, 1, 0 },
+    { "extintBackup", 6, 1, 0 },
+    { "limitPeakCurr", 8, 2, 0 },
+    { "waitTimeFix", 10, 1, 0 },
+    { "updateRTC", 11, 1, 0 },
+    { "updateEPH", 12, 1, 0 },
+    { "doNotEnterOff", 16, 1, 0 },
+    { "mode", 17, 2, 0 },
+    { "extintSel", 4, 1, 0 },
+    { "extintWake", 5, 1, 0 },
+    { "extintBackup", 6, 1, 0 },
+    { "extintInactive", 7, 1, 0 },
+    { "limitPeakCurr", 8, 2, 0 },  // 650
+    { "waitTimeFix", 10, 1, 0 },
+    { "updateRTC", 11, 1, 0 },
+    { "updateEPH", 12, 1, 0 },
+    { "doNotEnterOff", 16, 1, 0 },
+    { "mode", 17, 2, 0 },
+    { "optTarget", 1, 3, 0 },
+    { "extintSel", 4, 1, 0 },
+    { "extintWake", 5, 1, 0 },
+    { "extintBackup", 6, 1, 0 },
+    { "extintInactive", 7, 1, 0 },
+    { "limitPeakCurr", 8, 2, 0 },
+    { "waitTimeFix", 10, 1, 0 },
+    { "updateRTC", 11, 1, 0 },
+    { "updateEPH", 12, 1, 0 },
+    { "doNotEnterOff", 16, 1, 0 },
+    { "mode", 17, 2, 0 },
+    { "lla", 0, 1, 0 },
+    { "altInv", 1, 1, 0 },
+    { "enable", 0, 1, 0 },
+    { "sigCfgMask", 16, 8, 0 },
+    { "length", 0, 7, 0 },
+    { "mask", 7, 1, 0 },
+    { "voltageControl", 0, 1, 0 },
+    { "shortDetection", 1, 1, 0 },
+    { "openDetection", 2, 1, 0 },
+    { "powerDown", 3, 1, 0 },
+    { "shortDetectionPol", 4, 1, 0 },
+    { "openDetectionPol", 5, 1, 0 },
+    { "powerDownPol", 6, 1, 0 },
+    { "recover", 7, 1, 0 },
+    { "switchPin", 0, 4, 0 },
+    { "shortPin", 4, 4, 0 },
+    { "openPin", 0, 4, 0 },
+    { "i2cEnabled", 4, 1, 0 },
+    { "uartEnabled", 5, 1, 0 },
+    { "timePulseEnabled", 6, 1, 0 },
+    { "recordEnabled", 0, 1, 0 },
+    { "psmOncePerWakupEnabled", 1, 1, 0 },
+    { "applyAllFilterSettings", 2, 1, 0 },
+    { "DDC", 0, 1, 0 },
+    { "UART1", 1, 1, 0 },
+    { "UART2", 2, 1, 0 },
+    { "USB", 3, 1, 0 },
+    { "SPI", 4, 1, 0 },
+    { "version", 0, 8, 0 },
+    { "doAutoMntAlg", 8, 1, 0 },
+    { "polarity", 0, 1, 0 },
+    { "gnssUtc", 1, 1, 0 },
+    { "isCalibrated", 0, 1, 0 },
+    { "controlIf", 1, 4, 0 },  // 700
+    { "measInternal", 0, 1, 0 },
+    { "measGNSS", 1, 1, 0 },
+    { "measEXTINT0", 2, 1, 0 },
+    { "measEXTINT1", 3, 1, 0 },
+    { "disableInternal", 0, 1, 0 },
+    { "disableExternal", 1, 1, 0 },
+    { "preferenceMode", 2, 1, 0 },
+    { "enableGNSS", 3, 1, 0 },
+    { "enableEXTINT0", 4, 1, 0 },
+    { "enableEXTINT1", 5, 1, 0 },
+    { "enableHostMeasInt", 6, 1, 0 },
+    { "enableHostMeasExt", 7, 1, 0 },
+    { "useAnyFix", 10, 1, 0 },
+    { "disableMaxSlewRate", 11, 1, 0 },
+    { "issueFreqWarning", 12, 1, 0 },
+    { "issueTimeWarning", 13, 1, 0 },
+    { "TPCoherent", 14, 2, 0 },
+    { "disableOffset", 16, 1, 0 },
+    { "mode", 0, 8, 0 },
+    { "lla", 8, 1, 0 },
+    { "combineTicks", 0, 1, 0 },
+    { "useWtSpeed", 4, 1, 0 },
+    { "dirPinPol", 5, 1, 0 },
+    { "useWtPin", 6, 1, 0 },
+    { "autoWtCountMaxOff", 0, 1, 0 },
+    { "autoDirPinPolOff", 1, 1, 0 },
+    { "autoSoftwareWtOff", 2, 1, 0 },
+    { "autoUseWtSpeedOff", 3, 1, 0 },
+    { "cntBothEdges", 4, 1, 0 },
+    { "senConn", 0, 1, 0 },
+    { "i2cSdaPio", 0, 5, 0 },
+    { "i2cSclPio", 5, 5, 0 },
+    { "ram", 0, 1, 0 },
+    { "bbr", 1, 1, 0 },
+    { "flash", 2, 1, 0 },
+    { "ram", 0, 1, 0 },
+    { "bbr", 1, 1, 0 },
+    { "flash", 2, 1, 0 },
+    { "action", 0, 2, 0 },
+    { "bbr", 1, 1, 0 },
+    { "flash", 2, 1, 0 },
+    { "bbr", 1, 1, 0 },
+    { "flash", 2, 1, 0 },
+    { "action", 0, 2, 0 },
+    { "enabled", 0, 1, 0 },
+    { "test", 1, 1, 0 },
+    { "raim", 2, 1, 0 },
+    { "enable", 0, 1, 0 },
+    { "extraPvt", 2, 1, 0 },
+    { "extraOdo", 3, 1, 0 },  // 750
+    { "pioEnable", 5, 1, 0 },
+    { "pioActiveLow", 6, 1, 0 },
+    { "limit", 0, 6, 0 },
+    { "mem", 6, 1, 0 },
+    { "alloc", 7, 1, 0 },
+    { "rtcCalib", 0, 1, 0 },
+    { "rtcCalib", 0, 1, 0 },
+    { "safeBoot", 1, 1, 0 },
+    { "rtcCalib", 0, 1, 0 },
+    { "safeBoot", 1, 1, 0 },
+    { "jammingState", 2, 2, 0 },
+    { "rtcCalib", 0, 1, 0 },
+    { "safeBoot", 1, 1, 0 },
+    { "jammingState", 2, 2, 0 },
+    { "xtalAbsent", 4, 1, 0 },
+    { "awake", 0, 1, 0 },
+    { "activated", 0, 1, 0 },
+    { "location", 1, 2, 0 },
+    { "GPSSup", 0, 1, 0 },
+    { "GlonassSup", 1, 1, 0 },
+    { "BeidouSup", 2, 1, 0 },
+    { "GalileoSup", 3, 1, 0 },
+    { "GPSDef", 0, 1, 0 },
+    { "GlonassDef", 1, 1, 0 },
+    { "BeidouDef", 2, 1, 0 },
+    { "GalileoDef", 3, 1, 0 },
+    { "GPSEna", 0, 1, 0 },
+    { "GlonassEna", 1, 1, 0 },
+    { "BeidouEna", 2, 1, 0 },
+    { "GalileoEna", 3, 1, 0 },
+    { "planCfgId", 0, 8, 0 },
+    { "gnssCfgLevel", 8, 3, 0 },
+    { "gps_L1CA", 0, 1, 0 },
+    { "gps_L1C", 1, 1, 0 },
+    { "gps_L2C", 2, 1, 0 },
+    { "gps_L5", 3, 1, 0 },
+    { "gal_E1", 0, 1, 0 },
+    { "gal_E5A", 1, 1, 0 },
+    { "gal_E5B", 2, 1, 0 },
+    { "gal_E6", 3, 1, 0 },
+    { "bds_B1I", 0, 1, 0 },
+    { "bds_B1C", 1, 1, 0 },
+    { "bds_B2I", 2, 1, 0 },
+    { "bds_B2A", 3, 1, 0 },
+    { "bds_B3I", 4, 1, 0 },
+    { "glo_L1OF", 0, 1, 0 },
+    { "glo_L2OF", 1, 1, 0 },
+    { "sbas_L1CA", 0, 1, 0 },
+    { "qzss_L1CA", 0, 1, 0 },
+    { "qzss_L1CB", 1, 1, 0 },  // 800
+    { "qzss_L1C", 2, 1, 0 },
+    { "qzss_L1S", 3, 1, 0 },
+    { "qzss_L2C", 4, 1, 0 },
+    { "qzss_L5", 5, 1, 0 },
+    { "navic_L5", 0, 1, 0 },
+    { "lband_L1", 0, 1, 0 },
+    { "intOscState", 0, 4, 0 },
+    { "intOscCalib", 4, 1, 0 },
+    { "intOscDisc", 5, 1, 0 },
+    { "extOscState", 0, 4, 0 },
+    { "extOscCalib", 4, 1, 0 },
+    { "extOscDisc", 5, 1, 0 },
+    { "gnssAvail", 0, 1, 0 },
+    { "extInt0Avail", 0, 1, 0 },
+    { "extInt0Type", 1, 1, 0 },
+    { "extInt0FeedBack", 2, 1, 0 },
+    { "extInt1Avail", 0, 1, 0 },
+    { "extInt1Type", 1, 1, 0 },
+    { "extInt1FeedBack", 2, 1, 0 },
+    { "drvVerMaj", 0, 4, 0 },
+    { "drvVerMin", 4, 4, 0 },
+    { "locked", 0, 1, 0 },
+    { "frameSync", 1, 1, 0 },
+    { "mem", 0, 1, 0 },
+    { "alloc", 1, 1, 0 },
+    { "outputPort", 2, 3, 0 },
+    { "rtcCalib", 0, 1, 0 },
+    { "safeBoot", 1, 1, 0 },
+    { "xtalAbsent", 2, 1, 0 },
+    { "periphPIO", 0, 1, 0 },
+    { "pinBank", 1, 3, 0 },
+    { "direction", 4, 1, 0 },
+    { "value", 5, 1, 0 },
+    { "vpManager", 6, 1, 0 },
+    { "pioIrq", 7, 1, 0 },
+    { "pioPullHigh", 8, 1, 0 },
+    { "pioPullLow", 9, 1, 0 },
+    { "jammingState", 0, 2, 0 },
+    { "safeBoot", 0, 1, 0 },
+    { "fixType", 0, 3, 0 },
+    { "fixOkFlag", 3, 1, 0 },
+    { "statusfixNOK", 0, 1, 0 },
+    { "statusfixType", 1, 1, 0 },
+    { "statusUsedSVs", 2, 1, 0 },
+    { "statusCNO", 3, 1, 0 },
+    { "statusPDOP", 4, 1, 0 },
+    { "installStatus1", 5, 1, 0 },
+    { "installStatus2", 6, 1, 0 },
+    { "sig_sbas_en_val", 0, 1, 0 },
+    { "sig_sbas_en_src", 1, 3, 0 },  // 850
+    { "sig_sbasL1ca_en_val", 4, 1, 0 },
+    { "sig_sbasL1ca_en_src", 5, 3, 0 },
+    { "sig_navic_en_val", 0, 1, 0 },
+    { "sig_navic_en_src", 1, 3, 0 },
+    { "sig_navicL5_en_val", 4, 1, 0 },
+    { "sig_navicL5_en_src", 5, 3, 0 },
+    { "sig_gps_en_val", 0, 1, 0 },
+    { "sig_gps_en_src", 1, 3, 0 },
+    { "sig_gpsL1ca_en_val", 4, 1, 0 },
+    { "sig_gpsL1ca_en_src", 5, 3, 0 },
+    { "sig_gpsL1c_en_val", 8, 1, 0 },
+    { "sig_gpsL1c_en_src", 9, 3, 0 },
+    { "sig_gpsL2c_en_val", 12, 1, 0 },
+    { "sig_gpsL2c_en_src", 13, 3, 0 },
+    { "sig_gpsL5_en_val", 16, 1, 0 },
+    { "sig_gpsL5_en_src", 17, 3, 0 },
+    { "sig_gal_en_val", 0, 1, 0 },
+    { "sig_gal_en_src", 1, 3, 0 },
+    { "sig_galE1_en_val", 4, 1, 0 },
+    { "sig_galE1_en_src", 5, 3, 0 },
+    { "sig_galE5a_en_val", 8, 1, 0 },
+    { "sig_galE5a_en_src", 9, 3, 0 },
+    { "sig_galE5b_en_val", 12, 1, 0 },
+    { "sig_galE5b_en_src", 13, 3, 0 },
+    { "sig_galE6_en_val", 16, 1, 0 },
+    { "sig_galE6_en_src", 17, 3, 0 },
+    { "sig_qzss_en_val", 0, 1, 0 },
+    { "sig_qzss_en_src", 1, 3, 0 },
+    { "sig_qzssL1ca_en_val", 4, 1, 0 },
+    { "sig_qzssL1ca_src", 5, 3, 0 },
+    { "sig_qzssL1c_en_val", 8, 1, 0 },
+    { "sig_qzssL1c_src", 9, 3, 0 },
+    { "sig_qzssL1s_en_val", 12, 1, 0 },
+    { "sig_qzssL1s_src", 13, 3, 0 },
+    { "sig_qzssL2c_en_val", 16, 1, 0 },
+    { "sig_qzssL2c_src", 17, 3, 0 },
+    { "sig_qzssL5_en_val", 20, 1, 0 },
+    { "sig_qzssL5_src", 21, 3, 0 },
+    { "sig_bds_en_val", 0, 1, 0 },
+    { "sig_bds_en_src", 1, 3, 0 },
+    { "sig_bdsB1i_en_val", 4, 1, 0 },
+    { "sig_bdsB1i_src", 5, 3, 0 },
+    { "sig_bdsB1c_en_val", 8, 1, 0 },
+    { "sig_bdsB1c_src", 9, 3, 0 },
+    { "sig_bdsB2_en_val", 12, 1, 0 },
+    { "sig_bdsB2_src", 13, 3, 0 },
+    { "sig_bdsB2a_en_val", 16, 1, 0 },
+    { "sig_bdsB2a_src", 17, 3, 0 },
+    { "sig_glo_en_val", 0, 1, 0 },
+    { "sig_glo_en_src", 1, 3, 0 },  // 900
+    { "sig_gloL1_en_val", 4, 1, 0 },
+    { "sig_gloL1_src", 5, 3, 0 },
+    { "sig_gloL2_en_val", 8, 1, 0 },
+    { "sig_gloL2_src", 9, 3, 0 },
+    { "sig_gloL3_en_val", 12, 1, 0 },
+    { "sig_gloL3_src", 13, 3, 0 },
+    { "lna_lnaMode_reg_val", 0, 4, 0 },
+    { "lna_lnaMode_cfg_val", 4, 4, 0 },
+    { "lna_lnaMode_src", 13, 3, 0 },
+    { "uart_enable_val", 0, 1, 0 },
+    { "uart_enable_src", 1, 3, 0 },
+    { "uart_remaped_val", 4, 1, 0 },
+    { "uart_remaped_src", 5, 3, 0 },
+    { "uart_dataBits_val", 8, 1, 0 },
+    { "uart_dataBits_src", 9, 3, 0 },
+    { "uart_stopBits_val", 12, 2, 0 },
+    { "uart_stopBits_src", 14, 3, 0 },
+    { "uart_parityBits_val", 17, 2, 0 },
+    { "uart_parityBits_src", 19, 3, 0 },
+    { "uart_baudrate_val", 0, 20, 0 },
+    { "uart_baudrate_src", 20, 3, 0 },
+    { "spi_enable_val", 0, 1, 0 },
+    { "spi_enable_src", 1, 3, 0 },
+    { "spi_extendedTimeout_val", 4, 1, 0 },
+    { "spi_extendedTimeout_src", 5, 3, 0 },
+    { "spi_CPolarity_val", 8, 1, 0 },
+    { "spi_CPolarity_src", 9, 3, 0 },
+    { "spi_CPhase_val", 12, 1, 0 },
+    { "spi_CPhase_src", 13, 3, 0 },
+    { "spi_maxFf_val", 16, 8, 0 },
+    { "spi_maxFf_src", 24, 3, 0 },
+    { "i2c_enable_val", 0, 1, 0 },
+    { "i2c_enable_src", 1, 3, 0 },
+    { "i2c_extendedTimeout_val", 4, 1, 0 },
+    { "i2c_extendedTimeout_src", 5, 3, 0 },
+    { "i2c_remap_val", 8, 1, 0 },
+    { "i2c_remap_src", 9, 3, 0 },
+    { "i2c_address_val", 12, 8, 0 },
+    { "i2c_address_src", 20, 3, 0 },
+    { "psm_operateMode_val", 0, 2, 0 },
+    { "psm_operateMode_src", 2, 3, 0 },
+    { "psm_operateMode_state", 5, 2, 0 },
+    { "antSup_smStatus_val", 0, 2, 0 },
+    { "antSup_aPower_val", 2, 2, 0 },
+    { "antSup_switchPi_val", 0, 5, 0 },
+    { "antSup_switchPin_src", 5, 3, 0 },
+    { "antSup_shortPin_val", 0, 5, 0 },
+    { "antSup_shortPin_src", 5, 3, 0 },
+    { "antSup_openPin_val", 0, 5, 0 },
+    { "antSup_openPin_src", 5, 3, 0 },  // 950
+    { "antSup_recInt_val", 0, 8, 0 },
+    { "antSup_recInt_src", 13, 3, 0 },
+    { "antSup_voltctrl_val", 0, 1, 0 },
+    { "antSup_voltctrl_src", 1, 3, 0 },
+    { "antSup_shortDet_val", 4, 1, 0 },
+    { "antSup_shortDet_src", 5, 3, 0 },
+    { "antSup_shortDet_pol_val", 8, 1, 0 },
+    { "antSup_shortDet_pol_src", 9, 3, 0 },
+    { "antSup_openDet_val", 12, 1, 0 },
+    { "antSup_openDet_src", 13, 3, 0 },
+    { "antSup_openDet_pol_val", 16, 1, 0 },
+    { "antSup_openDet_pol_src", 17, 3, 0 },
+    { "antSup_pwrDown_val", 20, 1, 0 },
+    { "antSup_pwrDown_src", 21, 3, 0 },
+    { "antSup_pwrDown_pol_val", 24, 1, 0 },
+    { "antSup_pwrDown_pol_src", 25, 3, 0 },
+    { "antSup_recover_val", 28, 1, 0 },
+    { "antSup_recover_src", 29, 3, 0 },
+    { "antSup_shortUs_val", 0, 16, 0 },
+    { "antSup_shortUs_src", 29, 3, 0 },
+    { "fEdge", 1, 1, 0 },
+    { "tm1", 4, 1, 0 },
+    { "f1", 6, 1, 0 },
+    { "pos", 0, 1, 0 },
+    { "time", 1, 1, 0 },
+    { "clockD", 2, 1, 0 },
+    { "tp", 3, 1, 0 },
+    { "clockF", 4, 1, 0 },
+    { "lla", 5, 1, 0 },
+    { "altInv", 6, 1, 0 },
+    { "prevTm", 7, 1, 0 },
+    { "fEdge", 1, 1, 0 },
+    { "tm1", 4, 1, 0 },
+    { "f1", 6, 1, 0 },
+    { "pos", 0, 1, 0 },
+    { "time", 1, 1, 0 },
+    { "clockD", 2, 1, 0 },
+    { "tp", 3, 1, 0 },
+    { "clockF", 4, 1, 0 },
+    { "lla", 5, 1, 0 },
+    { "altInv", 6, 1, 0 },
+    { "prevTm", 7, 1, 0 },
+    { "utc", 10, 1, 0 },
+    { "fEdge", 1, 1, 0 },
+    { "tm1", 4, 1, 0 },
+    { "f1", 6, 1, 0 },
+    { "pos", 0, 1, 0 },
+    { "time", 1, 1, 0 },
+    { "clockD", 2, 1, 0 },
+    { "tp", 3, 1, 0 },  // 1000
+    { "clockF", 4, 1, 0 },
+    { "lla", 5, 1, 0 },
+    { "altInv", 6, 1, 0 },
+    { "prevTm", 7, 1, 0 },
+    { "utc", 10, 1, 0 },
+    { "healthValid", 0, 1, 0 },
+    { "utcValid", 1, 1, 0 },
+    { "klobValid", 2, 1, 0 },
+    { "timeBase", 0, 1, 0 },
+    { "utc", 1, 1, 0 },
+    { "raim", 2, 2, 0 },
+    { "qErrInvalid", 4, 1, 0 },
+    { "TpNotLocked", 5, 1, 0 },
+    { "timeRefGnss", 0, 4, 0 },
+    { "utcStandard", 4, 4, 0 },
+    { "mode", 0, 1, 0 },
+    { "run", 1, 1, 0 },
+    { "newFallingEdge", 2, 1, 0 },
+    { "timeBase", 3, 2, 0 },
+    { "utc", 5, 1, 0 },
+    { "time", 6, 1, 0 },
+    { "newRisingEdge", 7, 1, 0 },
+    { "src", 0, 3, 0 },
+    { "leapNow", 0, 1, 0 },
+    { "leapSoon", 1, 1, 0 },
+    { "leapPositive", 2, 1, 0 },
+    { "timeInLimit", 3, 1, 0 },
+    { "intOscInLimit", 4, 1, 0 },
+    { "extOscInLimit", 5, 1, 0 },
+    { "gnssTimeValid", 6, 1, 0 },
+    { "UTCTimeValid", 7, 1, 0 },
+    { "DiscSrc", 8, 3, 0 },
+    { "raim", 11, 1, 0 },
+    { "cohPulse", 12, 1, 0 },
+    { "lockedPulse", 13, 1, 0 },
+    { "freqValid", 0, 1, 0 },
+    { "phaseValid", 1, 1, 0 },
+    { "raw", 0, 1, 0 },
+    { "difference", 1, 1, 0 },
+    { "timeMarkSent", 0, 2, 0 },
+    { "timeMarkEdge", 2, 1, 0 },
+    { "calibTtagValid", 3, 1, 0 },
+    { "numMeas", 11, 5, 0 },
+    { "dataField", 0, 24, 0 },
+    { "dataType", 24, 6, 0 },
+    { "timeMarkSent", 0, 2, 0 },
+    { "timeMarkEdge", 2, 1, 0 },
+    { "calibTtagValid", 3, 1, 0 },
+    { "numMeas", 11, 5, 0 },
+    { "dataField", 0, 24, 0 },  // 1050
+    { "dataType", 24, 8, 0 },
+    { "dataField", 0, 24, 0 },
+    { "dataType", 24, 8, 0 },
+    { "dataField", 0, 24, 0 },
+    { "dataType", 24, 6, 0 },
+    { "type", 0, 6, 0 },
+    { "used", 6, 1, 0 },
+    { "calibStatus", 0, 2, 0 },
+    { "timeStatus", 2, 2, 0 },
+    { "type", 0, 6, 0 },
+    { "used", 6, 1, 0 },
+    { "ready", 7, 1, 0 },
+    { "calibStatus", 0, 2, 0 },
+    { "timeStatus", 2, 2, 0 },
+    { "badMeas", 0, 1, 0 },
+    { "badTTag", 1, 1, 0 },
+    { "missingMeas", 2, 1, 0 },
+    { "noisyMeas", 3, 1, 0 },
+    { "wtInitStatus", 0, 2, 0 },
+    { "mntAlgStatus", 2, 3, 0 },
+    { "insInitStatus", 5, 2, 0 },
+    { "imuInitStatus", 0, 2, 0 },
+    { "type", 0, 6, 0 },
+    { "used", 6, 1, 0 },
+    { "ready", 7, 1, 0 },
+    { "calibStatus", 0, 2, 0 },
+    { "timeStatus", 2, 2, 0 },
+    { "badMeas", 0, 1, 0 },
+    { "badTTag", 1, 1, 0 },
+    { "missingMeas", 2, 1, 0 },
+    { "noisyMeas", 3, 1, 0 },
+    { "autoMntAlgOn", 0, 1, 0 },
+    { "status", 1, 3, 0 },
+    { "tiltAlgError", 0, 1, 0 },
+    { "yawAlgError", 1, 1, 0 },
+    { "angleError", 2, 1, 0 },
+    { "version", 0, 8, 0 },
+    { "xAngRateValid", 8, 1, 0 },
+    { "yAngRateValid", 9, 1, 0 },
+    { "zAngRateValid", 10, 1, 0 },
+    { "xAccelValid", 11, 1, 0 },
+    { "yAccelValid", 12, 1, 0 },
+    { "zAccelValid", 13, 1, 0 },
+    { "pubKeyId", 0, 4, 0 },
+    { "pubKeyType", 4, 4, 0 },
+    { "applicabilityTime", 0, 1, 0 },
+    { "source", 0, 4, 0 },
+    { "fall", 4, 1, 0 },
+    { "last", 5, 1, 0 },
+    { "trustedSource", 0, 1, 0 },  // 1100
+    { "source", 0, 4, 0 },
+    { "fall", 4, 1, 0 },
+    { "last", 5, 1, 0 },
+    { "trustedSource", 0, 1, 0 },
+    { "source", 0, 4, 0 },
+    { "fall", 4, 1, 0 },
+    { "circular", 0, 1, 0 },
+    { "recording", 3, 1, 0 },
+    { "inactive", 4, 1, 0 },
+    { "circular", 5, 1, 0 },
+    { "sendMonFirst", 0, 1, 0 },
+    { "extraPvt", 0, 1, 0 },
+    { "extraOdo", 1, 1, 0 },
+    { "validDate", 0, 1, 0 },
+    { "validTime", 1, 1, 0 },
+    { "gnssFixOK", 0, 1, 0 },
+    { "diffSoln", 1, 1, 0 },
+    { "psmState", 2, 3, 0 },
+    { "jamDetEnabled", 0, 1, 0 },
+    { "jammingState", 1, 2, 0 },
+    { "spfDetEnabled", 0, 1, 0 },
+    { "spoofingState", 1, 3, 0 },
+    { "jamDetEnabled", 0, 1, 0 },
+    { "jamState", 1, 2, 0 },
+    { "spfDetEnabled", 3, 1, 0 },
+    { "spfState", 4, 3, 0 },
+    { "centFreq", 0, 24, 0 },
+    { "jammed", 24, 1, 0 },
+    { "headerAuthStatus", 0, 1, 0 },
+    { "nmaStatus", 1, 2, 0 },
+    { "chainInForce", 3, 2, 0 },
+    { "CPKS", 5, 3, 0 },
+    { "osnmaEnabled", 0, 1, 0 },
+    { "numberSVs", 1, 5, 0 },
+    { "nmaHeaderUpdate", 6, 2, 0 },
+    { "timSyncEnabled", 0, 1, 0 },
+    { "timSyncStatus", 1, 3, 0 },
+    { "dsmAuthenticationStatus", 0, 6, 0 },
+    { "hashFunction", 6, 2, 0 },
+    { "macFunction", 8, 2, 0 },
+    { "pubKeyId", 10, 4, 0 },
+    { "macLookupTable", 14, 8, 0 },
+    { "keySize", 22, 4, 0 },
+    { "macSize", 26, 4, 0 },
+    { "fromNVS", 30, 1, 0 },
+    { "teslaKeyAuthStatus", 0, 3, 0 },
+    { "wnSf", 3, 12, 0 },
+    { "towSf", 15, 15, 0 },
+    { "chainId", 30, 2, 0 },
+    { "authSVs", 0, 6, 0 },  // 1150
+    { "authNumTim", 6, 6, 0 },
+    { "timingAuthResult", 12, 2, 0 },
+    { "macAdkdType", 14, 1, 0 },
+    { "pubKeySrc", 15, 2, 0 },
+    { "IODE", 0, 10, 0 },
+    { "authNum", 10, 5, 0 },
+    { "authStatus", 15, 1, 0 },
+    { "headerAuthStatus", 0, 1, 0 },
+    { "nmaStatus", 1, 2, 0 },
+    { "chainInForce", 3, 2, 0 },
+    { "CPKS", 5, 3, 0 },
+    { "osnmaEnabled", 0, 1, 0 },
+    { "numberSVs", 1, 5, 0 },
+    { "nmaHeaderUpdate", 6, 2, 0 },
+    { "timSyncEnabled", 0, 1, 0 },
+    { "timSyncStatus", 1, 3, 0 },
+    { "dsmAuthenticationStatus", 0, 6, 0 },
+    { "hashFunction", 6, 2, 0 },
+    { "macFunction", 8, 2, 0 },
+    { "pubKeyId", 10, 4, 0 },
+    { "macLookupTable", 14, 8, 0 },
+    { "keySize", 22, 4, 0 },
+    { "macSize", 26, 4, 0 },
+    { "fromNVS", 30, 1, 0 },
+    { "teslaKeyAuthStatus", 0, 3, 0 },
+    { "wnSf", 3, 12, 0 },
+    { "towSf", 15, 15, 0 },
+    { "chainId", 30, 2, 0 },
+    { "authSVs", 0, 6, 0 },
+    { "authNumTim", 6, 6, 0 },
+    { "timingAuthResult", 12, 2, 0 },
+    { "macAdkdType", 14, 1, 0 },
+    { "pubKeySrc", 15, 2, 0 },
+    { "merkleRootSrc", 17, 2, 0 },
+    { "merkleRootVal", 19, 1, 0 },
+    { "futureMerkleRootSrc", 20, 2, 0 },
+    { "futureMerkleRootVal", 22, 1, 0 },
+    { "pubKeyVal", 23, 1, 0 },
+    { "futurePubKeyVal", 24, 1, 0 },
+    { "futurePubKeySrc", 25, 2, 0 },
+    { "futurePubKeyId", 27, 4, 0 },
+    { "IODE", 0, 10, 0 },
+    { "authNum", 10, 5, 0 },
+    { "authStatus", 15, 1, 0 },
+    { "headerAuthStatus", 0, 1, 0 },
+    { "nmaStatus", 1, 2, 0 },
+    { "chainInForce", 3, 2, 0 },
+    { "CPKS", 5, 3, 0 },
+    { "osnmaEnabled", 0, 1, 0 },
+    { "numberSVs", 1, 5, 0 },  // 1200
+    { "nmaHeaderUpdate", 6, 2, 0 },
+    { "noData", 8, 1, 0 },
+    { "wrongData", 9, 1, 0 },
+    { "wrongFlxMac", 10, 1, 0 },
+    { "wrongMaclt", 11, 1, 0 },
+    { "timSyncEnabled", 0, 1, 0 },
+    { "timSyncStatus", 1, 3, 0 },
+    { "dsmAuthenticationStatus", 0, 6, 0 },
+    { "hashFunction", 6, 2, 0 },
+    { "macFunction", 8, 2, 0 },
+    { "pubKeyId", 10, 4, 0 },
+    { "macLookupTable", 14, 8, 0 },
+    { "keySize", 22, 4, 0 },
+    { "macSize", 26, 4, 0 },
+    { "fromNVS", 30, 1, 0 },
+    { "teslaKeyAuthStatus", 0, 3, 0 },
+    { "wnSf", 3, 12, 0 },
+    { "towSf", 15, 15, 0 },
+    { "chainId", 30, 2, 0 },
+    { "authSVs", 0, 6, 0 },
+    { "authNumTim", 6, 6, 0 },
+    { "timingAuthResult", 12, 2, 0 },
+    { "macAdkdType", 14, 1, 0 },
+    { "pubKeySrc", 15, 2, 0 },
+    { "merkleRootSrc", 17, 2, 0 },
+    { "merkleRootVal", 19, 1, 0 },
+    { "futureMerkleRootSrc", 20, 2, 0 },
+    { "futureMerkleRootVal", 22, 1, 0 },
+    { "pubKeyVal", 23, 1, 0 },
+    { "futurePubKeyVal", 24, 1, 0 },
+    { "futurePubKeySrc", 25, 2, 0 },
+    { "futurePubKeyId", 27, 4, 0 },
+    { "IODE", 0, 10, 0 },
+    { "authNum", 10, 5, 0 },
+    { "authStatus", 15, 1, 0 },
+    { "validDate", 0, 1, 0 },
+    { "validTime", 1, 1, 0 },
+    { "fullyResolved", 2, 1, 0 },
+    { "GPSfixOK", 0, 1, 0 },
+    { "DiffSoln", 1, 1, 0 },
+    { "WKNSET", 2, 1, 0 },
+    { "TOWSET", 3, 1, 0 },
+    { "headVehValid", 4, 1, 0 },
+    { "version", 0, 8, 0 },
+    { "xAngRateValid", 8, 1, 0 },
+    { "yAngRateValid", 9, 1, 0 },
+    { "zAngRateValid", 10, 1, 0 },
+    { "xAccelValid", 11, 1, 0 },
+    { "yAccelValid", 12, 1, 0 },
+    { "zAccelValid", 13, 1, 0 },  // 1250
+    { "gpsFixOk", 0, 1, 0 },
+    { "diffSoln", 1, 1, 0 },
+    { "wknSet", 2, 1, 0 },
+    { "towSet", 3, 1, 0 },
+    { "diffCorr", 0, 1, 0 },
+    { "carrSolnValid", 1, 1, 0 },
+    { "mapMatching", 6, 2, 0 },
+    { "psmState", 0, 2, 0 },
+    { "spoofDetState", 3, 2, 0 },
+    { "carrSoln", 6, 2, 0 },
+    { "validDate", 0, 1, 0 },
+    { "validTime", 1, 1, 0 },
+    { "fullyResolved", 2, 1, 0 },
+    { "validMag", 3, 1, 0 },
+    { "gnssFixOK", 0, 1, 0 },
+    { "diffSoln", 1, 1, 0 },
+    { "psmState", 2, 3, 0 },
+    { "headVehValid", 5, 1, 0 },
+    { "carrSoln", 6, 2, 0 },
+    { "confirmedAvai", 5, 1, 0 },
+    { "confirmedDate", 6, 1, 0 },
+    { "confirmedTime", 7, 1, 0 },
+    { "invalidLlh", 0, 1, 0 },
+    { "lastCorrectionAge", 1, 4, 0 },
+    { "authTime", 13, 1, 0 },
+    { "nmaFixStatus", 14, 1, 0 },
+    { "validDate", 0, 1, 0 },
+    { "validTime", 1, 1, 0 },
+    { "fullyResolved", 2, 1, 0 },
+    { "validMag", 3, 1, 0 },
+    { "gnssFixOK", 0, 1, 0 },
+    { "diffSoln", 1, 1, 0 },
+    { "vehRollValid", 3, 1, 0 },
+    { "vehPitchValid", 4, 1, 0 },
+    { "vehHeadingValid", 5, 1, 0 },
+    { "carrSoln", 6, 2, 0 },
+    { "confirmedAvai", 5, 1, 0 },
+    { "confirmedDate", 6, 1, 0 },
+    { "confirmedTime", 7, 1, 0 },
+    { "towValid", 0, 1, 0 },
+    { "weekValid", 1, 1, 0 },
+    { "leapSValid", 2, 1, 0 },
+    { "validTOW", 0, 1, 0 },
+    { "validWKN", 1, 1, 0 },
+    { "validUTC", 2, 1, 0 },
+    { "authStatus", 3, 1, 0 },
+    { "utcStandard", 4, 4, 0 },
+    { "todValid", 0, 1, 0 },
+    { "dateValid", 1, 1, 0 },
+    { "sowValid", 0, 1, 0 },  // 1300
+    { "weekValid", 1, 1, 0 },
+    { "leapSValid", 2, 1, 0 },
+    { "galTowValid", 0, 1, 0 },
+    { "galWnoValid", 1, 1, 0 },
+    { "leapSValid", 2, 1, 0 },
+    { "validCurrLs", 0, 1, 0 },
+    { "validTimeToLsEvent", 1, 1, 0 },
+    { "qzssTowValid", 0, 1, 0 },
+    { "qzssWnoValid", 1, 1, 0 },
+    { "leapSValid", 2, 1, 0 },
+    { "Ranging", 0, 1, 0 },
+    { "Corrections", 1, 1, 0 },
+    { "Integrity", 2, 1, 0 },
+    { "Testmode", 3, 1, 0 },
+    { "Bad", 4, 1, 0 },
+    { "integrityUsed", 0, 2, 0 },
+    { "qualityInd", 0, 3, 0 },
+    { "svUsed", 3, 1, 0 },
+    { "health", 4, 2, 0 },
+    { "diffCorr", 6, 1, 0 },
+    { "smoothed", 7, 1, 0 },
+    { "orbitSource", 8, 3, 0 },
+    { "ephAvail", 11, 1, 0 },
+    { "almAvail", 12, 1, 0 },
+    { "anoAvail", 13, 1, 0 },
+    { "aopAvail", 14, 1, 0 },
+    { "sbasCorrUsed", 16, 1, 0 },
+    { "rtcmCorrUsed", 17, 1, 0 },
+    { "slasCorrUsed", 18, 1, 0 },
+    { "spartnCorrUsed", 19, 1, 0 },
+    { "prCorrUsed", 20, 1, 0 },
+    { "crCorrUsed", 21, 1, 0 },
+    { "doCorrUsed", 22, 1, 0 },
+    { "clasCorrUsed", 23, 1, 0 },
+    { "lppCorrUsed", 24, 1, 0 },
+    { "hasCorrUsed", 25, 1, 0 },
+    { "gmsAvailable", 0, 1, 0 },
+    { "qzssSvAvailable", 1, 1, 0 },
+    { "testMode", 2, 1, 0 },
+    { "health", 0, 2, 0 },
+    { "prSmoothed", 2, 1, 0 },
+    { "prUsed", 3, 1, 0 },
+    { "crUsed", 4, 1, 0 },
+    { "doUsed", 5, 1, 0 },
+    { "prCorrUsed", 6, 1, 0 },
+    { "crCorrUsed", 7, 1, 0 },
+    { "doCorrUsed", 8, 1, 0 },
+    { "authStatus", 9, 1, 0 },
+    { "NavICTowValid", 0, 1, 0 },
+    { "NavICWnoValid", 1, 1, 0 },  // 1350
+    { "leapSValid", 2, 1, 0 },
+};
+
+static const ubx_msgdb_field_t ubx_msgdb_fields[] = {
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 0, 0 },  // 0
+    { "ecefX", 4, UBX_MSGDB_I4, 1, 0, 0, 0 },
+    { "ecefY", 8, UBX_MSGDB_I4, 1, 0, 0, 0 },
+    { "ecefZ", 12, UBX_MSGDB_I4, 1, 0, 0, 0 },
+    { "pAcc", 16, UBX_MSGDB_U4, 1, 0, 0, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 0, 0 },
+    { "lon", 4, UBX_MSGDB_I4, 1, 0, 0, 0 },
+    { "lat", 8, UBX_MSGDB_I4, 1, 0, 0, 0 },
+    { "height", 12, UBX_MSGDB_I4, 1, 0, 0, 0 },
+    { "hMSL", 16, UBX_MSGDB_I4, 1, 0, 0, 0 },
+    { "hAcc", 20, UBX_MSGDB_U4, 1, 0, 0, 0 },
+    { "vAcc", 24, UBX_MSGDB_U4, 1, 0, 0, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 0, 0 },
+    { "gpsFix", 4, UBX_MSGDB_U1, 1, 0, 0, 0 },
+    { "flags", 5, UBX_MSGDB_X1, 1, 0, 0, 4 },
+    { "fixStat", 6, UBX_MSGDB_X1, 1, 0, 4, 3 },
+    { "flags2", 7, UBX_MSGDB_X1, 1, 0, 7, 3 },
+    { "ttff", 8, UBX_MSGDB_U4, 1, 0, 10, 0 },
+    { "msss", 12, UBX_MSGDB_U4, 1, 0, 10, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 10, 0 },
+    { "gDOP", 4, UBX_MSGDB_U2, 1, 0, 10, 0 },
+    { "pDOP", 6, UBX_MSGDB_U2, 1, 0, 10, 0 },
+    { "tDOP", 8, UBX_MSGDB_U2, 1, 0, 10, 0 },
+    { "vDOP", 10, UBX_MSGDB_U2, 1, 0, 10, 0 },
+    { "hDOP", 12, UBX_MSGDB_U2, 1, 0, 10, 0 },
+    { "nDOP", 14, UBX_MSGDB_U2, 1, 0, 10, 0 },
+    { "eDOP", 16, UBX_MSGDB_U2, 1, 0, 10, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 10, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 10, 0 },
+    { "reserved0", 5, UBX_MSGDB_U1, 3, 1, 10, 0 },
+    { "roll", 8, UBX_MSGDB_I4, 1, 0, 10, 0 },
+    { "pitch", 12, UBX_MSGDB_I4, 1, 0, 10, 0 },
+    { "heading", 16, UBX_MSGDB_I4, 1, 0, 10, 0 },
+    { "accRoll", 20, UBX_MSGDB_U4, 1, 0, 10, 0 },
+    { "accPitch", 24, UBX_MSGDB_U4, 1, 0, 10, 0 },
+    { "accHeading", 28, UBX_MSGDB_U4, 1, 0, 10, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 10, 0 },
+    { "fTOW", 4, UBX_MSGDB_I4, 1, 0, 10, 0 },
+    { "week", 8, UBX_MSGDB_I2, 1, 0, 10, 0 },
+    { "gpsFix", 10, UBX_MSGDB_U1, 1, 0, 10, 0 },
+    { "flags", 11, UBX_MSGDB_X1, 1, 0, 10, 4 },
+    { "ecefX", 12, UBX_MSGDB_I4, 1, 0, 14, 0 },
+    { "ecefY", 16, UBX_MSGDB_I4, 1, 0, 14, 0 },
+    { "ecefZ", 20, UBX_MSGDB_I4, 1, 0, 14, 0 },
+    { "pAcc", 24, UBX_MSGDB_U4, 1, 0, 14, 0 },
+    { "ecefVX", 28, UBX_MSGDB_I4, 1, 0, 14, 0 },
+    { "ecefVY", 32, UBX_MSGDB_I4, 1, 0, 14, 0 },
+    { "ecefVZ", 36, UBX_MSGDB_I4, 1, 0, 14, 0 },
+    { "sAcc", 40, UBX_MSGDB_U4, 1, 0, 14, 0 },
+    { "pDOP", 44, UBX_MSGDB_U2, 1, 0, 14, 0 },
+    { "reserved0", 46, UBX_MSGDB_U1, 1, 1, 14, 0 },  // 50
+    { "numSV", 47, UBX_MSGDB_U1, 1, 0, 14, 0 },
+    { "reserved1", 48, UBX_MSGDB_U1, 4, 1, 14, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 14, 0 },
+    { "year", 4, UBX_MSGDB_U2, 1, 0, 14, 0 },
+    { "month", 6, UBX_MSGDB_U1, 1, 0, 14, 0 },
+    { "day", 7, UBX_MSGDB_U1, 1, 0, 14, 0 },
+    { "hour", 8, UBX_MSGDB_U1, 1, 0, 14, 0 },
+    { "min", 9, UBX_MSGDB_U1, 1, 0, 14, 0 },
+    { "sec", 10, UBX_MSGDB_U1, 1, 0, 14, 0 },
+    { "valid", 11, UBX_MSGDB_X1, 1, 0, 14, 3 },
+    { "tAcc", 12, UBX_MSGDB_U4, 1, 0, 17, 0 },
+    { "nano", 16, UBX_MSGDB_I4, 1, 0, 17, 0 },
+    { "fixType", 20, UBX_MSGDB_U1, 1, 0, 17, 0 },
+    { "flags", 21, UBX_MSGDB_X1, 1, 0, 17, 3 },
+    { "reserved0", 22, UBX_MSGDB_U1, 1, 1, 20, 0 },
+    { "numSV", 23, UBX_MSGDB_U1, 1, 0, 20, 0 },
+    { "lon", 24, UBX_MSGDB_I4, 1, 0, 20, 0 },
+    { "lat", 28, UBX_MSGDB_I4, 1, 0, 20, 0 },
+    { "height", 32, UBX_MSGDB_I4, 1, 0, 20, 0 },
+    { "hMSL", 36, UBX_MSGDB_I4, 1, 0, 20, 0 },
+    { "hAcc", 40, UBX_MSGDB_U4, 1, 0, 20, 0 },
+    { "vAcc", 44, UBX_MSGDB_U4, 1, 0, 20, 0 },
+    { "velN", 48, UBX_MSGDB_I4, 1, 0, 20, 0 },
+    { "velE", 52, UBX_MSGDB_I4, 1, 0, 20, 0 },
+    { "velD", 56, UBX_MSGDB_I4, 1, 0, 20, 0 },
+    { "gSpeed", 60, UBX_MSGDB_I4, 1, 0, 20, 0 },
+    { "headMot", 64, UBX_MSGDB_I4, 1, 0, 20, 0 },
+    { "sAcc", 68, UBX_MSGDB_U4, 1, 0, 20, 0 },
+    { "headAcc", 72, UBX_MSGDB_U4, 1, 0, 20, 0 },
+    { "pDOP", 76, UBX_MSGDB_U2, 1, 0, 20, 0 },
+    { "reserved1", 78, UBX_MSGDB_U1, 6, 1, 20, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 20, 0 },
+    { "year", 4, UBX_MSGDB_U2, 1, 0, 20, 0 },
+    { "month", 6, UBX_MSGDB_U1, 1, 0, 20, 0 },
+    { "day", 7, UBX_MSGDB_U1, 1, 0, 20, 0 },
+    { "hour", 8, UBX_MSGDB_U1, 1, 0, 20, 0 },
+    { "min", 9, UBX_MSGDB_U1, 1, 0, 20, 0 },
+    { "sec", 10, UBX_MSGDB_U1, 1, 0, 20, 0 },
+    { "valid", 11, UBX_MSGDB_X1, 1, 0, 20, 4 },
+    { "tAcc", 12, UBX_MSGDB_U4, 1, 0, 24, 0 },
+    { "nano", 16, UBX_MSGDB_I4, 1, 0, 24, 0 },
+    { "fixType", 20, UBX_MSGDB_U1, 1, 0, 24, 0 },
+    { "flags", 21, UBX_MSGDB_X1, 1, 0, 24, 5 },
+    { "flags2", 22, UBX_MSGDB_X1, 1, 0, 29, 3 },
+    { "numSV", 23, UBX_MSGDB_U1, 1, 0, 32, 0 },
+    { "lon", 24, UBX_MSGDB_I4, 1, 0, 32, 0 },
+    { "lat", 28, UBX_MSGDB_I4, 1, 0, 32, 0 },
+    { "height", 32, UBX_MSGDB_I4, 1, 0, 32, 0 },
+    { "hMSL", 36, UBX_MSGDB_I4, 1, 0, 32, 0 },
+    { "hAcc", 40, UBX_MSGDB_U4, 1, 0, 32, 0 },  // 100
+    { "vAcc", 44, UBX_MSGDB_U4, 1, 0, 32, 0 },
+    { "velN", 48, UBX_MSGDB_I4, 1, 0, 32, 0 },
+    { "velE", 52, UBX_MSGDB_I4, 1, 0, 32, 0 },
+    { "velD", 56, UBX_MSGDB_I4, 1, 0, 32, 0 },
+    { "gSpeed", 60, UBX_MSGDB_I4, 1, 0, 32, 0 },
+    { "headMot", 64, UBX_MSGDB_I4, 1, 0, 32, 0 },
+    { "sAcc", 68, UBX_MSGDB_U4, 1, 0, 32, 0 },
+    { "headAcc", 72, UBX_MSGDB_U4, 1, 0, 32, 0 },
+    { "pDOP", 76, UBX_MSGDB_U2, 1, 0, 32, 0 },
+    { "flags3", 78, UBX_MSGDB_X2, 1, 0, 32, 4 },
+    { "reserved0", 80, UBX_MSGDB_U1, 4, 1, 36, 0 },
+    { "headVeh", 84, UBX_MSGDB_I4, 1, 0, 36, 0 },
+    { "magDec", 88, UBX_MSGDB_I2, 1, 0, 36, 0 },
+    { "magAcc", 90, UBX_MSGDB_U2, 1, 0, 36, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 36, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 36, 0 },
+    { "iTOW", 4, UBX_MSGDB_U4, 1, 0, 36, 0 },
+    { "distance", 8, UBX_MSGDB_U4, 1, 0, 36, 0 },
+    { "totalDistance", 12, UBX_MSGDB_U4, 1, 0, 36, 0 },
+    { "distanceStd", 16, UBX_MSGDB_U4, 1, 0, 36, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 36, 0 },
+    { "ecefVX", 4, UBX_MSGDB_I4, 1, 0, 36, 0 },
+    { "ecefVY", 8, UBX_MSGDB_I4, 1, 0, 36, 0 },
+    { "ecefVZ", 12, UBX_MSGDB_I4, 1, 0, 36, 0 },
+    { "sAcc", 16, UBX_MSGDB_U4, 1, 0, 36, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 36, 0 },
+    { "velN", 4, UBX_MSGDB_I4, 1, 0, 36, 0 },
+    { "velE", 8, UBX_MSGDB_I4, 1, 0, 36, 0 },
+    { "velD", 12, UBX_MSGDB_I4, 1, 0, 36, 0 },
+    { "speed", 16, UBX_MSGDB_U4, 1, 0, 36, 0 },
+    { "gSpeed", 20, UBX_MSGDB_U4, 1, 0, 36, 0 },
+    { "heading", 24, UBX_MSGDB_I4, 1, 0, 36, 0 },
+    { "sAcc", 28, UBX_MSGDB_U4, 1, 0, 36, 0 },
+    { "cAcc", 32, UBX_MSGDB_U4, 1, 0, 36, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 36, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 36, 0 },
+    { "iTOW", 4, UBX_MSGDB_U4, 1, 0, 36, 0 },
+    { "ecefX", 8, UBX_MSGDB_I4, 1, 0, 36, 0 },
+    { "ecefY", 12, UBX_MSGDB_I4, 1, 0, 36, 0 },
+    { "ecefZ", 16, UBX_MSGDB_I4, 1, 0, 36, 0 },
+    { "ecefXHp", 20, UBX_MSGDB_I1, 1, 0, 36, 0 },
+    { "ecefYHp", 21, UBX_MSGDB_I1, 1, 0, 36, 0 },
+    { "ecefZHp", 22, UBX_MSGDB_I1, 1, 0, 36, 0 },
+    { "flags", 23, UBX_MSGDB_X1, 1, 0, 36, 1 },
+    { "pAcc", 24, UBX_MSGDB_U4, 1, 0, 37, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 37, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 2, 1, 37, 0 },
+    { "flags", 3, UBX_MSGDB_X1, 1, 0, 37, 1 },
+    { "iTOW", 4, UBX_MSGDB_U4, 1, 0, 38, 0 },
+    { "lon", 8, UBX_MSGDB_I4, 1, 0, 38, 0 },  // 150
+    { "lat", 12, UBX_MSGDB_I4, 1, 0, 38, 0 },
+    { "height", 16, UBX_MSGDB_I4, 1, 0, 38, 0 },
+    { "hMSL", 20, UBX_MSGDB_I4, 1, 0, 38, 0 },
+    { "lonHp", 24, UBX_MSGDB_I1, 1, 0, 38, 0 },
+    { "latHp", 25, UBX_MSGDB_I1, 1, 0, 38, 0 },
+    { "heightHp", 26, UBX_MSGDB_I1, 1, 0, 38, 0 },
+    { "hMSLHp", 27, UBX_MSGDB_I1, 1, 0, 38, 0 },
+    { "hAcc", 28, UBX_MSGDB_U4, 1, 0, 38, 0 },
+    { "vAcc", 32, UBX_MSGDB_U4, 1, 0, 38, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 38, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 38, 0 },
+    { "valid", 5, UBX_MSGDB_X1, 1, 0, 38, 4 },
+    { "year", 6, UBX_MSGDB_U2, 1, 0, 42, 0 },
+    { "month", 8, UBX_MSGDB_U1, 1, 0, 42, 0 },
+    { "day", 9, UBX_MSGDB_U1, 1, 0, 42, 0 },
+    { "hour", 10, UBX_MSGDB_U1, 1, 0, 42, 0 },
+    { "min", 11, UBX_MSGDB_U1, 1, 0, 42, 0 },
+    { "sec", 12, UBX_MSGDB_U1, 1, 0, 42, 0 },
+    { "reserved0", 13, UBX_MSGDB_U1, 1, 1, 42, 0 },
+    { "reserved1", 14, UBX_MSGDB_U1, 2, 1, 42, 0 },
+    { "tAcc", 16, UBX_MSGDB_U4, 1, 0, 42, 0 },
+    { "nano", 20, UBX_MSGDB_I4, 1, 0, 42, 0 },
+    { "fixType", 24, UBX_MSGDB_U1, 1, 0, 42, 0 },
+    { "flags", 25, UBX_MSGDB_X1, 1, 0, 42, 6 },
+    { "flags2", 26, UBX_MSGDB_X1, 1, 0, 48, 3 },
+    { "numSV", 27, UBX_MSGDB_U1, 1, 0, 51, 0 },
+    { "lon", 28, UBX_MSGDB_I4, 1, 0, 51, 0 },
+    { "lat", 32, UBX_MSGDB_I4, 1, 0, 51, 0 },
+    { "height", 36, UBX_MSGDB_I4, 1, 0, 51, 0 },
+    { "hMSL", 40, UBX_MSGDB_I4, 1, 0, 51, 0 },
+    { "hAcc", 44, UBX_MSGDB_U4, 1, 0, 51, 0 },
+    { "vAcc", 48, UBX_MSGDB_U4, 1, 0, 51, 0 },
+    { "velN", 52, UBX_MSGDB_I4, 1, 0, 51, 0 },
+    { "velE", 56, UBX_MSGDB_I4, 1, 0, 51, 0 },
+    { "velD", 60, UBX_MSGDB_I4, 1, 0, 51, 0 },
+    { "gSpeed", 64, UBX_MSGDB_I4, 1, 0, 51, 0 },
+    { "sAcc", 68, UBX_MSGDB_U4, 1, 0, 51, 0 },
+    { "vehRoll", 72, UBX_MSGDB_I4, 1, 0, 51, 0 },
+    { "vehPitch", 76, UBX_MSGDB_I4, 1, 0, 51, 0 },
+    { "vehHeading", 80, UBX_MSGDB_I4, 1, 0, 51, 0 },
+    { "motHeading", 84, UBX_MSGDB_I4, 1, 0, 51, 0 },
+    { "accRoll", 88, UBX_MSGDB_U2, 1, 0, 51, 0 },
+    { "accPitch", 90, UBX_MSGDB_U2, 1, 0, 51, 0 },
+    { "accHeading", 92, UBX_MSGDB_U2, 1, 0, 51, 0 },
+    { "magDec", 94, UBX_MSGDB_I2, 1, 0, 51, 0 },
+    { "magAcc", 96, UBX_MSGDB_U2, 1, 0, 51, 0 },
+    { "errEllipseOrient", 98, UBX_MSGDB_U2, 1, 0, 51, 0 },
+    { "errEllipseMajor", 100, UBX_MSGDB_U4, 1, 0, 51, 0 },
+    { "errEllipseMinor", 104, UBX_MSGDB_U4, 1, 0, 51, 0 },
+    { "reserved2", 108, UBX_MSGDB_U1, 4, 1, 51, 0 },  // 200
+    { "reserved3", 112, UBX_MSGDB_U1, 4, 1, 51, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 51, 0 },
+    { "fTOW", 4, UBX_MSGDB_I4, 1, 0, 51, 0 },
+    { "week", 8, UBX_MSGDB_I2, 1, 0, 51, 0 },
+    { "leapS", 10, UBX_MSGDB_I1, 1, 0, 51, 0 },
+    { "valid", 11, UBX_MSGDB_X1, 1, 0, 51, 3 },
+    { "tAcc", 12, UBX_MSGDB_U4, 1, 0, 54, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 54, 0 },
+    { "tAcc", 4, UBX_MSGDB_U4, 1, 0, 54, 0 },
+    { "nano", 8, UBX_MSGDB_I4, 1, 0, 54, 0 },
+    { "year", 12, UBX_MSGDB_U2, 1, 0, 54, 0 },
+    { "month", 14, UBX_MSGDB_U1, 1, 0, 54, 0 },
+    { "day", 15, UBX_MSGDB_U1, 1, 0, 54, 0 },
+    { "hour", 16, UBX_MSGDB_U1, 1, 0, 54, 0 },
+    { "min", 17, UBX_MSGDB_U1, 1, 0, 54, 0 },
+    { "sec", 18, UBX_MSGDB_U1, 1, 0, 54, 0 },
+    { "valid", 19, UBX_MSGDB_X1, 1, 0, 54, 5 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 59, 0 },
+    { "clkB", 4, UBX_MSGDB_I4, 1, 0, 59, 0 },
+    { "clkD", 8, UBX_MSGDB_I4, 1, 0, 59, 0 },
+    { "tAcc", 12, UBX_MSGDB_U4, 1, 0, 59, 0 },
+    { "fAcc", 16, UBX_MSGDB_U4, 1, 0, 59, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 59, 0 },
+    { "TOD", 4, UBX_MSGDB_U4, 1, 0, 59, 0 },
+    { "fTOD", 8, UBX_MSGDB_I4, 1, 0, 59, 0 },
+    { "Nt", 12, UBX_MSGDB_U2, 1, 0, 59, 0 },
+    { "N4", 14, UBX_MSGDB_U1, 1, 0, 59, 0 },
+    { "valid", 15, UBX_MSGDB_X1, 1, 0, 59, 2 },
+    { "tAcc", 16, UBX_MSGDB_U4, 1, 0, 61, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 61, 0 },
+    { "SOW", 4, UBX_MSGDB_U4, 1, 0, 61, 0 },
+    { "fSOW", 8, UBX_MSGDB_I4, 1, 0, 61, 0 },
+    { "week", 12, UBX_MSGDB_I2, 1, 0, 61, 0 },
+    { "leapS", 14, UBX_MSGDB_I1, 1, 0, 61, 0 },
+    { "valid", 15, UBX_MSGDB_X1, 1, 0, 61, 3 },
+    { "tAcc", 16, UBX_MSGDB_U4, 1, 0, 64, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 64, 0 },
+    { "galTow", 4, UBX_MSGDB_U4, 1, 0, 64, 0 },
+    { "fGalTow", 8, UBX_MSGDB_I4, 1, 0, 64, 0 },
+    { "galWno", 12, UBX_MSGDB_I2, 1, 0, 64, 0 },
+    { "leapS", 14, UBX_MSGDB_I1, 1, 0, 64, 0 },
+    { "valid", 15, UBX_MSGDB_X1, 1, 0, 64, 3 },
+    { "tAcc", 16, UBX_MSGDB_U4, 1, 0, 67, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 67, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 67, 0 },
+    { "reserved0", 5, UBX_MSGDB_U1, 3, 1, 67, 0 },
+    { "srcOfCurrLs", 8, UBX_MSGDB_U1, 1, 0, 67, 0 },
+    { "currLs", 9, UBX_MSGDB_I1, 1, 0, 67, 0 },
+    { "srcOfLsChange", 10, UBX_MSGDB_U1, 1, 0, 67, 0 },
+    { "lsChange", 11, UBX_MSGDB_I1, 1, 0, 67, 0 },  // 250
+    { "timeToLsEvent", 12, UBX_MSGDB_I4, 1, 0, 67, 0 },
+    { "dateOfLsGpsWn", 16, UBX_MSGDB_U2, 1, 0, 67, 0 },
+    { "dateOfLsGpsDn", 18, UBX_MSGDB_U2, 1, 0, 67, 0 },
+    { "reserved1", 20, UBX_MSGDB_U1, 3, 1, 67, 0 },
+    { "valid", 23, UBX_MSGDB_X1, 1, 0, 67, 2 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 69, 0 },
+    { "qzssTow", 4, UBX_MSGDB_U4, 1, 0, 69, 0 },
+    { "fQzssTow", 8, UBX_MSGDB_I4, 1, 0, 69, 0 },
+    { "qzssWno", 12, UBX_MSGDB_I2, 1, 0, 69, 0 },
+    { "leapS", 14, UBX_MSGDB_I1, 1, 0, 69, 0 },
+    { "valid", 15, UBX_MSGDB_X1, 1, 0, 69, 3 },
+    { "tAcc", 16, UBX_MSGDB_U4, 1, 0, 72, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 72, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 72, 0 },
+    { "reserved0", 5, UBX_MSGDB_U1, 4, 1, 72, 0 },
+    { "gpsNmiFlags", 9, UBX_MSGDB_X1, 1, 0, 72, 4 },
+    { "gpsLsFlags", 10, UBX_MSGDB_X1, 1, 0, 76, 5 },
+    { "galNmiFlags", 11, UBX_MSGDB_X1, 1, 0, 81, 2 },
+    { "galLsFlags", 12, UBX_MSGDB_X1, 1, 0, 83, 5 },
+    { "bdsNmiFlags", 13, UBX_MSGDB_X1, 1, 0, 88, 2 },
+    { "bdsLsFlags", 14, UBX_MSGDB_X1, 1, 0, 90, 5 },
+    { "gloNmiFlags", 15, UBX_MSGDB_X1, 1, 0, 95, 2 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 97, 0 },
+    { "numCh", 4, UBX_MSGDB_U1, 1, 0, 97, 0 },
+    { "globalFlags", 5, UBX_MSGDB_X1, 1, 0, 97, 1 },
+    { "reserved0", 6, UBX_MSGDB_U1, 2, 1, 98, 0 },
+    { "chn", 0, UBX_MSGDB_U1, 1, 0, 98, 0 },
+    { "svid", 1, UBX_MSGDB_U1, 1, 0, 98, 0 },
+    { "flags", 2, UBX_MSGDB_X1, 1, 0, 98, 8 },
+    { "quality", 3, UBX_MSGDB_X1, 1, 0, 106, 1 },
+    { "cno", 4, UBX_MSGDB_U1, 1, 0, 107, 0 },
+    { "elev", 5, UBX_MSGDB_I1, 1, 0, 107, 0 },
+    { "azim", 6, UBX_MSGDB_I2, 1, 0, 107, 0 },
+    { "prRes", 8, UBX_MSGDB_I4, 1, 0, 107, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 107, 0 },
+    { "age", 4, UBX_MSGDB_I4, 1, 0, 107, 0 },
+    { "baseId", 8, UBX_MSGDB_I2, 1, 0, 107, 0 },
+    { "baseHealth", 10, UBX_MSGDB_I2, 1, 0, 107, 0 },
+    { "numCh", 12, UBX_MSGDB_U1, 1, 0, 107, 0 },
+    { "status", 13, UBX_MSGDB_U1, 1, 0, 107, 0 },
+    { "reserved0", 14, UBX_MSGDB_U1, 2, 1, 107, 0 },
+    { "svid", 0, UBX_MSGDB_U1, 1, 0, 107, 0 },
+    { "flags", 1, UBX_MSGDB_X1, 1, 0, 107, 2 },
+    { "ageC", 2, UBX_MSGDB_U2, 1, 0, 109, 0 },
+    { "prc", 4, UBX_MSGDB_R4, 1, 0, 109, 0 },
+    { "prrc", 8, UBX_MSGDB_R4, 1, 0, 109, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 109, 0 },
+    { "geo", 4, UBX_MSGDB_U1, 1, 0, 109, 0 },
+    { "mode", 5, UBX_MSGDB_U1, 1, 0, 109, 0 },
+    { "sys", 6, UBX_MSGDB_I1, 1, 0, 109, 0 },  // 300
+    { "service", 7, UBX_MSGDB_X1, 1, 0, 109, 5 },
+    { "cnt", 8, UBX_MSGDB_U1, 1, 0, 114, 0 },
+    { "statusFlags", 9, UBX_MSGDB_X1, 1, 0, 114, 1 },
+    { "reserved0", 10, UBX_MSGDB_U1, 2, 1, 115, 0 },
+    { "svid", 0, UBX_MSGDB_U1, 1, 0, 115, 0 },
+    { "reserved1", 1, UBX_MSGDB_U1, 1, 1, 115, 0 },
+    { "udre", 2, UBX_MSGDB_U1, 1, 0, 115, 0 },
+    { "svSys", 3, UBX_MSGDB_U1, 1, 0, 115, 0 },
+    { "svService", 4, UBX_MSGDB_U1, 1, 0, 115, 0 },
+    { "reserved2", 5, UBX_MSGDB_U1, 1, 1, 115, 0 },
+    { "prc", 6, UBX_MSGDB_I2, 1, 0, 115, 0 },
+    { "reserved3", 8, UBX_MSGDB_U1, 2, 1, 115, 0 },
+    { "ic", 10, UBX_MSGDB_I2, 1, 0, 115, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 115, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 115, 0 },
+    { "numSv", 5, UBX_MSGDB_U1, 1, 0, 115, 0 },
+    { "reserved0", 6, UBX_MSGDB_U1, 2, 1, 115, 0 },
+    { "gnssId", 0, UBX_MSGDB_U1, 1, 0, 115, 0 },
+    { "svId", 1, UBX_MSGDB_U1, 1, 0, 115, 0 },
+    { "svFlag", 2, UBX_MSGDB_X1, 1, 0, 115, 2 },
+    { "eph", 3, UBX_MSGDB_X1, 1, 0, 117, 2 },
+    { "alm", 4, UBX_MSGDB_X1, 1, 0, 119, 2 },
+    { "otherOrb", 5, UBX_MSGDB_X1, 1, 0, 121, 2 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 123, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 123, 0 },
+    { "numSvs", 5, UBX_MSGDB_U1, 1, 0, 123, 0 },
+    { "reserved0", 6, UBX_MSGDB_U1, 2, 1, 123, 0 },
+    { "gnssId", 0, UBX_MSGDB_U1, 1, 0, 123, 0 },
+    { "svId", 1, UBX_MSGDB_U1, 1, 0, 123, 0 },
+    { "cno", 2, UBX_MSGDB_U1, 1, 0, 123, 0 },
+    { "elev", 3, UBX_MSGDB_I1, 1, 0, 123, 0 },
+    { "azim", 4, UBX_MSGDB_I2, 1, 0, 123, 0 },
+    { "prRes", 6, UBX_MSGDB_I2, 1, 0, 123, 0 },
+    { "flags", 8, UBX_MSGDB_X4, 1, 0, 123, 20 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 143, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 143, 0 },
+    { "posCovValid", 5, UBX_MSGDB_U1, 1, 0, 143, 0 },
+    { "velCovValid", 6, UBX_MSGDB_U1, 1, 0, 143, 0 },
+    { "reserved0", 7, UBX_MSGDB_U1, 9, 1, 143, 0 },
+    { "posCovNN", 16, UBX_MSGDB_R4, 1, 0, 143, 0 },
+    { "posCovNE", 20, UBX_MSGDB_R4, 1, 0, 143, 0 },
+    { "posCovND", 24, UBX_MSGDB_R4, 1, 0, 143, 0 },
+    { "posCovEE", 28, UBX_MSGDB_R4, 1, 0, 143, 0 },
+    { "posCovED", 32, UBX_MSGDB_R4, 1, 0, 143, 0 },
+    { "posCovDD", 36, UBX_MSGDB_R4, 1, 0, 143, 0 },
+    { "velCovNN", 40, UBX_MSGDB_R4, 1, 0, 143, 0 },
+    { "velCovNE", 44, UBX_MSGDB_R4, 1, 0, 143, 0 },
+    { "velCovND", 48, UBX_MSGDB_R4, 1, 0, 143, 0 },
+    { "velCovEE", 52, UBX_MSGDB_R4, 1, 0, 143, 0 },
+    { "velCovED", 56, UBX_MSGDB_R4, 1, 0, 143, 0 },  // 350
+    { "velCovDD", 60, UBX_MSGDB_R4, 1, 0, 143, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 143, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 143, 0 },
+    { "status", 5, UBX_MSGDB_U1, 1, 0, 143, 0 },
+    { "numFences", 6, UBX_MSGDB_U1, 1, 0, 143, 0 },
+    { "combState", 7, UBX_MSGDB_U1, 1, 0, 143, 0 },
+    { "state", 0, UBX_MSGDB_U1, 1, 0, 143, 0 },
+    { "id", 1, UBX_MSGDB_U1, 1, 0, 143, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 143, 0 },
+    { "age", 4, UBX_MSGDB_I4, 1, 0, 143, 0 },
+    { "baseId", 8, UBX_MSGDB_I2, 1, 0, 143, 0 },
+    { "baseHealth", 10, UBX_MSGDB_I2, 1, 0, 143, 0 },
+    { "numMeas", 12, UBX_MSGDB_U1, 1, 0, 143, 0 },
+    { "status", 13, UBX_MSGDB_U1, 1, 0, 143, 0 },
+    { "reserved0", 14, UBX_MSGDB_U1, 2, 1, 143, 0 },
+    { "gnssId", 0, UBX_MSGDB_U1, 1, 0, 143, 0 },
+    { "svId", 1, UBX_MSGDB_U1, 1, 0, 143, 0 },
+    { "sigId", 2, UBX_MSGDB_U1, 1, 0, 143, 0 },
+    { "flags", 3, UBX_MSGDB_X1, 1, 0, 143, 3 },
+    { "ageC", 4, UBX_MSGDB_U2, 1, 0, 146, 0 },
+    { "reserved1", 6, UBX_MSGDB_U1, 2, 1, 146, 0 },
+    { "prc", 8, UBX_MSGDB_R4, 1, 0, 146, 0 },
+    { "prrc", 12, UBX_MSGDB_R4, 1, 0, 146, 0 },
+    { "cr", 16, UBX_MSGDB_R4, 1, 0, 146, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 146, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 146, 0 },
+    { "iTOW", 4, UBX_MSGDB_U4, 1, 0, 146, 0 },
+    { "dur", 8, UBX_MSGDB_U4, 1, 0, 146, 0 },
+    { "meanX", 12, UBX_MSGDB_I4, 1, 0, 146, 0 },
+    { "meanY", 16, UBX_MSGDB_I4, 1, 0, 146, 0 },
+    { "meanZ", 20, UBX_MSGDB_I4, 1, 0, 146, 0 },
+    { "meanXHP", 24, UBX_MSGDB_I1, 1, 0, 146, 0 },
+    { "meanYHP", 25, UBX_MSGDB_I1, 1, 0, 146, 0 },
+    { "meanZHP", 26, UBX_MSGDB_I1, 1, 0, 146, 0 },
+    { "reserved1", 27, UBX_MSGDB_U1, 1, 1, 146, 0 },
+    { "meanAcc", 28, UBX_MSGDB_U4, 1, 0, 146, 0 },
+    { "obs", 32, UBX_MSGDB_U4, 1, 0, 146, 0 },
+    { "valid", 36, UBX_MSGDB_U1, 1, 0, 146, 0 },
+    { "active", 37, UBX_MSGDB_U1, 1, 0, 146, 0 },
+    { "reserved2", 38, UBX_MSGDB_U1, 2, 1, 146, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 146, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 1, 1, 146, 0 },
+    { "refStationId", 2, UBX_MSGDB_U2, 1, 0, 146, 0 },
+    { "iTOW", 4, UBX_MSGDB_U4, 1, 0, 146, 0 },
+    { "relPosN", 8, UBX_MSGDB_I4, 1, 0, 146, 0 },
+    { "relPosE", 12, UBX_MSGDB_I4, 1, 0, 146, 0 },
+    { "relPosD", 16, UBX_MSGDB_I4, 1, 0, 146, 0 },
+    { "relPosHPN", 20, UBX_MSGDB_I1, 1, 0, 146, 0 },
+    { "relPosHPE", 21, UBX_MSGDB_I1, 1, 0, 146, 0 },
+    { "relPosHPD", 22, UBX_MSGDB_I1, 1, 0, 146, 0 },  // 400
+    { "reserved1", 23, UBX_MSGDB_U1, 1, 1, 146, 0 },
+    { "accN", 24, UBX_MSGDB_U4, 1, 0, 146, 0 },
+    { "accE", 28, UBX_MSGDB_U4, 1, 0, 146, 0 },
+    { "accD", 32, UBX_MSGDB_U4, 1, 0, 146, 0 },
+    { "flags", 36, UBX_MSGDB_X4, 1, 0, 146, 7 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 153, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 1, 1, 153, 0 },
+    { "refStationId", 2, UBX_MSGDB_U2, 1, 0, 153, 0 },
+    { "iTOW", 4, UBX_MSGDB_U4, 1, 0, 153, 0 },
+    { "relPosN", 8, UBX_MSGDB_I4, 1, 0, 153, 0 },
+    { "relPosE", 12, UBX_MSGDB_I4, 1, 0, 153, 0 },
+    { "relPosD", 16, UBX_MSGDB_I4, 1, 0, 153, 0 },
+    { "relPosLength", 20, UBX_MSGDB_I4, 1, 0, 153, 0 },
+    { "relPosHeading", 24, UBX_MSGDB_I4, 1, 0, 153, 0 },
+    { "reserved1", 28, UBX_MSGDB_U1, 4, 1, 153, 0 },
+    { "relPosHPN", 32, UBX_MSGDB_I1, 1, 0, 153, 0 },
+    { "relPosHPE", 33, UBX_MSGDB_I1, 1, 0, 153, 0 },
+    { "relPosHPD", 34, UBX_MSGDB_I1, 1, 0, 153, 0 },
+    { "relPosHPLength", 35, UBX_MSGDB_I1, 1, 0, 153, 0 },
+    { "accN", 36, UBX_MSGDB_U4, 1, 0, 153, 0 },
+    { "accE", 40, UBX_MSGDB_U4, 1, 0, 153, 0 },
+    { "accD", 44, UBX_MSGDB_U4, 1, 0, 153, 0 },
+    { "accLength", 48, UBX_MSGDB_U4, 1, 0, 153, 0 },
+    { "accHeading", 52, UBX_MSGDB_U4, 1, 0, 153, 0 },
+    { "reserved2", 56, UBX_MSGDB_U1, 4, 1, 153, 0 },
+    { "flags", 60, UBX_MSGDB_X4, 1, 0, 153, 9 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 162, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 162, 0 },
+    { "reserved0", 5, UBX_MSGDB_U1, 1, 1, 162, 0 },
+    { "errEllipseOrient", 6, UBX_MSGDB_U2, 1, 0, 162, 0 },
+    { "errEllipseMajor", 8, UBX_MSGDB_U4, 1, 0, 162, 0 },
+    { "errEllipseMinor", 12, UBX_MSGDB_U4, 1, 0, 162, 0 },
+    { "pulses", 0, UBX_MSGDB_I4, 1, 0, 162, 0 },
+    { "period", 4, UBX_MSGDB_I4, 1, 0, 162, 0 },
+    { "gyroMean", 8, UBX_MSGDB_U4, 1, 0, 162, 0 },
+    { "temperature", 12, UBX_MSGDB_I2, 1, 0, 162, 0 },
+    { "direction", 14, UBX_MSGDB_I1, 1, 0, 162, 0 },
+    { "calibStatus", 15, UBX_MSGDB_X1, 1, 0, 162, 3 },
+    { "pulseScale", 16, UBX_MSGDB_I4, 1, 0, 165, 0 },
+    { "gyroBias", 20, UBX_MSGDB_I4, 1, 0, 165, 0 },
+    { "gyroScale", 24, UBX_MSGDB_I4, 1, 0, 165, 0 },
+    { "accPulseScale", 28, UBX_MSGDB_I2, 1, 0, 165, 0 },
+    { "accGyroBias", 30, UBX_MSGDB_I2, 1, 0, 165, 0 },
+    { "accGyroScale", 32, UBX_MSGDB_I2, 1, 0, 165, 0 },
+    { "measUsed", 34, UBX_MSGDB_X1, 1, 0, 165, 8 },
+    { "reserved0", 35, UBX_MSGDB_U1, 1, 1, 173, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 173, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 173, 0 },
+    { "reserved0", 5, UBX_MSGDB_U1, 3, 1, 173, 0 },
+    { "gmsLon", 8, UBX_MSGDB_I4, 1, 0, 173, 0 },  // 450
+    { "gmsLat", 12, UBX_MSGDB_I4, 1, 0, 173, 0 },
+    { "gmsCode", 16, UBX_MSGDB_U1, 1, 0, 173, 0 },
+    { "qzssSvId", 17, UBX_MSGDB_U1, 1, 0, 173, 0 },
+    { "serviceFlags", 18, UBX_MSGDB_X1, 1, 0, 173, 3 },
+    { "cnt", 19, UBX_MSGDB_U1, 1, 0, 176, 0 },
+    { "gnssId", 0, UBX_MSGDB_U1, 1, 0, 176, 0 },
+    { "svId", 1, UBX_MSGDB_U1, 1, 0, 176, 0 },
+    { "reserved1", 2, UBX_MSGDB_U1, 1, 1, 176, 0 },
+    { "reserved2", 3, UBX_MSGDB_U1, 3, 1, 176, 0 },
+    { "prc", 6, UBX_MSGDB_I2, 1, 0, 176, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 176, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 176, 0 },
+    { "numSigs", 5, UBX_MSGDB_U1, 1, 0, 176, 0 },
+    { "reserved0", 6, UBX_MSGDB_U1, 2, 1, 176, 0 },
+    { "gnssId", 0, UBX_MSGDB_U1, 1, 0, 176, 0 },
+    { "svId", 1, UBX_MSGDB_U1, 1, 0, 176, 0 },
+    { "sigId", 2, UBX_MSGDB_U1, 1, 0, 176, 0 },
+    { "freqId", 3, UBX_MSGDB_U1, 1, 0, 176, 0 },
+    { "prRes", 4, UBX_MSGDB_I2, 1, 0, 176, 0 },
+    { "cno", 6, UBX_MSGDB_U1, 1, 0, 176, 0 },
+    { "qualityInd", 7, UBX_MSGDB_U1, 1, 0, 176, 0 },
+    { "corrSource", 8, UBX_MSGDB_U1, 1, 0, 176, 0 },
+    { "ionoModel", 9, UBX_MSGDB_U1, 1, 0, 176, 0 },
+    { "sigFlags", 10, UBX_MSGDB_X2, 1, 0, 176, 9 },
+    { "reserved1", 12, UBX_MSGDB_U1, 4, 1, 185, 0 },
+    { "numTx", 0, UBX_MSGDB_U1, 1, 0, 185, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 185, 0 },
+    { "txid", 0, UBX_MSGDB_U1, 1, 0, 185, 0 },
+    { "cno", 1, UBX_MSGDB_U1, 1, 0, 185, 0 },
+    { "quality", 2, UBX_MSGDB_X1, 1, 0, 185, 1 },
+    { "reserved1", 3, UBX_MSGDB_U1, 1, 1, 186, 0 },
+    { "doppler", 4, UBX_MSGDB_I4, 1, 0, 186, 0 },
+    { "position1_1", 8, UBX_MSGDB_X4, 1, 0, 186, 2 },
+    { "position1_2", 12, UBX_MSGDB_X4, 1, 0, 188, 2 },
+    { "position2_1", 16, UBX_MSGDB_X4, 1, 0, 190, 3 },
+    { "lat", 20, UBX_MSGDB_I4, 1, 0, 193, 0 },
+    { "lon", 24, UBX_MSGDB_I4, 1, 0, 193, 0 },
+    { "shortIdFrame", 28, UBX_MSGDB_X4, 1, 0, 193, 3 },
+    { "mediumIdLSB", 32, UBX_MSGDB_U4, 1, 0, 196, 0 },
+    { "mediumId_2", 36, UBX_MSGDB_X4, 1, 0, 196, 3 },
+    { "numTx", 0, UBX_MSGDB_U1, 1, 0, 199, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 199, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 199, 0 },
+    { "gnssId", 0, UBX_MSGDB_U1, 1, 0, 199, 0 },
+    { "svId", 1, UBX_MSGDB_U1, 1, 0, 199, 0 },
+    { "signalId", 2, UBX_MSGDB_U1, 1, 0, 199, 0 },
+    { "reserved1", 3, UBX_MSGDB_U1, 2, 1, 199, 0 },
+    { "cno", 5, UBX_MSGDB_U1, 1, 0, 199, 0 },
+    { "quality", 6, UBX_MSGDB_X1, 1, 0, 199, 1 },
+    { "reserved2", 7, UBX_MSGDB_U1, 1, 1, 200, 0 },  // 500
+    { "doppler", 8, UBX_MSGDB_I4, 1, 0, 200, 0 },
+    { "position1_1", 12, UBX_MSGDB_X4, 1, 0, 200, 2 },
+    { "position1_2", 16, UBX_MSGDB_X4, 1, 0, 202, 2 },
+    { "position2_1", 20, UBX_MSGDB_X4, 1, 0, 204, 4 },
+    { "lat", 24, UBX_MSGDB_I4, 1, 0, 208, 0 },
+    { "lon", 28, UBX_MSGDB_I4, 1, 0, 208, 0 },
+    { "shortIdFrame", 32, UBX_MSGDB_X4, 1, 0, 208, 3 },
+    { "mediumIdLSB", 36, UBX_MSGDB_U4, 1, 0, 211, 0 },
+    { "mediumId_2", 40, UBX_MSGDB_X4, 1, 0, 211, 3 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 214, 0 },
+    { "aopCfg", 4, UBX_MSGDB_U1, 1, 0, 214, 1 },
+    { "status", 5, UBX_MSGDB_U1, 1, 0, 215, 0 },
+    { "reserved0", 6, UBX_MSGDB_U1, 2, 1, 215, 0 },
+    { "availGPS", 8, UBX_MSGDB_U4, 1, 0, 215, 0 },
+    { "availGLO", 12, UBX_MSGDB_U4, 1, 0, 215, 0 },
+    { "reserved1", 16, UBX_MSGDB_U1, 4, 1, 215, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 215, 0 },
+    { "aopCfg", 4, UBX_MSGDB_U1, 1, 0, 215, 1 },
+    { "status", 5, UBX_MSGDB_U1, 1, 0, 216, 0 },
+    { "reserved0", 6, UBX_MSGDB_U1, 10, 1, 216, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 216, 0 },
+    { "msgVersion", 0, UBX_MSGDB_U1, 1, 0, 216, 0 },
+    { "tmirCoeff", 1, UBX_MSGDB_U1, 1, 0, 216, 0 },
+    { "tmirExp", 2, UBX_MSGDB_I1, 1, 0, 216, 0 },
+    { "plPosValid", 3, UBX_MSGDB_U1, 1, 0, 216, 0 },
+    { "plPosFrame", 4, UBX_MSGDB_U1, 1, 0, 216, 0 },
+    { "plVelValid", 5, UBX_MSGDB_U1, 1, 0, 216, 0 },
+    { "plVelFrame", 6, UBX_MSGDB_U1, 1, 0, 216, 0 },
+    { "plTimeValid", 7, UBX_MSGDB_U1, 1, 0, 216, 0 },
+    { "plPosInvalidityReason", 8, UBX_MSGDB_U1, 1, 0, 216, 0 },
+    { "plVelInvalidityReason", 9, UBX_MSGDB_U1, 1, 0, 216, 0 },
+    { "plTimeInvalidityReason", 10, UBX_MSGDB_U1, 1, 0, 216, 0 },
+    { "reserved0", 11, UBX_MSGDB_U1, 1, 1, 216, 0 },
+    { "iTow", 12, UBX_MSGDB_U4, 1, 0, 216, 0 },
+    { "plPos1", 16, UBX_MSGDB_U4, 1, 0, 216, 0 },
+    { "plPos2", 20, UBX_MSGDB_U4, 1, 0, 216, 0 },
+    { "plPos3", 24, UBX_MSGDB_U4, 1, 0, 216, 0 },
+    { "plVel1", 28, UBX_MSGDB_U4, 1, 0, 216, 0 },
+    { "plVel2", 32, UBX_MSGDB_U4, 1, 0, 216, 0 },
+    { "plVel3", 36, UBX_MSGDB_U4, 1, 0, 216, 0 },
+    { "plPosHorizOrient", 40, UBX_MSGDB_U2, 1, 0, 216, 0 },
+    { "plVelHorizOrient", 42, UBX_MSGDB_U2, 1, 0, 216, 0 },
+    { "plTime", 44, UBX_MSGDB_U4, 1, 0, 216, 0 },
+    { "reserved1", 48, UBX_MSGDB_U1, 4, 1, 216, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 216, 0 },
+    { "NavICTow", 4, UBX_MSGDB_U4, 1, 0, 216, 0 },
+    { "fNavICTow", 8, UBX_MSGDB_I4, 1, 0, 216, 0 },
+    { "NavICWno", 12, UBX_MSGDB_I2, 1, 0, 216, 0 },
+    { "leapS", 14, UBX_MSGDB_I1, 1, 0, 216, 0 },
+    { "valid", 15, UBX_MSGDB_X1, 1, 0, 216, 3 },  // 550
+    { "tAcc", 16, UBX_MSGDB_U4, 1, 0, 219, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 219, 0 },
+    { "refSys", 1, UBX_MSGDB_U1, 1, 0, 219, 0 },
+    { "valid", 2, UBX_MSGDB_X1, 1, 0, 219, 2 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 221, 0 },
+    { "iTOW", 4, UBX_MSGDB_U4, 1, 0, 221, 0 },
+    { "iniWno", 8, UBX_MSGDB_U2, 1, 0, 221, 0 },
+    { "propWno", 10, UBX_MSGDB_U2, 1, 0, 221, 0 },
+    { "iniTow", 12, UBX_MSGDB_U4, 1, 0, 221, 0 },
+    { "propTow", 16, UBX_MSGDB_U4, 1, 0, 221, 0 },
+    { "iniTAcc", 20, UBX_MSGDB_U4, 1, 0, 221, 0 },
+    { "propTAcc", 24, UBX_MSGDB_U4, 1, 0, 221, 0 },
+    { "deltaS", 28, UBX_MSGDB_I4, 1, 0, 221, 0 },
+    { "deltaMs", 32, UBX_MSGDB_I4, 1, 0, 221, 0 },
+    { "reserved1", 36, UBX_MSGDB_U1, 4, 1, 221, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 221, 0 },
+    { "ecefX", 4, UBX_MSGDB_I4, 1, 0, 221, 0 },
+    { "ecefY", 8, UBX_MSGDB_I4, 1, 0, 221, 0 },
+    { "ecefZ", 12, UBX_MSGDB_I4, 1, 0, 221, 0 },
+    { "lat", 16, UBX_MSGDB_I4, 1, 0, 221, 0 },
+    { "lon", 20, UBX_MSGDB_I4, 1, 0, 221, 0 },
+    { "height", 24, UBX_MSGDB_I4, 1, 0, 221, 0 },
+    { "cfb2d", 28, UBX_MSGDB_U4, 1, 0, 221, 0 },
+    { "cfb3d", 32, UBX_MSGDB_U4, 1, 0, 221, 0 },
+    { "cfb2d_int", 36, UBX_MSGDB_U1, 1, 0, 221, 0 },
+    { "cfb3d_int", 37, UBX_MSGDB_U1, 1, 0, 221, 0 },
+    { "svs", 38, UBX_MSGDB_U1, 1, 0, 221, 0 },
+    { "flags", 39, UBX_MSGDB_X1, 1, 0, 221, 2 },
+    { "rcvTow", 0, UBX_MSGDB_I4, 1, 0, 223, 0 },
+    { "week", 4, UBX_MSGDB_I2, 1, 0, 223, 0 },
+    { "numSV", 6, UBX_MSGDB_U1, 1, 0, 223, 0 },
+    { "reserved0", 7, UBX_MSGDB_U1, 1, 1, 223, 0 },
+    { "cpMes", 0, UBX_MSGDB_R8, 1, 0, 223, 0 },
+    { "prMes", 8, UBX_MSGDB_R8, 1, 0, 223, 0 },
+    { "doMes", 16, UBX_MSGDB_R4, 1, 0, 223, 0 },
+    { "sv", 20, UBX_MSGDB_U1, 1, 0, 223, 0 },
+    { "mesQI", 21, UBX_MSGDB_I1, 1, 0, 223, 0 },
+    { "cno", 22, UBX_MSGDB_I1, 1, 0, 223, 0 },
+    { "lli", 23, UBX_MSGDB_U1, 1, 0, 223, 0 },
+    { "chn", 0, UBX_MSGDB_U1, 1, 0, 223, 0 },
+    { "svid", 1, UBX_MSGDB_U1, 1, 0, 223, 0 },
+    { "dwrd", 2, UBX_MSGDB_X4, 10, 0, 223, 0 },
+    { "txid", 0, UBX_MSGDB_U1, 1, 0, 223, 0 },
+    { "gnssId", 1, UBX_MSGDB_U1, 1, 0, 223, 0 },
+    { "numWords", 2, UBX_MSGDB_U1, 1, 0, 223, 0 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 223, 0 },
+    { "dwrd", 0, UBX_MSGDB_U4, 1, 0, 223, 0 },
+    { "gnssId", 0, UBX_MSGDB_U1, 1, 0, 223, 0 },
+    { "svId", 1, UBX_MSGDB_U1, 1, 0, 223, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 1, 1, 223, 0 },  // 600
+    { "freqId", 3, UBX_MSGDB_U1, 1, 0, 223, 0 },
+    { "numWords", 4, UBX_MSGDB_U1, 1, 0, 223, 0 },
+    { "reserved1", 5, UBX_MSGDB_U1, 1, 1, 223, 0 },
+    { "version", 6, UBX_MSGDB_U1, 1, 0, 223, 0 },
+    { "reserved2", 7, UBX_MSGDB_U1, 1, 1, 223, 0 },
+    { "dwrd", 0, UBX_MSGDB_U4, 1, 0, 223, 0 },
+    { "gnssId", 0, UBX_MSGDB_U1, 1, 0, 223, 0 },
+    { "svId", 1, UBX_MSGDB_U1, 1, 0, 223, 0 },
+    { "sigId", 2, UBX_MSGDB_U1, 1, 0, 223, 0 },
+    { "freqId", 3, UBX_MSGDB_U1, 1, 0, 223, 0 },
+    { "numWords", 4, UBX_MSGDB_U1, 1, 0, 223, 0 },
+    { "chn", 5, UBX_MSGDB_U1, 1, 0, 223, 0 },
+    { "version", 6, UBX_MSGDB_U1, 1, 0, 223, 0 },
+    { "reserved0", 7, UBX_MSGDB_U1, 1, 1, 223, 0 },
+    { "dwrd", 0, UBX_MSGDB_U4, 1, 0, 223, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 223, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 223, 0 },
+    { "gpsTOW", 4, UBX_MSGDB_U4, 1, 0, 223, 0 },
+    { "gloTOW", 8, UBX_MSGDB_U4, 1, 0, 223, 0 },
+    { "bdsTOW", 12, UBX_MSGDB_U4, 1, 0, 223, 0 },
+    { "reserved1", 16, UBX_MSGDB_U1, 4, 1, 223, 0 },
+    { "qzssTOW", 20, UBX_MSGDB_U4, 1, 0, 223, 0 },
+    { "gpsTOWacc", 24, UBX_MSGDB_U2, 1, 0, 223, 0 },
+    { "gloTOWacc", 26, UBX_MSGDB_U2, 1, 0, 223, 0 },
+    { "bdsTOWacc", 28, UBX_MSGDB_U2, 1, 0, 223, 0 },
+    { "reserved2", 30, UBX_MSGDB_U1, 2, 1, 223, 0 },
+    { "qzssTOWacc", 32, UBX_MSGDB_U2, 1, 0, 223, 0 },
+    { "numSV", 34, UBX_MSGDB_U1, 1, 0, 223, 0 },
+    { "flags", 35, UBX_MSGDB_U1, 1, 0, 223, 1 },
+    { "reserved3", 36, UBX_MSGDB_U1, 8, 1, 224, 0 },
+    { "gnssId", 0, UBX_MSGDB_U1, 1, 0, 224, 0 },
+    { "svId", 1, UBX_MSGDB_U1, 1, 0, 224, 0 },
+    { "cNo", 2, UBX_MSGDB_U1, 1, 0, 224, 0 },
+    { "mpathIndic", 3, UBX_MSGDB_U1, 1, 0, 224, 0 },
+    { "dopplerMS", 4, UBX_MSGDB_I4, 1, 0, 224, 0 },
+    { "dopplerHz", 8, UBX_MSGDB_I4, 1, 0, 224, 0 },
+    { "wholeChips", 12, UBX_MSGDB_U2, 1, 0, 224, 0 },
+    { "fracChips", 14, UBX_MSGDB_U2, 1, 0, 224, 0 },
+    { "codePhase", 16, UBX_MSGDB_U4, 1, 0, 224, 0 },
+    { "intCodePhase", 20, UBX_MSGDB_U1, 1, 0, 224, 0 },
+    { "pseuRangeRMSErr", 21, UBX_MSGDB_U1, 1, 0, 224, 0 },
+    { "reserved4", 22, UBX_MSGDB_U1, 2, 1, 224, 0 },
+    { "rcvTow", 0, UBX_MSGDB_R8, 1, 0, 224, 0 },
+    { "week", 8, UBX_MSGDB_U2, 1, 0, 224, 0 },
+    { "leapS", 10, UBX_MSGDB_I1, 1, 0, 224, 0 },
+    { "numMeas", 11, UBX_MSGDB_U1, 1, 0, 224, 0 },
+    { "recStat", 12, UBX_MSGDB_X1, 1, 0, 224, 2 },
+    { "reserved0", 13, UBX_MSGDB_U1, 3, 1, 226, 0 },
+    { "prMes", 0, UBX_MSGDB_R8, 1, 0, 226, 0 },
+    { "cpMes", 8, UBX_MSGDB_R8, 1, 0, 226, 0 },  // 650
+    { "doMes", 16, UBX_MSGDB_R4, 1, 0, 226, 0 },
+    { "gnssId", 20, UBX_MSGDB_U1, 1, 0, 226, 0 },
+    { "svId", 21, UBX_MSGDB_U1, 1, 0, 226, 0 },
+    { "reserved1", 22, UBX_MSGDB_U1, 1, 1, 226, 0 },
+    { "freqId", 23, UBX_MSGDB_U1, 1, 0, 226, 0 },
+    { "locktime", 24, UBX_MSGDB_U2, 1, 0, 226, 0 },
+    { "cno", 26, UBX_MSGDB_U1, 1, 0, 226, 0 },
+    { "prStdev", 27, UBX_MSGDB_X1, 1, 0, 226, 1 },
+    { "cpStdev", 28, UBX_MSGDB_X1, 1, 0, 227, 1 },
+    { "doStdev", 29, UBX_MSGDB_X1, 1, 0, 228, 1 },
+    { "trkStat", 30, UBX_MSGDB_X1, 1, 0, 229, 4 },
+    { "reserved2", 31, UBX_MSGDB_U1, 1, 1, 233, 0 },
+    { "rcvTow", 0, UBX_MSGDB_R8, 1, 0, 233, 0 },
+    { "week", 8, UBX_MSGDB_U2, 1, 0, 233, 0 },
+    { "leapS", 10, UBX_MSGDB_I1, 1, 0, 233, 0 },
+    { "numMeas", 11, UBX_MSGDB_U1, 1, 0, 233, 0 },
+    { "recStat", 12, UBX_MSGDB_X1, 1, 0, 233, 2 },
+    { "version", 13, UBX_MSGDB_U1, 1, 0, 235, 0 },
+    { "reserved0", 14, UBX_MSGDB_U1, 2, 1, 235, 0 },
+    { "prMes", 0, UBX_MSGDB_R8, 1, 0, 235, 0 },
+    { "cpMes", 8, UBX_MSGDB_R8, 1, 0, 235, 0 },
+    { "doMes", 16, UBX_MSGDB_R4, 1, 0, 235, 0 },
+    { "gnssId", 20, UBX_MSGDB_U1, 1, 0, 235, 0 },
+    { "svId", 21, UBX_MSGDB_U1, 1, 0, 235, 0 },
+    { "sigId", 22, UBX_MSGDB_U1, 1, 0, 235, 0 },
+    { "freqId", 23, UBX_MSGDB_U1, 1, 0, 235, 0 },
+    { "locktime", 24, UBX_MSGDB_U2, 1, 0, 235, 0 },
+    { "cno", 26, UBX_MSGDB_U1, 1, 0, 235, 0 },
+    { "prStdev", 27, UBX_MSGDB_X1, 1, 0, 235, 1 },
+    { "cpStdev", 28, UBX_MSGDB_X1, 1, 0, 236, 1 },
+    { "doStdev", 29, UBX_MSGDB_X1, 1, 0, 237, 1 },
+    { "trkStat", 30, UBX_MSGDB_X1, 1, 0, 238, 4 },
+    { "reserved1", 31, UBX_MSGDB_U1, 1, 1, 242, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 242, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 242, 0 },
+    { "gpsTOW", 4, UBX_MSGDB_U4, 1, 0, 242, 0 },
+    { "gloTOW", 8, UBX_MSGDB_U4, 1, 0, 242, 0 },
+    { "bdsTOW", 12, UBX_MSGDB_U4, 1, 0, 242, 0 },
+    { "reserved1", 16, UBX_MSGDB_U1, 4, 1, 242, 0 },
+    { "qzssTOW", 20, UBX_MSGDB_U4, 1, 0, 242, 0 },
+    { "gpsTOWacc", 24, UBX_MSGDB_U2, 1, 0, 242, 0 },
+    { "gloTOWacc", 26, UBX_MSGDB_U2, 1, 0, 242, 0 },
+    { "bdsTOWacc", 28, UBX_MSGDB_U2, 1, 0, 242, 0 },
+    { "reserved2", 30, UBX_MSGDB_U1, 2, 1, 242, 0 },
+    { "qzssTOWacc", 32, UBX_MSGDB_U2, 1, 0, 242, 0 },
+    { "numSV", 34, UBX_MSGDB_U1, 1, 0, 242, 0 },
+    { "flags", 35, UBX_MSGDB_U1, 1, 0, 242, 1 },
+    { "reserved3", 36, UBX_MSGDB_U1, 8, 1, 243, 0 },
+    { "gnssId", 0, UBX_MSGDB_U1, 1, 0, 243, 0 },
+    { "svId", 1, UBX_MSGDB_U1, 1, 0, 243, 0 },  // 700
+    { "sigId", 2, UBX_MSGDB_U1, 1, 0, 243, 0 },
+    { "cNo", 3, UBX_MSGDB_U1, 1, 0, 243, 0 },
+    { "dopplerMS", 4, UBX_MSGDB_I4, 1, 0, 243, 0 },
+    { "dopplerHz", 8, UBX_MSGDB_I4, 1, 0, 243, 0 },
+    { "mpathIndic", 12, UBX_MSGDB_U1, 1, 0, 243, 0 },
+    { "pseuRangeRMSErr", 13, UBX_MSGDB_U1, 1, 0, 243, 0 },
+    { "fracChips", 14, UBX_MSGDB_U2, 1, 0, 243, 0 },
+    { "wholeChips", 16, UBX_MSGDB_U4, 1, 0, 243, 0 },
+    { "codePhase", 20, UBX_MSGDB_U4, 1, 0, 243, 0 },
+    { "intCodePhase", 24, UBX_MSGDB_U2, 1, 0, 243, 0 },
+    { "reserved4", 26, UBX_MSGDB_U1, 2, 1, 243, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 243, 0 },
+    { "week", 4, UBX_MSGDB_I2, 1, 0, 243, 0 },
+    { "numVis", 6, UBX_MSGDB_U1, 1, 0, 243, 0 },
+    { "numSV", 7, UBX_MSGDB_U1, 1, 0, 243, 0 },
+    { "svid", 0, UBX_MSGDB_U1, 1, 0, 243, 0 },
+    { "svFlag", 1, UBX_MSGDB_X1, 1, 0, 243, 5 },
+    { "azim", 2, UBX_MSGDB_I2, 1, 0, 248, 0 },
+    { "elev", 4, UBX_MSGDB_I1, 1, 0, 248, 0 },
+    { "age", 5, UBX_MSGDB_X1, 1, 0, 248, 2 },
+    { "svid", 0, UBX_MSGDB_U1, 1, 0, 250, 0 },
+    { "svid", 0, UBX_MSGDB_U4, 1, 0, 250, 0 },
+    { "week", 4, UBX_MSGDB_U4, 1, 0, 250, 0 },
+    { "dwrd", 0, UBX_MSGDB_U4, 8, 0, 250, 0 },
+    { "svid", 0, UBX_MSGDB_U1, 1, 0, 250, 0 },
+    { "svid", 0, UBX_MSGDB_U4, 1, 0, 250, 0 },
+    { "how", 4, UBX_MSGDB_U4, 1, 0, 250, 0 },
+    { "sf1d", 0, UBX_MSGDB_U4, 8, 0, 250, 0 },
+    { "sf2d", 32, UBX_MSGDB_U4, 8, 0, 250, 0 },
+    { "sf3d", 64, UBX_MSGDB_U4, 8, 0, 250, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 250, 0 },
+    { "flags", 1, UBX_MSGDB_X1, 1, 0, 250, 2 },
+    { "subType", 2, UBX_MSGDB_U2, 1, 0, 252, 0 },
+    { "refStation", 4, UBX_MSGDB_U2, 1, 0, 252, 0 },
+    { "msgType", 6, UBX_MSGDB_U2, 1, 0, 252, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 252, 0 },
+    { "flags", 1, UBX_MSGDB_X1, 1, 0, 252, 1 },
+    { "subType", 2, UBX_MSGDB_U2, 1, 0, 253, 0 },
+    { "reserved0", 4, UBX_MSGDB_U1, 2, 1, 253, 0 },
+    { "msgType", 6, UBX_MSGDB_U2, 1, 0, 253, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 253, 0 },
+    { "ebno", 1, UBX_MSGDB_U1, 1, 0, 253, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 1, 1, 253, 0 },
+    { "reserved1", 3, UBX_MSGDB_U1, 1, 1, 253, 0 },
+    { "statusInfo", 4, UBX_MSGDB_X4, 1, 0, 253, 9 },
+    { "msgType", 8, UBX_MSGDB_U2, 1, 0, 262, 0 },
+    { "msgSubType", 10, UBX_MSGDB_U2, 1, 0, 262, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 262, 0 },
+    { "numKeys", 1, UBX_MSGDB_U1, 1, 0, 262, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 262, 0 },  // 750
+    { "reserved1", 0, UBX_MSGDB_U1, 1, 1, 262, 0 },
+    { "keyLengthBytes", 1, UBX_MSGDB_U1, 1, 0, 262, 0 },
+    { "validFromWno", 2, UBX_MSGDB_U2, 1, 0, 262, 0 },
+    { "validFromTow", 4, UBX_MSGDB_U4, 1, 0, 262, 0 },
+    { "key", 0, UBX_MSGDB_U1, 1, 0, 262, 0 },
+    { "duration", 0, UBX_MSGDB_U4, 1, 0, 262, 0 },
+    { "flags", 4, UBX_MSGDB_X4, 1, 0, 262, 1 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 263, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 263, 0 },
+    { "duration", 4, UBX_MSGDB_U4, 1, 0, 263, 0 },
+    { "flags", 8, UBX_MSGDB_X4, 1, 0, 263, 2 },
+    { "wakeupSources", 12, UBX_MSGDB_X4, 1, 0, 265, 4 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 269, 0 },
+    { "type", 1, UBX_MSGDB_U1, 1, 0, 269, 0 },
+    { "svId", 2, UBX_MSGDB_U1, 1, 0, 269, 0 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 269, 0 },
+    { "beacon", 4, UBX_MSGDB_U1, 8, 0, 269, 0 },
+    { "message", 12, UBX_MSGDB_U1, 1, 0, 269, 0 },
+    { "params", 13, UBX_MSGDB_U1, 2, 0, 269, 0 },
+    { "reserved1", 15, UBX_MSGDB_U1, 1, 1, 269, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 269, 0 },
+    { "type", 1, UBX_MSGDB_U1, 1, 0, 269, 0 },
+    { "svId", 2, UBX_MSGDB_U1, 1, 0, 269, 0 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 269, 0 },
+    { "beacon", 4, UBX_MSGDB_U1, 8, 0, 269, 0 },
+    { "message", 12, UBX_MSGDB_U1, 1, 0, 269, 0 },
+    { "params", 13, UBX_MSGDB_U1, 12, 0, 269, 0 },
+    { "reserved1", 25, UBX_MSGDB_U1, 3, 1, 269, 0 },
+    { "numTx", 0, UBX_MSGDB_U1, 1, 0, 269, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 269, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 269, 0 },
+    { "reserved1", 0, UBX_MSGDB_U1, 1, 1, 269, 0 },
+    { "txId", 1, UBX_MSGDB_U1, 1, 0, 269, 0 },
+    { "reserved2", 2, UBX_MSGDB_U1, 3, 1, 269, 0 },
+    { "cno", 5, UBX_MSGDB_U1, 1, 0, 269, 0 },
+    { "reserved3", 6, UBX_MSGDB_U1, 2, 1, 269, 0 },
+    { "doppler", 8, UBX_MSGDB_I4, 1, 0, 269, 0 },
+    { "position1_1", 12, UBX_MSGDB_X4, 1, 0, 269, 2 },
+    { "position1_2", 16, UBX_MSGDB_X4, 1, 0, 271, 2 },
+    { "position2_1", 20, UBX_MSGDB_X4, 1, 0, 273, 4 },
+    { "lat", 24, UBX_MSGDB_I4, 1, 0, 277, 0 },
+    { "lon", 28, UBX_MSGDB_I4, 1, 0, 277, 0 },
+    { "shortIdFrame", 32, UBX_MSGDB_X4, 1, 0, 277, 3 },
+    { "mediumIdLSB", 36, UBX_MSGDB_U4, 1, 0, 280, 0 },
+    { "mediumId_2", 40, UBX_MSGDB_X4, 1, 0, 280, 3 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 283, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 283, 0 },
+    { "timeTag", 4, UBX_MSGDB_U4, 1, 0, 283, 0 },
+    { "uniqueWord", 8, UBX_MSGDB_U4, 2, 0, 283, 0 },
+    { "serviceIdentifier", 16, UBX_MSGDB_U2, 1, 0, 283, 0 },  // 800
+    { "spare", 18, UBX_MSGDB_U1, 1, 0, 283, 0 },
+    { "uniqueWordBitErrors", 19, UBX_MSGDB_U1, 1, 0, 283, 0 },
+    { "userData", 20, UBX_MSGDB_U1, 504, 0, 283, 0 },
+    { "fecBits", 524, UBX_MSGDB_U2, 1, 0, 283, 0 },
+    { "ebno", 526, UBX_MSGDB_U1, 1, 0, 283, 0 },
+    { "reserved1", 527, UBX_MSGDB_U1, 1, 1, 283, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 283, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 1, 1, 283, 0 },
+    { "numBytesUserData", 2, UBX_MSGDB_U2, 1, 0, 283, 0 },
+    { "timeTag", 4, UBX_MSGDB_U4, 1, 0, 283, 0 },
+    { "uniqueWord", 8, UBX_MSGDB_U4, 2, 0, 283, 0 },
+    { "serviceIdentifier", 16, UBX_MSGDB_U2, 1, 0, 283, 0 },
+    { "spare", 18, UBX_MSGDB_U1, 1, 0, 283, 0 },
+    { "uniqueWordBitErrors", 19, UBX_MSGDB_U1, 1, 0, 283, 0 },
+    { "fecBits", 20, UBX_MSGDB_U2, 1, 0, 283, 0 },
+    { "ebno", 22, UBX_MSGDB_U1, 1, 0, 283, 0 },
+    { "reserved1", 23, UBX_MSGDB_U1, 1, 1, 283, 0 },
+    { "userData", 0, UBX_MSGDB_U1, 1, 0, 283, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 283, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 1, 1, 283, 0 },
+    { "numBytesUserData", 2, UBX_MSGDB_U2, 1, 0, 283, 0 },
+    { "timeTag", 4, UBX_MSGDB_U4, 1, 0, 283, 0 },
+    { "uniqueWord", 8, UBX_MSGDB_U4, 2, 0, 283, 0 },
+    { "serviceIdentifier", 16, UBX_MSGDB_U2, 1, 0, 283, 0 },
+    { "spare", 18, UBX_MSGDB_U1, 1, 0, 283, 0 },
+    { "uniqueWordBitErrors", 19, UBX_MSGDB_U1, 1, 0, 283, 0 },
+    { "fecBits", 20, UBX_MSGDB_U2, 1, 0, 283, 0 },
+    { "ebno", 22, UBX_MSGDB_U1, 1, 0, 283, 0 },
+    { "reserved1", 23, UBX_MSGDB_U1, 1, 1, 283, 0 },
+    { "userData", 0, UBX_MSGDB_U1, 1, 0, 283, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 283, 0 },
+    { "svId", 1, UBX_MSGDB_U1, 1, 0, 283, 0 },
+    { "cno", 2, UBX_MSGDB_U2, 1, 0, 283, 0 },
+    { "timeTag", 4, UBX_MSGDB_U4, 1, 0, 283, 0 },
+    { "groupDelay", 8, UBX_MSGDB_U1, 1, 0, 283, 0 },
+    { "bitErrCorr", 9, UBX_MSGDB_U1, 1, 0, 283, 0 },
+    { "chInfo", 10, UBX_MSGDB_X2, 1, 0, 283, 4 },
+    { "reserved0", 12, UBX_MSGDB_U1, 2, 1, 287, 0 },
+    { "msgBytes", 14, UBX_MSGDB_U1, 250, 0, 287, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 287, 0 },
+    { "svId", 1, UBX_MSGDB_U1, 1, 0, 287, 0 },
+    { "cno", 2, UBX_MSGDB_U2, 1, 0, 287, 0 },
+    { "timeTag", 4, UBX_MSGDB_U4, 1, 0, 287, 0 },
+    { "groupDelay", 8, UBX_MSGDB_U1, 1, 0, 287, 0 },
+    { "bitErrCorr", 9, UBX_MSGDB_U1, 1, 0, 287, 0 },
+    { "chInfo", 10, UBX_MSGDB_X2, 1, 0, 287, 4 },
+    { "reserved0", 12, UBX_MSGDB_U1, 2, 1, 291, 0 },
+    { "msgBytes", 14, UBX_MSGDB_U1, 250, 0, 291, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 291, 0 },
+    { "numMeas", 1, UBX_MSGDB_U1, 1, 0, 291, 0 },  // 850
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 291, 0 },
+    { "reserved1", 4, UBX_MSGDB_U1, 4, 1, 291, 0 },
+    { "edgeInfo", 0, UBX_MSGDB_X4, 1, 0, 291, 2 },
+    { "count", 4, UBX_MSGDB_U2, 1, 0, 293, 0 },
+    { "wno", 6, UBX_MSGDB_U2, 1, 0, 293, 0 },
+    { "towMs", 8, UBX_MSGDB_U4, 1, 0, 293, 0 },
+    { "towSubMsR", 12, UBX_MSGDB_U4, 1, 0, 293, 0 },
+    { "reserved2", 16, UBX_MSGDB_U1, 4, 1, 293, 0 },
+    { "reserved3", 20, UBX_MSGDB_U1, 4, 1, 293, 0 },
+    { "payload", 0, UBX_MSGDB_U1, 1, 0, 293, 0 },
+    { "payload", 0, UBX_MSGDB_U1, 1, 0, 293, 0 },
+    { "payload", 0, UBX_MSGDB_U1, 1, 0, 293, 0 },
+    { "payload", 0, UBX_MSGDB_U1, 1, 0, 293, 0 },
+    { "str", 0, UBX_MSGDB_CH, 1, 0, 293, 0 },
+    { "str", 0, UBX_MSGDB_CH, 1, 0, 293, 0 },
+    { "str", 0, UBX_MSGDB_CH, 1, 0, 293, 0 },
+    { "str", 0, UBX_MSGDB_CH, 1, 0, 293, 0 },
+    { "str", 0, UBX_MSGDB_CH, 1, 0, 293, 0 },
+    { "clsID", 0, UBX_MSGDB_U1, 1, 0, 293, 0 },
+    { "msgID", 1, UBX_MSGDB_U1, 1, 0, 293, 0 },
+    { "clsID", 0, UBX_MSGDB_U1, 1, 0, 293, 0 },
+    { "msgID", 1, UBX_MSGDB_U1, 1, 0, 293, 0 },
+    { "PortID", 0, UBX_MSGDB_U1, 1, 0, 293, 0 },
+    { "portID", 0, UBX_MSGDB_U1, 1, 0, 293, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 1, 1, 293, 0 },
+    { "txReady", 2, UBX_MSGDB_X2, 1, 0, 293, 4 },
+    { "mode", 4, UBX_MSGDB_X4, 1, 0, 297, 3 },
+    { "baudRate", 8, UBX_MSGDB_U4, 1, 0, 300, 0 },
+    { "inProtoMask", 12, UBX_MSGDB_X2, 1, 0, 300, 4 },
+    { "outProtoMask", 14, UBX_MSGDB_X2, 1, 0, 304, 3 },
+    { "flags", 16, UBX_MSGDB_X2, 1, 0, 307, 1 },
+    { "reserved1", 18, UBX_MSGDB_U1, 2, 1, 308, 0 },
+    { "portID", 0, UBX_MSGDB_U1, 1, 0, 308, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 1, 1, 308, 0 },
+    { "txReady", 2, UBX_MSGDB_X2, 1, 0, 308, 4 },
+    { "reserved1", 4, UBX_MSGDB_U1, 8, 1, 312, 0 },
+    { "inProtoMask", 12, UBX_MSGDB_X2, 1, 0, 312, 4 },
+    { "outProtoMask", 14, UBX_MSGDB_X2, 1, 0, 316, 3 },
+    { "reserved2", 16, UBX_MSGDB_U1, 2, 1, 319, 0 },
+    { "reserved3", 18, UBX_MSGDB_U1, 2, 1, 319, 0 },
+    { "portID", 0, UBX_MSGDB_U1, 1, 0, 319, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 1, 1, 319, 0 },
+    { "txReady", 2, UBX_MSGDB_X2, 1, 0, 319, 4 },
+    { "mode", 4, UBX_MSGDB_X4, 1, 0, 323, 2 },
+    { "reserved1", 8, UBX_MSGDB_U1, 4, 1, 325, 0 },
+    { "inProtoMask", 12, UBX_MSGDB_X2, 1, 0, 325, 4 },
+    { "outProtoMask", 14, UBX_MSGDB_X2, 1, 0, 329, 3 },
+    { "flags", 16, UBX_MSGDB_X2, 1, 0, 332, 1 },
+    { "reserved2", 18, UBX_MSGDB_U1, 2, 1, 333, 0 },
+    { "portID", 0, UBX_MSGDB_U1, 1, 0, 333, 0 },  // 900
+    { "reserved0", 1, UBX_MSGDB_U1, 1, 1, 333, 0 },
+    { "txReady", 2, UBX_MSGDB_X2, 1, 0, 333, 4 },
+    { "mode", 4, UBX_MSGDB_X4, 1, 0, 337, 1 },
+    { "reserved1", 8, UBX_MSGDB_U1, 4, 1, 338, 0 },
+    { "inProtoMask", 12, UBX_MSGDB_X2, 1, 0, 338, 4 },
+    { "outProtoMask", 14, UBX_MSGDB_X2, 1, 0, 342, 3 },
+    { "flags", 16, UBX_MSGDB_X2, 1, 0, 345, 1 },
+    { "reserved2", 18, UBX_MSGDB_U1, 2, 1, 346, 0 },
+    { "msgClass", 0, UBX_MSGDB_U1, 1, 0, 346, 0 },
+    { "msgID", 1, UBX_MSGDB_U1, 1, 0, 346, 0 },
+    { "msgClass", 0, UBX_MSGDB_U1, 1, 0, 346, 0 },
+    { "msgID", 1, UBX_MSGDB_U1, 1, 0, 346, 0 },
+    { "rate", 2, UBX_MSGDB_U1, 6, 0, 346, 0 },
+    { "msgClass", 0, UBX_MSGDB_U1, 1, 0, 346, 0 },
+    { "msgID", 1, UBX_MSGDB_U1, 1, 0, 346, 0 },
+    { "rate", 2, UBX_MSGDB_U1, 1, 0, 346, 0 },
+    { "protocolID", 0, UBX_MSGDB_U1, 1, 0, 346, 0 },
+    { "protocolID", 0, UBX_MSGDB_U1, 1, 0, 346, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 346, 0 },
+    { "infMsgMask", 4, UBX_MSGDB_X1, 6, 0, 346, 5 },
+    { "navBbrMask", 0, UBX_MSGDB_X2, 1, 0, 351, 13 },
+    { "resetMode", 2, UBX_MSGDB_U1, 1, 0, 364, 0 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 364, 0 },
+    { "navBbrMask", 0, UBX_MSGDB_X2, 1, 0, 364, 13 },
+    { "resetMode", 2, UBX_MSGDB_U1, 1, 0, 377, 0 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 377, 0 },
+    { "navBbrMask", 0, UBX_MSGDB_X2, 1, 0, 377, 13 },
+    { "resetMode", 2, UBX_MSGDB_U1, 1, 0, 390, 0 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 390, 0 },
+    { "navBbrMask", 0, UBX_MSGDB_X2, 1, 0, 390, 13 },
+    { "resetMode", 2, UBX_MSGDB_U1, 1, 0, 403, 0 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 403, 0 },
+    { "datumNum", 0, UBX_MSGDB_U2, 1, 0, 403, 0 },
+    { "majA", 0, UBX_MSGDB_R8, 1, 0, 403, 0 },
+    { "flat", 8, UBX_MSGDB_R8, 1, 0, 403, 0 },
+    { "dX", 16, UBX_MSGDB_R4, 1, 0, 403, 0 },
+    { "dY", 20, UBX_MSGDB_R4, 1, 0, 403, 0 },
+    { "dZ", 24, UBX_MSGDB_R4, 1, 0, 403, 0 },
+    { "rotX", 28, UBX_MSGDB_R4, 1, 0, 403, 0 },
+    { "rotY", 32, UBX_MSGDB_R4, 1, 0, 403, 0 },
+    { "rotZ", 36, UBX_MSGDB_R4, 1, 0, 403, 0 },
+    { "scale", 40, UBX_MSGDB_R4, 1, 0, 403, 0 },
+    { "datumNum", 0, UBX_MSGDB_U2, 1, 0, 403, 0 },
+    { "datumName", 2, UBX_MSGDB_CH, 6, 0, 403, 0 },
+    { "majA", 8, UBX_MSGDB_R8, 1, 0, 403, 0 },
+    { "flat", 16, UBX_MSGDB_R8, 1, 0, 403, 0 },
+    { "dX", 24, UBX_MSGDB_R4, 1, 0, 403, 0 },
+    { "dY", 28, UBX_MSGDB_R4, 1, 0, 403, 0 },
+    { "dZ", 32, UBX_MSGDB_R4, 1, 0, 403, 0 },
+    { "rotX", 36, UBX_MSGDB_R4, 1, 0, 403, 0 },  // 950
+    { "rotY", 40, UBX_MSGDB_R4, 1, 0, 403, 0 },
+    { "rotZ", 44, UBX_MSGDB_R4, 1, 0, 403, 0 },
+    { "scale", 48, UBX_MSGDB_R4, 1, 0, 403, 0 },
+    { "interval", 0, UBX_MSGDB_U4, 1, 0, 403, 0 },
+    { "length", 4, UBX_MSGDB_U4, 1, 0, 403, 0 },
+    { "status", 8, UBX_MSGDB_I1, 1, 0, 403, 0 },
+    { "timeRef", 9, UBX_MSGDB_U1, 1, 0, 403, 0 },
+    { "flags", 10, UBX_MSGDB_U1, 1, 0, 403, 1 },
+    { "reserved0", 11, UBX_MSGDB_U1, 1, 1, 404, 0 },
+    { "antennaCableDelay", 12, UBX_MSGDB_I2, 1, 0, 404, 0 },
+    { "rfGroupDelay", 14, UBX_MSGDB_I2, 1, 0, 404, 0 },
+    { "userDelay", 16, UBX_MSGDB_I4, 1, 0, 404, 0 },
+    { "measRate", 0, UBX_MSGDB_U2, 1, 0, 404, 0 },
+    { "navRate", 2, UBX_MSGDB_U2, 1, 0, 404, 0 },
+    { "timeRef", 4, UBX_MSGDB_U2, 1, 0, 404, 0 },
+    { "clearMask", 0, UBX_MSGDB_X4, 1, 0, 404, 10 },
+    { "saveMask", 4, UBX_MSGDB_X4, 1, 0, 414, 0 },
+    { "loadMask", 8, UBX_MSGDB_X4, 1, 0, 414, 0 },
+    { "deviceMask", 0, UBX_MSGDB_X1, 1, 0, 414, 4 },
+    { "clearMask", 0, UBX_MSGDB_X4, 1, 0, 418, 1 },
+    { "saveMask", 4, UBX_MSGDB_X4, 1, 0, 419, 1 },
+    { "loadMask", 8, UBX_MSGDB_X4, 1, 0, 420, 1 },
+    { "deviceMask", 0, UBX_MSGDB_X1, 1, 0, 421, 4 },
+    { "flags", 0, UBX_MSGDB_X4, 1, 0, 425, 3 },
+    { "tReacq", 4, UBX_MSGDB_U4, 1, 0, 428, 0 },
+    { "tAcq", 8, UBX_MSGDB_U4, 1, 0, 428, 0 },
+    { "tReacqOff", 12, UBX_MSGDB_U4, 1, 0, 428, 0 },
+    { "tAcqOff", 16, UBX_MSGDB_U4, 1, 0, 428, 0 },
+    { "tOn", 20, UBX_MSGDB_U4, 1, 0, 428, 0 },
+    { "tOff", 24, UBX_MSGDB_U4, 1, 0, 428, 0 },
+    { "reserved0", 28, UBX_MSGDB_U1, 4, 1, 428, 0 },
+    { "baseTow", 32, UBX_MSGDB_U4, 1, 0, 428, 0 },
+    { "reserved0", 0, UBX_MSGDB_U1, 1, 1, 428, 0 },
+    { "lpMode", 1, UBX_MSGDB_U1, 1, 0, 428, 0 },
+    { "reserved0", 0, UBX_MSGDB_U1, 1, 1, 428, 0 },
+    { "lpMode", 1, UBX_MSGDB_U1, 1, 0, 428, 0 },
+    { "disableEkf", 0, UBX_MSGDB_U1, 1, 0, 428, 0 },
+    { "actionFlags", 1, UBX_MSGDB_X1, 1, 0, 428, 6 },
+    { "configFlags", 2, UBX_MSGDB_U1, 1, 0, 434, 2 },
+    { "inverseFlags", 3, UBX_MSGDB_X1, 1, 0, 436, 2 },
+    { "reserved0", 4, UBX_MSGDB_U1, 4, 1, 438, 0 },
+    { "nomPPDist", 8, UBX_MSGDB_U2, 1, 0, 438, 0 },
+    { "nomZero", 10, UBX_MSGDB_U2, 1, 0, 438, 0 },
+    { "nomSens", 12, UBX_MSGDB_U1, 1, 0, 438, 0 },
+    { "rmsTemp", 13, UBX_MSGDB_U1, 1, 0, 438, 0 },
+    { "tempUpdate", 14, UBX_MSGDB_U2, 1, 0, 438, 0 },
+    { "disableEkf", 0, UBX_MSGDB_U1, 1, 0, 438, 0 },
+    { "actionFlags", 1, UBX_MSGDB_X1, 1, 0, 438, 6 },
+    { "configFlags", 2, UBX_MSGDB_U1, 1, 0, 444, 2 },
+    { "inverseFlags", 3, UBX_MSGDB_X1, 1, 0, 446, 2 },  // 1000
+    { "reserved0", 4, UBX_MSGDB_U1, 4, 1, 448, 0 },
+    { "nomPPDist", 8, UBX_MSGDB_U2, 1, 0, 448, 0 },
+    { "nomZero", 10, UBX_MSGDB_U2, 1, 0, 448, 0 },
+    { "nomSens", 12, UBX_MSGDB_U1, 1, 0, 448, 0 },
+    { "rmsTemp", 13, UBX_MSGDB_U1, 1, 0, 448, 0 },
+    { "tempUpdate", 14, UBX_MSGDB_U2, 1, 0, 448, 0 },
+    { "flags", 0, UBX_MSGDB_X2, 1, 0, 448, 5 },
+    { "pins", 2, UBX_MSGDB_X2, 1, 0, 453, 4 },
+    { "flags", 0, UBX_MSGDB_X2, 1, 0, 457, 5 },
+    { "pins", 2, UBX_MSGDB_X2, 1, 0, 462, 3 },
+    { "mode", 0, UBX_MSGDB_X1, 1, 0, 465, 2 },
+    { "usage", 1, UBX_MSGDB_X1, 1, 0, 467, 3 },
+    { "maxSBAS", 2, UBX_MSGDB_U1, 1, 0, 470, 0 },
+    { "scanmode2", 3, UBX_MSGDB_X1, 1, 0, 470, 7 },
+    { "scanmode1", 4, UBX_MSGDB_X4, 1, 0, 477, 32 },
+    { "filter", 0, UBX_MSGDB_X1, 1, 0, 509, 6 },
+    { "nmeaVersion", 1, UBX_MSGDB_U1, 1, 0, 515, 0 },
+    { "numSV", 2, UBX_MSGDB_U1, 1, 0, 515, 0 },
+    { "flags", 3, UBX_MSGDB_X1, 1, 0, 515, 2 },
+    { "filter", 0, UBX_MSGDB_X1, 1, 0, 517, 6 },
+    { "nmeaVersion", 1, UBX_MSGDB_U1, 1, 0, 523, 0 },
+    { "numSV", 2, UBX_MSGDB_U1, 1, 0, 523, 0 },
+    { "flags", 3, UBX_MSGDB_X1, 1, 0, 523, 2 },
+    { "gnssToFilter", 4, UBX_MSGDB_X4, 1, 0, 525, 6 },
+    { "svNumbering", 8, UBX_MSGDB_U1, 1, 0, 531, 0 },
+    { "mainTalkerId", 9, UBX_MSGDB_U1, 1, 0, 531, 0 },
+    { "gsvTalkerId", 10, UBX_MSGDB_U1, 1, 0, 531, 0 },
+    { "version", 11, UBX_MSGDB_U1, 1, 0, 531, 0 },
+    { "filter", 0, UBX_MSGDB_X1, 1, 0, 531, 6 },
+    { "nmeaVersion", 1, UBX_MSGDB_U1, 1, 0, 537, 0 },
+    { "numSV", 2, UBX_MSGDB_U1, 1, 0, 537, 0 },
+    { "flags", 3, UBX_MSGDB_X1, 1, 0, 537, 4 },
+    { "gnssToFilter", 4, UBX_MSGDB_X4, 1, 0, 541, 6 },
+    { "svNumbering", 8, UBX_MSGDB_U1, 1, 0, 547, 0 },
+    { "mainTalkerId", 9, UBX_MSGDB_U1, 1, 0, 547, 0 },
+    { "gsvTalkerId", 10, UBX_MSGDB_U1, 1, 0, 547, 0 },
+    { "version", 11, UBX_MSGDB_U1, 1, 0, 547, 0 },
+    { "bdsTalkerId", 12, UBX_MSGDB_CH, 2, 0, 547, 0 },
+    { "reserved0", 14, UBX_MSGDB_U1, 6, 1, 547, 0 },
+    { "vendorID", 0, UBX_MSGDB_U2, 1, 0, 547, 0 },
+    { "productID", 2, UBX_MSGDB_U2, 1, 0, 547, 0 },
+    { "reserved0", 4, UBX_MSGDB_U1, 2, 1, 547, 0 },
+    { "reserved1", 6, UBX_MSGDB_U1, 2, 1, 547, 0 },
+    { "powerConsumption", 8, UBX_MSGDB_U2, 1, 0, 547, 0 },
+    { "flags", 10, UBX_MSGDB_X2, 1, 0, 547, 2 },
+    { "vendorString", 12, UBX_MSGDB_CH, 32, 0, 549, 0 },
+    { "productString", 44, UBX_MSGDB_CH, 32, 0, 549, 0 },
+    { "serialNumber", 76, UBX_MSGDB_CH, 32, 0, 549, 0 },
+    { "timeMode", 0, UBX_MSGDB_U4, 1, 0, 549, 0 },
+    { "fixedPosX", 4, UBX_MSGDB_I4, 1, 0, 549, 0 },  // 1050
+    { "fixedPosY", 8, UBX_MSGDB_I4, 1, 0, 549, 0 },
+    { "fixedPosZ", 12, UBX_MSGDB_I4, 1, 0, 549, 0 },
+    { "fixedPosVar", 16, UBX_MSGDB_U4, 1, 0, 549, 0 },
+    { "svinMinDur", 20, UBX_MSGDB_U4, 1, 0, 549, 0 },
+    { "svinVarLimit", 24, UBX_MSGDB_U4, 1, 0, 549, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 549, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 549, 0 },
+    { "flags", 4, UBX_MSGDB_U1, 1, 0, 549, 4 },
+    { "odoCfg", 5, UBX_MSGDB_X1, 1, 0, 553, 1 },
+    { "reserved1", 6, UBX_MSGDB_U1, 6, 1, 554, 0 },
+    { "cogMaxSpeed", 12, UBX_MSGDB_U1, 1, 0, 554, 0 },
+    { "cogMaxPosAcc", 13, UBX_MSGDB_U1, 1, 0, 554, 0 },
+    { "reserved2", 14, UBX_MSGDB_U1, 2, 1, 554, 0 },
+    { "velLpGain", 16, UBX_MSGDB_U1, 1, 0, 554, 0 },
+    { "cogLpGain", 17, UBX_MSGDB_U1, 1, 0, 554, 0 },
+    { "reserved3", 18, UBX_MSGDB_U1, 2, 1, 554, 0 },
+    { "version", 0, UBX_MSGDB_U2, 1, 0, 554, 0 },
+    { "mask1", 2, UBX_MSGDB_X2, 1, 0, 554, 7 },
+    { "mask2", 4, UBX_MSGDB_X4, 1, 0, 561, 1 },
+    { "reserved0", 8, UBX_MSGDB_U1, 2, 1, 562, 0 },
+    { "minSVs", 10, UBX_MSGDB_U1, 1, 0, 562, 0 },
+    { "maxSVs", 11, UBX_MSGDB_U1, 1, 0, 562, 0 },
+    { "minCNO", 12, UBX_MSGDB_U1, 1, 0, 562, 0 },
+    { "reserved1", 13, UBX_MSGDB_U1, 1, 1, 562, 0 },
+    { "iniFix3D", 14, UBX_MSGDB_U1, 1, 0, 562, 0 },
+    { "reserved2", 15, UBX_MSGDB_U1, 2, 1, 562, 0 },
+    { "ackAiding", 17, UBX_MSGDB_U1, 1, 0, 562, 0 },
+    { "wknRollover", 18, UBX_MSGDB_U2, 1, 0, 562, 0 },
+    { "reserved3", 20, UBX_MSGDB_U1, 6, 1, 562, 0 },
+    { "usePPP", 26, UBX_MSGDB_U1, 1, 0, 562, 0 },
+    { "aopCfg", 27, UBX_MSGDB_U1, 1, 0, 562, 1 },
+    { "reserved4", 28, UBX_MSGDB_U1, 2, 1, 563, 0 },
+    { "aopOrbMaxErr", 30, UBX_MSGDB_U2, 1, 0, 563, 0 },
+    { "reserved5", 32, UBX_MSGDB_U1, 4, 1, 563, 0 },
+    { "reserved6", 36, UBX_MSGDB_U1, 3, 1, 563, 0 },
+    { "useAdr", 39, UBX_MSGDB_U1, 1, 0, 563, 0 },
+    { "version", 0, UBX_MSGDB_U2, 1, 0, 563, 0 },
+    { "mask1", 2, UBX_MSGDB_X2, 1, 0, 563, 6 },
+    { "reserved0", 4, UBX_MSGDB_U1, 6, 1, 569, 0 },
+    { "minSVs", 10, UBX_MSGDB_U1, 1, 0, 569, 0 },
+    { "maxSVs", 11, UBX_MSGDB_U1, 1, 0, 569, 0 },
+    { "minCNO", 12, UBX_MSGDB_U1, 1, 0, 569, 0 },
+    { "reserved1", 13, UBX_MSGDB_U1, 1, 1, 569, 0 },
+    { "iniFix3D", 14, UBX_MSGDB_U1, 1, 0, 569, 0 },
+    { "reserved2", 15, UBX_MSGDB_U1, 2, 1, 569, 0 },
+    { "ackAiding", 17, UBX_MSGDB_U1, 1, 0, 569, 0 },
+    { "wknRollover", 18, UBX_MSGDB_U2, 1, 0, 569, 0 },
+    { "reserved3", 20, UBX_MSGDB_U1, 6, 1, 569, 0 },
+    { "usePPP", 26, UBX_MSGDB_U1, 1, 0, 569, 0 },
+    { "aopCfg", 27, UBX_MSGDB_U1, 1, 0, 569, 1 },  // 1100
+    { "reserved4", 28, UBX_MSGDB_U1, 2, 1, 570, 0 },
+    { "aopOrbMaxErr", 30, UBX_MSGDB_U2, 1, 0, 570, 0 },
+    { "reserved5", 32, UBX_MSGDB_U1, 1, 1, 570, 0 },
+    { "reserved6", 33, UBX_MSGDB_U1, 7, 1, 570, 0 },
+    { "version", 0, UBX_MSGDB_U2, 1, 0, 570, 0 },
+    { "mask1", 2, UBX_MSGDB_X2, 1, 0, 570, 7 },
+    { "mask2", 4, UBX_MSGDB_X4, 1, 0, 577, 2 },
+    { "reserved0", 8, UBX_MSGDB_U1, 2, 1, 579, 0 },
+    { "minSVs", 10, UBX_MSGDB_U1, 1, 0, 579, 0 },
+    { "maxSVs", 11, UBX_MSGDB_U1, 1, 0, 579, 0 },
+    { "minCNO", 12, UBX_MSGDB_U1, 1, 0, 579, 0 },
+    { "reserved1", 13, UBX_MSGDB_U1, 1, 1, 579, 0 },
+    { "iniFix3D", 14, UBX_MSGDB_U1, 1, 0, 579, 0 },
+    { "reserved2", 15, UBX_MSGDB_U1, 2, 1, 579, 0 },
+    { "ackAiding", 17, UBX_MSGDB_U1, 1, 0, 579, 0 },
+    { "wknRollover", 18, UBX_MSGDB_U2, 1, 0, 579, 0 },
+    { "sigAttenCompMode", 20, UBX_MSGDB_U1, 1, 0, 579, 0 },
+    { "reserved3", 21, UBX_MSGDB_U1, 1, 1, 579, 0 },
+    { "reserved4", 22, UBX_MSGDB_U1, 2, 1, 579, 0 },
+    { "reserved5", 24, UBX_MSGDB_U1, 2, 1, 579, 0 },
+    { "usePPP", 26, UBX_MSGDB_U1, 1, 0, 579, 0 },
+    { "aopCfg", 27, UBX_MSGDB_U1, 1, 0, 579, 1 },
+    { "reserved6", 28, UBX_MSGDB_U1, 1, 1, 580, 0 },
+    { "reserved7", 29, UBX_MSGDB_U1, 1, 1, 580, 0 },
+    { "aopOrbMaxErr", 30, UBX_MSGDB_U2, 1, 0, 580, 0 },
+    { "reserved8", 32, UBX_MSGDB_U1, 4, 1, 580, 0 },
+    { "reserved9", 36, UBX_MSGDB_U1, 3, 1, 580, 0 },
+    { "useAdr", 39, UBX_MSGDB_U1, 1, 0, 580, 0 },
+    { "version", 0, UBX_MSGDB_U2, 1, 0, 580, 0 },
+    { "mask1", 2, UBX_MSGDB_X2, 1, 0, 580, 7 },
+    { "mask2", 4, UBX_MSGDB_X4, 1, 0, 587, 2 },
+    { "reserved0", 8, UBX_MSGDB_U1, 2, 1, 589, 0 },
+    { "minSVs", 10, UBX_MSGDB_U1, 1, 0, 589, 0 },
+    { "maxSVs", 11, UBX_MSGDB_U1, 1, 0, 589, 0 },
+    { "minCNO", 12, UBX_MSGDB_U1, 1, 0, 589, 0 },
+    { "reserved1", 13, UBX_MSGDB_U1, 1, 1, 589, 0 },
+    { "iniFix3D", 14, UBX_MSGDB_U1, 1, 0, 589, 0 },
+    { "reserved2", 15, UBX_MSGDB_U1, 2, 1, 589, 0 },
+    { "ackAiding", 17, UBX_MSGDB_U1, 1, 0, 589, 0 },
+    { "wknRollover", 18, UBX_MSGDB_U2, 1, 0, 589, 0 },
+    { "sigAttenCompMode", 20, UBX_MSGDB_U1, 1, 0, 589, 0 },
+    { "reserved3", 21, UBX_MSGDB_U1, 1, 1, 589, 0 },
+    { "reserved4", 22, UBX_MSGDB_U1, 2, 1, 589, 0 },
+    { "reserved5", 24, UBX_MSGDB_U1, 2, 1, 589, 0 },
+    { "usePPP", 26, UBX_MSGDB_U1, 1, 0, 589, 0 },
+    { "aopCfg", 27, UBX_MSGDB_U1, 1, 0, 589, 1 },
+    { "reserved6", 28, UBX_MSGDB_U1, 2, 1, 590, 0 },
+    { "aopOrbMaxErr", 30, UBX_MSGDB_U2, 1, 0, 590, 0 },
+    { "reserved7", 32, UBX_MSGDB_U1, 4, 1, 590, 0 },
+    { "reserved8", 36, UBX_MSGDB_U1, 3, 1, 590, 0 },  // 1150
+    { "useAdr", 39, UBX_MSGDB_U1, 1, 0, 590, 0 },
+    { "reserved9", 40, UBX_MSGDB_U1, 2, 1, 590, 0 },
+    { "reserved10", 42, UBX_MSGDB_U1, 2, 1, 590, 0 },
+    { "mask", 0, UBX_MSGDB_X2, 1, 0, 590, 10 },
+    { "dynModel", 2, UBX_MSGDB_U1, 1, 0, 600, 0 },
+    { "fixMode", 3, UBX_MSGDB_U1, 1, 0, 600, 0 },
+    { "fixedAlt", 4, UBX_MSGDB_I4, 1, 0, 600, 0 },
+    { "fixedAltVar", 8, UBX_MSGDB_U4, 1, 0, 600, 0 },
+    { "minElev", 12, UBX_MSGDB_I1, 1, 0, 600, 0 },
+    { "drLimit", 13, UBX_MSGDB_U1, 1, 0, 600, 0 },
+    { "pDop", 14, UBX_MSGDB_U2, 1, 0, 600, 0 },
+    { "tDop", 16, UBX_MSGDB_U2, 1, 0, 600, 0 },
+    { "pAcc", 18, UBX_MSGDB_U2, 1, 0, 600, 0 },
+    { "tAcc", 20, UBX_MSGDB_U2, 1, 0, 600, 0 },
+    { "staticHoldThresh", 22, UBX_MSGDB_U1, 1, 0, 600, 0 },
+    { "dgnssTimeout", 23, UBX_MSGDB_U1, 1, 0, 600, 0 },
+    { "cnoThreshNumSVs", 24, UBX_MSGDB_U1, 1, 0, 600, 0 },
+    { "cnoThresh", 25, UBX_MSGDB_U1, 1, 0, 600, 0 },
+    { "reserved0", 26, UBX_MSGDB_U1, 2, 1, 600, 0 },
+    { "staticHoldMaxDist", 28, UBX_MSGDB_U2, 1, 0, 600, 0 },
+    { "utcStandard", 30, UBX_MSGDB_U1, 1, 0, 600, 0 },
+    { "reserved1", 31, UBX_MSGDB_U1, 5, 1, 600, 0 },
+    { "flags", 0, UBX_MSGDB_X2, 1, 0, 600, 3 },
+    { "id", 2, UBX_MSGDB_U2, 1, 0, 603, 0 },
+    { "wtFactor", 4, UBX_MSGDB_U4, 1, 0, 603, 0 },
+    { "reserved0", 8, UBX_MSGDB_U1, 4, 1, 603, 0 },
+    { "wtQuantError", 12, UBX_MSGDB_U4, 1, 0, 603, 0 },
+    { "senTtagFactor", 16, UBX_MSGDB_U4, 1, 0, 603, 0 },
+    { "wtCountMax", 20, UBX_MSGDB_U4, 1, 0, 603, 0 },
+    { "senTtagMax", 24, UBX_MSGDB_U4, 1, 0, 603, 0 },
+    { "wtLatency", 28, UBX_MSGDB_U2, 1, 0, 603, 0 },
+    { "reserved1", 30, UBX_MSGDB_U1, 2, 1, 603, 0 },
+    { "wtFrequency", 32, UBX_MSGDB_U1, 1, 0, 603, 0 },
+    { "reserved2", 33, UBX_MSGDB_U1, 1, 1, 603, 0 },
+    { "speedDeadBand", 34, UBX_MSGDB_U2, 1, 0, 603, 0 },
+    { "reserved3", 36, UBX_MSGDB_U1, 8, 1, 603, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 603, 0 },
+    { "numConfigs", 1, UBX_MSGDB_U1, 1, 0, 603, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 603, 0 },
+    { "leverArmType", 0, UBX_MSGDB_U1, 1, 0, 603, 0 },
+    { "reserved1", 1, UBX_MSGDB_U1, 1, 1, 603, 0 },
+    { "leverArmX", 2, UBX_MSGDB_I2, 1, 0, 603, 0 },
+    { "leverArmY", 4, UBX_MSGDB_I2, 1, 0, 603, 0 },
+    { "leverArmZ", 6, UBX_MSGDB_I2, 1, 0, 603, 0 },
+    { "tpIdx", 0, UBX_MSGDB_U1, 1, 0, 603, 0 },
+    { "tpIdx", 0, UBX_MSGDB_U1, 1, 0, 603, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 603, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 603, 0 },
+    { "antCableDelay", 4, UBX_MSGDB_I2, 1, 0, 603, 0 },
+    { "rfGroupDelay", 6, UBX_MSGDB_I2, 1, 0, 603, 0 },  // 1200
+    { "freqPeriod", 8, UBX_MSGDB_U4, 1, 0, 603, 0 },
+    { "freqPeriodLock", 12, UBX_MSGDB_U4, 1, 0, 603, 0 },
+    { "pulseLenRatio", 16, UBX_MSGDB_U4, 1, 0, 603, 0 },
+    { "pulseLenRatioLock", 20, UBX_MSGDB_U4, 1, 0, 603, 0 },
+    { "userConfigDelay", 24, UBX_MSGDB_I4, 1, 0, 603, 0 },
+    { "flags", 28, UBX_MSGDB_X4, 1, 0, 603, 8 },
+    { "tpIdx", 0, UBX_MSGDB_U1, 1, 0, 611, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 611, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 611, 0 },
+    { "antCableDelay", 4, UBX_MSGDB_I2, 1, 0, 611, 0 },
+    { "rfGroupDelay", 6, UBX_MSGDB_I2, 1, 0, 611, 0 },
+    { "freqPeriod", 8, UBX_MSGDB_U4, 1, 0, 611, 0 },
+    { "freqPeriodLock", 12, UBX_MSGDB_U4, 1, 0, 611, 0 },
+    { "pulseLenRatio", 16, UBX_MSGDB_U4, 1, 0, 611, 0 },
+    { "pulseLenRatioLock", 20, UBX_MSGDB_U4, 1, 0, 611, 0 },
+    { "userConfigDelay", 24, UBX_MSGDB_I4, 1, 0, 611, 0 },
+    { "flags", 28, UBX_MSGDB_X4, 1, 0, 611, 9 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 620, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 620, 0 },
+    { "flags", 4, UBX_MSGDB_X4, 1, 0, 620, 8 },
+    { "updatePeriod", 8, UBX_MSGDB_U4, 1, 0, 628, 0 },
+    { "searchPeriod", 12, UBX_MSGDB_U4, 1, 0, 628, 0 },
+    { "gridOffset", 16, UBX_MSGDB_U4, 1, 0, 628, 0 },
+    { "onTime", 20, UBX_MSGDB_U2, 1, 0, 628, 0 },
+    { "minAcqTime", 22, UBX_MSGDB_U2, 1, 0, 628, 0 },
+    { "flags", 0, UBX_MSGDB_X1, 1, 0, 628, 2 },
+    { "data", 0, UBX_MSGDB_U1, 1, 0, 630, 0 },
+    { "config", 0, UBX_MSGDB_X4, 1, 0, 630, 4 },
+    { "config2", 4, UBX_MSGDB_X4, 1, 0, 634, 3 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 637, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 1, 1, 637, 0 },
+    { "maxStartupStateDur", 2, UBX_MSGDB_U1, 1, 0, 637, 0 },
+    { "reserved1", 3, UBX_MSGDB_U1, 1, 1, 637, 0 },
+    { "flags", 4, UBX_MSGDB_X4, 1, 0, 637, 9 },
+    { "updatePeriod", 8, UBX_MSGDB_U4, 1, 0, 646, 0 },
+    { "searchPeriod", 12, UBX_MSGDB_U4, 1, 0, 646, 0 },
+    { "gridOffset", 16, UBX_MSGDB_U4, 1, 0, 646, 0 },
+    { "onTime", 20, UBX_MSGDB_U2, 1, 0, 646, 0 },
+    { "minAcqTime", 22, UBX_MSGDB_U2, 1, 0, 646, 0 },
+    { "reserved2", 24, UBX_MSGDB_U1, 20, 1, 646, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 646, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 1, 1, 646, 0 },
+    { "maxStartupStateDur", 2, UBX_MSGDB_U1, 1, 0, 646, 0 },
+    { "reserved1", 3, UBX_MSGDB_U1, 1, 1, 646, 0 },
+    { "flags", 4, UBX_MSGDB_X4, 1, 0, 646, 10 },
+    { "updatePeriod", 8, UBX_MSGDB_U4, 1, 0, 656, 0 },
+    { "searchPeriod", 12, UBX_MSGDB_U4, 1, 0, 656, 0 },
+    { "gridOffset", 16, UBX_MSGDB_U4, 1, 0, 656, 0 },
+    { "onTime", 20, UBX_MSGDB_U2, 1, 0, 656, 0 },
+    { "minAcqTime", 22, UBX_MSGDB_U2, 1, 0, 656, 0 },  // 1250
+    { "reserved2", 24, UBX_MSGDB_U1, 20, 1, 656, 0 },
+    { "extintInactivityMs", 44, UBX_MSGDB_U4, 1, 0, 656, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 656, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 1, 1, 656, 0 },
+    { "maxStartupStateDur", 2, UBX_MSGDB_U1, 1, 0, 656, 0 },
+    { "reserved1", 3, UBX_MSGDB_U1, 1, 1, 656, 0 },
+    { "flags", 4, UBX_MSGDB_X4, 1, 0, 656, 11 },
+    { "updatePeriod", 8, UBX_MSGDB_U4, 1, 0, 667, 0 },
+    { "searchPeriod", 12, UBX_MSGDB_U4, 1, 0, 667, 0 },
+    { "gridOffset", 16, UBX_MSGDB_U4, 1, 0, 667, 0 },
+    { "onTime", 20, UBX_MSGDB_U2, 1, 0, 667, 0 },
+    { "minAcqTime", 22, UBX_MSGDB_U2, 1, 0, 667, 0 },
+    { "reserved2", 24, UBX_MSGDB_U1, 20, 1, 667, 0 },
+    { "extintInactivityMs", 44, UBX_MSGDB_U4, 1, 0, 667, 0 },
+    { "timeMode", 0, UBX_MSGDB_U1, 1, 0, 667, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 1, 1, 667, 0 },
+    { "flags", 2, UBX_MSGDB_X2, 1, 0, 667, 2 },
+    { "ecefXOrLat", 4, UBX_MSGDB_I4, 1, 0, 669, 0 },
+    { "ecefYOrLon", 8, UBX_MSGDB_I4, 1, 0, 669, 0 },
+    { "ecefZOrAlt", 12, UBX_MSGDB_I4, 1, 0, 669, 0 },
+    { "fixedPosAcc", 16, UBX_MSGDB_U4, 1, 0, 669, 0 },
+    { "svinMinDur", 20, UBX_MSGDB_U4, 1, 0, 669, 0 },
+    { "svinAccLimit", 24, UBX_MSGDB_U4, 1, 0, 669, 0 },
+    { "msgVer", 0, UBX_MSGDB_U1, 1, 0, 669, 0 },
+    { "numTrkChHw", 1, UBX_MSGDB_U1, 1, 0, 669, 0 },
+    { "numTrkChUse", 2, UBX_MSGDB_U1, 1, 0, 669, 0 },
+    { "numConfigBlocks", 3, UBX_MSGDB_U1, 1, 0, 669, 0 },
+    { "gnssId", 0, UBX_MSGDB_U1, 1, 0, 669, 0 },
+    { "resTrkCh", 1, UBX_MSGDB_U1, 1, 0, 669, 0 },
+    { "maxTrkCh", 2, UBX_MSGDB_U1, 1, 0, 669, 0 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 669, 0 },
+    { "flags", 4, UBX_MSGDB_X4, 1, 0, 669, 2 },
+    { "cfgHeader", 0, UBX_MSGDB_U1, 12, 0, 671, 0 },
+    { "cfgData", 0, UBX_MSGDB_U1, 1, 0, 671, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 671, 0 },
+    { "operation", 1, UBX_MSGDB_U1, 1, 0, 671, 0 },
+    { "fileID", 2, UBX_MSGDB_U1, 1, 0, 671, 0 },
+    { "lengthMask", 3, UBX_MSGDB_X1, 1, 0, 671, 2 },
+    { "reserved0", 4, UBX_MSGDB_U1, 4, 1, 673, 0 },
+    { "key", 8, UBX_MSGDB_U4, 1, 0, 673, 0 },
+    { "antSupCfg1", 12, UBX_MSGDB_X1, 1, 0, 673, 8 },
+    { "antSupCfg2", 13, UBX_MSGDB_X1, 1, 0, 681, 2 },
+    { "antSupCfg3", 14, UBX_MSGDB_X1, 1, 0, 683, 4 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 687, 0 },
+    { "flags", 1, UBX_MSGDB_X1, 1, 0, 687, 3 },
+    { "minInterval", 2, UBX_MSGDB_U2, 1, 0, 690, 0 },
+    { "timeThreshold", 4, UBX_MSGDB_U2, 1, 0, 690, 0 },
+    { "speedThreshold", 6, UBX_MSGDB_U2, 1, 0, 690, 0 },
+    { "positionThreshold", 8, UBX_MSGDB_U4, 1, 0, 690, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 690, 0 },  // 1300
+    { "reserved0", 1, UBX_MSGDB_U1, 9, 1, 690, 0 },
+    { "accelRmsThdl", 10, UBX_MSGDB_U1, 1, 0, 690, 0 },
+    { "frequency", 11, UBX_MSGDB_U1, 1, 0, 690, 0 },
+    { "latency", 12, UBX_MSGDB_U2, 1, 0, 690, 0 },
+    { "accuracy", 14, UBX_MSGDB_U2, 1, 0, 690, 0 },
+    { "reserved1", 16, UBX_MSGDB_U1, 4, 1, 690, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 690, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 7, 1, 690, 0 },
+    { "tcTableSaveRate", 8, UBX_MSGDB_U2, 1, 0, 690, 0 },
+    { "gyroRmsThdl", 10, UBX_MSGDB_U1, 1, 0, 690, 0 },
+    { "frequency", 11, UBX_MSGDB_U1, 1, 0, 690, 0 },
+    { "latency", 12, UBX_MSGDB_U2, 1, 0, 690, 0 },
+    { "accuracy", 14, UBX_MSGDB_U2, 1, 0, 690, 0 },
+    { "reserved1", 16, UBX_MSGDB_U1, 4, 1, 690, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 690, 0 },
+    { "enable", 1, UBX_MSGDB_X1, 1, 0, 690, 5 },
+    { "refTp", 2, UBX_MSGDB_U1, 1, 0, 695, 0 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 695, 0 },
+    { "end", 0, UBX_MSGDB_U4, 1, 0, 695, 0 },
+    { "bitfield", 0, UBX_MSGDB_U4, 1, 0, 695, 2 },
+    { "yaw", 4, UBX_MSGDB_U4, 1, 0, 697, 0 },
+    { "pitch", 8, UBX_MSGDB_I2, 1, 0, 697, 0 },
+    { "roll", 10, UBX_MSGDB_I2, 1, 0, 697, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 697, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 697, 0 },
+    { "state", 4, UBX_MSGDB_U4, 1, 0, 697, 0 },
+    { "highNavRate", 0, UBX_MSGDB_U1, 1, 0, 697, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 697, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 697, 0 },
+    { "numSources", 1, UBX_MSGDB_U1, 1, 0, 697, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 697, 0 },
+    { "extInt", 0, UBX_MSGDB_U1, 1, 0, 697, 0 },
+    { "sourceType", 1, UBX_MSGDB_U1, 1, 0, 697, 0 },
+    { "flags", 2, UBX_MSGDB_X2, 1, 0, 697, 2 },
+    { "freq", 4, UBX_MSGDB_U4, 1, 0, 699, 0 },
+    { "reserved1", 8, UBX_MSGDB_U1, 4, 1, 699, 0 },
+    { "withTemp", 12, UBX_MSGDB_U4, 1, 0, 699, 0 },
+    { "withAge", 16, UBX_MSGDB_U4, 1, 0, 699, 0 },
+    { "timeToTemp", 20, UBX_MSGDB_U2, 1, 0, 699, 0 },
+    { "maxDevLifeTime", 22, UBX_MSGDB_U2, 1, 0, 699, 0 },
+    { "offset", 24, UBX_MSGDB_I4, 1, 0, 699, 0 },
+    { "offsetUncertainty", 28, UBX_MSGDB_U4, 1, 0, 699, 0 },
+    { "jitter", 32, UBX_MSGDB_U4, 1, 0, 699, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 699, 0 },
+    { "numOsc", 1, UBX_MSGDB_U1, 1, 0, 699, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 699, 0 },
+    { "oscId", 0, UBX_MSGDB_U1, 1, 0, 699, 0 },
+    { "reserved1", 1, UBX_MSGDB_U1, 1, 1, 699, 0 },
+    { "flags", 2, UBX_MSGDB_X2, 1, 0, 699, 2 },
+    { "freq", 4, UBX_MSGDB_U4, 1, 0, 701, 0 },  // 1350
+    { "phaseOffset", 8, UBX_MSGDB_I4, 1, 0, 701, 0 },
+    { "withTemp", 12, UBX_MSGDB_U4, 1, 0, 701, 0 },
+    { "withAge", 16, UBX_MSGDB_U4, 1, 0, 701, 0 },
+    { "timeToTemp", 20, UBX_MSGDB_U2, 1, 0, 701, 0 },
+    { "reserved2", 22, UBX_MSGDB_U1, 2, 1, 701, 0 },
+    { "gainVco", 24, UBX_MSGDB_I4, 1, 0, 701, 0 },
+    { "gainUncertainty", 28, UBX_MSGDB_U1, 1, 0, 701, 0 },
+    { "reserved3", 29, UBX_MSGDB_U1, 3, 1, 701, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 701, 0 },
+    { "minGNSSFix", 1, UBX_MSGDB_U1, 1, 0, 701, 0 },
+    { "maxFreqChangeRate", 2, UBX_MSGDB_U2, 1, 0, 701, 0 },
+    { "maxPhaseCorrRate", 4, UBX_MSGDB_U2, 1, 0, 701, 0 },
+    { "reserved0", 6, UBX_MSGDB_U1, 2, 1, 701, 0 },
+    { "freqTolerance", 8, UBX_MSGDB_U2, 1, 0, 701, 0 },
+    { "timeTolerance", 10, UBX_MSGDB_U2, 1, 0, 701, 0 },
+    { "messageCfg", 12, UBX_MSGDB_X2, 1, 0, 701, 4 },
+    { "maxSlewRate", 14, UBX_MSGDB_U2, 1, 0, 705, 0 },
+    { "flags", 16, UBX_MSGDB_X4, 1, 0, 705, 14 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 719, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 1, 1, 719, 0 },
+    { "sensorId", 2, UBX_MSGDB_U2, 1, 0, 719, 0 },
+    { "reserved1", 4, UBX_MSGDB_U1, 8, 1, 719, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 719, 0 },
+    { "numFences", 1, UBX_MSGDB_U1, 1, 0, 719, 0 },
+    { "confLvl", 2, UBX_MSGDB_U1, 1, 0, 719, 0 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 719, 0 },
+    { "pioEnabled", 4, UBX_MSGDB_U1, 1, 0, 719, 0 },
+    { "pinPolarity", 5, UBX_MSGDB_U1, 1, 0, 719, 0 },
+    { "pin", 6, UBX_MSGDB_U1, 1, 0, 719, 0 },
+    { "reserved1", 7, UBX_MSGDB_U1, 1, 1, 719, 0 },
+    { "lat", 0, UBX_MSGDB_I4, 1, 0, 719, 0 },
+    { "lon", 4, UBX_MSGDB_I4, 1, 0, 719, 0 },
+    { "radius", 8, UBX_MSGDB_U4, 1, 0, 719, 0 },
+    { "dgnssMode", 0, UBX_MSGDB_U1, 1, 0, 719, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 719, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 719, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 1, 1, 719, 0 },
+    { "flags", 2, UBX_MSGDB_X2, 1, 0, 719, 2 },
+    { "ecefXOrLat", 4, UBX_MSGDB_I4, 1, 0, 721, 0 },
+    { "ecefYOrLon", 8, UBX_MSGDB_I4, 1, 0, 721, 0 },
+    { "ecefZOrAlt", 12, UBX_MSGDB_I4, 1, 0, 721, 0 },
+    { "ecefXOrLatHP", 16, UBX_MSGDB_I1, 1, 0, 721, 0 },
+    { "ecefYOrLonHP", 17, UBX_MSGDB_I1, 1, 0, 721, 0 },
+    { "ecefZOrAltHP", 18, UBX_MSGDB_I1, 1, 0, 721, 0 },
+    { "reserved1", 19, UBX_MSGDB_U1, 1, 1, 721, 0 },
+    { "fixedPosAcc", 20, UBX_MSGDB_U4, 1, 0, 721, 0 },
+    { "svinMinDur", 24, UBX_MSGDB_U4, 1, 0, 721, 0 },
+    { "svinAccLimit", 28, UBX_MSGDB_U4, 1, 0, 721, 0 },
+    { "reserved2", 32, UBX_MSGDB_U1, 8, 1, 721, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 721, 0 },  // 1400
+    { "flags1", 1, UBX_MSGDB_X1, 1, 0, 721, 4 },
+    { "flags2", 2, UBX_MSGDB_X1, 1, 0, 725, 4 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 729, 0 },
+    { "wtFactor", 4, UBX_MSGDB_U4, 1, 0, 729, 0 },
+    { "wtQuantError", 8, UBX_MSGDB_U4, 1, 0, 729, 0 },
+    { "wtCountMax", 12, UBX_MSGDB_U4, 1, 0, 729, 0 },
+    { "wtLatency", 16, UBX_MSGDB_U2, 1, 0, 729, 0 },
+    { "wtFrequency", 18, UBX_MSGDB_U1, 1, 0, 729, 0 },
+    { "flags3", 19, UBX_MSGDB_X1, 1, 0, 729, 1 },
+    { "speedDeadBand", 20, UBX_MSGDB_U2, 1, 0, 730, 0 },
+    { "reserved1", 22, UBX_MSGDB_U1, 10, 1, 730, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 730, 0 },
+    { "powerSetupValue", 1, UBX_MSGDB_U1, 1, 0, 730, 0 },
+    { "period", 2, UBX_MSGDB_U2, 1, 0, 730, 0 },
+    { "onTime", 4, UBX_MSGDB_U2, 1, 0, 730, 0 },
+    { "reserved0", 6, UBX_MSGDB_U1, 2, 1, 730, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 730, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 730, 0 },
+    { "flags", 2, UBX_MSGDB_X2, 1, 0, 730, 1 },
+    { "pioConf", 4, UBX_MSGDB_X2, 1, 0, 731, 2 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 733, 0 },
+    { "layers", 1, UBX_MSGDB_X1, 1, 0, 733, 3 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 736, 0 },
+    { "cfgData", 0, UBX_MSGDB_U1, 1, 0, 736, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 736, 0 },
+    { "layers", 1, UBX_MSGDB_X1, 1, 0, 736, 3 },
+    { "transaction", 2, UBX_MSGDB_U1, 1, 0, 739, 1 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 740, 0 },
+    { "cfgData", 0, UBX_MSGDB_U1, 1, 0, 740, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 740, 0 },
+    { "layer", 1, UBX_MSGDB_U1, 1, 0, 740, 0 },
+    { "position", 2, UBX_MSGDB_U2, 1, 0, 740, 0 },
+    { "keys", 0, UBX_MSGDB_U4, 1, 0, 740, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 740, 0 },
+    { "layer", 1, UBX_MSGDB_U1, 1, 0, 740, 0 },
+    { "position", 2, UBX_MSGDB_U2, 1, 0, 740, 0 },
+    { "cfgData", 0, UBX_MSGDB_U1, 1, 0, 740, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 740, 0 },
+    { "layers", 1, UBX_MSGDB_X1, 1, 0, 740, 2 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 742, 0 },
+    { "keys", 0, UBX_MSGDB_U4, 1, 0, 742, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 742, 0 },
+    { "layers", 1, UBX_MSGDB_X1, 1, 0, 742, 2 },
+    { "transaction", 2, UBX_MSGDB_X1, 1, 0, 744, 1 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 745, 0 },
+    { "keys", 0, UBX_MSGDB_U4, 1, 0, 745, 0 },
+    { "mode", 0, UBX_MSGDB_X1, 1, 0, 745, 3 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 748, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 748, 0 },
+    { "flags", 1, UBX_MSGDB_X1, 1, 0, 748, 5 },  // 1450
+    { "bufSize", 2, UBX_MSGDB_U2, 1, 0, 753, 0 },
+    { "notifThrs", 4, UBX_MSGDB_U2, 1, 0, 753, 0 },
+    { "pioId", 6, UBX_MSGDB_U1, 1, 0, 753, 0 },
+    { "reserved0", 7, UBX_MSGDB_U1, 1, 1, 753, 0 },
+    { "cmd", 0, UBX_MSGDB_U1, 1, 0, 753, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 753, 0 },
+    { "cmd", 0, UBX_MSGDB_U1, 1, 0, 753, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 753, 0 },
+    { "cmd", 0, UBX_MSGDB_U1, 1, 0, 753, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 753, 0 },
+    { "response", 4, UBX_MSGDB_U1, 1, 0, 753, 0 },
+    { "reserved1", 5, UBX_MSGDB_U1, 3, 1, 753, 0 },
+    { "cmd", 0, UBX_MSGDB_U1, 1, 0, 753, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 753, 0 },
+    { "response", 4, UBX_MSGDB_U1, 1, 0, 753, 0 },
+    { "reserved1", 5, UBX_MSGDB_U1, 3, 1, 753, 0 },
+    { "rxBytes", 0, UBX_MSGDB_U4, 1, 0, 753, 0 },
+    { "txBytes", 4, UBX_MSGDB_U4, 1, 0, 753, 0 },
+    { "parityErrs", 8, UBX_MSGDB_U2, 1, 0, 753, 0 },
+    { "framingErrs", 10, UBX_MSGDB_U2, 1, 0, 753, 0 },
+    { "overrunErrs", 12, UBX_MSGDB_U2, 1, 0, 753, 0 },
+    { "breakCond", 14, UBX_MSGDB_U2, 1, 0, 753, 0 },
+    { "reserved0", 16, UBX_MSGDB_U1, 4, 1, 753, 0 },
+    { "swVersion", 0, UBX_MSGDB_CH, 30, 0, 753, 0 },
+    { "hwVersion", 30, UBX_MSGDB_CH, 10, 0, 753, 0 },
+    { "extension", 0, UBX_MSGDB_CH, 30, 0, 753, 0 },
+    { "msg1", 0, UBX_MSGDB_U2, 8, 0, 753, 0 },
+    { "msg2", 16, UBX_MSGDB_U2, 8, 0, 753, 0 },
+    { "msg3", 32, UBX_MSGDB_U2, 8, 0, 753, 0 },
+    { "msg4", 48, UBX_MSGDB_U2, 8, 0, 753, 0 },
+    { "msg5", 64, UBX_MSGDB_U2, 8, 0, 753, 0 },
+    { "msg6", 80, UBX_MSGDB_U2, 8, 0, 753, 0 },
+    { "skipped", 96, UBX_MSGDB_U4, 6, 0, 753, 0 },
+    { "pending", 0, UBX_MSGDB_U2, 6, 0, 753, 0 },
+    { "usage", 12, UBX_MSGDB_U1, 6, 0, 753, 0 },
+    { "peakUsage", 18, UBX_MSGDB_U1, 6, 0, 753, 0 },
+    { "pending", 0, UBX_MSGDB_U2, 6, 0, 753, 0 },
+    { "usage", 12, UBX_MSGDB_U1, 6, 0, 753, 0 },
+    { "peakUsage", 18, UBX_MSGDB_U1, 6, 0, 753, 0 },
+    { "tUsage", 24, UBX_MSGDB_U1, 1, 0, 753, 0 },
+    { "tPeakusage", 25, UBX_MSGDB_U1, 1, 0, 753, 0 },
+    { "errors", 26, UBX_MSGDB_X1, 1, 0, 753, 3 },
+    { "reserved0", 27, UBX_MSGDB_U1, 1, 1, 756, 0 },
+    { "pinSel", 0, UBX_MSGDB_X4, 1, 0, 756, 0 },
+    { "pinBank", 4, UBX_MSGDB_X4, 1, 0, 756, 0 },
+    { "pinDir", 8, UBX_MSGDB_X4, 1, 0, 756, 0 },
+    { "pinVal", 12, UBX_MSGDB_X4, 1, 0, 756, 0 },
+    { "noisePerMS", 16, UBX_MSGDB_U2, 1, 0, 756, 0 },
+    { "agcCnt", 18, UBX_MSGDB_U2, 1, 0, 756, 0 },
+    { "aStatus", 20, UBX_MSGDB_U1, 1, 0, 756, 0 },  // 1500
+    { "aPower", 21, UBX_MSGDB_U1, 1, 0, 756, 0 },
+    { "flags", 22, UBX_MSGDB_X1, 1, 0, 756, 1 },
+    { "reserved0", 23, UBX_MSGDB_U1, 1, 1, 757, 0 },
+    { "usedMask", 24, UBX_MSGDB_X4, 1, 0, 757, 0 },
+    { "VP", 28, UBX_MSGDB_U1, 25, 0, 757, 0 },
+    { "reserved1", 53, UBX_MSGDB_U1, 3, 1, 757, 0 },
+    { "pinIrq", 56, UBX_MSGDB_X4, 1, 0, 757, 0 },
+    { "pullH", 60, UBX_MSGDB_X4, 1, 0, 757, 0 },
+    { "pullL", 64, UBX_MSGDB_X4, 1, 0, 757, 0 },
+    { "pinSel", 0, UBX_MSGDB_X4, 1, 0, 757, 0 },
+    { "pinBank", 4, UBX_MSGDB_X4, 1, 0, 757, 0 },
+    { "pinDir", 8, UBX_MSGDB_X4, 1, 0, 757, 0 },
+    { "pinVal", 12, UBX_MSGDB_X4, 1, 0, 757, 0 },
+    { "noisePerMS", 16, UBX_MSGDB_U2, 1, 0, 757, 0 },
+    { "agcCnt", 18, UBX_MSGDB_U2, 1, 0, 757, 0 },
+    { "aStatus", 20, UBX_MSGDB_U1, 1, 0, 757, 0 },
+    { "aPower", 21, UBX_MSGDB_U1, 1, 0, 757, 0 },
+    { "flags", 22, UBX_MSGDB_X1, 1, 0, 757, 2 },
+    { "reserved0", 23, UBX_MSGDB_U1, 1, 1, 759, 0 },
+    { "usedMask", 24, UBX_MSGDB_X4, 1, 0, 759, 0 },
+    { "VP", 28, UBX_MSGDB_U1, 25, 0, 759, 0 },
+    { "cwSuppression", 53, UBX_MSGDB_U1, 1, 0, 759, 0 },
+    { "reserved1", 54, UBX_MSGDB_U1, 2, 1, 759, 0 },
+    { "pinIrq", 56, UBX_MSGDB_X4, 1, 0, 759, 0 },
+    { "pullH", 60, UBX_MSGDB_X4, 1, 0, 759, 0 },
+    { "pullL", 64, UBX_MSGDB_X4, 1, 0, 759, 0 },
+    { "pinSel", 0, UBX_MSGDB_X4, 1, 0, 759, 0 },
+    { "pinBank", 4, UBX_MSGDB_X4, 1, 0, 759, 0 },
+    { "pinDir", 8, UBX_MSGDB_X4, 1, 0, 759, 0 },
+    { "pinVal", 12, UBX_MSGDB_X4, 1, 0, 759, 0 },
+    { "noisePerMS", 16, UBX_MSGDB_U2, 1, 0, 759, 0 },
+    { "agcCnt", 18, UBX_MSGDB_U2, 1, 0, 759, 0 },
+    { "aStatus", 20, UBX_MSGDB_U1, 1, 0, 759, 0 },
+    { "aPower", 21, UBX_MSGDB_U1, 1, 0, 759, 0 },
+    { "flags", 22, UBX_MSGDB_X1, 1, 0, 759, 3 },
+    { "reserved0", 23, UBX_MSGDB_U1, 1, 1, 762, 0 },
+    { "usedMask", 24, UBX_MSGDB_X4, 1, 0, 762, 0 },
+    { "VP", 28, UBX_MSGDB_U1, 25, 0, 762, 0 },
+    { "cwSuppression", 53, UBX_MSGDB_U1, 1, 0, 762, 0 },
+    { "reserved1", 54, UBX_MSGDB_U1, 2, 1, 762, 0 },
+    { "pinIrq", 56, UBX_MSGDB_X4, 1, 0, 762, 0 },
+    { "pullH", 60, UBX_MSGDB_X4, 1, 0, 762, 0 },
+    { "pullL", 64, UBX_MSGDB_X4, 1, 0, 762, 0 },
+    { "pinSel", 0, UBX_MSGDB_X4, 1, 0, 762, 0 },
+    { "pinBank", 4, UBX_MSGDB_X4, 1, 0, 762, 0 },
+    { "pinDir", 8, UBX_MSGDB_X4, 1, 0, 762, 0 },
+    { "pinVal", 12, UBX_MSGDB_X4, 1, 0, 762, 0 },
+    { "noisePerMS", 16, UBX_MSGDB_U2, 1, 0, 762, 0 },
+    { "agcCnt", 18, UBX_MSGDB_U2, 1, 0, 762, 0 },
+    { "aStatus", 20, UBX_MSGDB_U1, 1, 0, 762, 0 },  // 1550
+    { "aPower", 21, UBX_MSGDB_U1, 1, 0, 762, 0 },
+    { "flags", 22, UBX_MSGDB_X1, 1, 0, 762, 4 },
+    { "reserved0", 23, UBX_MSGDB_U1, 1, 1, 766, 0 },
+    { "usedMask", 24, UBX_MSGDB_X4, 1, 0, 766, 0 },
+    { "VP", 28, UBX_MSGDB_U1, 17, 0, 766, 0 },
+    { "cwSuppression", 45, UBX_MSGDB_U1, 1, 0, 766, 0 },
+    { "reserved1", 46, UBX_MSGDB_U1, 2, 1, 766, 0 },
+    { "pinIrq", 48, UBX_MSGDB_X4, 1, 0, 766, 0 },
+    { "pullH", 52, UBX_MSGDB_X4, 1, 0, 766, 0 },
+    { "pullL", 56, UBX_MSGDB_X4, 1, 0, 766, 0 },
+    { "reserved0", 0, UBX_MSGDB_U1, 56, 1, 766, 0 },
+    { "reserved0", 0, UBX_MSGDB_U1, 76, 1, 766, 0 },
+    { "ofsI", 0, UBX_MSGDB_I1, 1, 0, 766, 0 },
+    { "magI", 1, UBX_MSGDB_U1, 1, 0, 766, 0 },
+    { "ofsQ", 2, UBX_MSGDB_I1, 1, 0, 766, 0 },
+    { "magQ", 3, UBX_MSGDB_U1, 1, 0, 766, 0 },
+    { "cfgSource", 4, UBX_MSGDB_U1, 1, 0, 766, 0 },
+    { "reserved0", 5, UBX_MSGDB_U1, 3, 1, 766, 0 },
+    { "lowLevCfg", 8, UBX_MSGDB_U4, 1, 0, 766, 0 },
+    { "reserved1", 12, UBX_MSGDB_U1, 8, 1, 766, 0 },
+    { "postStatus", 20, UBX_MSGDB_U4, 1, 0, 766, 0 },
+    { "reserved2", 24, UBX_MSGDB_U1, 4, 1, 766, 0 },
+    { "flags", 0, UBX_MSGDB_X1, 1, 0, 766, 1 },
+    { "version", 0, UBX_MSGDB_U2, 1, 0, 767, 0 },
+    { "nEntries", 2, UBX_MSGDB_U2, 1, 0, 767, 0 },
+    { "patchInfo", 0, UBX_MSGDB_X4, 1, 0, 767, 2 },
+    { "comparatorNumber", 4, UBX_MSGDB_U4, 1, 0, 769, 0 },
+    { "patchAddress", 8, UBX_MSGDB_U4, 1, 0, 769, 0 },
+    { "patchData", 12, UBX_MSGDB_U4, 1, 0, 769, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 769, 0 },
+    { "supported", 1, UBX_MSGDB_X1, 1, 0, 769, 4 },
+    { "defaultGnss", 2, UBX_MSGDB_X1, 1, 0, 773, 4 },
+    { "enabled", 3, UBX_MSGDB_X1, 1, 0, 777, 4 },
+    { "simultaneous", 4, UBX_MSGDB_U1, 1, 0, 781, 0 },
+    { "reserved0", 5, UBX_MSGDB_U1, 3, 1, 781, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 781, 0 },
+    { "numPlans", 1, UBX_MSGDB_U1, 1, 0, 781, 0 },
+    { "activePlanInfo", 2, UBX_MSGDB_X2, 1, 0, 781, 2 },
+    { "id", 0, UBX_MSGDB_U1, 1, 0, 783, 0 },
+    { "name", 1, UBX_MSGDB_CH, 5, 0, 783, 0 },
+    { "gpsSup", 6, UBX_MSGDB_X2, 1, 0, 783, 4 },
+    { "galSup", 8, UBX_MSGDB_X2, 1, 0, 787, 4 },
+    { "bdsSup", 10, UBX_MSGDB_X2, 1, 0, 791, 5 },
+    { "gloSup", 12, UBX_MSGDB_X2, 1, 0, 796, 2 },
+    { "sbasSup", 14, UBX_MSGDB_X2, 1, 0, 798, 1 },
+    { "qzssSup", 16, UBX_MSGDB_X2, 1, 0, 799, 6 },
+    { "navicSup", 18, UBX_MSGDB_X2, 1, 0, 805, 1 },
+    { "lbandSup", 20, UBX_MSGDB_X2, 1, 0, 806, 1 },
+    { "reserved0", 22, UBX_MSGDB_U1, 6, 1, 807, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 807, 0 },  // 1600
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 807, 0 },
+    { "iTOW", 4, UBX_MSGDB_U4, 1, 0, 807, 0 },
+    { "intOsc", 8, UBX_MSGDB_X2, 1, 0, 807, 3 },
+    { "extOsc", 10, UBX_MSGDB_X2, 1, 0, 810, 3 },
+    { "discSrc", 12, UBX_MSGDB_U1, 1, 0, 813, 0 },
+    { "gnss", 13, UBX_MSGDB_X1, 1, 0, 813, 1 },
+    { "extInt0", 14, UBX_MSGDB_X1, 1, 0, 814, 3 },
+    { "extInt1", 15, UBX_MSGDB_X1, 1, 0, 817, 3 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 820, 0 },
+    { "numSensor", 1, UBX_MSGDB_U1, 1, 0, 820, 0 },
+    { "numRes", 2, UBX_MSGDB_U1, 1, 0, 820, 0 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 820, 0 },
+    { "sensorId", 0, UBX_MSGDB_U1, 1, 0, 820, 0 },
+    { "drvVer", 1, UBX_MSGDB_X1, 1, 0, 820, 2 },
+    { "testState", 2, UBX_MSGDB_U1, 1, 0, 822, 0 },
+    { "drvFileName", 3, UBX_MSGDB_U1, 1, 0, 822, 0 },
+    { "sensorIdRes", 0, UBX_MSGDB_U2, 1, 0, 822, 0 },
+    { "sensorType", 2, UBX_MSGDB_U2, 1, 0, 822, 0 },
+    { "resType", 4, UBX_MSGDB_U2, 1, 0, 822, 0 },
+    { "reserved1", 6, UBX_MSGDB_U1, 2, 1, 822, 0 },
+    { "value", 8, UBX_MSGDB_I4, 1, 0, 822, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 822, 0 },
+    { "numRfBlocks", 1, UBX_MSGDB_U1, 1, 0, 822, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 822, 0 },
+    { "spectrum", 0, UBX_MSGDB_U1, 256, 0, 822, 0 },
+    { "span", 256, UBX_MSGDB_U4, 1, 0, 822, 0 },
+    { "res", 260, UBX_MSGDB_U4, 1, 0, 822, 0 },
+    { "center", 264, UBX_MSGDB_U4, 1, 0, 822, 0 },
+    { "pga", 268, UBX_MSGDB_U1, 1, 0, 822, 0 },
+    { "reserved1", 269, UBX_MSGDB_U1, 3, 1, 822, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 822, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 822, 0 },
+    { "fillLevel", 4, UBX_MSGDB_U2, 1, 0, 822, 0 },
+    { "dropsAll", 6, UBX_MSGDB_U2, 1, 0, 822, 0 },
+    { "dropsSinceMon", 8, UBX_MSGDB_U2, 1, 0, 822, 0 },
+    { "nextMsgCnt", 10, UBX_MSGDB_U2, 1, 0, 822, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 822, 0 },
+    { "nEntries", 1, UBX_MSGDB_U1, 1, 0, 822, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 822, 0 },
+    { "reserved1", 0, UBX_MSGDB_U1, 4, 1, 822, 0 },
+    { "status", 4, UBX_MSGDB_X4, 1, 0, 822, 2 },
+    { "reserved2", 8, UBX_MSGDB_U1, 8, 1, 824, 0 },
+    { "cno", 16, UBX_MSGDB_U1, 1, 0, 824, 0 },
+    { "cnoFrac", 17, UBX_MSGDB_U1, 1, 0, 824, 0 },
+    { "reserved3", 18, UBX_MSGDB_U1, 2, 1, 824, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 824, 0 },
+    { "nPorts", 1, UBX_MSGDB_U1, 1, 0, 824, 0 },
+    { "txErrors", 2, UBX_MSGDB_X1, 1, 0, 824, 3 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 827, 0 },
+    { "protIds", 4, UBX_MSGDB_U1, 4, 0, 827, 0 },  // 1650
+    { "portId", 0, UBX_MSGDB_U2, 1, 0, 827, 0 },
+    { "txPending", 2, UBX_MSGDB_U2, 1, 0, 827, 0 },
+    { "txBytes", 4, UBX_MSGDB_U4, 1, 0, 827, 0 },
+    { "txUsage", 8, UBX_MSGDB_U1, 1, 0, 827, 0 },
+    { "txPeakUsage", 9, UBX_MSGDB_U1, 1, 0, 827, 0 },
+    { "rxPending", 10, UBX_MSGDB_U2, 1, 0, 827, 0 },
+    { "rxBytes", 12, UBX_MSGDB_U4, 1, 0, 827, 0 },
+    { "rxUsage", 16, UBX_MSGDB_U1, 1, 0, 827, 0 },
+    { "rxPeakUsage", 17, UBX_MSGDB_U1, 1, 0, 827, 0 },
+    { "overrunErrs", 18, UBX_MSGDB_U2, 1, 0, 827, 0 },
+    { "msgs", 20, UBX_MSGDB_U2, 4, 0, 827, 0 },
+    { "reserved1", 28, UBX_MSGDB_U1, 8, 1, 827, 0 },
+    { "skipped", 36, UBX_MSGDB_U4, 1, 0, 827, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 827, 0 },
+    { "nPins", 1, UBX_MSGDB_U1, 1, 0, 827, 0 },
+    { "flags", 2, UBX_MSGDB_X1, 1, 0, 827, 3 },
+    { "hwVersion", 3, UBX_MSGDB_CH, 10, 0, 830, 0 },
+    { "reserved0", 13, UBX_MSGDB_U1, 9, 1, 830, 0 },
+    { "reserved1", 0, UBX_MSGDB_U1, 1, 1, 830, 0 },
+    { "pinId", 1, UBX_MSGDB_U1, 1, 0, 830, 0 },
+    { "pinMask", 2, UBX_MSGDB_X2, 1, 0, 830, 8 },
+    { "VP", 4, UBX_MSGDB_U1, 1, 0, 838, 0 },
+    { "reserved2", 5, UBX_MSGDB_U1, 1, 1, 838, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 838, 0 },
+    { "nBlocks", 1, UBX_MSGDB_U1, 1, 0, 838, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 838, 0 },
+    { "blockId", 0, UBX_MSGDB_U1, 1, 0, 838, 0 },
+    { "flags", 1, UBX_MSGDB_X1, 1, 0, 838, 1 },
+    { "antStatus", 2, UBX_MSGDB_U1, 1, 0, 839, 0 },
+    { "antPower", 3, UBX_MSGDB_U1, 1, 0, 839, 0 },
+    { "postStatus", 4, UBX_MSGDB_U4, 1, 0, 839, 0 },
+    { "reserved1", 8, UBX_MSGDB_U1, 4, 1, 839, 0 },
+    { "noisePerMS", 12, UBX_MSGDB_U2, 1, 0, 839, 0 },
+    { "agcCnt", 14, UBX_MSGDB_U2, 1, 0, 839, 0 },
+    { "cwSuppression", 16, UBX_MSGDB_U1, 1, 0, 839, 0 },
+    { "ofsI", 17, UBX_MSGDB_I1, 1, 0, 839, 0 },
+    { "magI", 18, UBX_MSGDB_U1, 1, 0, 839, 0 },
+    { "ofsQ", 19, UBX_MSGDB_I1, 1, 0, 839, 0 },
+    { "magQ", 20, UBX_MSGDB_U1, 1, 0, 839, 0 },
+    { "rfBlockGnssBand", 21, UBX_MSGDB_U1, 1, 0, 839, 0 },
+    { "reserved2", 22, UBX_MSGDB_U1, 2, 1, 839, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 839, 0 },
+    { "nBlocks", 1, UBX_MSGDB_U1, 1, 0, 839, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 839, 0 },
+    { "blockId", 0, UBX_MSGDB_U1, 1, 0, 839, 0 },
+    { "antStatus", 1, UBX_MSGDB_U1, 1, 0, 839, 0 },
+    { "antPower", 2, UBX_MSGDB_U1, 1, 0, 839, 0 },
+    { "cwSuppression", 3, UBX_MSGDB_U1, 1, 0, 839, 0 },
+    { "postStatus", 4, UBX_MSGDB_U4, 1, 0, 839, 0 },
+    { "reserved1", 8, UBX_MSGDB_U1, 4, 1, 839, 0 },  // 1700
+    { "noisePerMS", 12, UBX_MSGDB_U2, 1, 0, 839, 0 },
+    { "agcCnt", 14, UBX_MSGDB_U2, 1, 0, 839, 0 },
+    { "ofsI", 16, UBX_MSGDB_I1, 1, 0, 839, 0 },
+    { "magI", 17, UBX_MSGDB_U1, 1, 0, 839, 0 },
+    { "ofsQ", 18, UBX_MSGDB_I1, 1, 0, 839, 0 },
+    { "magQ", 19, UBX_MSGDB_U1, 1, 0, 839, 0 },
+    { "msgVer", 0, UBX_MSGDB_U1, 1, 0, 839, 0 },
+    { "bootType", 1, UBX_MSGDB_U1, 1, 0, 839, 0 },
+    { "cpuLoad", 2, UBX_MSGDB_U1, 1, 0, 839, 0 },
+    { "cpuLoadMax", 3, UBX_MSGDB_U1, 1, 0, 839, 0 },
+    { "memUsage", 4, UBX_MSGDB_U1, 1, 0, 839, 0 },
+    { "memUsageMax", 5, UBX_MSGDB_U1, 1, 0, 839, 0 },
+    { "ioUsage", 6, UBX_MSGDB_U1, 1, 0, 839, 0 },
+    { "ioUsageMax", 7, UBX_MSGDB_U1, 1, 0, 839, 0 },
+    { "runTime", 8, UBX_MSGDB_U4, 1, 0, 839, 0 },
+    { "noticeCount", 12, UBX_MSGDB_U2, 1, 0, 839, 0 },
+    { "warnCount", 14, UBX_MSGDB_U2, 1, 0, 839, 0 },
+    { "errorCount", 16, UBX_MSGDB_U2, 1, 0, 839, 0 },
+    { "tempValue", 18, UBX_MSGDB_I1, 1, 0, 839, 0 },
+    { "reserved0", 19, UBX_MSGDB_U1, 5, 1, 839, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 839, 0 },
+    { "flags", 1, UBX_MSGDB_X1, 1, 0, 839, 1 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 840, 0 },
+    { "postStatus", 4, UBX_MSGDB_U4, 1, 0, 840, 0 },
+    { "reserved1", 8, UBX_MSGDB_U1, 4, 1, 840, 0 },
+    { "rxTtag", 0, UBX_MSGDB_U4, 1, 0, 840, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 840, 0 },
+    { "countEpoch", 5, UBX_MSGDB_U1, 1, 0, 840, 0 },
+    { "usedSVs", 6, UBX_MSGDB_U1, 1, 0, 840, 0 },
+    { "maxCNO", 7, UBX_MSGDB_U1, 1, 0, 840, 0 },
+    { "pDOP", 8, UBX_MSGDB_U2, 1, 0, 840, 0 },
+    { "gnssFixStatus", 10, UBX_MSGDB_X1, 1, 0, 840, 2 },
+    { "statusFlags", 11, UBX_MSGDB_X1, 1, 0, 842, 7 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 849, 0 },
+    { "sbas", 0, UBX_MSGDB_X1, 1, 0, 849, 4 },
+    { "navic", 1, UBX_MSGDB_X1, 1, 0, 853, 4 },
+    { "reserved0", 2, UBX_MSGDB_U1, 1, 1, 857, 0 },
+    { "gps", 3, UBX_MSGDB_X4, 1, 0, 857, 10 },
+    { "gal", 7, UBX_MSGDB_X4, 1, 0, 867, 10 },
+    { "qzss", 11, UBX_MSGDB_X4, 1, 0, 877, 12 },
+    { "bds", 15, UBX_MSGDB_X4, 1, 0, 889, 10 },
+    { "glo", 19, UBX_MSGDB_X2, 1, 0, 899, 8 },
+    { "lnaMode", 0, UBX_MSGDB_X2, 1, 0, 907, 3 },
+    { "reserved1", 0, UBX_MSGDB_U1, 4, 1, 910, 0 },
+    { "reserved2", 0, UBX_MSGDB_U1, 4, 1, 910, 0 },
+    { "reserved3", 0, UBX_MSGDB_U1, 4, 1, 910, 0 },
+    { "uartBitfield", 0, UBX_MSGDB_X4, 1, 0, 910, 10 },
+    { "uartBaudrate", 4, UBX_MSGDB_X4, 1, 0, 920, 2 },
+    { "spiBitfield", 0, UBX_MSGDB_X4, 1, 0, 922, 10 },
+    { "i2cBitfield", 0, UBX_MSGDB_X4, 1, 0, 932, 8 },  // 1750
+    { "reserved4", 0, UBX_MSGDB_U1, 1, 1, 940, 0 },
+    { "operatemode", 1, UBX_MSGDB_X1, 1, 0, 940, 3 },
+    { "status", 0, UBX_MSGDB_X1, 1, 0, 943, 2 },
+    { "switchPin", 1, UBX_MSGDB_X1, 1, 0, 945, 2 },
+    { "shortPin", 2, UBX_MSGDB_X1, 1, 0, 947, 2 },
+    { "openPin", 3, UBX_MSGDB_X1, 1, 0, 949, 2 },
+    { "reserved5", 4, UBX_MSGDB_U1, 4, 1, 951, 0 },
+    { "recInt", 8, UBX_MSGDB_X2, 1, 0, 951, 2 },
+    { "antSupBitfield", 10, UBX_MSGDB_X4, 1, 0, 953, 16 },
+    { "shortUs", 14, UBX_MSGDB_X4, 1, 0, 969, 2 },
+    { "reserved6", 0, UBX_MSGDB_U1, 4, 1, 971, 0 },
+    { "reserved7", 4, UBX_MSGDB_U1, 2, 1, 971, 0 },
+    { "reserved8", 6, UBX_MSGDB_U1, 2, 1, 971, 0 },
+    { "reserved9", 0, UBX_MSGDB_U1, 4, 1, 971, 0 },
+    { "ecefXOrLat", 0, UBX_MSGDB_I4, 1, 0, 971, 0 },
+    { "ecefYOrLon", 4, UBX_MSGDB_I4, 1, 0, 971, 0 },
+    { "ecefZOrAlt", 8, UBX_MSGDB_I4, 1, 0, 971, 0 },
+    { "posAcc", 12, UBX_MSGDB_U4, 1, 0, 971, 0 },
+    { "tmCfg", 16, UBX_MSGDB_X2, 1, 0, 971, 3 },
+    { "wn", 18, UBX_MSGDB_U2, 1, 0, 974, 0 },
+    { "tow", 20, UBX_MSGDB_U4, 1, 0, 974, 0 },
+    { "towNs", 24, UBX_MSGDB_I4, 1, 0, 974, 0 },
+    { "tAccMs", 28, UBX_MSGDB_U4, 1, 0, 974, 0 },
+    { "tAccNs", 32, UBX_MSGDB_U4, 1, 0, 974, 0 },
+    { "clkDOrFreq", 36, UBX_MSGDB_I4, 1, 0, 974, 0 },
+    { "clkDAccOrFreqAcc", 40, UBX_MSGDB_U4, 1, 0, 974, 0 },
+    { "flags", 44, UBX_MSGDB_X4, 1, 0, 974, 8 },
+    { "ecefXOrLat", 0, UBX_MSGDB_I4, 1, 0, 982, 0 },
+    { "ecefYOrLon", 4, UBX_MSGDB_I4, 1, 0, 982, 0 },
+    { "ecefZOrAlt", 8, UBX_MSGDB_I4, 1, 0, 982, 0 },
+    { "posAcc", 12, UBX_MSGDB_U4, 1, 0, 982, 0 },
+    { "tmCfg", 16, UBX_MSGDB_X2, 1, 0, 982, 3 },
+    { "wnoOrDate", 18, UBX_MSGDB_U2, 1, 0, 985, 0 },
+    { "towOrTime", 20, UBX_MSGDB_U4, 1, 0, 985, 0 },
+    { "towNs", 24, UBX_MSGDB_I4, 1, 0, 985, 0 },
+    { "tAccMs", 28, UBX_MSGDB_U4, 1, 0, 985, 0 },
+    { "tAccNs", 32, UBX_MSGDB_U4, 1, 0, 985, 0 },
+    { "clkDOrFreq", 36, UBX_MSGDB_I4, 1, 0, 985, 0 },
+    { "clkDAccOrFreqAcc", 40, UBX_MSGDB_U4, 1, 0, 985, 0 },
+    { "flags", 44, UBX_MSGDB_X4, 1, 0, 985, 9 },
+    { "ecefXOrLat", 0, UBX_MSGDB_I4, 1, 0, 994, 0 },
+    { "ecefYOrLon", 4, UBX_MSGDB_I4, 1, 0, 994, 0 },
+    { "ecefZOrAlt", 8, UBX_MSGDB_I4, 1, 0, 994, 0 },
+    { "posAcc", 12, UBX_MSGDB_U4, 1, 0, 994, 0 },
+    { "tmCfg", 16, UBX_MSGDB_X2, 1, 0, 994, 3 },
+    { "wnoOrDate", 18, UBX_MSGDB_U2, 1, 0, 997, 0 },
+    { "towOrTime", 20, UBX_MSGDB_U4, 1, 0, 997, 0 },
+    { "towNs", 24, UBX_MSGDB_I4, 1, 0, 997, 0 },
+    { "tAccMs", 28, UBX_MSGDB_U4, 1, 0, 997, 0 },
+    { "tAccNs", 32, UBX_MSGDB_U4, 1, 0, 997, 0 },  // 1800
+    { "clkDOrFreq", 36, UBX_MSGDB_I4, 1, 0, 997, 0 },
+    { "clkDAccOrFreqAcc", 40, UBX_MSGDB_U4, 1, 0, 997, 0 },
+    { "flags", 44, UBX_MSGDB_X4, 1, 0, 997, 9 },
+    { "health", 0, UBX_MSGDB_X4, 1, 0, 1006, 0 },
+    { "utcA0", 4, UBX_MSGDB_R8, 1, 0, 1006, 0 },
+    { "utcA1", 12, UBX_MSGDB_R8, 1, 0, 1006, 0 },
+    { "utcTOW", 20, UBX_MSGDB_I4, 1, 0, 1006, 0 },
+    { "utcWNT", 24, UBX_MSGDB_I2, 1, 0, 1006, 0 },
+    { "utcLS", 26, UBX_MSGDB_I2, 1, 0, 1006, 0 },
+    { "utcWNF", 28, UBX_MSGDB_I2, 1, 0, 1006, 0 },
+    { "utcDN", 30, UBX_MSGDB_I2, 1, 0, 1006, 0 },
+    { "utcLSF", 32, UBX_MSGDB_I2, 1, 0, 1006, 0 },
+    { "utcSpare", 34, UBX_MSGDB_I2, 1, 0, 1006, 0 },
+    { "klobA0", 36, UBX_MSGDB_R4, 1, 0, 1006, 0 },
+    { "klobA1", 40, UBX_MSGDB_R4, 1, 0, 1006, 0 },
+    { "klobA2", 44, UBX_MSGDB_R4, 1, 0, 1006, 0 },
+    { "klobA3", 48, UBX_MSGDB_R4, 1, 0, 1006, 0 },
+    { "klobB0", 52, UBX_MSGDB_R4, 1, 0, 1006, 0 },
+    { "klobB1", 56, UBX_MSGDB_R4, 1, 0, 1006, 0 },
+    { "klobB2", 60, UBX_MSGDB_R4, 1, 0, 1006, 0 },
+    { "klobB3", 64, UBX_MSGDB_R4, 1, 0, 1006, 0 },
+    { "flags", 68, UBX_MSGDB_X4, 1, 0, 1006, 3 },
+    { "svid", 0, UBX_MSGDB_U1, 1, 0, 1009, 0 },
+    { "svid", 0, UBX_MSGDB_U4, 1, 0, 1009, 0 },
+    { "week", 4, UBX_MSGDB_U4, 1, 0, 1009, 0 },
+    { "dwrd", 0, UBX_MSGDB_U4, 8, 0, 1009, 0 },
+    { "svid", 0, UBX_MSGDB_U1, 1, 0, 1009, 0 },
+    { "svid", 0, UBX_MSGDB_U4, 1, 0, 1009, 0 },
+    { "how", 4, UBX_MSGDB_U4, 1, 0, 1009, 0 },
+    { "sf1d", 0, UBX_MSGDB_U4, 8, 0, 1009, 0 },
+    { "sf2d", 32, UBX_MSGDB_U4, 8, 0, 1009, 0 },
+    { "sf3d", 64, UBX_MSGDB_U4, 8, 0, 1009, 0 },
+    { "idSize", 0, UBX_MSGDB_U1, 1, 0, 1009, 0 },
+    { "type", 1, UBX_MSGDB_U1, 1, 0, 1009, 0 },
+    { "ofs", 2, UBX_MSGDB_U2, 1, 0, 1009, 0 },
+    { "size", 4, UBX_MSGDB_U2, 1, 0, 1009, 0 },
+    { "fileId", 6, UBX_MSGDB_U2, 1, 0, 1009, 0 },
+    { "dataSize", 8, UBX_MSGDB_U2, 1, 0, 1009, 0 },
+    { "id1", 10, UBX_MSGDB_U1, 1, 0, 1009, 0 },
+    { "id2", 11, UBX_MSGDB_U1, 1, 0, 1009, 0 },
+    { "id3", 12, UBX_MSGDB_U4, 1, 0, 1009, 0 },
+    { "idSize", 0, UBX_MSGDB_U1, 1, 0, 1009, 0 },
+    { "type", 1, UBX_MSGDB_U1, 1, 0, 1009, 0 },
+    { "ofs", 2, UBX_MSGDB_U2, 1, 0, 1009, 0 },
+    { "size", 4, UBX_MSGDB_U2, 1, 0, 1009, 0 },
+    { "fileId", 6, UBX_MSGDB_U2, 1, 0, 1009, 0 },
+    { "dataSize", 8, UBX_MSGDB_U2, 1, 0, 1009, 0 },
+    { "id1", 10, UBX_MSGDB_U1, 1, 0, 1009, 0 },
+    { "id2", 11, UBX_MSGDB_U1, 1, 0, 1009, 0 },
+    { "id3", 12, UBX_MSGDB_U4, 1, 0, 1009, 0 },  // 1850
+    { "data", 0, UBX_MSGDB_U1, 1, 0, 1009, 0 },
+    { "idSize", 0, UBX_MSGDB_U1, 1, 0, 1009, 0 },
+    { "type", 1, UBX_MSGDB_U1, 1, 0, 1009, 0 },
+    { "ofs", 2, UBX_MSGDB_U2, 1, 0, 1009, 0 },
+    { "size", 4, UBX_MSGDB_U2, 1, 0, 1009, 0 },
+    { "fileId", 6, UBX_MSGDB_U2, 1, 0, 1009, 0 },
+    { "data", 0, UBX_MSGDB_U2, 1, 0, 1009, 0 },
+    { "svid", 0, UBX_MSGDB_U1, 1, 0, 1009, 0 },
+    { "svid", 0, UBX_MSGDB_U1, 1, 0, 1009, 0 },
+    { "data", 1, UBX_MSGDB_U1, 47, 0, 1009, 0 },
+    { "optional0", 0, UBX_MSGDB_U1, 48, 0, 1009, 0 },
+    { "optional1", 48, UBX_MSGDB_U1, 48, 0, 1009, 0 },
+    { "optional2", 96, UBX_MSGDB_U1, 48, 0, 1009, 0 },
+    { "svid", 0, UBX_MSGDB_U1, 1, 0, 1009, 0 },
+    { "data", 1, UBX_MSGDB_U1, 59, 0, 1009, 0 },
+    { "optional0", 0, UBX_MSGDB_U1, 48, 0, 1009, 0 },
+    { "optional1", 48, UBX_MSGDB_U1, 48, 0, 1009, 0 },
+    { "optional2", 96, UBX_MSGDB_U1, 48, 0, 1009, 0 },
+    { "gnssId", 0, UBX_MSGDB_U1, 1, 0, 1009, 0 },
+    { "svId", 1, UBX_MSGDB_U1, 1, 0, 1009, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 1009, 0 },
+    { "data", 0, UBX_MSGDB_U1, 64, 0, 1009, 0 },
+    { "alpData", 0, UBX_MSGDB_U2, 1, 0, 1009, 0 },
+    { "reserved0", 0, UBX_MSGDB_U1, 1, 1, 1009, 0 },
+    { "ack", 0, UBX_MSGDB_U1, 1, 0, 1009, 0 },
+    { "nak", 0, UBX_MSGDB_U1, 1, 0, 1009, 0 },
+    { "predTow", 0, UBX_MSGDB_U4, 1, 0, 1009, 0 },
+    { "predDur", 4, UBX_MSGDB_U4, 1, 0, 1009, 0 },
+    { "age", 8, UBX_MSGDB_I4, 1, 0, 1009, 0 },
+    { "predWno", 12, UBX_MSGDB_U2, 1, 0, 1009, 0 },
+    { "almWno", 14, UBX_MSGDB_U2, 1, 0, 1009, 0 },
+    { "reserved0", 16, UBX_MSGDB_U1, 4, 1, 1009, 0 },
+    { "svs", 20, UBX_MSGDB_U1, 1, 0, 1009, 0 },
+    { "reserved1", 21, UBX_MSGDB_U1, 3, 1, 1009, 0 },
+    { "predTow", 0, UBX_MSGDB_U4, 1, 0, 1009, 0 },
+    { "predDur", 4, UBX_MSGDB_U4, 1, 0, 1009, 0 },
+    { "age", 8, UBX_MSGDB_I4, 1, 0, 1009, 0 },
+    { "predWno", 12, UBX_MSGDB_U2, 1, 0, 1009, 0 },
+    { "almWno", 14, UBX_MSGDB_U2, 1, 0, 1009, 0 },
+    { "reserved0", 16, UBX_MSGDB_U1, 4, 1, 1009, 0 },
+    { "svs", 20, UBX_MSGDB_U1, 1, 0, 1009, 0 },
+    { "reserved1", 21, UBX_MSGDB_U1, 1, 1, 1009, 0 },
+    { "reserved2", 22, UBX_MSGDB_U1, 2, 1, 1009, 0 },
+    { "towMS", 0, UBX_MSGDB_U4, 1, 0, 1009, 0 },
+    { "towSubMS", 4, UBX_MSGDB_U4, 1, 0, 1009, 0 },
+    { "qErr", 8, UBX_MSGDB_I4, 1, 0, 1009, 0 },
+    { "week", 12, UBX_MSGDB_U2, 1, 0, 1009, 0 },
+    { "flags", 14, UBX_MSGDB_X1, 1, 0, 1009, 5 },
+    { "refInfo", 15, UBX_MSGDB_X1, 1, 0, 1014, 2 },
+    { "ch", 0, UBX_MSGDB_U1, 1, 0, 1016, 0 },  // 1900
+    { "flags", 1, UBX_MSGDB_X1, 1, 0, 1016, 7 },
+    { "count", 2, UBX_MSGDB_U2, 1, 0, 1023, 0 },
+    { "wnR", 4, UBX_MSGDB_U2, 1, 0, 1023, 0 },
+    { "wnF", 6, UBX_MSGDB_U2, 1, 0, 1023, 0 },
+    { "towMsR", 8, UBX_MSGDB_U4, 1, 0, 1023, 0 },
+    { "towSubMsR", 12, UBX_MSGDB_U4, 1, 0, 1023, 0 },
+    { "towMsF", 16, UBX_MSGDB_U4, 1, 0, 1023, 0 },
+    { "towSubMsF", 20, UBX_MSGDB_U4, 1, 0, 1023, 0 },
+    { "accEst", 24, UBX_MSGDB_U4, 1, 0, 1023, 0 },
+    { "dur", 0, UBX_MSGDB_U4, 1, 0, 1023, 0 },
+    { "meanX", 4, UBX_MSGDB_I4, 1, 0, 1023, 0 },
+    { "meanY", 8, UBX_MSGDB_I4, 1, 0, 1023, 0 },
+    { "meanZ", 12, UBX_MSGDB_I4, 1, 0, 1023, 0 },
+    { "meanV", 16, UBX_MSGDB_U4, 1, 0, 1023, 0 },
+    { "obs", 20, UBX_MSGDB_U4, 1, 0, 1023, 0 },
+    { "valid", 24, UBX_MSGDB_U1, 1, 0, 1023, 0 },
+    { "active", 25, UBX_MSGDB_U1, 1, 0, 1023, 0 },
+    { "reserved0", 26, UBX_MSGDB_U1, 2, 1, 1023, 0 },
+    { "itow", 0, UBX_MSGDB_I4, 1, 0, 1023, 0 },
+    { "frac", 4, UBX_MSGDB_I4, 1, 0, 1023, 0 },
+    { "deltaMs", 8, UBX_MSGDB_I4, 1, 0, 1023, 0 },
+    { "deltaNs", 12, UBX_MSGDB_I4, 1, 0, 1023, 0 },
+    { "wno", 16, UBX_MSGDB_U2, 1, 0, 1023, 0 },
+    { "flags", 18, UBX_MSGDB_X1, 1, 0, 1023, 1 },
+    { "reserved0", 19, UBX_MSGDB_U1, 1, 1, 1024, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 1024, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 1024, 0 },
+    { "value", 4, UBX_MSGDB_U4, 1, 0, 1024, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 1024, 0 },
+    { "gnssId", 1, UBX_MSGDB_U1, 1, 0, 1024, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 1024, 0 },
+    { "flags", 4, UBX_MSGDB_X4, 1, 0, 1024, 12 },
+    { "year", 8, UBX_MSGDB_U2, 1, 0, 1036, 0 },
+    { "month", 10, UBX_MSGDB_U1, 1, 0, 1036, 0 },
+    { "day", 11, UBX_MSGDB_U1, 1, 0, 1036, 0 },
+    { "hour", 12, UBX_MSGDB_U1, 1, 0, 1036, 0 },
+    { "minute", 13, UBX_MSGDB_U1, 1, 0, 1036, 0 },
+    { "second", 14, UBX_MSGDB_U1, 1, 0, 1036, 0 },
+    { "utcStandard", 15, UBX_MSGDB_U1, 1, 0, 1036, 0 },
+    { "utcOffset", 16, UBX_MSGDB_I4, 1, 0, 1036, 0 },
+    { "utcUncertainty", 20, UBX_MSGDB_U4, 1, 0, 1036, 0 },
+    { "week", 24, UBX_MSGDB_U4, 1, 0, 1036, 0 },
+    { "TOW", 28, UBX_MSGDB_U4, 1, 0, 1036, 0 },
+    { "gnssOffset", 32, UBX_MSGDB_I4, 1, 0, 1036, 0 },
+    { "gnssUncertainty", 36, UBX_MSGDB_U4, 1, 0, 1036, 0 },
+    { "intOscOffset", 40, UBX_MSGDB_I4, 1, 0, 1036, 0 },
+    { "intOscUncertainty", 44, UBX_MSGDB_U4, 1, 0, 1036, 0 },
+    { "extOscOffset", 48, UBX_MSGDB_I4, 1, 0, 1036, 0 },
+    { "extOscUncertainty", 52, UBX_MSGDB_U4, 1, 0, 1036, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 1036, 0 },  // 1950
+    { "numMeas", 1, UBX_MSGDB_U1, 1, 0, 1036, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 1036, 0 },
+    { "iTOW", 4, UBX_MSGDB_U4, 1, 0, 1036, 0 },
+    { "reserved1", 8, UBX_MSGDB_U1, 4, 1, 1036, 0 },
+    { "sourceId", 0, UBX_MSGDB_U1, 1, 0, 1036, 0 },
+    { "flags", 1, UBX_MSGDB_X1, 1, 0, 1036, 2 },
+    { "phaseOffsetFrac", 2, UBX_MSGDB_I1, 1, 0, 1038, 0 },
+    { "phaseUncFrac", 3, UBX_MSGDB_U1, 1, 0, 1038, 0 },
+    { "phaseOffset", 4, UBX_MSGDB_I4, 1, 0, 1038, 0 },
+    { "phaseUnc", 8, UBX_MSGDB_U4, 1, 0, 1038, 0 },
+    { "reserved2", 12, UBX_MSGDB_U1, 4, 1, 1038, 0 },
+    { "freqOffset", 16, UBX_MSGDB_I4, 1, 0, 1038, 0 },
+    { "freqUnc", 20, UBX_MSGDB_U4, 1, 0, 1038, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1038, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1038, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1038, 0 },
+    { "oscId", 2, UBX_MSGDB_U1, 1, 0, 1038, 0 },
+    { "srcId", 3, UBX_MSGDB_U1, 1, 0, 1038, 0 },
+    { "reserved0", 4, UBX_MSGDB_U1, 2, 1, 1038, 0 },
+    { "raw0", 6, UBX_MSGDB_U2, 1, 0, 1038, 0 },
+    { "raw1", 8, UBX_MSGDB_U2, 1, 0, 1038, 0 },
+    { "maxStepSize", 10, UBX_MSGDB_U2, 1, 0, 1038, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1038, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1038, 0 },
+    { "oscId", 2, UBX_MSGDB_U1, 1, 0, 1038, 0 },
+    { "reserved0", 3, UBX_MSGDB_U1, 3, 1, 1038, 0 },
+    { "gainUncertainty", 6, UBX_MSGDB_U2, 1, 0, 1038, 0 },
+    { "gainVco", 8, UBX_MSGDB_I4, 1, 0, 1038, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 1038, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 1038, 0 },
+    { "iTOW", 4, UBX_MSGDB_U4, 1, 0, 1038, 0 },
+    { "intDeltaFreq", 8, UBX_MSGDB_I4, 1, 0, 1038, 0 },
+    { "intDeltaFreqUnc", 12, UBX_MSGDB_U4, 1, 0, 1038, 0 },
+    { "intRaw", 16, UBX_MSGDB_U4, 1, 0, 1038, 0 },
+    { "extDeltaFreq", 20, UBX_MSGDB_I4, 1, 0, 1038, 0 },
+    { "extDeltaFreqUnc", 24, UBX_MSGDB_U4, 1, 0, 1038, 0 },
+    { "extRaw", 28, UBX_MSGDB_U4, 1, 0, 1038, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 1038, 0 },
+    { "oscId", 1, UBX_MSGDB_U1, 1, 0, 1038, 0 },
+    { "flags", 2, UBX_MSGDB_U1, 1, 0, 1038, 2 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 1040, 0 },
+    { "value", 4, UBX_MSGDB_I4, 1, 0, 1040, 0 },
+    { "timeTag", 0, UBX_MSGDB_U4, 1, 0, 1040, 0 },
+    { "flags", 4, UBX_MSGDB_X2, 1, 0, 1040, 4 },
+    { "id", 6, UBX_MSGDB_U2, 1, 0, 1044, 0 },
+    { "data", 0, UBX_MSGDB_X4, 1, 0, 1044, 2 },
+    { "calibTtag", 0, UBX_MSGDB_U4, 1, 0, 1046, 0 },
+    { "timeTag", 0, UBX_MSGDB_U4, 1, 0, 1046, 0 },
+    { "flags", 4, UBX_MSGDB_X2, 1, 0, 1046, 4 },
+    { "id", 6, UBX_MSGDB_U2, 1, 0, 1050, 0 },  // 2000
+    { "data", 0, UBX_MSGDB_X4, 1, 0, 1050, 2 },
+    { "calibTtag", 0, UBX_MSGDB_U4, 1, 0, 1052, 0 },
+    { "reserved0", 0, UBX_MSGDB_U1, 4, 1, 1052, 0 },
+    { "data", 0, UBX_MSGDB_X4, 1, 0, 1052, 2 },
+    { "sTtag", 4, UBX_MSGDB_U4, 1, 0, 1054, 0 },
+    { "sTtag", 0, UBX_MSGDB_U4, 1, 0, 1054, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 1054, 0 },
+    { "reserved0", 5, UBX_MSGDB_U1, 3, 1, 1054, 0 },
+    { "reserved1", 8, UBX_MSGDB_U1, 4, 1, 1054, 0 },
+    { "data", 0, UBX_MSGDB_X4, 1, 0, 1054, 2 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1056, 0 },
+    { "reserved0", 4, UBX_MSGDB_U1, 8, 1, 1056, 0 },
+    { "status", 12, UBX_MSGDB_U1, 1, 0, 1056, 0 },
+    { "reserved1", 13, UBX_MSGDB_U1, 2, 1, 1056, 0 },
+    { "numSens", 15, UBX_MSGDB_U1, 1, 0, 1056, 0 },
+    { "sensStatus1", 0, UBX_MSGDB_X1, 1, 0, 1056, 2 },
+    { "sensStatus2", 1, UBX_MSGDB_X1, 1, 0, 1058, 2 },
+    { "freq", 2, UBX_MSGDB_U1, 1, 0, 1060, 0 },
+    { "reserved2", 3, UBX_MSGDB_U1, 1, 1, 1060, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1060, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 1060, 0 },
+    { "reserved0", 5, UBX_MSGDB_U1, 7, 1, 1060, 0 },
+    { "status", 12, UBX_MSGDB_U1, 1, 0, 1060, 0 },
+    { "reserved1", 13, UBX_MSGDB_U1, 2, 1, 1060, 0 },
+    { "numSens", 15, UBX_MSGDB_U1, 1, 0, 1060, 0 },
+    { "sensStatus1", 0, UBX_MSGDB_X1, 1, 0, 1060, 3 },
+    { "sensStatus2", 1, UBX_MSGDB_X1, 1, 0, 1063, 2 },
+    { "freq", 2, UBX_MSGDB_U1, 1, 0, 1065, 0 },
+    { "faults", 3, UBX_MSGDB_X1, 1, 0, 1065, 4 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1069, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 1069, 0 },
+    { "initStatus1", 5, UBX_MSGDB_X1, 1, 0, 1069, 3 },
+    { "initStatus2", 6, UBX_MSGDB_X1, 1, 0, 1072, 1 },
+    { "reserved0", 7, UBX_MSGDB_U1, 5, 1, 1073, 0 },
+    { "fusionMode", 12, UBX_MSGDB_U1, 1, 0, 1073, 0 },
+    { "reserved1", 13, UBX_MSGDB_U1, 2, 1, 1073, 0 },
+    { "numSens", 15, UBX_MSGDB_U1, 1, 0, 1073, 0 },
+    { "sensStatus1", 0, UBX_MSGDB_X1, 1, 0, 1073, 3 },
+    { "sensStatus2", 1, UBX_MSGDB_X1, 1, 0, 1076, 2 },
+    { "freq", 2, UBX_MSGDB_U1, 1, 0, 1078, 0 },
+    { "faults", 3, UBX_MSGDB_X1, 1, 0, 1078, 4 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1082, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 1082, 0 },
+    { "flags", 5, UBX_MSGDB_U1, 1, 0, 1082, 2 },
+    { "error", 6, UBX_MSGDB_U1, 1, 0, 1084, 3 },
+    { "reserved0", 7, UBX_MSGDB_U1, 1, 1, 1087, 0 },
+    { "yaw", 8, UBX_MSGDB_U4, 1, 0, 1087, 0 },
+    { "pitch", 12, UBX_MSGDB_I2, 1, 0, 1087, 0 },
+    { "roll", 14, UBX_MSGDB_I2, 1, 0, 1087, 0 },
+    { "bitfield0", 0, UBX_MSGDB_U4, 1, 0, 1087, 7 },  // 2050
+    { "reserved0", 4, UBX_MSGDB_U1, 4, 1, 1094, 0 },
+    { "iTOW", 8, UBX_MSGDB_U4, 1, 0, 1094, 0 },
+    { "xAngRate", 12, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "yAngRate", 16, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "zAngRate", 20, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "xAccel", 24, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "yAccel", 28, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "zAccel", 32, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "svId", 2, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 1094, 0 },
+    { "fitInterval", 4, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "uraIndex", 5, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "svHealth", 6, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "tgd", 7, UBX_MSGDB_I1, 1, 0, 1094, 0 },
+    { "iodc", 8, UBX_MSGDB_U2, 1, 0, 1094, 0 },
+    { "toc", 10, UBX_MSGDB_U2, 1, 0, 1094, 0 },
+    { "reserved1", 12, UBX_MSGDB_U1, 1, 1, 1094, 0 },
+    { "af2", 13, UBX_MSGDB_I1, 1, 0, 1094, 0 },
+    { "af1", 14, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "af0", 16, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "crs", 20, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "deltaN", 22, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "m0", 24, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "cuc", 28, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "cus", 30, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "e", 32, UBX_MSGDB_U4, 1, 0, 1094, 0 },
+    { "sqrtA", 36, UBX_MSGDB_U4, 1, 0, 1094, 0 },
+    { "toe", 40, UBX_MSGDB_U2, 1, 0, 1094, 0 },
+    { "cic", 42, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "omega0", 44, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "cis", 48, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "crc", 50, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "i0", 52, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "omega", 56, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "omegaDot", 60, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "idot", 64, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "reserved2", 66, UBX_MSGDB_U1, 2, 1, 1094, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "svId", 2, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "svHealth", 3, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "e", 4, UBX_MSGDB_U2, 1, 0, 1094, 0 },
+    { "almWNa", 6, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "toa", 7, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "deltaI", 8, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "omegaDot", 10, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "sqrtA", 12, UBX_MSGDB_U4, 1, 0, 1094, 0 },
+    { "omega0", 16, UBX_MSGDB_I4, 1, 0, 1094, 0 },  // 2100
+    { "omega", 20, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "m0", 24, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "af0", 28, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "af1", 30, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "reserved0", 32, UBX_MSGDB_U1, 4, 1, 1094, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 1094, 0 },
+    { "healthCode", 4, UBX_MSGDB_U1, 32, 0, 1094, 0 },
+    { "reserved1", 36, UBX_MSGDB_U1, 4, 1, 1094, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 1094, 0 },
+    { "utcA0", 4, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "utcA1", 8, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "utcDtLS", 12, UBX_MSGDB_I1, 1, 0, 1094, 0 },
+    { "utcTot", 13, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "utcWNt", 14, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "utcWNlsf", 15, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "utcDn", 16, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "utcDtLSF", 17, UBX_MSGDB_I1, 1, 0, 1094, 0 },
+    { "reserved1", 18, UBX_MSGDB_U1, 2, 1, 1094, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 1094, 0 },
+    { "ionoAlpha0", 4, UBX_MSGDB_I1, 1, 0, 1094, 0 },
+    { "ionoAlpha1", 5, UBX_MSGDB_I1, 1, 0, 1094, 0 },
+    { "ionoAlpha2", 6, UBX_MSGDB_I1, 1, 0, 1094, 0 },
+    { "ionoAlpha3", 7, UBX_MSGDB_I1, 1, 0, 1094, 0 },
+    { "ionoBeta0", 8, UBX_MSGDB_I1, 1, 0, 1094, 0 },
+    { "ionoBeta1", 9, UBX_MSGDB_I1, 1, 0, 1094, 0 },
+    { "ionoBeta2", 10, UBX_MSGDB_I1, 1, 0, 1094, 0 },
+    { "ionoBeta3", 11, UBX_MSGDB_I1, 1, 0, 1094, 0 },
+    { "reserved1", 12, UBX_MSGDB_U1, 4, 1, 1094, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "svId", 2, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 1094, 0 },
+    { "iodNav", 4, UBX_MSGDB_U2, 1, 0, 1094, 0 },
+    { "deltaN", 6, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "m0", 8, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "e", 12, UBX_MSGDB_U4, 1, 0, 1094, 0 },
+    { "sqrtA", 16, UBX_MSGDB_U4, 1, 0, 1094, 0 },
+    { "omega0", 20, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "i0", 24, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "omega", 28, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "omegaDot", 32, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "iDot", 36, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "cuc", 38, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "cus", 40, UBX_MSGDB_I2, 1, 0, 1094, 0 },  // 2150
+    { "crc", 42, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "crs", 44, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "cic", 46, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "cis", 48, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "toe", 50, UBX_MSGDB_U2, 1, 0, 1094, 0 },
+    { "af0", 52, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "af1", 56, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "af2", 60, UBX_MSGDB_I1, 1, 0, 1094, 0 },
+    { "sisaIndexE1E5b", 61, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "toc", 62, UBX_MSGDB_U2, 1, 0, 1094, 0 },
+    { "bgdE1E5b", 64, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "reserved1", 66, UBX_MSGDB_U1, 2, 1, 1094, 0 },
+    { "healthE1B", 68, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "dataValidityE1B", 69, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "healthE5b", 70, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "dataValidityE5b", 71, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "reserved2", 72, UBX_MSGDB_U1, 4, 1, 1094, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "svId", 2, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 1094, 0 },
+    { "ioda", 4, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "almWNa", 5, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "toa", 6, UBX_MSGDB_U2, 1, 0, 1094, 0 },
+    { "deltaSqrtA", 8, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "e", 10, UBX_MSGDB_U2, 1, 0, 1094, 0 },
+    { "deltaI", 12, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "omega0", 14, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "omegaDot", 16, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "omega", 18, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "m0", 20, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "af0", 22, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "af1", 24, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "healthE1B", 26, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "healthE5b", 27, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "reserved1", 28, UBX_MSGDB_U1, 4, 1, 1094, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 1094, 0 },
+    { "a0G", 4, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "a1G", 6, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "t0G", 8, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "wn0G", 9, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "reserved1", 10, UBX_MSGDB_U1, 2, 1, 1094, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 1094, 0 },
+    { "a0", 4, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "a1", 8, UBX_MSGDB_I4, 1, 0, 1094, 0 },
+    { "dtLS", 12, UBX_MSGDB_I1, 1, 0, 1094, 0 },  // 2200
+    { "tot", 13, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "wnt", 14, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "wnLSF", 15, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "dN", 16, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "dTLSF", 17, UBX_MSGDB_I1, 1, 0, 1094, 0 },
+    { "reserved1", 18, UBX_MSGDB_U1, 2, 1, 1094, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 1094, 0 },
+    { "ai0", 4, UBX_MSGDB_U2, 1, 0, 1094, 0 },
+    { "ai1", 6, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "ai2", 8, UBX_MSGDB_I2, 1, 0, 1094, 0 },
+    { "sf1", 10, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "sf2", 11, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "sf3", 12, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "sf4", 13, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "sf5", 14, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "reserved1", 15, UBX_MSGDB_U1, 1, 1, 1094, 0 },
+    { "reserved2", 16, UBX_MSGDB_U1, 4, 1, 1094, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1094, 0 },
+    { "bitfield0", 2, UBX_MSGDB_X1, 1, 0, 1094, 2 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 1096, 0 },
+    { "pubKeyPoint", 4, UBX_MSGDB_U1, 67, 0, 1096, 0 },
+    { "reserved1", 71, UBX_MSGDB_U1, 1, 1, 1096, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1096, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1096, 0 },
+    { "bitfield0", 2, UBX_MSGDB_X1, 1, 0, 1096, 1 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 1097, 0 },
+    { "treeNode", 4, UBX_MSGDB_U1, 32, 0, 1097, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "svId", 2, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 1097, 0 },
+    { "SatH1", 4, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "IODC", 5, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "a2", 6, UBX_MSGDB_I2, 1, 0, 1097, 0 },
+    { "a1", 8, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "a0", 12, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "toc", 16, UBX_MSGDB_U4, 1, 0, 1097, 0 },
+    { "TGD1", 20, UBX_MSGDB_I2, 1, 0, 1097, 0 },
+    { "URAI", 22, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "IODE", 23, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "toe", 24, UBX_MSGDB_U4, 1, 0, 1097, 0 },
+    { "sqrtA", 28, UBX_MSGDB_U4, 1, 0, 1097, 0 },
+    { "e", 32, UBX_MSGDB_U4, 1, 0, 1097, 0 },
+    { "omega", 36, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "Deltan", 40, UBX_MSGDB_I2, 1, 0, 1097, 0 },
+    { "IDOT", 42, UBX_MSGDB_I2, 1, 0, 1097, 0 },
+    { "M0", 44, UBX_MSGDB_I4, 1, 0, 1097, 0 },  // 2250
+    { "Omega0", 48, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "OmegaDot", 52, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "i0", 56, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "Cuc", 60, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "Cus", 64, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "Crc", 68, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "Crs", 72, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "Cic", 76, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "Cis", 80, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "reserved1", 84, UBX_MSGDB_U1, 4, 1, 1097, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "svId", 2, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 1097, 0 },
+    { "Wna", 4, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "toa", 5, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "deltaI", 6, UBX_MSGDB_I2, 1, 0, 1097, 0 },
+    { "sqrtA", 8, UBX_MSGDB_U4, 1, 0, 1097, 0 },
+    { "e", 12, UBX_MSGDB_U4, 1, 0, 1097, 0 },
+    { "omega", 16, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "M0", 20, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "Omega0", 24, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "omegaDot", 28, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "a0", 32, UBX_MSGDB_I2, 1, 0, 1097, 0 },
+    { "a1", 34, UBX_MSGDB_I2, 1, 0, 1097, 0 },
+    { "reserved1", 36, UBX_MSGDB_U1, 4, 1, 1097, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 1097, 0 },
+    { "healthCode", 4, UBX_MSGDB_U2, 30, 0, 1097, 0 },
+    { "reserved1", 64, UBX_MSGDB_U1, 4, 1, 1097, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 1097, 0 },
+    { "a0UTC", 4, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "a1UTC", 8, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "dtLS", 12, UBX_MSGDB_I1, 1, 0, 1097, 0 },
+    { "reserved1", 13, UBX_MSGDB_U1, 1, 1, 1097, 0 },
+    { "wnRec", 14, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "wnLSF", 15, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "dN", 16, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "dtLSF", 17, UBX_MSGDB_I1, 1, 0, 1097, 0 },
+    { "reserved2", 18, UBX_MSGDB_U1, 2, 1, 1097, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 1097, 0 },
+    { "alpha0", 4, UBX_MSGDB_I1, 1, 0, 1097, 0 },
+    { "alpha1", 5, UBX_MSGDB_I1, 1, 0, 1097, 0 },
+    { "alpha2", 6, UBX_MSGDB_I1, 1, 0, 1097, 0 },
+    { "alpha3", 7, UBX_MSGDB_I1, 1, 0, 1097, 0 },  // 2300
+    { "beta0", 8, UBX_MSGDB_I1, 1, 0, 1097, 0 },
+    { "beta1", 9, UBX_MSGDB_I1, 1, 0, 1097, 0 },
+    { "beta2", 10, UBX_MSGDB_I1, 1, 0, 1097, 0 },
+    { "beta3", 11, UBX_MSGDB_I1, 1, 0, 1097, 0 },
+    { "reserved1", 12, UBX_MSGDB_U1, 4, 1, 1097, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "svId", 2, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 1097, 0 },
+    { "fitInterval", 4, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "uraIndex", 5, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "svHealth", 6, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "tgd", 7, UBX_MSGDB_I1, 1, 0, 1097, 0 },
+    { "iodc", 8, UBX_MSGDB_U2, 1, 0, 1097, 0 },
+    { "toc", 10, UBX_MSGDB_U2, 1, 0, 1097, 0 },
+    { "reserved1", 12, UBX_MSGDB_U1, 1, 1, 1097, 0 },
+    { "af2", 13, UBX_MSGDB_I1, 1, 0, 1097, 0 },
+    { "af1", 14, UBX_MSGDB_I2, 1, 0, 1097, 0 },
+    { "af0", 16, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "crs", 20, UBX_MSGDB_I2, 1, 0, 1097, 0 },
+    { "deltaN", 22, UBX_MSGDB_I2, 1, 0, 1097, 0 },
+    { "m0", 24, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "cuc", 28, UBX_MSGDB_I2, 1, 0, 1097, 0 },
+    { "cus", 30, UBX_MSGDB_I2, 1, 0, 1097, 0 },
+    { "e", 32, UBX_MSGDB_U4, 1, 0, 1097, 0 },
+    { "sqrtA", 36, UBX_MSGDB_U4, 1, 0, 1097, 0 },
+    { "toe", 40, UBX_MSGDB_U2, 1, 0, 1097, 0 },
+    { "cic", 42, UBX_MSGDB_I2, 1, 0, 1097, 0 },
+    { "omega0", 44, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "cis", 48, UBX_MSGDB_I2, 1, 0, 1097, 0 },
+    { "crc", 50, UBX_MSGDB_I2, 1, 0, 1097, 0 },
+    { "i0", 52, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "omega", 56, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "omegaDot", 60, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "idot", 64, UBX_MSGDB_I2, 1, 0, 1097, 0 },
+    { "reserved2", 66, UBX_MSGDB_U1, 2, 1, 1097, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "svId", 2, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "svHealth", 3, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "e", 4, UBX_MSGDB_U2, 1, 0, 1097, 0 },
+    { "almWNa", 6, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "toa", 7, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "deltaI", 8, UBX_MSGDB_I2, 1, 0, 1097, 0 },
+    { "omegaDot", 10, UBX_MSGDB_I2, 1, 0, 1097, 0 },
+    { "sqrtA", 12, UBX_MSGDB_U4, 1, 0, 1097, 0 },
+    { "omega0", 16, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "omega", 20, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "m0", 24, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "af0", 28, UBX_MSGDB_I2, 1, 0, 1097, 0 },  // 2350
+    { "af1", 30, UBX_MSGDB_I2, 1, 0, 1097, 0 },
+    { "reserved0", 32, UBX_MSGDB_U1, 4, 1, 1097, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 1097, 0 },
+    { "healthCode", 4, UBX_MSGDB_U1, 5, 0, 1097, 0 },
+    { "reserved1", 9, UBX_MSGDB_U1, 3, 1, 1097, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "svId", 2, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 1097, 0 },
+    { "FT", 4, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "B", 5, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "M", 6, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "H", 7, UBX_MSGDB_I1, 1, 0, 1097, 0 },
+    { "x", 8, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "y", 12, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "z", 16, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "dx", 20, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "dy", 24, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "dz", 28, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "ddx", 32, UBX_MSGDB_I1, 1, 0, 1097, 0 },
+    { "ddy", 33, UBX_MSGDB_I1, 1, 0, 1097, 0 },
+    { "ddz", 34, UBX_MSGDB_I1, 1, 0, 1097, 0 },
+    { "tb", 35, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "gamma", 36, UBX_MSGDB_I2, 1, 0, 1097, 0 },
+    { "E", 38, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "deltaTau", 39, UBX_MSGDB_I1, 1, 0, 1097, 0 },
+    { "tau", 40, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "reserved1", 44, UBX_MSGDB_U1, 4, 1, 1097, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "svId", 2, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 1097, 0 },
+    { "N", 4, UBX_MSGDB_U2, 1, 0, 1097, 0 },
+    { "M", 6, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "C", 7, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "tau", 8, UBX_MSGDB_I2, 1, 0, 1097, 0 },
+    { "epsilon", 10, UBX_MSGDB_U2, 1, 0, 1097, 0 },
+    { "lambda", 12, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "deltaI", 16, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "tLambda", 20, UBX_MSGDB_U4, 1, 0, 1097, 0 },
+    { "deltaT", 24, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "deltaDT", 28, UBX_MSGDB_I1, 1, 0, 1097, 0 },
+    { "H", 29, UBX_MSGDB_I1, 1, 0, 1097, 0 },
+    { "omega", 30, UBX_MSGDB_I2, 1, 0, 1097, 0 },
+    { "reserved1", 32, UBX_MSGDB_U1, 4, 1, 1097, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "N", 2, UBX_MSGDB_U2, 1, 0, 1097, 0 },  // 2400
+    { "tauC", 4, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "tauGps", 8, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "B1", 12, UBX_MSGDB_I2, 1, 0, 1097, 0 },
+    { "B2", 14, UBX_MSGDB_I2, 1, 0, 1097, 0 },
+    { "reserved0", 16, UBX_MSGDB_U1, 4, 1, 1097, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "nValA", 2, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "nValB", 3, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "age", 4, UBX_MSGDB_U2, 1, 0, 1097, 0 },
+    { "reserved0", 6, UBX_MSGDB_U1, 90, 1, 1097, 0 },
+    { "reserved1", 0, UBX_MSGDB_U1, 8, 1, 1097, 0 },
+    { "reserved2", 0, UBX_MSGDB_U1, 8, 1, 1097, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 462, 1, 1097, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "svId", 2, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "gnssId", 3, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "year", 0, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "month", 1, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "day", 2, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 1097, 0 },
+    { "data", 0, UBX_MSGDB_U1, 64, 0, 1097, 0 },
+    { "reserved1", 0, UBX_MSGDB_U1, 4, 1, 1097, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "sequence", 2, UBX_MSGDB_U2, 1, 0, 1097, 0 },
+    { "size", 4, UBX_MSGDB_U2, 1, 0, 1097, 0 },
+    { "data", 0, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "ack", 2, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "reserved0", 3, UBX_MSGDB_U1, 1, 1, 1097, 0 },
+    { "sequence", 4, UBX_MSGDB_U2, 1, 0, 1097, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 1097, 0 },
+    { "ecefX", 4, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "ecefY", 8, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "ecefZ", 12, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "posAcc", 16, UBX_MSGDB_U4, 1, 0, 1097, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 1097, 0 },
+    { "lat", 4, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "lon", 8, UBX_MSGDB_I4, 1, 0, 1097, 0 },  // 2450
+    { "alt", 12, UBX_MSGDB_I4, 1, 0, 1097, 0 },
+    { "posAcc", 16, UBX_MSGDB_U4, 1, 0, 1097, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1097, 0 },
+    { "ref", 2, UBX_MSGDB_X1, 1, 0, 1097, 3 },
+    { "leapSecs", 3, UBX_MSGDB_I1, 1, 0, 1100, 0 },
+    { "year", 4, UBX_MSGDB_U2, 1, 0, 1100, 0 },
+    { "month", 6, UBX_MSGDB_U1, 1, 0, 1100, 0 },
+    { "day", 7, UBX_MSGDB_U1, 1, 0, 1100, 0 },
+    { "hour", 8, UBX_MSGDB_U1, 1, 0, 1100, 0 },
+    { "minute", 9, UBX_MSGDB_U1, 1, 0, 1100, 0 },
+    { "second", 10, UBX_MSGDB_U1, 1, 0, 1100, 0 },
+    { "bitfield0", 11, UBX_MSGDB_X1, 1, 0, 1100, 1 },
+    { "ns", 12, UBX_MSGDB_U4, 1, 0, 1101, 0 },
+    { "tAccS", 16, UBX_MSGDB_U2, 1, 0, 1101, 0 },
+    { "reserved0", 18, UBX_MSGDB_U1, 2, 1, 1101, 0 },
+    { "tAccNs", 20, UBX_MSGDB_U4, 1, 0, 1101, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1101, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1101, 0 },
+    { "ref", 2, UBX_MSGDB_X1, 1, 0, 1101, 3 },
+    { "gnssId", 3, UBX_MSGDB_U1, 1, 0, 1104, 0 },
+    { "bitfield0", 4, UBX_MSGDB_X1, 1, 0, 1104, 1 },
+    { "reserved0", 5, UBX_MSGDB_U1, 1, 1, 1105, 0 },
+    { "week", 6, UBX_MSGDB_U2, 1, 0, 1105, 0 },
+    { "tow", 8, UBX_MSGDB_U4, 1, 0, 1105, 0 },
+    { "ns", 12, UBX_MSGDB_U4, 1, 0, 1105, 0 },
+    { "tAccS", 16, UBX_MSGDB_U2, 1, 0, 1105, 0 },
+    { "reserved1", 18, UBX_MSGDB_U1, 2, 1, 1105, 0 },
+    { "tAccNs", 20, UBX_MSGDB_U4, 1, 0, 1105, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1105, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1105, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 1105, 0 },
+    { "clkD", 4, UBX_MSGDB_I4, 1, 0, 1105, 0 },
+    { "clkDAcc", 8, UBX_MSGDB_U4, 1, 0, 1105, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1105, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1105, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 1, 1, 1105, 0 },
+    { "flags", 3, UBX_MSGDB_X1, 1, 0, 1105, 2 },
+    { "freq", 4, UBX_MSGDB_I4, 1, 0, 1107, 0 },
+    { "freqAcc", 8, UBX_MSGDB_U4, 1, 0, 1107, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1107, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1107, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 1107, 0 },
+    { "d2kRef", 4, UBX_MSGDB_U2, 1, 0, 1107, 0 },
+    { "d2kMax", 6, UBX_MSGDB_U2, 1, 0, 1107, 0 },
+    { "xpP0", 8, UBX_MSGDB_I4, 1, 0, 1107, 0 },
+    { "xpP1", 12, UBX_MSGDB_I4, 1, 0, 1107, 0 },
+    { "ypP0", 16, UBX_MSGDB_I4, 1, 0, 1107, 0 },
+    { "ypP1", 20, UBX_MSGDB_I4, 1, 0, 1107, 0 },
+    { "dUT1", 24, UBX_MSGDB_I4, 1, 0, 1107, 0 },  // 2500
+    { "ddUT1", 28, UBX_MSGDB_I4, 1, 0, 1107, 0 },
+    { "reserved1", 32, UBX_MSGDB_U1, 40, 1, 1107, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1107, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1107, 0 },
+    { "age", 2, UBX_MSGDB_U2, 1, 0, 1107, 0 },
+    { "roll", 4, UBX_MSGDB_I4, 1, 0, 1107, 0 },
+    { "pitch", 8, UBX_MSGDB_I4, 1, 0, 1107, 0 },
+    { "heading", 12, UBX_MSGDB_I4, 1, 0, 1107, 0 },
+    { "accRoll", 16, UBX_MSGDB_U4, 1, 0, 1107, 0 },
+    { "accPitch", 20, UBX_MSGDB_U4, 1, 0, 1107, 0 },
+    { "accHeading", 24, UBX_MSGDB_U4, 1, 0, 1107, 0 },
+    { "type", 0, UBX_MSGDB_U1, 1, 0, 1107, 0 },
+    { "version", 1, UBX_MSGDB_U1, 1, 0, 1107, 0 },
+    { "infoCode", 2, UBX_MSGDB_U1, 1, 0, 1107, 0 },
+    { "msgId", 3, UBX_MSGDB_U1, 1, 0, 1107, 0 },
+    { "msgPayloadStart", 4, UBX_MSGDB_U1, 4, 0, 1107, 0 },
+    { "reserved0", 0, UBX_MSGDB_U1, 12, 1, 1107, 0 },
+    { "data", 0, UBX_MSGDB_U1, 1, 0, 1107, 0 },
+    { "bytes", 0, UBX_MSGDB_U1, 1, 0, 1107, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 1107, 0 },
+    { "logCfg", 1, UBX_MSGDB_X1, 1, 0, 1107, 1 },
+    { "reserved0", 2, UBX_MSGDB_U1, 1, 1, 1108, 0 },
+    { "logSize", 3, UBX_MSGDB_U1, 1, 0, 1108, 0 },
+    { "userDefinedSize", 4, UBX_MSGDB_U4, 1, 0, 1108, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 1108, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 1108, 0 },
+    { "filestoreCapacity", 4, UBX_MSGDB_U4, 1, 0, 1108, 0 },
+    { "reserved1", 8, UBX_MSGDB_U1, 8, 1, 1108, 0 },
+    { "currentMaxLogSize", 16, UBX_MSGDB_U4, 1, 0, 1108, 0 },
+    { "currentLogSize", 20, UBX_MSGDB_U4, 1, 0, 1108, 0 },
+    { "entryCount", 24, UBX_MSGDB_U4, 1, 0, 1108, 0 },
+    { "oldestYear", 28, UBX_MSGDB_U2, 1, 0, 1108, 0 },
+    { "oldestMonth", 30, UBX_MSGDB_U1, 1, 0, 1108, 0 },
+    { "oldestDay", 31, UBX_MSGDB_U1, 1, 0, 1108, 0 },
+    { "oldestHour", 32, UBX_MSGDB_U1, 1, 0, 1108, 0 },
+    { "oldestMinute", 33, UBX_MSGDB_U1, 1, 0, 1108, 0 },
+    { "oldestSecond", 34, UBX_MSGDB_U1, 1, 0, 1108, 0 },
+    { "reserved2", 35, UBX_MSGDB_U1, 1, 1, 1108, 0 },
+    { "newestYear", 36, UBX_MSGDB_U2, 1, 0, 1108, 0 },
+    { "newestMonth", 38, UBX_MSGDB_U1, 1, 0, 1108, 0 },
+    { "newestDay", 39, UBX_MSGDB_U1, 1, 0, 1108, 0 },
+    { "newestHour", 40, UBX_MSGDB_U1, 1, 0, 1108, 0 },
+    { "newestMinute", 41, UBX_MSGDB_U1, 1, 0, 1108, 0 },
+    { "newestSecond", 42, UBX_MSGDB_U1, 1, 0, 1108, 0 },
+    { "reserved3", 43, UBX_MSGDB_U1, 1, 1, 1108, 0 },
+    { "status", 44, UBX_MSGDB_X1, 1, 0, 1108, 3 },
+    { "reserved4", 45, UBX_MSGDB_U1, 3, 1, 1111, 0 },
+    { "startNumber", 0, UBX_MSGDB_U4, 1, 0, 1111, 0 },
+    { "entryCount", 4, UBX_MSGDB_U4, 1, 0, 1111, 0 },
+    { "version", 8, UBX_MSGDB_U1, 1, 0, 1111, 0 },  // 2550
+    { "reserved0", 9, UBX_MSGDB_U1, 3, 1, 1111, 0 },
+    { "entryIndex", 0, UBX_MSGDB_U4, 1, 0, 1111, 0 },
+    { "lon", 4, UBX_MSGDB_I4, 1, 0, 1111, 0 },
+    { "lat", 8, UBX_MSGDB_I4, 1, 0, 1111, 0 },
+    { "hMSL", 12, UBX_MSGDB_I4, 1, 0, 1111, 0 },
+    { "hAcc", 16, UBX_MSGDB_U4, 1, 0, 1111, 0 },
+    { "gSpeed", 20, UBX_MSGDB_U4, 1, 0, 1111, 0 },
+    { "heading", 24, UBX_MSGDB_U4, 1, 0, 1111, 0 },
+    { "version", 28, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "fixType", 29, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "year", 30, UBX_MSGDB_U2, 1, 0, 1111, 0 },
+    { "month", 32, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "day", 33, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "hour", 34, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "minute", 35, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "second", 36, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "reserved0", 37, UBX_MSGDB_U1, 1, 1, 1111, 0 },
+    { "numSV", 38, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "reserved1", 39, UBX_MSGDB_U1, 1, 1, 1111, 0 },
+    { "entryIndex", 0, UBX_MSGDB_U4, 1, 0, 1111, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "reserved0", 5, UBX_MSGDB_U1, 1, 1, 1111, 0 },
+    { "year", 6, UBX_MSGDB_U2, 1, 0, 1111, 0 },
+    { "month", 8, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "day", 9, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "hour", 10, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "minute", 11, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "second", 12, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "reserved1", 13, UBX_MSGDB_U1, 1, 1, 1111, 0 },
+    { "byteCount", 14, UBX_MSGDB_U2, 1, 0, 1111, 0 },
+    { "bytes", 0, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "type", 1, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "year", 2, UBX_MSGDB_U2, 1, 0, 1111, 0 },
+    { "month", 4, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "day", 5, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "hour", 6, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "minute", 7, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "second", 8, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "reserved0", 9, UBX_MSGDB_U1, 1, 1, 1111, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "type", 1, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 1111, 0 },
+    { "entryNumber", 4, UBX_MSGDB_U4, 1, 0, 1111, 0 },
+    { "entryIndex", 0, UBX_MSGDB_U4, 1, 0, 1111, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "reserved0", 5, UBX_MSGDB_U1, 1, 1, 1111, 0 },
+    { "year", 6, UBX_MSGDB_U2, 1, 0, 1111, 0 },
+    { "month", 8, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "day", 9, UBX_MSGDB_U1, 1, 0, 1111, 0 },  // 2600
+    { "hour", 10, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "minute", 11, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "second", 12, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "reserved1", 13, UBX_MSGDB_U1, 3, 1, 1111, 0 },
+    { "distance", 16, UBX_MSGDB_U4, 1, 0, 1111, 0 },
+    { "reserved2", 20, UBX_MSGDB_U1, 12, 1, 1111, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 1111, 0 },
+    { "flags", 1, UBX_MSGDB_X1, 1, 0, 1111, 1 },
+    { "reserved0", 2, UBX_MSGDB_U1, 2, 1, 1112, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 1112, 0 },
+    { "contentValid", 1, UBX_MSGDB_X1, 1, 0, 1112, 2 },
+    { "msgCnt", 2, UBX_MSGDB_U2, 1, 0, 1114, 0 },
+    { "iTOW", 4, UBX_MSGDB_U4, 1, 0, 1114, 0 },
+    { "year", 8, UBX_MSGDB_U2, 1, 0, 1114, 0 },
+    { "month", 10, UBX_MSGDB_U1, 1, 0, 1114, 0 },
+    { "day", 11, UBX_MSGDB_U1, 1, 0, 1114, 0 },
+    { "hour", 12, UBX_MSGDB_U1, 1, 0, 1114, 0 },
+    { "min", 13, UBX_MSGDB_U1, 1, 0, 1114, 0 },
+    { "sec", 14, UBX_MSGDB_U1, 1, 0, 1114, 0 },
+    { "valid", 15, UBX_MSGDB_X1, 1, 0, 1114, 2 },
+    { "tAcc", 16, UBX_MSGDB_U4, 1, 0, 1116, 0 },
+    { "fracSec", 20, UBX_MSGDB_I4, 1, 0, 1116, 0 },
+    { "fixType", 24, UBX_MSGDB_U1, 1, 0, 1116, 0 },
+    { "flags", 25, UBX_MSGDB_X1, 1, 0, 1116, 3 },
+    { "flags2", 26, UBX_MSGDB_X1, 1, 0, 1119, 0 },
+    { "numSV", 27, UBX_MSGDB_U1, 1, 0, 1119, 0 },
+    { "lon", 28, UBX_MSGDB_I4, 1, 0, 1119, 0 },
+    { "lat", 32, UBX_MSGDB_I4, 1, 0, 1119, 0 },
+    { "height", 36, UBX_MSGDB_I4, 1, 0, 1119, 0 },
+    { "hMSL", 40, UBX_MSGDB_I4, 1, 0, 1119, 0 },
+    { "hAcc", 44, UBX_MSGDB_U4, 1, 0, 1119, 0 },
+    { "vAcc", 48, UBX_MSGDB_U4, 1, 0, 1119, 0 },
+    { "velN", 52, UBX_MSGDB_I4, 1, 0, 1119, 0 },
+    { "velE", 56, UBX_MSGDB_I4, 1, 0, 1119, 0 },
+    { "velD", 60, UBX_MSGDB_I4, 1, 0, 1119, 0 },
+    { "gSpeed", 64, UBX_MSGDB_I4, 1, 0, 1119, 0 },
+    { "headMot", 68, UBX_MSGDB_I4, 1, 0, 1119, 0 },
+    { "sAcc", 72, UBX_MSGDB_U4, 1, 0, 1119, 0 },
+    { "headAcc", 76, UBX_MSGDB_U4, 1, 0, 1119, 0 },
+    { "pDOP", 80, UBX_MSGDB_U2, 1, 0, 1119, 0 },
+    { "reserved0", 82, UBX_MSGDB_U1, 2, 1, 1119, 0 },
+    { "distance", 84, UBX_MSGDB_U4, 1, 0, 1119, 0 },
+    { "totalDistance", 88, UBX_MSGDB_U4, 1, 0, 1119, 0 },
+    { "distanceStd", 92, UBX_MSGDB_U4, 1, 0, 1119, 0 },
+    { "reserved1", 96, UBX_MSGDB_U1, 4, 1, 1119, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 1119, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 1119, 0 },
+    { "uniqueId", 4, UBX_MSGDB_U1, 5, 0, 1119, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 1119, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 1119, 0 },  // 2650
+    { "uniqueId", 4, UBX_MSGDB_U1, 6, 0, 1119, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 1119, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 1119, 0 },
+    { "jamFlags", 4, UBX_MSGDB_X1, 1, 0, 1119, 2 },
+    { "reserved1", 5, UBX_MSGDB_U1, 3, 1, 1121, 0 },
+    { "spfFlags", 8, UBX_MSGDB_X1, 1, 0, 1121, 2 },
+    { "reserved2", 9, UBX_MSGDB_U1, 3, 1, 1123, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 1123, 0 },
+    { "sigSecFlags", 1, UBX_MSGDB_X1, 1, 0, 1123, 4 },
+    { "reserved0", 2, UBX_MSGDB_U1, 1, 1, 1127, 0 },
+    { "jamNumCentFreqs", 3, UBX_MSGDB_U1, 1, 0, 1127, 0 },
+    { "jamStateCentFreq", 0, UBX_MSGDB_X4, 1, 0, 1127, 2 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 1129, 0 },
+    { "nmaHeader", 1, UBX_MSGDB_X1, 1, 0, 1129, 4 },
+    { "osnmaMonitoring", 2, UBX_MSGDB_X1, 1, 0, 1133, 3 },
+    { "timSyncReq", 3, UBX_MSGDB_X1, 1, 0, 1136, 2 },
+    { "timSyncReqDiff", 4, UBX_MSGDB_I4, 1, 0, 1138, 0 },
+    { "reserved0", 8, UBX_MSGDB_U1, 4, 1, 1138, 0 },
+    { "dsmAuthentication", 12, UBX_MSGDB_X4, 1, 0, 1138, 8 },
+    { "teslaKey", 16, UBX_MSGDB_X4, 1, 0, 1146, 4 },
+    { "generalAndTiming", 20, UBX_MSGDB_X4, 1, 0, 1150, 5 },
+    { "bitfield1", 0, UBX_MSGDB_X2, 1, 0, 1155, 3 },
+    { "svId", 2, UBX_MSGDB_U1, 1, 0, 1158, 0 },
+    { "reserved1", 3, UBX_MSGDB_U1, 1, 1, 1158, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 1158, 0 },
+    { "nmaHeader", 1, UBX_MSGDB_X1, 1, 0, 1158, 4 },
+    { "osnmaMonitoring", 2, UBX_MSGDB_X1, 1, 0, 1162, 3 },
+    { "timSyncReq", 3, UBX_MSGDB_X1, 1, 0, 1165, 2 },
+    { "timSyncReqDiff", 4, UBX_MSGDB_I4, 1, 0, 1167, 0 },
+    { "reserved0", 8, UBX_MSGDB_U1, 4, 1, 1167, 0 },
+    { "dsmAuthentication", 12, UBX_MSGDB_X4, 1, 0, 1167, 8 },
+    { "teslaKey", 16, UBX_MSGDB_X4, 1, 0, 1175, 4 },
+    { "generalAndTiming", 20, UBX_MSGDB_X4, 1, 0, 1179, 13 },
+    { "bitfield1", 0, UBX_MSGDB_X2, 1, 0, 1192, 3 },
+    { "svId", 2, UBX_MSGDB_U1, 1, 0, 1195, 0 },
+    { "reserved1", 3, UBX_MSGDB_U1, 1, 1, 1195, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 1195, 0 },
+    { "nmaHeader", 1, UBX_MSGDB_X1, 1, 0, 1195, 4 },
+    { "osnmaMonitoring", 2, UBX_MSGDB_X2, 1, 0, 1199, 7 },
+    { "timSyncReq", 4, UBX_MSGDB_X1, 1, 0, 1206, 2 },
+    { "reserved0", 5, UBX_MSGDB_U1, 3, 1, 1208, 0 },
+    { "timSyncReqDiff", 8, UBX_MSGDB_I4, 1, 0, 1208, 0 },
+    { "reserved1", 12, UBX_MSGDB_U1, 4, 1, 1208, 0 },
+    { "dsmAuthentication", 16, UBX_MSGDB_X4, 1, 0, 1208, 8 },
+    { "teslaKey", 20, UBX_MSGDB_X4, 1, 0, 1216, 4 },
+    { "generalAndTiming", 24, UBX_MSGDB_X4, 1, 0, 1220, 13 },
+    { "bitfield1", 0, UBX_MSGDB_X2, 1, 0, 1233, 3 },
+    { "svId", 2, UBX_MSGDB_U1, 1, 0, 1236, 0 },
+    { "reserved2", 3, UBX_MSGDB_U1, 1, 1, 1236, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 1236, 0 },  // 2700
+    { "numEvents", 1, UBX_MSGDB_U1, 1, 0, 1236, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 6, 1, 1236, 0 },
+    { "timeElapsed", 0, UBX_MSGDB_U4, 1, 0, 1236, 0 },
+    { "detectionType", 4, UBX_MSGDB_U1, 1, 0, 1236, 0 },
+    { "eventType", 5, UBX_MSGDB_U1, 1, 0, 1236, 0 },
+    { "reserved1", 6, UBX_MSGDB_U1, 2, 1, 1236, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 1236, 0 },
+    { "numEvents", 1, UBX_MSGDB_U1, 1, 0, 1236, 0 },
+    { "reserved0", 2, UBX_MSGDB_U1, 6, 1, 1236, 0 },
+    { "timeElapsed", 0, UBX_MSGDB_U4, 1, 0, 1236, 0 },
+    { "detectionType", 4, UBX_MSGDB_U1, 1, 0, 1236, 0 },
+    { "eventType", 5, UBX_MSGDB_U1, 1, 0, 1236, 0 },
+    { "reserved1", 6, UBX_MSGDB_U1, 2, 1, 1236, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1236, 0 },
+    { "year", 4, UBX_MSGDB_U2, 1, 0, 1236, 0 },
+    { "month", 6, UBX_MSGDB_U1, 1, 0, 1236, 0 },
+    { "day", 7, UBX_MSGDB_U1, 1, 0, 1236, 0 },
+    { "hour", 8, UBX_MSGDB_U1, 1, 0, 1236, 0 },
+    { "min", 9, UBX_MSGDB_U1, 1, 0, 1236, 0 },
+    { "sec", 10, UBX_MSGDB_U1, 1, 0, 1236, 0 },
+    { "valid", 11, UBX_MSGDB_X1, 1, 0, 1236, 3 },
+    { "nano", 12, UBX_MSGDB_I4, 1, 0, 1239, 0 },
+    { "gpsFix", 16, UBX_MSGDB_U1, 1, 0, 1239, 0 },
+    { "flags", 17, UBX_MSGDB_X1, 1, 0, 1239, 5 },
+    { "reserved0", 18, UBX_MSGDB_U1, 2, 1, 1244, 0 },
+    { "lon", 20, UBX_MSGDB_I4, 1, 0, 1244, 0 },
+    { "lat", 24, UBX_MSGDB_I4, 1, 0, 1244, 0 },
+    { "height", 28, UBX_MSGDB_I4, 1, 0, 1244, 0 },
+    { "hMSL", 32, UBX_MSGDB_I4, 1, 0, 1244, 0 },
+    { "gSpeed", 36, UBX_MSGDB_I4, 1, 0, 1244, 0 },
+    { "speed", 40, UBX_MSGDB_I4, 1, 0, 1244, 0 },
+    { "headMot", 44, UBX_MSGDB_I4, 1, 0, 1244, 0 },
+    { "headVeh", 48, UBX_MSGDB_I4, 1, 0, 1244, 0 },
+    { "hAcc", 52, UBX_MSGDB_U4, 1, 0, 1244, 0 },
+    { "vAcc", 56, UBX_MSGDB_U4, 1, 0, 1244, 0 },
+    { "sAcc", 60, UBX_MSGDB_U4, 1, 0, 1244, 0 },
+    { "headAcc", 64, UBX_MSGDB_U4, 1, 0, 1244, 0 },
+    { "reserved1", 68, UBX_MSGDB_U1, 4, 1, 1244, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1244, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 1244, 0 },
+    { "reserved0", 5, UBX_MSGDB_U1, 3, 1, 1244, 0 },
+    { "roll", 8, UBX_MSGDB_I4, 1, 0, 1244, 0 },
+    { "pitch", 12, UBX_MSGDB_I4, 1, 0, 1244, 0 },
+    { "heading", 16, UBX_MSGDB_I4, 1, 0, 1244, 0 },
+    { "accRoll", 20, UBX_MSGDB_U4, 1, 0, 1244, 0 },
+    { "accPitch", 24, UBX_MSGDB_U4, 1, 0, 1244, 0 },
+    { "accHeading", 28, UBX_MSGDB_U4, 1, 0, 1244, 0 },
+    { "bitfield0", 0, UBX_MSGDB_X4, 1, 0, 1244, 7 },
+    { "reserved0", 4, UBX_MSGDB_U1, 4, 1, 1251, 0 },
+    { "iTOW", 8, UBX_MSGDB_U4, 1, 0, 1251, 0 },  // 2750
+    { "xAngRate", 12, UBX_MSGDB_I4, 1, 0, 1251, 0 },
+    { "yAngRate", 16, UBX_MSGDB_I4, 1, 0, 1251, 0 },
+    { "zAngRate", 20, UBX_MSGDB_I4, 1, 0, 1251, 0 },
+    { "xAccel", 24, UBX_MSGDB_I4, 1, 0, 1251, 0 },
+    { "yAccel", 28, UBX_MSGDB_I4, 1, 0, 1251, 0 },
+    { "zAccel", 32, UBX_MSGDB_I4, 1, 0, 1251, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1251, 0 },
+    { "ecefX", 4, UBX_MSGDB_I4, 1, 0, 1251, 0 },
+    { "ecefY", 8, UBX_MSGDB_I4, 1, 0, 1251, 0 },
+    { "ecefZ", 12, UBX_MSGDB_I4, 1, 0, 1251, 0 },
+    { "pAcc", 16, UBX_MSGDB_U4, 1, 0, 1251, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1251, 0 },
+    { "lon", 4, UBX_MSGDB_I4, 1, 0, 1251, 0 },
+    { "lat", 8, UBX_MSGDB_I4, 1, 0, 1251, 0 },
+    { "height", 12, UBX_MSGDB_I4, 1, 0, 1251, 0 },
+    { "hMSL", 16, UBX_MSGDB_I4, 1, 0, 1251, 0 },
+    { "hAcc", 20, UBX_MSGDB_U4, 1, 0, 1251, 0 },
+    { "vAcc", 24, UBX_MSGDB_U4, 1, 0, 1251, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1251, 0 },
+    { "gpsFix", 4, UBX_MSGDB_U1, 1, 0, 1251, 0 },
+    { "flags", 5, UBX_MSGDB_X1, 1, 0, 1251, 4 },
+    { "fixStat", 6, UBX_MSGDB_X1, 1, 0, 1255, 3 },
+    { "flags2", 7, UBX_MSGDB_X1, 1, 0, 1258, 3 },
+    { "ttff", 8, UBX_MSGDB_U4, 1, 0, 1261, 0 },
+    { "msss", 12, UBX_MSGDB_U4, 1, 0, 1261, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1261, 0 },
+    { "gDOP", 4, UBX_MSGDB_U2, 1, 0, 1261, 0 },
+    { "pDOP", 6, UBX_MSGDB_U2, 1, 0, 1261, 0 },
+    { "tDOP", 8, UBX_MSGDB_U2, 1, 0, 1261, 0 },
+    { "vDOP", 10, UBX_MSGDB_U2, 1, 0, 1261, 0 },
+    { "hDOP", 12, UBX_MSGDB_U2, 1, 0, 1261, 0 },
+    { "nDOP", 14, UBX_MSGDB_U2, 1, 0, 1261, 0 },
+    { "eDOP", 16, UBX_MSGDB_U2, 1, 0, 1261, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1261, 0 },
+    { "year", 4, UBX_MSGDB_U2, 1, 0, 1261, 0 },
+    { "month", 6, UBX_MSGDB_U1, 1, 0, 1261, 0 },
+    { "day", 7, UBX_MSGDB_U1, 1, 0, 1261, 0 },
+    { "hour", 8, UBX_MSGDB_U1, 1, 0, 1261, 0 },
+    { "min", 9, UBX_MSGDB_U1, 1, 0, 1261, 0 },
+    { "sec", 10, UBX_MSGDB_U1, 1, 0, 1261, 0 },
+    { "valid", 11, UBX_MSGDB_X1, 1, 0, 1261, 4 },
+    { "tAcc", 12, UBX_MSGDB_U4, 1, 0, 1265, 0 },
+    { "nano", 16, UBX_MSGDB_I4, 1, 0, 1265, 0 },
+    { "fixType", 20, UBX_MSGDB_U1, 1, 0, 1265, 0 },
+    { "flags", 21, UBX_MSGDB_X1, 1, 0, 1265, 5 },
+    { "flags2", 22, UBX_MSGDB_X1, 1, 0, 1270, 3 },
+    { "numSV", 23, UBX_MSGDB_U1, 1, 0, 1273, 0 },
+    { "lon", 24, UBX_MSGDB_I4, 1, 0, 1273, 0 },
+    { "lat", 28, UBX_MSGDB_I4, 1, 0, 1273, 0 },
+    { "height", 32, UBX_MSGDB_I4, 1, 0, 1273, 0 },  // 2800
+    { "hMSL", 36, UBX_MSGDB_I4, 1, 0, 1273, 0 },
+    { "hAcc", 40, UBX_MSGDB_U4, 1, 0, 1273, 0 },
+    { "vAcc", 44, UBX_MSGDB_U4, 1, 0, 1273, 0 },
+    { "velN", 48, UBX_MSGDB_I4, 1, 0, 1273, 0 },
+    { "velE", 52, UBX_MSGDB_I4, 1, 0, 1273, 0 },
+    { "velD", 56, UBX_MSGDB_I4, 1, 0, 1273, 0 },
+    { "gSpeed", 60, UBX_MSGDB_I4, 1, 0, 1273, 0 },
+    { "headMot", 64, UBX_MSGDB_I4, 1, 0, 1273, 0 },
+    { "sAcc", 68, UBX_MSGDB_U4, 1, 0, 1273, 0 },
+    { "headAcc", 72, UBX_MSGDB_U4, 1, 0, 1273, 0 },
+    { "pDOP", 76, UBX_MSGDB_U2, 1, 0, 1273, 0 },
+    { "flags3", 78, UBX_MSGDB_X2, 1, 0, 1273, 4 },
+    { "reserved0", 80, UBX_MSGDB_U1, 4, 1, 1277, 0 },
+    { "headVeh", 84, UBX_MSGDB_I4, 1, 0, 1277, 0 },
+    { "magDec", 88, UBX_MSGDB_I2, 1, 0, 1277, 0 },
+    { "magAcc", 90, UBX_MSGDB_U2, 1, 0, 1277, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 1277, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 1277, 0 },
+    { "iTOW", 4, UBX_MSGDB_U4, 1, 0, 1277, 0 },
+    { "distance", 8, UBX_MSGDB_U4, 1, 0, 1277, 0 },
+    { "totalDistance", 12, UBX_MSGDB_U4, 1, 0, 1277, 0 },
+    { "distanceStd", 16, UBX_MSGDB_U4, 1, 0, 1277, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1277, 0 },
+    { "ecefVX", 4, UBX_MSGDB_I4, 1, 0, 1277, 0 },
+    { "ecefVY", 8, UBX_MSGDB_I4, 1, 0, 1277, 0 },
+    { "ecefVZ", 12, UBX_MSGDB_I4, 1, 0, 1277, 0 },
+    { "sAcc", 16, UBX_MSGDB_U4, 1, 0, 1277, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1277, 0 },
+    { "velN", 4, UBX_MSGDB_I4, 1, 0, 1277, 0 },
+    { "velE", 8, UBX_MSGDB_I4, 1, 0, 1277, 0 },
+    { "velD", 12, UBX_MSGDB_I4, 1, 0, 1277, 0 },
+    { "speed", 16, UBX_MSGDB_U4, 1, 0, 1277, 0 },
+    { "gSpeed", 20, UBX_MSGDB_U4, 1, 0, 1277, 0 },
+    { "heading", 24, UBX_MSGDB_I4, 1, 0, 1277, 0 },
+    { "sAcc", 28, UBX_MSGDB_U4, 1, 0, 1277, 0 },
+    { "cAcc", 32, UBX_MSGDB_U4, 1, 0, 1277, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1277, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 1277, 0 },
+    { "valid", 5, UBX_MSGDB_X1, 1, 0, 1277, 4 },
+    { "year", 6, UBX_MSGDB_U2, 1, 0, 1281, 0 },
+    { "month", 8, UBX_MSGDB_U1, 1, 0, 1281, 0 },
+    { "day", 9, UBX_MSGDB_U1, 1, 0, 1281, 0 },
+    { "hour", 10, UBX_MSGDB_U1, 1, 0, 1281, 0 },
+    { "min", 11, UBX_MSGDB_U1, 1, 0, 1281, 0 },
+    { "sec", 12, UBX_MSGDB_U1, 1, 0, 1281, 0 },
+    { "reserved0", 13, UBX_MSGDB_U1, 1, 1, 1281, 0 },
+    { "reserved1", 14, UBX_MSGDB_U1, 2, 1, 1281, 0 },
+    { "tAcc", 16, UBX_MSGDB_U4, 1, 0, 1281, 0 },
+    { "nano", 20, UBX_MSGDB_I4, 1, 0, 1281, 0 },
+    { "fixType", 24, UBX_MSGDB_U1, 1, 0, 1281, 0 },  // 2850
+    { "flags", 25, UBX_MSGDB_X1, 1, 0, 1281, 6 },
+    { "flags2", 26, UBX_MSGDB_X1, 1, 0, 1287, 3 },
+    { "numSV", 27, UBX_MSGDB_U1, 1, 0, 1290, 0 },
+    { "lon", 28, UBX_MSGDB_I4, 1, 0, 1290, 0 },
+    { "lat", 32, UBX_MSGDB_I4, 1, 0, 1290, 0 },
+    { "height", 36, UBX_MSGDB_I4, 1, 0, 1290, 0 },
+    { "hMSL", 40, UBX_MSGDB_I4, 1, 0, 1290, 0 },
+    { "hAcc", 44, UBX_MSGDB_U4, 1, 0, 1290, 0 },
+    { "vAcc", 48, UBX_MSGDB_U4, 1, 0, 1290, 0 },
+    { "velN", 52, UBX_MSGDB_I4, 1, 0, 1290, 0 },
+    { "velE", 56, UBX_MSGDB_I4, 1, 0, 1290, 0 },
+    { "velD", 60, UBX_MSGDB_I4, 1, 0, 1290, 0 },
+    { "gSpeed", 64, UBX_MSGDB_I4, 1, 0, 1290, 0 },
+    { "sAcc", 68, UBX_MSGDB_U4, 1, 0, 1290, 0 },
+    { "vehRoll", 72, UBX_MSGDB_I4, 1, 0, 1290, 0 },
+    { "vehPitch", 76, UBX_MSGDB_I4, 1, 0, 1290, 0 },
+    { "vehHeading", 80, UBX_MSGDB_I4, 1, 0, 1290, 0 },
+    { "motHeading", 84, UBX_MSGDB_I4, 1, 0, 1290, 0 },
+    { "accRoll", 88, UBX_MSGDB_U2, 1, 0, 1290, 0 },
+    { "accPitch", 90, UBX_MSGDB_U2, 1, 0, 1290, 0 },
+    { "accHeading", 92, UBX_MSGDB_U2, 1, 0, 1290, 0 },
+    { "magDec", 94, UBX_MSGDB_I2, 1, 0, 1290, 0 },
+    { "magAcc", 96, UBX_MSGDB_U2, 1, 0, 1290, 0 },
+    { "errEllipseOrient", 98, UBX_MSGDB_U2, 1, 0, 1290, 0 },
+    { "errEllipseMajor", 100, UBX_MSGDB_U4, 1, 0, 1290, 0 },
+    { "errEllipseMinor", 104, UBX_MSGDB_U4, 1, 0, 1290, 0 },
+    { "reserved2", 108, UBX_MSGDB_U1, 4, 1, 1290, 0 },
+    { "reserved3", 112, UBX_MSGDB_U1, 4, 1, 1290, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1290, 0 },
+    { "fTOW", 4, UBX_MSGDB_I4, 1, 0, 1290, 0 },
+    { "week", 8, UBX_MSGDB_I2, 1, 0, 1290, 0 },
+    { "leapS", 10, UBX_MSGDB_I1, 1, 0, 1290, 0 },
+    { "valid", 11, UBX_MSGDB_X1, 1, 0, 1290, 3 },
+    { "tAcc", 12, UBX_MSGDB_U4, 1, 0, 1293, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1293, 0 },
+    { "tAcc", 4, UBX_MSGDB_U4, 1, 0, 1293, 0 },
+    { "nano", 8, UBX_MSGDB_I4, 1, 0, 1293, 0 },
+    { "year", 12, UBX_MSGDB_U2, 1, 0, 1293, 0 },
+    { "month", 14, UBX_MSGDB_U1, 1, 0, 1293, 0 },
+    { "day", 15, UBX_MSGDB_U1, 1, 0, 1293, 0 },
+    { "hour", 16, UBX_MSGDB_U1, 1, 0, 1293, 0 },
+    { "min", 17, UBX_MSGDB_U1, 1, 0, 1293, 0 },
+    { "sec", 18, UBX_MSGDB_U1, 1, 0, 1293, 0 },
+    { "valid", 19, UBX_MSGDB_X1, 1, 0, 1293, 5 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1298, 0 },
+    { "clkB", 4, UBX_MSGDB_I4, 1, 0, 1298, 0 },
+    { "clkD", 8, UBX_MSGDB_I4, 1, 0, 1298, 0 },
+    { "tAcc", 12, UBX_MSGDB_U4, 1, 0, 1298, 0 },
+    { "fAcc", 16, UBX_MSGDB_U4, 1, 0, 1298, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1298, 0 },  // 2900
+    { "TOD", 4, UBX_MSGDB_U4, 1, 0, 1298, 0 },
+    { "fTOD", 8, UBX_MSGDB_I4, 1, 0, 1298, 0 },
+    { "Nt", 12, UBX_MSGDB_U2, 1, 0, 1298, 0 },
+    { "N4", 14, UBX_MSGDB_U1, 1, 0, 1298, 0 },
+    { "valid", 15, UBX_MSGDB_X1, 1, 0, 1298, 2 },
+    { "tAcc", 16, UBX_MSGDB_U4, 1, 0, 1300, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1300, 0 },
+    { "SOW", 4, UBX_MSGDB_U4, 1, 0, 1300, 0 },
+    { "fSOW", 8, UBX_MSGDB_I4, 1, 0, 1300, 0 },
+    { "week", 12, UBX_MSGDB_I2, 1, 0, 1300, 0 },
+    { "leapS", 14, UBX_MSGDB_I1, 1, 0, 1300, 0 },
+    { "valid", 15, UBX_MSGDB_X1, 1, 0, 1300, 3 },
+    { "tAcc", 16, UBX_MSGDB_U4, 1, 0, 1303, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1303, 0 },
+    { "galTow", 4, UBX_MSGDB_U4, 1, 0, 1303, 0 },
+    { "fGalTow", 8, UBX_MSGDB_I4, 1, 0, 1303, 0 },
+    { "galWno", 12, UBX_MSGDB_I2, 1, 0, 1303, 0 },
+    { "leapS", 14, UBX_MSGDB_I1, 1, 0, 1303, 0 },
+    { "valid", 15, UBX_MSGDB_X1, 1, 0, 1303, 3 },
+    { "tAcc", 16, UBX_MSGDB_U4, 1, 0, 1306, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1306, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 1306, 0 },
+    { "reserved0", 5, UBX_MSGDB_U1, 3, 1, 1306, 0 },
+    { "srcOfCurrLs", 8, UBX_MSGDB_U1, 1, 0, 1306, 0 },
+    { "currLs", 9, UBX_MSGDB_I1, 1, 0, 1306, 0 },
+    { "srcOfLsChange", 10, UBX_MSGDB_U1, 1, 0, 1306, 0 },
+    { "lsChange", 11, UBX_MSGDB_I1, 1, 0, 1306, 0 },
+    { "timeToLsEvent", 12, UBX_MSGDB_I4, 1, 0, 1306, 0 },
+    { "dateOfLsGpsWn", 16, UBX_MSGDB_U2, 1, 0, 1306, 0 },
+    { "dateOfLsGpsDn", 18, UBX_MSGDB_U2, 1, 0, 1306, 0 },
+    { "reserved1", 20, UBX_MSGDB_U1, 3, 1, 1306, 0 },
+    { "valid", 23, UBX_MSGDB_X1, 1, 0, 1306, 2 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1308, 0 },
+    { "qzssTow", 4, UBX_MSGDB_U4, 1, 0, 1308, 0 },
+    { "fQzssTow", 8, UBX_MSGDB_I4, 1, 0, 1308, 0 },
+    { "qzssWno", 12, UBX_MSGDB_I2, 1, 0, 1308, 0 },
+    { "leapS", 14, UBX_MSGDB_I1, 1, 0, 1308, 0 },
+    { "valid", 15, UBX_MSGDB_X1, 1, 0, 1308, 3 },
+    { "tAcc", 16, UBX_MSGDB_U4, 1, 0, 1311, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1311, 0 },
+    { "geo", 4, UBX_MSGDB_U1, 1, 0, 1311, 0 },
+    { "mode", 5, UBX_MSGDB_U1, 1, 0, 1311, 0 },
+    { "sys", 6, UBX_MSGDB_I1, 1, 0, 1311, 0 },
+    { "service", 7, UBX_MSGDB_X1, 1, 0, 1311, 5 },
+    { "cnt", 8, UBX_MSGDB_U1, 1, 0, 1316, 0 },
+    { "statusFlags", 9, UBX_MSGDB_X1, 1, 0, 1316, 1 },
+    { "reserved0", 10, UBX_MSGDB_U1, 2, 1, 1317, 0 },
+    { "svid", 0, UBX_MSGDB_U1, 1, 0, 1317, 0 },
+    { "reserved1", 1, UBX_MSGDB_U1, 1, 1, 1317, 0 },
+    { "udre", 2, UBX_MSGDB_U1, 1, 0, 1317, 0 },  // 2950
+    { "svSys", 3, UBX_MSGDB_U1, 1, 0, 1317, 0 },
+    { "svService", 4, UBX_MSGDB_U1, 1, 0, 1317, 0 },
+    { "reserved2", 5, UBX_MSGDB_U1, 1, 1, 1317, 0 },
+    { "prc", 6, UBX_MSGDB_I2, 1, 0, 1317, 0 },
+    { "reserved3", 8, UBX_MSGDB_U1, 2, 1, 1317, 0 },
+    { "ic", 10, UBX_MSGDB_I2, 1, 0, 1317, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1317, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 1317, 0 },
+    { "numSvs", 5, UBX_MSGDB_U1, 1, 0, 1317, 0 },
+    { "reserved0", 6, UBX_MSGDB_U1, 2, 1, 1317, 0 },
+    { "gnssId", 0, UBX_MSGDB_U1, 1, 0, 1317, 0 },
+    { "svId", 1, UBX_MSGDB_U1, 1, 0, 1317, 0 },
+    { "cno", 2, UBX_MSGDB_U1, 1, 0, 1317, 0 },
+    { "elev", 3, UBX_MSGDB_I1, 1, 0, 1317, 0 },
+    { "azim", 4, UBX_MSGDB_I2, 1, 0, 1317, 0 },
+    { "prRes", 6, UBX_MSGDB_I2, 1, 0, 1317, 0 },
+    { "flags", 8, UBX_MSGDB_X4, 1, 0, 1317, 20 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1337, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 1337, 0 },
+    { "posCovValid", 5, UBX_MSGDB_U1, 1, 0, 1337, 0 },
+    { "velCovValid", 6, UBX_MSGDB_U1, 1, 0, 1337, 0 },
+    { "reserved0", 7, UBX_MSGDB_U1, 9, 1, 1337, 0 },
+    { "posCovNN", 16, UBX_MSGDB_R4, 1, 0, 1337, 0 },
+    { "posCovNE", 20, UBX_MSGDB_R4, 1, 0, 1337, 0 },
+    { "posCovND", 24, UBX_MSGDB_R4, 1, 0, 1337, 0 },
+    { "posCovEE", 28, UBX_MSGDB_R4, 1, 0, 1337, 0 },
+    { "posCovED", 32, UBX_MSGDB_R4, 1, 0, 1337, 0 },
+    { "posCovDD", 36, UBX_MSGDB_R4, 1, 0, 1337, 0 },
+    { "velCovNN", 40, UBX_MSGDB_R4, 1, 0, 1337, 0 },
+    { "velCovNE", 44, UBX_MSGDB_R4, 1, 0, 1337, 0 },
+    { "velCovND", 48, UBX_MSGDB_R4, 1, 0, 1337, 0 },
+    { "velCovEE", 52, UBX_MSGDB_R4, 1, 0, 1337, 0 },
+    { "velCovED", 56, UBX_MSGDB_R4, 1, 0, 1337, 0 },
+    { "velCovDD", 60, UBX_MSGDB_R4, 1, 0, 1337, 0 },
+    { "version", 0, UBX_MSGDB_U1, 1, 0, 1337, 0 },
+    { "reserved0", 1, UBX_MSGDB_U1, 3, 1, 1337, 0 },
+    { "iTOW", 4, UBX_MSGDB_U4, 1, 0, 1337, 0 },
+    { "dur", 8, UBX_MSGDB_U4, 1, 0, 1337, 0 },
+    { "meanX", 12, UBX_MSGDB_I4, 1, 0, 1337, 0 },
+    { "meanY", 16, UBX_MSGDB_I4, 1, 0, 1337, 0 },
+    { "meanZ", 20, UBX_MSGDB_I4, 1, 0, 1337, 0 },
+    { "meanXHP", 24, UBX_MSGDB_I1, 1, 0, 1337, 0 },
+    { "meanYHP", 25, UBX_MSGDB_I1, 1, 0, 1337, 0 },
+    { "meanZHP", 26, UBX_MSGDB_I1, 1, 0, 1337, 0 },
+    { "reserved1", 27, UBX_MSGDB_U1, 1, 1, 1337, 0 },
+    { "meanAcc", 28, UBX_MSGDB_U4, 1, 0, 1337, 0 },
+    { "obs", 32, UBX_MSGDB_U4, 1, 0, 1337, 0 },
+    { "valid", 36, UBX_MSGDB_U1, 1, 0, 1337, 0 },
+    { "active", 37, UBX_MSGDB_U1, 1, 0, 1337, 0 },
+    { "reserved2", 38, UBX_MSGDB_U1, 2, 1, 1337, 0 },  // 3000
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1337, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 1337, 0 },
+    { "reserved0", 5, UBX_MSGDB_U1, 1, 1, 1337, 0 },
+    { "errEllipseOrient", 6, UBX_MSGDB_U2, 1, 0, 1337, 0 },
+    { "errEllipseMajor", 8, UBX_MSGDB_U4, 1, 0, 1337, 0 },
+    { "errEllipseMinor", 12, UBX_MSGDB_U4, 1, 0, 1337, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1337, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 1337, 0 },
+    { "reserved0", 5, UBX_MSGDB_U1, 3, 1, 1337, 0 },
+    { "gmsLon", 8, UBX_MSGDB_I4, 1, 0, 1337, 0 },
+    { "gmsLat", 12, UBX_MSGDB_I4, 1, 0, 1337, 0 },
+    { "gmsCode", 16, UBX_MSGDB_U1, 1, 0, 1337, 0 },
+    { "qzssSvId", 17, UBX_MSGDB_U1, 1, 0, 1337, 0 },
+    { "serviceFlags", 18, UBX_MSGDB_X1, 1, 0, 1337, 3 },
+    { "cnt", 19, UBX_MSGDB_U1, 1, 0, 1340, 0 },
+    { "gnssId", 0, UBX_MSGDB_U1, 1, 0, 1340, 0 },
+    { "svId", 1, UBX_MSGDB_U1, 1, 0, 1340, 0 },
+    { "reserved1", 2, UBX_MSGDB_U1, 1, 1, 1340, 0 },
+    { "reserved2", 3, UBX_MSGDB_U1, 3, 1, 1340, 0 },
+    { "prc", 6, UBX_MSGDB_I2, 1, 0, 1340, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1340, 0 },
+    { "version", 4, UBX_MSGDB_U1, 1, 0, 1340, 0 },
+    { "numSigs", 5, UBX_MSGDB_U1, 1, 0, 1340, 0 },
+    { "reserved0", 6, UBX_MSGDB_U1, 2, 1, 1340, 0 },
+    { "gnssId", 0, UBX_MSGDB_U1, 1, 0, 1340, 0 },
+    { "svId", 1, UBX_MSGDB_U1, 1, 0, 1340, 0 },
+    { "sigId", 2, UBX_MSGDB_U1, 1, 0, 1340, 0 },
+    { "freqId", 3, UBX_MSGDB_U1, 1, 0, 1340, 0 },
+    { "prRes", 4, UBX_MSGDB_I2, 1, 0, 1340, 0 },
+    { "cno", 6, UBX_MSGDB_U1, 1, 0, 1340, 0 },
+    { "qualityInd", 7, UBX_MSGDB_U1, 1, 0, 1340, 0 },
+    { "corrSource", 8, UBX_MSGDB_U1, 1, 0, 1340, 0 },
+    { "ionoModel", 9, UBX_MSGDB_U1, 1, 0, 1340, 0 },
+    { "sigFlags", 10, UBX_MSGDB_X2, 1, 0, 1340, 9 },
+    { "reserved1", 12, UBX_MSGDB_U1, 4, 1, 1349, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1349, 0 },
+    { "iTOW", 0, UBX_MSGDB_U4, 1, 0, 1349, 0 },
+    { "NavICTow", 4, UBX_MSGDB_U4, 1, 0, 1349, 0 },
+    { "fNavICTow", 8, UBX_MSGDB_I4, 1, 0, 1349, 0 },
+    { "NavICWno", 12, UBX_MSGDB_I2, 1, 0, 1349, 0 },
+    { "leapS", 14, UBX_MSGDB_I1, 1, 0, 1349, 0 },
+    { "valid", 15, UBX_MSGDB_X1, 1, 0, 1349, 3 },
+    { "tAcc", 16, UBX_MSGDB_U4, 1, 0, 1352, 0 },
+};
+
+static const ubx_msgdb_group_t ubx_msgdb_groups[] = {
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 0, 5 },  // 0
+    { "group0", 28, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 5, 7 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 12, 7 },
+    { "group0", 18, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 19, 8 },
+    { "group0", 32, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 27, 9 },
+    { "group0", 52, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 36, 17 },
+    { "group0", 84, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 53, 29 },
+    { "group0", 92, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 82, 33 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 115, 6 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 121, 5 },
+    { "group0", 36, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 126, 9 },
+    { "group0", 28, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 135, 11 },
+    { "group0", 36, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 146, 14 },
+    { "group0", 116, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 160, 42 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 202, 6 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 208, 10 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 218, 5 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 223, 7 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 230, 7 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 237, 7 },
+    { "group0", 24, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 244, 12 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 256, 7 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 263, 10 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 273, 4 },
+    { "chan", 12, UBX_MSGDB_BY_FIELD, 4, UBX_MSGDB_U1, 277, 8 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 285, 7 },
+    { "channels", 12, UBX_MSGDB_BY_FIELD, 12, UBX_MSGDB_U1, 292, 5 },
+    { "group0", 12, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 297, 8 },
+    { "svs", 12, UBX_MSGDB_BY_FIELD, 8, UBX_MSGDB_U1, 305, 9 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 314, 4 },
+    { "svInfo", 6, UBX_MSGDB_BY_FIELD, 5, UBX_MSGDB_U1, 318, 6 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 324, 4 },
+    { "sv", 12, UBX_MSGDB_BY_FIELD, 5, UBX_MSGDB_U1, 328, 7 },
+    { "group0", 64, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 335, 17 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 352, 5 },
+    { "fences", 2, UBX_MSGDB_BY_FIELD, 6, UBX_MSGDB_U1, 357, 2 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 359, 7 },
+    { "measurements", 20, UBX_MSGDB_BY_FIELD, 12, UBX_MSGDB_U1, 366, 9 },
+    { "group0", 40, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 375, 16 },
+    { "group0", 40, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 391, 15 },
+    { "group0", 64, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 406, 21 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 427, 6 },
+    { "group0", 36, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 433, 14 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 447, 9 },
+    { "prcs", 8, UBX_MSGDB_BY_FIELD, 19, UBX_MSGDB_U1, 456, 5 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 461, 4 },
+    { "sig", 16, UBX_MSGDB_BY_FIELD, 5, UBX_MSGDB_U1, 465, 11 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 476, 2 },
+    { "txs", 40, UBX_MSGDB_BY_FIELD, 0, UBX_MSGDB_U1, 478, 13 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 491, 3 },
+    { "txs", 44, UBX_MSGDB_BY_FIELD, 0, UBX_MSGDB_U1, 494, 16 },  // 50
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 510, 7 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 517, 4 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 521, 1 },
+    { "group0", 52, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 522, 23 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 545, 7 },
+    { "group0", 40, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 552, 14 },
+    { "group0", 40, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 566, 13 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 579, 4 },
+    { "svs", 24, UBX_MSGDB_BY_FIELD, 6, UBX_MSGDB_U1, 583, 7 },
+    { "group0", 42, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 590, 3 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 593, 4 },
+    { "group1", 4, UBX_MSGDB_BY_FIELD, 2, UBX_MSGDB_U1, 597, 1 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 598, 8 },
+    { "d", 4, UBX_MSGDB_BY_FIELD, 4, UBX_MSGDB_U1, 606, 1 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 607, 8 },
+    { "d", 4, UBX_MSGDB_BY_FIELD, 4, UBX_MSGDB_U1, 615, 1 },
+    { "group0", 44, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 616, 15 },
+    { "meas", 24, UBX_MSGDB_BY_FIELD, 34, UBX_MSGDB_U1, 631, 12 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 643, 6 },
+    { "meas", 32, UBX_MSGDB_BY_FIELD, 11, UBX_MSGDB_U1, 649, 14 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 663, 7 },
+    { "meas", 32, UBX_MSGDB_BY_FIELD, 11, UBX_MSGDB_U1, 670, 14 },
+    { "group0", 44, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 684, 15 },
+    { "meas", 28, UBX_MSGDB_BY_FIELD, 34, UBX_MSGDB_U1, 699, 13 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 712, 4 },
+    { "svInfo", 6, UBX_MSGDB_BY_FIELD, 7, UBX_MSGDB_U1, 716, 5 },
+    { "group0", 1, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 721, 1 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 722, 2 },
+    { "group1", 32, UBX_MSGDB_OPTIONAL, 0, UBX_MSGDB_U1, 724, 1 },
+    { "group0", 1, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 725, 1 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 726, 2 },
+    { "group1", 96, UBX_MSGDB_OPTIONAL, 0, UBX_MSGDB_U1, 728, 3 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 731, 5 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 736, 5 },
+    { "group0", 12, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 741, 7 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 748, 3 },
+    { "keysDescription", 8, UBX_MSGDB_BY_FIELD, 1, UBX_MSGDB_U1, 751, 4 },
+    { "keysPayload", 1, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 755, 1 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 756, 2 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 758, 5 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 763, 8 },
+    { "group0", 28, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 771, 8 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 779, 3 },
+    { "txs", 44, UBX_MSGDB_BY_FIELD, 0, UBX_MSGDB_U1, 782, 14 },
+    { "group0", 528, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 796, 11 },
+    { "group0", 24, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 807, 11 },
+    { "group1", 1, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 818, 1 },
+    { "group0", 24, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 819, 11 },
+    { "group1", 1, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 830, 1 },
+    { "group0", 264, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 831, 9 },  // 100
+    { "group0", 264, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 840, 9 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 849, 4 },
+    { "edgeMeas", 24, UBX_MSGDB_BY_FIELD, 1, UBX_MSGDB_U1, 853, 7 },
+    { "group0", 1, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 860, 1 },
+    { "group0", 1, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 861, 1 },
+    { "group0", 1, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 862, 1 },
+    { "group0", 1, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 863, 1 },
+    { "group0", 1, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 864, 1 },
+    { "group0", 1, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 865, 1 },
+    { "group0", 1, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 866, 1 },
+    { "group0", 1, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 867, 1 },
+    { "group0", 1, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 868, 1 },
+    { "group0", 2, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 869, 2 },
+    { "group0", 2, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 871, 2 },
+    { "group0", 1, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 873, 1 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 874, 9 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 883, 8 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 891, 9 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 900, 9 },
+    { "group0", 2, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 909, 2 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 911, 3 },
+    { "group0", 3, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 914, 3 },
+    { "group0", 1, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 917, 1 },
+    { "configs", 10, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 918, 3 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 921, 3 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 924, 3 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 927, 3 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 930, 3 },
+    { "group0", 2, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 933, 1 },
+    { "group0", 44, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 934, 9 },
+    { "group0", 52, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 943, 11 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 954, 9 },
+    { "group0", 6, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 963, 3 },
+    { "group0", 12, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 966, 3 },
+    { "group1", 1, UBX_MSGDB_OPTIONAL, 0, UBX_MSGDB_U1, 969, 1 },
+    { "group0", 12, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 970, 3 },
+    { "group1", 1, UBX_MSGDB_OPTIONAL, 0, UBX_MSGDB_U1, 973, 1 },
+    { "group0", 36, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 974, 9 },
+    { "group0", 2, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 983, 2 },
+    { "group0", 2, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 985, 2 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 987, 10 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 997, 10 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1007, 2 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1009, 2 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1011, 5 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1016, 4 },
+    { "group0", 12, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1020, 9 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1029, 11 },
+    { "group0", 108, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1040, 9 },
+    { "group0", 28, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1049, 7 },  // 150
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1056, 11 },
+    { "group0", 40, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1067, 20 },
+    { "group0", 40, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1087, 18 },
+    { "group0", 40, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1105, 24 },
+    { "group0", 44, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1129, 25 },
+    { "group0", 36, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1154, 19 },
+    { "group0", 44, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1173, 14 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1187, 3 },
+    { "configurations", 8, UBX_MSGDB_BY_FIELD, 1, UBX_MSGDB_U1, 1190, 5 },
+    { "group0", 1, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1195, 1 },
+    { "group0", 32, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1196, 11 },
+    { "group0", 32, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1207, 11 },
+    { "group0", 24, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1218, 8 },
+    { "group0", 1, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1226, 1 },
+    { "group1", 1, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 1227, 1 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1228, 2 },
+    { "group0", 44, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1230, 11 },
+    { "group0", 48, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1241, 12 },
+    { "group0", 48, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1253, 12 },
+    { "group0", 28, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1265, 9 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1274, 4 },
+    { "configs", 8, UBX_MSGDB_BY_FIELD, 3, UBX_MSGDB_U1, 1278, 5 },
+    { "group0", 12, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1283, 1 },
+    { "group1", 1, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 1284, 1 },
+    { "group0", 15, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1285, 9 },
+    { "group0", 12, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1294, 6 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1300, 7 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1307, 8 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1315, 4 },
+    { "slots", 4, UBX_MSGDB_BY_CONST, 3, UBX_MSGDB_U1, 1319, 1 },
+    { "group0", 12, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1320, 4 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1324, 3 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1327, 2 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1329, 3 },
+    { "sources", 36, UBX_MSGDB_BY_FIELD, 1, UBX_MSGDB_U1, 1332, 12 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1344, 3 },
+    { "oscillators", 32, UBX_MSGDB_BY_FIELD, 1, UBX_MSGDB_U1, 1347, 12 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1359, 10 },
+    { "group0", 12, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1369, 4 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1373, 8 },
+    { "fences", 12, UBX_MSGDB_BY_FIELD, 1, UBX_MSGDB_U1, 1381, 3 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1384, 2 },
+    { "group0", 40, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1386, 14 },
+    { "group0", 32, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1400, 12 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1412, 5 },
+    { "group0", 6, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1417, 4 },
+    { "header", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1421, 3 },
+    { "group0", 1, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 1424, 1 },
+    { "header", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1425, 4 },
+    { "group0", 1, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 1429, 1 },  // 200
+    { "header", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1430, 3 },
+    { "group0", 4, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 1433, 1 },
+    { "header", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1434, 3 },
+    { "group0", 1, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 1437, 1 },
+    { "header", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1438, 3 },
+    { "group0", 4, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 1441, 1 },
+    { "header", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1442, 4 },
+    { "group0", 4, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 1446, 1 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1447, 2 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1449, 6 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1455, 2 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1457, 2 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1459, 4 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1463, 4 },
+    { "ports", 20, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 1467, 7 },
+    { "group0", 40, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1474, 2 },
+    { "group1", 30, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 1476, 1 },
+    { "group0", 120, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1477, 7 },
+    { "group0", 24, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1484, 3 },
+    { "group0", 28, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1487, 7 },
+    { "group0", 68, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1494, 16 },
+    { "group0", 68, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1510, 17 },
+    { "group0", 68, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1527, 17 },
+    { "group0", 60, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1544, 17 },
+    { "group0", 56, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1561, 1 },
+    { "group0", 76, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1562, 1 },
+    { "group0", 28, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1563, 10 },
+    { "group0", 1, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1573, 1 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1574, 2 },
+    { "patchInformation", 16, UBX_MSGDB_BY_FIELD, 2, UBX_MSGDB_U2, 1576, 4 },
+    { "configs", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1580, 6 },
+    { "configs", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1586, 3 },
+    { "plans", 28, UBX_MSGDB_BY_FIELD, 1, UBX_MSGDB_U1, 1589, 11 },
+    { "configs", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1600, 9 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1609, 4 },
+    { "senData", 4, UBX_MSGDB_BY_FIELD, 1, UBX_MSGDB_U1, 1613, 4 },
+    { "testResult", 12, UBX_MSGDB_BY_FIELD, 2, UBX_MSGDB_U1, 1617, 5 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1622, 3 },
+    { "signal", 272, UBX_MSGDB_BY_FIELD, 1, UBX_MSGDB_U1, 1625, 6 },
+    { "group0", 12, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1631, 6 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1637, 3 },
+    { "info", 20, UBX_MSGDB_BY_FIELD, 1, UBX_MSGDB_U1, 1640, 6 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1646, 5 },
+    { "portInformation", 40, UBX_MSGDB_BY_FIELD, 1, UBX_MSGDB_U1, 1651, 13 },
+    { "group0", 22, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1664, 5 },
+    { "pinInformation", 6, UBX_MSGDB_BY_FIELD, 1, UBX_MSGDB_U1, 1669, 5 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1674, 3 },
+    { "hwInformation", 24, UBX_MSGDB_BY_FIELD, 1, UBX_MSGDB_U1, 1677, 15 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1692, 3 },
+    { "hwInformation", 20, UBX_MSGDB_BY_FIELD, 1, UBX_MSGDB_U1, 1695, 12 },  // 250
+    { "group0", 24, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1707, 14 },
+    { "group0", 12, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1721, 5 },
+    { "group0", 12, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1726, 8 },
+    { "group0", 1, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1734, 1 },
+    { "SIG", 21, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1735, 8 },
+    { "LNA", 2, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1743, 1 },
+    { "INTERNAL", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1744, 1 },
+    { "PMUSTATUS", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1745, 1 },
+    { "CLK", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1746, 1 },
+    { "UART", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1747, 2 },
+    { "SPI", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1749, 1 },
+    { "I2C", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1750, 1 },
+    { "PSM", 2, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1751, 2 },
+    { "antSup", 18, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1753, 8 },
+    { "OSC", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1761, 3 },
+    { "IOMONCFG", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1764, 1 },
+    { "group0", 48, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1765, 13 },
+    { "group0", 48, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1778, 13 },
+    { "group0", 48, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1791, 13 },
+    { "group0", 72, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1804, 19 },
+    { "group0", 1, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1823, 1 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1824, 2 },
+    { "group1", 32, UBX_MSGDB_OPTIONAL, 0, UBX_MSGDB_U1, 1826, 1 },
+    { "group0", 1, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1827, 1 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1828, 2 },
+    { "group1", 96, UBX_MSGDB_OPTIONAL, 0, UBX_MSGDB_U1, 1830, 3 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1833, 9 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1842, 9 },
+    { "group1", 1, UBX_MSGDB_BY_FIELD, 8, UBX_MSGDB_U2, 1851, 1 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1852, 5 },
+    { "group1", 2, UBX_MSGDB_BY_FIELD, 4, UBX_MSGDB_U2, 1857, 1 },
+    { "group0", 1, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1858, 1 },
+    { "group0", 48, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1859, 2 },
+    { "group1", 144, UBX_MSGDB_OPTIONAL, 0, UBX_MSGDB_U1, 1861, 3 },
+    { "group0", 60, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1864, 2 },
+    { "group1", 144, UBX_MSGDB_OPTIONAL, 0, UBX_MSGDB_U1, 1866, 3 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1869, 3 },
+    { "group1", 64, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1872, 1 },
+    { "group0", 2, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 1873, 1 },
+    { "group0", 1, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1874, 1 },
+    { "group0", 1, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1875, 1 },
+    { "group0", 1, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1876, 1 },
+    { "group0", 24, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1877, 8 },
+    { "group0", 24, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1885, 9 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1894, 6 },
+    { "group0", 28, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1900, 10 },
+    { "group0", 28, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1910, 9 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1919, 7 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1926, 3 },
+    { "group0", 56, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1929, 21 },  // 300
+    { "group0", 12, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1950, 5 },
+    { "channel", 24, UBX_MSGDB_BY_FIELD, 1, UBX_MSGDB_U1, 1955, 9 },
+    { "group0", 1, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1964, 1 },
+    { "group0", 12, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1965, 8 },
+    { "group0", 12, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1973, 6 },
+    { "group0", 32, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1979, 9 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1988, 5 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1993, 3 },
+    { "datafields", 4, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 1996, 1 },
+    { "group1", 4, UBX_MSGDB_OPTIONAL, 0, UBX_MSGDB_U1, 1997, 1 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 1998, 3 },
+    { "datafields", 4, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 2001, 1 },
+    { "group1", 4, UBX_MSGDB_OPTIONAL, 0, UBX_MSGDB_U1, 2002, 1 },
+    { "header", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2003, 1 },
+    { "datafields", 8, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 2004, 2 },
+    { "header", 12, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2006, 4 },
+    { "datafields", 4, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 2010, 1 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2011, 5 },
+    { "sensors", 4, UBX_MSGDB_BY_FIELD, 15, UBX_MSGDB_U1, 2016, 4 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2020, 6 },
+    { "sensors", 4, UBX_MSGDB_BY_FIELD, 15, UBX_MSGDB_U1, 2026, 4 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2030, 8 },
+    { "sensors", 4, UBX_MSGDB_BY_FIELD, 15, UBX_MSGDB_U1, 2038, 4 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2042, 8 },
+    { "group0", 36, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2050, 9 },
+    { "group0", 68, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2059, 31 },
+    { "group0", 36, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2090, 16 },
+    { "group0", 40, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2106, 5 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2111, 12 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2123, 12 },
+    { "group0", 76, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2135, 33 },
+    { "group0", 32, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2168, 19 },
+    { "group0", 12, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2187, 8 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2195, 12 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2207, 13 },
+    { "group0", 72, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2220, 6 },
+    { "group0", 36, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2226, 5 },
+    { "group0", 88, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2231, 30 },
+    { "group0", 40, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2261, 16 },
+    { "group0", 68, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2277, 5 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2282, 12 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2294, 12 },
+    { "group0", 68, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2306, 31 },
+    { "group0", 36, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2337, 16 },
+    { "group0", 12, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2353, 5 },
+    { "group0", 48, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2358, 23 },
+    { "group0", 36, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2381, 17 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2398, 8 },
+    { "group0", 96, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2406, 6 },
+    { "sensorFusionData", 8, UBX_MSGDB_BY_FIELD, 2, UBX_MSGDB_U1, 2412, 1 },  // 350
+    { "sensorFusionDataB", 8, UBX_MSGDB_BY_FIELD, 3, UBX_MSGDB_U1, 2413, 1 },
+    { "group0", 464, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2414, 3 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2417, 4 },
+    { "group1", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2421, 4 },
+    { "group2", 64, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2425, 1 },
+    { "group3", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2426, 1 },
+    { "group0", 6, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2427, 4 },
+    { "group1", 1, UBX_MSGDB_BY_FIELD, 4, UBX_MSGDB_U2, 2431, 1 },
+    { "group0", 2, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2432, 2 },
+    { "group0", 6, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2434, 5 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2439, 7 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2446, 7 },
+    { "group0", 24, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2453, 15 },
+    { "group0", 24, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2468, 12 },
+    { "group0", 12, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2480, 5 },
+    { "group0", 12, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2485, 6 },
+    { "group0", 72, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2491, 12 },
+    { "group0", 28, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2503, 9 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2512, 5 },
+    { "group0", 12, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2517, 1 },
+    { "group1", 1, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 2518, 1 },
+    { "group0", 1, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 2519, 1 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2520, 5 },
+    { "group0", 48, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2525, 23 },
+    { "group0", 12, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2548, 4 },
+    { "group0", 40, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2552, 18 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2570, 11 },
+    { "group1", 1, UBX_MSGDB_BY_FIELD, 14, UBX_MSGDB_U2, 2581, 1 },
+    { "group0", 10, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2582, 9 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2591, 4 },
+    { "group0", 32, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2595, 12 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2607, 3 },
+    { "group0", 100, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2610, 36 },
+    { "group0", 9, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2646, 3 },
+    { "group0", 10, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2649, 3 },
+    { "group0", 12, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2652, 6 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2658, 4 },
+    { "jamPerCentFreq", 4, UBX_MSGDB_BY_FIELD, 3, UBX_MSGDB_U1, 2662, 1 },
+    { "group0", 24, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2663, 9 },
+    { "authPerSV", 4, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 2672, 3 },
+    { "group0", 24, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2675, 9 },
+    { "authPerSV", 4, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 2684, 3 },
+    { "group0", 28, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2687, 10 },
+    { "authPerSV", 4, UBX_MSGDB_BY_SIZE, 0, UBX_MSGDB_U1, 2697, 3 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2700, 3 },
+    { "events", 8, UBX_MSGDB_BY_FIELD, 1, UBX_MSGDB_U1, 2703, 4 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2707, 3 },
+    { "events", 8, UBX_MSGDB_BY_FIELD, 1, UBX_MSGDB_U1, 2710, 4 },
+    { "group0", 72, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2714, 25 },
+    { "group0", 32, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2739, 9 },  // 400
+    { "group0", 36, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2748, 9 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2757, 5 },
+    { "group0", 28, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2762, 7 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2769, 7 },
+    { "group0", 18, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2776, 8 },
+    { "group0", 92, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2784, 33 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2817, 6 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2823, 5 },
+    { "group0", 36, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2828, 9 },
+    { "group0", 116, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2837, 42 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2879, 6 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2885, 10 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2895, 5 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2900, 7 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2907, 7 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2914, 7 },
+    { "group0", 24, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2921, 12 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2933, 7 },
+    { "group0", 12, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2940, 8 },
+    { "svs", 12, UBX_MSGDB_BY_FIELD, 8, UBX_MSGDB_U1, 2948, 9 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2957, 4 },
+    { "sv", 12, UBX_MSGDB_BY_FIELD, 5, UBX_MSGDB_U1, 2961, 7 },
+    { "group0", 64, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2968, 17 },
+    { "group0", 40, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 2985, 16 },
+    { "group0", 16, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 3001, 6 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 3007, 9 },
+    { "prcs", 8, UBX_MSGDB_BY_FIELD, 19, UBX_MSGDB_U1, 3016, 5 },
+    { "group0", 8, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 3021, 4 },
+    { "sig", 16, UBX_MSGDB_BY_FIELD, 5, UBX_MSGDB_U1, 3025, 11 },
+    { "group0", 4, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 3036, 1 },
+    { "group0", 20, UBX_MSGDB_ONCE, 0, UBX_MSGDB_U1, 3037, 7 },
+};
+
+static const ubx_msgdb_msg_t ubx_msgdb_msgs[] = {
+    { 0x0101, "POSECEF", "DATA0", 0, 1 },  // 0
+    { 0x0102, "POSLLH", "DATA0", 1, 1 },  // 1
+    { 0x0103, "STATUS", "DATA1", 2, 1 },  // 2
+    { 0x0104, "DOP", "DATA0", 3, 1 },  // 3
+    { 0x0105, "ATT", "POLL0", 4, 0 },  // 4
+    { 0x0105, "ATT", "DATA0", 4, 1 },  // 5
+    { 0x0106, "SOL", "DATA0", 5, 1 },  // 6
+    { 0x0107, "PVT", "DATA0", 6, 1 },  // 7
+    { 0x0107, "PVT", "DATA1", 7, 1 },  // 8
+    { 0x0109, "ODO", "POLL0", 8, 0 },  // 9
+    { 0x0109, "ODO", "DATA0", 8, 1 },  // 10
+    { 0x0110, "RESETODO", "DATA0", 9, 0 },  // 11
+    { 0x0111, "VELECEF", "DATA0", 9, 1 },  // 12
+    { 0x0112, "VELNED", "DATA0", 10, 1 },  // 13
+    { 0x0113, "HPPOSECEF", "DATA0", 11, 1 },  // 14
+    { 0x0114, "HPPOSLLH", "DATA0", 12, 1 },  // 15
+    { 0x0117, "PVAT", "POLL0", 13, 0 },  // 16
+    { 0x0117, "PVAT", "DATA0", 13, 1 },  // 17
+    { 0x0120, "TIMEGPS", "DATA0", 14, 1 },  // 18
+    { 0x0121, "TIMEUTC", "DATA0", 15, 1 },  // 19
+    { 0x0122, "CLOCK", "DATA0", 16, 1 },  // 20
+    { 0x0123, "TIMEGLO", "POLL0", 17, 0 },  // 21
+    { 0x0123, "TIMEGLO", "DATA0", 17, 1 },  // 22
+    { 0x0124, "TIMEBDS", "DATA0", 18, 1 },  // 23
+    { 0x0125, "TIMEGAL", "POLL0", 19, 0 },  // 24
+    { 0x0125, "TIMEGAL", "DATA0", 19, 1 },  // 25
+    { 0x0126, "TIMELS", "DATA0", 20, 1 },  // 26
+    { 0x0127, "TIMEQZSS", "POLL0", 21, 0 },  // 27
+    { 0x0127, "TIMEQZSS", "DATA0", 21, 1 },  // 28
+    { 0x0128, "NMI", "POLL0", 22, 0 },  // 29
+    { 0x0128, "NMI", "DATA0", 22, 1 },  // 30
+    { 0x0130, "SVINFO", "DATA0", 23, 2 },  // 31
+    { 0x0131, "DGPS", "DATA0", 25, 2 },  // 32
+    { 0x0132, "SBAS", "DATA0", 27, 2 },  // 33
+    { 0x0134, "ORB", "DATA0", 29, 2 },  // 34
+    { 0x0135, "SAT", "DATA0", 31, 2 },  // 35
+    { 0x0136, "COV", "POLL0", 33, 0 },  // 36
+    { 0x0136, "COV", "DATA0", 33, 1 },  // 37
+    { 0x0139, "GEOFENCE", "DATA0", 34, 2 },  // 38
+    { 0x013A, "DGNSS", "DATA0", 36, 2 },  // 39
+    { 0x013B, "SVIN", "POLL0", 38, 0 },  // 40
+    { 0x013B, "SVIN", "DATA0", 38, 1 },  // 41
+    { 0x013C, "RELPOSNED", "POLL0", 39, 0 },  // 42
+    { 0x013C, "RELPOSNED", "DATA0", 39, 1 },  // 43
+    { 0x013C, "RELPOSNED", "DATA1", 40, 1 },  // 44
+    { 0x013D, "EELL", "POLL0", 41, 0 },  // 45
+    { 0x013D, "EELL", "DATA0", 41, 1 },  // 46
+    { 0x0140, "EKFSTATUS", "DATA0", 42, 1 },  // 47
+    { 0x0142, "SLAS", "DATA0", 43, 2 },  // 48
+    { 0x0143, "SIG", "DATA0", 45, 2 },  // 49
+    { 0x0150, "IMES", "POLL0", 47, 0 },  // 50
+    { 0x0150, "IMES", "DATA0", 47, 2 },  // 51
+    { 0x0150, "IMES", "DATA1", 49, 2 },  // 52
+    { 0x0160, "AOPSTATUS", "DATA0", 51, 1 },  // 53
+    { 0x0160, "AOPSTATUS", "DATA1", 52, 1 },  // 54
+    { 0x0161, "EOE", "DATA0", 53, 1 },  // 55
+    { 0x0162, "PL", "DATA1", 54, 1 },  // 56
+    { 0x0163, "TIMENAVIC", "POLL0", 55, 0 },  // 57
+    { 0x0163, "TIMENAVIC", "DATA0", 55, 1 },  // 58
+    { 0x0164, "TIMETRUSTED", "DATA0", 56, 1 },  // 59
+    { 0x0165, "CFB", "POLL0", 57, 0 },  // 60
+    { 0x0165, "CFB", "DATA0", 57, 1 },  // 61
+    { 0x0210, "RAW", "DATA0", 58, 2 },  // 62
+    { 0x0211, "SFRB", "DATA0", 60, 1 },  // 63
+    { 0x0213, "SFRBX", "POLL0", 61, 0 },  // 64
+    { 0x0213, "SFRBX", "DATA0", 61, 2 },  // 65
+    { 0x0213, "SFRBX", "DATA1", 63, 2 },  // 66
+    { 0x0213, "SFRBX", "DATA2", 65, 2 },  // 67
+    { 0x0214, "MEASX", "POLL0", 67, 0 },  // 68
+    { 0x0214, "MEASX", "DATA1", 67, 2 },  // 69
+    { 0x0215, "RAWX", "DATA0", 69, 2 },  // 70
+    { 0x0215, "RAWX", "DATA1", 71, 2 },  // 71
+    { 0x0216, "MEASX2", "POLL0", 73, 0 },  // 72
+    { 0x0216, "MEASX2", "DATA0", 73, 2 },  // 73
+    { 0x0220, "SVSI", "DATA0", 75, 2 },  // 74
+    { 0x0230, "ALM", "POLL0", 77, 0 },  // 75
+    { 0x0230, "ALM", "POLLID", 77, 1 },  // 76
+    { 0x0230, "ALM", "DATA1", 78, 2 },  // 77
+    { 0x0231, "EPH", "POLL0", 80, 0 },  // 78
+    { 0x0231, "EPH", "POLLID", 80, 1 },  // 79
+    { 0x0231, "EPH", "DATA1", 81, 2 },  // 80
+    { 0x0232, "RTCM", "DATA1", 83, 1 },  // 81
+    { 0x0233, "SPARTN", "DATA0", 84, 1 },  // 82
+    { 0x0234, "COR", "DATA0", 85, 1 },  // 83
+    { 0x0236, "SPARTNKEY", "DATA0", 86, 3 },  // 84
+    { 0x0236, "SPARTNKEY", "POLL0", 89, 0 },  // 85
+    { 0x0241, "PMREQ", "0", 89, 1 },  // 86
+    { 0x0241, "PMREQ", "1", 90, 1 },  // 87
+    { 0x0259, "RLM", "SHORT", 91, 1 },  // 88
+    { 0x0259, "RLM", "LONG", 92, 1 },  // 89
+    { 0x0261, "IMES", "POLL0", 93, 0 },  // 90
+    { 0x0261, "IMES", "DATA0", 93, 2 },  // 91
+    { 0x0272, "PMP", "POLL0", 95, 0 },  // 92
+    { 0x0272, "PMP", "DATA0", 95, 1 },  // 93
+    { 0x0272, "PMP", "DATA1", 96, 2 },  // 94
+    { 0x0272, "PMP", "DATA2", 98, 2 },  // 95
+    { 0x0273, "QZSSL6", "DATA1", 100, 1 },  // 96
+    { 0x0273, "QZSSL6", "DATA2", 101, 1 },  // 97
+    { 0x0274, "TM", "POLL0", 102, 0 },  // 98
+    { 0x0274, "TM", "DATA0", 102, 2 },  // 99
+    { 0x0280, "MEASD12", "DATA0", 104, 1 },  // 100
+    { 0x0282, "MEASC12", "DATA0", 105, 1 },  // 101
+    { 0x0284, "MEAS20", "DATA0", 106, 1 },  // 102
+    { 0x0286, "MEAS50", "DATA0", 107, 1 },  // 103
+    { 0x0400, "ERROR", "DATA0", 108, 1 },  // 104
+    { 0x0401, "WARNING", "DATA0", 109, 1 },  // 105
+    { 0x0402, "NOTICE", "DATA0", 110, 1 },  // 106
+    { 0x0403, "TEST", "DATA0", 111, 1 },  // 107
+    { 0x0404, "DEBUG", "DATA0", 112, 1 },  // 108
+    { 0x0500, "NAK", "DATA0", 113, 1 },  // 109
+    { 0x0501, "ACK", "DATA0", 114, 1 },  // 110
+    { 0x0600, "PRT", "POLL0", 115, 0 },  // 111
+    { 0x0600, "PRT", "POLLID", 115, 1 },  // 112
+    { 0x0600, "PRT", "UART", 116, 1 },  // 113
+    { 0x0600, "PRT", "USB", 117, 1 },  // 114
+    { 0x0600, "PRT", "SPI", 118, 1 },  // 115
+    { 0x0600, "PRT", "DDC", 119, 1 },  // 116
+    { 0x0601, "MSG", "POLLID", 120, 1 },  // 117
+    { 0x0601, "MSG", "SETU5", 121, 1 },  // 118
+    { 0x0601, "MSG", "SETCURRENT", 122, 1 },  // 119
+    { 0x0602, "INF", "POLLID", 123, 1 },  // 120
+    { 0x0602, "INF", "DATA1", 124, 1 },  // 121
+    { 0x0604, "RST", "DATA0", 125, 1 },  // 122
+    { 0x0604, "RST", "DATA1", 126, 1 },  // 123
+    { 0x0604, "RST", "DATA2", 127, 1 },  // 124
+    { 0x0604, "RST", "DATA3", 128, 1 },  // 125
+    { 0x0606, "DAT", "POLL0", 129, 0 },  // 126
+    { 0x0606, "DAT", "SETSTD", 129, 1 },  // 127
+    { 0x0606, "DAT", "SETCUSTOM", 130, 1 },  // 128
+    { 0x0606, "DAT", "GETCURRENT", 131, 1 },  // 129
+    { 0x0607, "TP", "POLL0", 132, 0 },  // 130
+    { 0x0607, "TP", "DATA0", 132, 1 },  // 131
+    { 0x0608, "RATE", "POLL0", 133, 0 },  // 132
+    { 0x0608, "RATE", "DATA0", 133, 1 },  // 133
+    { 0x0609, "CFG", "U5", 134, 2 },  // 134
+    { 0x0609, "CFG", "DATA1", 136, 2 },  // 135
+    { 0x060E, "FXN", "POLL0", 138, 0 },  // 136
+    { 0x060E, "FXN", "DATA0", 138, 1 },  // 137
+    { 0x0611, "RXM", "POLL0", 139, 0 },  // 138
+    { 0x0611, "RXM", "DATA1", 139, 1 },  // 139
+    { 0x0611, "RXM", "DATA2", 140, 1 },  // 140
+    { 0x0612, "EKF", "POLL0", 141, 0 },  // 141
+    { 0x0612, "EKF", "DATA1", 141, 1 },  // 142
+    { 0x0612, "EKF", "DATA2", 142, 1 },  // 143
+    { 0x0613, "ANT", "POLL0", 143, 0 },  // 144
+    { 0x0613, "ANT", "DATA0", 143, 1 },  // 145
+    { 0x0613, "ANT", "DATA1", 144, 1 },  // 146
+    { 0x0616, "SBAS", "POLL0", 145, 0 },  // 147
+    { 0x0616, "SBAS", "U5", 145, 1 },  // 148
+    { 0x0617, "NMEA", "POLL0", 146, 0 },  // 149
+    { 0x0617, "NMEA", "DATA0", 146, 1 },  // 150
+    { 0x0617, "NMEA", "DATA1", 147, 1 },  // 151
+    { 0x0617, "NMEA", "DATA2", 148, 1 },  // 152
+    { 0x061B, "USB", "POLL0", 149, 0 },  // 153
+    { 0x061B, "USB", "DATA0", 149, 1 },  // 154
+    { 0x061D, "TMODE", "POLL0", 150, 0 },  // 155
+    { 0x061D, "TMODE", "DATA0", 150, 1 },  // 156
+    { 0x061E, "ODO", "POLL1", 151, 0 },  // 157
+    { 0x061E, "ODO", "DATA1", 151, 1 },  // 158
+    { 0x0623, "NAVX5", "POLL0", 152, 0 },  // 159
+    { 0x0623, "NAVX5", "DATA0", 152, 1 },  // 160
+    { 0x0623, "NAVX5", "DATA1", 153, 1 },  // 161
+    { 0x0623, "NAVX5", "DATA2", 154, 1 },  // 162
+    { 0x0623, "NAVX5", "DATA3", 155, 1 },  // 163
+    { 0x0624, "NAV5", "POLL0", 156, 0 },  // 164
+    { 0x0624, "NAV5", "DATA0", 156, 1 },  // 165
+    { 0x0629, "ESFGWT", "DATA6R", 157, 1 },  // 166
+    { 0x062F, "ESFLA", "POLL0", 158, 0 },  // 167
+    { 0x062F, "ESFLA", "DATA0", 158, 2 },  // 168
+    { 0x0631, "TP5", "POLL0", 160, 0 },  // 169
+    { 0x0631, "TP5", "POLLIX", 160, 1 },  // 170
+    { 0x0631, "TP5", "DATA0", 161, 1 },  // 171
+    { 0x0631, "TP5", "DATA1", 162, 1 },  // 172
+    { 0x0632, "PM", "POLL0", 163, 0 },  // 173
+    { 0x0632, "PM", "DATA0", 163, 1 },  // 174
+    { 0x0634, "RINV", "POLL0", 164, 0 },  // 175
+    { 0x0634, "RINV", "DATA0", 164, 2 },  // 176
+    { 0x0639, "ITFM", "DATA0", 166, 1 },  // 177
+    { 0x0639, "ITFM", "POLL0", 167, 0 },  // 178
+    { 0x063B, "PM2", "POLL0", 167, 0 },  // 179
+    { 0x063B, "PM2", "DATA0", 167, 1 },  // 180
+    { 0x063B, "PM2", "DATA1", 168, 1 },  // 181
+    { 0x063B, "PM2", "DATA2", 169, 1 },  // 182
+    { 0x063D, "TMODE2", "POLL0", 170, 0 },  // 183
+    { 0x063D, "TMODE2", "DATA0", 170, 1 },  // 184
+    { 0x063E, "GNSS", "POLL0", 171, 0 },  // 185
+    { 0x063E, "GNSS", "DATA0", 171, 2 },  // 186
+    { 0x063F, "IMES", "POLL0", 173, 0 },  // 187
+    { 0x0641, "OTP", "WRITEFILEJU_A4", 173, 2 },  // 188
+    { 0x0641, "OTP", "WRITEFILEJU_37", 175, 1 },  // 189
+    { 0x0647, "LOGFILTER", "POLL0", 176, 0 },  // 190
+    { 0x0647, "LOGFILTER", "DATA0", 176, 1 },  // 191
+    { 0x064C, "ESFA", "POLL0", 177, 0 },  // 192
+    { 0x064C, "ESFA", "DATA0", 177, 1 },  // 193
+    { 0x064D, "ESFG", "POLL0", 178, 0 },  // 194
+    { 0x064D, "ESFG", "DATA0", 178, 1 },  // 195
+    { 0x0653, "TXSLOT", "POLL0", 179, 0 },  // 196
+    { 0x0653, "TXSLOT", "DATA0", 179, 2 },  // 197
+    { 0x0656, "ESFALG", "POLL0", 181, 0 },  // 198
+    { 0x0656, "ESFALG", "DATA0", 181, 1 },  // 199
+    { 0x0657, "PWR", "DATA1", 182, 1 },  // 200
+    { 0x065C, "HNR", "POLL0", 183, 0 },  // 201
+    { 0x065C, "HNR", "DATA0", 183, 1 },  // 202
+    { 0x0660, "ESRC", "POLL0", 184, 0 },  // 203
+    { 0x0660, "ESRC", "DATA0", 184, 2 },  // 204
+    { 0x0661, "DOSC", "POLL0", 186, 0 },  // 205
+    { 0x0661, "DOSC", "DATA0", 186, 2 },  // 206
+    { 0x0662, "SMGR", "POLL0", 188, 0 },  // 207
+    { 0x0662, "SMGR", "DATA0", 188, 1 },  // 208
+    { 0x0664, "SPT", "POLL0", 189, 0 },  // 209
+    { 0x0664, "SPT", "DATA0", 189, 1 },  // 210
+    { 0x0669, "GEOFENCE", "POLL0", 190, 0 },  // 211
+    { 0x0669, "GEOFENCE", "DATA0", 190, 2 },  // 212
+    { 0x0670, "DGNSS", "POLL0", 192, 0 },  // 213
+    { 0x0670, "DGNSS", "DATA1", 192, 1 },  // 214
+    { 0x0671, "TMODE3", "POLL0", 193, 0 },  // 215
+    { 0x0671, "TMODE3", "DATA0", 193, 1 },  // 216
+    { 0x0682, "ESFWT", "POLL0", 194, 0 },  // 217
+    { 0x0682, "ESFWT", "DATA0", 194, 1 },  // 218
+    { 0x0686, "PMS", "POLL0", 195, 0 },  // 219
+    { 0x0686, "PMS", "DATA0", 195, 1 },  // 220
+    { 0x0688, "SENIF", "POLL0", 196, 0 },  // 221
+    { 0x0688, "SENIF", "I2CDATA0", 196, 1 },  // 222
+    { 0x068A, "VALSET", "DATA0", 197, 2 },  // 223
+    { 0x068A, "VALSET", "DATA1", 199, 2 },  // 224
+    { 0x068B, "VALGET", "POLLID", 201, 2 },  // 225
+    { 0x068B, "VALGET", "DATA0", 203, 2 },  // 226
+    { 0x068C, "VALDEL", "DATA0", 205, 2 },  // 227
+    { 0x068C, "VALDEL", "DATA1", 207, 2 },  // 228
+    { 0x068D, "SLAS", "POLL0", 209, 0 },  // 229
+    { 0x068D, "SLAS", "DATA0", 209, 1 },  // 230
+    { 0x0693, "BATCH", "POLL0", 210, 0 },  // 231
+    { 0x0693, "BATCH", "DATA0", 210, 1 },  // 232
+    { 0x0914, "SOS", "POLL0", 211, 0 },  // 233
+    { 0x0914, "SOS", "BACKUP", 211, 1 },  // 234
+    { 0x0914, "SOS", "CLEAR", 212, 1 },  // 235
+    { 0x0914, "SOS", "ACK", 213, 1 },  // 236
+    { 0x0914, "SOS", "RESTORED", 214, 1 },  // 237
+    { 0x0A02, "IO", "DATA0", 215, 1 },  // 238
+    { 0x0A04, "VER", "POLL0", 216, 0 },  // 239
+    { 0x0A04, "VER", "DATA0", 216, 2 },  // 240
+    { 0x0A06, "MSGPP", "U5", 218, 1 },  // 241
+    { 0x0A07, "RXBUF", "U5", 219, 1 },  // 242
+    { 0x0A08, "TXBUF", "U5", 220, 1 },  // 243
+    { 0x0A09, "HW", "U5_0", 221, 1 },  // 244
+    { 0x0A09, "HW", "U5_1", 222, 1 },  // 245
+    { 0x0A09, "HW", "U6", 223, 1 },  // 246
+    { 0x0A09, "HW", "TITLIS", 224, 1 },  // 247
+    { 0x0A09, "HW", "U10", 225, 1 },  // 248
+    { 0x0A09, "HW", "U20", 226, 1 },  // 249
+    { 0x0A0B, "HW2", "DATA0", 227, 1 },  // 250
+    { 0x0A21, "RXR", "VER0", 228, 1 },  // 251
+    { 0x0A27, "PATCH", "POLL0", 229, 0 },  // 252
+    { 0x0A27, "PATCH", "DATA0", 229, 2 },  // 253
+    { 0x0A28, "GNSS", "POLL0", 231, 0 },  // 254
+    { 0x0A28, "GNSS", "DATA0", 231, 1 },  // 255
+    { 0x0A28, "GNSS", "DATA1", 232, 2 },  // 256
+    { 0x0A2E, "SMGR", "POLL0", 234, 0 },  // 257
+    { 0x0A2E, "SMGR", "DATA0", 234, 1 },  // 258
+    { 0x0A2F, "SPT", "DATA1", 235, 3 },  // 259
+    { 0x0A31, "SPAN", "POLL0", 238, 0 },  // 260
+    { 0x0A31, "SPAN", "DATA0", 238, 2 },  // 261
+    { 0x0A32, "BATCH", "POLL0", 240, 0 },  // 262
+    { 0x0A32, "BATCH", "DATA0", 240, 1 },  // 263
+    { 0x0A35, "PMP", "POLL0", 241, 0 },  // 264
+    { 0x0A35, "PMP", "DATA0", 241, 2 },  // 265
+    { 0x0A36, "COMMS", "POLL0", 243, 0 },  // 266
+    { 0x0A36, "COMMS", "DATA0", 243, 2 },  // 267
+    { 0x0A37, "HW3", "POLL0", 245, 0 },  // 268
+    { 0x0A37, "HW3", "DATA0", 245, 2 },  // 269
+    { 0x0A38, "RF", "POLL0", 247, 0 },  // 270
+    { 0x0A38, "RF", "DATA0", 247, 2 },  // 271
+    { 0x0A38, "RF", "DATA1", 249, 2 },  // 272
+    { 0x0A39, "SYS", "POLL0", 251, 0 },  // 273
+    { 0x0A39, "SYS", "DATA0", 251, 1 },  // 274
+    { 0x0A3B, "POST", "POLL0", 252, 0 },  // 275
+    { 0x0A3B, "POST", "DATA0", 252, 1 },  // 276
+    { 0x0A3D, "INST", "DATA0", 253, 1 },  // 277
+    { 0x0A40, "RCVRSTAT", "POLL0", 254, 0 },  // 278
+    { 0x0A40, "RCVRSTAT", "DATA0", 254, 13 },  // 279
+    { 0x0B00, "REQ", "0", 267, 0 },  // 280
+    { 0x0B01, "INI", "POLL0", 267, 0 },  // 281
+    { 0x0B01, "INI", "U5", 267, 1 },  // 282
+    { 0x0B01, "INI", "U6", 268, 1 },  // 283
+    { 0x0B01, "INI", "U6M", 269, 1 },  // 284
+    { 0x0B02, "HUI", "POLL0", 270, 0 },  // 285
+    { 0x0B02, "HUI", "DATA1", 270, 1 },  // 286
+    { 0x0B10, "DATA", "POLL0", 271, 0 },  // 287
+    { 0x0B30, "ALM", "POLL0", 271, 0 },  // 288
+    { 0x0B30, "ALM", "POLLID", 271, 1 },  // 289
+    { 0x0B30, "ALM", "DATA0", 272, 2 },  // 290
+    { 0x0B31, "EPH", "POLL0", 274, 0 },  // 291
+    { 0x0B31, "EPH", "POLLID", 274, 1 },  // 292
+    { 0x0B31, "EPH", "DATA0", 275, 2 },  // 293
+    { 0x0B32, "ALPSRV", "REQ", 277, 1 },  // 294
+    { 0x0B32, "ALPSRV", "SRV", 278, 2 },  // 295
+    { 0x0B32, "ALPSRV", "CLI", 280, 2 },  // 296
+    { 0x0B33, "AOP", "POLL0", 282, 0 },  // 297
+    { 0x0B33, "AOP", "POLLID", 282, 1 },  // 298
+    { 0x0B33, "AOP", "DATA0", 283, 2 },  // 299
+    { 0x0B33, "AOP", "DATA1", 285, 2 },  // 300
+    { 0x0B33, "AOP", "DATA2", 287, 2 },  // 301
+    { 0x0B50, "ALP", "TX", 289, 1 },  // 302
+    { 0x0B50, "ALP", "STOP", 290, 1 },  // 303
+    { 0x0B50, "ALP", "ACK", 291, 1 },  // 304
+    { 0x0B50, "ALP", "NAK", 292, 1 },  // 305
+    { 0x0B50, "ALP", "STAT", 293, 1 },  // 306
+    { 0x0B50, "ALP", "STATEXT", 294, 1 },  // 307
+    { 0x0D01, "TP", "DATA0", 295, 1 },  // 308
+    { 0x0D03, "TM2", "DATA1", 296, 1 },  // 309
+    { 0x0D04, "SVIN", "DATA0", 297, 1 },  // 310
+    { 0x0D06, "VRFY", "DATA1", 298, 1 },  // 311
+    { 0x0D11, "DOSC", "DATA0", 299, 1 },  // 312
+    { 0x0D12, "TOS", "DATA0", 300, 1 },  // 313
+    { 0x0D13, "SMEAS", "DATA0", 301, 2 },  // 314
+    { 0x0D15, "VCOCAL", "STOP", 303, 1 },  // 315
+    { 0x0D15, "VCOCAL", "CMD1", 304, 1 },  // 316
+    { 0x0D15, "VCOCAL", "DATA0", 305, 1 },  // 317
+    { 0x0D16, "FCHG", "DATA0", 306, 1 },  // 318
+    { 0x0D17, "HOC", "DATA0", 307, 1 },  // 319
+    { 0x1002, "MEAS", "DATA0", 308, 3 },  // 320
+    { 0x1002, "MEAS", "DATA6R", 311, 3 },  // 321
+    { 0x1003, "RAW", "DATA0", 314, 2 },  // 322
+    { 0x1004, "CAL", "POLL0", 316, 0 },  // 323
+    { 0x1004, "CAL", "DATA0", 316, 2 },  // 324
+    { 0x1010, "STATUS", "DATA6R", 318, 2 },  // 325
+    { 0x1010, "STATUS", "DATA2", 320, 2 },  // 326
+    { 0x1010, "STATUS", "DATA3", 322, 2 },  // 327
+    { 0x1013, "RESETALG", "DATA0", 324, 0 },  // 328
+    { 0x1014, "ALG", "POLL0", 324, 0 },  // 329
+    { 0x1014, "ALG", "DATA1", 324, 1 },  // 330
+    { 0x1015, "INS", "POLL0", 325, 0 },  // 331
+    { 0x1015, "INS", "DATA1", 325, 1 },  // 332
+    { 0x1300, "GPS", "EPH", 326, 1 },  // 333
+    { 0x1300, "GPS", "ALM", 327, 1 },  // 334
+    { 0x1300, "GPS", "HEALTH", 328, 1 },  // 335
+    { 0x1300, "GPS", "UTC", 329, 1 },  // 336
+    { 0x1300, "GPS", "IONO", 330, 1 },  // 337
+    { 0x1302, "GAL", "EPH", 331, 1 },  // 338
+    { 0x1302, "GAL", "ALM", 332, 1 },  // 339
+    { 0x1302, "GAL", "TIMEOFFSET", 333, 1 },  // 340
+    { 0x1302, "GAL", "UTC", 334, 1 },  // 341
+    { 0x1302, "GAL", "IONO", 335, 1 },  // 342
+    { 0x1302, "GAL", "OSNMA_PUBKEY", 336, 1 },  // 343
+    { 0x1302, "GAL", "OSNMA_MERKLE", 337, 1 },  // 344
+    { 0x1303, "BDS", "EPH", 338, 1 },  // 345
+    { 0x1303, "BDS", "ALM", 339, 1 },  // 346
+    { 0x1303, "BDS", "HEALTH", 340, 1 },  // 347
+    { 0x1303, "BDS", "UTC", 341, 1 },  // 348
+    { 0x1303, "BDS", "IONO", 342, 1 },  // 349
+    { 0x1305, "QZSS", "EPH", 343, 1 },  // 350
+    { 0x1305, "QZSS", "ALM", 344, 1 },  // 351
+    { 0x1305, "QZSS", "HEALTH", 345, 1 },  // 352
+    { 0x1306, "GLO", "EPH", 346, 1 },  // 353
+    { 0x1306, "GLO", "ALM", 347, 1 },  // 354
+    { 0x1306, "GLO", "TIMEOFFSET", 348, 1 },  // 355
+    { 0x1310, "SF", "INI", 349, 3 },  // 356
+    { 0x1310, "SF", "INI2", 352, 1 },  // 357
+    { 0x1320, "ANO", "DATA0", 353, 4 },  // 358
+    { 0x1321, "FLASH", "DATA", 357, 2 },  // 359
+    { 0x1321, "FLASH", "STOP", 359, 1 },  // 360
+    { 0x1321, "FLASH", "ACK", 360, 1 },  // 361
+    { 0x1340, "INI", "POS_XYZ", 361, 1 },  // 362
+    { 0x1340, "INI", "POS_LLH", 362, 1 },  // 363
+    { 0x1340, "INI", "TIME_UTC", 363, 1 },  // 364
+    { 0x1340, "INI", "TIME_GNSS", 364, 1 },  // 365
+    { 0x1340, "INI", "CLKD", 365, 1 },  // 366
+    { 0x1340, "INI", "FREQ", 366, 1 },  // 367
+    { 0x1340, "INI", "EOP", 367, 1 },  // 368
+    { 0x1340, "INI", "ATT", 368, 1 },  // 369
+    { 0x1360, "ACK", "DATA0", 369, 1 },  // 370
+    { 0x1380, "DBD", "POLL", 370, 0 },  // 371
+    { 0x1380, "DBD", "DATA0", 370, 2 },  // 372
+    { 0x2103, "ERASE", "DATA0", 372, 0 },  // 373
+    { 0x2104, "STRING", "DATA0", 372, 1 },  // 374
+    { 0x2107, "CREATE", "CREATE0", 373, 1 },  // 375
+    { 0x2108, "INFO", "POLL0", 374, 0 },  // 376
+    { 0x2108, "INFO", "DATA0", 374, 1 },  // 377
+    { 0x2109, "RETRIEVE", "REQ0", 375, 1 },  // 378
+    { 0x210B, "RETRIEVEPOS", "POS0", 376, 1 },  // 379
+    { 0x210D, "RETRIEVESTRING", "STRING0", 377, 2 },  // 380
+    { 0x210E, "FINDTIME", "REQUEST", 379, 1 },  // 381
+    { 0x210E, "FINDTIME", "RESPONSE", 380, 1 },  // 382
+    { 0x210F, "RETRIEVEPOSEXTRA", "ODOMETER0", 381, 1 },  // 383
+    { 0x2110, "RETRIEVEBATCH", "REQ0", 382, 1 },  // 384
+    { 0x2111, "BATCH", "DATA0", 383, 1 },  // 385
+    { 0x2703, "UNIQID", "POLL0", 384, 0 },  // 386
+    { 0x2703, "UNIQID", "DATA0", 384, 1 },  // 387
+    { 0x2703, "UNIQID", "DATA1", 385, 1 },  // 388
+    { 0x2709, "SIG", "POLL0", 386, 0 },  // 389
+    { 0x2709, "SIG", "DATA0", 386, 1 },  // 390
+    { 0x2709, "SIG", "DATA1", 387, 2 },  // 391
+    { 0x270A, "OSNMA", "DATA0", 389, 2 },  // 392
+    { 0x270A, "OSNMA", "DATA1", 391, 2 },  // 393
+    { 0x270A, "OSNMA", "DATA2", 393, 2 },  // 394
+    { 0x2710, "SIGLOG", "POLL0", 395, 0 },  // 395
+    { 0x2710, "SIGLOG", "DATA0", 395, 2 },  // 396
+    { 0x2710, "SIGLOG", "DATA1", 397, 2 },  // 397
+    { 0x2800, "PVT", "POLL0", 399, 0 },  // 398
+    { 0x2800, "PVT", "DATA0", 399, 1 },  // 399
+    { 0x2801, "ATT", "DATA1", 400, 1 },  // 400
+    { 0x2802, "INS", "POLL0", 401, 0 },  // 401
+    { 0x2802, "INS", "DATA0", 401, 1 },  // 402
+    { 0x2901, "POSECEF", "DATA0", 402, 1 },  // 403
+    { 0x2902, "POSLLH", "DATA0", 403, 1 },  // 404
+    { 0x2903, "STATUS", "DATA1", 404, 1 },  // 405
+    { 0x2904, "DOP", "DATA0", 405, 1 },  // 406
+    { 0x2907, "PVT", "DATA1", 406, 1 },  // 407
+    { 0x2909, "ODO", "POLL0", 407, 0 },  // 408
+    { 0x2909, "ODO", "DATA0", 407, 1 },  // 409
+    { 0x2911, "VELECEF", "DATA0", 408, 1 },  // 410
+    { 0x2912, "VELNED", "DATA0", 409, 1 },  // 411
+    { 0x2917, "PVAT", "DATA0", 410, 1 },  // 412
+    { 0x2920, "TIMEGPS", "DATA0", 411, 1 },  // 413
+    { 0x2921, "TIMEUTC", "DATA0", 412, 1 },  // 414
+    { 0x2922, "CLOCK", "DATA0", 413, 1 },  // 415
+    { 0x2923, "TIMEGLO", "POLL0", 414, 0 },  // 416
+    { 0x2923, "TIMEGLO", "DATA0", 414, 1 },  // 417
+    { 0x2924, "TIMEBDS", "DATA0", 415, 1 },  // 418
+    { 0x2925, "TIMEGAL", "POLL0", 416, 0 },  // 419
+    { 0x2925, "TIMEGAL", "DATA0", 416, 1 },  // 420
+    { 0x2926, "TIMELS", "POLL0", 417, 0 },  // 421
+    { 0x2926, "TIMELS", "DATA0", 417, 1 },  // 422
+    { 0x2927, "TIMEQZSS", "POLL0", 418, 0 },  // 423
+    { 0x2927, "TIMEQZSS", "DATA0", 418, 1 },  // 424
+    { 0x2932, "SBAS", "DATA0", 419, 2 },  // 425
+    { 0x2935, "SAT", "DATA0", 421, 2 },  // 426
+    { 0x2936, "COV", "POLL0", 423, 0 },  // 427
+    { 0x2936, "COV", "DATA0", 423, 1 },  // 428
+    { 0x293B, "SVIN", "POLL0", 424, 0 },  // 429
+    { 0x293B, "SVIN", "DATA0", 424, 1 },  // 430
+    { 0x293D, "EELL", "POLL0", 425, 0 },  // 431
+    { 0x293D, "EELL", "DATA0", 425, 1 },  // 432
+    { 0x2942, "SLAS", "DATA0", 426, 2 },  // 433
+    { 0x2943, "SIG", "DATA0", 428, 2 },  // 434
+    { 0x2961, "EOE", "DATA0", 430, 1 },  // 435
+    { 0x2963, "TIMENAVIC", "POLL0", 431, 0 },  // 436
+    { 0x2963, "TIMENAVIC", "DATA0", 431, 1 },  // 437
+    { 0xF000, "GGA", "", 0, 0 },  // 438
+    { 0xF001, "GLL", "", 0, 0 },  // 439
+    { 0xF002, "GSA", "", 0, 0 },  // 440
+    { 0xF003, "GSV", "", 0, 0 },  // 441
+    { 0xF004, "RMC", "", 0, 0 },  // 442
+    { 0xF005, "VTG", "", 0, 0 },  // 443
+    { 0xF006, "GRS", "", 0, 0 },  // 444
+    { 0xF007, "GST", "", 0, 0 },  // 445
+    { 0xF008, "ZDA", "", 0, 0 },  // 446
+    { 0xF009, "GBS", "", 0, 0 },  // 447
+    { 0xF00A, "DTM", "", 0, 0 },  // 448
+    { 0xF00B, "RLM", "", 0, 0 },  // 449
+    { 0xF00D, "GNS", "", 0, 0 },  // 450
+    { 0xF00E, "THS", "", 0, 0 },  // 451
+    { 0xF00F, "VLW", "", 0, 0 },  // 452
+    { 0xF010, "UTC", "", 0, 0 },  // 453
+    { 0xF040, "GPQ", "", 0, 0 },  // 454
+    { 0xF041, "TXT", "", 0, 0 },  // 455
+    { 0xF042, "GNQ", "", 0, 0 },  // 456
+    { 0xF043, "GLQ", "", 0, 0 },  // 457
+    { 0xF044, "GBQ", "", 0, 0 },  // 458
+    { 0xF045, "GAQ", "", 0, 0 },  // 459
+    { 0xF047, "GQQ", "", 0, 0 },  // 460
+    { 0xF100, "POSITION", "", 0, 0 },  // 461
+    { 0xF103, "SVSTATUS", "", 0, 0 },  // 462
+    { 0xF104, "TIME", "", 0, 0 },  // 463
+    { 0xF105, "ADRSTATUS", "", 0, 0 },  // 464
+    { 0xF106, "ADRPOSITION", "", 0, 0 },  // 465
+    { 0xF140, "RATE", "", 0, 0 },  // 466
+    { 0xF141, "CONFIG", "", 0, 0 },  // 467
+    { 0xF700, "GGA", "", 0, 0 },  // 468
+    { 0xF701, "GLL", "", 0, 0 },  // 469
+    { 0xF702, "GSA", "", 0, 0 },  // 470
+    { 0xF704, "RMC", "", 0, 0 },  // 471
+    { 0xF705, "VTG", "", 0, 0 },  // 472
+    { 0xF708, "ZDA", "", 0, 0 },  // 473
+    { 0xF70D, "GNS", "", 0, 0 },  // 474
+};
+
+static const ubx_msgdb_cond_t ubx_msgdb_conds[] = {
+    { -1, 1, 0, 1 },
+    { -1, 1, 1, 1 },
+    { -1, 1, 2, 1 },
+    { -1, 1, 3, 1 },
+    { -1, 1, 4, 1 },
+    { -1, 1, 5, 1 },
+    { -1, 1, 6, 1 },
+    { 0, 1, 7, 1 },
+    { -1, 1, 8, 1 },
+    { 0, 1, 9, 1 },
+    { -1, 1, 10, 1 },
+    { -1, 1, 11, 1 },
+    { -1, 1, 12, 1 },
+    { 1, 1, 13, 1 },
+    { -1, 1, 14, 1 },
+    { -1, 1, 15, 1 },
+    { -1, 1, 16, 2 },
+    { -1, 1, 18, 2 },
+    { -1, 1, 20, 1 },
+    { -1, 1, 21, 1 },
+    { -1, 1, 22, 1 },
+    { -1, 1, 23, 1 },
+    { -1, 1, 24, 1 },
+    { -1, 1, 25, 1 },
+    { -1, 1, 26, 1 },
+    { -1, 1, 27, 1 },
+    { -1, 1, 28, 1 },
+    { -1, 1, 29, 1 },
+    { -1, 1, 30, 1 },
+    { -1, 1, 31, 1 },
+    { -1, 1, 32, 1 },
+    { -1, 1, 33, 1 },
+    { 0, 1, 34, 1 },
+    { -1, 1, 35, 2 },
+    { -1, 1, 37, 1 },
+    { -1, 1, 38, 1 },
+    { -1, 1, 39, 1 },
+    { -1, 1, 40, 1 },
+    { -1, 1, 41, 1 },
+    { -1, 1, 42, 1 },
+    { -1, 1, 43, 1 },
+    { -1, 1, 44, 1 },
+    { -1, 1, 45, 1 },
+    { -1, 1, 46, 1 },
+    { 0, 1, 47, 1 },
+    { -1, 1, 48, 1 },
+    { 0, 1, 49, 1 },
+    { -1, 1, 50, 1 },
+    { 0, 1, 51, 1 },
+    { -1, 1, 52, 1 },
+    { 0, 1, 53, 1 },
+    { -1, 1, 54, 1 },
+    { 0, 1, 55, 1 },
+    { -1, 1, 56, 1 },
+    { 0, 1, 57, 1 },
+    { -1, 1, 58, 1 },
+    { -1, 1, 59, 1 },
+    { -1, 1, 60, 1 },
+    { 0, 1, 61, 1 },
+    { -1, 1, 62, 1 },
+    { 0, 1, 63, 1 },
+    { -1, 1, 64, 1 },
+    { -1, 1, 65, 1 },
+    { -1, 1, 66, 1 },
+    { -1, 1, 67, 1 },
+    { -1, 1, 68, 1 },
+    { -1, 1, 69, 1 },
+    { -1, 1, 70, 1 },
+    { 0, 1, 71, 1 },
+    { -1, 1, 72, 1 },
+    { -1, 1, 73, 1 },
+    { -1, 1, 74, 1 },
+    { -1, 1, 75, 1 },
+    { -1, 1, 76, 1 },
+    { -1, 1, 77, 1 },
+    { 0, 2, 78, 1 },
+    { 0, 2, 79, 1 },
+    { 0, 2, 80, 1 },
+    { 0, 2, 81, 1 },
+    { -1, 1, 82, 1 },
+    { -1, 1, 83, 1 },
+    { -1, 1, 84, 1 },
+    { 11, 1, 85, 1 },
+    { -1, 1, 86, 1 },
+    { -1, 1, 87, 1 },
+    { -1, 1, 88, 1 },
+    { -1, 1, 89, 1 },
+    { 0, 1, 90, 1 },
+    { -1, 1, 91, 1 },
+    { 0, 1, 92, 1 },
+    { 0, 1, 93, 1 },
+    { 35, 1, 94, 1 },
+    { 0, 1, 95, 1 },
+    { -1, 1, 96, 1 },
+    { 0, 1, 97, 1 },
+    { -1, 1, 98, 1 },
+    { -1, 1, 99, 1 },
+    { -1, 1, 100, 1 },
+    { 0, 1, 101, 2 },
+    { -1, 1, 103, 1 },
+    { 0, 1, 104, 1 },
+    { -1, 1, 105, 1 },
+    { 0, 1, 106, 1 },
+    { -1, 1, 107, 1 },
+    { 0, 1, 108, 1 },
+    { 0, 1, 109, 1 },
+    { -1, 1, 110, 1 },
+    { -1, 1, 111, 1 },
+    { -1, 1, 112, 1 },
+    { -1, 1, 113, 1 },
+    { -1, 1, 114, 1 },
+    { -1, 1, 115, 1 },
+    { -1, 1, 116, 1 },
+    { -1, 1, 117, 1 },
+    { -1, 1, 118, 1 },
+    { -1, 1, 119, 1 },
+    { -1, 1, 120, 1 },
+    { -1, 1, 121, 1 },
+    { -1, 1, 122, 1 },
+    { -1, 1, 123, 1 },
+    { -1, 1, 124, 1 },
+    { -1, 1, 125, 1 },
+    { -1, 1, 126, 1 },
+    { -1, 1, 127, 1 },
+    { -1, 1, 128, 1 },
+    { -1, 1, 129, 1 },
+    { -1, 1, 130, 1 },
+    { -1, 1, 131, 1 },
+    { -1, 1, 132, 1 },
+    { -1, 1, 133, 1 },
+    { 1, 1, 134, 1 },
+    { -1, 1, 135, 1 },
+    { -1, 1, 136, 1 },
+    { -1, 1, 137, 1 },
+    { 0, 1, 138, 1 },
+    { 0, 1, 139, 1 },
+    { 0, 1, 140, 1 },
+    { 0, 1, 141, 1 },
+    { 0, 1, 142, 1 },
+    { 0, 1, 143, 1 },
+    { -1, 1, 144, 1 },
+    { 4, 1, 145, 1 },
+    { -1, 1, 146, 1 },
+    { 4, 1, 147, 1 },
+    { 0, 1, 148, 1 },
+    { -1, 1, 149, 1 },
+    { 4, 1, 150, 1 },
+    { 4, 1, 151, 1 },
+    { 4, 1, 152, 1 },
+    { 4, 1, 153, 1 },
+    { -1, 1, 154, 1 },
+    { 0, 1, 155, 1 },
+    { -1, 1, 156, 1 },
+    { -1, 1, 157, 1 },
+    { 0, 1, 158, 1 },
+    { 0, 1, 159, 1 },
+    { 0, 1, 160, 1 },
+    { 0, 1, 161, 1 },
+    { -1, 1, 162, 1 },
+    { 0, 1, 163, 1 },
+    { 8, 1, 164, 1 },
+    { 0, 1, 165, 1 },
+    { 28, 1, 166, 1 },
+    { 4, 1, 167, 1 },
+    { 4, 1, 168, 1 },
+    { 0, 1, 169, 1 },
+    { 1, 1, 170, 1 },
+    { -1, 1, 171, 1 },
+    { -1, 1, 172, 1 },
+    { 0, 1, 173, 1 },
+    { -1, 1, 174, 1 },
+    { -1, 1, 175, 1 },
+    { 0, 1, 176, 1 },
+    { 0, 1, 177, 1 },
+    { -1, 1, 178, 1 },
+    { -1, 1, 179, 1 },
+    { -1, 1, 180, 1 },
+    { -1, 1, 181, 1 },
+    { -1, 1, 182, 1 },
+    { -1, 1, 183, 1 },
+    { -1, 1, 184, 1 },
+    { -1, 1, 185, 1 },
+    { -1, 1, 186, 1 },
+    { -1, 1, 187, 1 },
+    { 0, 1, 188, 1 },
+    { -1, 1, 189, 1 },
+    { -1, 1, 190, 1 },
+    { 0, 1, 191, 1 },
+    { -1, 1, 192, 1 },
+    { 0, 1, 193, 1 },
+    { 0, 1, 194, 1 },
+    { -1, 1, 195, 1 },
+    { -1, 1, 196, 1 },
+    { -1, 1, 197, 1 },
+    { -1, 1, 198, 1 },
+    { 0, 1, 199, 1 },
+    { -1, 1, 200, 1 },
+    { 0, 1, 201, 1 },
+    { -1, 1, 202, 1 },
+    { -1, 1, 203, 1 },
+    { -1, 1, 204, 1 },
+    { -1, 1, 205, 1 },
+    { -1, 1, 206, 1 },
+    { 4, 1, 207, 1 },
+    { -1, 1, 208, 1 },
+    { -1, 1, 209, 1 },
+    { -1, 1, 210, 1 },
+    { -1, 1, 211, 1 },
+    { 4, 1, 212, 1 },
+    { -1, 1, 213, 1 },
+    { -1, 1, 214, 1 },
+    { 4, 1, 215, 1 },
+    { -1, 1, 216, 1 },
+    { -1, 1, 217, 1 },
+    { 4, 1, 218, 1 },
+    { -1, 1, 219, 1 },
+    { -1, 1, 220, 1 },
+    { -1, 1, 221, 1 },
+    { 1, 1, 222, 1 },
+    { 1, 1, 223, 1 },
+    { -1, 1, 224, 1 },
+    { -1, 1, 225, 1 },
+    { -1, 1, 226, 1 },
+    { 0, 1, 227, 1 },
+    { 0, 1, 228, 1 },
+    { -1, 1, 229, 1 },
+    { -1, 1, 230, 1 },
+    { -1, 1, 231, 1 },
+    { 4, 1, 232, 1 },
+    { -1, 1, 233, 1 },
+    { -1, 1, 234, 1 },
+    { -1, 1, 235, 1 },
+    { 0, 1, 236, 1 },
+    { 0, 1, 237, 1 },
+    { -1, 1, 238, 1 },
+    { 4, 1, 239, 1 },
+    { 4, 1, 240, 1 },
+    { -1, 1, 241, 1 },
+    { -1, 1, 242, 1 },
+    { -1, 1, 243, 1 },
+    { 0, 1, 244, 1 },
+    { -1, 1, 245, 1 },
+    { -1, 1, 246, 1 },
+    { -1, 1, 247, 1 },
+    { -1, 1, 248, 1 },
+    { -1, 1, 249, 1 },
+    { -1, 1, 250, 1 },
+    { -1, 1, 251, 1 },
+    { -1, 1, 252, 1 },
+    { -1, 1, 253, 1 },
+    { -1, 1, 254, 1 },
+    { -1, 1, 255, 1 },
+    { 0, 1, 256, 1 },
+    { -1, 1, 257, 1 },
+    { -1, 1, 258, 1 },
+    { -1, 1, 259, 1 },
+    { -1, 1, 260, 1 },
+    { -1, 1, 261, 1 },
+    { 4, 1, 262, 1 },
+    { -1, 1, 263, 1 },
+    { -1, 1, 264, 1 },
+    { 4, 1, 265, 1 },
+    { -1, 1, 266, 1 },
+    { -1, 1, 267, 1 },
+    { 0, 1, 268, 1 },
+    { -1, 1, 269, 1 },
+    { -1, 1, 270, 1 },
+    { 4, 1, 271, 1 },
+    { -1, 1, 272, 1 },
+    { 4, 1, 273, 1 },
+    { 4, 1, 274, 1 },
+    { -1, 1, 275, 1 },
+    { -1, 1, 276, 1 },
+    { 0, 1, 277, 1 },
+    { -1, 1, 278, 1 },
+    { -1, 1, 279, 1 },
+    { -1, 1, 280, 1 },
+    { -1, 1, 281, 1 },
+    { -1, 1, 282, 1 },
+    { -1, 1, 283, 1 },
+    { -1, 1, 284, 1 },
+    { -1, 1, 285, 1 },
+    { -1, 1, 286, 1 },
+    { -1, 1, 287, 1 },
+    { -1, 1, 288, 1 },
+    { -1, 1, 289, 1 },
+    { -1, 1, 290, 1 },
+    { -1, 1, 291, 1 },
+    { -1, 1, 292, 1 },
+    { -1, 1, 293, 1 },
+    { -1, 1, 294, 1 },
+    { -1, 1, 295, 2 },
+    { 0, 1, 297, 1 },
+    { -1, 1, 298, 1 },
+    { -1, 1, 299, 1 },
+    { -1, 1, 300, 2 },
+    { -1, 1, 302, 1 },
+    { 1, 1, 303, 1 },
+    { -1, 1, 304, 1 },
+    { -1, 1, 305, 1 },
+    { -1, 1, 306, 1 },
+    { -1, 1, 307, 1 },
+    { -1, 1, 308, 1 },
+    { 0, 1, 309, 1 },
+    { -1, 1, 310, 1 },
+    { -1, 1, 311, 1 },
+    { 0, 1, 312, 1 },
+    { 0, 1, 313, 1 },
+    { -1, 1, 314, 1 },
+    { 0, 1, 315, 1 },
+    { 0, 1, 316, 1 },
+    { 13, 1, 317, 1 },
+    { 13, 1, 318, 1 },
+    { 1, 1, 319, 1 },
+    { 1, 1, 320, 1 },
+    { 0, 1, 321, 1 },
+    { -1, 1, 322, 1 },
+    { -1, 1, 323, 1 },
+    { 6, 1, 324, 1 },
+    { 0, 1, 325, 1 },
+    { 6, 1, 326, 1 },
+    { 6, 1, 327, 1 },
+    { 6, 1, 328, 1 },
+    { 6, 1, 329, 2 },
+    { 0, 1, 331, 1 },
+    { 6, 1, 332, 1 },
+    { 6, 1, 333, 2 },
+    { 6, 1, 335, 1 },
+    { 0, 1, 336, 1 },
+    { -1, 1, 337, 1 },
+    { 0, 1, 338, 1 },
+    { -1, 1, 339, 1 },
+    { 0, 1, 340, 1 },
+    { 0, 1, 341, 1 },
+    { 0, 1, 342, 1 },
+    { 0, 1, 343, 1 },
+    { -1, 1, 344, 1 },
+    { 0, 1, 345, 1 },
+    { 0, 1, 346, 1 },
+    { -1, 1, 347, 1 },
+    { 0, 1, 348, 1 },
+    { 0, 1, 349, 1 },
+    { -1, 1, 350, 1 },
+    { 0, 1, 351, 1 },
+    { 0, 1, 352, 1 },
+    { 0, 1, 353, 1 },
+    { -1, 1, 354, 1 },
+    { -1, 1, 355, 1 },
+    { 0, 1, 356, 1 },
+    { -1, 1, 357, 1 },
+    { 0, 1, 358, 1 },
+    { 0, 1, 359, 1 },
+    { 0, 1, 360, 1 },
+    { -1, 1, 361, 1 },
+    { 0, 1, 362, 1 },
+    { 0, 1, 363, 1 },
+    { 0, 1, 364, 1 },
+    { 0, 1, 365, 1 },
+};
+
+static const uint16_t ubx_msgdb_vals[] = {
+    2, 2, 0, 1, 40, 8, 1, 0, 1, 1, 1, 24, 16, 255, 0, 1,
+    48, 192, 60, 204, 68, 0, 0, 1, 8, 104, 0, 72, 0, 48, 0, 0,
+    4, 0, 0, 12, 13, 0, 2, 44, 52, 0, 4, 0, 0, 16, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 0, 0, 0, 0,
+    0, 4, 0, 1, 8, 0, 0, 1, 2, 3, 8, 0, 36, 0, 0, 1,
+    2, 3, 0, 4, 12, 1, 0, 20, 0, 24, 0, 0, 1, 2, 0, 2,
+    0, 0, 0, 1, 20, 1, 2, 20, 3, 20, 4, 20, 0, 1, 0, 6,
+    0, 4, 0, 2, 0, 8, 0, 6, 0, 4, 0, 0, 0, 28, 0, 28,
+    0, 40, 0, 20, 0, 1, 1, 0, 0, 108, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 0, 1, 0, 0, 1, 2, 1, 0, 0, 0, 72, 0, 0,
+    0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 68, 60, 56, 76, 28, 0, 12, 120, 0, 0, 0, 0, 0, 1,
+    0, 0, 1, 24, 1, 0, 0, 1, 0, 1, 28, 0, 20, 16, 0, 0,
+    0, 40, 20, 0, 0, 18, 0, 0, 36, 4, 0, 28, 36, 0, 0, 2,
+    0, 16, 0, 0, 1, 20, 28, 0, 0, 84, 92, 0, 0, 1, 0, 0,
+    0, 52, 16, 0, 0, 20, 0, 20, 0, 20, 16, 24, 0, 20, 0, 20,
+    1, 20, 20, 36, 20, 0, 0, 18, 0, 0, 4, 0, 0, 20, 28, 0,
+    92, 0, 0, 16, 0, 0, 20, 0, 20, 0, 20, 16, 0, 24, 0, 20,
+    0, 20, 20, 20, 36, 0, 1, 8, 40, 1, 0, 1, 8, 104, 0, 1,
+    20, 50, 12, 12, 0, 1, 0, 0, 0, 1, 8, 0, 1, 0, 1, 1,
+    2, 2, 42, 0, 1, 4, 1, 1, 1, 2, 3, 4, 2, 2, 3, 2,
+    1, 0, 1, 0, 0, 1, 2, 3, 0, 1, 2, 0, 0, 1, 0, 1,
+    2, 0, 28, 28, 0, 16, 0, 2, 3, 20, 0, 1, 2, 3,
+};
+
+static const ubx_msgdb_rule_t ubx_msgdb_rules[] = {
+    { 0x0101, 0, 225, 1 },
+    { 0x0102, 1, 226, 1 },
+    { 0x0103, 2, 238, 1 },
+    { 0x0104, 3, 209, 1 },
+    { 0x0105, 4, 202, 1 },
+    { 0x0105, 5, 203, 1 },
+    { 0x0106, 6, 237, 1 },
+    { 0x0107, 7, 229, 1 },
+    { 0x0107, 8, 230, 1 },
+    { 0x0109, 9, 222, 1 },
+    { 0x0109, 10, 223, 1 },
+    { 0x0110, 11, 234, 1 },
+    { 0x0111, 12, 254, 1 },
+    { 0x0112, 13, 255, 1 },
+    { 0x0113, 14, 215, 1 },
+    { 0x0114, 15, 216, 1 },
+    { 0x0117, 16, 227, 1 },
+    { 0x0117, 17, 228, 1 },
+    { 0x0120, 18, 246, 1 },
+    { 0x0121, 19, 253, 1 },
+    { 0x0122, 20, 206, 1 },
+    { 0x0123, 21, 244, 1 },
+    { 0x0123, 22, 245, 1 },
+    { 0x0124, 23, 241, 1 },
+    { 0x0125, 24, 242, 1 },
+    { 0x0125, 25, 243, 1 },
+    { 0x0126, 26, 247, 1 },
+    { 0x0127, 27, 250, 1 },
+    { 0x0127, 28, 251, 1 },
+    { 0x0128, 29, 220, 1 },
+    { 0x0128, 30, 221, 1 },
+    { 0x0130, 31, 241, 0 },
+    { 0x0131, 32, 209, 0 },
+    { 0x0132, 33, 235, 0 },
+    { 0x0134, 34, 224, 0 },
+    { 0x0135, 35, 235, 0 },
+    { 0x0136, 36, 207, 1 },
+    { 0x0136, 37, 208, 1 },
+    { 0x0139, 38, 214, 1 },
+    { 0x013A, 39, 209, 0 },
+    { 0x013B, 40, 239, 1 },
+    { 0x013B, 41, 240, 1 },
+    { 0x013C, 42, 231, 1 },
+    { 0x013C, 43, 232, 1 },
+    { 0x013C, 44, 233, 1 },
+    { 0x013D, 45, 210, 1 },
+    { 0x013D, 46, 211, 1 },
+    { 0x0140, 47, 212, 1 },
+    { 0x0142, 48, 236, 1 },
+    { 0x0143, 49, 235, 1 },
+    { 0x0150, 50, 217, 1 },
+    { 0x0150, 51, 218, 1 },
+    { 0x0150, 52, 219, 1 },
+    { 0x0160, 53, 200, 1 },
+    { 0x0160, 54, 201, 1 },
+    { 0x0161, 55, 213, 1 },
+    { 0x0162, 56, 224, 1 },
+    { 0x0163, 57, 248, 1 },
+    { 0x0163, 58, 249, 1 },
+    { 0x0164, 59, 252, 1 },
+    { 0x0165, 60, 204, 1 },
+    { 0x0165, 61, 205, 1 },
+    { 0x0210, 62, 311, 0 },
+    { 0x0211, 63, 316, 1 },
+    { 0x0213, 64, 317, 1 },
+    { 0x0213, 66, 318, 3 },
+    { 0x0213, 66, 321, 2 },
+    { 0x0213, 67, 323, 3 },
+    { 0x0213, 67, 326, 2 },
+    { 0x0214, 68, 302, 1 },
+    { 0x0214, 69, 303, 1 },
+    { 0x0215, 70, 311, 1 },
+    { 0x0215, 71, 312, 1 },
+    { 0x0216, 72, 304, 1 },
+    { 0x0216, 73, 305, 0 },
+    { 0x0220, 74, 331, 0 },
+    { 0x0230, 75, 289, 1 },
+    { 0x0230, 76, 290, 1 },
+    { 0x0230, 77, 291, 1 },
+    { 0x0231, 78, 293, 1 },
+    { 0x0231, 79, 294, 1 },
+    { 0x0231, 80, 295, 1 },
+    { 0x0232, 81, 315, 1 },
+    { 0x0233, 82, 328, 1 },
+    { 0x0234, 83, 292, 1 },
+    { 0x0236, 85, 329, 1 },
+    { 0x0236, 84, 330, 1 },
+    { 0x0241, 86, 308, 1 },
+    { 0x0241, 87, 309, 1 },
+    { 0x0259, 88, 313, 1 },
+    { 0x0259, 89, 314, 1 },
+    { 0x0261, 90, 296, 1 },
+    { 0x0261, 91, 297, 1 },
+    { 0x0272, 92, 305, 1 },
+    { 0x0272, 93, 306, 1 },
+    { 0x0272, 94, 307, 1 },
+    { 0x0273, 96, 310, 1 },
+    { 0x0274, 98, 331, 1 },
+    { 0x0274, 99, 332, 1 },
+    { 0x0280, 100, 301, 1 },
+    { 0x0282, 101, 300, 1 },
+    { 0x0284, 102, 298, 1 },
+    { 0x0286, 103, 299, 1 },
+    { 0x0400, 104, 154, 0 },
+    { 0x0401, 105, 154, 0 },
+    { 0x0402, 106, 154, 0 },
+    { 0x0403, 107, 154, 0 },
+    { 0x0404, 108, 154, 0 },
+    { 0x0500, 109, 1, 1 },
+    { 0x0501, 110, 0, 1 },
+    { 0x0600, 111, 95, 1 },
+    { 0x0600, 112, 96, 1 },
+    { 0x0600, 113, 97, 2 },
+    { 0x0600, 114, 99, 2 },
+    { 0x0600, 115, 101, 2 },
+    { 0x0600, 116, 103, 2 },
+    { 0x0601, 117, 69, 1 },
+    { 0x0601, 119, 70, 1 },
+    { 0x0601, 118, 71, 1 },
+    { 0x0602, 120, 64, 1 },
+    { 0x0602, 121, 65, 0 },
+    { 0x0604, 125, 109, 1 },
+    { 0x0606, 126, 34, 1 },
+    { 0x0606, 127, 35, 1 },
+    { 0x0606, 128, 36, 1 },
+    { 0x0606, 129, 37, 1 },
+    { 0x0607, 130, 126, 1 },
+    { 0x0607, 131, 127, 1 },
+    { 0x0608, 132, 106, 1 },
+    { 0x0608, 133, 107, 1 },
+    { 0x0609, 134, 33, 1 },
+    { 0x060E, 136, 55, 1 },
+    { 0x060E, 137, 56, 1 },
+    { 0x0611, 138, 110, 1 },
+    { 0x0611, 140, 111, 1 },
+    { 0x0612, 141, 41, 1 },
+    { 0x0612, 143, 42, 1 },
+    { 0x0613, 144, 29, 1 },
+    { 0x0613, 145, 30, 1 },
+    { 0x0616, 147, 112, 1 },
+    { 0x0616, 148, 113, 1 },
+    { 0x0617, 149, 79, 1 },
+    { 0x0617, 150, 80, 1 },
+    { 0x0617, 151, 81, 1 },
+    { 0x0617, 152, 82, 1 },
+    { 0x061B, 153, 132, 1 },
+    { 0x061B, 154, 133, 1 },
+    { 0x061D, 155, 120, 1 },
+    { 0x061D, 156, 121, 1 },
+    { 0x061E, 157, 83, 1 },
+    { 0x061E, 158, 84, 1 },
+    { 0x0623, 159, 74, 1 },
+    { 0x0623, 160, 75, 1 },
+    { 0x0623, 161, 76, 1 },
+    { 0x0623, 162, 77, 1 },
+    { 0x0623, 163, 78, 1 },
+    { 0x0624, 164, 72, 1 },
+    { 0x0624, 165, 73, 1 },
+    { 0x062F, 167, 49, 1 },
+    { 0x062F, 168, 50, 1 },
+    { 0x0631, 169, 128, 1 },
+    { 0x0631, 170, 129, 1 },
+    { 0x0631, 172, 130, 1 },
+    { 0x0631, 171, 131, 0 },
+    { 0x0632, 173, 85, 1 },
+    { 0x0632, 174, 86, 2 },
+    { 0x0634, 175, 108, 1 },
+    { 0x0634, 176, 109, 0 },
+    { 0x0639, 177, 65, 1 },
+    { 0x0639, 178, 66, 1 },
+    { 0x063B, 179, 88, 1 },
+    { 0x063B, 180, 89, 1 },
+    { 0x063B, 181, 90, 2 },
+    { 0x063B, 182, 92, 1 },
+    { 0x063D, 183, 122, 1 },
+    { 0x063D, 184, 123, 1 },
+    { 0x063E, 185, 59, 1 },
+    { 0x063E, 186, 60, 1 },
+    { 0x063F, 187, 63, 1 },
+    { 0x0647, 190, 67, 1 },
+    { 0x0647, 191, 68, 1 },
+    { 0x064C, 192, 43, 1 },
+    { 0x064C, 193, 44, 1 },
+    { 0x064D, 194, 47, 1 },
+    { 0x064D, 195, 48, 1 },
+    { 0x0653, 196, 131, 1 },
+    { 0x0653, 197, 132, 0 },
+    { 0x0656, 198, 45, 1 },
+    { 0x0656, 199, 46, 1 },
+    { 0x0657, 200, 105, 1 },
+    { 0x065C, 201, 61, 1 },
+    { 0x065C, 202, 62, 1 },
+    { 0x0660, 203, 53, 1 },
+    { 0x0660, 204, 54, 1 },
+    { 0x0661, 205, 40, 1 },
+    { 0x0661, 206, 41, 0 },
+    { 0x0662, 207, 118, 1 },
+    { 0x0662, 208, 119, 0 },
+    { 0x0664, 209, 119, 1 },
+    { 0x0664, 210, 120, 0 },
+    { 0x0669, 211, 57, 1 },
+    { 0x0669, 212, 58, 1 },
+    { 0x0670, 213, 38, 1 },
+    { 0x0670, 214, 39, 1 },
+    { 0x0671, 215, 124, 1 },
+    { 0x0671, 216, 125, 1 },
+    { 0x0682, 217, 51, 1 },
+    { 0x0682, 218, 52, 1 },
+    { 0x0686, 219, 93, 1 },
+    { 0x0686, 220, 94, 1 },
+    { 0x0688, 221, 114, 1 },
+    { 0x0688, 222, 115, 1 },
+    { 0x068A, 223, 138, 1 },
+    { 0x068A, 224, 139, 1 },
+    { 0x068B, 225, 136, 1 },
+    { 0x068B, 226, 137, 1 },
+    { 0x068C, 227, 134, 1 },
+    { 0x068C, 228, 135, 1 },
+    { 0x068D, 229, 116, 1 },
+    { 0x068D, 230, 117, 1 },
+    { 0x0693, 231, 31, 1 },
+    { 0x0693, 232, 32, 1 },
+    { 0x0914, 234, 354, 1 },
+    { 0x0914, 235, 355, 1 },
+    { 0x0914, 236, 356, 1 },
+    { 0x0914, 237, 357, 1 },
+    { 0x0A02, 238, 181, 0 },
+    { 0x0A04, 239, 199, 1 },
+    { 0x0A04, 240, 200, 0 },
+    { 0x0A06, 241, 181, 1 },
+    { 0x0A07, 242, 191, 1 },
+    { 0x0A08, 243, 198, 1 },
+    { 0x0A09, 246, 174, 1 },
+    { 0x0A09, 247, 175, 1 },
+    { 0x0A09, 248, 176, 1 },
+    { 0x0A09, 249, 177, 1 },
+    { 0x0A0B, 250, 178, 1 },
+    { 0x0A21, 251, 192, 1 },
+    { 0x0A27, 252, 182, 1 },
+    { 0x0A27, 253, 183, 0 },
+    { 0x0A28, 254, 171, 1 },
+    { 0x0A28, 255, 172, 1 },
+    { 0x0A28, 256, 173, 1 },
+    { 0x0A2E, 257, 193, 1 },
+    { 0x0A2E, 258, 194, 0 },
+    { 0x0A2F, 259, 195, 1 },
+    { 0x0A31, 260, 194, 1 },
+    { 0x0A31, 261, 195, 0 },
+    { 0x0A32, 262, 168, 1 },
+    { 0x0A32, 263, 169, 1 },
+    { 0x0A35, 264, 183, 1 },
+    { 0x0A35, 265, 184, 1 },
+    { 0x0A36, 266, 170, 1 },
+    { 0x0A36, 267, 171, 0 },
+    { 0x0A37, 268, 179, 1 },
+    { 0x0A37, 269, 180, 0 },
+    { 0x0A38, 270, 188, 1 },
+    { 0x0A38, 271, 189, 1 },
+    { 0x0A38, 272, 190, 1 },
+    { 0x0A39, 273, 196, 1 },
+    { 0x0A39, 274, 197, 1 },
+    { 0x0A3B, 275, 185, 1 },
+    { 0x0A3B, 276, 186, 0 },
+    { 0x0A3D, 277, 180, 1 },
+    { 0x0A40, 278, 186, 1 },
+    { 0x0A40, 279, 187, 1 },
+    { 0x0B00, 280, 28, 1 },
+    { 0x0B01, 281, 26, 1 },
+    { 0x0B01, 283, 27, 1 },
+    { 0x0B02, 285, 24, 1 },
+    { 0x0B02, 286, 25, 1 },
+    { 0x0B10, 287, 19, 1 },
+    { 0x0B30, 288, 2, 1 },
+    { 0x0B30, 289, 3, 1 },
+    { 0x0B30, 290, 4, 1 },
+    { 0x0B30, 290, 5, 1 },
+    { 0x0B31, 291, 20, 1 },
+    { 0x0B31, 292, 21, 1 },
+    { 0x0B31, 293, 22, 1 },
+    { 0x0B31, 293, 23, 1 },
+    { 0x0B32, 294, 12, 1 },
+    { 0x0B32, 296, 13, 1 },
+    { 0x0B32, 295, 14, 0 },
+    { 0x0B33, 297, 14, 1 },
+    { 0x0B33, 298, 15, 1 },
+    { 0x0B33, 299, 16, 1 },
+    { 0x0B33, 300, 17, 1 },
+    { 0x0B33, 301, 18, 1 },
+    { 0x0B50, 305, 6, 2 },
+    { 0x0B50, 304, 8, 2 },
+    { 0x0B50, 303, 10, 1 },
+    { 0x0B50, 307, 11, 1 },
+    { 0x0B50, 302, 12, 0 },
+    { 0x0D01, 308, 349, 1 },
+    { 0x0D03, 309, 347, 1 },
+    { 0x0D04, 310, 346, 1 },
+    { 0x0D06, 311, 353, 1 },
+    { 0x0D11, 312, 345, 1 },
+    { 0x0D12, 313, 348, 1 },
+    { 0x0D13, 314, 346, 0 },
+    { 0x0D15, 315, 350, 1 },
+    { 0x0D15, 316, 351, 1 },
+    { 0x0D15, 317, 352, 1 },
+    { 0x0D16, 318, 346, 0 },
+    { 0x0D17, 319, 346, 0 },
+    { 0x1002, 320, 145, 0 },
+    { 0x1003, 322, 145, 0 },
+    { 0x1004, 323, 142, 1 },
+    { 0x1004, 324, 143, 1 },
+    { 0x1010, 325, 146, 1 },
+    { 0x1010, 326, 147, 1 },
+    { 0x1010, 327, 148, 1 },
+    { 0x1013, 328, 145, 1 },
+    { 0x1014, 329, 140, 1 },
+    { 0x1014, 330, 141, 1 },
+    { 0x1015, 332, 144, 1 },
+    { 0x1320, 358, 165, 2 },
+    { 0x1380, 371, 167, 1 },
+    { 0x1380, 372, 168, 0 },
+    { 0x2103, 373, 156, 0 },
+    { 0x2104, 374, 165, 0 },
+    { 0x2107, 375, 155, 1 },
+    { 0x2108, 376, 158, 1 },
+    { 0x2108, 377, 159, 1 },
+    { 0x2109, 378, 160, 1 },
+    { 0x210B, 379, 162, 1 },
+    { 0x210D, 380, 164, 1 },
+    { 0x210E, 381, 156, 1 },
+    { 0x210E, 382, 157, 1 },
+    { 0x210F, 383, 163, 1 },
+    { 0x2110, 384, 161, 1 },
+    { 0x2111, 385, 154, 1 },
+    { 0x2703, 386, 342, 1 },
+    { 0x2703, 387, 343, 1 },
+    { 0x2703, 388, 344, 1 },
+    { 0x2709, 389, 336, 1 },
+    { 0x2709, 390, 337, 1 },
+    { 0x2709, 391, 338, 1 },
+    { 0x270A, 392, 333, 1 },
+    { 0x270A, 393, 334, 1 },
+    { 0x270A, 394, 335, 1 },
+    { 0x2710, 395, 339, 1 },
+    { 0x2710, 396, 340, 1 },
+    { 0x2710, 397, 341, 1 },
+    { 0x2800, 398, 152, 1 },
+    { 0x2800, 399, 153, 1 },
+    { 0x2801, 400, 149, 1 },
+    { 0x2802, 401, 150, 1 },
+    { 0x2802, 402, 151, 1 },
+    { 0x2901, 403, 265, 1 },
+    { 0x2902, 404, 266, 1 },
+    { 0x2903, 405, 271, 1 },
+    { 0x2904, 406, 259, 1 },
+    { 0x2907, 407, 268, 1 },
+    { 0x2909, 408, 263, 1 },
+    { 0x2909, 409, 264, 1 },
+    { 0x2911, 410, 287, 1 },
+    { 0x2912, 411, 288, 1 },
+    { 0x2917, 412, 267, 1 },
+    { 0x2920, 413, 279, 1 },
+    { 0x2921, 414, 286, 1 },
+    { 0x2922, 415, 256, 1 },
+    { 0x2923, 416, 277, 1 },
+    { 0x2923, 417, 278, 1 },
+    { 0x2924, 418, 274, 1 },
+    { 0x2925, 419, 275, 1 },
+    { 0x2925, 420, 276, 1 },
+    { 0x2926, 421, 280, 1 },
+    { 0x2926, 422, 281, 1 },
+    { 0x2927, 423, 284, 1 },
+    { 0x2927, 424, 285, 1 },
+    { 0x2932, 425, 269, 0 },
+    { 0x2935, 426, 269, 0 },
+    { 0x2936, 427, 257, 1 },
+    { 0x2936, 428, 258, 1 },
+    { 0x293B, 429, 272, 1 },
+    { 0x293B, 430, 273, 1 },
+    { 0x293D, 431, 260, 1 },
+    { 0x293D, 432, 261, 1 },
+    { 0x2942, 433, 270, 1 },
+    { 0x2943, 434, 269, 1 },
+    { 0x2961, 435, 262, 1 },
+    { 0x2963, 436, 282, 1 },
+    { 0x2963, 437, 283, 1 },
+};
+
+#endif // UBX_MSGDB_TABLES_H
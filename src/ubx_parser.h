@@ -0,0 +1,331 @@
+#ifndef UBX_PARSER_H
+#define UBX_PARSER_H
+/*******************************************************************************
+ ubx_parser.h
+
+ Incremental parser for a receiver stream of UBX frames mixed with NMEA.
+
+ All state lives in ubx_parser_t, so any number of parsers can run side by
+ side.  ubx_parser_feed_buf() consumes a whole read() at a time: it jumps to
+ the next sync byte or '$' with memchr(), copies header and payload spans
+ into raw[] with memcpy() and runs the Fletcher checksum once over the
+ complete frame.
+
+ Two hooks may be defined before this header is included:
+   UBX_PARSER_ON_NMEA(p, line)  a complete NMEA line, CR/LF stripped
+   UBX_PARSER_ON_SKIP(p)        a valid frame the filter did not accept
+
+ Example:
+   ubx_parser_t parser;
+   ubx_parser_init(&parser);
+   size_t off = 0, used;
+   while (off < n) {
+       ubx_parse_result_t res = ubx_parser_feed_buf(&parser, &buf[off], n - off, &used);
+       off += used;
+       if (res == UBX_PARSE_OK)
+           handle(parser.cls, parser.id, parser.payload, parser.payload_len);
+   }
+
+ Copyright (C) 2025 Richard Elwell
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*******************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include "ubx_message.h"
+
+#ifndef UBX_PARSER_ON_NMEA
+#define UBX_PARSER_ON_NMEA(p, line) ((void)0)
+#endif
+#ifndef UBX_PARSER_ON_SKIP
+#define UBX_PARSER_ON_SKIP(p) ((void)0)
+#endif
+
+#define UBX_PARSER_NMEA_MAX 128     // longer lines are truncated
+
+typedef enum {
+    UBX_FILTER_NONE = 0,
+    UBX_FILTER_CLS_ID,              // match cls, id
+    UBX_FILTER_ACK,                 // match cls, id and payload bytes
+    UBX_FILTER_RESPONSE_OR_ACK      // match cls, id or an ACK/NAK for them
+} ubx_filter_t;
+
+typedef enum {
+    UBX_STATE_SYNC1 = 0,            // looking for 0xB5 or '$'
+    UBX_STATE_SYNC2,                // 0xB5 seen, expecting 0x62
+    UBX_STATE_HEADER,               // class, ID and length
+    UBX_STATE_BODY,                 // payload and checksum
+    UBX_STATE_NMEA                  // inside an NMEA line
+} ubx_state_t;
+
+typedef struct {
+    uint8_t raw[UBX_MAX_MSG_SIZE];  // full message (0xB5..checksum)
+    size_t  length;                 // number of bytes currently in raw[]
+    uint8_t *payload;               // pointer to raw[6], the payload
+    size_t  payload_len;            // extracted payload length (L field)
+    size_t  state;                  // current parser state
+    uint8_t cls, id;                // class and ID
+    uint8_t ck_a, ck_b;             // checksum of the last complete frame
+    ubx_filter_t filter_type;       // what filter to apply
+    uint8_t filter_cls;             // CLS we are waiting for
+    uint8_t filter_id;              // ID we are waiting for
+    uint8_t *filter_payload;        // Payload we are waiting for
+    size_t filter_payload_len;      // Payload length we are waiting for
+    bool filter_active;             // flag: true = filter active
+    char    nmea[UBX_PARSER_NMEA_MAX];  // NMEA line being skipped
+    size_t  nmea_len;
+} ubx_parser_t;
+
+typedef enum ubx_parse_result {
+    UBX_PARSE_INCOMPLETE = 0,  // still accumulating bytes
+    UBX_PARSE_OK,              // message complete and checksum OK
+    UBX_PARSE_CKSUM_ERR,       // checksum failed
+    UBX_PARSE_SYNC_ERR,        // lost sync or invalid structure
+    UBX_PARSE_FILTER_ERR,      // bad filter type
+    UBX_PARSE_TIMEOUT,         // timeout while parsing data
+    UBX_SELECT_TIMEOUT,        // timeout while reading data
+    UBX_SELECT_ERROR,
+    UBX_READ_ERROR,
+    UBX_WRITE_ERROR,
+    UBX_RECEIVED_NAK,
+    UBX_ARG_ERROR,
+    UBX_STOP,
+    UBX_UNEXPECTED
+} ubx_parse_result_t;
+
+static inline const char *result_text(ubx_parse_result_t res)
+{
+    switch(res) {
+    case UBX_PARSE_INCOMPLETE:  return "Parse incomplete";
+    case UBX_PARSE_OK:          return "Success";
+    case UBX_PARSE_CKSUM_ERR:   return "Parse checksum error";
+    case UBX_PARSE_SYNC_ERR:    return "Parse sync error";
+    case UBX_PARSE_FILTER_ERR:  return "Unknown filter type";
+    case UBX_PARSE_TIMEOUT:     return "Timeout waiting for ACK or response";
+    case UBX_SELECT_TIMEOUT:    return "Timeout waiting for select()";
+    case UBX_SELECT_ERROR:      return "Error returned by select()";
+    case UBX_READ_ERROR:        return "Error returned by read()";
+    case UBX_WRITE_ERROR:       return "Error returned by write()";
+    case UBX_RECEIVED_NAK:      return "Device rejected the message";
+    case UBX_ARG_ERROR:         return "Bad argument passed to function";
+    case UBX_STOP:              return "Stop signal received";
+    case UBX_UNEXPECTED:        return "Unexpected error occurred";
+    default: {
+        static _Thread_local char buf[64];
+        snprintf(buf, sizeof(buf), "Unknown result code (%d)", res);
+        return buf;
+    }}
+}
+
+static void ubx_parser_init(ubx_parser_t *p)
+{
+    p->length = 0;
+    p->payload = &p->raw[6];
+    p->payload_len = 0;
+    p->state = UBX_STATE_SYNC1;
+    p->cls = 0;
+    p->id = 0;
+    p->ck_a = 0;
+    p->ck_b = 0;
+    p->filter_type = UBX_FILTER_NONE;
+    p->filter_cls = 0;
+    p->filter_id = 0;
+    p->filter_payload = NULL;
+    p->filter_payload_len = 0;
+    p->filter_active = false;
+    p->nmea_len = 0;
+}
+
+// 8-bit Fletcher checksum over class, ID, length and payload
+static inline void ubx_checksum(const uint8_t *data, size_t len, uint8_t *ck_a, uint8_t *ck_b)
+{
+    uint32_t a = 0, b = 0;
+    for (size_t i = 0; i < len; i++) {
+        a += data[i];
+        b += a;
+    }
+    *ck_a = (uint8_t)a;
+    *ck_b = (uint8_t)b;
+}
+
+// True if the complete frame in p->raw[] passes the filter
+static bool ubx_parser_accept(ubx_parser_t *p, ubx_parse_result_t *err)
+{
+    if (!p->filter_active)
+        return true;
+
+    bool ack = p->cls == UBX_CLS_ACK && (p->id == UBX_ID_ACK_ACK || p->id == UBX_ID_ACK_NAK);
+    switch (p->filter_type) {
+    case UBX_FILTER_CLS_ID:
+        if (p->cls != p->filter_cls || p->id != p->filter_id)
+            return false;
+        break;
+    case UBX_FILTER_ACK:
+        if (!ack || p->payload_len != p->filter_payload_len || p->payload_len < 2 ||
+            p->payload[0] != p->filter_payload[0] || p->payload[1] != p->filter_payload[1])
+            return false;
+        break;
+    case UBX_FILTER_RESPONSE_OR_ACK:
+        if (p->cls == p->filter_cls && p->id == p->filter_id)
+            break;  // poll response
+        if (!ack || p->payload_len != 2 ||
+            p->payload[0] != p->filter_cls || p->payload[1] != p->filter_id)
+            return false;
+        break;
+    default:
+        *err = UBX_PARSE_FILTER_ERR;
+        return true;
+    }
+    p->filter_active = false; // filter satisfied
+    return true;
+}
+
+/*
+ * ubx_parser_feed_buf()
+ * ---------------------
+ * Consumes bytes from 'data' until a frame completes or an error is found,
+ * or all 'len' bytes are used.  *used receives the number consumed; the rest
+ * belongs to the next call.  Returns UBX_PARSE_OK with the frame in p->raw[],
+ * UBX_PARSE_INCOMPLETE if more input is needed, or an error.  Frames the
+ * filter rejects are passed over without returning.
+ */
+static ubx_parse_result_t ubx_parser_feed_buf(ubx_parser_t *p, const uint8_t *data, size_t len,
+                                              size_t *used)
+{
+    const uint8_t *d = data, *end = data + len;
+
+    while (d < end) {
+        switch (p->state) {
+        case UBX_STATE_SYNC1: {
+            // next 0xB5, or an NMEA '$' before it
+            const uint8_t *sync = memchr(d, UBX_SYNC1, end - d);
+            const uint8_t *dollar = memchr(d, '$', (sync ? sync : end) - d);
+            if (dollar) {
+                p->nmea[0] = '$';
+                p->nmea_len = 1;
+                p->state = UBX_STATE_NMEA;
+                d = dollar + 1;
+            } else if (sync) {
+                p->raw[0] = UBX_SYNC1;
+                p->length = 1;
+                p->state = UBX_STATE_SYNC2;
+                d = sync + 1;
+            } else {
+                d = end;
+            }
+            break;
+        }
+
+        case UBX_STATE_NMEA: {
+            const uint8_t *nl = memchr(d, '\n', end - d);
+            const uint8_t *stop = nl ? nl : end;
+            size_t n = stop - d;
+            if (n > UBX_PARSER_NMEA_MAX - 1 - p->nmea_len)
+                n = UBX_PARSER_NMEA_MAX - 1 - p->nmea_len;
+            memcpy(&p->nmea[p->nmea_len], d, n);
+            p->nmea_len += n;
+            d = stop;
+            if (nl) {
+                d++;
+                while (p->nmea_len > 0 && p->nmea[p->nmea_len - 1] == '\r')
+                    p->nmea_len--;
+                p->nmea[p->nmea_len] = '\0';
+                UBX_PARSER_ON_NMEA(p, p->nmea);
+                p->nmea_len = 0;
+                p->state = UBX_STATE_SYNC1;
+            }
+            break;
+        }
+
+        case UBX_STATE_SYNC2:
+            if (*d == UBX_SYNC2) {
+                p->raw[p->length++] = *d++;
+                p->state = UBX_STATE_HEADER;
+            } else {
+                p->state = UBX_STATE_SYNC1;     // look at this byte again
+                p->length = 0;
+            }
+            break;
+
+        case UBX_STATE_HEADER: {
+            size_t n = 6 - p->length;
+            if (n > (size_t)(end - d))
+                n = end - d;
+            memcpy(&p->raw[p->length], d, n);
+            p->length += n;
+            d += n;
+            if (p->length < 6)
+                break;
+
+            p->cls = p->raw[2];
+            p->id = p->raw[3];
+            p->payload_len = p->raw[4] | ((size_t)p->raw[5] << 8);
+            if (p->payload_len > UBX_MAX_PAYLOAD_SIZE) {
+                // sanity check (too large)
+                p->state = UBX_STATE_SYNC1;
+                p->length = 0;
+                *used = d - data;
+                return UBX_PARSE_SYNC_ERR;
+            }
+            p->state = UBX_STATE_BODY;
+            break;
+        }
+
+        case UBX_STATE_BODY: {
+            size_t total = UBX_MIN_MSG_SIZE + p->payload_len;
+            size_t n = total - p->length;
+            if (n > (size_t)(end - d))
+                n = end - d;
+            memcpy(&p->raw[p->length], d, n);
+            p->length += n;
+            d += n;
+            if (p->length < total)
+                break;
+
+            // message complete
+            p->state = UBX_STATE_SYNC1;
+            p->payload = &p->raw[6];
+            ubx_checksum(&p->raw[2], 4 + p->payload_len, &p->ck_a, &p->ck_b);
+            if (p->raw[total - 2] != p->ck_a || p->raw[total - 1] != p->ck_b) {
+                p->length = 0;
+                *used = d - data;
+                return UBX_PARSE_CKSUM_ERR;
+            }
+
+            ubx_parse_result_t err = UBX_PARSE_OK;
+            if (!ubx_parser_accept(p, &err)) {
+                UBX_PARSER_ON_SKIP(p);
+                break;
+            }
+            *used = d - data;
+            return err;
+        }
+
+        default:
+            p->state = UBX_STATE_SYNC1;
+            p->length = 0;
+            *used = d - data;
+            return UBX_PARSE_SYNC_ERR;
+        }
+    }
+
+    *used = len;
+    return UBX_PARSE_INCOMPLETE;
+}
+
+
+#endif // UBX_PARSER_H
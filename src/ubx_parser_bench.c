@@ -0,0 +1,287 @@
+/*******************************************************************************
+ ubx_parser_bench.c
+
+ Throughput of ubx_parser_feed_buf() on a synthetic receiver stream: NMEA
+ sentences, UBX frames of assorted sizes, line noise and the odd frame with
+ a bad checksum.  The same stream is run through the byte-at-a-time state
+ machine that ubx_parser_feed_buf() replaced, and both must agree on every
+ frame, checksum error and NMEA line.  A read size of 1 shows the cost of
+ feeding single bytes.
+
+ Build and run:
+   gcc -std=c11 -O2 -Wall src/ubx_parser_bench.c -o ubx_parser_bench
+   ./ubx_parser_bench [megabytes] [read size]
+
+ Copyright (C) 2025 Richard Elwell
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*******************************************************************************/
+#define _POSIX_C_SOURCE 200809L
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static unsigned long bench_nmea_lines;
+#define UBX_PARSER_ON_NMEA(p, line) (bench_nmea_lines++)
+#include "ubx_parser.h"
+
+typedef struct {
+    unsigned long frames, cksum_errs, sync_errs, nmea_lines;
+    uint32_t digest;            // over cls, id and length of every frame
+} bench_counts_t;
+
+static void count_result(bench_counts_t *c, ubx_parse_result_t res, const uint8_t *raw)
+{
+    if (res == UBX_PARSE_OK) {
+        c->frames++;
+        c->digest = c->digest * 31 + (raw[2] << 24 | raw[3] << 16 | raw[4] << 8 | raw[5]);
+    } else if (res == UBX_PARSE_CKSUM_ERR) {
+        c->cksum_errs++;
+    } else if (res == UBX_PARSE_SYNC_ERR) {
+        c->sync_errs++;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+// The previous parser: one switch dispatch and checksum update per byte
+typedef struct {
+    uint8_t raw[UBX_MAX_MSG_SIZE];
+    size_t  length, payload_len;
+    int     state;
+    uint8_t ck_a, ck_b;
+    char    nmea[UBX_PARSER_NMEA_MAX];
+    size_t  nmea_pos;
+    unsigned long nmea_lines;
+} ref_parser_t;
+
+enum { REF_SYNC1, REF_SYNC2, REF_CLASS, REF_ID, REF_LEN_LO, REF_LEN_HI, REF_PAYLOAD, REF_CK_A, REF_CK_B, REF_NMEA };
+
+static ubx_parse_result_t ref_feed(ref_parser_t *p, uint8_t byte)
+{
+    switch (p->state) {
+    case REF_SYNC1:
+        if (byte == UBX_SYNC1) {
+            p->raw[0] = byte;
+            p->length = 1;
+            p->state = REF_SYNC2;
+        } else if (byte == '$') {
+            p->nmea_pos = 0;
+            p->nmea[p->nmea_pos++] = byte;
+            p->state = REF_NMEA;
+        }
+        return UBX_PARSE_INCOMPLETE;
+    case REF_NMEA:
+        if (p->nmea_pos < sizeof(p->nmea) - 1)
+            p->nmea[p->nmea_pos++] = byte;
+        if (byte == '\n') {
+            p->nmea[p->nmea_pos] = '\0';
+            p->nmea_lines++;
+            p->state = REF_SYNC1;
+        }
+        return UBX_PARSE_INCOMPLETE;
+    case REF_SYNC2:
+        if (byte == UBX_SYNC2) {
+            p->raw[p->length++] = byte;
+            p->state = REF_CLASS;
+            p->ck_a = p->ck_b = 0;
+        } else {
+            p->state = REF_SYNC1;
+        }
+        return UBX_PARSE_INCOMPLETE;
+    case REF_CLASS:
+    case REF_ID:
+    case REF_LEN_LO:
+        p->raw[p->length++] = byte;
+        p->ck_a += byte;
+        p->ck_b += p->ck_a;
+        p->state++;
+        return UBX_PARSE_INCOMPLETE;
+    case REF_LEN_HI:
+        p->raw[p->length++] = byte;
+        p->ck_a += byte;
+        p->ck_b += p->ck_a;
+        p->payload_len = p->raw[4] | ((size_t)byte << 8);
+        if (p->payload_len > UBX_MAX_PAYLOAD_SIZE) {
+            p->state = REF_SYNC1;
+            return UBX_PARSE_SYNC_ERR;
+        }
+        p->state = p->payload_len ? REF_PAYLOAD : REF_CK_A;
+        return UBX_PARSE_INCOMPLETE;
+    case REF_PAYLOAD:
+        p->raw[p->length++] = byte;
+        p->ck_a += byte;
+        p->ck_b += p->ck_a;
+        if (p->length == 6 + p->payload_len)
+            p->state = REF_CK_A;
+        return UBX_PARSE_INCOMPLETE;
+    case REF_CK_A:
+        p->raw[p->length++] = byte;
+        p->state = REF_CK_B;
+        return UBX_PARSE_INCOMPLETE;
+    default:
+        p->raw[p->length++] = byte;
+        p->state = REF_SYNC1;
+        return (p->raw[p->length - 2] == p->ck_a && byte == p->ck_b) ? UBX_PARSE_OK : UBX_PARSE_CKSUM_ERR;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+static uint32_t rng_state = 0x12345678;
+
+static uint32_t rng(void)
+{
+    // xorshift32: deterministic, so every run measures the same stream
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static size_t gen_nmea(uint8_t *out)
+{
+    static const char *const body[] = {
+        "GPRMC,123519.00,A,4807.03812,N,01131.00012,E,0.022,,230394,,,A",
+        "GPGGA,123519.00,4807.03812,N,01131.00012,E,1,08,0.9,545.4,M,46.9,M,,",
+        "GPZDA,123519.00,23,03,1994,00,00",
+        "GPGSV,3,1,11,03,03,111,00,04,15,270,00,06,01,010,00,13,06,292,00",
+        "GPGLL,4807.03812,N,01131.00012,E,123519.00,A,A",
+    };
+    const char *s = body[rng() % (sizeof(body) / sizeof(body[0]))];
+    uint8_t cs = 0;
+    for (const char *c = s; *c; c++)
+        cs ^= (uint8_t)*c;
+    return (size_t)sprintf((char *)out, "$%s*%02X\r\n", s, cs);
+}
+
+static size_t gen_ubx(uint8_t *out, bool corrupt)
+{
+    static const uint16_t sizes[] = { 0, 2, 8, 20, 28, 40, 92, 100, 164, 400 };
+    uint16_t len = sizes[rng() % (sizeof(sizes) / sizeof(sizes[0]))];
+    out[0] = UBX_SYNC1;
+    out[1] = UBX_SYNC2;
+    out[2] = (uint8_t)(rng() % 0x30);
+    out[3] = (uint8_t)rng();
+    out[4] = len & 0xFF;
+    out[5] = len >> 8;
+    for (uint16_t i = 0; i < len; i++)
+        out[6 + i] = (uint8_t)rng();
+    ubx_checksum(&out[2], 4 + len, &out[6 + len], &out[7 + len]);
+    if (corrupt)
+        out[7 + len] ^= 0x5A;   // CK_B only, so both parsers consume the whole frame
+    return UBX_MIN_MSG_SIZE + len;
+}
+
+// Line noise that cannot start a frame or a sentence
+static size_t gen_noise(uint8_t *out)
+{
+    size_t n = 1 + rng() % 16;
+    for (size_t i = 0; i < n; i++) {
+        uint8_t b;
+        do b = (uint8_t)rng(); while (b == UBX_SYNC1 || b == '$' || b == '\n');
+        out[i] = b;
+    }
+    return n;
+}
+
+static double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char *argv[])
+{
+    size_t mb = (argc > 1) ? strtoul(argv[1], NULL, 10) : 64;
+    size_t chunk = (argc > 2) ? strtoul(argv[2], NULL, 10) : 1024;
+    if (mb == 0 || chunk == 0) {
+        fprintf(stderr, "Usage: %s [megabytes] [read size]\n", argv[0]);
+        return 1;
+    }
+
+    size_t size = mb << 20;
+    uint8_t *stream = malloc(size + UBX_MAX_MSG_SIZE);
+    if (!stream) {
+        perror("malloc");
+        return 1;
+    }
+    size_t len = 0;
+    while (len < size) {
+        uint32_t kind = rng() % 100;
+        if (kind < 55)
+            len += gen_nmea(&stream[len]);
+        else if (kind < 95)
+            len += gen_ubx(&stream[len], false);
+        else if (kind < 97)
+            len += gen_ubx(&stream[len], true);
+        else
+            len += gen_noise(&stream[len]);
+    }
+
+    // reference, one byte at a time
+    bench_counts_t ref = {0};
+    ref_parser_t rp = {0};
+    double t0 = now_sec();
+    for (size_t i = 0; i < len; i++)
+        count_result(&ref, ref_feed(&rp, stream[i]), rp.raw);
+    double t_ref = now_sec() - t0;
+    ref.nmea_lines = rp.nmea_lines;
+
+    ubx_parser_t *p = malloc(sizeof(*p));
+    if (!p) {
+        perror("malloc");
+        return 1;
+    }
+
+    // ubx_parser_feed_buf(), 'chunk' bytes per read()
+    bench_counts_t buf = {0};
+    ubx_parser_init(p);
+    bench_nmea_lines = 0;
+    t0 = now_sec();
+    for (size_t off = 0; off < len; off += chunk) {
+        size_t n = (len - off < chunk) ? len - off : chunk;
+        size_t pos = 0;
+        while (pos < n) {
+            size_t used;
+            ubx_parse_result_t res = ubx_parser_feed_buf(p, &stream[off + pos], n - pos, &used);
+            pos += used;
+            count_result(&buf, res, p->raw);
+        }
+    }
+    double t_buf = now_sec() - t0;
+    buf.nmea_lines = bench_nmea_lines;
+
+    printf("stream: %.1f MB, %lu UBX frames, %lu bad checksums, %lu NMEA lines\n",
+           len / 1048576.0, ref.frames, ref.cksum_errs, ref.nmea_lines);
+    printf("%-34s %8.1f MB/s\n", "previous parser (per byte)", len / 1048576.0 / t_ref);
+    printf("ubx_parser_feed_buf (%5zu B reads) %8.1f MB/s  (%.1fx)\n", chunk,
+           len / 1048576.0 / t_buf, t_ref / t_buf);
+
+    int rc = 0;
+    if (memcmp(&buf, &ref, sizeof(ref)) != 0) {
+        fprintf(stderr, "MISMATCH: frames %lu/%lu cksum %lu/%lu sync %lu/%lu nmea %lu/%lu\n",
+                buf.frames, ref.frames, buf.cksum_errs, ref.cksum_errs,
+                buf.sync_errs, ref.sync_errs, buf.nmea_lines, ref.nmea_lines);
+        rc = 1;
+    }
+
+    free(p);
+    free(stream);
+    return rc;
+}
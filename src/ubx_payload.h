@@ -23,6 +23,15 @@
 
 #pragma pack(push, 1)
 
+// Each payload struct is checked against the size the u-blox protocol
+// specification gives (the fixed part, for repeated blocks), so a field
+// added, dropped or given the wrong type fails the build.  The structs are
+// overlaid on wire data, which is little-endian.
+#define UBX_PAYLOAD_SIZE(type, size) \
+    _Static_assert(sizeof(type) == (size), #type " is not " #size " bytes as in the u-blox specification")
+
+_Static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "UBX payload structs need a little-endian host");
+
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -31,6 +40,7 @@ typedef struct __attribute__((packed)) {
     uint8_t clsID;   // 0: Class ID of acknowledged message
     uint8_t msgID;   // 1: Message ID of acknowledged message
 } ubx_ack_ack_t;
+UBX_PAYLOAD_SIZE(ubx_ack_ack_t, 2);
 
 
 
@@ -41,6 +51,7 @@ typedef struct __attribute__((packed)) {
     uint8_t clsID;   // 0: Class ID of rejected message
     uint8_t msgID;   // 1: Message ID of rejected message
 } ubx_ack_nak_t;
+UBX_PAYLOAD_SIZE(ubx_ack_nak_t, 2);
 
 
 
@@ -85,6 +96,7 @@ typedef struct __attribute__((packed)) {
         };
     };
 } ubx_cfg_cfg_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_cfg_t, 13);
 
 typedef union {
     ubx_cfg_cfg_t fields;
@@ -135,6 +147,7 @@ typedef struct __attribute__((packed)) {
         };
     };
 } ubx_cfg_cfg_u5_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_cfg_u5_t, 13);
 
 // Optional union for raw access
 typedef union {
@@ -162,6 +175,7 @@ typedef struct __attribute__((packed)) {
         uint32_t flags;
     };
 } ubx_cfg_gnss_block_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_gnss_block_t, 8);
 
 typedef struct __attribute__((packed)) {
     uint8_t  msgVer;          // Message version (always 0x00 or 0x01)
@@ -170,6 +184,7 @@ typedef struct __attribute__((packed)) {
     uint8_t  numConfigBlocks; // Number of GNSS configuration blocks
     ubx_cfg_gnss_block_t blocks[]; // repeated blocks
 } ubx_cfg_gnss_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_gnss_t, 4);
 
 typedef union {
     ubx_cfg_gnss_t fields;
@@ -198,11 +213,13 @@ typedef struct __attribute__((packed)) {
         uint8_t mask;              // raw bitmask
     } infMsgMask[6];
 } ubx_cfg_inf_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_inf_t, 10);
 
 // UBX-CFG-INF payload (1 byte)
 typedef struct __attribute__((packed)) {
     uint8_t protocolID;            // Protocol identifier to poll
 } ubx_cfg_inf_pollid_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_inf_pollid_t, 1);
 
 // Union form for direct payload access (raw or parsed)
 typedef union {
@@ -222,6 +239,7 @@ typedef struct __attribute__((packed)) {
     uint8_t msgClass;  // Message class to poll
     uint8_t msgID;     // Message ID to poll
 } ubx_cfg_msg_pollid_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_msg_pollid_t, 2);
 
 
 //
@@ -234,6 +252,7 @@ typedef struct __attribute__((packed)) {
     uint8_t msgID;     // Message ID
     uint8_t rate;      // Rate on current target (messages per navigation solution)
 } ubx_cfg_msg_setcurrent_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_msg_setcurrent_t, 3);
 
 
 //
@@ -252,6 +271,7 @@ typedef struct __attribute__((packed)) {
     uint8_t rateSPI;    // Output rate on SPI
     uint8_t rateReserved; // Reserved (usually 0)
 } ubx_cfg_msg_setu5_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_msg_setu5_t, 8);
 
 
 //
@@ -275,6 +295,7 @@ typedef union {
 typedef struct __attribute__((packed)) {
     // No payload — used to request current rate settings.
 } ubx_cfg_rate_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_rate_poll0_t, 0);
 
 
 //
@@ -295,8 +316,9 @@ typedef enum {
 typedef struct __attribute__((packed)) {
     uint16_t measRate;  // Measurement rate [ms]
     uint16_t navRate;   // Navigation rate [measurement cycles]
-    ubx_time_ref_t timeRef; // Time system reference (see enum)
+    uint16_t timeRef;   // Time system reference (ubx_time_ref_t)
 } ubx_cfg_rate_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_rate_data0_t, 6);
 
 
 //
@@ -340,6 +362,7 @@ typedef struct __attribute__((packed)) {
     int16_t rfGroupDelay;        // RF group delay [ns]
     int32_t userDelay;           // User-configurable delay [ns]
 } ubx_cfg_tp_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_tp_data0_t, 20);
 
 
 //
@@ -349,6 +372,7 @@ typedef struct __attribute__((packed)) {
 typedef struct __attribute__((packed)) {
     // Empty payload
 } ubx_cfg_tp_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_tp_poll0_t, 0);
 
 
 //
@@ -393,6 +417,7 @@ typedef struct __attribute__((packed)) {
         };
     } flags;
 } ubx_cfg_tp5_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_tp5_data0_t, 32);
 
 
 //
@@ -426,6 +451,7 @@ typedef struct __attribute__((packed)) {
         };
     } flags;
 } ubx_cfg_tp5_data1_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_tp5_data1_t, 32);
 
 
 //
@@ -434,10 +460,12 @@ typedef struct __attribute__((packed)) {
 typedef struct __attribute__((packed)) {
     // Empty payload for POLL0
 } ubx_cfg_tp5_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_tp5_poll0_t, 0);
 
 typedef struct __attribute__((packed)) {
     uint8_t tpIdx;
 } ubx_cfg_tp5_pollix_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_tp5_pollix_t, 1);
 
 
 //
@@ -519,6 +547,39 @@ typedef struct __attribute__((packed)) {
 
     uint16_t reserved1;    // 18-19: Reserved
 } ubx_cfg_prt_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_prt_t, 20);
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-TMODE2 payload (28 bytes), timing receivers up to u-blox 8
+typedef struct __attribute__((packed)) {
+    uint8_t  timeMode;      // 0: ubx_tmode_t
+    uint8_t  reserved1;     // 1
+    union {
+        uint16_t flags;     // 2
+        struct {
+            uint16_t lla      : 1;      // position is lat/lon/alt instead of ECEF
+            uint16_t altInv   : 1;      // altitude not valid
+            uint16_t reserved : 14;
+        };
+    };
+    int32_t  ecefXOrLat;    // 4: ECEF X [cm] or latitude [1e-7 deg]
+    int32_t  ecefYOrLon;    // 8: ECEF Y [cm] or longitude [1e-7 deg]
+    int32_t  ecefZOrAlt;    // 12: ECEF Z [cm] or altitude [cm]
+    uint32_t fixedPosAcc;   // 16: Fixed position 3D accuracy [mm]
+    uint32_t svinMinDur;    // 20: Survey-in minimum duration [s]
+    uint32_t svinAccLimit;  // 24: Survey-in position accuracy limit [mm]
+} ubx_cfg_tmode2_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_tmode2_t, 28);
+
+// timeMode / CFG-TMODE-MODE
+typedef enum {
+    UBX_TMODE_DISABLED = 0,
+    UBX_TMODE_SURVEY_IN,
+    UBX_TMODE_FIXED
+} ubx_tmode_t;
 
 
 
@@ -532,6 +593,7 @@ typedef struct __attribute__((packed)) {
     // "PROTVER 14.00", "GPS;SBAS;GLO;QZSS", etc.
     char extensions[][30];
 } ubx_mon_ver_t;
+UBX_PAYLOAD_SIZE(ubx_mon_ver_t, 40);
 
 // overlay ubx_mon_ver_t onto the raw payload bytes
 typedef struct __attribute__((packed)) {
@@ -544,8 +606,257 @@ typedef struct __attribute__((packed)) {
 } ubx_mon_ver_payload_t;
 
 
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-HW payload (60 bytes), u-blox 6 to 8
+typedef struct __attribute__((packed)) {
+    uint32_t pinSel;        // 0: Mask of pins set as peripheral/PIO
+    uint32_t pinBank;       // 4: Mask of pins set as bank A/B
+    uint32_t pinDir;        // 8: Mask of pins set as input/output
+    uint32_t pinVal;        // 12: Mask of pins value low/high
+    uint16_t noisePerMS;    // 16: Noise level as measured by the GPS core
+    uint16_t agcCnt;        // 18: AGC monitor (0 = 0%, 8191 = 100%)
+    uint8_t  aStatus;       // 20: Antenna supervisor state (ubx_ant_status_t)
+    uint8_t  aPower;        // 21: Antenna power status (0 = off, 1 = on, 2 = unknown)
+    union {
+        uint8_t flags;      // 22
+        struct {
+            uint8_t rtcCalib     : 1;   // RTC is calibrated
+            uint8_t safeBoot     : 1;   // Safe boot mode
+            uint8_t jammingState : 2;   // ubx_jamming_state_t
+            uint8_t xtalAbsent   : 1;   // RTC crystal not present
+            uint8_t reserved     : 3;
+        };
+    };
+    uint8_t  reserved1;     // 23
+    uint32_t usedMask;      // 24: Mask of pins used by the virtual pin manager
+    uint8_t  VP[17];        // 28: Pin mappings of each of the 17 physical pins
+    uint8_t  jamInd;        // 45: CW jamming indicator (0 = none, 255 = strong)
+    uint8_t  reserved2[2];  // 46
+    uint32_t pinIrq;        // 48: Mask of pins value using the PIO IRQ
+    uint32_t pullH;         // 52: Mask of pins value using the PIO pull high resistor
+    uint32_t pullL;         // 56: Mask of pins value using the PIO pull low resistor
+} ubx_mon_hw_t;
+UBX_PAYLOAD_SIZE(ubx_mon_hw_t, 60);
+
+// aStatus / antStatus
+typedef enum {
+    UBX_ANT_INIT = 0,
+    UBX_ANT_DONTKNOW,
+    UBX_ANT_OK,
+    UBX_ANT_SHORT,
+    UBX_ANT_OPEN
+} ubx_ant_status_t;
+
+// jammingState (needs the jamming monitor enabled, CFG-ITFM)
+typedef enum {
+    UBX_JAM_UNKNOWN = 0,    // unknown or monitor disabled
+    UBX_JAM_OK,             // no significant jamming
+    UBX_JAM_WARNING,        // interference visible, fix OK
+    UBX_JAM_CRITICAL        // interference visible, no fix
+} ubx_jamming_state_t;
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-RF payload (4 + nBlocks*24 bytes), generation 9+
+typedef struct __attribute__((packed)) {
+    uint8_t  blockId;       // 0: RF block ID (0 = L1, 1 = L2/L5)
+    union {
+        uint8_t flags;      // 1
+        struct {
+            uint8_t jammingState : 2;   // ubx_jamming_state_t
+            uint8_t reserved     : 6;
+        };
+    };
+    uint8_t  antStatus;     // 2: ubx_ant_status_t
+    uint8_t  antPower;      // 3: 0 = off, 1 = on, 2 = unknown
+    uint32_t postStatus;    // 4: POST status word
+    uint8_t  reserved1[4];  // 8
+    uint16_t noisePerMS;    // 12: Noise level as measured by the GPS core
+    uint16_t agcCnt;        // 14: AGC monitor (0 = 0%, 8191 = 100%)
+    uint8_t  jamInd;        // 16: CW jamming indicator (0 = none, 255 = strong)
+    int8_t   ofsI;          // 17: Imbalance of I-part of complex signal
+    uint8_t  magI;          // 18: Magnitude of I-part of complex signal
+    int8_t   ofsQ;          // 19: Imbalance of Q-part of complex signal
+    uint8_t  magQ;          // 20: Magnitude of Q-part of complex signal
+    uint8_t  reserved2[3];  // 21
+} ubx_mon_rf_block_t;
+UBX_PAYLOAD_SIZE(ubx_mon_rf_block_t, 24);
+
+typedef struct __attribute__((packed)) {
+    uint8_t  version;       // 0: Message version (0x00)
+    uint8_t  nBlocks;       // 1: Number of RF blocks
+    uint8_t  reserved0[2];  // 2
+    ubx_mon_rf_block_t blocks[];
+} ubx_mon_rf_t;
+UBX_PAYLOAD_SIZE(ubx_mon_rf_t, 4);
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-COMMS payload (8 + nPorts*40 bytes), generation 9+
+typedef struct __attribute__((packed)) {
+    uint16_t portId;        // 0: Port ID (0x0000 = I2C, 0x0100 = UART1, 0x0300 = USB, ...)
+    uint16_t txPending;     // 2: Bytes pending in the transmitter buffer
+    uint32_t txBytes;       // 4: Bytes ever sent
+    uint8_t  txUsage;       // 8: TX buffer usage over the last period [%]
+    uint8_t  txPeakUsage;   // 9: Maximum TX buffer usage [%]
+    uint16_t rxPending;     // 10: Bytes in the receiver buffer
+    uint32_t rxBytes;       // 12: Bytes ever received
+    uint8_t  rxUsage;       // 16: RX buffer usage over the last period [%]
+    uint8_t  rxPeakUsage;   // 17: Maximum RX buffer usage [%]
+    uint16_t overrunErrs;   // 18: Number of 100 ms timeslots with overrun errors
+    uint16_t msgs[4];       // 20: Messages parsed, per protocol in protIds
+    uint8_t  reserved1[8];  // 28
+    uint32_t skipped;       // 36: Bytes skipped
+} ubx_mon_comms_port_t;
+UBX_PAYLOAD_SIZE(ubx_mon_comms_port_t, 40);
+
+typedef struct __attribute__((packed)) {
+    uint8_t  version;       // 0: Message version (0x00)
+    uint8_t  nPorts;        // 1: Number of ports
+    union {
+        uint8_t txErrors;   // 2
+        struct {
+            uint8_t mem      : 1;   // Memory allocation error
+            uint8_t alloc    : 1;   // Buffer allocation error (TX overrun)
+            uint8_t reserved : 6;
+        };
+    };
+    uint8_t  reserved0;     // 3
+    uint8_t  protIds[4];    // 4: Protocol of each msgs[] column (0 = UBX, 1 = NMEA, ...)
+    ubx_mon_comms_port_t ports[];
+} ubx_mon_comms_t;
+UBX_PAYLOAD_SIZE(ubx_mon_comms_t, 8);
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-TXBUF payload (28 bytes), up to u-blox 8.  Arrays are per port.
+typedef struct __attribute__((packed)) {
+    uint16_t pending[6];    // 0: Bytes pending in the transmitter buffer
+    uint8_t  usage[6];      // 12: Buffer usage over the last period [%]
+    uint8_t  peakUsage[6];  // 18: Maximum buffer usage [%]
+    uint8_t  tUsage;        // 24: All ports: usage over the last period [%]
+    uint8_t  tPeakusage;    // 25: All ports: maximum usage [%]
+    union {
+        uint8_t errors;     // 26
+        struct {
+            uint8_t limit    : 6;   // Buffer limit of the corresponding port reached
+            uint8_t mem      : 1;   // Memory allocation error
+            uint8_t alloc    : 1;   // Buffer allocation error (TX overrun)
+        };
+    };
+    uint8_t  reserved1;     // 27
+} ubx_mon_txbuf_t;
+UBX_PAYLOAD_SIZE(ubx_mon_txbuf_t, 28);
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-RXBUF payload (24 bytes), up to u-blox 8.  Arrays are per port.
+typedef struct __attribute__((packed)) {
+    uint16_t pending[6];    // 0: Bytes pending in the receiver buffer
+    uint8_t  usage[6];      // 12: Buffer usage over the last period [%]
+    uint8_t  peakUsage[6];  // 18: Maximum buffer usage [%]
+} ubx_mon_rxbuf_t;
+UBX_PAYLOAD_SIZE(ubx_mon_rxbuf_t, 24);
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-PVT payload (92 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;          // 0: GPS time of week of the navigation epoch [ms]
+    uint16_t year;          // 4: Year (UTC)
+    uint8_t  month;         // 6: Month, 1..12 (UTC)
+    uint8_t  day;           // 7: Day of month, 1..31 (UTC)
+    uint8_t  hour;          // 8: Hour of day, 0..23 (UTC)
+    uint8_t  min;           // 9: Minute of hour, 0..59 (UTC)
+    uint8_t  sec;           // 10: Seconds of minute, 0..60 (UTC)
+    uint8_t  valid;         // 11: Validity flags (bit 0 date, 1 time, 2 fully resolved)
+    uint32_t tAcc;          // 12: Time accuracy estimate (UTC) [ns]
+    int32_t  nano;          // 16: Fraction of second, -1e9..1e9 (UTC) [ns]
+    uint8_t  fixType;       // 20: 0 none, 1 DR, 2 2D, 3 3D, 4 GNSS+DR, 5 time only
+    union {
+        uint8_t flags;      // 21
+        struct {
+            uint8_t gnssFixOK    : 1;   // Valid fix (within DOP and accuracy masks)
+            uint8_t diffSoln     : 1;   // Differential corrections applied
+            uint8_t psmState     : 3;
+            uint8_t headVehValid : 1;
+            uint8_t carrSoln     : 2;
+        };
+    };
+    uint8_t  flags2;        // 22
+    uint8_t  numSV;         // 23: Number of satellites used in the solution
+    int32_t  lon;           // 24: Longitude [1e-7 deg]
+    int32_t  lat;           // 28: Latitude [1e-7 deg]
+    int32_t  height;        // 32: Height above ellipsoid [mm]
+    int32_t  hMSL;          // 36: Height above mean sea level [mm]
+    uint32_t hAcc;          // 40: Horizontal accuracy estimate [mm]
+    uint32_t vAcc;          // 44: Vertical accuracy estimate [mm]
+    int32_t  velN;          // 48: NED north velocity [mm/s]
+    int32_t  velE;          // 52: NED east velocity [mm/s]
+    int32_t  velD;          // 56: NED down velocity [mm/s]
+    int32_t  gSpeed;        // 60: Ground speed (2D) [mm/s]
+    int32_t  headMot;       // 64: Heading of motion (2D) [1e-5 deg]
+    uint32_t sAcc;          // 68: Speed accuracy estimate [mm/s]
+    uint32_t headAcc;       // 72: Heading accuracy estimate [1e-5 deg]
+    uint16_t pDOP;          // 76: Position DOP [0.01]
+    uint8_t  flags3;        // 78
+    uint8_t  reserved0[5];  // 79
+    int32_t  headVeh;       // 84: Heading of vehicle (2D) [1e-5 deg]
+    int16_t  magDec;        // 88: Magnetic declination [1e-2 deg]
+    uint16_t magAcc;        // 90: Magnetic declination accuracy [1e-2 deg]
+} ubx_nav_pvt_t;
+UBX_PAYLOAD_SIZE(ubx_nav_pvt_t, 92);
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-TIMEUTC payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;          // 0: GPS time of week of the navigation epoch [ms]
+    uint32_t tAcc;          // 4: Time accuracy estimate (UTC) [ns]
+    int32_t  nano;          // 8: Fraction of second, -1e9..1e9 (UTC) [ns]
+    uint16_t year;          // 12: Year (UTC)
+    uint8_t  month;         // 14: Month, 1..12 (UTC)
+    uint8_t  day;           // 15: Day of month, 1..31 (UTC)
+    uint8_t  hour;          // 16: Hour of day, 0..23 (UTC)
+    uint8_t  min;           // 17: Minute of hour, 0..59 (UTC)
+    uint8_t  sec;           // 18: Seconds of minute, 0..60 (UTC)
+    union {
+        uint8_t valid;      // 19
+        struct {
+            uint8_t validTOW    : 1;    // Valid time of week
+            uint8_t validWKN    : 1;    // Valid week number
+            uint8_t validUTC    : 1;    // Valid UTC time (leap seconds known)
+            uint8_t reserved    : 1;
+            uint8_t utcStandard : 4;    // UTC standard identifier
+        };
+    };
+} ubx_nav_timeutc_t;
+UBX_PAYLOAD_SIZE(ubx_nav_timeutc_t, 20);
+
+#define UBX_TIMEUTC_VALID_TOW   0x01
+#define UBX_TIMEUTC_VALID_WKN   0x02
+#define UBX_TIMEUTC_VALID_UTC   0x04
+#define UBX_TIMEUTC_VALID_ALL   0x07
+
 
 
 #pragma pack(pop)
 
+// Every other public message, generated from the u-center 2 database
+#include "ubx_structs.h"
+
 #endif // UBX_PAYLOAD_H
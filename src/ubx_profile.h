@@ -0,0 +1,466 @@
+#ifndef UBX_PROFILE_H
+#define UBX_PROFILE_H
+/*******************************************************************************
+ ubx_profile.h
+
+ Compiles a receiver profile file into UBX frames.
+
+ A profile is plain text, one setting per line, using the message and field
+ names of ubx_payload.h.  '#' starts a comment; names are case-insensitive.
+
+   PORT UBX+NMEA                         output protocols on USB and UART1
+   PORT NMEA                               (sent without waiting for an ACK)
+   CFG-INF NMEA off                      infMsgMask for every target
+   CFG-INF UBX usb=0x07 uart1=0x07
+   CFG-MSG ZDA usb=1 uart1=1             rateI2C, rateUART1, rateUART2,
+   CFG-MSG GSV off                         rateUSB, rateSPI (unnamed = 0)
+   CFG-MSG F0-08 all=1                   class-id instead of an NMEA name
+   CFG-RATE measRate=1000 navRate=1 timeRef=GPS
+   CFG-GNSS numTrkChUse=22 GPS=on,4,255 SBAS=on,1,3 QZSS=on,0,3 GLONASS=off,8,255
+   UBX 06 31 00 01 00 00 ...             raw class, id and payload, in hex
+   VALSET CFG-MSGOUT-NMEA_ID_ZDA_UART1=1 CFG-SIGNAL-GLO_ENA=off
+   VALSET ram,bbr CFG-RATE-MEAS=1000     key-value items (generation 9+),
+                                           see ubx_valcfg.h for the key names
+
+ Every frame, checksum included, is assembled once by ubx_profile_load()
+ into the fixed-size table of a ubx_profile_t, ready to be written as is.
+
+ Copyright (C) 2025 Richard Elwell
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <errno.h>
+#include <ctype.h>
+#include <stdbool.h>
+#include "ubx_defs.h"
+#include "ubx_payload.h"
+#include "ubx_valcfg.h"
+
+#define UBX_PROFILE_DIR         "/etc/ntpgps/profiles"
+#define UBX_PROFILE_MAX_STEPS   64
+#define UBX_PROFILE_FRAME_MAX   256
+#define UBX_PROFILE_MAX_TOKENS  16
+
+typedef struct {
+    char    path[256];
+    size_t  count;
+    uint8_t frame[UBX_PROFILE_MAX_STEPS][UBX_PROFILE_FRAME_MAX];
+    size_t  len[UBX_PROFILE_MAX_STEPS];
+    bool    no_wait[UBX_PROFILE_MAX_STEPS];   // port switch: no ACK expected
+} ubx_profile_t;
+
+// NMEA standard messages (class 0xF0) by name
+static const struct { const char *name; uint8_t id; } ubx_profile_nmea[] = {
+    { "GGA", 0x00 }, { "GLL", 0x01 }, { "GSA", 0x02 }, { "GSV", 0x03 },
+    { "RMC", 0x04 }, { "VTG", 0x05 }, { "GRS", 0x06 }, { "GST", 0x07 },
+    { "ZDA", 0x08 }, { "GBS", 0x09 }, { "DTM", 0x0A }, { "RLM", 0x0B },
+    { "GNS", 0x0D }, { "THS", 0x0E }, { "VLW", 0x0F }, { "UTC", 0x10 },
+};
+
+// GNSS identifiers of CFG-GNSS blocks
+static const struct { const char *name; uint8_t id; } ubx_profile_gnss[] = {
+    { "GPS", 0 }, { "SBAS", 1 }, { "Galileo", 2 }, { "BeiDou", 3 },
+    { "IMES", 4 }, { "QZSS", 5 }, { "GLONASS", 6 },
+};
+
+// Per-target fields of CFG-MSG and CFG-INF, in payload order
+static const char * const ubx_profile_targets[] = { "I2C", "UART1", "UART2", "USB", "SPI" };
+
+typedef struct {
+    const char *path;
+    int         line;
+    char       *err;
+    size_t      err_size;
+} ubx_profile_ctx_t;
+
+static int ubx_profile_error(ubx_profile_ctx_t *ctx, const char *msg, const char *arg)
+{
+    snprintf(ctx->err, ctx->err_size, "%s:%d: %s%s%s", ctx->path, ctx->line, msg,
+             arg ? ": " : "", arg ? arg : "");
+    return -1;
+}
+
+// Parse an unsigned number (decimal or 0x hex) no larger than 'max'
+static bool ubx_profile_uint(const char *s, unsigned long max, unsigned long *out)
+{
+    char *end;
+    if (!*s || *s == '-')
+        return false;
+    unsigned long v = strtoul(s, &end, 0);
+    if (*end || v > max)
+        return false;
+    *out = v;
+    return true;
+}
+
+// Split "key=value"; value is NULL if there is no '='
+static void ubx_profile_kv(char *tok, char **key, char **val)
+{
+    char *eq = strchr(tok, '=');
+    *key = tok;
+    *val = NULL;
+    if (eq) {
+        *eq = '\0';
+        *val = eq + 1;
+    }
+}
+
+// Index of a target name (with or without the "rate" prefix of CFG-MSG), -1 if unknown
+static int ubx_profile_target(const char *key)
+{
+    if (strncasecmp(key, "rate", 4) == 0)
+        key += 4;
+    for (size_t i = 0; i < SIZEOF(ubx_profile_targets); i++) {
+        if (strcasecmp(key, ubx_profile_targets[i]) == 0)
+            return (int)i;
+    }
+    return -1;
+}
+
+static int ubx_profile_add(ubx_profile_t *p, ubx_profile_ctx_t *ctx, uint8_t cls, uint8_t id,
+                           const void *payload, size_t payload_len, bool no_wait)
+{
+    if (p->count == UBX_PROFILE_MAX_STEPS)
+        return ubx_profile_error(ctx, "too many settings", NULL);
+
+    size_t len = ubx_frame_build(p->frame[p->count], UBX_PROFILE_FRAME_MAX, cls, id, payload, payload_len);
+    if (len == 0)
+        return ubx_profile_error(ctx, "payload too long", NULL);
+
+    p->len[p->count] = len;
+    p->no_wait[p->count] = no_wait;
+    p->count++;
+    return 0;
+}
+
+static int ubx_profile_add_msg(ubx_profile_t *p, ubx_profile_ctx_t *ctx, const ubx_msg_t *msg, bool no_wait)
+{
+    return ubx_profile_add(p, ctx, msg->cls, msg->id, msg->payload, msg->payload_len, no_wait);
+}
+
+// PORT UBX+NMEA | NMEA
+static int ubx_profile_port(ubx_profile_t *p, ubx_profile_ctx_t *ctx, char **tok, int ntok)
+{
+    if (ntok != 2)
+        return ubx_profile_error(ctx, "expected PORT UBX+NMEA or PORT NMEA", NULL);
+
+    if (strcasecmp(tok[1], "UBX+NMEA") == 0) {
+        if (ubx_profile_add_msg(p, ctx, &set_cfg_prt_usb_ubxnmea, true) ||
+            ubx_profile_add_msg(p, ctx, &set_cfg_prt_uart1_ubxnmea, true))
+            return -1;
+    } else if (strcasecmp(tok[1], "NMEA") == 0) {
+        if (ubx_profile_add_msg(p, ctx, &set_cfg_prt_usb_nmea, true) ||
+            ubx_profile_add_msg(p, ctx, &set_cfg_prt_uart1_nmea, true))
+            return -1;
+    } else {
+        return ubx_profile_error(ctx, "unknown port protocol", tok[1]);
+    }
+    return 0;
+}
+
+// CFG-INF NMEA|UBX off | <target>=mask ...
+static int ubx_profile_cfg_inf(ubx_profile_t *p, ubx_profile_ctx_t *ctx, char **tok, int ntok)
+{
+    ubx_cfg_inf_t inf = {0};
+
+    if (ntok < 3)
+        return ubx_profile_error(ctx, "expected CFG-INF <NMEA|UBX> <off|target=mask ...>", NULL);
+    if (strcasecmp(tok[1], "UBX") == 0)
+        inf.protocolID = 0;
+    else if (strcasecmp(tok[1], "NMEA") == 0)
+        inf.protocolID = 1;
+    else
+        return ubx_profile_error(ctx, "unknown protocolID", tok[1]);
+
+    for (int i = 2; i < ntok; i++) {
+        char *key, *val;
+        unsigned long v;
+        if (strcasecmp(tok[i], "off") == 0)
+            continue;
+        ubx_profile_kv(tok[i], &key, &val);
+        int t = ubx_profile_target(key);
+        if (t < 0 || !val)
+            return ubx_profile_error(ctx, "expected <target>=<infMsgMask>", key);
+        if (!ubx_profile_uint(val, 0xFF, &v))
+            return ubx_profile_error(ctx, "bad infMsgMask", val);
+        inf.infMsgMask[t].mask = (uint8_t)v;
+    }
+    return ubx_profile_add(p, ctx, UBX_CLS_CFG, UBX_ID_CFG_INF, &inf, sizeof(inf), false);
+}
+
+// CFG-MSG <NMEA name|cls-id> off | on | all=N | <target>=N ...
+static int ubx_profile_cfg_msg(ubx_profile_t *p, ubx_profile_ctx_t *ctx, char **tok, int ntok)
+{
+    ubx_cfg_msg_setu5_t msg = {0};
+    bool found = false;
+
+    if (ntok < 3)
+        return ubx_profile_error(ctx, "expected CFG-MSG <message> <on|off|target=rate ...>", NULL);
+
+    for (size_t i = 0; i < SIZEOF(ubx_profile_nmea) && !found; i++) {
+        if (strcasecmp(tok[1], ubx_profile_nmea[i].name) == 0) {
+            msg.msgClass = 0xF0;
+            msg.msgID = ubx_profile_nmea[i].id;
+            found = true;
+        }
+    }
+    if (!found) {
+        unsigned c, m;
+        char tail;
+        if (sscanf(tok[1], "%2x-%2x%c", &c, &m, &tail) != 2)
+            return ubx_profile_error(ctx, "unknown message", tok[1]);
+        msg.msgClass = (uint8_t)c;
+        msg.msgID = (uint8_t)m;
+    }
+
+    uint8_t *rate = &msg.rateI2C;
+    for (int i = 2; i < ntok; i++) {
+        char *key, *val;
+        unsigned long v;
+        if (strcasecmp(tok[i], "off") == 0)
+            continue;
+        if (strcasecmp(tok[i], "on") == 0) {
+            memset(rate, 1, SIZEOF(ubx_profile_targets));
+            continue;
+        }
+        ubx_profile_kv(tok[i], &key, &val);
+        if (!val || !ubx_profile_uint(val, 0xFF, &v))
+            return ubx_profile_error(ctx, "expected <target>=<rate>", tok[i]);
+        if (strcasecmp(key, "all") == 0) {
+            memset(rate, (int)v, SIZEOF(ubx_profile_targets));
+            continue;
+        }
+        int t = ubx_profile_target(key);
+        if (t < 0)
+            return ubx_profile_error(ctx, "unknown target", key);
+        rate[t] = (uint8_t)v;
+    }
+    return ubx_profile_add(p, ctx, UBX_CLS_CFG, UBX_ID_CFG_MSG, &msg, sizeof(msg), false);
+}
+
+// CFG-RATE measRate=ms navRate=cycles timeRef=UTC|GPS|N
+static int ubx_profile_cfg_rate(ubx_profile_t *p, ubx_profile_ctx_t *ctx, char **tok, int ntok)
+{
+    ubx_cfg_rate_data0_t rate = { .measRate = 1000, .navRate = 1, .timeRef = UBX_TIME_REF_GPS };
+
+    for (int i = 1; i < ntok; i++) {
+        char *key, *val;
+        unsigned long v;
+        ubx_profile_kv(tok[i], &key, &val);
+        if (!val)
+            return ubx_profile_error(ctx, "expected key=value", key);
+
+        if (strcasecmp(key, "measRate") == 0 && ubx_profile_uint(val, 0xFFFF, &v) && v > 0)
+            rate.measRate = (uint16_t)v;
+        else if (strcasecmp(key, "navRate") == 0 && ubx_profile_uint(val, 127, &v) && v > 0)
+            rate.navRate = (uint16_t)v;
+        else if (strcasecmp(key, "timeRef") == 0 && strcasecmp(val, "UTC") == 0)
+            rate.timeRef = UBX_TIME_REF_UTC;
+        else if (strcasecmp(key, "timeRef") == 0 && strcasecmp(val, "GPS") == 0)
+            rate.timeRef = UBX_TIME_REF_GPS;
+        else if (strcasecmp(key, "timeRef") == 0 && ubx_profile_uint(val, UBX_TIME_REF_GALILEO, &v))
+            rate.timeRef = (uint16_t)v;
+        else
+            return ubx_profile_error(ctx, "bad CFG-RATE field", key);
+    }
+
+    return ubx_profile_add(p, ctx, UBX_CLS_CFG, UBX_ID_CFG_RATE, &rate, sizeof(rate), false);
+}
+
+// CFG-GNSS [numTrkChUse=N] <gnss>=on|off,resTrkCh,maxTrkCh ...
+static int ubx_profile_cfg_gnss(ubx_profile_t *p, ubx_profile_ctx_t *ctx, char **tok, int ntok)
+{
+    uint8_t payload[4 + SIZEOF(ubx_profile_gnss) * sizeof(ubx_cfg_gnss_block_t)] = {0};
+    ubx_cfg_gnss_t *gnss = (ubx_cfg_gnss_t *)payload;
+    unsigned long v;
+
+    for (int i = 1; i < ntok; i++) {
+        char *key, *val;
+        ubx_profile_kv(tok[i], &key, &val);
+        if (!val)
+            return ubx_profile_error(ctx, "expected key=value", key);
+
+        if (strcasecmp(key, "numTrkChUse") == 0) {
+            if (!ubx_profile_uint(val, 0xFF, &v))
+                return ubx_profile_error(ctx, "bad numTrkChUse", val);
+            gnss->numTrkChUse = (uint8_t)v;
+            continue;
+        }
+
+        int g = -1;
+        for (size_t k = 0; k < SIZEOF(ubx_profile_gnss); k++) {
+            if (strcasecmp(key, ubx_profile_gnss[k].name) == 0)
+                g = (int)k;
+        }
+        if (g < 0)
+            return ubx_profile_error(ctx, "unknown gnssId", key);
+        if (gnss->numConfigBlocks == SIZEOF(ubx_profile_gnss))
+            return ubx_profile_error(ctx, "too many GNSS blocks", NULL);
+
+        char state[4];
+        unsigned res, max;
+        char tail;
+        if (sscanf(val, "%3[a-zA-Z],%u,%u%c", state, &res, &max, &tail) != 3 || res > max || max > 0xFF ||
+            (strcasecmp(state, "on") != 0 && strcasecmp(state, "off") != 0))
+            return ubx_profile_error(ctx, "expected <gnss>=on|off,resTrkCh,maxTrkCh", val);
+
+        ubx_cfg_gnss_block_t *b = &gnss->blocks[gnss->numConfigBlocks++];
+        b->gnssId   = ubx_profile_gnss[g].id;
+        b->resTrkCh = (uint8_t)res;
+        b->maxTrkCh = (uint8_t)max;
+        b->enable   = (strcasecmp(state, "on") == 0);
+        b->reserved2 = 0x01;    // as u-center writes it for u-blox 7
+    }
+
+    if (gnss->numConfigBlocks == 0)
+        return ubx_profile_error(ctx, "CFG-GNSS needs at least one GNSS block", NULL);
+    return ubx_profile_add(p, ctx, UBX_CLS_CFG, UBX_ID_CFG_GNSS, payload,
+                           4 + gnss->numConfigBlocks * sizeof(ubx_cfg_gnss_block_t), false);
+}
+
+// One byte of a raw UBX line: bare hex as on the UBX control command ("06",
+// "31", "B5"), optionally with a 0x prefix
+static bool ubx_profile_hex_byte(const char *s, uint8_t *out)
+{
+    unsigned byte;
+    char tail;
+    if (s[0] == '0' && (s[1] == 'x' || s[1] == 'X'))
+        s += 2;
+    if (!isxdigit((unsigned char)s[0]) || sscanf(s, "%2x%c", &byte, &tail) != 1)
+        return false;
+    *out = (uint8_t)byte;
+    return true;
+}
+
+// UBX <cls> <id> [payload...], all bytes in hex
+static int ubx_profile_raw(ubx_profile_t *p, ubx_profile_ctx_t *ctx, char **tok, int ntok)
+{
+    uint8_t payload[UBX_PROFILE_FRAME_MAX];
+    size_t n = 0;
+    uint8_t cls, id;
+
+    if (ntok < 3 || !ubx_profile_hex_byte(tok[1], &cls) || !ubx_profile_hex_byte(tok[2], &id))
+        return ubx_profile_error(ctx, "expected UBX <class> <id> [payload bytes] in hex", NULL);
+    for (int i = 3; i < ntok; i++) {
+        if (n == sizeof(payload) - UBX_MIN_MSG_SIZE)
+            return ubx_profile_error(ctx, "payload too long", NULL);
+        if (!ubx_profile_hex_byte(tok[i], &payload[n++]))
+            return ubx_profile_error(ctx, "bad payload byte", tok[i]);
+    }
+    return ubx_profile_add(p, ctx, cls, id, payload, n, false);
+}
+
+// VALSET [layers] KEY=VALUE...
+static int ubx_profile_valset(ubx_profile_t *p, ubx_profile_ctx_t *ctx, char **tok, int ntok)
+{
+    ubx_valcfg_kv_t kv[UBX_PROFILE_MAX_TOKENS];
+    uint8_t layers = UBX_VAL_LAYER_RAM;
+    size_t n = 0;
+    char err[160];
+
+    for (int i = 1; i < ntok; i++) {
+        if (i == 1 && !strchr(tok[i], '=')) {
+            layers = ubx_valcfg_parse_layers(tok[i]);
+            if (!layers)
+                return ubx_profile_error(ctx, "unknown VALSET layers", tok[i]);
+            continue;
+        }
+        if (ubx_valcfg_parse(tok[i], &kv[n], err, sizeof(err)) != 0)
+            return ubx_profile_error(ctx, err, NULL);
+        n++;
+    }
+    if (n == 0)
+        return ubx_profile_error(ctx, "expected VALSET [layers] KEY=VALUE...", NULL);
+
+    uint8_t frame[UBX_MAX_MSG_SIZE];
+    size_t len = ubx_valset_build(frame, sizeof(frame), layers, UBX_VALSET_TXN_NONE, kv, n);
+    return ubx_profile_add(p, ctx, UBX_CLS_CFG, UBX_ID_CFG_VALSET, &frame[6], len - UBX_MIN_MSG_SIZE, false);
+}
+
+/*
+ * ubx_profile_load()
+ * ------------------
+ * Reads 'path' (a bare name is looked up as UBX_PROFILE_DIR/<name>.profile)
+ * and assembles its frames into 'p'.  Returns 0, or -1 with a
+ * "file:line: reason" message in 'err'.
+ */
+static int ubx_profile_load(const char *path, ubx_profile_t *p, char *err, size_t err_size)
+{
+    memset(p, 0, sizeof(*p));
+    if (strchr(path, '/'))
+        snprintf(p->path, sizeof(p->path), "%s", path);
+    else
+        snprintf(p->path, sizeof(p->path), "%s/%s.profile", UBX_PROFILE_DIR, path);
+
+    ubx_profile_ctx_t ctx = { p->path, 0, err, err_size };
+    FILE *f = fopen(p->path, "r");
+    if (!f) {
+        snprintf(err, err_size, "%.200s: %s", p->path, strerror(errno));
+        return -1;
+    }
+
+    char line[512];
+    int rc = 0;
+    while (rc == 0 && fgets(line, sizeof(line), f)) {
+        ctx.line++;
+        char *hash = strchr(line, '#');
+        if (hash)
+            *hash = '\0';
+
+        char *tok[UBX_PROFILE_MAX_TOKENS];
+        int ntok = 0;
+        for (char *t = strtok(line, " \t\r\n"); t; t = strtok(NULL, " \t\r\n")) {
+            if (ntok == UBX_PROFILE_MAX_TOKENS) {
+                rc = ubx_profile_error(&ctx, "too many fields", NULL);
+                break;
+            }
+            tok[ntok++] = t;
+        }
+        if (rc || ntok == 0)
+            continue;
+
+        if (strcasecmp(tok[0], "PORT") == 0)
+            rc = ubx_profile_port(p, &ctx, tok, ntok);
+        else if (strcasecmp(tok[0], "CFG-INF") == 0)
+            rc = ubx_profile_cfg_inf(p, &ctx, tok, ntok);
+        else if (strcasecmp(tok[0], "CFG-MSG") == 0)
+            rc = ubx_profile_cfg_msg(p, &ctx, tok, ntok);
+        else if (strcasecmp(tok[0], "CFG-RATE") == 0)
+            rc = ubx_profile_cfg_rate(p, &ctx, tok, ntok);
+        else if (strcasecmp(tok[0], "CFG-GNSS") == 0)
+            rc = ubx_profile_cfg_gnss(p, &ctx, tok, ntok);
+        else if (strcasecmp(tok[0], "UBX") == 0)
+            rc = ubx_profile_raw(p, &ctx, tok, ntok);
+        else if (strcasecmp(tok[0], "VALSET") == 0)
+            rc = ubx_profile_valset(p, &ctx, tok, ntok);
+        else
+            rc = ubx_profile_error(&ctx, "unknown setting", tok[0]);
+    }
+    fclose(f);
+
+    if (rc == 0 && p->count == 0) {
+        snprintf(err, err_size, "%.200s: no settings", p->path);
+        rc = -1;
+    }
+    return rc;
+}
+
+
+#endif // UBX_PROFILE_H
@@ -0,0 +1,11445 @@
+#ifndef UBX_STRUCTS_H
+#define UBX_STRUCTS_H
+/*******************************************************************************
+ ubx_structs.h
+
+ Generated by test/gen-ubx-structs.py from test/ucenter2/ucenter2-messages.json,
+ do not edit.  Included by ubx_payload.h, which provides UBX_PAYLOAD_SIZE and
+ the hand-written structs of the 13 variants left out here.
+
+ 516 payload structs (91 of them repeated blocks) for 425 message variants.
+
+ Example:
+   const ubx_nav_sat_data0_t *sat = UBX_NAV_SAT_DATA0(payload);
+   for (unsigned i = 0; i < UBX_NAV_SAT_DATA0_SV_COUNT(payload, len); i++)
+       if (UBX_NAV_SAT_DATA0_SV(payload, i)->svUsed) ...
+
+   UBX_TIM_TP_DATA0_TYPED(tim_tp, (towMS, 1000), (week, 2380))
+
+ Copyright (C) 2025 Richard Elwell
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#pragma pack(push, 1)
+
+// Defined in ubx_payload.h:
+//   UBX-CFG-MSG-POLLID, UBX-CFG-MSG-SETU5, UBX-CFG-MSG-SETCURRENT, UBX-CFG-INF-POLLID
+//   UBX-CFG-TP-POLL0, UBX-CFG-TP-DATA0, UBX-CFG-RATE-POLL0, UBX-CFG-RATE-DATA0
+//   UBX-CFG-CFG-U5, UBX-CFG-TP5-POLL0, UBX-CFG-TP5-POLLIX, UBX-CFG-TP5-DATA0
+//   UBX-CFG-TP5-DATA1
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-POSECEF-DATA0 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    int32_t ecefX;                      // 4: cm
+    int32_t ecefY;                      // 8: cm
+    int32_t ecefZ;                      // 12: cm
+    uint32_t pAcc;                      // 16: cm
+} ubx_nav_posecef_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_posecef_data0_t, 20);
+
+#define UBX_NAV_POSECEF_DATA0(payload)          ((const ubx_nav_posecef_data0_t *)(payload))
+#define UBX_NAV_POSECEF_DATA0_SIZE              20
+#define UBX_NAV_POSECEF_DATA0_TYPED(name, ...)  UBX_MESSAGE_TYPED(name, 0x01, 0x01, ubx_nav_posecef_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-POSLLH-DATA0 payload (28 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    int32_t lon;                        // 4: deg, *1e-7
+    int32_t lat;                        // 8: deg, *1e-7
+    int32_t height;                     // 12: mm
+    int32_t hMSL;                       // 16: mm
+    uint32_t hAcc;                      // 20: mm
+    uint32_t vAcc;                      // 24: mm
+} ubx_nav_posllh_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_posllh_data0_t, 28);
+
+#define UBX_NAV_POSLLH_DATA0(payload)           ((const ubx_nav_posllh_data0_t *)(payload))
+#define UBX_NAV_POSLLH_DATA0_SIZE               28
+#define UBX_NAV_POSLLH_DATA0_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, 0x01, 0x02, ubx_nav_posllh_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-STATUS-DATA1 payload (16 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t gpsFix;                     // 4
+    union {
+        uint8_t flags;                  // 5
+        struct {
+            uint8_t gpsFixOk : 1;           // bit 0
+            uint8_t diffSoln : 1;           // bit 1
+            uint8_t wknSet : 1;             // bit 2
+            uint8_t towSet : 1;             // bit 3
+            uint8_t : 4;
+        };
+    };
+    union {
+        uint8_t fixStat;                // 6
+        struct {
+            uint8_t diffCorr : 1;           // bit 0
+            uint8_t carrSolnValid : 1;      // bit 1
+            uint8_t : 4;
+            uint8_t mapMatching : 2;        // bit 6..7
+        };
+    };
+    union {
+        uint8_t flags2;                 // 7
+        struct {
+            uint8_t psmState : 2;           // bit 0..1
+            uint8_t : 1;
+            uint8_t spoofDetState : 2;      // bit 3..4
+            uint8_t : 1;
+            uint8_t carrSoln : 2;           // bit 6..7
+        };
+    };
+    uint32_t ttff;                      // 8: ms
+    uint32_t msss;                      // 12: ms
+} ubx_nav_status_data1_t;
+UBX_PAYLOAD_SIZE(ubx_nav_status_data1_t, 16);
+
+#define UBX_NAV_STATUS_DATA1(payload)           ((const ubx_nav_status_data1_t *)(payload))
+#define UBX_NAV_STATUS_DATA1_SIZE               16
+#define UBX_NAV_STATUS_DATA1_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, 0x01, 0x03, ubx_nav_status_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-DOP-DATA0 payload (18 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint16_t gDOP;                      // 4: *0.01
+    uint16_t pDOP;                      // 6: *0.01
+    uint16_t tDOP;                      // 8: *0.01
+    uint16_t vDOP;                      // 10: *0.01
+    uint16_t hDOP;                      // 12: *0.01
+    uint16_t nDOP;                      // 14: *0.01
+    uint16_t eDOP;                      // 16: *0.01
+} ubx_nav_dop_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_dop_data0_t, 18);
+
+#define UBX_NAV_DOP_DATA0(payload)              ((const ubx_nav_dop_data0_t *)(payload))
+#define UBX_NAV_DOP_DATA0_SIZE                  18
+#define UBX_NAV_DOP_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x01, 0x04, ubx_nav_dop_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-ATT-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_nav_att_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_att_poll0_t, 0);
+
+#define UBX_NAV_ATT_POLL0(payload)              ((const ubx_nav_att_poll0_t *)(payload))
+#define UBX_NAV_ATT_POLL0_SIZE                  0
+#define UBX_NAV_ATT_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x01, 0x05, ubx_nav_att_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-ATT-DATA0 payload (32 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t version;                    // 4
+    uint8_t reserved0[3];               // 5
+    int32_t roll;                       // 8: deg, *1e-5
+    int32_t pitch;                      // 12: deg, *1e-5
+    int32_t heading;                    // 16: deg, *1e-5
+    uint32_t accRoll;                   // 20: deg, *1e-5
+    uint32_t accPitch;                  // 24: deg, *1e-5
+    uint32_t accHeading;                // 28: deg, *1e-5
+} ubx_nav_att_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_att_data0_t, 32);
+
+#define UBX_NAV_ATT_DATA0(payload)              ((const ubx_nav_att_data0_t *)(payload))
+#define UBX_NAV_ATT_DATA0_SIZE                  32
+#define UBX_NAV_ATT_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x01, 0x05, ubx_nav_att_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-SOL-DATA0 payload (52 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    int32_t fTOW;                       // 4: ns
+    int16_t week;                       // 8: weeks
+    uint8_t gpsFix;                     // 10
+    union {
+        uint8_t flags;                  // 11
+        struct {
+            uint8_t GPSfixOK : 1;           // bit 0
+            uint8_t DiffSoln : 1;           // bit 1
+            uint8_t WKNSET : 1;             // bit 2
+            uint8_t TOWSET : 1;             // bit 3
+            uint8_t : 4;
+        };
+    };
+    int32_t ecefX;                      // 12: cm
+    int32_t ecefY;                      // 16: cm
+    int32_t ecefZ;                      // 20: cm
+    uint32_t pAcc;                      // 24: cm
+    int32_t ecefVX;                     // 28: cm/s
+    int32_t ecefVY;                     // 32: cm/s
+    int32_t ecefVZ;                     // 36: cm/s
+    uint32_t sAcc;                      // 40: cm/s
+    uint16_t pDOP;                      // 44: *0.01
+    uint8_t reserved0;                  // 46
+    uint8_t numSV;                      // 47
+    uint8_t reserved1[4];               // 48
+} ubx_nav_sol_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_sol_data0_t, 52);
+
+#define UBX_NAV_SOL_DATA0(payload)              ((const ubx_nav_sol_data0_t *)(payload))
+#define UBX_NAV_SOL_DATA0_SIZE                  52
+#define UBX_NAV_SOL_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x01, 0x06, ubx_nav_sol_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-PVT-DATA0 payload (84 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint16_t year;                      // 4: y
+    uint8_t month;                      // 6: month
+    uint8_t day;                        // 7: d
+    uint8_t hour;                       // 8: h
+    uint8_t min;                        // 9: min
+    uint8_t sec;                        // 10: s
+    union {
+        uint8_t valid;                  // 11
+        struct {
+            uint8_t validDate : 1;          // bit 0
+            uint8_t validTime : 1;          // bit 1
+            uint8_t fullyResolved : 1;      // bit 2
+            uint8_t : 5;
+        };
+    };
+    uint32_t tAcc;                      // 12: ns
+    int32_t nano;                       // 16: ns
+    uint8_t fixType;                    // 20
+    union {
+        uint8_t flags;                  // 21
+        struct {
+            uint8_t gnssFixOK : 1;          // bit 0
+            uint8_t diffSoln : 1;           // bit 1
+            uint8_t psmState : 3;           // bit 2..4
+            uint8_t : 3;
+        };
+    };
+    uint8_t reserved0;                  // 22
+    uint8_t numSV;                      // 23
+    int32_t lon;                        // 24: deg, *1e-7
+    int32_t lat;                        // 28: deg, *1e-7
+    int32_t height;                     // 32: mm
+    int32_t hMSL;                       // 36: mm
+    uint32_t hAcc;                      // 40: mm
+    uint32_t vAcc;                      // 44: mm
+    int32_t velN;                       // 48: mm/s
+    int32_t velE;                       // 52: mm/s
+    int32_t velD;                       // 56: mm/s
+    int32_t gSpeed;                     // 60: mm/s
+    int32_t headMot;                    // 64: deg, *1e-5
+    uint32_t sAcc;                      // 68: mm/s
+    uint32_t headAcc;                   // 72: deg, *1e-5
+    uint16_t pDOP;                      // 76: *0.01
+    uint8_t reserved1[6];               // 78
+} ubx_nav_pvt_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_pvt_data0_t, 84);
+
+#define UBX_NAV_PVT_DATA0(payload)              ((const ubx_nav_pvt_data0_t *)(payload))
+#define UBX_NAV_PVT_DATA0_SIZE                  84
+#define UBX_NAV_PVT_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x01, 0x07, ubx_nav_pvt_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-PVT-DATA1 payload (92 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint16_t year;                      // 4: y
+    uint8_t month;                      // 6: month
+    uint8_t day;                        // 7: d
+    uint8_t hour;                       // 8: h
+    uint8_t min;                        // 9: min
+    uint8_t sec;                        // 10: s
+    union {
+        uint8_t valid;                  // 11
+        struct {
+            uint8_t validDate : 1;          // bit 0
+            uint8_t validTime : 1;          // bit 1
+            uint8_t fullyResolved : 1;      // bit 2
+            uint8_t validMag : 1;           // bit 3
+            uint8_t : 4;
+        };
+    };
+    uint32_t tAcc;                      // 12: ns
+    int32_t nano;                       // 16: ns
+    uint8_t fixType;                    // 20
+    union {
+        uint8_t flags;                  // 21
+        struct {
+            uint8_t gnssFixOK : 1;          // bit 0
+            uint8_t diffSoln : 1;           // bit 1
+            uint8_t psmState : 3;           // bit 2..4
+            uint8_t headVehValid : 1;       // bit 5
+            uint8_t carrSoln : 2;           // bit 6..7
+        };
+    };
+    union {
+        uint8_t flags2;                 // 22
+        struct {
+            uint8_t : 5;
+            uint8_t confirmedAvai : 1;      // bit 5
+            uint8_t confirmedDate : 1;      // bit 6
+            uint8_t confirmedTime : 1;      // bit 7
+        };
+    };
+    uint8_t numSV;                      // 23
+    int32_t lon;                        // 24: deg, *1e-7
+    int32_t lat;                        // 28: deg, *1e-7
+    int32_t height;                     // 32: mm
+    int32_t hMSL;                       // 36: mm
+    uint32_t hAcc;                      // 40: mm
+    uint32_t vAcc;                      // 44: mm
+    int32_t velN;                       // 48: mm/s
+    int32_t velE;                       // 52: mm/s
+    int32_t velD;                       // 56: mm/s
+    int32_t gSpeed;                     // 60: mm/s
+    int32_t headMot;                    // 64: deg, *1e-5
+    uint32_t sAcc;                      // 68: mm/s
+    uint32_t headAcc;                   // 72: deg, *1e-5
+    uint16_t pDOP;                      // 76: *0.01
+    union {
+        uint16_t flags3;                // 78
+        struct {
+            uint16_t invalidLlh : 1;        // bit 0
+            uint16_t lastCorrectionAge : 4; // bit 1..4
+            uint16_t : 8;
+            uint16_t authTime : 1;          // bit 13
+            uint16_t nmaFixStatus : 1;      // bit 14
+            uint16_t : 1;
+        };
+    };
+    uint8_t reserved0[4];               // 80
+    int32_t headVeh;                    // 84: deg, *1e-5
+    int16_t magDec;                     // 88: deg, *1e-2
+    uint16_t magAcc;                    // 90: deg, *1e-2
+} ubx_nav_pvt_data1_t;
+UBX_PAYLOAD_SIZE(ubx_nav_pvt_data1_t, 92);
+
+#define UBX_NAV_PVT_DATA1(payload)              ((const ubx_nav_pvt_data1_t *)(payload))
+#define UBX_NAV_PVT_DATA1_SIZE                  92
+#define UBX_NAV_PVT_DATA1_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x01, 0x07, ubx_nav_pvt_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-ODO-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_nav_odo_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_odo_poll0_t, 0);
+
+#define UBX_NAV_ODO_POLL0(payload)              ((const ubx_nav_odo_poll0_t *)(payload))
+#define UBX_NAV_ODO_POLL0_SIZE                  0
+#define UBX_NAV_ODO_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x01, 0x09, ubx_nav_odo_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-ODO-DATA0 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0[3];               // 1
+    uint32_t iTOW;                      // 4: ms
+    uint32_t distance;                  // 8: m
+    uint32_t totalDistance;             // 12: m
+    uint32_t distanceStd;               // 16: m
+} ubx_nav_odo_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_odo_data0_t, 20);
+
+#define UBX_NAV_ODO_DATA0(payload)              ((const ubx_nav_odo_data0_t *)(payload))
+#define UBX_NAV_ODO_DATA0_SIZE                  20
+#define UBX_NAV_ODO_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x01, 0x09, ubx_nav_odo_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-RESETODO-DATA0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_nav_resetodo_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_resetodo_data0_t, 0);
+
+#define UBX_NAV_RESETODO_DATA0(payload)         ((const ubx_nav_resetodo_data0_t *)(payload))
+#define UBX_NAV_RESETODO_DATA0_SIZE             0
+#define UBX_NAV_RESETODO_DATA0_TYPED(name, ...) UBX_MESSAGE_TYPED(name, 0x01, 0x10, ubx_nav_resetodo_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-VELECEF-DATA0 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    int32_t ecefVX;                     // 4: cm/s
+    int32_t ecefVY;                     // 8: cm/s
+    int32_t ecefVZ;                     // 12: cm/s
+    uint32_t sAcc;                      // 16: cm/s
+} ubx_nav_velecef_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_velecef_data0_t, 20);
+
+#define UBX_NAV_VELECEF_DATA0(payload)          ((const ubx_nav_velecef_data0_t *)(payload))
+#define UBX_NAV_VELECEF_DATA0_SIZE              20
+#define UBX_NAV_VELECEF_DATA0_TYPED(name, ...)  UBX_MESSAGE_TYPED(name, 0x01, 0x11, ubx_nav_velecef_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-VELNED-DATA0 payload (36 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    int32_t velN;                       // 4: cm/s
+    int32_t velE;                       // 8: cm/s
+    int32_t velD;                       // 12: cm/s
+    uint32_t speed;                     // 16: cm/s
+    uint32_t gSpeed;                    // 20: cm/s
+    int32_t heading;                    // 24: deg, *1e-5
+    uint32_t sAcc;                      // 28: cm/s
+    uint32_t cAcc;                      // 32: deg, *1e-5
+} ubx_nav_velned_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_velned_data0_t, 36);
+
+#define UBX_NAV_VELNED_DATA0(payload)           ((const ubx_nav_velned_data0_t *)(payload))
+#define UBX_NAV_VELNED_DATA0_SIZE               36
+#define UBX_NAV_VELNED_DATA0_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, 0x01, 0x12, ubx_nav_velned_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-HPPOSECEF-DATA0 payload (28 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0[3];               // 1
+    uint32_t iTOW;                      // 4: ms
+    int32_t ecefX;                      // 8: cm
+    int32_t ecefY;                      // 12: cm
+    int32_t ecefZ;                      // 16: cm
+    int8_t ecefXHp;                     // 20: mm, *0.1
+    int8_t ecefYHp;                     // 21: mm, *0.1
+    int8_t ecefZHp;                     // 22: mm, *0.1
+    union {
+        uint8_t flags;                  // 23
+        struct {
+            uint8_t invalidEcef : 1;        // bit 0
+            uint8_t : 7;
+        };
+    };
+    uint32_t pAcc;                      // 24: mm, *0.1
+} ubx_nav_hpposecef_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_hpposecef_data0_t, 28);
+
+#define UBX_NAV_HPPOSECEF_DATA0(payload)        ((const ubx_nav_hpposecef_data0_t *)(payload))
+#define UBX_NAV_HPPOSECEF_DATA0_SIZE            28
+#define UBX_NAV_HPPOSECEF_DATA0_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x01, 0x13, ubx_nav_hpposecef_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-HPPOSLLH-DATA0 payload (36 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0[2];               // 1
+    union {
+        uint8_t flags;                  // 3
+        struct {
+            uint8_t invalidLlh : 1;         // bit 0
+            uint8_t : 7;
+        };
+    };
+    uint32_t iTOW;                      // 4: ms
+    int32_t lon;                        // 8: deg, *1e-7
+    int32_t lat;                        // 12: deg, *1e-7
+    int32_t height;                     // 16: mm
+    int32_t hMSL;                       // 20: mm
+    int8_t lonHp;                       // 24: deg, *1e-9
+    int8_t latHp;                       // 25: deg, *1e-9
+    int8_t heightHp;                    // 26: mm, *0.1
+    int8_t hMSLHp;                      // 27: mm, *0.1
+    uint32_t hAcc;                      // 28: mm, *0.1
+    uint32_t vAcc;                      // 32: mm, *0.1
+} ubx_nav_hpposllh_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_hpposllh_data0_t, 36);
+
+#define UBX_NAV_HPPOSLLH_DATA0(payload)         ((const ubx_nav_hpposllh_data0_t *)(payload))
+#define UBX_NAV_HPPOSLLH_DATA0_SIZE             36
+#define UBX_NAV_HPPOSLLH_DATA0_TYPED(name, ...) UBX_MESSAGE_TYPED(name, 0x01, 0x14, ubx_nav_hpposllh_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-PVAT-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_nav_pvat_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_pvat_poll0_t, 0);
+
+#define UBX_NAV_PVAT_POLL0(payload)             ((const ubx_nav_pvat_poll0_t *)(payload))
+#define UBX_NAV_PVAT_POLL0_SIZE                 0
+#define UBX_NAV_PVAT_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x01, 0x17, ubx_nav_pvat_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-PVAT-DATA0 payload (116 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t version;                    // 4
+    union {
+        uint8_t valid;                  // 5
+        struct {
+            uint8_t validDate : 1;          // bit 0
+            uint8_t validTime : 1;          // bit 1
+            uint8_t fullyResolved : 1;      // bit 2
+            uint8_t validMag : 1;           // bit 3
+            uint8_t : 4;
+        };
+    };
+    uint16_t year;                      // 6: y
+    uint8_t month;                      // 8: month
+    uint8_t day;                        // 9: d
+    uint8_t hour;                       // 10: h
+    uint8_t min;                        // 11: min
+    uint8_t sec;                        // 12: s
+    uint8_t reserved0;                  // 13
+    uint8_t reserved1[2];               // 14
+    uint32_t tAcc;                      // 16: ns
+    int32_t nano;                       // 20: ns
+    uint8_t fixType;                    // 24
+    union {
+        uint8_t flags;                  // 25
+        struct {
+            uint8_t gnssFixOK : 1;          // bit 0
+            uint8_t diffSoln : 1;           // bit 1
+            uint8_t : 1;
+            uint8_t vehRollValid : 1;       // bit 3
+            uint8_t vehPitchValid : 1;      // bit 4
+            uint8_t vehHeadingValid : 1;    // bit 5
+            uint8_t carrSoln : 2;           // bit 6..7
+        };
+    };
+    union {
+        uint8_t flags2;                 // 26
+        struct {
+            uint8_t : 5;
+            uint8_t confirmedAvai : 1;      // bit 5
+            uint8_t confirmedDate : 1;      // bit 6
+            uint8_t confirmedTime : 1;      // bit 7
+        };
+    };
+    uint8_t numSV;                      // 27
+    int32_t lon;                        // 28: deg, *1e-7
+    int32_t lat;                        // 32: deg, *1e-7
+    int32_t height;                     // 36: mm
+    int32_t hMSL;                       // 40: mm
+    uint32_t hAcc;                      // 44: mm
+    uint32_t vAcc;                      // 48: mm
+    int32_t velN;                       // 52: mm/s
+    int32_t velE;                       // 56: mm/s
+    int32_t velD;                       // 60: mm/s
+    int32_t gSpeed;                     // 64: mm/s
+    uint32_t sAcc;                      // 68: mm/s
+    int32_t vehRoll;                    // 72: deg, *1e-5
+    int32_t vehPitch;                   // 76: deg, *1e-5
+    int32_t vehHeading;                 // 80: deg, *1e-5
+    int32_t motHeading;                 // 84: deg, *1e-5
+    uint16_t accRoll;                   // 88: deg, *1e-2
+    uint16_t accPitch;                  // 90: deg, *1e-2
+    uint16_t accHeading;                // 92: deg, *1e-2
+    int16_t magDec;                     // 94: deg, *1e-2
+    uint16_t magAcc;                    // 96: deg, *1e-2
+    uint16_t errEllipseOrient;          // 98: deg, *1e-2
+    uint32_t errEllipseMajor;           // 100: mm
+    uint32_t errEllipseMinor;           // 104: mm
+    uint8_t reserved2[4];               // 108
+    uint8_t reserved3[4];               // 112
+} ubx_nav_pvat_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_pvat_data0_t, 116);
+
+#define UBX_NAV_PVAT_DATA0(payload)             ((const ubx_nav_pvat_data0_t *)(payload))
+#define UBX_NAV_PVAT_DATA0_SIZE                 116
+#define UBX_NAV_PVAT_DATA0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x01, 0x17, ubx_nav_pvat_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-TIMEGPS-DATA0 payload (16 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    int32_t fTOW;                       // 4: ns
+    int16_t week;                       // 8
+    int8_t leapS;                       // 10: s
+    union {
+        uint8_t valid;                  // 11
+        struct {
+            uint8_t towValid : 1;           // bit 0
+            uint8_t weekValid : 1;          // bit 1
+            uint8_t leapSValid : 1;         // bit 2
+            uint8_t : 5;
+        };
+    };
+    uint32_t tAcc;                      // 12: ns
+} ubx_nav_timegps_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_timegps_data0_t, 16);
+
+#define UBX_NAV_TIMEGPS_DATA0(payload)          ((const ubx_nav_timegps_data0_t *)(payload))
+#define UBX_NAV_TIMEGPS_DATA0_SIZE              16
+#define UBX_NAV_TIMEGPS_DATA0_TYPED(name, ...)  UBX_MESSAGE_TYPED(name, 0x01, 0x20, ubx_nav_timegps_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-TIMEUTC-DATA0 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint32_t tAcc;                      // 4: ns
+    int32_t nano;                       // 8: ns
+    uint16_t year;                      // 12: y
+    uint8_t month;                      // 14: month
+    uint8_t day;                        // 15: d
+    uint8_t hour;                       // 16: h
+    uint8_t min;                        // 17: min
+    uint8_t sec;                        // 18: s
+    union {
+        uint8_t valid;                  // 19
+        struct {
+            uint8_t validTOW : 1;           // bit 0
+            uint8_t validWKN : 1;           // bit 1
+            uint8_t validUTC : 1;           // bit 2
+            uint8_t authStatus : 1;         // bit 3
+            uint8_t utcStandard : 4;        // bit 4..7
+        };
+    };
+} ubx_nav_timeutc_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_timeutc_data0_t, 20);
+
+#define UBX_NAV_TIMEUTC_DATA0(payload)          ((const ubx_nav_timeutc_data0_t *)(payload))
+#define UBX_NAV_TIMEUTC_DATA0_SIZE              20
+#define UBX_NAV_TIMEUTC_DATA0_TYPED(name, ...)  UBX_MESSAGE_TYPED(name, 0x01, 0x21, ubx_nav_timeutc_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-CLOCK-DATA0 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    int32_t clkB;                       // 4: ns
+    int32_t clkD;                       // 8: ns/s
+    uint32_t tAcc;                      // 12: ns
+    uint32_t fAcc;                      // 16: ps/s
+} ubx_nav_clock_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_clock_data0_t, 20);
+
+#define UBX_NAV_CLOCK_DATA0(payload)            ((const ubx_nav_clock_data0_t *)(payload))
+#define UBX_NAV_CLOCK_DATA0_SIZE                20
+#define UBX_NAV_CLOCK_DATA0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x01, 0x22, ubx_nav_clock_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-TIMEGLO-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_nav_timeglo_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_timeglo_poll0_t, 0);
+
+#define UBX_NAV_TIMEGLO_POLL0(payload)          ((const ubx_nav_timeglo_poll0_t *)(payload))
+#define UBX_NAV_TIMEGLO_POLL0_SIZE              0
+#define UBX_NAV_TIMEGLO_POLL0_TYPED(name, ...)  UBX_MESSAGE_TYPED(name, 0x01, 0x23, ubx_nav_timeglo_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-TIMEGLO-DATA0 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint32_t TOD;                       // 4: s
+    int32_t fTOD;                       // 8: ns
+    uint16_t Nt;                        // 12: days
+    uint8_t N4;                         // 14
+    union {
+        uint8_t valid;                  // 15
+        struct {
+            uint8_t todValid : 1;           // bit 0
+            uint8_t dateValid : 1;          // bit 1
+            uint8_t : 6;
+        };
+    };
+    uint32_t tAcc;                      // 16: ns
+} ubx_nav_timeglo_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_timeglo_data0_t, 20);
+
+#define UBX_NAV_TIMEGLO_DATA0(payload)          ((const ubx_nav_timeglo_data0_t *)(payload))
+#define UBX_NAV_TIMEGLO_DATA0_SIZE              20
+#define UBX_NAV_TIMEGLO_DATA0_TYPED(name, ...)  UBX_MESSAGE_TYPED(name, 0x01, 0x23, ubx_nav_timeglo_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-TIMEBDS-DATA0 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint32_t SOW;                       // 4: s
+    int32_t fSOW;                       // 8: ns
+    int16_t week;                       // 12
+    int8_t leapS;                       // 14: s
+    union {
+        uint8_t valid;                  // 15
+        struct {
+            uint8_t sowValid : 1;           // bit 0
+            uint8_t weekValid : 1;          // bit 1
+            uint8_t leapSValid : 1;         // bit 2
+            uint8_t : 5;
+        };
+    };
+    uint32_t tAcc;                      // 16: ns
+} ubx_nav_timebds_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_timebds_data0_t, 20);
+
+#define UBX_NAV_TIMEBDS_DATA0(payload)          ((const ubx_nav_timebds_data0_t *)(payload))
+#define UBX_NAV_TIMEBDS_DATA0_SIZE              20
+#define UBX_NAV_TIMEBDS_DATA0_TYPED(name, ...)  UBX_MESSAGE_TYPED(name, 0x01, 0x24, ubx_nav_timebds_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-TIMEGAL-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_nav_timegal_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_timegal_poll0_t, 0);
+
+#define UBX_NAV_TIMEGAL_POLL0(payload)          ((const ubx_nav_timegal_poll0_t *)(payload))
+#define UBX_NAV_TIMEGAL_POLL0_SIZE              0
+#define UBX_NAV_TIMEGAL_POLL0_TYPED(name, ...)  UBX_MESSAGE_TYPED(name, 0x01, 0x25, ubx_nav_timegal_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-TIMEGAL-DATA0 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint32_t galTow;                    // 4: s
+    int32_t fGalTow;                    // 8: ns
+    int16_t galWno;                     // 12
+    int8_t leapS;                       // 14: s
+    union {
+        uint8_t valid;                  // 15
+        struct {
+            uint8_t galTowValid : 1;        // bit 0
+            uint8_t galWnoValid : 1;        // bit 1
+            uint8_t leapSValid : 1;         // bit 2
+            uint8_t : 5;
+        };
+    };
+    uint32_t tAcc;                      // 16: ns
+} ubx_nav_timegal_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_timegal_data0_t, 20);
+
+#define UBX_NAV_TIMEGAL_DATA0(payload)          ((const ubx_nav_timegal_data0_t *)(payload))
+#define UBX_NAV_TIMEGAL_DATA0_SIZE              20
+#define UBX_NAV_TIMEGAL_DATA0_TYPED(name, ...)  UBX_MESSAGE_TYPED(name, 0x01, 0x25, ubx_nav_timegal_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-TIMELS-DATA0 payload (24 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t version;                    // 4
+    uint8_t reserved0[3];               // 5
+    uint8_t srcOfCurrLs;                // 8
+    int8_t currLs;                      // 9: s
+    uint8_t srcOfLsChange;              // 10
+    int8_t lsChange;                    // 11: s
+    int32_t timeToLsEvent;              // 12: s
+    uint16_t dateOfLsGpsWn;             // 16
+    uint16_t dateOfLsGpsDn;             // 18
+    uint8_t reserved1[3];               // 20
+    union {
+        uint8_t valid;                  // 23
+        struct {
+            uint8_t validCurrLs : 1;        // bit 0
+            uint8_t validTimeToLsEvent : 1; // bit 1
+            uint8_t : 6;
+        };
+    };
+} ubx_nav_timels_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_timels_data0_t, 24);
+
+#define UBX_NAV_TIMELS_DATA0(payload)           ((const ubx_nav_timels_data0_t *)(payload))
+#define UBX_NAV_TIMELS_DATA0_SIZE               24
+#define UBX_NAV_TIMELS_DATA0_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, 0x01, 0x26, ubx_nav_timels_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-TIMEQZSS-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_nav_timeqzss_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_timeqzss_poll0_t, 0);
+
+#define UBX_NAV_TIMEQZSS_POLL0(payload)         ((const ubx_nav_timeqzss_poll0_t *)(payload))
+#define UBX_NAV_TIMEQZSS_POLL0_SIZE             0
+#define UBX_NAV_TIMEQZSS_POLL0_TYPED(name, ...) UBX_MESSAGE_TYPED(name, 0x01, 0x27, ubx_nav_timeqzss_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-TIMEQZSS-DATA0 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint32_t qzssTow;                   // 4: s
+    int32_t fQzssTow;                   // 8: ns
+    int16_t qzssWno;                    // 12
+    int8_t leapS;                       // 14: s
+    union {
+        uint8_t valid;                  // 15
+        struct {
+            uint8_t qzssTowValid : 1;       // bit 0
+            uint8_t qzssWnoValid : 1;       // bit 1
+            uint8_t leapSValid : 1;         // bit 2
+            uint8_t : 5;
+        };
+    };
+    uint32_t tAcc;                      // 16: ns
+} ubx_nav_timeqzss_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_timeqzss_data0_t, 20);
+
+#define UBX_NAV_TIMEQZSS_DATA0(payload)         ((const ubx_nav_timeqzss_data0_t *)(payload))
+#define UBX_NAV_TIMEQZSS_DATA0_SIZE             20
+#define UBX_NAV_TIMEQZSS_DATA0_TYPED(name, ...) UBX_MESSAGE_TYPED(name, 0x01, 0x27, ubx_nav_timeqzss_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-NMI-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_nav_nmi_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_nmi_poll0_t, 0);
+
+#define UBX_NAV_NMI_POLL0(payload)              ((const ubx_nav_nmi_poll0_t *)(payload))
+#define UBX_NAV_NMI_POLL0_SIZE                  0
+#define UBX_NAV_NMI_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x01, 0x28, ubx_nav_nmi_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-NMI-DATA0 payload (16 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t version;                    // 4
+    uint8_t reserved0[4];               // 5
+    union {
+        uint8_t gpsNmiFlags;            // 9
+        struct {
+            uint8_t wnoCheckedGPS : 1;      // bit 0
+            uint8_t wnoInvalidGPS : 1;      // bit 1
+            uint8_t UTCORefCheckedGPS : 1;  // bit 2
+            uint8_t UTCORefInvalidGPS : 1;  // bit 3
+            uint8_t : 4;
+        };
+    };
+    union {
+        uint8_t gpsLsFlags;             // 10
+        struct {
+            uint8_t lsValGPS : 1;           // bit 0
+            uint8_t dnRangeGPS : 1;         // bit 1
+            uint8_t totRangeGPS : 1;        // bit 2
+            uint8_t lsEventGPS : 1;         // bit 3
+            uint8_t recNowGPS : 1;          // bit 4
+            uint8_t : 3;
+        };
+    };
+    union {
+        uint8_t galNmiFlags;            // 11
+        struct {
+            uint8_t wnoCheckedGAL : 1;      // bit 0
+            uint8_t wnoInvalidGAL : 1;      // bit 1
+            uint8_t : 6;
+        };
+    };
+    union {
+        uint8_t galLsFlags;             // 12
+        struct {
+            uint8_t lsValGAL : 1;           // bit 0
+            uint8_t dnRangeGAL : 1;         // bit 1
+            uint8_t totRangeGAL : 1;        // bit 2
+            uint8_t lsEventGAL : 1;         // bit 3
+            uint8_t recNowGAL : 1;          // bit 4
+            uint8_t : 3;
+        };
+    };
+    union {
+        uint8_t bdsNmiFlags;            // 13
+        struct {
+            uint8_t wnoCheckedBDS : 1;      // bit 0
+            uint8_t wnoInvalidBDS : 1;      // bit 1
+            uint8_t : 6;
+        };
+    };
+    union {
+        uint8_t bdsLsFlags;             // 14
+        struct {
+            uint8_t lsValBDS : 1;           // bit 0
+            uint8_t dnRangeBDS : 1;         // bit 1
+            uint8_t totRangeBDS : 1;        // bit 2
+            uint8_t lsEventBDS : 1;         // bit 3
+            uint8_t recNowBDS : 1;          // bit 4
+            uint8_t : 3;
+        };
+    };
+    union {
+        uint8_t gloNmiFlags;            // 15
+        struct {
+            uint8_t wnoCheckedGLO : 1;      // bit 0
+            uint8_t wnoInvalidGLO : 1;      // bit 1
+            uint8_t : 6;
+        };
+    };
+} ubx_nav_nmi_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_nmi_data0_t, 16);
+
+#define UBX_NAV_NMI_DATA0(payload)              ((const ubx_nav_nmi_data0_t *)(payload))
+#define UBX_NAV_NMI_DATA0_SIZE                  16
+#define UBX_NAV_NMI_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x01, 0x28, ubx_nav_nmi_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-SVINFO-DATA0 chan (12 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t chn;                        // 0
+    uint8_t svid;                       // 1
+    union {
+        uint8_t flags;                  // 2
+        struct {
+            uint8_t svUsed : 1;             // bit 0
+            uint8_t diffCorr : 1;           // bit 1
+            uint8_t orbitAvail : 1;         // bit 2
+            uint8_t orbitEph : 1;           // bit 3
+            uint8_t unhealthy : 1;          // bit 4
+            uint8_t orbitAlm : 1;           // bit 5
+            uint8_t orbitAop : 1;           // bit 6
+            uint8_t smoothed : 1;           // bit 7
+        };
+    };
+    union {
+        uint8_t quality;                // 3
+        struct {
+            uint8_t qualityInd : 4;         // bit 0..3
+            uint8_t : 4;
+        };
+    };
+    uint8_t cno;                        // 4: dBHz
+    int8_t elev;                        // 5: deg
+    int16_t azim;                       // 6: deg
+    int32_t prRes;                      // 8: cm
+} ubx_nav_svinfo_data0_chan_t;
+UBX_PAYLOAD_SIZE(ubx_nav_svinfo_data0_chan_t, 12);
+
+// UBX-NAV-SVINFO-DATA0 payload (8 + numCh*12 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t numCh;                      // 4
+    union {
+        uint8_t globalFlags;            // 5
+        struct {
+            uint8_t chipGen : 3;            // bit 0..2
+            uint8_t : 5;
+        };
+    };
+    uint8_t reserved0[2];               // 6
+    ubx_nav_svinfo_data0_chan_t chan[]; // 8: repeated
+} ubx_nav_svinfo_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_svinfo_data0_t, 8);
+
+#define UBX_NAV_SVINFO_DATA0(payload)           ((const ubx_nav_svinfo_data0_t *)(payload))
+#define UBX_NAV_SVINFO_DATA0_SIZE               8
+#define UBX_NAV_SVINFO_DATA0_CHAN(payload, i)   ((const ubx_nav_svinfo_data0_chan_t *)((const uint8_t *)(payload) + 8 + (size_t)(i) * 12))
+#define UBX_NAV_SVINFO_DATA0_CHAN_COUNT(payload, len) \
+    ((size_t)(len) <= 8 ? 0 : (size_t)UBX_NAV_SVINFO_DATA0(payload)->numCh < ((size_t)(len) - 8) / 12 ? (size_t)UBX_NAV_SVINFO_DATA0(payload)->numCh : ((size_t)(len) - 8) / 12)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-DGPS-DATA0 channels (12 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t svid;                       // 0
+    union {
+        uint8_t flags;                  // 1
+        struct {
+            uint8_t channel : 4;            // bit 0..3
+            uint8_t dgpsUsed : 1;           // bit 4
+            uint8_t : 3;
+        };
+    };
+    uint16_t ageC;                      // 2: ms
+    float prc;                          // 4: m
+    float prrc;                         // 8: m/s
+} ubx_nav_dgps_data0_channels_t;
+UBX_PAYLOAD_SIZE(ubx_nav_dgps_data0_channels_t, 12);
+
+// UBX-NAV-DGPS-DATA0 payload (16 + numCh*12 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    int32_t age;                        // 4: ms
+    int16_t baseId;                     // 8
+    int16_t baseHealth;                 // 10
+    uint8_t numCh;                      // 12
+    uint8_t status;                     // 13
+    uint8_t reserved0[2];               // 14
+    ubx_nav_dgps_data0_channels_t channels[];// 16: repeated
+} ubx_nav_dgps_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_dgps_data0_t, 16);
+
+#define UBX_NAV_DGPS_DATA0(payload)             ((const ubx_nav_dgps_data0_t *)(payload))
+#define UBX_NAV_DGPS_DATA0_SIZE                 16
+#define UBX_NAV_DGPS_DATA0_CHANNELS(payload, i) ((const ubx_nav_dgps_data0_channels_t *)((const uint8_t *)(payload) + 16 + (size_t)(i) * 12))
+#define UBX_NAV_DGPS_DATA0_CHANNELS_COUNT(payload, len) \
+    ((size_t)(len) <= 16 ? 0 : (size_t)UBX_NAV_DGPS_DATA0(payload)->numCh < ((size_t)(len) - 16) / 12 ? (size_t)UBX_NAV_DGPS_DATA0(payload)->numCh : ((size_t)(len) - 16) / 12)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-SBAS-DATA0 svs (12 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t svid;                       // 0
+    uint8_t reserved1;                  // 1
+    uint8_t udre;                       // 2
+    uint8_t svSys;                      // 3
+    uint8_t svService;                  // 4
+    uint8_t reserved2;                  // 5
+    int16_t prc;                        // 6: cm
+    uint8_t reserved3[2];               // 8
+    int16_t ic;                         // 10: cm
+} ubx_nav_sbas_data0_svs_t;
+UBX_PAYLOAD_SIZE(ubx_nav_sbas_data0_svs_t, 12);
+
+// UBX-NAV-SBAS-DATA0 payload (12 + cnt*12 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t geo;                        // 4
+    uint8_t mode;                       // 5
+    int8_t sys;                         // 6
+    union {
+        uint8_t service;                // 7
+        struct {
+            uint8_t Ranging : 1;            // bit 0
+            uint8_t Corrections : 1;        // bit 1
+            uint8_t Integrity : 1;          // bit 2
+            uint8_t Testmode : 1;           // bit 3
+            uint8_t Bad : 1;                // bit 4
+            uint8_t : 3;
+        };
+    };
+    uint8_t cnt;                        // 8
+    union {
+        uint8_t statusFlags;            // 9
+        struct {
+            uint8_t integrityUsed : 2;      // bit 0..1
+            uint8_t : 6;
+        };
+    };
+    uint8_t reserved0[2];               // 10
+    ubx_nav_sbas_data0_svs_t svs[];     // 12: repeated
+} ubx_nav_sbas_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_sbas_data0_t, 12);
+
+#define UBX_NAV_SBAS_DATA0(payload)             ((const ubx_nav_sbas_data0_t *)(payload))
+#define UBX_NAV_SBAS_DATA0_SIZE                 12
+#define UBX_NAV_SBAS_DATA0_SVS(payload, i)      ((const ubx_nav_sbas_data0_svs_t *)((const uint8_t *)(payload) + 12 + (size_t)(i) * 12))
+#define UBX_NAV_SBAS_DATA0_SVS_COUNT(payload, len) \
+    ((size_t)(len) <= 12 ? 0 : (size_t)UBX_NAV_SBAS_DATA0(payload)->cnt < ((size_t)(len) - 12) / 12 ? (size_t)UBX_NAV_SBAS_DATA0(payload)->cnt : ((size_t)(len) - 12) / 12)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-ORB-DATA0 svInfo (6 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t gnssId;                     // 0
+    uint8_t svId;                       // 1
+    union {
+        uint8_t svFlag;                 // 2
+        struct {
+            uint8_t health : 2;             // bit 0..1
+            uint8_t visibility : 2;         // bit 2..3
+            uint8_t : 4;
+        };
+    };
+    union {
+        uint8_t eph;                    // 3
+        struct {
+            uint8_t ephUsability : 5;       // bit 0..4
+            uint8_t ephSource : 3;          // bit 5..7
+        };
+    };
+    union {
+        uint8_t alm;                    // 4
+        struct {
+            uint8_t almUsability : 5;       // bit 0..4
+            uint8_t almSource : 3;          // bit 5..7
+        };
+    };
+    union {
+        uint8_t otherOrb;               // 5
+        struct {
+            uint8_t anoAopUsability : 5;    // bit 0..4
+            uint8_t type : 3;               // bit 5..7
+        };
+    };
+} ubx_nav_orb_data0_svinfo_t;
+UBX_PAYLOAD_SIZE(ubx_nav_orb_data0_svinfo_t, 6);
+
+// UBX-NAV-ORB-DATA0 payload (8 + numSv*6 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t version;                    // 4
+    uint8_t numSv;                      // 5
+    uint8_t reserved0[2];               // 6
+    ubx_nav_orb_data0_svinfo_t svInfo[];// 8: repeated
+} ubx_nav_orb_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_orb_data0_t, 8);
+
+#define UBX_NAV_ORB_DATA0(payload)              ((const ubx_nav_orb_data0_t *)(payload))
+#define UBX_NAV_ORB_DATA0_SIZE                  8
+#define UBX_NAV_ORB_DATA0_SVINFO(payload, i)    ((const ubx_nav_orb_data0_svinfo_t *)((const uint8_t *)(payload) + 8 + (size_t)(i) * 6))
+#define UBX_NAV_ORB_DATA0_SVINFO_COUNT(payload, len) \
+    ((size_t)(len) <= 8 ? 0 : (size_t)UBX_NAV_ORB_DATA0(payload)->numSv < ((size_t)(len) - 8) / 6 ? (size_t)UBX_NAV_ORB_DATA0(payload)->numSv : ((size_t)(len) - 8) / 6)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-SAT-DATA0 sv (12 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t gnssId;                     // 0
+    uint8_t svId;                       // 1
+    uint8_t cno;                        // 2: dBHz
+    int8_t elev;                        // 3: deg
+    int16_t azim;                       // 4: deg
+    int16_t prRes;                      // 6: m, *0.1
+    union {
+        uint32_t flags;                 // 8
+        struct {
+            uint32_t qualityInd : 3;        // bit 0..2
+            uint32_t svUsed : 1;            // bit 3
+            uint32_t health : 2;            // bit 4..5
+            uint32_t diffCorr : 1;          // bit 6
+            uint32_t smoothed : 1;          // bit 7
+            uint32_t orbitSource : 3;       // bit 8..10
+            uint32_t ephAvail : 1;          // bit 11
+            uint32_t almAvail : 1;          // bit 12
+            uint32_t anoAvail : 1;          // bit 13
+            uint32_t aopAvail : 1;          // bit 14
+            uint32_t : 1;
+            uint32_t sbasCorrUsed : 1;      // bit 16
+            uint32_t rtcmCorrUsed : 1;      // bit 17
+            uint32_t slasCorrUsed : 1;      // bit 18
+            uint32_t spartnCorrUsed : 1;    // bit 19
+            uint32_t prCorrUsed : 1;        // bit 20
+            uint32_t crCorrUsed : 1;        // bit 21
+            uint32_t doCorrUsed : 1;        // bit 22
+            uint32_t clasCorrUsed : 1;      // bit 23
+            uint32_t lppCorrUsed : 1;       // bit 24
+            uint32_t hasCorrUsed : 1;       // bit 25
+            uint32_t : 6;
+        };
+    };
+} ubx_nav_sat_data0_sv_t;
+UBX_PAYLOAD_SIZE(ubx_nav_sat_data0_sv_t, 12);
+
+// UBX-NAV-SAT-DATA0 payload (8 + numSvs*12 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t version;                    // 4
+    uint8_t numSvs;                     // 5
+    uint8_t reserved0[2];               // 6
+    ubx_nav_sat_data0_sv_t sv[];        // 8: repeated
+} ubx_nav_sat_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_sat_data0_t, 8);
+
+#define UBX_NAV_SAT_DATA0(payload)              ((const ubx_nav_sat_data0_t *)(payload))
+#define UBX_NAV_SAT_DATA0_SIZE                  8
+#define UBX_NAV_SAT_DATA0_SV(payload, i)        ((const ubx_nav_sat_data0_sv_t *)((const uint8_t *)(payload) + 8 + (size_t)(i) * 12))
+#define UBX_NAV_SAT_DATA0_SV_COUNT(payload, len) \
+    ((size_t)(len) <= 8 ? 0 : (size_t)UBX_NAV_SAT_DATA0(payload)->numSvs < ((size_t)(len) - 8) / 12 ? (size_t)UBX_NAV_SAT_DATA0(payload)->numSvs : ((size_t)(len) - 8) / 12)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-COV-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_nav_cov_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_cov_poll0_t, 0);
+
+#define UBX_NAV_COV_POLL0(payload)              ((const ubx_nav_cov_poll0_t *)(payload))
+#define UBX_NAV_COV_POLL0_SIZE                  0
+#define UBX_NAV_COV_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x01, 0x36, ubx_nav_cov_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-COV-DATA0 payload (64 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t version;                    // 4
+    uint8_t posCovValid;                // 5
+    uint8_t velCovValid;                // 6
+    uint8_t reserved0[9];               // 7
+    float posCovNN;                     // 16: m^2
+    float posCovNE;                     // 20: m^2
+    float posCovND;                     // 24: m^2
+    float posCovEE;                     // 28: m^2
+    float posCovED;                     // 32: m^2
+    float posCovDD;                     // 36: m^2
+    float velCovNN;                     // 40: m^2/s^2
+    float velCovNE;                     // 44: m^2/s^2
+    float velCovND;                     // 48: m^2/s^2
+    float velCovEE;                     // 52: m^2/s^2
+    float velCovED;                     // 56: m^2/s^2
+    float velCovDD;                     // 60: m^2/s^2
+} ubx_nav_cov_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_cov_data0_t, 64);
+
+#define UBX_NAV_COV_DATA0(payload)              ((const ubx_nav_cov_data0_t *)(payload))
+#define UBX_NAV_COV_DATA0_SIZE                  64
+#define UBX_NAV_COV_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x01, 0x36, ubx_nav_cov_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-GEOFENCE-DATA0 fences (2 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t state;                      // 0
+    uint8_t id;                         // 1
+} ubx_nav_geofence_data0_fences_t;
+UBX_PAYLOAD_SIZE(ubx_nav_geofence_data0_fences_t, 2);
+
+// UBX-NAV-GEOFENCE-DATA0 payload (8 + numFences*2 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t version;                    // 4
+    uint8_t status;                     // 5
+    uint8_t numFences;                  // 6
+    uint8_t combState;                  // 7
+    ubx_nav_geofence_data0_fences_t fences[];// 8: repeated
+} ubx_nav_geofence_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_geofence_data0_t, 8);
+
+#define UBX_NAV_GEOFENCE_DATA0(payload)         ((const ubx_nav_geofence_data0_t *)(payload))
+#define UBX_NAV_GEOFENCE_DATA0_SIZE             8
+#define UBX_NAV_GEOFENCE_DATA0_FENCES(payload, i)((const ubx_nav_geofence_data0_fences_t *)((const uint8_t *)(payload) + 8 + (size_t)(i) * 2))
+#define UBX_NAV_GEOFENCE_DATA0_FENCES_COUNT(payload, len) \
+    ((size_t)(len) <= 8 ? 0 : (size_t)UBX_NAV_GEOFENCE_DATA0(payload)->numFences < ((size_t)(len) - 8) / 2 ? (size_t)UBX_NAV_GEOFENCE_DATA0(payload)->numFences : ((size_t)(len) - 8) / 2)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-DGNSS-DATA0 measurements (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t gnssId;                     // 0
+    uint8_t svId;                       // 1
+    uint8_t sigId;                      // 2
+    union {
+        uint8_t flags;                  // 3
+        struct {
+            uint8_t channel : 4;            // bit 0..3
+            uint8_t prUsed : 1;             // bit 4
+            uint8_t : 1;
+            uint8_t crUsed : 1;             // bit 6
+            uint8_t : 1;
+        };
+    };
+    uint16_t ageC;                      // 4: ms
+    uint8_t reserved1[2];               // 6
+    float prc;                          // 8: m
+    float prrc;                         // 12: m/s
+    float cr;                           // 16: m
+} ubx_nav_dgnss_data0_measurements_t;
+UBX_PAYLOAD_SIZE(ubx_nav_dgnss_data0_measurements_t, 20);
+
+// UBX-NAV-DGNSS-DATA0 payload (16 + numMeas*20 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    int32_t age;                        // 4: ms
+    int16_t baseId;                     // 8
+    int16_t baseHealth;                 // 10
+    uint8_t numMeas;                    // 12
+    uint8_t status;                     // 13
+    uint8_t reserved0[2];               // 14
+    ubx_nav_dgnss_data0_measurements_t measurements[];// 16: repeated
+} ubx_nav_dgnss_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_dgnss_data0_t, 16);
+
+#define UBX_NAV_DGNSS_DATA0(payload)            ((const ubx_nav_dgnss_data0_t *)(payload))
+#define UBX_NAV_DGNSS_DATA0_SIZE                16
+#define UBX_NAV_DGNSS_DATA0_MEASUREMENTS(payload, i)((const ubx_nav_dgnss_data0_measurements_t *)((const uint8_t *)(payload) + 16 + (size_t)(i) * 20))
+#define UBX_NAV_DGNSS_DATA0_MEASUREMENTS_COUNT(payload, len) \
+    ((size_t)(len) <= 16 ? 0 : (size_t)UBX_NAV_DGNSS_DATA0(payload)->numMeas < ((size_t)(len) - 16) / 20 ? (size_t)UBX_NAV_DGNSS_DATA0(payload)->numMeas : ((size_t)(len) - 16) / 20)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-SVIN-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_nav_svin_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_svin_poll0_t, 0);
+
+#define UBX_NAV_SVIN_POLL0(payload)             ((const ubx_nav_svin_poll0_t *)(payload))
+#define UBX_NAV_SVIN_POLL0_SIZE                 0
+#define UBX_NAV_SVIN_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x01, 0x3B, ubx_nav_svin_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-SVIN-DATA0 payload (40 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0[3];               // 1
+    uint32_t iTOW;                      // 4: ms
+    uint32_t dur;                       // 8: s
+    int32_t meanX;                      // 12: cm
+    int32_t meanY;                      // 16: cm
+    int32_t meanZ;                      // 20: cm
+    int8_t meanXHP;                     // 24: 0.1_mm
+    int8_t meanYHP;                     // 25: 0.1_mm
+    int8_t meanZHP;                     // 26: 0.1_mm
+    uint8_t reserved1;                  // 27
+    uint32_t meanAcc;                   // 28: 0.1_mm
+    uint32_t obs;                       // 32
+    uint8_t valid;                      // 36
+    uint8_t active;                     // 37
+    uint8_t reserved2[2];               // 38
+} ubx_nav_svin_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_svin_data0_t, 40);
+
+#define UBX_NAV_SVIN_DATA0(payload)             ((const ubx_nav_svin_data0_t *)(payload))
+#define UBX_NAV_SVIN_DATA0_SIZE                 40
+#define UBX_NAV_SVIN_DATA0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x01, 0x3B, ubx_nav_svin_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-RELPOSNED-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_nav_relposned_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_relposned_poll0_t, 0);
+
+#define UBX_NAV_RELPOSNED_POLL0(payload)        ((const ubx_nav_relposned_poll0_t *)(payload))
+#define UBX_NAV_RELPOSNED_POLL0_SIZE            0
+#define UBX_NAV_RELPOSNED_POLL0_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x01, 0x3C, ubx_nav_relposned_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-RELPOSNED-DATA0 payload (40 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0;                  // 1
+    uint16_t refStationId;              // 2
+    uint32_t iTOW;                      // 4: ms
+    int32_t relPosN;                    // 8: cm
+    int32_t relPosE;                    // 12: cm
+    int32_t relPosD;                    // 16: cm
+    int8_t relPosHPN;                   // 20: mm, *0.1
+    int8_t relPosHPE;                   // 21: mm, *0.1
+    int8_t relPosHPD;                   // 22: mm, *0.1
+    uint8_t reserved1;                  // 23
+    uint32_t accN;                      // 24: mm, *0.1
+    uint32_t accE;                      // 28: mm, *0.1
+    uint32_t accD;                      // 32: mm, *0.1
+    union {
+        uint32_t flags;                 // 36
+        struct {
+            uint32_t gnssFixOK : 1;         // bit 0
+            uint32_t diffSoln : 1;          // bit 1
+            uint32_t relPosValid : 1;       // bit 2
+            uint32_t carrSoln : 2;          // bit 3..4
+            uint32_t isMoving : 1;          // bit 5
+            uint32_t refPosMiss : 1;        // bit 6
+            uint32_t refObsMiss : 1;        // bit 7
+            uint32_t : 24;
+        };
+    };
+} ubx_nav_relposned_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_relposned_data0_t, 40);
+
+#define UBX_NAV_RELPOSNED_DATA0(payload)        ((const ubx_nav_relposned_data0_t *)(payload))
+#define UBX_NAV_RELPOSNED_DATA0_SIZE            40
+#define UBX_NAV_RELPOSNED_DATA0_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x01, 0x3C, ubx_nav_relposned_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-RELPOSNED-DATA1 payload (64 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0;                  // 1
+    uint16_t refStationId;              // 2
+    uint32_t iTOW;                      // 4: ms
+    int32_t relPosN;                    // 8: cm
+    int32_t relPosE;                    // 12: cm
+    int32_t relPosD;                    // 16: cm
+    int32_t relPosLength;               // 20: cm
+    int32_t relPosHeading;              // 24: deg, *1e-5
+    uint8_t reserved1[4];               // 28
+    int8_t relPosHPN;                   // 32: mm, *0.1
+    int8_t relPosHPE;                   // 33: mm, *0.1
+    int8_t relPosHPD;                   // 34: mm, *0.1
+    int8_t relPosHPLength;              // 35: mm, *0.1
+    uint32_t accN;                      // 36: mm, *0.1
+    uint32_t accE;                      // 40: mm, *0.1
+    uint32_t accD;                      // 44: mm, *0.1
+    uint32_t accLength;                 // 48: mm, *0.1
+    uint32_t accHeading;                // 52: deg, *1e-5
+    uint8_t reserved2[4];               // 56
+    union {
+        uint32_t flags;                 // 60
+        struct {
+            uint32_t gnssFixOK : 1;         // bit 0
+            uint32_t diffSoln : 1;          // bit 1
+            uint32_t relPosValid : 1;       // bit 2
+            uint32_t carrSoln : 2;          // bit 3..4
+            uint32_t isMoving : 1;          // bit 5
+            uint32_t refPosMiss : 1;        // bit 6
+            uint32_t refObsMiss : 1;        // bit 7
+            uint32_t relPosHeadingValid : 1;// bit 8
+            uint32_t relPosNormalized : 1;  // bit 9
+            uint32_t : 22;
+        };
+    };
+} ubx_nav_relposned_data1_t;
+UBX_PAYLOAD_SIZE(ubx_nav_relposned_data1_t, 64);
+
+#define UBX_NAV_RELPOSNED_DATA1(payload)        ((const ubx_nav_relposned_data1_t *)(payload))
+#define UBX_NAV_RELPOSNED_DATA1_SIZE            64
+#define UBX_NAV_RELPOSNED_DATA1_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x01, 0x3C, ubx_nav_relposned_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-EELL-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_nav_eell_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_eell_poll0_t, 0);
+
+#define UBX_NAV_EELL_POLL0(payload)             ((const ubx_nav_eell_poll0_t *)(payload))
+#define UBX_NAV_EELL_POLL0_SIZE                 0
+#define UBX_NAV_EELL_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x01, 0x3D, ubx_nav_eell_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-EELL-DATA0 payload (16 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t version;                    // 4
+    uint8_t reserved0;                  // 5
+    uint16_t errEllipseOrient;          // 6: deg, *1e-2
+    uint32_t errEllipseMajor;           // 8: mm
+    uint32_t errEllipseMinor;           // 12: mm
+} ubx_nav_eell_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_eell_data0_t, 16);
+
+#define UBX_NAV_EELL_DATA0(payload)             ((const ubx_nav_eell_data0_t *)(payload))
+#define UBX_NAV_EELL_DATA0_SIZE                 16
+#define UBX_NAV_EELL_DATA0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x01, 0x3D, ubx_nav_eell_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-EKFSTATUS-DATA0 payload (36 bytes)
+typedef struct __attribute__((packed)) {
+    int32_t pulses;                     // 0
+    int32_t period;                     // 4: ms
+    uint32_t gyroMean;                  // 8: *1e-2
+    int16_t temperature;                // 12: degC, *2^-8
+    int8_t direction;                   // 14
+    union {
+        uint8_t calibStatus;            // 15
+        struct {
+            uint8_t calibTacho : 2;         // bit 0..1
+            uint8_t calibGyro : 2;          // bit 2..3
+            uint8_t calibGyroB : 2;         // bit 4..5
+            uint8_t : 2;
+        };
+    };
+    int32_t pulseScale;                 // 16: *1e-5
+    int32_t gyroBias;                   // 20: *1e-5
+    int32_t gyroScale;                  // 24: *1e-5
+    int16_t accPulseScale;              // 28: *1e-4
+    int16_t accGyroBias;                // 30: *1e-4
+    int16_t accGyroScale;               // 32: *1e-4
+    union {
+        uint8_t measUsed;               // 34
+        struct {
+            uint8_t pulseUsed : 1;          // bit 0
+            uint8_t directionUsed : 1;      // bit 1
+            uint8_t gyroUsed : 1;           // bit 2
+            uint8_t tempUsed : 1;           // bit 3
+            uint8_t posUsed : 1;            // bit 4
+            uint8_t velUsed : 1;            // bit 5
+            uint8_t errGyro : 1;            // bit 6
+            uint8_t errPulse : 1;           // bit 7
+        };
+    };
+    uint8_t reserved0;                  // 35
+} ubx_nav_ekfstatus_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_ekfstatus_data0_t, 36);
+
+#define UBX_NAV_EKFSTATUS_DATA0(payload)        ((const ubx_nav_ekfstatus_data0_t *)(payload))
+#define UBX_NAV_EKFSTATUS_DATA0_SIZE            36
+#define UBX_NAV_EKFSTATUS_DATA0_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x01, 0x40, ubx_nav_ekfstatus_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-SLAS-DATA0 prcs (8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t gnssId;                     // 0
+    uint8_t svId;                       // 1
+    uint8_t reserved1;                  // 2
+    uint8_t reserved2[3];               // 3
+    int16_t prc;                        // 6: cm
+} ubx_nav_slas_data0_prcs_t;
+UBX_PAYLOAD_SIZE(ubx_nav_slas_data0_prcs_t, 8);
+
+// UBX-NAV-SLAS-DATA0 payload (20 + cnt*8 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t version;                    // 4
+    uint8_t reserved0[3];               // 5
+    int32_t gmsLon;                     // 8: deg, *1e-3
+    int32_t gmsLat;                     // 12: deg, *1e-3
+    uint8_t gmsCode;                    // 16
+    uint8_t qzssSvId;                   // 17
+    union {
+        uint8_t serviceFlags;           // 18
+        struct {
+            uint8_t gmsAvailable : 1;       // bit 0
+            uint8_t qzssSvAvailable : 1;    // bit 1
+            uint8_t testMode : 1;           // bit 2
+            uint8_t : 5;
+        };
+    };
+    uint8_t cnt;                        // 19
+    ubx_nav_slas_data0_prcs_t prcs[];   // 20: repeated
+} ubx_nav_slas_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_slas_data0_t, 20);
+
+#define UBX_NAV_SLAS_DATA0(payload)             ((const ubx_nav_slas_data0_t *)(payload))
+#define UBX_NAV_SLAS_DATA0_SIZE                 20
+#define UBX_NAV_SLAS_DATA0_PRCS(payload, i)     ((const ubx_nav_slas_data0_prcs_t *)((const uint8_t *)(payload) + 20 + (size_t)(i) * 8))
+#define UBX_NAV_SLAS_DATA0_PRCS_COUNT(payload, len) \
+    ((size_t)(len) <= 20 ? 0 : (size_t)UBX_NAV_SLAS_DATA0(payload)->cnt < ((size_t)(len) - 20) / 8 ? (size_t)UBX_NAV_SLAS_DATA0(payload)->cnt : ((size_t)(len) - 20) / 8)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-SIG-DATA0 sig (16 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t gnssId;                     // 0
+    uint8_t svId;                       // 1
+    uint8_t sigId;                      // 2
+    uint8_t freqId;                     // 3
+    int16_t prRes;                      // 4: m, *0.1
+    uint8_t cno;                        // 6: dBHz
+    uint8_t qualityInd;                 // 7
+    uint8_t corrSource;                 // 8
+    uint8_t ionoModel;                  // 9
+    union {
+        uint16_t sigFlags;              // 10
+        struct {
+            uint16_t health : 2;            // bit 0..1
+            uint16_t prSmoothed : 1;        // bit 2
+            uint16_t prUsed : 1;            // bit 3
+            uint16_t crUsed : 1;            // bit 4
+            uint16_t doUsed : 1;            // bit 5
+            uint16_t prCorrUsed : 1;        // bit 6
+            uint16_t crCorrUsed : 1;        // bit 7
+            uint16_t doCorrUsed : 1;        // bit 8
+            uint16_t authStatus : 1;        // bit 9
+            uint16_t : 6;
+        };
+    };
+    uint8_t reserved1[4];               // 12
+} ubx_nav_sig_data0_sig_t;
+UBX_PAYLOAD_SIZE(ubx_nav_sig_data0_sig_t, 16);
+
+// UBX-NAV-SIG-DATA0 payload (8 + numSigs*16 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t version;                    // 4
+    uint8_t numSigs;                    // 5
+    uint8_t reserved0[2];               // 6
+    ubx_nav_sig_data0_sig_t sig[];      // 8: repeated
+} ubx_nav_sig_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_sig_data0_t, 8);
+
+#define UBX_NAV_SIG_DATA0(payload)              ((const ubx_nav_sig_data0_t *)(payload))
+#define UBX_NAV_SIG_DATA0_SIZE                  8
+#define UBX_NAV_SIG_DATA0_SIG(payload, i)       ((const ubx_nav_sig_data0_sig_t *)((const uint8_t *)(payload) + 8 + (size_t)(i) * 16))
+#define UBX_NAV_SIG_DATA0_SIG_COUNT(payload, len) \
+    ((size_t)(len) <= 8 ? 0 : (size_t)UBX_NAV_SIG_DATA0(payload)->numSigs < ((size_t)(len) - 8) / 16 ? (size_t)UBX_NAV_SIG_DATA0(payload)->numSigs : ((size_t)(len) - 8) / 16)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-IMES-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_nav_imes_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_imes_poll0_t, 0);
+
+#define UBX_NAV_IMES_POLL0(payload)             ((const ubx_nav_imes_poll0_t *)(payload))
+#define UBX_NAV_IMES_POLL0_SIZE                 0
+#define UBX_NAV_IMES_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x01, 0x50, ubx_nav_imes_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-IMES-DATA0 txs (40 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t txid;                       // 0
+    uint8_t cno;                        // 1: dBHz
+    union {
+        uint8_t quality;                // 2
+        struct {
+            uint8_t qualityInd : 4;         // bit 0..3
+            uint8_t : 4;
+        };
+    };
+    uint8_t reserved1;                  // 3
+    int32_t doppler;                    // 4: Hz, *2^-12
+    union {
+        uint32_t position1_1;           // 8
+        struct {
+            uint32_t pos1Floor : 8;         // bit 0..7
+            int32_t pos1Lat : 23;           // bit 8..30
+            uint32_t : 1;
+        };
+    };
+    union {
+        uint32_t position1_2;           // 12
+        struct {
+            int32_t pos1Lon : 24;           // bit 0..23
+            uint32_t pos1Valid : 1;         // bit 24
+            uint32_t : 7;
+        };
+    };
+    union {
+        uint32_t position2_1;           // 16
+        struct {
+            uint32_t pos2Floor : 9;         // bit 0..8
+            uint32_t pos2Alt : 12;          // bit 9..20
+            uint32_t pos2Valid : 1;         // bit 21
+            uint32_t : 10;
+        };
+    };
+    int32_t lat;                        // 20: deg, *180*2^-24
+    int32_t lon;                        // 24: deg, *360*2^-25
+    union {
+        uint32_t shortIdFrame;          // 28
+        struct {
+            uint32_t shortId : 12;          // bit 0..11
+            uint32_t shortValid : 2;        // bit 12..13
+            uint32_t shortBoundary : 1;     // bit 14
+            uint32_t : 17;
+        };
+    };
+    uint32_t mediumIdLSB;               // 32
+    union {
+        uint32_t mediumId_2;            // 36
+        struct {
+            uint32_t mediumIdMSB : 1;       // bit 0
+            uint32_t mediumValid : 1;       // bit 1
+            uint32_t mediumboundary : 1;    // bit 2
+            uint32_t : 29;
+        };
+    };
+} ubx_nav_imes_data0_txs_t;
+UBX_PAYLOAD_SIZE(ubx_nav_imes_data0_txs_t, 40);
+
+// UBX-NAV-IMES-DATA0 payload (4 + numTx*40 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t numTx;                      // 0
+    uint8_t reserved0[3];               // 1
+    ubx_nav_imes_data0_txs_t txs[];     // 4: repeated
+} ubx_nav_imes_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_imes_data0_t, 4);
+
+#define UBX_NAV_IMES_DATA0(payload)             ((const ubx_nav_imes_data0_t *)(payload))
+#define UBX_NAV_IMES_DATA0_SIZE                 4
+#define UBX_NAV_IMES_DATA0_TXS(payload, i)      ((const ubx_nav_imes_data0_txs_t *)((const uint8_t *)(payload) + 4 + (size_t)(i) * 40))
+#define UBX_NAV_IMES_DATA0_TXS_COUNT(payload, len) \
+    ((size_t)(len) <= 4 ? 0 : (size_t)UBX_NAV_IMES_DATA0(payload)->numTx < ((size_t)(len) - 4) / 40 ? (size_t)UBX_NAV_IMES_DATA0(payload)->numTx : ((size_t)(len) - 4) / 40)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-IMES-DATA1 txs (44 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t gnssId;                     // 0
+    uint8_t svId;                       // 1
+    uint8_t signalId;                   // 2
+    uint8_t reserved1[2];               // 3
+    uint8_t cno;                        // 5: dBHz
+    union {
+        uint8_t quality;                // 6
+        struct {
+            uint8_t qualityInd : 4;         // bit 0..3
+            uint8_t : 4;
+        };
+    };
+    uint8_t reserved2;                  // 7
+    int32_t doppler;                    // 8: Hz, *2^-12
+    union {
+        uint32_t position1_1;           // 12
+        struct {
+            uint32_t pos1Floor : 8;         // bit 0..7
+            int32_t pos1Lat : 23;           // bit 8..30
+            uint32_t : 1;
+        };
+    };
+    union {
+        uint32_t position1_2;           // 16
+        struct {
+            int32_t pos1Lon : 24;           // bit 0..23
+            uint32_t pos1Valid : 1;         // bit 24
+            uint32_t : 7;
+        };
+    };
+    union {
+        uint32_t position2_1;           // 20
+        struct {
+            uint32_t pos2Floor : 9;         // bit 0..8
+            uint32_t pos2Alt : 12;          // bit 9..20
+            uint32_t pos2Acc : 2;           // bit 21..22
+            uint32_t pos2Valid : 1;         // bit 23
+            uint32_t : 8;
+        };
+    };
+    int32_t lat;                        // 24: deg, *180*2^-24
+    int32_t lon;                        // 28: deg, *360*2^-25
+    union {
+        uint32_t shortIdFrame;          // 32
+        struct {
+            uint32_t shortId : 12;          // bit 0..11
+            uint32_t shortValid : 1;        // bit 12
+            uint32_t shortBoundary : 1;     // bit 13
+            uint32_t : 18;
+        };
+    };
+    uint32_t mediumIdLSB;               // 36
+    union {
+        uint32_t mediumId_2;            // 40
+        struct {
+            uint32_t mediumIdMSB : 1;       // bit 0
+            uint32_t mediumValid : 1;       // bit 1
+            uint32_t mediumboundary : 1;    // bit 2
+            uint32_t : 29;
+        };
+    };
+} ubx_nav_imes_data1_txs_t;
+UBX_PAYLOAD_SIZE(ubx_nav_imes_data1_txs_t, 44);
+
+// UBX-NAV-IMES-DATA1 payload (4 + numTx*44 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t numTx;                      // 0
+    uint8_t version;                    // 1
+    uint8_t reserved0[2];               // 2
+    ubx_nav_imes_data1_txs_t txs[];     // 4: repeated
+} ubx_nav_imes_data1_t;
+UBX_PAYLOAD_SIZE(ubx_nav_imes_data1_t, 4);
+
+#define UBX_NAV_IMES_DATA1(payload)             ((const ubx_nav_imes_data1_t *)(payload))
+#define UBX_NAV_IMES_DATA1_SIZE                 4
+#define UBX_NAV_IMES_DATA1_TXS(payload, i)      ((const ubx_nav_imes_data1_txs_t *)((const uint8_t *)(payload) + 4 + (size_t)(i) * 44))
+#define UBX_NAV_IMES_DATA1_TXS_COUNT(payload, len) \
+    ((size_t)(len) <= 4 ? 0 : (size_t)UBX_NAV_IMES_DATA1(payload)->numTx < ((size_t)(len) - 4) / 44 ? (size_t)UBX_NAV_IMES_DATA1(payload)->numTx : ((size_t)(len) - 4) / 44)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-AOPSTATUS-DATA0 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    union {
+        uint8_t aopCfg;                 // 4
+        struct {
+            uint8_t useAOP : 1;             // bit 0
+            uint8_t : 7;
+        };
+    };
+    uint8_t status;                     // 5
+    uint8_t reserved0[2];               // 6
+    uint32_t availGPS;                  // 8
+    uint32_t availGLO;                  // 12
+    uint8_t reserved1[4];               // 16
+} ubx_nav_aopstatus_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_aopstatus_data0_t, 20);
+
+#define UBX_NAV_AOPSTATUS_DATA0(payload)        ((const ubx_nav_aopstatus_data0_t *)(payload))
+#define UBX_NAV_AOPSTATUS_DATA0_SIZE            20
+#define UBX_NAV_AOPSTATUS_DATA0_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x01, 0x60, ubx_nav_aopstatus_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-AOPSTATUS-DATA1 payload (16 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    union {
+        uint8_t aopCfg;                 // 4
+        struct {
+            uint8_t useAOP : 1;             // bit 0
+            uint8_t : 7;
+        };
+    };
+    uint8_t status;                     // 5
+    uint8_t reserved0[10];              // 6
+} ubx_nav_aopstatus_data1_t;
+UBX_PAYLOAD_SIZE(ubx_nav_aopstatus_data1_t, 16);
+
+#define UBX_NAV_AOPSTATUS_DATA1(payload)        ((const ubx_nav_aopstatus_data1_t *)(payload))
+#define UBX_NAV_AOPSTATUS_DATA1_SIZE            16
+#define UBX_NAV_AOPSTATUS_DATA1_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x01, 0x60, ubx_nav_aopstatus_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-EOE-DATA0 payload (4 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+} ubx_nav_eoe_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_eoe_data0_t, 4);
+
+#define UBX_NAV_EOE_DATA0(payload)              ((const ubx_nav_eoe_data0_t *)(payload))
+#define UBX_NAV_EOE_DATA0_SIZE                  4
+#define UBX_NAV_EOE_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x01, 0x61, ubx_nav_eoe_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-PL-DATA1 payload (52 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t msgVersion;                 // 0
+    uint8_t tmirCoeff;                  // 1
+    int8_t tmirExp;                     // 2
+    uint8_t plPosValid;                 // 3
+    uint8_t plPosFrame;                 // 4
+    uint8_t plVelValid;                 // 5
+    uint8_t plVelFrame;                 // 6
+    uint8_t plTimeValid;                // 7
+    uint8_t plPosInvalidityReason;      // 8
+    uint8_t plVelInvalidityReason;      // 9
+    uint8_t plTimeInvalidityReason;     // 10
+    uint8_t reserved0;                  // 11
+    uint32_t iTow;                      // 12: ms
+    uint32_t plPos1;                    // 16: mm
+    uint32_t plPos2;                    // 20: mm
+    uint32_t plPos3;                    // 24: mm
+    uint32_t plVel1;                    // 28: mm/s
+    uint32_t plVel2;                    // 32: mm/s
+    uint32_t plVel3;                    // 36: mm/s
+    uint16_t plPosHorizOrient;          // 40: deg, *1e-2
+    uint16_t plVelHorizOrient;          // 42: deg, *1e-2
+    uint32_t plTime;                    // 44: ns
+    uint8_t reserved1[4];               // 48
+} ubx_nav_pl_data1_t;
+UBX_PAYLOAD_SIZE(ubx_nav_pl_data1_t, 52);
+
+#define UBX_NAV_PL_DATA1(payload)               ((const ubx_nav_pl_data1_t *)(payload))
+#define UBX_NAV_PL_DATA1_SIZE                   52
+#define UBX_NAV_PL_DATA1_TYPED(name, ...)       UBX_MESSAGE_TYPED(name, 0x01, 0x62, ubx_nav_pl_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-TIMENAVIC-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_nav_timenavic_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_timenavic_poll0_t, 0);
+
+#define UBX_NAV_TIMENAVIC_POLL0(payload)        ((const ubx_nav_timenavic_poll0_t *)(payload))
+#define UBX_NAV_TIMENAVIC_POLL0_SIZE            0
+#define UBX_NAV_TIMENAVIC_POLL0_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x01, 0x63, ubx_nav_timenavic_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-TIMENAVIC-DATA0 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint32_t NavICTow;                  // 4: s
+    int32_t fNavICTow;                  // 8: ns
+    int16_t NavICWno;                   // 12
+    int8_t leapS;                       // 14: s
+    union {
+        uint8_t valid;                  // 15
+        struct {
+            uint8_t NavICTowValid : 1;      // bit 0
+            uint8_t NavICWnoValid : 1;      // bit 1
+            uint8_t leapSValid : 1;         // bit 2
+            uint8_t : 5;
+        };
+    };
+    uint32_t tAcc;                      // 16: ns
+} ubx_nav_timenavic_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_timenavic_data0_t, 20);
+
+#define UBX_NAV_TIMENAVIC_DATA0(payload)        ((const ubx_nav_timenavic_data0_t *)(payload))
+#define UBX_NAV_TIMENAVIC_DATA0_SIZE            20
+#define UBX_NAV_TIMENAVIC_DATA0_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x01, 0x63, ubx_nav_timenavic_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-TIMETRUSTED-DATA0 payload (40 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t refSys;                     // 1
+    union {
+        uint8_t valid;                  // 2
+        struct {
+            uint8_t trustedTimeValid : 1;   // bit 0
+            uint8_t deltaTimeValid : 1;     // bit 1
+            uint8_t : 6;
+        };
+    };
+    uint8_t reserved0;                  // 3
+    uint32_t iTOW;                      // 4: ms
+    uint16_t iniWno;                    // 8
+    uint16_t propWno;                   // 10
+    uint32_t iniTow;                    // 12: ms
+    uint32_t propTow;                   // 16: ms
+    uint32_t iniTAcc;                   // 20: ms
+    uint32_t propTAcc;                  // 24: ms
+    int32_t deltaS;                     // 28: s
+    int32_t deltaMs;                    // 32: ms
+    uint8_t reserved1[4];               // 36
+} ubx_nav_timetrusted_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_timetrusted_data0_t, 40);
+
+#define UBX_NAV_TIMETRUSTED_DATA0(payload)      ((const ubx_nav_timetrusted_data0_t *)(payload))
+#define UBX_NAV_TIMETRUSTED_DATA0_SIZE          40
+#define UBX_NAV_TIMETRUSTED_DATA0_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x01, 0x64, ubx_nav_timetrusted_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-CFB-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_nav_cfb_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_cfb_poll0_t, 0);
+
+#define UBX_NAV_CFB_POLL0(payload)              ((const ubx_nav_cfb_poll0_t *)(payload))
+#define UBX_NAV_CFB_POLL0_SIZE                  0
+#define UBX_NAV_CFB_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x01, 0x65, ubx_nav_cfb_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV-CFB-DATA0 payload (40 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    int32_t ecefX;                      // 4: cm
+    int32_t ecefY;                      // 8: cm
+    int32_t ecefZ;                      // 12: cm
+    int32_t lat;                        // 16: deg, *1e-7
+    int32_t lon;                        // 20: deg, *1e-7
+    int32_t height;                     // 24: cm
+    uint32_t cfb2d;                     // 28: cm
+    uint32_t cfb3d;                     // 32: cm
+    uint8_t cfb2d_int;                  // 36
+    uint8_t cfb3d_int;                  // 37
+    uint8_t svs;                        // 38
+    union {
+        uint8_t flags;                  // 39
+        struct {
+            uint8_t validResult : 1;        // bit 0
+            uint8_t updatedValues : 1;      // bit 1
+            uint8_t : 6;
+        };
+    };
+} ubx_nav_cfb_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav_cfb_data0_t, 40);
+
+#define UBX_NAV_CFB_DATA0(payload)              ((const ubx_nav_cfb_data0_t *)(payload))
+#define UBX_NAV_CFB_DATA0_SIZE                  40
+#define UBX_NAV_CFB_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x01, 0x65, ubx_nav_cfb_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-RAW-DATA0 svs (24 bytes)
+typedef struct __attribute__((packed)) {
+    double cpMes;                       // 0: cycles
+    double prMes;                       // 8: m
+    float doMes;                        // 16: Hz
+    uint8_t sv;                         // 20
+    int8_t mesQI;                       // 21
+    int8_t cno;                         // 22: dBHz
+    uint8_t lli;                        // 23
+} ubx_rxm_raw_data0_svs_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_raw_data0_svs_t, 24);
+
+// UBX-RXM-RAW-DATA0 payload (8 + numSV*24 bytes)
+typedef struct __attribute__((packed)) {
+    int32_t rcvTow;                     // 0: ms
+    int16_t week;                       // 4: weeks
+    uint8_t numSV;                      // 6
+    uint8_t reserved0;                  // 7
+    ubx_rxm_raw_data0_svs_t svs[];      // 8: repeated
+} ubx_rxm_raw_data0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_raw_data0_t, 8);
+
+#define UBX_RXM_RAW_DATA0(payload)              ((const ubx_rxm_raw_data0_t *)(payload))
+#define UBX_RXM_RAW_DATA0_SIZE                  8
+#define UBX_RXM_RAW_DATA0_SVS(payload, i)       ((const ubx_rxm_raw_data0_svs_t *)((const uint8_t *)(payload) + 8 + (size_t)(i) * 24))
+#define UBX_RXM_RAW_DATA0_SVS_COUNT(payload, len) \
+    ((size_t)(len) <= 8 ? 0 : (size_t)UBX_RXM_RAW_DATA0(payload)->numSV < ((size_t)(len) - 8) / 24 ? (size_t)UBX_RXM_RAW_DATA0(payload)->numSV : ((size_t)(len) - 8) / 24)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-SFRB-DATA0 payload (42 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t chn;                        // 0
+    uint8_t svid;                       // 1
+    uint32_t dwrd[10];                  // 2
+} ubx_rxm_sfrb_data0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_sfrb_data0_t, 42);
+
+#define UBX_RXM_SFRB_DATA0(payload)             ((const ubx_rxm_sfrb_data0_t *)(payload))
+#define UBX_RXM_SFRB_DATA0_SIZE                 42
+#define UBX_RXM_SFRB_DATA0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x02, 0x11, ubx_rxm_sfrb_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-SFRBX-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_rxm_sfrbx_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_sfrbx_poll0_t, 0);
+
+#define UBX_RXM_SFRBX_POLL0(payload)            ((const ubx_rxm_sfrbx_poll0_t *)(payload))
+#define UBX_RXM_SFRBX_POLL0_SIZE                0
+#define UBX_RXM_SFRBX_POLL0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x02, 0x13, ubx_rxm_sfrbx_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-SFRBX-DATA0 group1 (4 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t dwrd;                      // 0
+} ubx_rxm_sfrbx_data0_group1_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_sfrbx_data0_group1_t, 4);
+
+// UBX-RXM-SFRBX-DATA0 payload (4 + numWords*4 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t txid;                       // 0
+    uint8_t gnssId;                     // 1
+    uint8_t numWords;                   // 2
+    uint8_t reserved0;                  // 3
+    ubx_rxm_sfrbx_data0_group1_t group1[];// 4: repeated
+} ubx_rxm_sfrbx_data0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_sfrbx_data0_t, 4);
+
+#define UBX_RXM_SFRBX_DATA0(payload)            ((const ubx_rxm_sfrbx_data0_t *)(payload))
+#define UBX_RXM_SFRBX_DATA0_SIZE                4
+#define UBX_RXM_SFRBX_DATA0_GROUP1(payload, i)  ((const ubx_rxm_sfrbx_data0_group1_t *)((const uint8_t *)(payload) + 4 + (size_t)(i) * 4))
+#define UBX_RXM_SFRBX_DATA0_GROUP1_COUNT(payload, len) \
+    ((size_t)(len) <= 4 ? 0 : (size_t)UBX_RXM_SFRBX_DATA0(payload)->numWords < ((size_t)(len) - 4) / 4 ? (size_t)UBX_RXM_SFRBX_DATA0(payload)->numWords : ((size_t)(len) - 4) / 4)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-SFRBX-DATA1 d (4 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t dwrd;                      // 0
+} ubx_rxm_sfrbx_data1_d_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_sfrbx_data1_d_t, 4);
+
+// UBX-RXM-SFRBX-DATA1 payload (8 + numWords*4 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t gnssId;                     // 0
+    uint8_t svId;                       // 1
+    uint8_t reserved0;                  // 2
+    uint8_t freqId;                     // 3
+    uint8_t numWords;                   // 4
+    uint8_t reserved1;                  // 5
+    uint8_t version;                    // 6
+    uint8_t reserved2;                  // 7
+    ubx_rxm_sfrbx_data1_d_t d[];        // 8: repeated
+} ubx_rxm_sfrbx_data1_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_sfrbx_data1_t, 8);
+
+#define UBX_RXM_SFRBX_DATA1(payload)            ((const ubx_rxm_sfrbx_data1_t *)(payload))
+#define UBX_RXM_SFRBX_DATA1_SIZE                8
+#define UBX_RXM_SFRBX_DATA1_D(payload, i)       ((const ubx_rxm_sfrbx_data1_d_t *)((const uint8_t *)(payload) + 8 + (size_t)(i) * 4))
+#define UBX_RXM_SFRBX_DATA1_D_COUNT(payload, len) \
+    ((size_t)(len) <= 8 ? 0 : (size_t)UBX_RXM_SFRBX_DATA1(payload)->numWords < ((size_t)(len) - 8) / 4 ? (size_t)UBX_RXM_SFRBX_DATA1(payload)->numWords : ((size_t)(len) - 8) / 4)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-SFRBX-DATA2 d (4 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t dwrd;                      // 0
+} ubx_rxm_sfrbx_data2_d_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_sfrbx_data2_d_t, 4);
+
+// UBX-RXM-SFRBX-DATA2 payload (8 + numWords*4 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t gnssId;                     // 0
+    uint8_t svId;                       // 1
+    uint8_t sigId;                      // 2
+    uint8_t freqId;                     // 3
+    uint8_t numWords;                   // 4
+    uint8_t chn;                        // 5
+    uint8_t version;                    // 6
+    uint8_t reserved0;                  // 7
+    ubx_rxm_sfrbx_data2_d_t d[];        // 8: repeated
+} ubx_rxm_sfrbx_data2_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_sfrbx_data2_t, 8);
+
+#define UBX_RXM_SFRBX_DATA2(payload)            ((const ubx_rxm_sfrbx_data2_t *)(payload))
+#define UBX_RXM_SFRBX_DATA2_SIZE                8
+#define UBX_RXM_SFRBX_DATA2_D(payload, i)       ((const ubx_rxm_sfrbx_data2_d_t *)((const uint8_t *)(payload) + 8 + (size_t)(i) * 4))
+#define UBX_RXM_SFRBX_DATA2_D_COUNT(payload, len) \
+    ((size_t)(len) <= 8 ? 0 : (size_t)UBX_RXM_SFRBX_DATA2(payload)->numWords < ((size_t)(len) - 8) / 4 ? (size_t)UBX_RXM_SFRBX_DATA2(payload)->numWords : ((size_t)(len) - 8) / 4)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-MEASX-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_rxm_measx_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_measx_poll0_t, 0);
+
+#define UBX_RXM_MEASX_POLL0(payload)            ((const ubx_rxm_measx_poll0_t *)(payload))
+#define UBX_RXM_MEASX_POLL0_SIZE                0
+#define UBX_RXM_MEASX_POLL0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x02, 0x14, ubx_rxm_measx_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-MEASX-DATA1 meas (24 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t gnssId;                     // 0
+    uint8_t svId;                       // 1
+    uint8_t cNo;                        // 2
+    uint8_t mpathIndic;                 // 3
+    int32_t dopplerMS;                  // 4: m/s, *0.04
+    int32_t dopplerHz;                  // 8: Hz, *0.2
+    uint16_t wholeChips;                // 12
+    uint16_t fracChips;                 // 14
+    uint32_t codePhase;                 // 16: ms, *2^-21
+    uint8_t intCodePhase;               // 20: ms
+    uint8_t pseuRangeRMSErr;            // 21
+    uint8_t reserved4[2];               // 22
+} ubx_rxm_measx_data1_meas_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_measx_data1_meas_t, 24);
+
+// UBX-RXM-MEASX-DATA1 payload (44 + numSV*24 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0[3];               // 1
+    uint32_t gpsTOW;                    // 4: ms
+    uint32_t gloTOW;                    // 8: ms
+    uint32_t bdsTOW;                    // 12: ms
+    uint8_t reserved1[4];               // 16
+    uint32_t qzssTOW;                   // 20: ms
+    uint16_t gpsTOWacc;                 // 24: ms, *2^-4
+    uint16_t gloTOWacc;                 // 26: ms, *2^-4
+    uint16_t bdsTOWacc;                 // 28: ms, *2^-4
+    uint8_t reserved2[2];               // 30
+    uint16_t qzssTOWacc;                // 32: ms, *2^-4
+    uint8_t numSV;                      // 34
+    union {
+        uint8_t flags;                  // 35
+        struct {
+            uint8_t towSet : 2;             // bit 0..1
+            uint8_t : 6;
+        };
+    };
+    uint8_t reserved3[8];               // 36
+    ubx_rxm_measx_data1_meas_t meas[];  // 44: repeated
+} ubx_rxm_measx_data1_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_measx_data1_t, 44);
+
+#define UBX_RXM_MEASX_DATA1(payload)            ((const ubx_rxm_measx_data1_t *)(payload))
+#define UBX_RXM_MEASX_DATA1_SIZE                44
+#define UBX_RXM_MEASX_DATA1_MEAS(payload, i)    ((const ubx_rxm_measx_data1_meas_t *)((const uint8_t *)(payload) + 44 + (size_t)(i) * 24))
+#define UBX_RXM_MEASX_DATA1_MEAS_COUNT(payload, len) \
+    ((size_t)(len) <= 44 ? 0 : (size_t)UBX_RXM_MEASX_DATA1(payload)->numSV < ((size_t)(len) - 44) / 24 ? (size_t)UBX_RXM_MEASX_DATA1(payload)->numSV : ((size_t)(len) - 44) / 24)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-RAWX-DATA0 meas (32 bytes)
+typedef struct __attribute__((packed)) {
+    double prMes;                       // 0: m
+    double cpMes;                       // 8: cycles
+    float doMes;                        // 16: Hz
+    uint8_t gnssId;                     // 20
+    uint8_t svId;                       // 21
+    uint8_t reserved1;                  // 22
+    uint8_t freqId;                     // 23
+    uint16_t locktime;                  // 24: ms
+    uint8_t cno;                        // 26: dBHz
+    union {
+        uint8_t prStdev;                // 27: m, *0.01*2^n
+        struct {
+            uint8_t prStd : 4;              // bit 0..3
+            uint8_t : 4;
+        };
+    };
+    union {
+        uint8_t cpStdev;                // 28: cycles, *0.004
+        struct {
+            uint8_t cpStd : 4;              // bit 0..3
+            uint8_t : 4;
+        };
+    };
+    union {
+        uint8_t doStdev;                // 29: Hz, *0.002*2^n
+        struct {
+            uint8_t doStd : 4;              // bit 0..3
+            uint8_t : 4;
+        };
+    };
+    union {
+        uint8_t trkStat;                // 30
+        struct {
+            uint8_t prValid : 1;            // bit 0
+            uint8_t cpValid : 1;            // bit 1
+            uint8_t halfCyc : 1;            // bit 2
+            uint8_t subHalfCyc : 1;         // bit 3
+            uint8_t : 4;
+        };
+    };
+    uint8_t reserved2;                  // 31
+} ubx_rxm_rawx_data0_meas_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_rawx_data0_meas_t, 32);
+
+// UBX-RXM-RAWX-DATA0 payload (16 + numMeas*32 bytes)
+typedef struct __attribute__((packed)) {
+    double rcvTow;                      // 0: s
+    uint16_t week;                      // 8: weeks
+    int8_t leapS;                       // 10: s
+    uint8_t numMeas;                    // 11
+    union {
+        uint8_t recStat;                // 12
+        struct {
+            uint8_t leapSec : 1;            // bit 0
+            uint8_t clkReset : 1;           // bit 1
+            uint8_t : 6;
+        };
+    };
+    uint8_t reserved0[3];               // 13
+    ubx_rxm_rawx_data0_meas_t meas[];   // 16: repeated
+} ubx_rxm_rawx_data0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_rawx_data0_t, 16);
+
+#define UBX_RXM_RAWX_DATA0(payload)             ((const ubx_rxm_rawx_data0_t *)(payload))
+#define UBX_RXM_RAWX_DATA0_SIZE                 16
+#define UBX_RXM_RAWX_DATA0_MEAS(payload, i)     ((const ubx_rxm_rawx_data0_meas_t *)((const uint8_t *)(payload) + 16 + (size_t)(i) * 32))
+#define UBX_RXM_RAWX_DATA0_MEAS_COUNT(payload, len) \
+    ((size_t)(len) <= 16 ? 0 : (size_t)UBX_RXM_RAWX_DATA0(payload)->numMeas < ((size_t)(len) - 16) / 32 ? (size_t)UBX_RXM_RAWX_DATA0(payload)->numMeas : ((size_t)(len) - 16) / 32)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-RAWX-DATA1 meas (32 bytes)
+typedef struct __attribute__((packed)) {
+    double prMes;                       // 0: m
+    double cpMes;                       // 8: cycles
+    float doMes;                        // 16: Hz
+    uint8_t gnssId;                     // 20
+    uint8_t svId;                       // 21
+    uint8_t sigId;                      // 22
+    uint8_t freqId;                     // 23
+    uint16_t locktime;                  // 24: ms
+    uint8_t cno;                        // 26: dBHz
+    union {
+        uint8_t prStdev;                // 27: m, *0.01*2^n
+        struct {
+            uint8_t prStd : 4;              // bit 0..3
+            uint8_t : 4;
+        };
+    };
+    union {
+        uint8_t cpStdev;                // 28: cycles, *0.004
+        struct {
+            uint8_t cpStd : 4;              // bit 0..3
+            uint8_t : 4;
+        };
+    };
+    union {
+        uint8_t doStdev;                // 29: Hz, *0.002*2^n
+        struct {
+            uint8_t doStd : 4;              // bit 0..3
+            uint8_t : 4;
+        };
+    };
+    union {
+        uint8_t trkStat;                // 30
+        struct {
+            uint8_t prValid : 1;            // bit 0
+            uint8_t cpValid : 1;            // bit 1
+            uint8_t halfCyc : 1;            // bit 2
+            uint8_t subHalfCyc : 1;         // bit 3
+            uint8_t : 4;
+        };
+    };
+    uint8_t reserved1;                  // 31
+} ubx_rxm_rawx_data1_meas_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_rawx_data1_meas_t, 32);
+
+// UBX-RXM-RAWX-DATA1 payload (16 + numMeas*32 bytes)
+typedef struct __attribute__((packed)) {
+    double rcvTow;                      // 0: s
+    uint16_t week;                      // 8: weeks
+    int8_t leapS;                       // 10: s
+    uint8_t numMeas;                    // 11
+    union {
+        uint8_t recStat;                // 12
+        struct {
+            uint8_t leapSec : 1;            // bit 0
+            uint8_t clkReset : 1;           // bit 1
+            uint8_t : 6;
+        };
+    };
+    uint8_t version;                    // 13
+    uint8_t reserved0[2];               // 14
+    ubx_rxm_rawx_data1_meas_t meas[];   // 16: repeated
+} ubx_rxm_rawx_data1_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_rawx_data1_t, 16);
+
+#define UBX_RXM_RAWX_DATA1(payload)             ((const ubx_rxm_rawx_data1_t *)(payload))
+#define UBX_RXM_RAWX_DATA1_SIZE                 16
+#define UBX_RXM_RAWX_DATA1_MEAS(payload, i)     ((const ubx_rxm_rawx_data1_meas_t *)((const uint8_t *)(payload) + 16 + (size_t)(i) * 32))
+#define UBX_RXM_RAWX_DATA1_MEAS_COUNT(payload, len) \
+    ((size_t)(len) <= 16 ? 0 : (size_t)UBX_RXM_RAWX_DATA1(payload)->numMeas < ((size_t)(len) - 16) / 32 ? (size_t)UBX_RXM_RAWX_DATA1(payload)->numMeas : ((size_t)(len) - 16) / 32)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-MEASX2-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_rxm_measx2_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_measx2_poll0_t, 0);
+
+#define UBX_RXM_MEASX2_POLL0(payload)           ((const ubx_rxm_measx2_poll0_t *)(payload))
+#define UBX_RXM_MEASX2_POLL0_SIZE               0
+#define UBX_RXM_MEASX2_POLL0_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, 0x02, 0x16, ubx_rxm_measx2_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-MEASX2-DATA0 meas (28 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t gnssId;                     // 0
+    uint8_t svId;                       // 1
+    uint8_t sigId;                      // 2
+    uint8_t cNo;                        // 3
+    int32_t dopplerMS;                  // 4: m/s, *0.04
+    int32_t dopplerHz;                  // 8: Hz, *0.2
+    uint8_t mpathIndic;                 // 12
+    uint8_t pseuRangeRMSErr;            // 13
+    uint16_t fracChips;                 // 14
+    uint32_t wholeChips;                // 16
+    uint32_t codePhase;                 // 20: ms, *2^-21
+    uint16_t intCodePhase;              // 24: ms
+    uint8_t reserved4[2];               // 26
+} ubx_rxm_measx2_data0_meas_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_measx2_data0_meas_t, 28);
+
+// UBX-RXM-MEASX2-DATA0 payload (44 + numSV*28 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0[3];               // 1
+    uint32_t gpsTOW;                    // 4: ms
+    uint32_t gloTOW;                    // 8: ms
+    uint32_t bdsTOW;                    // 12: ms
+    uint8_t reserved1[4];               // 16
+    uint32_t qzssTOW;                   // 20: ms
+    uint16_t gpsTOWacc;                 // 24: ms, *2^-4
+    uint16_t gloTOWacc;                 // 26: ms, *2^-4
+    uint16_t bdsTOWacc;                 // 28: ms, *2^-4
+    uint8_t reserved2[2];               // 30
+    uint16_t qzssTOWacc;                // 32: ms, *2^-4
+    uint8_t numSV;                      // 34
+    union {
+        uint8_t flags;                  // 35
+        struct {
+            uint8_t towSet : 2;             // bit 0..1
+            uint8_t : 6;
+        };
+    };
+    uint8_t reserved3[8];               // 36
+    ubx_rxm_measx2_data0_meas_t meas[]; // 44: repeated
+} ubx_rxm_measx2_data0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_measx2_data0_t, 44);
+
+#define UBX_RXM_MEASX2_DATA0(payload)           ((const ubx_rxm_measx2_data0_t *)(payload))
+#define UBX_RXM_MEASX2_DATA0_SIZE               44
+#define UBX_RXM_MEASX2_DATA0_MEAS(payload, i)   ((const ubx_rxm_measx2_data0_meas_t *)((const uint8_t *)(payload) + 44 + (size_t)(i) * 28))
+#define UBX_RXM_MEASX2_DATA0_MEAS_COUNT(payload, len) \
+    ((size_t)(len) <= 44 ? 0 : (size_t)UBX_RXM_MEASX2_DATA0(payload)->numSV < ((size_t)(len) - 44) / 28 ? (size_t)UBX_RXM_MEASX2_DATA0(payload)->numSV : ((size_t)(len) - 44) / 28)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-SVSI-DATA0 svInfo (6 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t svid;                       // 0
+    union {
+        uint8_t svFlag;                 // 1
+        struct {
+            uint8_t ura : 4;                // bit 0..3
+            uint8_t healthy : 1;            // bit 4
+            uint8_t ephVal : 1;             // bit 5
+            uint8_t almVal : 1;             // bit 6
+            uint8_t notAvail : 1;           // bit 7
+        };
+    };
+    int16_t azim;                       // 2
+    int8_t elev;                        // 4
+    union {
+        uint8_t age;                    // 5
+        struct {
+            uint8_t almAge : 4;             // bit 0..3
+            uint8_t ephAge : 4;             // bit 4..7
+        };
+    };
+} ubx_rxm_svsi_data0_svinfo_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_svsi_data0_svinfo_t, 6);
+
+// UBX-RXM-SVSI-DATA0 payload (8 + numSV*6 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    int16_t week;                       // 4: weeks
+    uint8_t numVis;                     // 6
+    uint8_t numSV;                      // 7
+    ubx_rxm_svsi_data0_svinfo_t svInfo[];// 8: repeated
+} ubx_rxm_svsi_data0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_svsi_data0_t, 8);
+
+#define UBX_RXM_SVSI_DATA0(payload)             ((const ubx_rxm_svsi_data0_t *)(payload))
+#define UBX_RXM_SVSI_DATA0_SIZE                 8
+#define UBX_RXM_SVSI_DATA0_SVINFO(payload, i)   ((const ubx_rxm_svsi_data0_svinfo_t *)((const uint8_t *)(payload) + 8 + (size_t)(i) * 6))
+#define UBX_RXM_SVSI_DATA0_SVINFO_COUNT(payload, len) \
+    ((size_t)(len) <= 8 ? 0 : (size_t)UBX_RXM_SVSI_DATA0(payload)->numSV < ((size_t)(len) - 8) / 6 ? (size_t)UBX_RXM_SVSI_DATA0(payload)->numSV : ((size_t)(len) - 8) / 6)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-ALM-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_rxm_alm_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_alm_poll0_t, 0);
+
+#define UBX_RXM_ALM_POLL0(payload)              ((const ubx_rxm_alm_poll0_t *)(payload))
+#define UBX_RXM_ALM_POLL0_SIZE                  0
+#define UBX_RXM_ALM_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x02, 0x30, ubx_rxm_alm_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-ALM-POLLID payload (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t svid;                       // 0
+} ubx_rxm_alm_pollid_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_alm_pollid_t, 1);
+
+#define UBX_RXM_ALM_POLLID(payload)             ((const ubx_rxm_alm_pollid_t *)(payload))
+#define UBX_RXM_ALM_POLLID_SIZE                 1
+#define UBX_RXM_ALM_POLLID_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x02, 0x30, ubx_rxm_alm_pollid_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-ALM-DATA1 payload (8 + 32 optional bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t svid;                      // 0
+    uint32_t week;                      // 4
+    uint32_t dwrd[8];                   // 8
+} ubx_rxm_alm_data1_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_alm_data1_t, 40);
+
+#define UBX_RXM_ALM_DATA1(payload)              ((const ubx_rxm_alm_data1_t *)(payload))
+#define UBX_RXM_ALM_DATA1_SIZE                  40
+#define UBX_RXM_ALM_DATA1_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x02, 0x30, ubx_rxm_alm_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-EPH-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_rxm_eph_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_eph_poll0_t, 0);
+
+#define UBX_RXM_EPH_POLL0(payload)              ((const ubx_rxm_eph_poll0_t *)(payload))
+#define UBX_RXM_EPH_POLL0_SIZE                  0
+#define UBX_RXM_EPH_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x02, 0x31, ubx_rxm_eph_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-EPH-POLLID payload (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t svid;                       // 0
+} ubx_rxm_eph_pollid_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_eph_pollid_t, 1);
+
+#define UBX_RXM_EPH_POLLID(payload)             ((const ubx_rxm_eph_pollid_t *)(payload))
+#define UBX_RXM_EPH_POLLID_SIZE                 1
+#define UBX_RXM_EPH_POLLID_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x02, 0x31, ubx_rxm_eph_pollid_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-EPH-DATA1 payload (8 + 96 optional bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t svid;                      // 0
+    uint32_t how;                       // 4
+    uint32_t sf1d[8];                   // 8
+    uint32_t sf2d[8];                   // 40
+    uint32_t sf3d[8];                   // 72
+} ubx_rxm_eph_data1_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_eph_data1_t, 104);
+
+#define UBX_RXM_EPH_DATA1(payload)              ((const ubx_rxm_eph_data1_t *)(payload))
+#define UBX_RXM_EPH_DATA1_SIZE                  104
+#define UBX_RXM_EPH_DATA1_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x02, 0x31, ubx_rxm_eph_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-RTCM-DATA1 payload (8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    union {
+        uint8_t flags;                  // 1
+        struct {
+            uint8_t crcFailed : 1;          // bit 0
+            uint8_t msgUsed : 2;            // bit 1..2
+            uint8_t : 5;
+        };
+    };
+    uint16_t subType;                   // 2
+    uint16_t refStation;                // 4
+    uint16_t msgType;                   // 6
+} ubx_rxm_rtcm_data1_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_rtcm_data1_t, 8);
+
+#define UBX_RXM_RTCM_DATA1(payload)             ((const ubx_rxm_rtcm_data1_t *)(payload))
+#define UBX_RXM_RTCM_DATA1_SIZE                 8
+#define UBX_RXM_RTCM_DATA1_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x02, 0x32, ubx_rxm_rtcm_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-SPARTN-DATA0 payload (8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    union {
+        uint8_t flags;                  // 1
+        struct {
+            uint8_t : 1;
+            uint8_t msgUsed : 2;            // bit 1..2
+            uint8_t : 5;
+        };
+    };
+    uint16_t subType;                   // 2
+    uint8_t reserved0[2];               // 4
+    uint16_t msgType;                   // 6
+} ubx_rxm_spartn_data0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_spartn_data0_t, 8);
+
+#define UBX_RXM_SPARTN_DATA0(payload)           ((const ubx_rxm_spartn_data0_t *)(payload))
+#define UBX_RXM_SPARTN_DATA0_SIZE               8
+#define UBX_RXM_SPARTN_DATA0_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, 0x02, 0x33, ubx_rxm_spartn_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-COR-DATA0 payload (12 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t ebno;                       // 1: dB, *2^-3
+    uint8_t reserved0;                  // 2
+    uint8_t reserved1;                  // 3
+    union {
+        uint32_t statusInfo;            // 4
+        struct {
+            uint32_t protocol : 5;          // bit 0..4
+            uint32_t errStatus : 2;         // bit 5..6
+            uint32_t msgUsed : 2;           // bit 7..8
+            uint32_t correctionId : 16;     // bit 9..24
+            uint32_t msgTypeValid : 1;      // bit 25
+            uint32_t msgSubTypeValid : 1;   // bit 26
+            uint32_t msgInputHandle : 1;    // bit 27
+            uint32_t msgEncrypted : 2;      // bit 28..29
+            uint32_t msgDecrypted : 2;      // bit 30..31
+        };
+    };
+    uint16_t msgType;                   // 8
+    uint16_t msgSubType;                // 10
+} ubx_rxm_cor_data0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_cor_data0_t, 12);
+
+#define UBX_RXM_COR_DATA0(payload)              ((const ubx_rxm_cor_data0_t *)(payload))
+#define UBX_RXM_COR_DATA0_SIZE                  12
+#define UBX_RXM_COR_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x02, 0x34, ubx_rxm_cor_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-SPARTNKEY-DATA0 keysDescription (8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t reserved1;                  // 0
+    uint8_t keyLengthBytes;             // 1
+    uint16_t validFromWno;              // 2: week
+    uint32_t validFromTow;              // 4: sec
+} ubx_rxm_spartnkey_data0_keysdescription_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_spartnkey_data0_keysdescription_t, 8);
+
+// UBX-RXM-SPARTNKEY-DATA0 keysPayload (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t key;                        // 0
+} ubx_rxm_spartnkey_data0_keyspayload_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_spartnkey_data0_keyspayload_t, 1);
+
+// UBX-RXM-SPARTNKEY-DATA0 payload (4 + numKeys*8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t numKeys;                    // 1
+    uint8_t reserved0[2];               // 2
+    ubx_rxm_spartnkey_data0_keysdescription_t keysDescription[];// 4: repeated
+} ubx_rxm_spartnkey_data0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_spartnkey_data0_t, 4);
+
+#define UBX_RXM_SPARTNKEY_DATA0(payload)        ((const ubx_rxm_spartnkey_data0_t *)(payload))
+#define UBX_RXM_SPARTNKEY_DATA0_SIZE            4
+#define UBX_RXM_SPARTNKEY_DATA0_KEYSDESCRIPTION(payload, i)((const ubx_rxm_spartnkey_data0_keysdescription_t *)((const uint8_t *)(payload) + 4 + (size_t)(i) * 8))
+#define UBX_RXM_SPARTNKEY_DATA0_KEYSDESCRIPTION_COUNT(payload, len) \
+    ((size_t)(len) <= 4 ? 0 : (size_t)UBX_RXM_SPARTNKEY_DATA0(payload)->numKeys < ((size_t)(len) - 4) / 8 ? (size_t)UBX_RXM_SPARTNKEY_DATA0(payload)->numKeys : ((size_t)(len) - 4) / 8)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-SPARTNKEY-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_rxm_spartnkey_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_spartnkey_poll0_t, 0);
+
+#define UBX_RXM_SPARTNKEY_POLL0(payload)        ((const ubx_rxm_spartnkey_poll0_t *)(payload))
+#define UBX_RXM_SPARTNKEY_POLL0_SIZE            0
+#define UBX_RXM_SPARTNKEY_POLL0_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x02, 0x36, ubx_rxm_spartnkey_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-PMREQ-0 payload (8 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t duration;                  // 0: ms
+    union {
+        uint32_t flags;                 // 4
+        struct {
+            uint32_t : 1;
+            uint32_t backup : 1;            // bit 1
+            uint32_t : 30;
+        };
+    };
+} ubx_rxm_pmreq_0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_pmreq_0_t, 8);
+
+#define UBX_RXM_PMREQ_0(payload)                ((const ubx_rxm_pmreq_0_t *)(payload))
+#define UBX_RXM_PMREQ_0_SIZE                    8
+#define UBX_RXM_PMREQ_0_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x02, 0x41, ubx_rxm_pmreq_0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-PMREQ-1 payload (16 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0[3];               // 1
+    uint32_t duration;                  // 4: ms
+    union {
+        uint32_t flags;                 // 8
+        struct {
+            uint32_t : 1;
+            uint32_t backup : 1;            // bit 1
+            uint32_t force : 1;             // bit 2
+            uint32_t : 29;
+        };
+    };
+    union {
+        uint32_t wakeupSources;         // 12
+        struct {
+            uint32_t : 3;
+            uint32_t uartrx : 1;            // bit 3
+            uint32_t : 1;
+            uint32_t extint0 : 1;           // bit 5
+            uint32_t extint1 : 1;           // bit 6
+            uint32_t spics : 1;             // bit 7
+            uint32_t : 24;
+        };
+    };
+} ubx_rxm_pmreq_1_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_pmreq_1_t, 16);
+
+#define UBX_RXM_PMREQ_1(payload)                ((const ubx_rxm_pmreq_1_t *)(payload))
+#define UBX_RXM_PMREQ_1_SIZE                    16
+#define UBX_RXM_PMREQ_1_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x02, 0x41, ubx_rxm_pmreq_1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-RLM-SHORT payload (16 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t type;                       // 1
+    uint8_t svId;                       // 2
+    uint8_t reserved0;                  // 3
+    uint8_t beacon[8];                  // 4
+    uint8_t message;                    // 12
+    uint8_t params[2];                  // 13
+    uint8_t reserved1;                  // 15
+} ubx_rxm_rlm_short_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_rlm_short_t, 16);
+
+#define UBX_RXM_RLM_SHORT(payload)              ((const ubx_rxm_rlm_short_t *)(payload))
+#define UBX_RXM_RLM_SHORT_SIZE                  16
+#define UBX_RXM_RLM_SHORT_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x02, 0x59, ubx_rxm_rlm_short_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-RLM-LONG payload (28 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t type;                       // 1
+    uint8_t svId;                       // 2
+    uint8_t reserved0;                  // 3
+    uint8_t beacon[8];                  // 4
+    uint8_t message;                    // 12
+    uint8_t params[12];                 // 13
+    uint8_t reserved1[3];               // 25
+} ubx_rxm_rlm_long_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_rlm_long_t, 28);
+
+#define UBX_RXM_RLM_LONG(payload)               ((const ubx_rxm_rlm_long_t *)(payload))
+#define UBX_RXM_RLM_LONG_SIZE                   28
+#define UBX_RXM_RLM_LONG_TYPED(name, ...)       UBX_MESSAGE_TYPED(name, 0x02, 0x59, ubx_rxm_rlm_long_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-IMES-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_rxm_imes_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_imes_poll0_t, 0);
+
+#define UBX_RXM_IMES_POLL0(payload)             ((const ubx_rxm_imes_poll0_t *)(payload))
+#define UBX_RXM_IMES_POLL0_SIZE                 0
+#define UBX_RXM_IMES_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x02, 0x61, ubx_rxm_imes_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-IMES-DATA0 txs (44 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t reserved1;                  // 0
+    uint8_t txId;                       // 1
+    uint8_t reserved2[3];               // 2
+    uint8_t cno;                        // 5: dBHz
+    uint8_t reserved3[2];               // 6
+    int32_t doppler;                    // 8: Hz, *2^-12
+    union {
+        uint32_t position1_1;           // 12
+        struct {
+            uint32_t pos1Floor : 8;         // bit 0..7
+            int32_t pos1Lat : 23;           // bit 8..30
+            uint32_t : 1;
+        };
+    };
+    union {
+        uint32_t position1_2;           // 16
+        struct {
+            int32_t pos1Lon : 24;           // bit 0..23
+            uint32_t pos1Valid : 1;         // bit 24
+            uint32_t : 7;
+        };
+    };
+    union {
+        uint32_t position2_1;           // 20
+        struct {
+            uint32_t pos2Floor : 9;         // bit 0..8
+            uint32_t pos2Alt : 12;          // bit 9..20
+            uint32_t pos2Acc : 2;           // bit 21..22
+            uint32_t pos2Valid : 1;         // bit 23
+            uint32_t : 8;
+        };
+    };
+    int32_t lat;                        // 24: deg, *180*2^-24
+    int32_t lon;                        // 28: deg, *360*2^-25
+    union {
+        uint32_t shortIdFrame;          // 32
+        struct {
+            uint32_t shortId : 12;          // bit 0..11
+            uint32_t shortValid : 1;        // bit 12
+            uint32_t shortBoundary : 1;     // bit 13
+            uint32_t : 18;
+        };
+    };
+    uint32_t mediumIdLSB;               // 36
+    union {
+        uint32_t mediumId_2;            // 40
+        struct {
+            uint32_t mediumIdMSB : 1;       // bit 0
+            uint32_t mediumValid : 1;       // bit 1
+            uint32_t mediumboundary : 1;    // bit 2
+            uint32_t : 29;
+        };
+    };
+} ubx_rxm_imes_data0_txs_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_imes_data0_txs_t, 44);
+
+// UBX-RXM-IMES-DATA0 payload (4 + numTx*44 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t numTx;                      // 0
+    uint8_t version;                    // 1
+    uint8_t reserved0[2];               // 2
+    ubx_rxm_imes_data0_txs_t txs[];     // 4: repeated
+} ubx_rxm_imes_data0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_imes_data0_t, 4);
+
+#define UBX_RXM_IMES_DATA0(payload)             ((const ubx_rxm_imes_data0_t *)(payload))
+#define UBX_RXM_IMES_DATA0_SIZE                 4
+#define UBX_RXM_IMES_DATA0_TXS(payload, i)      ((const ubx_rxm_imes_data0_txs_t *)((const uint8_t *)(payload) + 4 + (size_t)(i) * 44))
+#define UBX_RXM_IMES_DATA0_TXS_COUNT(payload, len) \
+    ((size_t)(len) <= 4 ? 0 : (size_t)UBX_RXM_IMES_DATA0(payload)->numTx < ((size_t)(len) - 4) / 44 ? (size_t)UBX_RXM_IMES_DATA0(payload)->numTx : ((size_t)(len) - 4) / 44)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-PMP-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_rxm_pmp_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_pmp_poll0_t, 0);
+
+#define UBX_RXM_PMP_POLL0(payload)              ((const ubx_rxm_pmp_poll0_t *)(payload))
+#define UBX_RXM_PMP_POLL0_SIZE                  0
+#define UBX_RXM_PMP_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x02, 0x72, ubx_rxm_pmp_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-PMP-DATA0 payload (528 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0[3];               // 1
+    uint32_t timeTag;                   // 4: ms
+    uint32_t uniqueWord[2];             // 8
+    uint16_t serviceIdentifier;         // 16
+    uint8_t spare;                      // 18
+    uint8_t uniqueWordBitErrors;        // 19
+    uint8_t userData[504];              // 20
+    uint16_t fecBits;                   // 524
+    uint8_t ebno;                       // 526: dB, *2^-3
+    uint8_t reserved1;                  // 527
+} ubx_rxm_pmp_data0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_pmp_data0_t, 528);
+
+#define UBX_RXM_PMP_DATA0(payload)              ((const ubx_rxm_pmp_data0_t *)(payload))
+#define UBX_RXM_PMP_DATA0_SIZE                  528
+#define UBX_RXM_PMP_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x02, 0x72, ubx_rxm_pmp_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-PMP-DATA1 group1 (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t userData;                   // 0
+} ubx_rxm_pmp_data1_group1_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_pmp_data1_group1_t, 1);
+
+// UBX-RXM-PMP-DATA1 payload (24 + n*1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0;                  // 1
+    uint16_t numBytesUserData;          // 2
+    uint32_t timeTag;                   // 4: ms
+    uint32_t uniqueWord[2];             // 8
+    uint16_t serviceIdentifier;         // 16
+    uint8_t spare;                      // 18
+    uint8_t uniqueWordBitErrors;        // 19
+    uint16_t fecBits;                   // 20
+    uint8_t ebno;                       // 22: dB, *2^-3
+    uint8_t reserved1;                  // 23
+    ubx_rxm_pmp_data1_group1_t group1[];// 24: repeated
+} ubx_rxm_pmp_data1_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_pmp_data1_t, 24);
+
+#define UBX_RXM_PMP_DATA1(payload)              ((const ubx_rxm_pmp_data1_t *)(payload))
+#define UBX_RXM_PMP_DATA1_SIZE                  24
+#define UBX_RXM_PMP_DATA1_GROUP1(payload, i)    ((const ubx_rxm_pmp_data1_group1_t *)((const uint8_t *)(payload) + 24 + (size_t)(i) * 1))
+#define UBX_RXM_PMP_DATA1_GROUP1_COUNT(payload, len)((size_t)(len) > 24 ? ((size_t)(len) - 24) / 1 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-PMP-DATA2 group1 (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t userData;                   // 0
+} ubx_rxm_pmp_data2_group1_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_pmp_data2_group1_t, 1);
+
+// UBX-RXM-PMP-DATA2 payload (24 + n*1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0;                  // 1
+    uint16_t numBytesUserData;          // 2
+    uint32_t timeTag;                   // 4: ms
+    uint32_t uniqueWord[2];             // 8
+    uint16_t serviceIdentifier;         // 16
+    uint8_t spare;                      // 18
+    uint8_t uniqueWordBitErrors;        // 19
+    uint16_t fecBits;                   // 20
+    uint8_t ebno;                       // 22: dB, *2^-3
+    uint8_t reserved1;                  // 23
+    ubx_rxm_pmp_data2_group1_t group1[];// 24: repeated
+} ubx_rxm_pmp_data2_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_pmp_data2_t, 24);
+
+#define UBX_RXM_PMP_DATA2(payload)              ((const ubx_rxm_pmp_data2_t *)(payload))
+#define UBX_RXM_PMP_DATA2_SIZE                  24
+#define UBX_RXM_PMP_DATA2_GROUP1(payload, i)    ((const ubx_rxm_pmp_data2_group1_t *)((const uint8_t *)(payload) + 24 + (size_t)(i) * 1))
+#define UBX_RXM_PMP_DATA2_GROUP1_COUNT(payload, len)((size_t)(len) > 24 ? ((size_t)(len) - 24) / 1 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-QZSSL6-DATA1 payload (264 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t svId;                       // 1
+    uint16_t cno;                       // 2: dBHz, *2^-8
+    uint32_t timeTag;                   // 4: ms
+    uint8_t groupDelay;                 // 8: ns
+    uint8_t bitErrCorr;                 // 9
+    union {
+        uint16_t chInfo;                // 10
+        struct {
+            uint16_t : 8;
+            uint16_t chn : 2;               // bit 8..9
+            uint16_t msgName : 1;           // bit 10
+            uint16_t : 1;
+            uint16_t errStatus : 2;         // bit 12..13
+            uint16_t chName : 2;            // bit 14..15
+        };
+    };
+    uint8_t reserved0[2];               // 12
+    uint8_t msgBytes[250];              // 14
+} ubx_rxm_qzssl6_data1_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_qzssl6_data1_t, 264);
+
+#define UBX_RXM_QZSSL6_DATA1(payload)           ((const ubx_rxm_qzssl6_data1_t *)(payload))
+#define UBX_RXM_QZSSL6_DATA1_SIZE               264
+#define UBX_RXM_QZSSL6_DATA1_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, 0x02, 0x73, ubx_rxm_qzssl6_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-QZSSL6-DATA2 payload (264 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t svId;                       // 1
+    uint16_t cno;                       // 2: dBHz, *2^-8
+    uint32_t timeTag;                   // 4: ms
+    uint8_t groupDelay;                 // 8: ns
+    uint8_t bitErrCorr;                 // 9
+    union {
+        uint16_t chInfo;                // 10
+        struct {
+            uint16_t : 8;
+            uint16_t chn : 2;               // bit 8..9
+            uint16_t msgName : 1;           // bit 10
+            uint16_t : 1;
+            uint16_t errStatus : 2;         // bit 12..13
+            uint16_t chName : 2;            // bit 14..15
+        };
+    };
+    uint8_t reserved0[2];               // 12
+    uint8_t msgBytes[250];              // 14
+} ubx_rxm_qzssl6_data2_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_qzssl6_data2_t, 264);
+
+#define UBX_RXM_QZSSL6_DATA2(payload)           ((const ubx_rxm_qzssl6_data2_t *)(payload))
+#define UBX_RXM_QZSSL6_DATA2_SIZE               264
+#define UBX_RXM_QZSSL6_DATA2_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, 0x02, 0x73, ubx_rxm_qzssl6_data2_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-TM-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_rxm_tm_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_tm_poll0_t, 0);
+
+#define UBX_RXM_TM_POLL0(payload)               ((const ubx_rxm_tm_poll0_t *)(payload))
+#define UBX_RXM_TM_POLL0_SIZE                   0
+#define UBX_RXM_TM_POLL0_TYPED(name, ...)       UBX_MESSAGE_TYPED(name, 0x02, 0x74, ubx_rxm_tm_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-TM-DATA0 edgeMeas (24 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint32_t edgeInfo;              // 0
+        struct {
+            uint32_t channel : 4;           // bit 0..3
+            uint32_t edgeType : 1;          // bit 4
+            uint32_t : 27;
+        };
+    };
+    uint16_t count;                     // 4
+    uint16_t wno;                       // 6
+    uint32_t towMs;                     // 8: ms
+    uint32_t towSubMsR;                 // 12: ps
+    uint8_t reserved2[4];               // 16
+    uint8_t reserved3[4];               // 20
+} ubx_rxm_tm_data0_edgemeas_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_tm_data0_edgemeas_t, 24);
+
+// UBX-RXM-TM-DATA0 payload (8 + numMeas*24 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t numMeas;                    // 1
+    uint8_t reserved0[2];               // 2
+    uint8_t reserved1[4];               // 4
+    ubx_rxm_tm_data0_edgemeas_t edgeMeas[];// 8: repeated
+} ubx_rxm_tm_data0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_tm_data0_t, 8);
+
+#define UBX_RXM_TM_DATA0(payload)               ((const ubx_rxm_tm_data0_t *)(payload))
+#define UBX_RXM_TM_DATA0_SIZE                   8
+#define UBX_RXM_TM_DATA0_EDGEMEAS(payload, i)   ((const ubx_rxm_tm_data0_edgemeas_t *)((const uint8_t *)(payload) + 8 + (size_t)(i) * 24))
+#define UBX_RXM_TM_DATA0_EDGEMEAS_COUNT(payload, len) \
+    ((size_t)(len) <= 8 ? 0 : (size_t)UBX_RXM_TM_DATA0(payload)->numMeas < ((size_t)(len) - 8) / 24 ? (size_t)UBX_RXM_TM_DATA0(payload)->numMeas : ((size_t)(len) - 8) / 24)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-MEASD12-DATA0 group0 (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t payload;                    // 0
+} ubx_rxm_measd12_data0_group0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_measd12_data0_group0_t, 1);
+
+// UBX-RXM-MEASD12-DATA0 payload (n*1 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_rxm_measd12_data0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_measd12_data0_t, 0);
+
+#define UBX_RXM_MEASD12_DATA0(payload)          ((const ubx_rxm_measd12_data0_t *)(payload))
+#define UBX_RXM_MEASD12_DATA0_SIZE              0
+#define UBX_RXM_MEASD12_DATA0_GROUP0(payload, i)((const ubx_rxm_measd12_data0_group0_t *)((const uint8_t *)(payload) + 0 + (size_t)(i) * 1))
+#define UBX_RXM_MEASD12_DATA0_GROUP0_COUNT(payload, len)((size_t)(len) > 0 ? ((size_t)(len) - 0) / 1 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-MEASC12-DATA0 group0 (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t payload;                    // 0
+} ubx_rxm_measc12_data0_group0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_measc12_data0_group0_t, 1);
+
+// UBX-RXM-MEASC12-DATA0 payload (n*1 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_rxm_measc12_data0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_measc12_data0_t, 0);
+
+#define UBX_RXM_MEASC12_DATA0(payload)          ((const ubx_rxm_measc12_data0_t *)(payload))
+#define UBX_RXM_MEASC12_DATA0_SIZE              0
+#define UBX_RXM_MEASC12_DATA0_GROUP0(payload, i)((const ubx_rxm_measc12_data0_group0_t *)((const uint8_t *)(payload) + 0 + (size_t)(i) * 1))
+#define UBX_RXM_MEASC12_DATA0_GROUP0_COUNT(payload, len)((size_t)(len) > 0 ? ((size_t)(len) - 0) / 1 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-MEAS20-DATA0 group0 (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t payload;                    // 0
+} ubx_rxm_meas20_data0_group0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_meas20_data0_group0_t, 1);
+
+// UBX-RXM-MEAS20-DATA0 payload (n*1 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_rxm_meas20_data0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_meas20_data0_t, 0);
+
+#define UBX_RXM_MEAS20_DATA0(payload)           ((const ubx_rxm_meas20_data0_t *)(payload))
+#define UBX_RXM_MEAS20_DATA0_SIZE               0
+#define UBX_RXM_MEAS20_DATA0_GROUP0(payload, i) ((const ubx_rxm_meas20_data0_group0_t *)((const uint8_t *)(payload) + 0 + (size_t)(i) * 1))
+#define UBX_RXM_MEAS20_DATA0_GROUP0_COUNT(payload, len)((size_t)(len) > 0 ? ((size_t)(len) - 0) / 1 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-RXM-MEAS50-DATA0 group0 (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t payload;                    // 0
+} ubx_rxm_meas50_data0_group0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_meas50_data0_group0_t, 1);
+
+// UBX-RXM-MEAS50-DATA0 payload (n*1 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_rxm_meas50_data0_t;
+UBX_PAYLOAD_SIZE(ubx_rxm_meas50_data0_t, 0);
+
+#define UBX_RXM_MEAS50_DATA0(payload)           ((const ubx_rxm_meas50_data0_t *)(payload))
+#define UBX_RXM_MEAS50_DATA0_SIZE               0
+#define UBX_RXM_MEAS50_DATA0_GROUP0(payload, i) ((const ubx_rxm_meas50_data0_group0_t *)((const uint8_t *)(payload) + 0 + (size_t)(i) * 1))
+#define UBX_RXM_MEAS50_DATA0_GROUP0_COUNT(payload, len)((size_t)(len) > 0 ? ((size_t)(len) - 0) / 1 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-INF-ERROR-DATA0 group0 (1 bytes)
+typedef struct __attribute__((packed)) {
+    char str;                           // 0
+} ubx_inf_error_data0_group0_t;
+UBX_PAYLOAD_SIZE(ubx_inf_error_data0_group0_t, 1);
+
+// UBX-INF-ERROR-DATA0 payload (n*1 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_inf_error_data0_t;
+UBX_PAYLOAD_SIZE(ubx_inf_error_data0_t, 0);
+
+#define UBX_INF_ERROR_DATA0(payload)            ((const ubx_inf_error_data0_t *)(payload))
+#define UBX_INF_ERROR_DATA0_SIZE                0
+#define UBX_INF_ERROR_DATA0_GROUP0(payload, i)  ((const ubx_inf_error_data0_group0_t *)((const uint8_t *)(payload) + 0 + (size_t)(i) * 1))
+#define UBX_INF_ERROR_DATA0_GROUP0_COUNT(payload, len)((size_t)(len) > 0 ? ((size_t)(len) - 0) / 1 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-INF-WARNING-DATA0 group0 (1 bytes)
+typedef struct __attribute__((packed)) {
+    char str;                           // 0
+} ubx_inf_warning_data0_group0_t;
+UBX_PAYLOAD_SIZE(ubx_inf_warning_data0_group0_t, 1);
+
+// UBX-INF-WARNING-DATA0 payload (n*1 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_inf_warning_data0_t;
+UBX_PAYLOAD_SIZE(ubx_inf_warning_data0_t, 0);
+
+#define UBX_INF_WARNING_DATA0(payload)          ((const ubx_inf_warning_data0_t *)(payload))
+#define UBX_INF_WARNING_DATA0_SIZE              0
+#define UBX_INF_WARNING_DATA0_GROUP0(payload, i)((const ubx_inf_warning_data0_group0_t *)((const uint8_t *)(payload) + 0 + (size_t)(i) * 1))
+#define UBX_INF_WARNING_DATA0_GROUP0_COUNT(payload, len)((size_t)(len) > 0 ? ((size_t)(len) - 0) / 1 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-INF-NOTICE-DATA0 group0 (1 bytes)
+typedef struct __attribute__((packed)) {
+    char str;                           // 0
+} ubx_inf_notice_data0_group0_t;
+UBX_PAYLOAD_SIZE(ubx_inf_notice_data0_group0_t, 1);
+
+// UBX-INF-NOTICE-DATA0 payload (n*1 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_inf_notice_data0_t;
+UBX_PAYLOAD_SIZE(ubx_inf_notice_data0_t, 0);
+
+#define UBX_INF_NOTICE_DATA0(payload)           ((const ubx_inf_notice_data0_t *)(payload))
+#define UBX_INF_NOTICE_DATA0_SIZE               0
+#define UBX_INF_NOTICE_DATA0_GROUP0(payload, i) ((const ubx_inf_notice_data0_group0_t *)((const uint8_t *)(payload) + 0 + (size_t)(i) * 1))
+#define UBX_INF_NOTICE_DATA0_GROUP0_COUNT(payload, len)((size_t)(len) > 0 ? ((size_t)(len) - 0) / 1 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-INF-TEST-DATA0 group0 (1 bytes)
+typedef struct __attribute__((packed)) {
+    char str;                           // 0
+} ubx_inf_test_data0_group0_t;
+UBX_PAYLOAD_SIZE(ubx_inf_test_data0_group0_t, 1);
+
+// UBX-INF-TEST-DATA0 payload (n*1 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_inf_test_data0_t;
+UBX_PAYLOAD_SIZE(ubx_inf_test_data0_t, 0);
+
+#define UBX_INF_TEST_DATA0(payload)             ((const ubx_inf_test_data0_t *)(payload))
+#define UBX_INF_TEST_DATA0_SIZE                 0
+#define UBX_INF_TEST_DATA0_GROUP0(payload, i)   ((const ubx_inf_test_data0_group0_t *)((const uint8_t *)(payload) + 0 + (size_t)(i) * 1))
+#define UBX_INF_TEST_DATA0_GROUP0_COUNT(payload, len)((size_t)(len) > 0 ? ((size_t)(len) - 0) / 1 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-INF-DEBUG-DATA0 group0 (1 bytes)
+typedef struct __attribute__((packed)) {
+    char str;                           // 0
+} ubx_inf_debug_data0_group0_t;
+UBX_PAYLOAD_SIZE(ubx_inf_debug_data0_group0_t, 1);
+
+// UBX-INF-DEBUG-DATA0 payload (n*1 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_inf_debug_data0_t;
+UBX_PAYLOAD_SIZE(ubx_inf_debug_data0_t, 0);
+
+#define UBX_INF_DEBUG_DATA0(payload)            ((const ubx_inf_debug_data0_t *)(payload))
+#define UBX_INF_DEBUG_DATA0_SIZE                0
+#define UBX_INF_DEBUG_DATA0_GROUP0(payload, i)  ((const ubx_inf_debug_data0_group0_t *)((const uint8_t *)(payload) + 0 + (size_t)(i) * 1))
+#define UBX_INF_DEBUG_DATA0_GROUP0_COUNT(payload, len)((size_t)(len) > 0 ? ((size_t)(len) - 0) / 1 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-ACK-NAK-DATA0 payload (2 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t clsID;                      // 0
+    uint8_t msgID;                      // 1
+} ubx_ack_nak_data0_t;
+UBX_PAYLOAD_SIZE(ubx_ack_nak_data0_t, 2);
+
+#define UBX_ACK_NAK_DATA0(payload)              ((const ubx_ack_nak_data0_t *)(payload))
+#define UBX_ACK_NAK_DATA0_SIZE                  2
+#define UBX_ACK_NAK_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x05, 0x00, ubx_ack_nak_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-ACK-ACK-DATA0 payload (2 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t clsID;                      // 0
+    uint8_t msgID;                      // 1
+} ubx_ack_ack_data0_t;
+UBX_PAYLOAD_SIZE(ubx_ack_ack_data0_t, 2);
+
+#define UBX_ACK_ACK_DATA0(payload)              ((const ubx_ack_ack_data0_t *)(payload))
+#define UBX_ACK_ACK_DATA0_SIZE                  2
+#define UBX_ACK_ACK_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x05, 0x01, ubx_ack_ack_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-PRT-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_prt_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_prt_poll0_t, 0);
+
+#define UBX_CFG_PRT_POLL0(payload)              ((const ubx_cfg_prt_poll0_t *)(payload))
+#define UBX_CFG_PRT_POLL0_SIZE                  0
+#define UBX_CFG_PRT_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x00, ubx_cfg_prt_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-PRT-POLLID payload (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t PortID;                     // 0
+} ubx_cfg_prt_pollid_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_prt_pollid_t, 1);
+
+#define UBX_CFG_PRT_POLLID(payload)             ((const ubx_cfg_prt_pollid_t *)(payload))
+#define UBX_CFG_PRT_POLLID_SIZE                 1
+#define UBX_CFG_PRT_POLLID_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x06, 0x00, ubx_cfg_prt_pollid_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-PRT-UART payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t portID;                     // 0
+    uint8_t reserved0;                  // 1
+    union {
+        uint16_t txReady;               // 2
+        struct {
+            uint16_t en : 1;                // bit 0
+            uint16_t pol : 1;               // bit 1
+            uint16_t pin : 5;               // bit 2..6
+            uint16_t thres : 9;             // bit 7..15
+        };
+    };
+    union {
+        uint32_t mode;                  // 4
+        struct {
+            uint32_t : 6;
+            uint32_t charLen : 2;           // bit 6..7
+            uint32_t : 1;
+            uint32_t parity : 3;            // bit 9..11
+            uint32_t nStopBits : 2;         // bit 12..13
+            uint32_t : 18;
+        };
+    };
+    uint32_t baudRate;                  // 8: Bits/s
+    union {
+        uint16_t inProtoMask;           // 12
+        struct {
+            uint16_t inUbx : 1;             // bit 0
+            uint16_t inNmea : 1;            // bit 1
+            uint16_t inRtcm : 1;            // bit 2
+            uint16_t : 2;
+            uint16_t inRtcm3 : 1;           // bit 5
+            uint16_t : 10;
+        };
+    };
+    union {
+        uint16_t outProtoMask;          // 14
+        struct {
+            uint16_t outUbx : 1;            // bit 0
+            uint16_t outNmea : 1;           // bit 1
+            uint16_t : 3;
+            uint16_t outRtcm3 : 1;          // bit 5
+            uint16_t : 10;
+        };
+    };
+    union {
+        uint16_t flags;                 // 16
+        struct {
+            uint16_t : 1;
+            uint16_t extendedTxTimeout : 1; // bit 1
+            uint16_t : 14;
+        };
+    };
+    uint8_t reserved1[2];               // 18
+} ubx_cfg_prt_uart_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_prt_uart_t, 20);
+
+#define UBX_CFG_PRT_UART(payload)               ((const ubx_cfg_prt_uart_t *)(payload))
+#define UBX_CFG_PRT_UART_SIZE                   20
+#define UBX_CFG_PRT_UART_TYPED(name, ...)       UBX_MESSAGE_TYPED(name, 0x06, 0x00, ubx_cfg_prt_uart_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-PRT-USB payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t portID;                     // 0
+    uint8_t reserved0;                  // 1
+    union {
+        uint16_t txReady;               // 2
+        struct {
+            uint16_t en : 1;                // bit 0
+            uint16_t pol : 1;               // bit 1
+            uint16_t pin : 5;               // bit 2..6
+            uint16_t thres : 9;             // bit 7..15
+        };
+    };
+    uint8_t reserved1[8];               // 4
+    union {
+        uint16_t inProtoMask;           // 12
+        struct {
+            uint16_t inUbx : 1;             // bit 0
+            uint16_t inNmea : 1;            // bit 1
+            uint16_t inRtcm : 1;            // bit 2
+            uint16_t : 2;
+            uint16_t inRtcm3 : 1;           // bit 5
+            uint16_t : 10;
+        };
+    };
+    union {
+        uint16_t outProtoMask;          // 14
+        struct {
+            uint16_t outUbx : 1;            // bit 0
+            uint16_t outNmea : 1;           // bit 1
+            uint16_t : 3;
+            uint16_t outRtcm3 : 1;          // bit 5
+            uint16_t : 10;
+        };
+    };
+    uint8_t reserved2[2];               // 16
+    uint8_t reserved3[2];               // 18
+} ubx_cfg_prt_usb_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_prt_usb_t, 20);
+
+#define UBX_CFG_PRT_USB(payload)                ((const ubx_cfg_prt_usb_t *)(payload))
+#define UBX_CFG_PRT_USB_SIZE                    20
+#define UBX_CFG_PRT_USB_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x06, 0x00, ubx_cfg_prt_usb_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-PRT-SPI payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t portID;                     // 0
+    uint8_t reserved0;                  // 1
+    union {
+        uint16_t txReady;               // 2
+        struct {
+            uint16_t en : 1;                // bit 0
+            uint16_t pol : 1;               // bit 1
+            uint16_t pin : 5;               // bit 2..6
+            uint16_t thres : 9;             // bit 7..15
+        };
+    };
+    union {
+        uint32_t mode;                  // 4
+        struct {
+            uint32_t : 1;
+            uint32_t spiMode : 2;           // bit 1..2
+            uint32_t : 5;
+            uint32_t ffCnt : 6;             // bit 8..13
+            uint32_t : 18;
+        };
+    };
+    uint8_t reserved1[4];               // 8
+    union {
+        uint16_t inProtoMask;           // 12
+        struct {
+            uint16_t inUbx : 1;             // bit 0
+            uint16_t inNmea : 1;            // bit 1
+            uint16_t inRtcm : 1;            // bit 2
+            uint16_t : 2;
+            uint16_t inRtcm3 : 1;           // bit 5
+            uint16_t : 10;
+        };
+    };
+    union {
+        uint16_t outProtoMask;          // 14
+        struct {
+            uint16_t outUbx : 1;            // bit 0
+            uint16_t outNmea : 1;           // bit 1
+            uint16_t : 3;
+            uint16_t outRtcm3 : 1;          // bit 5
+            uint16_t : 10;
+        };
+    };
+    union {
+        uint16_t flags;                 // 16
+        struct {
+            uint16_t : 1;
+            uint16_t extendedTxTimeout : 1; // bit 1
+            uint16_t : 14;
+        };
+    };
+    uint8_t reserved2[2];               // 18
+} ubx_cfg_prt_spi_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_prt_spi_t, 20);
+
+#define UBX_CFG_PRT_SPI(payload)                ((const ubx_cfg_prt_spi_t *)(payload))
+#define UBX_CFG_PRT_SPI_SIZE                    20
+#define UBX_CFG_PRT_SPI_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x06, 0x00, ubx_cfg_prt_spi_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-PRT-DDC payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t portID;                     // 0
+    uint8_t reserved0;                  // 1
+    union {
+        uint16_t txReady;               // 2
+        struct {
+            uint16_t en : 1;                // bit 0
+            uint16_t pol : 1;               // bit 1
+            uint16_t pin : 5;               // bit 2..6
+            uint16_t thres : 9;             // bit 7..15
+        };
+    };
+    union {
+        uint32_t mode;                  // 4
+        struct {
+            uint32_t : 1;
+            uint32_t slaveAddr : 7;         // bit 1..7
+            uint32_t : 24;
+        };
+    };
+    uint8_t reserved1[4];               // 8
+    union {
+        uint16_t inProtoMask;           // 12
+        struct {
+            uint16_t inUbx : 1;             // bit 0
+            uint16_t inNmea : 1;            // bit 1
+            uint16_t inRtcm : 1;            // bit 2
+            uint16_t : 2;
+            uint16_t inRtcm3 : 1;           // bit 5
+            uint16_t : 10;
+        };
+    };
+    union {
+        uint16_t outProtoMask;          // 14
+        struct {
+            uint16_t outUbx : 1;            // bit 0
+            uint16_t outNmea : 1;           // bit 1
+            uint16_t : 3;
+            uint16_t outRtcm3 : 1;          // bit 5
+            uint16_t : 10;
+        };
+    };
+    union {
+        uint16_t flags;                 // 16
+        struct {
+            uint16_t : 1;
+            uint16_t extendedTxTimeout : 1; // bit 1
+            uint16_t : 14;
+        };
+    };
+    uint8_t reserved2[2];               // 18
+} ubx_cfg_prt_ddc_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_prt_ddc_t, 20);
+
+#define UBX_CFG_PRT_DDC(payload)                ((const ubx_cfg_prt_ddc_t *)(payload))
+#define UBX_CFG_PRT_DDC_SIZE                    20
+#define UBX_CFG_PRT_DDC_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x06, 0x00, ubx_cfg_prt_ddc_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-INF-DATA1 configs (10 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t protocolID;                 // 0
+    uint8_t reserved0[3];               // 1
+    uint8_t infMsgMask[6];              // 4
+} ubx_cfg_inf_data1_configs_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_inf_data1_configs_t, 10);
+
+// UBX-CFG-INF-DATA1 payload (n*10 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_inf_data1_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_inf_data1_t, 0);
+
+#define UBX_CFG_INF_DATA1(payload)              ((const ubx_cfg_inf_data1_t *)(payload))
+#define UBX_CFG_INF_DATA1_SIZE                  0
+#define UBX_CFG_INF_DATA1_CONFIGS(payload, i)   ((const ubx_cfg_inf_data1_configs_t *)((const uint8_t *)(payload) + 0 + (size_t)(i) * 10))
+#define UBX_CFG_INF_DATA1_CONFIGS_COUNT(payload, len)((size_t)(len) > 0 ? ((size_t)(len) - 0) / 10 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-RST-DATA0 payload (4 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint16_t navBbrMask;            // 0
+        struct {
+            uint16_t eph : 1;               // bit 0
+            uint16_t alm : 1;               // bit 1
+            uint16_t health : 1;            // bit 2
+            uint16_t klob : 1;              // bit 3
+            uint16_t pos : 1;               // bit 4
+            uint16_t clkd : 1;              // bit 5
+            uint16_t osc : 1;               // bit 6
+            uint16_t utc : 1;               // bit 7
+            uint16_t rtc : 1;               // bit 8
+            uint16_t : 2;
+            uint16_t sfdr : 1;              // bit 11
+            uint16_t vmon : 1;              // bit 12
+            uint16_t tct : 1;               // bit 13
+            uint16_t : 1;
+            uint16_t aop : 1;               // bit 15
+        };
+    };
+    uint8_t resetMode;                  // 2
+    uint8_t reserved0;                  // 3
+} ubx_cfg_rst_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_rst_data0_t, 4);
+
+#define UBX_CFG_RST_DATA0(payload)              ((const ubx_cfg_rst_data0_t *)(payload))
+#define UBX_CFG_RST_DATA0_SIZE                  4
+#define UBX_CFG_RST_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x04, ubx_cfg_rst_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-RST-DATA1 payload (4 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint16_t navBbrMask;            // 0
+        struct {
+            uint16_t eph : 1;               // bit 0
+            uint16_t alm : 1;               // bit 1
+            uint16_t health : 1;            // bit 2
+            uint16_t klob : 1;              // bit 3
+            uint16_t pos : 1;               // bit 4
+            uint16_t clkd : 1;              // bit 5
+            uint16_t osc : 1;               // bit 6
+            uint16_t utc : 1;               // bit 7
+            uint16_t rtc : 1;               // bit 8
+            uint16_t : 2;
+            uint16_t sfdr : 1;              // bit 11
+            uint16_t vmon : 1;              // bit 12
+            uint16_t tct : 1;               // bit 13
+            uint16_t : 1;
+            uint16_t aop : 1;               // bit 15
+        };
+    };
+    uint8_t resetMode;                  // 2
+    uint8_t reserved0;                  // 3
+} ubx_cfg_rst_data1_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_rst_data1_t, 4);
+
+#define UBX_CFG_RST_DATA1(payload)              ((const ubx_cfg_rst_data1_t *)(payload))
+#define UBX_CFG_RST_DATA1_SIZE                  4
+#define UBX_CFG_RST_DATA1_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x04, ubx_cfg_rst_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-RST-DATA2 payload (4 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint16_t navBbrMask;            // 0
+        struct {
+            uint16_t eph : 1;               // bit 0
+            uint16_t alm : 1;               // bit 1
+            uint16_t health : 1;            // bit 2
+            uint16_t klob : 1;              // bit 3
+            uint16_t pos : 1;               // bit 4
+            uint16_t clkd : 1;              // bit 5
+            uint16_t osc : 1;               // bit 6
+            uint16_t utc : 1;               // bit 7
+            uint16_t rtc : 1;               // bit 8
+            uint16_t : 2;
+            uint16_t sfdr : 1;              // bit 11
+            uint16_t vmon : 1;              // bit 12
+            uint16_t tct : 1;               // bit 13
+            uint16_t : 1;
+            uint16_t aop : 1;               // bit 15
+        };
+    };
+    uint8_t resetMode;                  // 2
+    uint8_t reserved0;                  // 3
+} ubx_cfg_rst_data2_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_rst_data2_t, 4);
+
+#define UBX_CFG_RST_DATA2(payload)              ((const ubx_cfg_rst_data2_t *)(payload))
+#define UBX_CFG_RST_DATA2_SIZE                  4
+#define UBX_CFG_RST_DATA2_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x04, ubx_cfg_rst_data2_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-RST-DATA3 payload (4 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint16_t navBbrMask;            // 0
+        struct {
+            uint16_t eph : 1;               // bit 0
+            uint16_t alm : 1;               // bit 1
+            uint16_t health : 1;            // bit 2
+            uint16_t klob : 1;              // bit 3
+            uint16_t pos : 1;               // bit 4
+            uint16_t clkd : 1;              // bit 5
+            uint16_t osc : 1;               // bit 6
+            uint16_t utc : 1;               // bit 7
+            uint16_t rtc : 1;               // bit 8
+            uint16_t : 2;
+            uint16_t sfdr : 1;              // bit 11
+            uint16_t vmon : 1;              // bit 12
+            uint16_t tct : 1;               // bit 13
+            uint16_t : 1;
+            uint16_t aop : 1;               // bit 15
+        };
+    };
+    uint8_t resetMode;                  // 2
+    uint8_t reserved0;                  // 3
+} ubx_cfg_rst_data3_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_rst_data3_t, 4);
+
+#define UBX_CFG_RST_DATA3(payload)              ((const ubx_cfg_rst_data3_t *)(payload))
+#define UBX_CFG_RST_DATA3_SIZE                  4
+#define UBX_CFG_RST_DATA3_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x04, ubx_cfg_rst_data3_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-DAT-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_dat_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_dat_poll0_t, 0);
+
+#define UBX_CFG_DAT_POLL0(payload)              ((const ubx_cfg_dat_poll0_t *)(payload))
+#define UBX_CFG_DAT_POLL0_SIZE                  0
+#define UBX_CFG_DAT_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x06, ubx_cfg_dat_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-DAT-SETSTD payload (2 bytes)
+typedef struct __attribute__((packed)) {
+    uint16_t datumNum;                  // 0
+} ubx_cfg_dat_setstd_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_dat_setstd_t, 2);
+
+#define UBX_CFG_DAT_SETSTD(payload)             ((const ubx_cfg_dat_setstd_t *)(payload))
+#define UBX_CFG_DAT_SETSTD_SIZE                 2
+#define UBX_CFG_DAT_SETSTD_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x06, 0x06, ubx_cfg_dat_setstd_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-DAT-SETCUSTOM payload (44 bytes)
+typedef struct __attribute__((packed)) {
+    double majA;                        // 0: m
+    double flat;                        // 8
+    float dX;                           // 16: m
+    float dY;                           // 20: m
+    float dZ;                           // 24: m
+    float rotX;                         // 28: s
+    float rotY;                         // 32: s
+    float rotZ;                         // 36: s
+    float scale;                        // 40: ppm
+} ubx_cfg_dat_setcustom_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_dat_setcustom_t, 44);
+
+#define UBX_CFG_DAT_SETCUSTOM(payload)          ((const ubx_cfg_dat_setcustom_t *)(payload))
+#define UBX_CFG_DAT_SETCUSTOM_SIZE              44
+#define UBX_CFG_DAT_SETCUSTOM_TYPED(name, ...)  UBX_MESSAGE_TYPED(name, 0x06, 0x06, ubx_cfg_dat_setcustom_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-DAT-GETCURRENT payload (52 bytes)
+typedef struct __attribute__((packed)) {
+    uint16_t datumNum;                  // 0
+    char datumName[6];                  // 2
+    double majA;                        // 8: m
+    double flat;                        // 16
+    float dX;                           // 24: m
+    float dY;                           // 28: m
+    float dZ;                           // 32: m
+    float rotX;                         // 36: s
+    float rotY;                         // 40: s
+    float rotZ;                         // 44: s
+    float scale;                        // 48: ppm
+} ubx_cfg_dat_getcurrent_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_dat_getcurrent_t, 52);
+
+#define UBX_CFG_DAT_GETCURRENT(payload)         ((const ubx_cfg_dat_getcurrent_t *)(payload))
+#define UBX_CFG_DAT_GETCURRENT_SIZE             52
+#define UBX_CFG_DAT_GETCURRENT_TYPED(name, ...) UBX_MESSAGE_TYPED(name, 0x06, 0x06, ubx_cfg_dat_getcurrent_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-CFG-DATA1 payload (12 + 1 optional bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint32_t clearMask;             // 0
+        struct {
+            uint32_t clearAll : 32;         // bit 0..31
+        };
+    };
+    union {
+        uint32_t saveMask;              // 4
+        struct {
+            uint32_t saveAll : 32;          // bit 0..31
+        };
+    };
+    union {
+        uint32_t loadMask;              // 8
+        struct {
+            uint32_t loadAll : 32;          // bit 0..31
+        };
+    };
+    union {
+        uint8_t deviceMask;             // 12
+        struct {
+            uint8_t devBBR : 1;             // bit 0
+            uint8_t devFlash : 1;           // bit 1
+            uint8_t devEEPROM : 1;          // bit 2
+            uint8_t : 1;
+            uint8_t devSpiFlash : 1;        // bit 4
+            uint8_t : 3;
+        };
+    };
+} ubx_cfg_cfg_data1_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_cfg_data1_t, 13);
+
+#define UBX_CFG_CFG_DATA1(payload)              ((const ubx_cfg_cfg_data1_t *)(payload))
+#define UBX_CFG_CFG_DATA1_SIZE                  13
+#define UBX_CFG_CFG_DATA1_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x09, ubx_cfg_cfg_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-FXN-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_fxn_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_fxn_poll0_t, 0);
+
+#define UBX_CFG_FXN_POLL0(payload)              ((const ubx_cfg_fxn_poll0_t *)(payload))
+#define UBX_CFG_FXN_POLL0_SIZE                  0
+#define UBX_CFG_FXN_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x0E, ubx_cfg_fxn_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-FXN-DATA0 payload (36 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint32_t flags;                 // 0
+        struct {
+            uint32_t : 1;
+            uint32_t sleep : 1;             // bit 1
+            uint32_t : 1;
+            uint32_t absAlign : 1;          // bit 3
+            uint32_t onOff : 1;             // bit 4
+            uint32_t : 27;
+        };
+    };
+    uint32_t tReacq;                    // 4: ms
+    uint32_t tAcq;                      // 8: ms
+    uint32_t tReacqOff;                 // 12: ms
+    uint32_t tAcqOff;                   // 16: ms
+    uint32_t tOn;                       // 20: ms
+    uint32_t tOff;                      // 24: ms
+    uint8_t reserved0[4];               // 28
+    uint32_t baseTow;                   // 32: ms
+} ubx_cfg_fxn_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_fxn_data0_t, 36);
+
+#define UBX_CFG_FXN_DATA0(payload)              ((const ubx_cfg_fxn_data0_t *)(payload))
+#define UBX_CFG_FXN_DATA0_SIZE                  36
+#define UBX_CFG_FXN_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x0E, ubx_cfg_fxn_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-RXM-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_rxm_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_rxm_poll0_t, 0);
+
+#define UBX_CFG_RXM_POLL0(payload)              ((const ubx_cfg_rxm_poll0_t *)(payload))
+#define UBX_CFG_RXM_POLL0_SIZE                  0
+#define UBX_CFG_RXM_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x11, ubx_cfg_rxm_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-RXM-DATA1 payload (2 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t reserved0;                  // 0
+    uint8_t lpMode;                     // 1
+} ubx_cfg_rxm_data1_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_rxm_data1_t, 2);
+
+#define UBX_CFG_RXM_DATA1(payload)              ((const ubx_cfg_rxm_data1_t *)(payload))
+#define UBX_CFG_RXM_DATA1_SIZE                  2
+#define UBX_CFG_RXM_DATA1_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x11, ubx_cfg_rxm_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-RXM-DATA2 payload (2 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t reserved0;                  // 0
+    uint8_t lpMode;                     // 1
+} ubx_cfg_rxm_data2_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_rxm_data2_t, 2);
+
+#define UBX_CFG_RXM_DATA2(payload)              ((const ubx_cfg_rxm_data2_t *)(payload))
+#define UBX_CFG_RXM_DATA2_SIZE                  2
+#define UBX_CFG_RXM_DATA2_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x11, ubx_cfg_rxm_data2_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-EKF-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_ekf_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_ekf_poll0_t, 0);
+
+#define UBX_CFG_EKF_POLL0(payload)              ((const ubx_cfg_ekf_poll0_t *)(payload))
+#define UBX_CFG_EKF_POLL0_SIZE                  0
+#define UBX_CFG_EKF_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x12, ubx_cfg_ekf_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-EKF-DATA1 payload (16 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t disableEkf;                 // 0
+    union {
+        uint8_t actionFlags;            // 1
+        struct {
+            uint8_t : 1;
+            uint8_t clTab : 1;              // bit 1
+            uint8_t clCalib : 1;            // bit 2
+            uint8_t : 1;
+            uint8_t nomTacho : 1;           // bit 4
+            uint8_t nomGyro : 1;            // bit 5
+            uint8_t setTemp : 1;            // bit 6
+            uint8_t dir : 1;                // bit 7
+        };
+    };
+    union {
+        uint8_t configFlags;            // 2
+        struct {
+            uint8_t pulsesPerM : 1;         // bit 0
+            uint8_t useSerWt : 1;           // bit 1
+            uint8_t : 6;
+        };
+    };
+    union {
+        uint8_t inverseFlags;           // 3
+        struct {
+            uint8_t invDir : 1;             // bit 0
+            uint8_t invGyro : 1;            // bit 1
+            uint8_t : 6;
+        };
+    };
+    uint8_t reserved0[4];               // 4
+    uint16_t nomPPDist;                 // 8
+    uint16_t nomZero;                   // 10: mV
+    uint8_t nomSens;                    // 12: mV/(deg/s)
+    uint8_t rmsTemp;                    // 13: mV, *0.1
+    uint16_t tempUpdate;                // 14: s
+} ubx_cfg_ekf_data1_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_ekf_data1_t, 16);
+
+#define UBX_CFG_EKF_DATA1(payload)              ((const ubx_cfg_ekf_data1_t *)(payload))
+#define UBX_CFG_EKF_DATA1_SIZE                  16
+#define UBX_CFG_EKF_DATA1_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x12, ubx_cfg_ekf_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-EKF-DATA2 payload (16 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t disableEkf;                 // 0
+    union {
+        uint8_t actionFlags;            // 1
+        struct {
+            uint8_t : 1;
+            uint8_t clTab : 1;              // bit 1
+            uint8_t clCalib : 1;            // bit 2
+            uint8_t : 1;
+            uint8_t nomTacho : 1;           // bit 4
+            uint8_t nomGyro : 1;            // bit 5
+            uint8_t setTemp : 1;            // bit 6
+            uint8_t dir : 1;                // bit 7
+        };
+    };
+    union {
+        uint8_t configFlags;            // 2
+        struct {
+            uint8_t pulsesPerM : 1;         // bit 0
+            uint8_t useSerWt : 1;           // bit 1
+            uint8_t : 6;
+        };
+    };
+    union {
+        uint8_t inverseFlags;           // 3
+        struct {
+            uint8_t invDir : 1;             // bit 0
+            uint8_t invGyro : 1;            // bit 1
+            uint8_t : 6;
+        };
+    };
+    uint8_t reserved0[4];               // 4
+    uint16_t nomPPDist;                 // 8
+    uint16_t nomZero;                   // 10: mV
+    uint8_t nomSens;                    // 12: mV/(deg/s)
+    uint8_t rmsTemp;                    // 13: mV, *0.1
+    uint16_t tempUpdate;                // 14: s
+} ubx_cfg_ekf_data2_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_ekf_data2_t, 16);
+
+#define UBX_CFG_EKF_DATA2(payload)              ((const ubx_cfg_ekf_data2_t *)(payload))
+#define UBX_CFG_EKF_DATA2_SIZE                  16
+#define UBX_CFG_EKF_DATA2_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x12, ubx_cfg_ekf_data2_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-ANT-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_ant_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_ant_poll0_t, 0);
+
+#define UBX_CFG_ANT_POLL0(payload)              ((const ubx_cfg_ant_poll0_t *)(payload))
+#define UBX_CFG_ANT_POLL0_SIZE                  0
+#define UBX_CFG_ANT_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x13, ubx_cfg_ant_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-ANT-DATA0 payload (4 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint16_t flags;                 // 0
+        struct {
+            uint16_t svcs : 1;              // bit 0
+            uint16_t scd : 1;               // bit 1
+            uint16_t ocd : 1;               // bit 2
+            uint16_t pdwnOnSCD : 1;         // bit 3
+            uint16_t recovery : 1;          // bit 4
+            uint16_t : 11;
+        };
+    };
+    union {
+        uint16_t pins;                  // 2
+        struct {
+            uint16_t pinSwitch : 5;         // bit 0..4
+            uint16_t pinSCD : 5;            // bit 5..9
+            uint16_t pinOCD : 5;            // bit 10..14
+            uint16_t reconfig : 1;          // bit 15
+        };
+    };
+} ubx_cfg_ant_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_ant_data0_t, 4);
+
+#define UBX_CFG_ANT_DATA0(payload)              ((const ubx_cfg_ant_data0_t *)(payload))
+#define UBX_CFG_ANT_DATA0_SIZE                  4
+#define UBX_CFG_ANT_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x13, ubx_cfg_ant_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-ANT-DATA1 payload (4 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint16_t flags;                 // 0
+        struct {
+            uint16_t svcs : 1;              // bit 0
+            uint16_t scd : 1;               // bit 1
+            uint16_t ocd : 1;               // bit 2
+            uint16_t pdwnOnSCD : 1;         // bit 3
+            uint16_t recovery : 1;          // bit 4
+            uint16_t : 11;
+        };
+    };
+    union {
+        uint16_t pins;                  // 2
+        struct {
+            uint16_t pinSwitch : 5;         // bit 0..4
+            uint16_t pinSCD : 5;            // bit 5..9
+            uint16_t pinOCD : 5;            // bit 10..14
+            uint16_t : 1;
+        };
+    };
+} ubx_cfg_ant_data1_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_ant_data1_t, 4);
+
+#define UBX_CFG_ANT_DATA1(payload)              ((const ubx_cfg_ant_data1_t *)(payload))
+#define UBX_CFG_ANT_DATA1_SIZE                  4
+#define UBX_CFG_ANT_DATA1_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x13, ubx_cfg_ant_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-SBAS-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_sbas_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_sbas_poll0_t, 0);
+
+#define UBX_CFG_SBAS_POLL0(payload)             ((const ubx_cfg_sbas_poll0_t *)(payload))
+#define UBX_CFG_SBAS_POLL0_SIZE                 0
+#define UBX_CFG_SBAS_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x06, 0x16, ubx_cfg_sbas_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-SBAS-U5 payload (8 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint8_t mode;                   // 0
+        struct {
+            uint8_t enabled : 1;            // bit 0
+            uint8_t test : 1;               // bit 1
+            uint8_t : 6;
+        };
+    };
+    union {
+        uint8_t usage;                  // 1
+        struct {
+            uint8_t range : 1;              // bit 0
+            uint8_t diffCorr : 1;           // bit 1
+            uint8_t integrity : 1;          // bit 2
+            uint8_t : 5;
+        };
+    };
+    uint8_t maxSBAS;                    // 2
+    union {
+        uint8_t scanmode2;              // 3
+        struct {
+            uint8_t PRN152 : 1;             // bit 0
+            uint8_t PRN153 : 1;             // bit 1
+            uint8_t PRN154 : 1;             // bit 2
+            uint8_t PRN155 : 1;             // bit 3
+            uint8_t PRN156 : 1;             // bit 4
+            uint8_t PRN157 : 1;             // bit 5
+            uint8_t PRN158 : 1;             // bit 6
+            uint8_t : 1;
+        };
+    };
+    union {
+        uint32_t scanmode1;             // 4
+        struct {
+            uint32_t PRN120 : 1;            // bit 0
+            uint32_t PRN121 : 1;            // bit 1
+            uint32_t PRN122 : 1;            // bit 2
+            uint32_t PRN123 : 1;            // bit 3
+            uint32_t PRN124 : 1;            // bit 4
+            uint32_t PRN125 : 1;            // bit 5
+            uint32_t PRN126 : 1;            // bit 6
+            uint32_t PRN127 : 1;            // bit 7
+            uint32_t PRN128 : 1;            // bit 8
+            uint32_t PRN129 : 1;            // bit 9
+            uint32_t PRN130 : 1;            // bit 10
+            uint32_t PRN131 : 1;            // bit 11
+            uint32_t PRN132 : 1;            // bit 12
+            uint32_t PRN133 : 1;            // bit 13
+            uint32_t PRN134 : 1;            // bit 14
+            uint32_t PRN135 : 1;            // bit 15
+            uint32_t PRN136 : 1;            // bit 16
+            uint32_t PRN137 : 1;            // bit 17
+            uint32_t PRN138 : 1;            // bit 18
+            uint32_t PRN139 : 1;            // bit 19
+            uint32_t PRN140 : 1;            // bit 20
+            uint32_t PRN141 : 1;            // bit 21
+            uint32_t PRN142 : 1;            // bit 22
+            uint32_t PRN143 : 1;            // bit 23
+            uint32_t PRN144 : 1;            // bit 24
+            uint32_t PRN145 : 1;            // bit 25
+            uint32_t PRN146 : 1;            // bit 26
+            uint32_t PRN147 : 1;            // bit 27
+            uint32_t PRN148 : 1;            // bit 28
+            uint32_t PRN149 : 1;            // bit 29
+            uint32_t PRN150 : 1;            // bit 30
+            uint32_t PRN151 : 1;            // bit 31
+        };
+    };
+} ubx_cfg_sbas_u5_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_sbas_u5_t, 8);
+
+#define UBX_CFG_SBAS_U5(payload)                ((const ubx_cfg_sbas_u5_t *)(payload))
+#define UBX_CFG_SBAS_U5_SIZE                    8
+#define UBX_CFG_SBAS_U5_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x06, 0x16, ubx_cfg_sbas_u5_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-NMEA-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_nmea_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_nmea_poll0_t, 0);
+
+#define UBX_CFG_NMEA_POLL0(payload)             ((const ubx_cfg_nmea_poll0_t *)(payload))
+#define UBX_CFG_NMEA_POLL0_SIZE                 0
+#define UBX_CFG_NMEA_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x06, 0x17, ubx_cfg_nmea_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-NMEA-DATA0 payload (4 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint8_t filter;                 // 0
+        struct {
+            uint8_t posFilt : 1;            // bit 0
+            uint8_t mskPosFilt : 1;         // bit 1
+            uint8_t timeFilt : 1;           // bit 2
+            uint8_t dateFilt : 1;           // bit 3
+            uint8_t gpsOnlyFilter : 1;      // bit 4
+            uint8_t trackFilt : 1;          // bit 5
+            uint8_t : 2;
+        };
+    };
+    uint8_t nmeaVersion;                // 1
+    uint8_t numSV;                      // 2
+    union {
+        uint8_t flags;                  // 3
+        struct {
+            uint8_t compat : 1;             // bit 0
+            uint8_t consider : 1;           // bit 1
+            uint8_t : 6;
+        };
+    };
+} ubx_cfg_nmea_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_nmea_data0_t, 4);
+
+#define UBX_CFG_NMEA_DATA0(payload)             ((const ubx_cfg_nmea_data0_t *)(payload))
+#define UBX_CFG_NMEA_DATA0_SIZE                 4
+#define UBX_CFG_NMEA_DATA0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x06, 0x17, ubx_cfg_nmea_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-NMEA-DATA1 payload (12 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint8_t filter;                 // 0
+        struct {
+            uint8_t posFilt : 1;            // bit 0
+            uint8_t mskPosFilt : 1;         // bit 1
+            uint8_t timeFilt : 1;           // bit 2
+            uint8_t dateFilt : 1;           // bit 3
+            uint8_t gpsOnlyFilter : 1;      // bit 4
+            uint8_t trackFilt : 1;          // bit 5
+            uint8_t : 2;
+        };
+    };
+    uint8_t nmeaVersion;                // 1
+    uint8_t numSV;                      // 2
+    union {
+        uint8_t flags;                  // 3
+        struct {
+            uint8_t compat : 1;             // bit 0
+            uint8_t consider : 1;           // bit 1
+            uint8_t : 6;
+        };
+    };
+    union {
+        uint32_t gnssToFilter;          // 4
+        struct {
+            uint32_t gps : 1;               // bit 0
+            uint32_t sbas : 1;              // bit 1
+            uint32_t galileo : 1;           // bit 2
+            uint32_t : 1;
+            uint32_t qzss : 1;              // bit 4
+            uint32_t glonass : 1;           // bit 5
+            uint32_t beidou : 1;            // bit 6
+            uint32_t : 25;
+        };
+    };
+    uint8_t svNumbering;                // 8
+    uint8_t mainTalkerId;               // 9
+    uint8_t gsvTalkerId;                // 10
+    uint8_t version;                    // 11
+} ubx_cfg_nmea_data1_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_nmea_data1_t, 12);
+
+#define UBX_CFG_NMEA_DATA1(payload)             ((const ubx_cfg_nmea_data1_t *)(payload))
+#define UBX_CFG_NMEA_DATA1_SIZE                 12
+#define UBX_CFG_NMEA_DATA1_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x06, 0x17, ubx_cfg_nmea_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-NMEA-DATA2 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint8_t filter;                 // 0
+        struct {
+            uint8_t posFilt : 1;            // bit 0
+            uint8_t mskPosFilt : 1;         // bit 1
+            uint8_t timeFilt : 1;           // bit 2
+            uint8_t dateFilt : 1;           // bit 3
+            uint8_t gpsOnlyFilter : 1;      // bit 4
+            uint8_t trackFilt : 1;          // bit 5
+            uint8_t : 2;
+        };
+    };
+    uint8_t nmeaVersion;                // 1
+    uint8_t numSV;                      // 2
+    union {
+        uint8_t flags;                  // 3
+        struct {
+            uint8_t compat : 1;             // bit 0
+            uint8_t consider : 1;           // bit 1
+            uint8_t limit82 : 1;            // bit 2
+            uint8_t highPrec : 1;           // bit 3
+            uint8_t : 4;
+        };
+    };
+    union {
+        uint32_t gnssToFilter;          // 4
+        struct {
+            uint32_t gps : 1;               // bit 0
+            uint32_t sbas : 1;              // bit 1
+            uint32_t galileo : 1;           // bit 2
+            uint32_t : 1;
+            uint32_t qzss : 1;              // bit 4
+            uint32_t glonass : 1;           // bit 5
+            uint32_t beidou : 1;            // bit 6
+            uint32_t : 25;
+        };
+    };
+    uint8_t svNumbering;                // 8
+    uint8_t mainTalkerId;               // 9
+    uint8_t gsvTalkerId;                // 10
+    uint8_t version;                    // 11
+    char bdsTalkerId[2];                // 12
+    uint8_t reserved0[6];               // 14
+} ubx_cfg_nmea_data2_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_nmea_data2_t, 20);
+
+#define UBX_CFG_NMEA_DATA2(payload)             ((const ubx_cfg_nmea_data2_t *)(payload))
+#define UBX_CFG_NMEA_DATA2_SIZE                 20
+#define UBX_CFG_NMEA_DATA2_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x06, 0x17, ubx_cfg_nmea_data2_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-USB-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_usb_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_usb_poll0_t, 0);
+
+#define UBX_CFG_USB_POLL0(payload)              ((const ubx_cfg_usb_poll0_t *)(payload))
+#define UBX_CFG_USB_POLL0_SIZE                  0
+#define UBX_CFG_USB_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x1B, ubx_cfg_usb_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-USB-DATA0 payload (108 bytes)
+typedef struct __attribute__((packed)) {
+    uint16_t vendorID;                  // 0
+    uint16_t productID;                 // 2
+    uint8_t reserved0[2];               // 4
+    uint8_t reserved1[2];               // 6
+    uint16_t powerConsumption;          // 8: mA
+    union {
+        uint16_t flags;                 // 10
+        struct {
+            uint16_t reEnum : 1;            // bit 0
+            uint16_t powerMode : 1;         // bit 1
+            uint16_t : 14;
+        };
+    };
+    char vendorString[32];              // 12
+    char productString[32];             // 44
+    char serialNumber[32];              // 76
+} ubx_cfg_usb_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_usb_data0_t, 108);
+
+#define UBX_CFG_USB_DATA0(payload)              ((const ubx_cfg_usb_data0_t *)(payload))
+#define UBX_CFG_USB_DATA0_SIZE                  108
+#define UBX_CFG_USB_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x1B, ubx_cfg_usb_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-TMODE-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_tmode_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_tmode_poll0_t, 0);
+
+#define UBX_CFG_TMODE_POLL0(payload)            ((const ubx_cfg_tmode_poll0_t *)(payload))
+#define UBX_CFG_TMODE_POLL0_SIZE                0
+#define UBX_CFG_TMODE_POLL0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x06, 0x1D, ubx_cfg_tmode_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-TMODE-DATA0 payload (28 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t timeMode;                  // 0
+    int32_t fixedPosX;                  // 4: cm
+    int32_t fixedPosY;                  // 8: cm
+    int32_t fixedPosZ;                  // 12: cm
+    uint32_t fixedPosVar;               // 16: mm^2
+    uint32_t svinMinDur;                // 20: s
+    uint32_t svinVarLimit;              // 24: mm^2
+} ubx_cfg_tmode_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_tmode_data0_t, 28);
+
+#define UBX_CFG_TMODE_DATA0(payload)            ((const ubx_cfg_tmode_data0_t *)(payload))
+#define UBX_CFG_TMODE_DATA0_SIZE                28
+#define UBX_CFG_TMODE_DATA0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x06, 0x1D, ubx_cfg_tmode_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-ODO-POLL1 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_odo_poll1_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_odo_poll1_t, 0);
+
+#define UBX_CFG_ODO_POLL1(payload)              ((const ubx_cfg_odo_poll1_t *)(payload))
+#define UBX_CFG_ODO_POLL1_SIZE                  0
+#define UBX_CFG_ODO_POLL1_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x1E, ubx_cfg_odo_poll1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-ODO-DATA1 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0[3];               // 1
+    union {
+        uint8_t flags;                  // 4
+        struct {
+            uint8_t useODO : 1;             // bit 0
+            uint8_t useCOG : 1;             // bit 1
+            uint8_t outLPVel : 1;           // bit 2
+            uint8_t outLPCog : 1;           // bit 3
+            uint8_t : 4;
+        };
+    };
+    union {
+        uint8_t odoCfg;                 // 5
+        struct {
+            uint8_t profile : 3;            // bit 0..2
+            uint8_t : 5;
+        };
+    };
+    uint8_t reserved1[6];               // 6
+    uint8_t cogMaxSpeed;                // 12: m/s, *1e-1
+    uint8_t cogMaxPosAcc;               // 13: m
+    uint8_t reserved2[2];               // 14
+    uint8_t velLpGain;                  // 16
+    uint8_t cogLpGain;                  // 17
+    uint8_t reserved3[2];               // 18
+} ubx_cfg_odo_data1_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_odo_data1_t, 20);
+
+#define UBX_CFG_ODO_DATA1(payload)              ((const ubx_cfg_odo_data1_t *)(payload))
+#define UBX_CFG_ODO_DATA1_SIZE                  20
+#define UBX_CFG_ODO_DATA1_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x1E, ubx_cfg_odo_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-NAVX5-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_navx5_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_navx5_poll0_t, 0);
+
+#define UBX_CFG_NAVX5_POLL0(payload)            ((const ubx_cfg_navx5_poll0_t *)(payload))
+#define UBX_CFG_NAVX5_POLL0_SIZE                0
+#define UBX_CFG_NAVX5_POLL0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x06, 0x23, ubx_cfg_navx5_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-NAVX5-DATA0 payload (40 bytes)
+typedef struct __attribute__((packed)) {
+    uint16_t version;                   // 0
+    union {
+        uint16_t mask1;                 // 2
+        struct {
+            uint16_t : 2;
+            uint16_t minMax : 1;            // bit 2
+            uint16_t minCno : 1;            // bit 3
+            uint16_t : 2;
+            uint16_t initial3dfix : 1;      // bit 6
+            uint16_t : 2;
+            uint16_t wknRoll : 1;           // bit 9
+            uint16_t ackAid : 1;            // bit 10
+            uint16_t : 2;
+            uint16_t ppp : 1;               // bit 13
+            uint16_t aop : 1;               // bit 14
+            uint16_t : 1;
+        };
+    };
+    union {
+        uint32_t mask2;                 // 4
+        struct {
+            uint32_t : 6;
+            uint32_t adr : 1;               // bit 6
+            uint32_t : 25;
+        };
+    };
+    uint8_t reserved0[2];               // 8
+    uint8_t minSVs;                     // 10: #SVs
+    uint8_t maxSVs;                     // 11: #SVs
+    uint8_t minCNO;                     // 12: dBHz
+    uint8_t reserved1;                  // 13
+    uint8_t iniFix3D;                   // 14
+    uint8_t reserved2[2];               // 15
+    uint8_t ackAiding;                  // 17
+    uint16_t wknRollover;               // 18
+    uint8_t reserved3[6];               // 20
+    uint8_t usePPP;                     // 26
+    union {
+        uint8_t aopCfg;                 // 27
+        struct {
+            uint8_t useAOP : 1;             // bit 0
+            uint8_t : 7;
+        };
+    };
+    uint8_t reserved4[2];               // 28
+    uint16_t aopOrbMaxErr;              // 30: m
+    uint8_t reserved5[4];               // 32
+    uint8_t reserved6[3];               // 36
+    uint8_t useAdr;                     // 39
+} ubx_cfg_navx5_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_navx5_data0_t, 40);
+
+#define UBX_CFG_NAVX5_DATA0(payload)            ((const ubx_cfg_navx5_data0_t *)(payload))
+#define UBX_CFG_NAVX5_DATA0_SIZE                40
+#define UBX_CFG_NAVX5_DATA0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x06, 0x23, ubx_cfg_navx5_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-NAVX5-DATA1 payload (40 bytes)
+typedef struct __attribute__((packed)) {
+    uint16_t version;                   // 0
+    union {
+        uint16_t mask1;                 // 2
+        struct {
+            uint16_t : 2;
+            uint16_t minMax : 1;            // bit 2
+            uint16_t minCno : 1;            // bit 3
+            uint16_t : 2;
+            uint16_t initial3dfix : 1;      // bit 6
+            uint16_t : 2;
+            uint16_t wknRoll : 1;           // bit 9
+            uint16_t : 3;
+            uint16_t ppp : 1;               // bit 13
+            uint16_t aop : 1;               // bit 14
+            uint16_t : 1;
+        };
+    };
+    uint8_t reserved0[6];               // 4
+    uint8_t minSVs;                     // 10: #SVs
+    uint8_t maxSVs;                     // 11: #SVs
+    uint8_t minCNO;                     // 12: dBHz
+    uint8_t reserved1;                  // 13
+    uint8_t iniFix3D;                   // 14
+    uint8_t reserved2[2];               // 15
+    uint8_t ackAiding;                  // 17
+    uint16_t wknRollover;               // 18
+    uint8_t reserved3[6];               // 20
+    uint8_t usePPP;                     // 26
+    union {
+        uint8_t aopCfg;                 // 27
+        struct {
+            uint8_t useAOP : 1;             // bit 0
+            uint8_t : 7;
+        };
+    };
+    uint8_t reserved4[2];               // 28
+    uint16_t aopOrbMaxErr;              // 30: m
+    uint8_t reserved5;                  // 32
+    uint8_t reserved6[7];               // 33
+} ubx_cfg_navx5_data1_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_navx5_data1_t, 40);
+
+#define UBX_CFG_NAVX5_DATA1(payload)            ((const ubx_cfg_navx5_data1_t *)(payload))
+#define UBX_CFG_NAVX5_DATA1_SIZE                40
+#define UBX_CFG_NAVX5_DATA1_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x06, 0x23, ubx_cfg_navx5_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-NAVX5-DATA2 payload (40 bytes)
+typedef struct __attribute__((packed)) {
+    uint16_t version;                   // 0
+    union {
+        uint16_t mask1;                 // 2
+        struct {
+            uint16_t : 2;
+            uint16_t minMax : 1;            // bit 2
+            uint16_t minCno : 1;            // bit 3
+            uint16_t : 2;
+            uint16_t initial3dfix : 1;      // bit 6
+            uint16_t : 2;
+            uint16_t wknRoll : 1;           // bit 9
+            uint16_t ackAid : 1;            // bit 10
+            uint16_t : 2;
+            uint16_t ppp : 1;               // bit 13
+            uint16_t aop : 1;               // bit 14
+            uint16_t : 1;
+        };
+    };
+    union {
+        uint32_t mask2;                 // 4
+        struct {
+            uint32_t : 6;
+            uint32_t adr : 1;               // bit 6
+            uint32_t sigAttenComp : 1;      // bit 7
+            uint32_t : 24;
+        };
+    };
+    uint8_t reserved0[2];               // 8
+    uint8_t minSVs;                     // 10: #SVs
+    uint8_t maxSVs;                     // 11: #SVs
+    uint8_t minCNO;                     // 12: dBHz
+    uint8_t reserved1;                  // 13
+    uint8_t iniFix3D;                   // 14
+    uint8_t reserved2[2];               // 15
+    uint8_t ackAiding;                  // 17
+    uint16_t wknRollover;               // 18
+    uint8_t sigAttenCompMode;           // 20: dBHz
+    uint8_t reserved3;                  // 21
+    uint8_t reserved4[2];               // 22
+    uint8_t reserved5[2];               // 24
+    uint8_t usePPP;                     // 26
+    union {
+        uint8_t aopCfg;                 // 27
+        struct {
+            uint8_t useAOP : 1;             // bit 0
+            uint8_t : 7;
+        };
+    };
+    uint8_t reserved6;                  // 28
+    uint8_t reserved7;                  // 29
+    uint16_t aopOrbMaxErr;              // 30: m
+    uint8_t reserved8[4];               // 32
+    uint8_t reserved9[3];               // 36
+    uint8_t useAdr;                     // 39
+} ubx_cfg_navx5_data2_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_navx5_data2_t, 40);
+
+#define UBX_CFG_NAVX5_DATA2(payload)            ((const ubx_cfg_navx5_data2_t *)(payload))
+#define UBX_CFG_NAVX5_DATA2_SIZE                40
+#define UBX_CFG_NAVX5_DATA2_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x06, 0x23, ubx_cfg_navx5_data2_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-NAVX5-DATA3 payload (44 bytes)
+typedef struct __attribute__((packed)) {
+    uint16_t version;                   // 0
+    union {
+        uint16_t mask1;                 // 2
+        struct {
+            uint16_t : 2;
+            uint16_t minMax : 1;            // bit 2
+            uint16_t minCno : 1;            // bit 3
+            uint16_t : 2;
+            uint16_t initial3dfix : 1;      // bit 6
+            uint16_t : 2;
+            uint16_t wknRoll : 1;           // bit 9
+            uint16_t ackAid : 1;            // bit 10
+            uint16_t : 2;
+            uint16_t ppp : 1;               // bit 13
+            uint16_t aop : 1;               // bit 14
+            uint16_t : 1;
+        };
+    };
+    union {
+        uint32_t mask2;                 // 4
+        struct {
+            uint32_t : 6;
+            uint32_t adr : 1;               // bit 6
+            uint32_t sigAttenComp : 1;      // bit 7
+            uint32_t : 24;
+        };
+    };
+    uint8_t reserved0[2];               // 8
+    uint8_t minSVs;                     // 10: #SVs
+    uint8_t maxSVs;                     // 11: #SVs
+    uint8_t minCNO;                     // 12: dBHz
+    uint8_t reserved1;                  // 13
+    uint8_t iniFix3D;                   // 14
+    uint8_t reserved2[2];               // 15
+    uint8_t ackAiding;                  // 17
+    uint16_t wknRollover;               // 18
+    uint8_t sigAttenCompMode;           // 20: dBHz
+    uint8_t reserved3;                  // 21
+    uint8_t reserved4[2];               // 22
+    uint8_t reserved5[2];               // 24
+    uint8_t usePPP;                     // 26
+    union {
+        uint8_t aopCfg;                 // 27
+        struct {
+            uint8_t useAOP : 1;             // bit 0
+            uint8_t : 7;
+        };
+    };
+    uint8_t reserved6[2];               // 28
+    uint16_t aopOrbMaxErr;              // 30: m
+    uint8_t reserved7[4];               // 32
+    uint8_t reserved8[3];               // 36
+    uint8_t useAdr;                     // 39
+    uint8_t reserved9[2];               // 40
+    uint8_t reserved10[2];              // 42
+} ubx_cfg_navx5_data3_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_navx5_data3_t, 44);
+
+#define UBX_CFG_NAVX5_DATA3(payload)            ((const ubx_cfg_navx5_data3_t *)(payload))
+#define UBX_CFG_NAVX5_DATA3_SIZE                44
+#define UBX_CFG_NAVX5_DATA3_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x06, 0x23, ubx_cfg_navx5_data3_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-NAV5-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_nav5_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_nav5_poll0_t, 0);
+
+#define UBX_CFG_NAV5_POLL0(payload)             ((const ubx_cfg_nav5_poll0_t *)(payload))
+#define UBX_CFG_NAV5_POLL0_SIZE                 0
+#define UBX_CFG_NAV5_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x06, 0x24, ubx_cfg_nav5_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-NAV5-DATA0 payload (36 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint16_t mask;                  // 0
+        struct {
+            uint16_t dyn : 1;               // bit 0
+            uint16_t minEl : 1;             // bit 1
+            uint16_t posFixMode : 1;        // bit 2
+            uint16_t drLim : 1;             // bit 3
+            uint16_t posMask : 1;           // bit 4
+            uint16_t timeMask : 1;          // bit 5
+            uint16_t staticHoldMask : 1;    // bit 6
+            uint16_t dgpsMask : 1;          // bit 7
+            uint16_t cnoThreshold : 1;      // bit 8
+            uint16_t : 1;
+            uint16_t utc : 1;               // bit 10
+            uint16_t : 5;
+        };
+    };
+    uint8_t dynModel;                   // 2
+    uint8_t fixMode;                    // 3
+    int32_t fixedAlt;                   // 4: m, *0.01
+    uint32_t fixedAltVar;               // 8: m^2, *0.0001
+    int8_t minElev;                     // 12: deg
+    uint8_t drLimit;                    // 13: s
+    uint16_t pDop;                      // 14: *0.1
+    uint16_t tDop;                      // 16: *0.1
+    uint16_t pAcc;                      // 18: m
+    uint16_t tAcc;                      // 20: m
+    uint8_t staticHoldThresh;           // 22: cm/s
+    uint8_t dgnssTimeout;               // 23: s
+    uint8_t cnoThreshNumSVs;            // 24
+    uint8_t cnoThresh;                  // 25: dBHz
+    uint8_t reserved0[2];               // 26
+    uint16_t staticHoldMaxDist;         // 28: m
+    uint8_t utcStandard;                // 30
+    uint8_t reserved1[5];               // 31
+} ubx_cfg_nav5_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_nav5_data0_t, 36);
+
+#define UBX_CFG_NAV5_DATA0(payload)             ((const ubx_cfg_nav5_data0_t *)(payload))
+#define UBX_CFG_NAV5_DATA0_SIZE                 36
+#define UBX_CFG_NAV5_DATA0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x06, 0x24, ubx_cfg_nav5_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-ESFGWT-DATA6R payload (44 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint16_t flags;                 // 0
+        struct {
+            uint16_t : 12;
+            uint16_t setVehicle : 1;        // bit 12
+            uint16_t setTime : 1;           // bit 13
+            uint16_t setWt : 1;             // bit 14
+            uint16_t : 1;
+        };
+    };
+    uint16_t id;                        // 2
+    uint32_t wtFactor;                  // 4: *1e-6
+    uint8_t reserved0[4];               // 8
+    uint32_t wtQuantError;              // 12: m, *1e-6
+    uint32_t senTtagFactor;             // 16: *1e-6
+    uint32_t wtCountMax;                // 20
+    uint32_t senTtagMax;                // 24
+    uint16_t wtLatency;                 // 28: ms
+    uint8_t reserved1[2];               // 30
+    uint8_t wtFrequency;                // 32: Hz
+    uint8_t reserved2;                  // 33
+    uint16_t speedDeadBand;             // 34: cm/s
+    uint8_t reserved3[8];               // 36
+} ubx_cfg_esfgwt_data6r_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_esfgwt_data6r_t, 44);
+
+#define UBX_CFG_ESFGWT_DATA6R(payload)          ((const ubx_cfg_esfgwt_data6r_t *)(payload))
+#define UBX_CFG_ESFGWT_DATA6R_SIZE              44
+#define UBX_CFG_ESFGWT_DATA6R_TYPED(name, ...)  UBX_MESSAGE_TYPED(name, 0x06, 0x29, ubx_cfg_esfgwt_data6r_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-ESFLA-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_esfla_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_esfla_poll0_t, 0);
+
+#define UBX_CFG_ESFLA_POLL0(payload)            ((const ubx_cfg_esfla_poll0_t *)(payload))
+#define UBX_CFG_ESFLA_POLL0_SIZE                0
+#define UBX_CFG_ESFLA_POLL0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x06, 0x2F, ubx_cfg_esfla_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-ESFLA-DATA0 configurations (8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t leverArmType;               // 0
+    uint8_t reserved1;                  // 1
+    int16_t leverArmX;                  // 2: cm
+    int16_t leverArmY;                  // 4: cm
+    int16_t leverArmZ;                  // 6: cm
+} ubx_cfg_esfla_data0_configurations_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_esfla_data0_configurations_t, 8);
+
+// UBX-CFG-ESFLA-DATA0 payload (4 + numConfigs*8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t numConfigs;                 // 1
+    uint8_t reserved0[2];               // 2
+    ubx_cfg_esfla_data0_configurations_t configurations[];// 4: repeated
+} ubx_cfg_esfla_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_esfla_data0_t, 4);
+
+#define UBX_CFG_ESFLA_DATA0(payload)            ((const ubx_cfg_esfla_data0_t *)(payload))
+#define UBX_CFG_ESFLA_DATA0_SIZE                4
+#define UBX_CFG_ESFLA_DATA0_CONFIGURATIONS(payload, i)((const ubx_cfg_esfla_data0_configurations_t *)((const uint8_t *)(payload) + 4 + (size_t)(i) * 8))
+#define UBX_CFG_ESFLA_DATA0_CONFIGURATIONS_COUNT(payload, len) \
+    ((size_t)(len) <= 4 ? 0 : (size_t)UBX_CFG_ESFLA_DATA0(payload)->numConfigs < ((size_t)(len) - 4) / 8 ? (size_t)UBX_CFG_ESFLA_DATA0(payload)->numConfigs : ((size_t)(len) - 4) / 8)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-PM-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_pm_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_pm_poll0_t, 0);
+
+#define UBX_CFG_PM_POLL0(payload)               ((const ubx_cfg_pm_poll0_t *)(payload))
+#define UBX_CFG_PM_POLL0_SIZE                   0
+#define UBX_CFG_PM_POLL0_TYPED(name, ...)       UBX_MESSAGE_TYPED(name, 0x06, 0x32, ubx_cfg_pm_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-PM-DATA0 payload (24 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0[3];               // 1
+    union {
+        uint32_t flags;                 // 4
+        struct {
+            uint32_t : 2;
+            uint32_t internal : 2;          // bit 2..3
+            uint32_t extintSelect : 1;      // bit 4
+            uint32_t extintWake : 1;        // bit 5
+            uint32_t extintBackup : 1;      // bit 6
+            uint32_t : 1;
+            uint32_t limitPeakCurr : 2;     // bit 8..9
+            uint32_t WaitTimeFix : 1;       // bit 10
+            uint32_t updateRTC : 1;         // bit 11
+            uint32_t updateEPH : 1;         // bit 12
+            uint32_t : 19;
+        };
+    };
+    uint32_t updatePeriod;              // 8: ms
+    uint32_t searchPeriod;              // 12: ms
+    uint32_t gridOffset;                // 16: ms
+    uint16_t onTime;                    // 20: s
+    uint16_t minAcqTime;                // 22: s
+} ubx_cfg_pm_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_pm_data0_t, 24);
+
+#define UBX_CFG_PM_DATA0(payload)               ((const ubx_cfg_pm_data0_t *)(payload))
+#define UBX_CFG_PM_DATA0_SIZE                   24
+#define UBX_CFG_PM_DATA0_TYPED(name, ...)       UBX_MESSAGE_TYPED(name, 0x06, 0x32, ubx_cfg_pm_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-RINV-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_rinv_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_rinv_poll0_t, 0);
+
+#define UBX_CFG_RINV_POLL0(payload)             ((const ubx_cfg_rinv_poll0_t *)(payload))
+#define UBX_CFG_RINV_POLL0_SIZE                 0
+#define UBX_CFG_RINV_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x06, 0x34, ubx_cfg_rinv_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-RINV-DATA0 group1 (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t data;                       // 0
+} ubx_cfg_rinv_data0_group1_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_rinv_data0_group1_t, 1);
+
+// UBX-CFG-RINV-DATA0 payload (1 + n*1 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint8_t flags;                  // 0
+        struct {
+            uint8_t dump : 1;               // bit 0
+            uint8_t binary : 1;             // bit 1
+            uint8_t : 6;
+        };
+    };
+    ubx_cfg_rinv_data0_group1_t group1[];// 1: repeated
+} ubx_cfg_rinv_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_rinv_data0_t, 1);
+
+#define UBX_CFG_RINV_DATA0(payload)             ((const ubx_cfg_rinv_data0_t *)(payload))
+#define UBX_CFG_RINV_DATA0_SIZE                 1
+#define UBX_CFG_RINV_DATA0_GROUP1(payload, i)   ((const ubx_cfg_rinv_data0_group1_t *)((const uint8_t *)(payload) + 1 + (size_t)(i) * 1))
+#define UBX_CFG_RINV_DATA0_GROUP1_COUNT(payload, len)((size_t)(len) > 1 ? ((size_t)(len) - 1) / 1 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-ITFM-DATA0 payload (8 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint32_t config;                // 0
+        struct {
+            uint32_t bbThreshold : 4;       // bit 0..3
+            uint32_t cwThreshold : 5;       // bit 4..8
+            uint32_t algorithmBits : 22;    // bit 9..30
+            uint32_t enable : 1;            // bit 31
+        };
+    };
+    union {
+        uint32_t config2;               // 4
+        struct {
+            uint32_t generalBits : 12;      // bit 0..11
+            uint32_t antSetting : 2;        // bit 12..13
+            uint32_t enable2 : 1;           // bit 14
+            uint32_t : 17;
+        };
+    };
+} ubx_cfg_itfm_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_itfm_data0_t, 8);
+
+#define UBX_CFG_ITFM_DATA0(payload)             ((const ubx_cfg_itfm_data0_t *)(payload))
+#define UBX_CFG_ITFM_DATA0_SIZE                 8
+#define UBX_CFG_ITFM_DATA0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x06, 0x39, ubx_cfg_itfm_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-ITFM-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_itfm_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_itfm_poll0_t, 0);
+
+#define UBX_CFG_ITFM_POLL0(payload)             ((const ubx_cfg_itfm_poll0_t *)(payload))
+#define UBX_CFG_ITFM_POLL0_SIZE                 0
+#define UBX_CFG_ITFM_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x06, 0x39, ubx_cfg_itfm_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-PM2-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_pm2_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_pm2_poll0_t, 0);
+
+#define UBX_CFG_PM2_POLL0(payload)              ((const ubx_cfg_pm2_poll0_t *)(payload))
+#define UBX_CFG_PM2_POLL0_SIZE                  0
+#define UBX_CFG_PM2_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x3B, ubx_cfg_pm2_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-PM2-DATA0 payload (44 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0;                  // 1
+    uint8_t maxStartupStateDur;         // 2: s
+    uint8_t reserved1;                  // 3
+    union {
+        uint32_t flags;                 // 4
+        struct {
+            uint32_t : 4;
+            uint32_t extintSel : 1;         // bit 4
+            uint32_t extintWake : 1;        // bit 5
+            uint32_t extintBackup : 1;      // bit 6
+            uint32_t : 1;
+            uint32_t limitPeakCurr : 2;     // bit 8..9
+            uint32_t waitTimeFix : 1;       // bit 10
+            uint32_t updateRTC : 1;         // bit 11
+            uint32_t updateEPH : 1;         // bit 12
+            uint32_t : 3;
+            uint32_t doNotEnterOff : 1;     // bit 16
+            uint32_t mode : 2;              // bit 17..18
+            uint32_t : 13;
+        };
+    };
+    uint32_t updatePeriod;              // 8: ms
+    uint32_t searchPeriod;              // 12: ms
+    uint32_t gridOffset;                // 16: ms
+    uint16_t onTime;                    // 20: s
+    uint16_t minAcqTime;                // 22: s
+    uint8_t reserved2[20];              // 24
+} ubx_cfg_pm2_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_pm2_data0_t, 44);
+
+#define UBX_CFG_PM2_DATA0(payload)              ((const ubx_cfg_pm2_data0_t *)(payload))
+#define UBX_CFG_PM2_DATA0_SIZE                  44
+#define UBX_CFG_PM2_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x3B, ubx_cfg_pm2_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-PM2-DATA1 payload (48 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0;                  // 1
+    uint8_t maxStartupStateDur;         // 2: s
+    uint8_t reserved1;                  // 3
+    union {
+        uint32_t flags;                 // 4
+        struct {
+            uint32_t : 4;
+            uint32_t extintSel : 1;         // bit 4
+            uint32_t extintWake : 1;        // bit 5
+            uint32_t extintBackup : 1;      // bit 6
+            uint32_t extintInactive : 1;    // bit 7
+            uint32_t limitPeakCurr : 2;     // bit 8..9
+            uint32_t waitTimeFix : 1;       // bit 10
+            uint32_t updateRTC : 1;         // bit 11
+            uint32_t updateEPH : 1;         // bit 12
+            uint32_t : 3;
+            uint32_t doNotEnterOff : 1;     // bit 16
+            uint32_t mode : 2;              // bit 17..18
+            uint32_t : 13;
+        };
+    };
+    uint32_t updatePeriod;              // 8: ms
+    uint32_t searchPeriod;              // 12: ms
+    uint32_t gridOffset;                // 16: ms
+    uint16_t onTime;                    // 20: s
+    uint16_t minAcqTime;                // 22: s
+    uint8_t reserved2[20];              // 24
+    uint32_t extintInactivityMs;        // 44: ms
+} ubx_cfg_pm2_data1_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_pm2_data1_t, 48);
+
+#define UBX_CFG_PM2_DATA1(payload)              ((const ubx_cfg_pm2_data1_t *)(payload))
+#define UBX_CFG_PM2_DATA1_SIZE                  48
+#define UBX_CFG_PM2_DATA1_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x3B, ubx_cfg_pm2_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-PM2-DATA2 payload (48 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0;                  // 1
+    uint8_t maxStartupStateDur;         // 2: s
+    uint8_t reserved1;                  // 3
+    union {
+        uint32_t flags;                 // 4
+        struct {
+            uint32_t : 1;
+            uint32_t optTarget : 3;         // bit 1..3
+            uint32_t extintSel : 1;         // bit 4
+            uint32_t extintWake : 1;        // bit 5
+            uint32_t extintBackup : 1;      // bit 6
+            uint32_t extintInactive : 1;    // bit 7
+            uint32_t limitPeakCurr : 2;     // bit 8..9
+            uint32_t waitTimeFix : 1;       // bit 10
+            uint32_t updateRTC : 1;         // bit 11
+            uint32_t updateEPH : 1;         // bit 12
+            uint32_t : 3;
+            uint32_t doNotEnterOff : 1;     // bit 16
+            uint32_t mode : 2;              // bit 17..18
+            uint32_t : 13;
+        };
+    };
+    uint32_t updatePeriod;              // 8: ms
+    uint32_t searchPeriod;              // 12: ms
+    uint32_t gridOffset;                // 16: ms
+    uint16_t onTime;                    // 20: s
+    uint16_t minAcqTime;                // 22: s
+    uint8_t reserved2[20];              // 24
+    uint32_t extintInactivityMs;        // 44: ms
+} ubx_cfg_pm2_data2_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_pm2_data2_t, 48);
+
+#define UBX_CFG_PM2_DATA2(payload)              ((const ubx_cfg_pm2_data2_t *)(payload))
+#define UBX_CFG_PM2_DATA2_SIZE                  48
+#define UBX_CFG_PM2_DATA2_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x3B, ubx_cfg_pm2_data2_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-TMODE2-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_tmode2_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_tmode2_poll0_t, 0);
+
+#define UBX_CFG_TMODE2_POLL0(payload)           ((const ubx_cfg_tmode2_poll0_t *)(payload))
+#define UBX_CFG_TMODE2_POLL0_SIZE               0
+#define UBX_CFG_TMODE2_POLL0_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, 0x06, 0x3D, ubx_cfg_tmode2_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-TMODE2-DATA0 payload (28 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t timeMode;                   // 0
+    uint8_t reserved0;                  // 1
+    union {
+        uint16_t flags;                 // 2
+        struct {
+            uint16_t lla : 1;               // bit 0
+            uint16_t altInv : 1;            // bit 1
+            uint16_t : 14;
+        };
+    };
+    int32_t ecefXOrLat;                 // 4: cm_or_deg*1e-7
+    int32_t ecefYOrLon;                 // 8: cm_or_deg*1e-7
+    int32_t ecefZOrAlt;                 // 12: cm
+    uint32_t fixedPosAcc;               // 16: mm
+    uint32_t svinMinDur;                // 20: s
+    uint32_t svinAccLimit;              // 24: mm
+} ubx_cfg_tmode2_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_tmode2_data0_t, 28);
+
+#define UBX_CFG_TMODE2_DATA0(payload)           ((const ubx_cfg_tmode2_data0_t *)(payload))
+#define UBX_CFG_TMODE2_DATA0_SIZE               28
+#define UBX_CFG_TMODE2_DATA0_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, 0x06, 0x3D, ubx_cfg_tmode2_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-GNSS-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_gnss_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_gnss_poll0_t, 0);
+
+#define UBX_CFG_GNSS_POLL0(payload)             ((const ubx_cfg_gnss_poll0_t *)(payload))
+#define UBX_CFG_GNSS_POLL0_SIZE                 0
+#define UBX_CFG_GNSS_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x06, 0x3E, ubx_cfg_gnss_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-GNSS-DATA0 configs (8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t gnssId;                     // 0
+    uint8_t resTrkCh;                   // 1
+    uint8_t maxTrkCh;                   // 2
+    uint8_t reserved0;                  // 3
+    union {
+        uint32_t flags;                 // 4
+        struct {
+            uint32_t enable : 1;            // bit 0
+            uint32_t : 15;
+            uint32_t sigCfgMask : 8;        // bit 16..23
+            uint32_t : 8;
+        };
+    };
+} ubx_cfg_gnss_data0_configs_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_gnss_data0_configs_t, 8);
+
+// UBX-CFG-GNSS-DATA0 payload (4 + numConfigBlocks*8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t msgVer;                     // 0
+    uint8_t numTrkChHw;                 // 1
+    uint8_t numTrkChUse;                // 2
+    uint8_t numConfigBlocks;            // 3
+    ubx_cfg_gnss_data0_configs_t configs[];// 4: repeated
+} ubx_cfg_gnss_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_gnss_data0_t, 4);
+
+#define UBX_CFG_GNSS_DATA0(payload)             ((const ubx_cfg_gnss_data0_t *)(payload))
+#define UBX_CFG_GNSS_DATA0_SIZE                 4
+#define UBX_CFG_GNSS_DATA0_CONFIGS(payload, i)  ((const ubx_cfg_gnss_data0_configs_t *)((const uint8_t *)(payload) + 4 + (size_t)(i) * 8))
+#define UBX_CFG_GNSS_DATA0_CONFIGS_COUNT(payload, len) \
+    ((size_t)(len) <= 4 ? 0 : (size_t)UBX_CFG_GNSS_DATA0(payload)->numConfigBlocks < ((size_t)(len) - 4) / 8 ? (size_t)UBX_CFG_GNSS_DATA0(payload)->numConfigBlocks : ((size_t)(len) - 4) / 8)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-IMES-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_imes_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_imes_poll0_t, 0);
+
+#define UBX_CFG_IMES_POLL0(payload)             ((const ubx_cfg_imes_poll0_t *)(payload))
+#define UBX_CFG_IMES_POLL0_SIZE                 0
+#define UBX_CFG_IMES_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x06, 0x3F, ubx_cfg_imes_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-OTP-WRITEFILEJU-A4 group1 (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t cfgData;                    // 0
+} ubx_cfg_otp_writefileju_a4_group1_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_otp_writefileju_a4_group1_t, 1);
+
+// UBX-CFG-OTP-WRITEFILEJU-A4 payload (12 + n*1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t cfgHeader[12];              // 0
+    ubx_cfg_otp_writefileju_a4_group1_t group1[];// 12: repeated
+} ubx_cfg_otp_writefileju_a4_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_otp_writefileju_a4_t, 12);
+
+#define UBX_CFG_OTP_WRITEFILEJU_A4(payload)     ((const ubx_cfg_otp_writefileju_a4_t *)(payload))
+#define UBX_CFG_OTP_WRITEFILEJU_A4_SIZE         12
+#define UBX_CFG_OTP_WRITEFILEJU_A4_GROUP1(payload, i)((const ubx_cfg_otp_writefileju_a4_group1_t *)((const uint8_t *)(payload) + 12 + (size_t)(i) * 1))
+#define UBX_CFG_OTP_WRITEFILEJU_A4_GROUP1_COUNT(payload, len)((size_t)(len) > 12 ? ((size_t)(len) - 12) / 1 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-OTP-WRITEFILEJU-37 payload (15 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t operation;                  // 1
+    uint8_t fileID;                     // 2
+    union {
+        uint8_t lengthMask;             // 3
+        struct {
+            uint8_t length : 7;             // bit 0..6
+            uint8_t mask : 1;               // bit 7
+        };
+    };
+    uint8_t reserved0[4];               // 4
+    uint32_t key;                       // 8
+    union {
+        uint8_t antSupCfg1;             // 12
+        struct {
+            uint8_t voltageControl : 1;     // bit 0
+            uint8_t shortDetection : 1;     // bit 1
+            uint8_t openDetection : 1;      // bit 2
+            uint8_t powerDown : 1;          // bit 3
+            uint8_t shortDetectionPol : 1;  // bit 4
+            uint8_t openDetectionPol : 1;   // bit 5
+            uint8_t powerDownPol : 1;       // bit 6
+            uint8_t recover : 1;            // bit 7
+        };
+    };
+    union {
+        uint8_t antSupCfg2;             // 13
+        struct {
+            uint8_t switchPin : 4;          // bit 0..3
+            uint8_t shortPin : 4;           // bit 4..7
+        };
+    };
+    union {
+        uint8_t antSupCfg3;             // 14
+        struct {
+            uint8_t openPin : 4;            // bit 0..3
+            uint8_t i2cEnabled : 1;         // bit 4
+            uint8_t uartEnabled : 1;        // bit 5
+            uint8_t timePulseEnabled : 1;   // bit 6
+            uint8_t : 1;
+        };
+    };
+} ubx_cfg_otp_writefileju_37_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_otp_writefileju_37_t, 15);
+
+#define UBX_CFG_OTP_WRITEFILEJU_37(payload)     ((const ubx_cfg_otp_writefileju_37_t *)(payload))
+#define UBX_CFG_OTP_WRITEFILEJU_37_SIZE         15
+#define UBX_CFG_OTP_WRITEFILEJU_37_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x06, 0x41, ubx_cfg_otp_writefileju_37_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-LOGFILTER-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_logfilter_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_logfilter_poll0_t, 0);
+
+#define UBX_CFG_LOGFILTER_POLL0(payload)        ((const ubx_cfg_logfilter_poll0_t *)(payload))
+#define UBX_CFG_LOGFILTER_POLL0_SIZE            0
+#define UBX_CFG_LOGFILTER_POLL0_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x06, 0x47, ubx_cfg_logfilter_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-LOGFILTER-DATA0 payload (12 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    union {
+        uint8_t flags;                  // 1
+        struct {
+            uint8_t recordEnabled : 1;      // bit 0
+            uint8_t psmOncePerWakupEnabled : 1;// bit 1
+            uint8_t applyAllFilterSettings : 1;// bit 2
+            uint8_t : 5;
+        };
+    };
+    uint16_t minInterval;               // 2: s
+    uint16_t timeThreshold;             // 4: s
+    uint16_t speedThreshold;            // 6: m/s
+    uint32_t positionThreshold;         // 8: m
+} ubx_cfg_logfilter_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_logfilter_data0_t, 12);
+
+#define UBX_CFG_LOGFILTER_DATA0(payload)        ((const ubx_cfg_logfilter_data0_t *)(payload))
+#define UBX_CFG_LOGFILTER_DATA0_SIZE            12
+#define UBX_CFG_LOGFILTER_DATA0_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x06, 0x47, ubx_cfg_logfilter_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-ESFA-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_esfa_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_esfa_poll0_t, 0);
+
+#define UBX_CFG_ESFA_POLL0(payload)             ((const ubx_cfg_esfa_poll0_t *)(payload))
+#define UBX_CFG_ESFA_POLL0_SIZE                 0
+#define UBX_CFG_ESFA_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x06, 0x4C, ubx_cfg_esfa_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-ESFA-DATA0 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0[9];               // 1
+    uint8_t accelRmsThdl;               // 10: m/s^2, *2^-6
+    uint8_t frequency;                  // 11: Hz
+    uint16_t latency;                   // 12: ms
+    uint16_t accuracy;                  // 14: m/s^2, *1e-4
+    uint8_t reserved1[4];               // 16
+} ubx_cfg_esfa_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_esfa_data0_t, 20);
+
+#define UBX_CFG_ESFA_DATA0(payload)             ((const ubx_cfg_esfa_data0_t *)(payload))
+#define UBX_CFG_ESFA_DATA0_SIZE                 20
+#define UBX_CFG_ESFA_DATA0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x06, 0x4C, ubx_cfg_esfa_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-ESFG-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_esfg_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_esfg_poll0_t, 0);
+
+#define UBX_CFG_ESFG_POLL0(payload)             ((const ubx_cfg_esfg_poll0_t *)(payload))
+#define UBX_CFG_ESFG_POLL0_SIZE                 0
+#define UBX_CFG_ESFG_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x06, 0x4D, ubx_cfg_esfg_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-ESFG-DATA0 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0[7];               // 1
+    uint16_t tcTableSaveRate;           // 8: s
+    uint8_t gyroRmsThdl;                // 10: deg/s, *2^-8
+    uint8_t frequency;                  // 11: Hz
+    uint16_t latency;                   // 12: ms
+    uint16_t accuracy;                  // 14: deg/s, *1e-3
+    uint8_t reserved1[4];               // 16
+} ubx_cfg_esfg_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_esfg_data0_t, 20);
+
+#define UBX_CFG_ESFG_DATA0(payload)             ((const ubx_cfg_esfg_data0_t *)(payload))
+#define UBX_CFG_ESFG_DATA0_SIZE                 20
+#define UBX_CFG_ESFG_DATA0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x06, 0x4D, ubx_cfg_esfg_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-TXSLOT-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_txslot_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_txslot_poll0_t, 0);
+
+#define UBX_CFG_TXSLOT_POLL0(payload)           ((const ubx_cfg_txslot_poll0_t *)(payload))
+#define UBX_CFG_TXSLOT_POLL0_SIZE               0
+#define UBX_CFG_TXSLOT_POLL0_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, 0x06, 0x53, ubx_cfg_txslot_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-TXSLOT-DATA0 slots (4 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t end;                       // 0
+} ubx_cfg_txslot_data0_slots_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_txslot_data0_slots_t, 4);
+
+// UBX-CFG-TXSLOT-DATA0 payload (4 + 3*4 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    union {
+        uint8_t enable;                 // 1
+        struct {
+            uint8_t DDC : 1;                // bit 0
+            uint8_t UART1 : 1;              // bit 1
+            uint8_t UART2 : 1;              // bit 2
+            uint8_t USB : 1;                // bit 3
+            uint8_t SPI : 1;                // bit 4
+            uint8_t : 3;
+        };
+    };
+    uint8_t refTp;                      // 2
+    uint8_t reserved0;                  // 3
+    ubx_cfg_txslot_data0_slots_t slots[3];// 4
+} ubx_cfg_txslot_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_txslot_data0_t, 16);
+
+#define UBX_CFG_TXSLOT_DATA0(payload)           ((const ubx_cfg_txslot_data0_t *)(payload))
+#define UBX_CFG_TXSLOT_DATA0_SIZE               16
+#define UBX_CFG_TXSLOT_DATA0_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, 0x06, 0x53, ubx_cfg_txslot_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-ESFALG-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_esfalg_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_esfalg_poll0_t, 0);
+
+#define UBX_CFG_ESFALG_POLL0(payload)           ((const ubx_cfg_esfalg_poll0_t *)(payload))
+#define UBX_CFG_ESFALG_POLL0_SIZE               0
+#define UBX_CFG_ESFALG_POLL0_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, 0x06, 0x56, ubx_cfg_esfalg_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-ESFALG-DATA0 payload (12 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint32_t bitfield;              // 0
+        struct {
+            uint32_t version : 8;           // bit 0..7
+            uint32_t doAutoMntAlg : 1;      // bit 8
+            uint32_t : 23;
+        };
+    };
+    uint32_t yaw;                       // 4: deg, *1e-2
+    int16_t pitch;                      // 8: deg, *1e-2
+    int16_t roll;                       // 10: deg, *1e-2
+} ubx_cfg_esfalg_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_esfalg_data0_t, 12);
+
+#define UBX_CFG_ESFALG_DATA0(payload)           ((const ubx_cfg_esfalg_data0_t *)(payload))
+#define UBX_CFG_ESFALG_DATA0_SIZE               12
+#define UBX_CFG_ESFALG_DATA0_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, 0x06, 0x56, ubx_cfg_esfalg_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-PWR-DATA1 payload (8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0[3];               // 1
+    uint32_t state;                     // 4
+} ubx_cfg_pwr_data1_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_pwr_data1_t, 8);
+
+#define UBX_CFG_PWR_DATA1(payload)              ((const ubx_cfg_pwr_data1_t *)(payload))
+#define UBX_CFG_PWR_DATA1_SIZE                  8
+#define UBX_CFG_PWR_DATA1_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x57, ubx_cfg_pwr_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-HNR-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_hnr_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_hnr_poll0_t, 0);
+
+#define UBX_CFG_HNR_POLL0(payload)              ((const ubx_cfg_hnr_poll0_t *)(payload))
+#define UBX_CFG_HNR_POLL0_SIZE                  0
+#define UBX_CFG_HNR_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x5C, ubx_cfg_hnr_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-HNR-DATA0 payload (4 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t highNavRate;                // 0: Hz
+    uint8_t reserved0[3];               // 1
+} ubx_cfg_hnr_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_hnr_data0_t, 4);
+
+#define UBX_CFG_HNR_DATA0(payload)              ((const ubx_cfg_hnr_data0_t *)(payload))
+#define UBX_CFG_HNR_DATA0_SIZE                  4
+#define UBX_CFG_HNR_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x5C, ubx_cfg_hnr_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-ESRC-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_esrc_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_esrc_poll0_t, 0);
+
+#define UBX_CFG_ESRC_POLL0(payload)             ((const ubx_cfg_esrc_poll0_t *)(payload))
+#define UBX_CFG_ESRC_POLL0_SIZE                 0
+#define UBX_CFG_ESRC_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x06, 0x60, ubx_cfg_esrc_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-ESRC-DATA0 sources (36 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t extInt;                     // 0
+    uint8_t sourceType;                 // 1
+    union {
+        uint16_t flags;                 // 2
+        struct {
+            uint16_t polarity : 1;          // bit 0
+            uint16_t gnssUtc : 1;           // bit 1
+            uint16_t : 14;
+        };
+    };
+    uint32_t freq;                      // 4: Hz, *2^-2
+    uint8_t reserved1[4];               // 8
+    uint32_t withTemp;                  // 12: ppb, *2^-8
+    uint32_t withAge;                   // 16: ppb/year, *2^-8
+    uint16_t timeToTemp;                // 20: s
+    uint16_t maxDevLifeTime;            // 22: ppb
+    int32_t offset;                     // 24: ns
+    uint32_t offsetUncertainty;         // 28: ns
+    uint32_t jitter;                    // 32: ns/s
+} ubx_cfg_esrc_data0_sources_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_esrc_data0_sources_t, 36);
+
+// UBX-CFG-ESRC-DATA0 payload (4 + numSources*36 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t numSources;                 // 1
+    uint8_t reserved0[2];               // 2
+    ubx_cfg_esrc_data0_sources_t sources[];// 4: repeated
+} ubx_cfg_esrc_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_esrc_data0_t, 4);
+
+#define UBX_CFG_ESRC_DATA0(payload)             ((const ubx_cfg_esrc_data0_t *)(payload))
+#define UBX_CFG_ESRC_DATA0_SIZE                 4
+#define UBX_CFG_ESRC_DATA0_SOURCES(payload, i)  ((const ubx_cfg_esrc_data0_sources_t *)((const uint8_t *)(payload) + 4 + (size_t)(i) * 36))
+#define UBX_CFG_ESRC_DATA0_SOURCES_COUNT(payload, len) \
+    ((size_t)(len) <= 4 ? 0 : (size_t)UBX_CFG_ESRC_DATA0(payload)->numSources < ((size_t)(len) - 4) / 36 ? (size_t)UBX_CFG_ESRC_DATA0(payload)->numSources : ((size_t)(len) - 4) / 36)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-DOSC-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_dosc_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_dosc_poll0_t, 0);
+
+#define UBX_CFG_DOSC_POLL0(payload)             ((const ubx_cfg_dosc_poll0_t *)(payload))
+#define UBX_CFG_DOSC_POLL0_SIZE                 0
+#define UBX_CFG_DOSC_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x06, 0x61, ubx_cfg_dosc_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-DOSC-DATA0 oscillators (32 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t oscId;                      // 0
+    uint8_t reserved1;                  // 1
+    union {
+        uint16_t flags;                 // 2
+        struct {
+            uint16_t isCalibrated : 1;      // bit 0
+            uint16_t controlIf : 4;         // bit 1..4
+            uint16_t : 11;
+        };
+    };
+    uint32_t freq;                      // 4: Hz, *2^-2
+    int32_t phaseOffset;                // 8: ps
+    uint32_t withTemp;                  // 12: ppb, *2^-8
+    uint32_t withAge;                   // 16: ppb/year, *2^-8
+    uint16_t timeToTemp;                // 20: s
+    uint8_t reserved2[2];               // 22
+    int32_t gainVco;                    // 24: ppb/raw LSB, *2^-16
+    uint8_t gainUncertainty;            // 28: *2^-8
+    uint8_t reserved3[3];               // 29
+} ubx_cfg_dosc_data0_oscillators_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_dosc_data0_oscillators_t, 32);
+
+// UBX-CFG-DOSC-DATA0 payload (4 + numOsc*32 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t numOsc;                     // 1
+    uint8_t reserved0[2];               // 2
+    ubx_cfg_dosc_data0_oscillators_t oscillators[];// 4: repeated
+} ubx_cfg_dosc_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_dosc_data0_t, 4);
+
+#define UBX_CFG_DOSC_DATA0(payload)             ((const ubx_cfg_dosc_data0_t *)(payload))
+#define UBX_CFG_DOSC_DATA0_SIZE                 4
+#define UBX_CFG_DOSC_DATA0_OSCILLATORS(payload, i)((const ubx_cfg_dosc_data0_oscillators_t *)((const uint8_t *)(payload) + 4 + (size_t)(i) * 32))
+#define UBX_CFG_DOSC_DATA0_OSCILLATORS_COUNT(payload, len) \
+    ((size_t)(len) <= 4 ? 0 : (size_t)UBX_CFG_DOSC_DATA0(payload)->numOsc < ((size_t)(len) - 4) / 32 ? (size_t)UBX_CFG_DOSC_DATA0(payload)->numOsc : ((size_t)(len) - 4) / 32)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-SMGR-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_smgr_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_smgr_poll0_t, 0);
+
+#define UBX_CFG_SMGR_POLL0(payload)             ((const ubx_cfg_smgr_poll0_t *)(payload))
+#define UBX_CFG_SMGR_POLL0_SIZE                 0
+#define UBX_CFG_SMGR_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x06, 0x62, ubx_cfg_smgr_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-SMGR-DATA0 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t minGNSSFix;                 // 1
+    uint16_t maxFreqChangeRate;         // 2: ppb/s
+    uint16_t maxPhaseCorrRate;          // 4: ns/s
+    uint8_t reserved0[2];               // 6
+    uint16_t freqTolerance;             // 8: ppb
+    uint16_t timeTolerance;             // 10: ns
+    union {
+        uint16_t messageCfg;            // 12
+        struct {
+            uint16_t measInternal : 1;      // bit 0
+            uint16_t measGNSS : 1;          // bit 1
+            uint16_t measEXTINT0 : 1;       // bit 2
+            uint16_t measEXTINT1 : 1;       // bit 3
+            uint16_t : 12;
+        };
+    };
+    uint16_t maxSlewRate;               // 14: us/s
+    union {
+        uint32_t flags;                 // 16
+        struct {
+            uint32_t disableInternal : 1;   // bit 0
+            uint32_t disableExternal : 1;   // bit 1
+            uint32_t preferenceMode : 1;    // bit 2
+            uint32_t enableGNSS : 1;        // bit 3
+            uint32_t enableEXTINT0 : 1;     // bit 4
+            uint32_t enableEXTINT1 : 1;     // bit 5
+            uint32_t enableHostMeasInt : 1; // bit 6
+            uint32_t enableHostMeasExt : 1; // bit 7
+            uint32_t : 2;
+            uint32_t useAnyFix : 1;         // bit 10
+            uint32_t disableMaxSlewRate : 1;// bit 11
+            uint32_t issueFreqWarning : 1;  // bit 12
+            uint32_t issueTimeWarning : 1;  // bit 13
+            uint32_t TPCoherent : 2;        // bit 14..15
+            uint32_t disableOffset : 1;     // bit 16
+            uint32_t : 15;
+        };
+    };
+} ubx_cfg_smgr_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_smgr_data0_t, 20);
+
+#define UBX_CFG_SMGR_DATA0(payload)             ((const ubx_cfg_smgr_data0_t *)(payload))
+#define UBX_CFG_SMGR_DATA0_SIZE                 20
+#define UBX_CFG_SMGR_DATA0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x06, 0x62, ubx_cfg_smgr_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-SPT-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_spt_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_spt_poll0_t, 0);
+
+#define UBX_CFG_SPT_POLL0(payload)              ((const ubx_cfg_spt_poll0_t *)(payload))
+#define UBX_CFG_SPT_POLL0_SIZE                  0
+#define UBX_CFG_SPT_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x64, ubx_cfg_spt_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-SPT-DATA0 payload (12 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0;                  // 1
+    uint16_t sensorId;                  // 2
+    uint8_t reserved1[8];               // 4
+} ubx_cfg_spt_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_spt_data0_t, 12);
+
+#define UBX_CFG_SPT_DATA0(payload)              ((const ubx_cfg_spt_data0_t *)(payload))
+#define UBX_CFG_SPT_DATA0_SIZE                  12
+#define UBX_CFG_SPT_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x64, ubx_cfg_spt_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-GEOFENCE-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_geofence_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_geofence_poll0_t, 0);
+
+#define UBX_CFG_GEOFENCE_POLL0(payload)         ((const ubx_cfg_geofence_poll0_t *)(payload))
+#define UBX_CFG_GEOFENCE_POLL0_SIZE             0
+#define UBX_CFG_GEOFENCE_POLL0_TYPED(name, ...) UBX_MESSAGE_TYPED(name, 0x06, 0x69, ubx_cfg_geofence_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-GEOFENCE-DATA0 fences (12 bytes)
+typedef struct __attribute__((packed)) {
+    int32_t lat;                        // 0: deg, *1e-7
+    int32_t lon;                        // 4: deg, *1e-7
+    uint32_t radius;                    // 8: m, *1e-2
+} ubx_cfg_geofence_data0_fences_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_geofence_data0_fences_t, 12);
+
+// UBX-CFG-GEOFENCE-DATA0 payload (8 + numFences*12 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t numFences;                  // 1
+    uint8_t confLvl;                    // 2
+    uint8_t reserved0;                  // 3
+    uint8_t pioEnabled;                 // 4
+    uint8_t pinPolarity;                // 5
+    uint8_t pin;                        // 6
+    uint8_t reserved1;                  // 7
+    ubx_cfg_geofence_data0_fences_t fences[];// 8: repeated
+} ubx_cfg_geofence_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_geofence_data0_t, 8);
+
+#define UBX_CFG_GEOFENCE_DATA0(payload)         ((const ubx_cfg_geofence_data0_t *)(payload))
+#define UBX_CFG_GEOFENCE_DATA0_SIZE             8
+#define UBX_CFG_GEOFENCE_DATA0_FENCES(payload, i)((const ubx_cfg_geofence_data0_fences_t *)((const uint8_t *)(payload) + 8 + (size_t)(i) * 12))
+#define UBX_CFG_GEOFENCE_DATA0_FENCES_COUNT(payload, len) \
+    ((size_t)(len) <= 8 ? 0 : (size_t)UBX_CFG_GEOFENCE_DATA0(payload)->numFences < ((size_t)(len) - 8) / 12 ? (size_t)UBX_CFG_GEOFENCE_DATA0(payload)->numFences : ((size_t)(len) - 8) / 12)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-DGNSS-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_dgnss_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_dgnss_poll0_t, 0);
+
+#define UBX_CFG_DGNSS_POLL0(payload)            ((const ubx_cfg_dgnss_poll0_t *)(payload))
+#define UBX_CFG_DGNSS_POLL0_SIZE                0
+#define UBX_CFG_DGNSS_POLL0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x06, 0x70, ubx_cfg_dgnss_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-DGNSS-DATA1 payload (4 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t dgnssMode;                  // 0
+    uint8_t reserved0[3];               // 1
+} ubx_cfg_dgnss_data1_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_dgnss_data1_t, 4);
+
+#define UBX_CFG_DGNSS_DATA1(payload)            ((const ubx_cfg_dgnss_data1_t *)(payload))
+#define UBX_CFG_DGNSS_DATA1_SIZE                4
+#define UBX_CFG_DGNSS_DATA1_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x06, 0x70, ubx_cfg_dgnss_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-TMODE3-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_tmode3_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_tmode3_poll0_t, 0);
+
+#define UBX_CFG_TMODE3_POLL0(payload)           ((const ubx_cfg_tmode3_poll0_t *)(payload))
+#define UBX_CFG_TMODE3_POLL0_SIZE               0
+#define UBX_CFG_TMODE3_POLL0_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, 0x06, 0x71, ubx_cfg_tmode3_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-TMODE3-DATA0 payload (40 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0;                  // 1
+    union {
+        uint16_t flags;                 // 2
+        struct {
+            uint16_t mode : 8;              // bit 0..7
+            uint16_t lla : 1;               // bit 8
+            uint16_t : 7;
+        };
+    };
+    int32_t ecefXOrLat;                 // 4: cm_or_deg*1e-7
+    int32_t ecefYOrLon;                 // 8: cm_or_deg*1e-7
+    int32_t ecefZOrAlt;                 // 12: cm
+    int8_t ecefXOrLatHP;                // 16: 0.1_mm_or_deg*1e-9
+    int8_t ecefYOrLonHP;                // 17: 0.1_mm_or_deg*1e-9
+    int8_t ecefZOrAltHP;                // 18: 0.1_mm
+    uint8_t reserved1;                  // 19
+    uint32_t fixedPosAcc;               // 20: 0.1_mm
+    uint32_t svinMinDur;                // 24: s
+    uint32_t svinAccLimit;              // 28: 0.1_mm
+    uint8_t reserved2[8];               // 32
+} ubx_cfg_tmode3_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_tmode3_data0_t, 40);
+
+#define UBX_CFG_TMODE3_DATA0(payload)           ((const ubx_cfg_tmode3_data0_t *)(payload))
+#define UBX_CFG_TMODE3_DATA0_SIZE               40
+#define UBX_CFG_TMODE3_DATA0_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, 0x06, 0x71, ubx_cfg_tmode3_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-ESFWT-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_esfwt_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_esfwt_poll0_t, 0);
+
+#define UBX_CFG_ESFWT_POLL0(payload)            ((const ubx_cfg_esfwt_poll0_t *)(payload))
+#define UBX_CFG_ESFWT_POLL0_SIZE                0
+#define UBX_CFG_ESFWT_POLL0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x06, 0x82, ubx_cfg_esfwt_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-ESFWT-DATA0 payload (32 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    union {
+        uint8_t flags1;                 // 1
+        struct {
+            uint8_t combineTicks : 1;       // bit 0
+            uint8_t : 3;
+            uint8_t useWtSpeed : 1;         // bit 4
+            uint8_t dirPinPol : 1;          // bit 5
+            uint8_t useWtPin : 1;           // bit 6
+            uint8_t : 1;
+        };
+    };
+    union {
+        uint8_t flags2;                 // 2
+        struct {
+            uint8_t autoWtCountMaxOff : 1;  // bit 0
+            uint8_t autoDirPinPolOff : 1;   // bit 1
+            uint8_t autoSoftwareWtOff : 1;  // bit 2
+            uint8_t autoUseWtSpeedOff : 1;  // bit 3
+            uint8_t : 4;
+        };
+    };
+    uint8_t reserved0;                  // 3
+    uint32_t wtFactor;                  // 4: *1e-6
+    uint32_t wtQuantError;              // 8: m (or m/s), *1e-6
+    uint32_t wtCountMax;                // 12
+    uint16_t wtLatency;                 // 16: ms
+    uint8_t wtFrequency;                // 18: Hz
+    union {
+        uint8_t flags3;                 // 19
+        struct {
+            uint8_t : 4;
+            uint8_t cntBothEdges : 1;       // bit 4
+            uint8_t : 3;
+        };
+    };
+    uint16_t speedDeadBand;             // 20: cm/s
+    uint8_t reserved1[10];              // 22
+} ubx_cfg_esfwt_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_esfwt_data0_t, 32);
+
+#define UBX_CFG_ESFWT_DATA0(payload)            ((const ubx_cfg_esfwt_data0_t *)(payload))
+#define UBX_CFG_ESFWT_DATA0_SIZE                32
+#define UBX_CFG_ESFWT_DATA0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x06, 0x82, ubx_cfg_esfwt_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-PMS-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_pms_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_pms_poll0_t, 0);
+
+#define UBX_CFG_PMS_POLL0(payload)              ((const ubx_cfg_pms_poll0_t *)(payload))
+#define UBX_CFG_PMS_POLL0_SIZE                  0
+#define UBX_CFG_PMS_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x86, ubx_cfg_pms_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-PMS-DATA0 payload (8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t powerSetupValue;            // 1
+    uint16_t period;                    // 2: s
+    uint16_t onTime;                    // 4: s
+    uint8_t reserved0[2];               // 6
+} ubx_cfg_pms_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_pms_data0_t, 8);
+
+#define UBX_CFG_PMS_DATA0(payload)              ((const ubx_cfg_pms_data0_t *)(payload))
+#define UBX_CFG_PMS_DATA0_SIZE                  8
+#define UBX_CFG_PMS_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x06, 0x86, ubx_cfg_pms_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-SENIF-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_senif_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_senif_poll0_t, 0);
+
+#define UBX_CFG_SENIF_POLL0(payload)            ((const ubx_cfg_senif_poll0_t *)(payload))
+#define UBX_CFG_SENIF_POLL0_SIZE                0
+#define UBX_CFG_SENIF_POLL0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x06, 0x88, ubx_cfg_senif_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-SENIF-I2CDATA0 payload (6 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    union {
+        uint16_t flags;                 // 2
+        struct {
+            uint16_t senConn : 1;           // bit 0
+            uint16_t : 15;
+        };
+    };
+    union {
+        uint16_t pioConf;               // 4
+        struct {
+            uint16_t i2cSdaPio : 5;         // bit 0..4
+            uint16_t i2cSclPio : 5;         // bit 5..9
+            uint16_t : 6;
+        };
+    };
+} ubx_cfg_senif_i2cdata0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_senif_i2cdata0_t, 6);
+
+#define UBX_CFG_SENIF_I2CDATA0(payload)         ((const ubx_cfg_senif_i2cdata0_t *)(payload))
+#define UBX_CFG_SENIF_I2CDATA0_SIZE             6
+#define UBX_CFG_SENIF_I2CDATA0_TYPED(name, ...) UBX_MESSAGE_TYPED(name, 0x06, 0x88, ubx_cfg_senif_i2cdata0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-VALSET-DATA0 group0 (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t cfgData;                    // 0
+} ubx_cfg_valset_data0_group0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_valset_data0_group0_t, 1);
+
+// UBX-CFG-VALSET-DATA0 payload (4 + n*1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    union {
+        uint8_t layers;                 // 1
+        struct {
+            uint8_t ram : 1;                // bit 0
+            uint8_t bbr : 1;                // bit 1
+            uint8_t flash : 1;              // bit 2
+            uint8_t : 5;
+        };
+    };
+    uint8_t reserved0[2];               // 2
+    ubx_cfg_valset_data0_group0_t group0[];// 4: repeated
+} ubx_cfg_valset_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_valset_data0_t, 4);
+
+#define UBX_CFG_VALSET_DATA0(payload)           ((const ubx_cfg_valset_data0_t *)(payload))
+#define UBX_CFG_VALSET_DATA0_SIZE               4
+#define UBX_CFG_VALSET_DATA0_GROUP0(payload, i) ((const ubx_cfg_valset_data0_group0_t *)((const uint8_t *)(payload) + 4 + (size_t)(i) * 1))
+#define UBX_CFG_VALSET_DATA0_GROUP0_COUNT(payload, len)((size_t)(len) > 4 ? ((size_t)(len) - 4) / 1 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-VALSET-DATA1 group0 (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t cfgData;                    // 0
+} ubx_cfg_valset_data1_group0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_valset_data1_group0_t, 1);
+
+// UBX-CFG-VALSET-DATA1 payload (4 + n*1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    union {
+        uint8_t layers;                 // 1
+        struct {
+            uint8_t ram : 1;                // bit 0
+            uint8_t bbr : 1;                // bit 1
+            uint8_t flash : 1;              // bit 2
+            uint8_t : 5;
+        };
+    };
+    union {
+        uint8_t transaction;            // 2
+        struct {
+            uint8_t action : 2;             // bit 0..1
+            uint8_t : 6;
+        };
+    };
+    uint8_t reserved0;                  // 3
+    ubx_cfg_valset_data1_group0_t group0[];// 4: repeated
+} ubx_cfg_valset_data1_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_valset_data1_t, 4);
+
+#define UBX_CFG_VALSET_DATA1(payload)           ((const ubx_cfg_valset_data1_t *)(payload))
+#define UBX_CFG_VALSET_DATA1_SIZE               4
+#define UBX_CFG_VALSET_DATA1_GROUP0(payload, i) ((const ubx_cfg_valset_data1_group0_t *)((const uint8_t *)(payload) + 4 + (size_t)(i) * 1))
+#define UBX_CFG_VALSET_DATA1_GROUP0_COUNT(payload, len)((size_t)(len) > 4 ? ((size_t)(len) - 4) / 1 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-VALGET-POLLID group0 (4 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t keys;                      // 0
+} ubx_cfg_valget_pollid_group0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_valget_pollid_group0_t, 4);
+
+// UBX-CFG-VALGET-POLLID payload (4 + n*4 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t layer;                      // 1
+    uint16_t position;                  // 2
+    ubx_cfg_valget_pollid_group0_t group0[];// 4: repeated
+} ubx_cfg_valget_pollid_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_valget_pollid_t, 4);
+
+#define UBX_CFG_VALGET_POLLID(payload)          ((const ubx_cfg_valget_pollid_t *)(payload))
+#define UBX_CFG_VALGET_POLLID_SIZE              4
+#define UBX_CFG_VALGET_POLLID_GROUP0(payload, i)((const ubx_cfg_valget_pollid_group0_t *)((const uint8_t *)(payload) + 4 + (size_t)(i) * 4))
+#define UBX_CFG_VALGET_POLLID_GROUP0_COUNT(payload, len)((size_t)(len) > 4 ? ((size_t)(len) - 4) / 4 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-VALGET-DATA0 group0 (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t cfgData;                    // 0
+} ubx_cfg_valget_data0_group0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_valget_data0_group0_t, 1);
+
+// UBX-CFG-VALGET-DATA0 payload (4 + n*1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t layer;                      // 1
+    uint16_t position;                  // 2
+    ubx_cfg_valget_data0_group0_t group0[];// 4: repeated
+} ubx_cfg_valget_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_valget_data0_t, 4);
+
+#define UBX_CFG_VALGET_DATA0(payload)           ((const ubx_cfg_valget_data0_t *)(payload))
+#define UBX_CFG_VALGET_DATA0_SIZE               4
+#define UBX_CFG_VALGET_DATA0_GROUP0(payload, i) ((const ubx_cfg_valget_data0_group0_t *)((const uint8_t *)(payload) + 4 + (size_t)(i) * 1))
+#define UBX_CFG_VALGET_DATA0_GROUP0_COUNT(payload, len)((size_t)(len) > 4 ? ((size_t)(len) - 4) / 1 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-VALDEL-DATA0 group0 (4 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t keys;                      // 0
+} ubx_cfg_valdel_data0_group0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_valdel_data0_group0_t, 4);
+
+// UBX-CFG-VALDEL-DATA0 payload (4 + n*4 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    union {
+        uint8_t layers;                 // 1
+        struct {
+            uint8_t : 1;
+            uint8_t bbr : 1;                // bit 1
+            uint8_t flash : 1;              // bit 2
+            uint8_t : 5;
+        };
+    };
+    uint8_t reserved0[2];               // 2
+    ubx_cfg_valdel_data0_group0_t group0[];// 4: repeated
+} ubx_cfg_valdel_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_valdel_data0_t, 4);
+
+#define UBX_CFG_VALDEL_DATA0(payload)           ((const ubx_cfg_valdel_data0_t *)(payload))
+#define UBX_CFG_VALDEL_DATA0_SIZE               4
+#define UBX_CFG_VALDEL_DATA0_GROUP0(payload, i) ((const ubx_cfg_valdel_data0_group0_t *)((const uint8_t *)(payload) + 4 + (size_t)(i) * 4))
+#define UBX_CFG_VALDEL_DATA0_GROUP0_COUNT(payload, len)((size_t)(len) > 4 ? ((size_t)(len) - 4) / 4 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-VALDEL-DATA1 group0 (4 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t keys;                      // 0
+} ubx_cfg_valdel_data1_group0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_valdel_data1_group0_t, 4);
+
+// UBX-CFG-VALDEL-DATA1 payload (4 + n*4 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    union {
+        uint8_t layers;                 // 1
+        struct {
+            uint8_t : 1;
+            uint8_t bbr : 1;                // bit 1
+            uint8_t flash : 1;              // bit 2
+            uint8_t : 5;
+        };
+    };
+    union {
+        uint8_t transaction;            // 2
+        struct {
+            uint8_t action : 2;             // bit 0..1
+            uint8_t : 6;
+        };
+    };
+    uint8_t reserved0;                  // 3
+    ubx_cfg_valdel_data1_group0_t group0[];// 4: repeated
+} ubx_cfg_valdel_data1_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_valdel_data1_t, 4);
+
+#define UBX_CFG_VALDEL_DATA1(payload)           ((const ubx_cfg_valdel_data1_t *)(payload))
+#define UBX_CFG_VALDEL_DATA1_SIZE               4
+#define UBX_CFG_VALDEL_DATA1_GROUP0(payload, i) ((const ubx_cfg_valdel_data1_group0_t *)((const uint8_t *)(payload) + 4 + (size_t)(i) * 4))
+#define UBX_CFG_VALDEL_DATA1_GROUP0_COUNT(payload, len)((size_t)(len) > 4 ? ((size_t)(len) - 4) / 4 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-SLAS-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_slas_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_slas_poll0_t, 0);
+
+#define UBX_CFG_SLAS_POLL0(payload)             ((const ubx_cfg_slas_poll0_t *)(payload))
+#define UBX_CFG_SLAS_POLL0_SIZE                 0
+#define UBX_CFG_SLAS_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x06, 0x8D, ubx_cfg_slas_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-SLAS-DATA0 payload (4 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint8_t mode;                   // 0
+        struct {
+            uint8_t enabled : 1;            // bit 0
+            uint8_t test : 1;               // bit 1
+            uint8_t raim : 1;               // bit 2
+            uint8_t : 5;
+        };
+    };
+    uint8_t reserved0[3];               // 1
+} ubx_cfg_slas_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_slas_data0_t, 4);
+
+#define UBX_CFG_SLAS_DATA0(payload)             ((const ubx_cfg_slas_data0_t *)(payload))
+#define UBX_CFG_SLAS_DATA0_SIZE                 4
+#define UBX_CFG_SLAS_DATA0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x06, 0x8D, ubx_cfg_slas_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-BATCH-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_cfg_batch_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_batch_poll0_t, 0);
+
+#define UBX_CFG_BATCH_POLL0(payload)            ((const ubx_cfg_batch_poll0_t *)(payload))
+#define UBX_CFG_BATCH_POLL0_SIZE                0
+#define UBX_CFG_BATCH_POLL0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x06, 0x93, ubx_cfg_batch_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-CFG-BATCH-DATA0 payload (8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    union {
+        uint8_t flags;                  // 1
+        struct {
+            uint8_t enable : 1;             // bit 0
+            uint8_t : 1;
+            uint8_t extraPvt : 1;           // bit 2
+            uint8_t extraOdo : 1;           // bit 3
+            uint8_t : 1;
+            uint8_t pioEnable : 1;          // bit 5
+            uint8_t pioActiveLow : 1;       // bit 6
+            uint8_t : 1;
+        };
+    };
+    uint16_t bufSize;                   // 2
+    uint16_t notifThrs;                 // 4
+    uint8_t pioId;                      // 6
+    uint8_t reserved0;                  // 7
+} ubx_cfg_batch_data0_t;
+UBX_PAYLOAD_SIZE(ubx_cfg_batch_data0_t, 8);
+
+#define UBX_CFG_BATCH_DATA0(payload)            ((const ubx_cfg_batch_data0_t *)(payload))
+#define UBX_CFG_BATCH_DATA0_SIZE                8
+#define UBX_CFG_BATCH_DATA0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x06, 0x93, ubx_cfg_batch_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-UPD-SOS-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_upd_sos_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_upd_sos_poll0_t, 0);
+
+#define UBX_UPD_SOS_POLL0(payload)              ((const ubx_upd_sos_poll0_t *)(payload))
+#define UBX_UPD_SOS_POLL0_SIZE                  0
+#define UBX_UPD_SOS_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x09, 0x14, ubx_upd_sos_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-UPD-SOS-BACKUP payload (4 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t cmd;                        // 0
+    uint8_t reserved0[3];               // 1
+} ubx_upd_sos_backup_t;
+UBX_PAYLOAD_SIZE(ubx_upd_sos_backup_t, 4);
+
+#define UBX_UPD_SOS_BACKUP(payload)             ((const ubx_upd_sos_backup_t *)(payload))
+#define UBX_UPD_SOS_BACKUP_SIZE                 4
+#define UBX_UPD_SOS_BACKUP_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x09, 0x14, ubx_upd_sos_backup_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-UPD-SOS-CLEAR payload (4 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t cmd;                        // 0
+    uint8_t reserved0[3];               // 1
+} ubx_upd_sos_clear_t;
+UBX_PAYLOAD_SIZE(ubx_upd_sos_clear_t, 4);
+
+#define UBX_UPD_SOS_CLEAR(payload)              ((const ubx_upd_sos_clear_t *)(payload))
+#define UBX_UPD_SOS_CLEAR_SIZE                  4
+#define UBX_UPD_SOS_CLEAR_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x09, 0x14, ubx_upd_sos_clear_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-UPD-SOS-ACK payload (8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t cmd;                        // 0
+    uint8_t reserved0[3];               // 1
+    uint8_t response;                   // 4
+    uint8_t reserved1[3];               // 5
+} ubx_upd_sos_ack_t;
+UBX_PAYLOAD_SIZE(ubx_upd_sos_ack_t, 8);
+
+#define UBX_UPD_SOS_ACK(payload)                ((const ubx_upd_sos_ack_t *)(payload))
+#define UBX_UPD_SOS_ACK_SIZE                    8
+#define UBX_UPD_SOS_ACK_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x09, 0x14, ubx_upd_sos_ack_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-UPD-SOS-RESTORED payload (8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t cmd;                        // 0
+    uint8_t reserved0[3];               // 1
+    uint8_t response;                   // 4
+    uint8_t reserved1[3];               // 5
+} ubx_upd_sos_restored_t;
+UBX_PAYLOAD_SIZE(ubx_upd_sos_restored_t, 8);
+
+#define UBX_UPD_SOS_RESTORED(payload)           ((const ubx_upd_sos_restored_t *)(payload))
+#define UBX_UPD_SOS_RESTORED_SIZE               8
+#define UBX_UPD_SOS_RESTORED_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, 0x09, 0x14, ubx_upd_sos_restored_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-IO-DATA0 ports (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t rxBytes;                   // 0: bytes
+    uint32_t txBytes;                   // 4: bytes
+    uint16_t parityErrs;                // 8
+    uint16_t framingErrs;               // 10
+    uint16_t overrunErrs;               // 12
+    uint16_t breakCond;                 // 14
+    uint8_t reserved0[4];               // 16
+} ubx_mon_io_data0_ports_t;
+UBX_PAYLOAD_SIZE(ubx_mon_io_data0_ports_t, 20);
+
+// UBX-MON-IO-DATA0 payload (n*20 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_mon_io_data0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_io_data0_t, 0);
+
+#define UBX_MON_IO_DATA0(payload)               ((const ubx_mon_io_data0_t *)(payload))
+#define UBX_MON_IO_DATA0_SIZE                   0
+#define UBX_MON_IO_DATA0_PORTS(payload, i)      ((const ubx_mon_io_data0_ports_t *)((const uint8_t *)(payload) + 0 + (size_t)(i) * 20))
+#define UBX_MON_IO_DATA0_PORTS_COUNT(payload, len)((size_t)(len) > 0 ? ((size_t)(len) - 0) / 20 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-VER-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_mon_ver_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_ver_poll0_t, 0);
+
+#define UBX_MON_VER_POLL0(payload)              ((const ubx_mon_ver_poll0_t *)(payload))
+#define UBX_MON_VER_POLL0_SIZE                  0
+#define UBX_MON_VER_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x0A, 0x04, ubx_mon_ver_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-VER-DATA0 group1 (30 bytes)
+typedef struct __attribute__((packed)) {
+    char extension[30];                 // 0
+} ubx_mon_ver_data0_group1_t;
+UBX_PAYLOAD_SIZE(ubx_mon_ver_data0_group1_t, 30);
+
+// UBX-MON-VER-DATA0 payload (40 + n*30 bytes)
+typedef struct __attribute__((packed)) {
+    char swVersion[30];                 // 0
+    char hwVersion[10];                 // 30
+    ubx_mon_ver_data0_group1_t group1[];// 40: repeated
+} ubx_mon_ver_data0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_ver_data0_t, 40);
+
+#define UBX_MON_VER_DATA0(payload)              ((const ubx_mon_ver_data0_t *)(payload))
+#define UBX_MON_VER_DATA0_SIZE                  40
+#define UBX_MON_VER_DATA0_GROUP1(payload, i)    ((const ubx_mon_ver_data0_group1_t *)((const uint8_t *)(payload) + 40 + (size_t)(i) * 30))
+#define UBX_MON_VER_DATA0_GROUP1_COUNT(payload, len)((size_t)(len) > 40 ? ((size_t)(len) - 40) / 30 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-MSGPP-U5 payload (120 bytes)
+typedef struct __attribute__((packed)) {
+    uint16_t msg1[8];                   // 0: msgs
+    uint16_t msg2[8];                   // 16: msgs
+    uint16_t msg3[8];                   // 32: msgs
+    uint16_t msg4[8];                   // 48: msgs
+    uint16_t msg5[8];                   // 64: msgs
+    uint16_t msg6[8];                   // 80: msgs
+    uint32_t skipped[6];                // 96: bytes
+} ubx_mon_msgpp_u5_t;
+UBX_PAYLOAD_SIZE(ubx_mon_msgpp_u5_t, 120);
+
+#define UBX_MON_MSGPP_U5(payload)               ((const ubx_mon_msgpp_u5_t *)(payload))
+#define UBX_MON_MSGPP_U5_SIZE                   120
+#define UBX_MON_MSGPP_U5_TYPED(name, ...)       UBX_MESSAGE_TYPED(name, 0x0A, 0x06, ubx_mon_msgpp_u5_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-RXBUF-U5 payload (24 bytes)
+typedef struct __attribute__((packed)) {
+    uint16_t pending[6];                // 0: bytes
+    uint8_t usage[6];                   // 12: %
+    uint8_t peakUsage[6];               // 18: %
+} ubx_mon_rxbuf_u5_t;
+UBX_PAYLOAD_SIZE(ubx_mon_rxbuf_u5_t, 24);
+
+#define UBX_MON_RXBUF_U5(payload)               ((const ubx_mon_rxbuf_u5_t *)(payload))
+#define UBX_MON_RXBUF_U5_SIZE                   24
+#define UBX_MON_RXBUF_U5_TYPED(name, ...)       UBX_MESSAGE_TYPED(name, 0x0A, 0x07, ubx_mon_rxbuf_u5_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-TXBUF-U5 payload (28 bytes)
+typedef struct __attribute__((packed)) {
+    uint16_t pending[6];                // 0: bytes
+    uint8_t usage[6];                   // 12: %
+    uint8_t peakUsage[6];               // 18: %
+    uint8_t tUsage;                     // 24: %
+    uint8_t tPeakusage;                 // 25: %
+    union {
+        uint8_t errors;                 // 26
+        struct {
+            uint8_t limit : 6;              // bit 0..5
+            uint8_t mem : 1;                // bit 6
+            uint8_t alloc : 1;              // bit 7
+        };
+    };
+    uint8_t reserved0;                  // 27
+} ubx_mon_txbuf_u5_t;
+UBX_PAYLOAD_SIZE(ubx_mon_txbuf_u5_t, 28);
+
+#define UBX_MON_TXBUF_U5(payload)               ((const ubx_mon_txbuf_u5_t *)(payload))
+#define UBX_MON_TXBUF_U5_SIZE                   28
+#define UBX_MON_TXBUF_U5_TYPED(name, ...)       UBX_MESSAGE_TYPED(name, 0x0A, 0x08, ubx_mon_txbuf_u5_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-HW-U5-0 payload (68 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t pinSel;                    // 0
+    uint32_t pinBank;                   // 4
+    uint32_t pinDir;                    // 8
+    uint32_t pinVal;                    // 12
+    uint16_t noisePerMS;                // 16
+    uint16_t agcCnt;                    // 18
+    uint8_t aStatus;                    // 20
+    uint8_t aPower;                     // 21
+    union {
+        uint8_t flags;                  // 22
+        struct {
+            uint8_t rtcCalib : 1;           // bit 0
+            uint8_t : 7;
+        };
+    };
+    uint8_t reserved0;                  // 23
+    uint32_t usedMask;                  // 24
+    uint8_t VP[25];                     // 28
+    uint8_t reserved1[3];               // 53
+    uint32_t pinIrq;                    // 56
+    uint32_t pullH;                     // 60
+    uint32_t pullL;                     // 64
+} ubx_mon_hw_u5_0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_hw_u5_0_t, 68);
+
+#define UBX_MON_HW_U5_0(payload)                ((const ubx_mon_hw_u5_0_t *)(payload))
+#define UBX_MON_HW_U5_0_SIZE                    68
+#define UBX_MON_HW_U5_0_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x0A, 0x09, ubx_mon_hw_u5_0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-HW-U5-1 payload (68 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t pinSel;                    // 0
+    uint32_t pinBank;                   // 4
+    uint32_t pinDir;                    // 8
+    uint32_t pinVal;                    // 12
+    uint16_t noisePerMS;                // 16
+    uint16_t agcCnt;                    // 18
+    uint8_t aStatus;                    // 20
+    uint8_t aPower;                     // 21
+    union {
+        uint8_t flags;                  // 22
+        struct {
+            uint8_t rtcCalib : 1;           // bit 0
+            uint8_t safeBoot : 1;           // bit 1
+            uint8_t : 6;
+        };
+    };
+    uint8_t reserved0;                  // 23
+    uint32_t usedMask;                  // 24
+    uint8_t VP[25];                     // 28
+    uint8_t cwSuppression;              // 53
+    uint8_t reserved1[2];               // 54
+    uint32_t pinIrq;                    // 56
+    uint32_t pullH;                     // 60
+    uint32_t pullL;                     // 64
+} ubx_mon_hw_u5_1_t;
+UBX_PAYLOAD_SIZE(ubx_mon_hw_u5_1_t, 68);
+
+#define UBX_MON_HW_U5_1(payload)                ((const ubx_mon_hw_u5_1_t *)(payload))
+#define UBX_MON_HW_U5_1_SIZE                    68
+#define UBX_MON_HW_U5_1_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x0A, 0x09, ubx_mon_hw_u5_1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-HW-U6 payload (68 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t pinSel;                    // 0
+    uint32_t pinBank;                   // 4
+    uint32_t pinDir;                    // 8
+    uint32_t pinVal;                    // 12
+    uint16_t noisePerMS;                // 16
+    uint16_t agcCnt;                    // 18
+    uint8_t aStatus;                    // 20
+    uint8_t aPower;                     // 21
+    union {
+        uint8_t flags;                  // 22
+        struct {
+            uint8_t rtcCalib : 1;           // bit 0
+            uint8_t safeBoot : 1;           // bit 1
+            uint8_t jammingState : 2;       // bit 2..3
+            uint8_t : 4;
+        };
+    };
+    uint8_t reserved0;                  // 23
+    uint32_t usedMask;                  // 24
+    uint8_t VP[25];                     // 28
+    uint8_t cwSuppression;              // 53
+    uint8_t reserved1[2];               // 54
+    uint32_t pinIrq;                    // 56
+    uint32_t pullH;                     // 60
+    uint32_t pullL;                     // 64
+} ubx_mon_hw_u6_t;
+UBX_PAYLOAD_SIZE(ubx_mon_hw_u6_t, 68);
+
+#define UBX_MON_HW_U6(payload)                  ((const ubx_mon_hw_u6_t *)(payload))
+#define UBX_MON_HW_U6_SIZE                      68
+#define UBX_MON_HW_U6_TYPED(name, ...)          UBX_MESSAGE_TYPED(name, 0x0A, 0x09, ubx_mon_hw_u6_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-HW-TITLIS payload (60 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t pinSel;                    // 0
+    uint32_t pinBank;                   // 4
+    uint32_t pinDir;                    // 8
+    uint32_t pinVal;                    // 12
+    uint16_t noisePerMS;                // 16
+    uint16_t agcCnt;                    // 18
+    uint8_t aStatus;                    // 20
+    uint8_t aPower;                     // 21
+    union {
+        uint8_t flags;                  // 22
+        struct {
+            uint8_t rtcCalib : 1;           // bit 0
+            uint8_t safeBoot : 1;           // bit 1
+            uint8_t jammingState : 2;       // bit 2..3
+            uint8_t xtalAbsent : 1;         // bit 4
+            uint8_t : 3;
+        };
+    };
+    uint8_t reserved0;                  // 23
+    uint32_t usedMask;                  // 24
+    uint8_t VP[17];                     // 28
+    uint8_t cwSuppression;              // 45
+    uint8_t reserved1[2];               // 46
+    uint32_t pinIrq;                    // 48
+    uint32_t pullH;                     // 52
+    uint32_t pullL;                     // 56
+} ubx_mon_hw_titlis_t;
+UBX_PAYLOAD_SIZE(ubx_mon_hw_titlis_t, 60);
+
+#define UBX_MON_HW_TITLIS(payload)              ((const ubx_mon_hw_titlis_t *)(payload))
+#define UBX_MON_HW_TITLIS_SIZE                  60
+#define UBX_MON_HW_TITLIS_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x0A, 0x09, ubx_mon_hw_titlis_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-HW-U10 payload (56 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t reserved0[56];              // 0
+} ubx_mon_hw_u10_t;
+UBX_PAYLOAD_SIZE(ubx_mon_hw_u10_t, 56);
+
+#define UBX_MON_HW_U10(payload)                 ((const ubx_mon_hw_u10_t *)(payload))
+#define UBX_MON_HW_U10_SIZE                     56
+#define UBX_MON_HW_U10_TYPED(name, ...)         UBX_MESSAGE_TYPED(name, 0x0A, 0x09, ubx_mon_hw_u10_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-HW-U20 payload (76 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t reserved0[76];              // 0
+} ubx_mon_hw_u20_t;
+UBX_PAYLOAD_SIZE(ubx_mon_hw_u20_t, 76);
+
+#define UBX_MON_HW_U20(payload)                 ((const ubx_mon_hw_u20_t *)(payload))
+#define UBX_MON_HW_U20_SIZE                     76
+#define UBX_MON_HW_U20_TYPED(name, ...)         UBX_MESSAGE_TYPED(name, 0x0A, 0x09, ubx_mon_hw_u20_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-HW2-DATA0 payload (28 bytes)
+typedef struct __attribute__((packed)) {
+    int8_t ofsI;                        // 0
+    uint8_t magI;                       // 1
+    int8_t ofsQ;                        // 2
+    uint8_t magQ;                       // 3
+    uint8_t cfgSource;                  // 4
+    uint8_t reserved0[3];               // 5
+    uint32_t lowLevCfg;                 // 8
+    uint8_t reserved1[8];               // 12
+    uint32_t postStatus;                // 20
+    uint8_t reserved2[4];               // 24
+} ubx_mon_hw2_data0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_hw2_data0_t, 28);
+
+#define UBX_MON_HW2_DATA0(payload)              ((const ubx_mon_hw2_data0_t *)(payload))
+#define UBX_MON_HW2_DATA0_SIZE                  28
+#define UBX_MON_HW2_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x0A, 0x0B, ubx_mon_hw2_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-RXR-VER0 payload (1 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint8_t flags;                  // 0
+        struct {
+            uint8_t awake : 1;              // bit 0
+            uint8_t : 7;
+        };
+    };
+} ubx_mon_rxr_ver0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_rxr_ver0_t, 1);
+
+#define UBX_MON_RXR_VER0(payload)               ((const ubx_mon_rxr_ver0_t *)(payload))
+#define UBX_MON_RXR_VER0_SIZE                   1
+#define UBX_MON_RXR_VER0_TYPED(name, ...)       UBX_MESSAGE_TYPED(name, 0x0A, 0x21, ubx_mon_rxr_ver0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-PATCH-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_mon_patch_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_patch_poll0_t, 0);
+
+#define UBX_MON_PATCH_POLL0(payload)            ((const ubx_mon_patch_poll0_t *)(payload))
+#define UBX_MON_PATCH_POLL0_SIZE                0
+#define UBX_MON_PATCH_POLL0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x0A, 0x27, ubx_mon_patch_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-PATCH-DATA0 patchInformation (16 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint32_t patchInfo;             // 0
+        struct {
+            uint32_t activated : 1;         // bit 0
+            uint32_t location : 2;          // bit 1..2
+            uint32_t : 29;
+        };
+    };
+    uint32_t comparatorNumber;          // 4
+    uint32_t patchAddress;              // 8
+    uint32_t patchData;                 // 12
+} ubx_mon_patch_data0_patchinformation_t;
+UBX_PAYLOAD_SIZE(ubx_mon_patch_data0_patchinformation_t, 16);
+
+// UBX-MON-PATCH-DATA0 payload (4 + nEntries*16 bytes)
+typedef struct __attribute__((packed)) {
+    uint16_t version;                   // 0
+    uint16_t nEntries;                  // 2
+    ubx_mon_patch_data0_patchinformation_t patchInformation[];// 4: repeated
+} ubx_mon_patch_data0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_patch_data0_t, 4);
+
+#define UBX_MON_PATCH_DATA0(payload)            ((const ubx_mon_patch_data0_t *)(payload))
+#define UBX_MON_PATCH_DATA0_SIZE                4
+#define UBX_MON_PATCH_DATA0_PATCHINFORMATION(payload, i)((const ubx_mon_patch_data0_patchinformation_t *)((const uint8_t *)(payload) + 4 + (size_t)(i) * 16))
+#define UBX_MON_PATCH_DATA0_PATCHINFORMATION_COUNT(payload, len) \
+    ((size_t)(len) <= 4 ? 0 : (size_t)UBX_MON_PATCH_DATA0(payload)->nEntries < ((size_t)(len) - 4) / 16 ? (size_t)UBX_MON_PATCH_DATA0(payload)->nEntries : ((size_t)(len) - 4) / 16)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-GNSS-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_mon_gnss_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_gnss_poll0_t, 0);
+
+#define UBX_MON_GNSS_POLL0(payload)             ((const ubx_mon_gnss_poll0_t *)(payload))
+#define UBX_MON_GNSS_POLL0_SIZE                 0
+#define UBX_MON_GNSS_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x0A, 0x28, ubx_mon_gnss_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-GNSS-DATA0 payload (8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    union {
+        uint8_t supported;              // 1
+        struct {
+            uint8_t GPSSup : 1;             // bit 0
+            uint8_t GlonassSup : 1;         // bit 1
+            uint8_t BeidouSup : 1;          // bit 2
+            uint8_t GalileoSup : 1;         // bit 3
+            uint8_t : 4;
+        };
+    };
+    union {
+        uint8_t defaultGnss;            // 2
+        struct {
+            uint8_t GPSDef : 1;             // bit 0
+            uint8_t GlonassDef : 1;         // bit 1
+            uint8_t BeidouDef : 1;          // bit 2
+            uint8_t GalileoDef : 1;         // bit 3
+            uint8_t : 4;
+        };
+    };
+    union {
+        uint8_t enabled;                // 3
+        struct {
+            uint8_t GPSEna : 1;             // bit 0
+            uint8_t GlonassEna : 1;         // bit 1
+            uint8_t BeidouEna : 1;          // bit 2
+            uint8_t GalileoEna : 1;         // bit 3
+            uint8_t : 4;
+        };
+    };
+    uint8_t simultaneous;               // 4
+    uint8_t reserved0[3];               // 5
+} ubx_mon_gnss_data0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_gnss_data0_t, 8);
+
+#define UBX_MON_GNSS_DATA0(payload)             ((const ubx_mon_gnss_data0_t *)(payload))
+#define UBX_MON_GNSS_DATA0_SIZE                 8
+#define UBX_MON_GNSS_DATA0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x0A, 0x28, ubx_mon_gnss_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-GNSS-DATA1 plans (28 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t id;                         // 0
+    char name[5];                       // 1
+    union {
+        uint16_t gpsSup;                // 6
+        struct {
+            uint16_t gps_L1CA : 1;          // bit 0
+            uint16_t gps_L1C : 1;           // bit 1
+            uint16_t gps_L2C : 1;           // bit 2
+            uint16_t gps_L5 : 1;            // bit 3
+            uint16_t : 12;
+        };
+    };
+    union {
+        uint16_t galSup;                // 8
+        struct {
+            uint16_t gal_E1 : 1;            // bit 0
+            uint16_t gal_E5A : 1;           // bit 1
+            uint16_t gal_E5B : 1;           // bit 2
+            uint16_t gal_E6 : 1;            // bit 3
+            uint16_t : 12;
+        };
+    };
+    union {
+        uint16_t bdsSup;                // 10
+        struct {
+            uint16_t bds_B1I : 1;           // bit 0
+            uint16_t bds_B1C : 1;           // bit 1
+            uint16_t bds_B2I : 1;           // bit 2
+            uint16_t bds_B2A : 1;           // bit 3
+            uint16_t bds_B3I : 1;           // bit 4
+            uint16_t : 11;
+        };
+    };
+    union {
+        uint16_t gloSup;                // 12
+        struct {
+            uint16_t glo_L1OF : 1;          // bit 0
+            uint16_t glo_L2OF : 1;          // bit 1
+            uint16_t : 14;
+        };
+    };
+    union {
+        uint16_t sbasSup;               // 14
+        struct {
+            uint16_t sbas_L1CA : 1;         // bit 0
+            uint16_t : 15;
+        };
+    };
+    union {
+        uint16_t qzssSup;               // 16
+        struct {
+            uint16_t qzss_L1CA : 1;         // bit 0
+            uint16_t qzss_L1CB : 1;         // bit 1
+            uint16_t qzss_L1C : 1;          // bit 2
+            uint16_t qzss_L1S : 1;          // bit 3
+            uint16_t qzss_L2C : 1;          // bit 4
+            uint16_t qzss_L5 : 1;           // bit 5
+            uint16_t : 10;
+        };
+    };
+    union {
+        uint16_t navicSup;              // 18
+        struct {
+            uint16_t navic_L5 : 1;          // bit 0
+            uint16_t : 15;
+        };
+    };
+    union {
+        uint16_t lbandSup;              // 20
+        struct {
+            uint16_t lband_L1 : 1;          // bit 0
+            uint16_t : 15;
+        };
+    };
+    uint8_t reserved0[6];               // 22
+} ubx_mon_gnss_data1_plans_t;
+UBX_PAYLOAD_SIZE(ubx_mon_gnss_data1_plans_t, 28);
+
+// UBX-MON-GNSS-DATA1 payload (4 + numPlans*28 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t numPlans;                   // 1
+    union {
+        uint16_t activePlanInfo;        // 2
+        struct {
+            uint16_t planCfgId : 8;         // bit 0..7
+            uint16_t gnssCfgLevel : 3;      // bit 8..10
+            uint16_t : 5;
+        };
+    };
+    ubx_mon_gnss_data1_plans_t plans[]; // 4: repeated
+} ubx_mon_gnss_data1_t;
+UBX_PAYLOAD_SIZE(ubx_mon_gnss_data1_t, 4);
+
+#define UBX_MON_GNSS_DATA1(payload)             ((const ubx_mon_gnss_data1_t *)(payload))
+#define UBX_MON_GNSS_DATA1_SIZE                 4
+#define UBX_MON_GNSS_DATA1_PLANS(payload, i)    ((const ubx_mon_gnss_data1_plans_t *)((const uint8_t *)(payload) + 4 + (size_t)(i) * 28))
+#define UBX_MON_GNSS_DATA1_PLANS_COUNT(payload, len) \
+    ((size_t)(len) <= 4 ? 0 : (size_t)UBX_MON_GNSS_DATA1(payload)->numPlans < ((size_t)(len) - 4) / 28 ? (size_t)UBX_MON_GNSS_DATA1(payload)->numPlans : ((size_t)(len) - 4) / 28)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-SMGR-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_mon_smgr_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_smgr_poll0_t, 0);
+
+#define UBX_MON_SMGR_POLL0(payload)             ((const ubx_mon_smgr_poll0_t *)(payload))
+#define UBX_MON_SMGR_POLL0_SIZE                 0
+#define UBX_MON_SMGR_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x0A, 0x2E, ubx_mon_smgr_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-SMGR-DATA0 payload (16 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0[3];               // 1
+    uint32_t iTOW;                      // 4: ms
+    union {
+        uint16_t intOsc;                // 8
+        struct {
+            uint16_t intOscState : 4;       // bit 0..3
+            uint16_t intOscCalib : 1;       // bit 4
+            uint16_t intOscDisc : 1;        // bit 5
+            uint16_t : 10;
+        };
+    };
+    union {
+        uint16_t extOsc;                // 10
+        struct {
+            uint16_t extOscState : 4;       // bit 0..3
+            uint16_t extOscCalib : 1;       // bit 4
+            uint16_t extOscDisc : 1;        // bit 5
+            uint16_t : 10;
+        };
+    };
+    uint8_t discSrc;                    // 12
+    union {
+        uint8_t gnss;                   // 13
+        struct {
+            uint8_t gnssAvail : 1;          // bit 0
+            uint8_t : 7;
+        };
+    };
+    union {
+        uint8_t extInt0;                // 14
+        struct {
+            uint8_t extInt0Avail : 1;       // bit 0
+            uint8_t extInt0Type : 1;        // bit 1
+            uint8_t extInt0FeedBack : 1;    // bit 2
+            uint8_t : 5;
+        };
+    };
+    union {
+        uint8_t extInt1;                // 15
+        struct {
+            uint8_t extInt1Avail : 1;       // bit 0
+            uint8_t extInt1Type : 1;        // bit 1
+            uint8_t extInt1FeedBack : 1;    // bit 2
+            uint8_t : 5;
+        };
+    };
+} ubx_mon_smgr_data0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_smgr_data0_t, 16);
+
+#define UBX_MON_SMGR_DATA0(payload)             ((const ubx_mon_smgr_data0_t *)(payload))
+#define UBX_MON_SMGR_DATA0_SIZE                 16
+#define UBX_MON_SMGR_DATA0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x0A, 0x2E, ubx_mon_smgr_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-SPT-DATA1 senData (4 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t sensorId;                   // 0
+    union {
+        uint8_t drvVer;                 // 1
+        struct {
+            uint8_t drvVerMaj : 4;          // bit 0..3
+            uint8_t drvVerMin : 4;          // bit 4..7
+        };
+    };
+    uint8_t testState;                  // 2
+    uint8_t drvFileName;                // 3
+} ubx_mon_spt_data1_sendata_t;
+UBX_PAYLOAD_SIZE(ubx_mon_spt_data1_sendata_t, 4);
+
+// UBX-MON-SPT-DATA1 testResult (12 bytes)
+typedef struct __attribute__((packed)) {
+    uint16_t sensorIdRes;               // 0
+    uint16_t sensorType;                // 2
+    uint16_t resType;                   // 4
+    uint8_t reserved1[2];               // 6
+    int32_t value;                      // 8
+} ubx_mon_spt_data1_testresult_t;
+UBX_PAYLOAD_SIZE(ubx_mon_spt_data1_testresult_t, 12);
+
+// UBX-MON-SPT-DATA1 payload (4 + numSensor*4 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t numSensor;                  // 1
+    uint8_t numRes;                     // 2
+    uint8_t reserved0;                  // 3
+    ubx_mon_spt_data1_sendata_t senData[];// 4: repeated
+} ubx_mon_spt_data1_t;
+UBX_PAYLOAD_SIZE(ubx_mon_spt_data1_t, 4);
+
+#define UBX_MON_SPT_DATA1(payload)              ((const ubx_mon_spt_data1_t *)(payload))
+#define UBX_MON_SPT_DATA1_SIZE                  4
+#define UBX_MON_SPT_DATA1_SENDATA(payload, i)   ((const ubx_mon_spt_data1_sendata_t *)((const uint8_t *)(payload) + 4 + (size_t)(i) * 4))
+#define UBX_MON_SPT_DATA1_SENDATA_COUNT(payload, len) \
+    ((size_t)(len) <= 4 ? 0 : (size_t)UBX_MON_SPT_DATA1(payload)->numSensor < ((size_t)(len) - 4) / 4 ? (size_t)UBX_MON_SPT_DATA1(payload)->numSensor : ((size_t)(len) - 4) / 4)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-SPAN-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_mon_span_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_span_poll0_t, 0);
+
+#define UBX_MON_SPAN_POLL0(payload)             ((const ubx_mon_span_poll0_t *)(payload))
+#define UBX_MON_SPAN_POLL0_SIZE                 0
+#define UBX_MON_SPAN_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x0A, 0x31, ubx_mon_span_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-SPAN-DATA0 signal (272 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t spectrum[256];              // 0: dB, *2^-2
+    uint32_t span;                      // 256: Hz
+    uint32_t res;                       // 260: Hz
+    uint32_t center;                    // 264: Hz
+    uint8_t pga;                        // 268: dB
+    uint8_t reserved1[3];               // 269
+} ubx_mon_span_data0_signal_t;
+UBX_PAYLOAD_SIZE(ubx_mon_span_data0_signal_t, 272);
+
+// UBX-MON-SPAN-DATA0 payload (4 + numRfBlocks*272 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t numRfBlocks;                // 1
+    uint8_t reserved0[2];               // 2
+    ubx_mon_span_data0_signal_t signal[];// 4: repeated
+} ubx_mon_span_data0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_span_data0_t, 4);
+
+#define UBX_MON_SPAN_DATA0(payload)             ((const ubx_mon_span_data0_t *)(payload))
+#define UBX_MON_SPAN_DATA0_SIZE                 4
+#define UBX_MON_SPAN_DATA0_SIGNAL(payload, i)   ((const ubx_mon_span_data0_signal_t *)((const uint8_t *)(payload) + 4 + (size_t)(i) * 272))
+#define UBX_MON_SPAN_DATA0_SIGNAL_COUNT(payload, len) \
+    ((size_t)(len) <= 4 ? 0 : (size_t)UBX_MON_SPAN_DATA0(payload)->numRfBlocks < ((size_t)(len) - 4) / 272 ? (size_t)UBX_MON_SPAN_DATA0(payload)->numRfBlocks : ((size_t)(len) - 4) / 272)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-BATCH-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_mon_batch_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_batch_poll0_t, 0);
+
+#define UBX_MON_BATCH_POLL0(payload)            ((const ubx_mon_batch_poll0_t *)(payload))
+#define UBX_MON_BATCH_POLL0_SIZE                0
+#define UBX_MON_BATCH_POLL0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x0A, 0x32, ubx_mon_batch_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-BATCH-DATA0 payload (12 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0[3];               // 1
+    uint16_t fillLevel;                 // 4
+    uint16_t dropsAll;                  // 6
+    uint16_t dropsSinceMon;             // 8
+    uint16_t nextMsgCnt;                // 10
+} ubx_mon_batch_data0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_batch_data0_t, 12);
+
+#define UBX_MON_BATCH_DATA0(payload)            ((const ubx_mon_batch_data0_t *)(payload))
+#define UBX_MON_BATCH_DATA0_SIZE                12
+#define UBX_MON_BATCH_DATA0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x0A, 0x32, ubx_mon_batch_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-PMP-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_mon_pmp_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_pmp_poll0_t, 0);
+
+#define UBX_MON_PMP_POLL0(payload)              ((const ubx_mon_pmp_poll0_t *)(payload))
+#define UBX_MON_PMP_POLL0_SIZE                  0
+#define UBX_MON_PMP_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x0A, 0x35, ubx_mon_pmp_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-PMP-DATA0 info (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t reserved1[4];               // 0
+    union {
+        uint32_t status;                // 4
+        struct {
+            uint32_t locked : 1;            // bit 0
+            uint32_t frameSync : 1;         // bit 1
+            uint32_t : 30;
+        };
+    };
+    uint8_t reserved2[8];               // 8
+    uint8_t cno;                        // 16: dBHz
+    uint8_t cnoFrac;                    // 17: dBHz, *2^-8
+    uint8_t reserved3[2];               // 18
+} ubx_mon_pmp_data0_info_t;
+UBX_PAYLOAD_SIZE(ubx_mon_pmp_data0_info_t, 20);
+
+// UBX-MON-PMP-DATA0 payload (4 + nEntries*20 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t nEntries;                   // 1
+    uint8_t reserved0[2];               // 2
+    ubx_mon_pmp_data0_info_t info[];    // 4: repeated
+} ubx_mon_pmp_data0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_pmp_data0_t, 4);
+
+#define UBX_MON_PMP_DATA0(payload)              ((const ubx_mon_pmp_data0_t *)(payload))
+#define UBX_MON_PMP_DATA0_SIZE                  4
+#define UBX_MON_PMP_DATA0_INFO(payload, i)      ((const ubx_mon_pmp_data0_info_t *)((const uint8_t *)(payload) + 4 + (size_t)(i) * 20))
+#define UBX_MON_PMP_DATA0_INFO_COUNT(payload, len) \
+    ((size_t)(len) <= 4 ? 0 : (size_t)UBX_MON_PMP_DATA0(payload)->nEntries < ((size_t)(len) - 4) / 20 ? (size_t)UBX_MON_PMP_DATA0(payload)->nEntries : ((size_t)(len) - 4) / 20)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-COMMS-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_mon_comms_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_comms_poll0_t, 0);
+
+#define UBX_MON_COMMS_POLL0(payload)            ((const ubx_mon_comms_poll0_t *)(payload))
+#define UBX_MON_COMMS_POLL0_SIZE                0
+#define UBX_MON_COMMS_POLL0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x0A, 0x36, ubx_mon_comms_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-COMMS-DATA0 portInformation (40 bytes)
+typedef struct __attribute__((packed)) {
+    uint16_t portId;                    // 0
+    uint16_t txPending;                 // 2: bytes
+    uint32_t txBytes;                   // 4: bytes
+    uint8_t txUsage;                    // 8: %
+    uint8_t txPeakUsage;                // 9: %
+    uint16_t rxPending;                 // 10: bytes
+    uint32_t rxBytes;                   // 12: bytes
+    uint8_t rxUsage;                    // 16: %
+    uint8_t rxPeakUsage;                // 17: %
+    uint16_t overrunErrs;               // 18
+    uint16_t msgs[4];                   // 20: msg
+    uint8_t reserved1[8];               // 28
+    uint32_t skipped;                   // 36: bytes
+} ubx_mon_comms_data0_portinformation_t;
+UBX_PAYLOAD_SIZE(ubx_mon_comms_data0_portinformation_t, 40);
+
+// UBX-MON-COMMS-DATA0 payload (8 + nPorts*40 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t nPorts;                     // 1
+    union {
+        uint8_t txErrors;               // 2
+        struct {
+            uint8_t mem : 1;                // bit 0
+            uint8_t alloc : 1;              // bit 1
+            uint8_t outputPort : 3;         // bit 2..4
+            uint8_t : 3;
+        };
+    };
+    uint8_t reserved0;                  // 3
+    uint8_t protIds[4];                 // 4:  
+    ubx_mon_comms_data0_portinformation_t portInformation[];// 8: repeated
+} ubx_mon_comms_data0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_comms_data0_t, 8);
+
+#define UBX_MON_COMMS_DATA0(payload)            ((const ubx_mon_comms_data0_t *)(payload))
+#define UBX_MON_COMMS_DATA0_SIZE                8
+#define UBX_MON_COMMS_DATA0_PORTINFORMATION(payload, i)((const ubx_mon_comms_data0_portinformation_t *)((const uint8_t *)(payload) + 8 + (size_t)(i) * 40))
+#define UBX_MON_COMMS_DATA0_PORTINFORMATION_COUNT(payload, len) \
+    ((size_t)(len) <= 8 ? 0 : (size_t)UBX_MON_COMMS_DATA0(payload)->nPorts < ((size_t)(len) - 8) / 40 ? (size_t)UBX_MON_COMMS_DATA0(payload)->nPorts : ((size_t)(len) - 8) / 40)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-HW3-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_mon_hw3_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_hw3_poll0_t, 0);
+
+#define UBX_MON_HW3_POLL0(payload)              ((const ubx_mon_hw3_poll0_t *)(payload))
+#define UBX_MON_HW3_POLL0_SIZE                  0
+#define UBX_MON_HW3_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x0A, 0x37, ubx_mon_hw3_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-HW3-DATA0 pinInformation (6 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t reserved1;                  // 0
+    uint8_t pinId;                      // 1
+    union {
+        uint16_t pinMask;               // 2
+        struct {
+            uint16_t periphPIO : 1;         // bit 0
+            uint16_t pinBank : 3;           // bit 1..3
+            uint16_t direction : 1;         // bit 4
+            uint16_t value : 1;             // bit 5
+            uint16_t vpManager : 1;         // bit 6
+            uint16_t pioIrq : 1;            // bit 7
+            uint16_t pioPullHigh : 1;       // bit 8
+            uint16_t pioPullLow : 1;        // bit 9
+            uint16_t : 6;
+        };
+    };
+    uint8_t VP;                         // 4
+    uint8_t reserved2;                  // 5
+} ubx_mon_hw3_data0_pininformation_t;
+UBX_PAYLOAD_SIZE(ubx_mon_hw3_data0_pininformation_t, 6);
+
+// UBX-MON-HW3-DATA0 payload (22 + nPins*6 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t nPins;                      // 1
+    union {
+        uint8_t flags;                  // 2
+        struct {
+            uint8_t rtcCalib : 1;           // bit 0
+            uint8_t safeBoot : 1;           // bit 1
+            uint8_t xtalAbsent : 1;         // bit 2
+            uint8_t : 5;
+        };
+    };
+    char hwVersion[10];                 // 3
+    uint8_t reserved0[9];               // 13
+    ubx_mon_hw3_data0_pininformation_t pinInformation[];// 22: repeated
+} ubx_mon_hw3_data0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_hw3_data0_t, 22);
+
+#define UBX_MON_HW3_DATA0(payload)              ((const ubx_mon_hw3_data0_t *)(payload))
+#define UBX_MON_HW3_DATA0_SIZE                  22
+#define UBX_MON_HW3_DATA0_PININFORMATION(payload, i)((const ubx_mon_hw3_data0_pininformation_t *)((const uint8_t *)(payload) + 22 + (size_t)(i) * 6))
+#define UBX_MON_HW3_DATA0_PININFORMATION_COUNT(payload, len) \
+    ((size_t)(len) <= 22 ? 0 : (size_t)UBX_MON_HW3_DATA0(payload)->nPins < ((size_t)(len) - 22) / 6 ? (size_t)UBX_MON_HW3_DATA0(payload)->nPins : ((size_t)(len) - 22) / 6)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-RF-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_mon_rf_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_rf_poll0_t, 0);
+
+#define UBX_MON_RF_POLL0(payload)               ((const ubx_mon_rf_poll0_t *)(payload))
+#define UBX_MON_RF_POLL0_SIZE                   0
+#define UBX_MON_RF_POLL0_TYPED(name, ...)       UBX_MESSAGE_TYPED(name, 0x0A, 0x38, ubx_mon_rf_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-RF-DATA0 hwInformation (24 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t blockId;                    // 0
+    union {
+        uint8_t flags;                  // 1
+        struct {
+            uint8_t jammingState : 2;       // bit 0..1
+            uint8_t : 6;
+        };
+    };
+    uint8_t antStatus;                  // 2
+    uint8_t antPower;                   // 3
+    uint32_t postStatus;                // 4
+    uint8_t reserved1[4];               // 8
+    uint16_t noisePerMS;                // 12
+    uint16_t agcCnt;                    // 14
+    uint8_t cwSuppression;              // 16
+    int8_t ofsI;                        // 17
+    uint8_t magI;                       // 18
+    int8_t ofsQ;                        // 19
+    uint8_t magQ;                       // 20
+    uint8_t rfBlockGnssBand;            // 21
+    uint8_t reserved2[2];               // 22
+} ubx_mon_rf_data0_hwinformation_t;
+UBX_PAYLOAD_SIZE(ubx_mon_rf_data0_hwinformation_t, 24);
+
+// UBX-MON-RF-DATA0 payload (4 + nBlocks*24 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t nBlocks;                    // 1
+    uint8_t reserved0[2];               // 2
+    ubx_mon_rf_data0_hwinformation_t hwInformation[];// 4: repeated
+} ubx_mon_rf_data0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_rf_data0_t, 4);
+
+#define UBX_MON_RF_DATA0(payload)               ((const ubx_mon_rf_data0_t *)(payload))
+#define UBX_MON_RF_DATA0_SIZE                   4
+#define UBX_MON_RF_DATA0_HWINFORMATION(payload, i)((const ubx_mon_rf_data0_hwinformation_t *)((const uint8_t *)(payload) + 4 + (size_t)(i) * 24))
+#define UBX_MON_RF_DATA0_HWINFORMATION_COUNT(payload, len) \
+    ((size_t)(len) <= 4 ? 0 : (size_t)UBX_MON_RF_DATA0(payload)->nBlocks < ((size_t)(len) - 4) / 24 ? (size_t)UBX_MON_RF_DATA0(payload)->nBlocks : ((size_t)(len) - 4) / 24)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-RF-DATA1 hwInformation (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t blockId;                    // 0
+    uint8_t antStatus;                  // 1
+    uint8_t antPower;                   // 2
+    uint8_t cwSuppression;              // 3
+    uint32_t postStatus;                // 4
+    uint8_t reserved1[4];               // 8
+    uint16_t noisePerMS;                // 12
+    uint16_t agcCnt;                    // 14
+    int8_t ofsI;                        // 16
+    uint8_t magI;                       // 17
+    int8_t ofsQ;                        // 18
+    uint8_t magQ;                       // 19
+} ubx_mon_rf_data1_hwinformation_t;
+UBX_PAYLOAD_SIZE(ubx_mon_rf_data1_hwinformation_t, 20);
+
+// UBX-MON-RF-DATA1 payload (4 + nBlocks*20 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t nBlocks;                    // 1
+    uint8_t reserved0[2];               // 2
+    ubx_mon_rf_data1_hwinformation_t hwInformation[];// 4: repeated
+} ubx_mon_rf_data1_t;
+UBX_PAYLOAD_SIZE(ubx_mon_rf_data1_t, 4);
+
+#define UBX_MON_RF_DATA1(payload)               ((const ubx_mon_rf_data1_t *)(payload))
+#define UBX_MON_RF_DATA1_SIZE                   4
+#define UBX_MON_RF_DATA1_HWINFORMATION(payload, i)((const ubx_mon_rf_data1_hwinformation_t *)((const uint8_t *)(payload) + 4 + (size_t)(i) * 20))
+#define UBX_MON_RF_DATA1_HWINFORMATION_COUNT(payload, len) \
+    ((size_t)(len) <= 4 ? 0 : (size_t)UBX_MON_RF_DATA1(payload)->nBlocks < ((size_t)(len) - 4) / 20 ? (size_t)UBX_MON_RF_DATA1(payload)->nBlocks : ((size_t)(len) - 4) / 20)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-SYS-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_mon_sys_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_sys_poll0_t, 0);
+
+#define UBX_MON_SYS_POLL0(payload)              ((const ubx_mon_sys_poll0_t *)(payload))
+#define UBX_MON_SYS_POLL0_SIZE                  0
+#define UBX_MON_SYS_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x0A, 0x39, ubx_mon_sys_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-SYS-DATA0 payload (24 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t msgVer;                     // 0
+    uint8_t bootType;                   // 1
+    uint8_t cpuLoad;                    // 2
+    uint8_t cpuLoadMax;                 // 3
+    uint8_t memUsage;                   // 4
+    uint8_t memUsageMax;                // 5
+    uint8_t ioUsage;                    // 6
+    uint8_t ioUsageMax;                 // 7
+    uint32_t runTime;                   // 8: sec
+    uint16_t noticeCount;               // 12
+    uint16_t warnCount;                 // 14
+    uint16_t errorCount;                // 16
+    int8_t tempValue;                   // 18
+    uint8_t reserved0[5];               // 19
+} ubx_mon_sys_data0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_sys_data0_t, 24);
+
+#define UBX_MON_SYS_DATA0(payload)              ((const ubx_mon_sys_data0_t *)(payload))
+#define UBX_MON_SYS_DATA0_SIZE                  24
+#define UBX_MON_SYS_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x0A, 0x39, ubx_mon_sys_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-POST-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_mon_post_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_post_poll0_t, 0);
+
+#define UBX_MON_POST_POLL0(payload)             ((const ubx_mon_post_poll0_t *)(payload))
+#define UBX_MON_POST_POLL0_SIZE                 0
+#define UBX_MON_POST_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x0A, 0x3B, ubx_mon_post_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-POST-DATA0 payload (12 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    union {
+        uint8_t flags;                  // 1
+        struct {
+            uint8_t safeBoot : 1;           // bit 0
+            uint8_t : 7;
+        };
+    };
+    uint8_t reserved0[2];               // 2
+    uint32_t postStatus;                // 4
+    uint8_t reserved1[4];               // 8
+} ubx_mon_post_data0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_post_data0_t, 12);
+
+#define UBX_MON_POST_DATA0(payload)             ((const ubx_mon_post_data0_t *)(payload))
+#define UBX_MON_POST_DATA0_SIZE                 12
+#define UBX_MON_POST_DATA0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x0A, 0x3B, ubx_mon_post_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-INST-DATA0 payload (12 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t rxTtag;                    // 0: ms
+    uint8_t version;                    // 4
+    uint8_t countEpoch;                 // 5
+    uint8_t usedSVs;                    // 6
+    uint8_t maxCNO;                     // 7
+    uint16_t pDOP;                      // 8: *0.01
+    union {
+        uint8_t gnssFixStatus;          // 10
+        struct {
+            uint8_t fixType : 3;            // bit 0..2
+            uint8_t fixOkFlag : 1;          // bit 3
+            uint8_t : 4;
+        };
+    };
+    union {
+        uint8_t statusFlags;            // 11
+        struct {
+            uint8_t statusfixNOK : 1;       // bit 0
+            uint8_t statusfixType : 1;      // bit 1
+            uint8_t statusUsedSVs : 1;      // bit 2
+            uint8_t statusCNO : 1;          // bit 3
+            uint8_t statusPDOP : 1;         // bit 4
+            uint8_t installStatus1 : 1;     // bit 5
+            uint8_t installStatus2 : 1;     // bit 6
+            uint8_t : 1;
+        };
+    };
+} ubx_mon_inst_data0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_inst_data0_t, 12);
+
+#define UBX_MON_INST_DATA0(payload)             ((const ubx_mon_inst_data0_t *)(payload))
+#define UBX_MON_INST_DATA0_SIZE                 12
+#define UBX_MON_INST_DATA0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x0A, 0x3D, ubx_mon_inst_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-RCVRSTAT-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_mon_rcvrstat_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_rcvrstat_poll0_t, 0);
+
+#define UBX_MON_RCVRSTAT_POLL0(payload)         ((const ubx_mon_rcvrstat_poll0_t *)(payload))
+#define UBX_MON_RCVRSTAT_POLL0_SIZE             0
+#define UBX_MON_RCVRSTAT_POLL0_TYPED(name, ...) UBX_MESSAGE_TYPED(name, 0x0A, 0x40, ubx_mon_rcvrstat_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MON-RCVRSTAT-DATA0 payload (1 + 21 + 2 + 4 + 4 + 4 + 8 + 4 + 4 + 2 + 18 + 8 + 4 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    union {
+        uint8_t sbas;                   // 1
+        struct {
+            uint8_t sig_sbas_en_val : 1;    // bit 0
+            uint8_t sig_sbas_en_src : 3;    // bit 1..3
+            uint8_t sig_sbasL1ca_en_val : 1;// bit 4
+            uint8_t sig_sbasL1ca_en_src : 3;// bit 5..7
+        };
+    };
+    union {
+        uint8_t navic;                  // 2
+        struct {
+            uint8_t sig_navic_en_val : 1;   // bit 0
+            uint8_t sig_navic_en_src : 3;   // bit 1..3
+            uint8_t sig_navicL5_en_val : 1; // bit 4
+            uint8_t sig_navicL5_en_src : 3; // bit 5..7
+        };
+    };
+    uint8_t reserved0;                  // 3
+    union {
+        uint32_t gps;                   // 4
+        struct {
+            uint32_t sig_gps_en_val : 1;    // bit 0
+            uint32_t sig_gps_en_src : 3;    // bit 1..3
+            uint32_t sig_gpsL1ca_en_val : 1;// bit 4
+            uint32_t sig_gpsL1ca_en_src : 3;// bit 5..7
+            uint32_t sig_gpsL1c_en_val : 1; // bit 8
+            uint32_t sig_gpsL1c_en_src : 3; // bit 9..11
+            uint32_t sig_gpsL2c_en_val : 1; // bit 12
+            uint32_t sig_gpsL2c_en_src : 3; // bit 13..15
+            uint32_t sig_gpsL5_en_val : 1;  // bit 16
+            uint32_t sig_gpsL5_en_src : 3;  // bit 17..19
+            uint32_t : 12;
+        };
+    };
+    union {
+        uint32_t gal;                   // 8
+        struct {
+            uint32_t sig_gal_en_val : 1;    // bit 0
+            uint32_t sig_gal_en_src : 3;    // bit 1..3
+            uint32_t sig_galE1_en_val : 1;  // bit 4
+            uint32_t sig_galE1_en_src : 3;  // bit 5..7
+            uint32_t sig_galE5a_en_val : 1; // bit 8
+            uint32_t sig_galE5a_en_src : 3; // bit 9..11
+            uint32_t sig_galE5b_en_val : 1; // bit 12
+            uint32_t sig_galE5b_en_src : 3; // bit 13..15
+            uint32_t sig_galE6_en_val : 1;  // bit 16
+            uint32_t sig_galE6_en_src : 3;  // bit 17..19
+            uint32_t : 12;
+        };
+    };
+    union {
+        uint32_t qzss;                  // 12
+        struct {
+            uint32_t sig_qzss_en_val : 1;   // bit 0
+            uint32_t sig_qzss_en_src : 3;   // bit 1..3
+            uint32_t sig_qzssL1ca_en_val : 1;// bit 4
+            uint32_t sig_qzssL1ca_src : 3;  // bit 5..7
+            uint32_t sig_qzssL1c_en_val : 1;// bit 8
+            uint32_t sig_qzssL1c_src : 3;   // bit 9..11
+            uint32_t sig_qzssL1s_en_val : 1;// bit 12
+            uint32_t sig_qzssL1s_src : 3;   // bit 13..15
+            uint32_t sig_qzssL2c_en_val : 1;// bit 16
+            uint32_t sig_qzssL2c_src : 3;   // bit 17..19
+            uint32_t sig_qzssL5_en_val : 1; // bit 20
+            uint32_t sig_qzssL5_src : 3;    // bit 21..23
+            uint32_t : 8;
+        };
+    };
+    union {
+        uint32_t bds;                   // 16
+        struct {
+            uint32_t sig_bds_en_val : 1;    // bit 0
+            uint32_t sig_bds_en_src : 3;    // bit 1..3
+            uint32_t sig_bdsB1i_en_val : 1; // bit 4
+            uint32_t sig_bdsB1i_src : 3;    // bit 5..7
+            uint32_t sig_bdsB1c_en_val : 1; // bit 8
+            uint32_t sig_bdsB1c_src : 3;    // bit 9..11
+            uint32_t sig_bdsB2_en_val : 1;  // bit 12
+            uint32_t sig_bdsB2_src : 3;     // bit 13..15
+            uint32_t sig_bdsB2a_en_val : 1; // bit 16
+            uint32_t sig_bdsB2a_src : 3;    // bit 17..19
+            uint32_t : 12;
+        };
+    };
+    union {
+        uint16_t glo;                   // 20
+        struct {
+            uint16_t sig_glo_en_val : 1;    // bit 0
+            uint16_t sig_glo_en_src : 3;    // bit 1..3
+            uint16_t sig_gloL1_en_val : 1;  // bit 4
+            uint16_t sig_gloL1_src : 3;     // bit 5..7
+            uint16_t sig_gloL2_en_val : 1;  // bit 8
+            uint16_t sig_gloL2_src : 3;     // bit 9..11
+            uint16_t sig_gloL3_en_val : 1;  // bit 12
+            uint16_t sig_gloL3_src : 3;     // bit 13..15
+        };
+    };
+    union {
+        uint16_t lnaMode;               // 22
+        struct {
+            uint16_t lna_lnaMode_reg_val : 4;// bit 0..3
+            uint16_t lna_lnaMode_cfg_val : 4;// bit 4..7
+            uint16_t : 5;
+            uint16_t lna_lnaMode_src : 3;   // bit 13..15
+        };
+    };
+    uint8_t reserved1[4];               // 24
+    uint8_t reserved2[4];               // 28
+    uint8_t reserved3[4];               // 32
+    union {
+        uint32_t uartBitfield;          // 36
+        struct {
+            uint32_t uart_enable_val : 1;   // bit 0
+            uint32_t uart_enable_src : 3;   // bit 1..3
+            uint32_t uart_remaped_val : 1;  // bit 4
+            uint32_t uart_remaped_src : 3;  // bit 5..7
+            uint32_t uart_dataBits_val : 1; // bit 8
+            uint32_t uart_dataBits_src : 3; // bit 9..11
+            uint32_t uart_stopBits_val : 2; // bit 12..13
+            uint32_t uart_stopBits_src : 3; // bit 14..16
+            uint32_t uart_parityBits_val : 2;// bit 17..18
+            uint32_t uart_parityBits_src : 3;// bit 19..21
+            uint32_t : 10;
+        };
+    };
+    union {
+        uint32_t uartBaudrate;          // 40
+        struct {
+            uint32_t uart_baudrate_val : 20;// bit 0..19
+            uint32_t uart_baudrate_src : 3; // bit 20..22
+            uint32_t : 9;
+        };
+    };
+    union {
+        uint32_t spiBitfield;           // 44
+        struct {
+            uint32_t spi_enable_val : 1;    // bit 0
+            uint32_t spi_enable_src : 3;    // bit 1..3
+            uint32_t spi_extendedTimeout_val : 1;// bit 4
+            uint32_t spi_extendedTimeout_src : 3;// bit 5..7
+            uint32_t spi_CPolarity_val : 1; // bit 8
+            uint32_t spi_CPolarity_src : 3; // bit 9..11
+            uint32_t spi_CPhase_val : 1;    // bit 12
+            uint32_t spi_CPhase_src : 3;    // bit 13..15
+            uint32_t spi_maxFf_val : 8;     // bit 16..23
+            uint32_t spi_maxFf_src : 3;     // bit 24..26
+            uint32_t : 5;
+        };
+    };
+    union {
+        uint32_t i2cBitfield;           // 48
+        struct {
+            uint32_t i2c_enable_val : 1;    // bit 0
+            uint32_t i2c_enable_src : 3;    // bit 1..3
+            uint32_t i2c_extendedTimeout_val : 1;// bit 4
+            uint32_t i2c_extendedTimeout_src : 3;// bit 5..7
+            uint32_t i2c_remap_val : 1;     // bit 8
+            uint32_t i2c_remap_src : 3;     // bit 9..11
+            uint32_t i2c_address_val : 8;   // bit 12..19
+            uint32_t i2c_address_src : 3;   // bit 20..22
+            uint32_t : 9;
+        };
+    };
+    uint8_t reserved4;                  // 52
+    union {
+        uint8_t operatemode;            // 53
+        struct {
+            uint8_t psm_operateMode_val : 2;// bit 0..1
+            uint8_t psm_operateMode_src : 3;// bit 2..4
+            uint8_t psm_operateMode_state : 2;// bit 5..6
+            uint8_t : 1;
+        };
+    };
+    union {
+        uint8_t status;                 // 54
+        struct {
+            uint8_t antSup_smStatus_val : 2;// bit 0..1
+            uint8_t antSup_aPower_val : 2;  // bit 2..3
+            uint8_t : 4;
+        };
+    };
+    union {
+        uint8_t switchPin;              // 55
+        struct {
+            uint8_t antSup_switchPi_val : 5;// bit 0..4
+            uint8_t antSup_switchPin_src : 3;// bit 5..7
+        };
+    };
+    union {
+        uint8_t shortPin;               // 56
+        struct {
+            uint8_t antSup_shortPin_val : 5;// bit 0..4
+            uint8_t antSup_shortPin_src : 3;// bit 5..7
+        };
+    };
+    union {
+        uint8_t openPin;                // 57
+        struct {
+            uint8_t antSup_openPin_val : 5; // bit 0..4
+            uint8_t antSup_openPin_src : 3; // bit 5..7
+        };
+    };
+    uint8_t reserved5[4];               // 58
+    union {
+        uint16_t recInt;                // 62
+        struct {
+            uint16_t antSup_recInt_val : 8; // bit 0..7
+            uint16_t : 5;
+            uint16_t antSup_recInt_src : 3; // bit 13..15
+        };
+    };
+    union {
+        uint32_t antSupBitfield;        // 64
+        struct {
+            uint32_t antSup_voltctrl_val : 1;// bit 0
+            uint32_t antSup_voltctrl_src : 3;// bit 1..3
+            uint32_t antSup_shortDet_val : 1;// bit 4
+            uint32_t antSup_shortDet_src : 3;// bit 5..7
+            uint32_t antSup_shortDet_pol_val : 1;// bit 8
+            uint32_t antSup_shortDet_pol_src : 3;// bit 9..11
+            uint32_t antSup_openDet_val : 1;// bit 12
+            uint32_t antSup_openDet_src : 3;// bit 13..15
+            uint32_t antSup_openDet_pol_val : 1;// bit 16
+            uint32_t antSup_openDet_pol_src : 3;// bit 17..19
+            uint32_t antSup_pwrDown_val : 1;// bit 20
+            uint32_t antSup_pwrDown_src : 3;// bit 21..23
+            uint32_t antSup_pwrDown_pol_val : 1;// bit 24
+            uint32_t antSup_pwrDown_pol_src : 3;// bit 25..27
+            uint32_t antSup_recover_val : 1;// bit 28
+            uint32_t antSup_recover_src : 3;// bit 29..31
+        };
+    };
+    union {
+        uint32_t shortUs;               // 68
+        struct {
+            uint32_t antSup_shortUs_val : 16;// bit 0..15
+            uint32_t : 13;
+            uint32_t antSup_shortUs_src : 3;// bit 29..31
+        };
+    };
+    uint8_t reserved6[4];               // 72
+    uint8_t reserved7[2];               // 76
+    uint8_t reserved8[2];               // 78
+    uint8_t reserved9[4];               // 80
+} ubx_mon_rcvrstat_data0_t;
+UBX_PAYLOAD_SIZE(ubx_mon_rcvrstat_data0_t, 84);
+
+#define UBX_MON_RCVRSTAT_DATA0(payload)         ((const ubx_mon_rcvrstat_data0_t *)(payload))
+#define UBX_MON_RCVRSTAT_DATA0_SIZE             84
+#define UBX_MON_RCVRSTAT_DATA0_TYPED(name, ...) UBX_MESSAGE_TYPED(name, 0x0A, 0x40, ubx_mon_rcvrstat_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-REQ-0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_aid_req_0_t;
+UBX_PAYLOAD_SIZE(ubx_aid_req_0_t, 0);
+
+#define UBX_AID_REQ_0(payload)                  ((const ubx_aid_req_0_t *)(payload))
+#define UBX_AID_REQ_0_SIZE                      0
+#define UBX_AID_REQ_0_TYPED(name, ...)          UBX_MESSAGE_TYPED(name, 0x0B, 0x00, ubx_aid_req_0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-INI-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_aid_ini_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_aid_ini_poll0_t, 0);
+
+#define UBX_AID_INI_POLL0(payload)              ((const ubx_aid_ini_poll0_t *)(payload))
+#define UBX_AID_INI_POLL0_SIZE                  0
+#define UBX_AID_INI_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x0B, 0x01, ubx_aid_ini_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-INI-U5 payload (48 bytes)
+typedef struct __attribute__((packed)) {
+    int32_t ecefXOrLat;                 // 0: cm_or_deg*1e-7
+    int32_t ecefYOrLon;                 // 4: cm_or_deg*1e-7
+    int32_t ecefZOrAlt;                 // 8: cm
+    uint32_t posAcc;                    // 12: cm
+    union {
+        uint16_t tmCfg;                 // 16
+        struct {
+            uint16_t : 1;
+            uint16_t fEdge : 1;             // bit 1
+            uint16_t : 2;
+            uint16_t tm1 : 1;               // bit 4
+            uint16_t : 1;
+            uint16_t f1 : 1;                // bit 6
+            uint16_t : 9;
+        };
+    };
+    uint16_t wn;                        // 18
+    uint32_t tow;                       // 20: ms
+    int32_t towNs;                      // 24: ns
+    uint32_t tAccMs;                    // 28: ms
+    uint32_t tAccNs;                    // 32: ns
+    int32_t clkDOrFreq;                 // 36: ns/s_or_Hz*1e-2
+    uint32_t clkDAccOrFreqAcc;          // 40: ns/s_or_ppb
+    union {
+        uint32_t flags;                 // 44
+        struct {
+            uint32_t pos : 1;               // bit 0
+            uint32_t time : 1;              // bit 1
+            uint32_t clockD : 1;            // bit 2
+            uint32_t tp : 1;                // bit 3
+            uint32_t clockF : 1;            // bit 4
+            uint32_t lla : 1;               // bit 5
+            uint32_t altInv : 1;            // bit 6
+            uint32_t prevTm : 1;            // bit 7
+            uint32_t : 24;
+        };
+    };
+} ubx_aid_ini_u5_t;
+UBX_PAYLOAD_SIZE(ubx_aid_ini_u5_t, 48);
+
+#define UBX_AID_INI_U5(payload)                 ((const ubx_aid_ini_u5_t *)(payload))
+#define UBX_AID_INI_U5_SIZE                     48
+#define UBX_AID_INI_U5_TYPED(name, ...)         UBX_MESSAGE_TYPED(name, 0x0B, 0x01, ubx_aid_ini_u5_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-INI-U6 payload (48 bytes)
+typedef struct __attribute__((packed)) {
+    int32_t ecefXOrLat;                 // 0: cm_or_deg*1e-7
+    int32_t ecefYOrLon;                 // 4: cm_or_deg*1e-7
+    int32_t ecefZOrAlt;                 // 8: cm
+    uint32_t posAcc;                    // 12: cm
+    union {
+        uint16_t tmCfg;                 // 16
+        struct {
+            uint16_t : 1;
+            uint16_t fEdge : 1;             // bit 1
+            uint16_t : 2;
+            uint16_t tm1 : 1;               // bit 4
+            uint16_t : 1;
+            uint16_t f1 : 1;                // bit 6
+            uint16_t : 9;
+        };
+    };
+    uint16_t wnoOrDate;                 // 18: week_or_yearMonth
+    uint32_t towOrTime;                 // 20: ms_or_dayHourMinuteSec
+    int32_t towNs;                      // 24: ns
+    uint32_t tAccMs;                    // 28: ms
+    uint32_t tAccNs;                    // 32: ns
+    int32_t clkDOrFreq;                 // 36: ns/s_or_Hz*1e-2
+    uint32_t clkDAccOrFreqAcc;          // 40: ns/s_or_ppb
+    union {
+        uint32_t flags;                 // 44
+        struct {
+            uint32_t pos : 1;               // bit 0
+            uint32_t time : 1;              // bit 1
+            uint32_t clockD : 1;            // bit 2
+            uint32_t tp : 1;                // bit 3
+            uint32_t clockF : 1;            // bit 4
+            uint32_t lla : 1;               // bit 5
+            uint32_t altInv : 1;            // bit 6
+            uint32_t prevTm : 1;            // bit 7
+            uint32_t : 2;
+            uint32_t utc : 1;               // bit 10
+            uint32_t : 21;
+        };
+    };
+} ubx_aid_ini_u6_t;
+UBX_PAYLOAD_SIZE(ubx_aid_ini_u6_t, 48);
+
+#define UBX_AID_INI_U6(payload)                 ((const ubx_aid_ini_u6_t *)(payload))
+#define UBX_AID_INI_U6_SIZE                     48
+#define UBX_AID_INI_U6_TYPED(name, ...)         UBX_MESSAGE_TYPED(name, 0x0B, 0x01, ubx_aid_ini_u6_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-INI-U6M payload (48 bytes)
+typedef struct __attribute__((packed)) {
+    int32_t ecefXOrLat;                 // 0: cm_or_deg*1e-7
+    int32_t ecefYOrLon;                 // 4: cm_or_deg*1e-7
+    int32_t ecefZOrAlt;                 // 8: cm
+    uint32_t posAcc;                    // 12: cm
+    union {
+        uint16_t tmCfg;                 // 16
+        struct {
+            uint16_t : 1;
+            uint16_t fEdge : 1;             // bit 1
+            uint16_t : 2;
+            uint16_t tm1 : 1;               // bit 4
+            uint16_t : 1;
+            uint16_t f1 : 1;                // bit 6
+            uint16_t : 9;
+        };
+    };
+    uint16_t wnoOrDate;                 // 18: week_or_yearMonth
+    uint32_t towOrTime;                 // 20: ms_or_dayHourMinuteSec
+    int32_t towNs;                      // 24: ns
+    uint32_t tAccMs;                    // 28: ms
+    uint32_t tAccNs;                    // 32: ns
+    int32_t clkDOrFreq;                 // 36: ns/s_or_Hz*1e-2
+    uint32_t clkDAccOrFreqAcc;          // 40: ns/s_or_ppb
+    union {
+        uint32_t flags;                 // 44
+        struct {
+            uint32_t pos : 1;               // bit 0
+            uint32_t time : 1;              // bit 1
+            uint32_t clockD : 1;            // bit 2
+            uint32_t tp : 1;                // bit 3
+            uint32_t clockF : 1;            // bit 4
+            uint32_t lla : 1;               // bit 5
+            uint32_t altInv : 1;            // bit 6
+            uint32_t prevTm : 1;            // bit 7
+            uint32_t : 2;
+            uint32_t utc : 1;               // bit 10
+            uint32_t : 21;
+        };
+    };
+} ubx_aid_ini_u6m_t;
+UBX_PAYLOAD_SIZE(ubx_aid_ini_u6m_t, 48);
+
+#define UBX_AID_INI_U6M(payload)                ((const ubx_aid_ini_u6m_t *)(payload))
+#define UBX_AID_INI_U6M_SIZE                    48
+#define UBX_AID_INI_U6M_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x0B, 0x01, ubx_aid_ini_u6m_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-HUI-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_aid_hui_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_aid_hui_poll0_t, 0);
+
+#define UBX_AID_HUI_POLL0(payload)              ((const ubx_aid_hui_poll0_t *)(payload))
+#define UBX_AID_HUI_POLL0_SIZE                  0
+#define UBX_AID_HUI_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x0B, 0x02, ubx_aid_hui_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-HUI-DATA1 payload (72 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t health;                    // 0
+    double utcA0;                       // 4
+    double utcA1;                       // 12
+    int32_t utcTOW;                     // 20
+    int16_t utcWNT;                     // 24
+    int16_t utcLS;                      // 26
+    int16_t utcWNF;                     // 28
+    int16_t utcDN;                      // 30
+    int16_t utcLSF;                     // 32
+    int16_t utcSpare;                   // 34
+    float klobA0;                       // 36: s
+    float klobA1;                       // 40: s/semicircle
+    float klobA2;                       // 44: s/semicircle^2
+    float klobA3;                       // 48: s/semicircle^3
+    float klobB0;                       // 52: s
+    float klobB1;                       // 56: s/semicircle
+    float klobB2;                       // 60: s/semicircle^2
+    float klobB3;                       // 64: s/semicircle^3
+    union {
+        uint32_t flags;                 // 68
+        struct {
+            uint32_t healthValid : 1;       // bit 0
+            uint32_t utcValid : 1;          // bit 1
+            uint32_t klobValid : 1;         // bit 2
+            uint32_t : 29;
+        };
+    };
+} ubx_aid_hui_data1_t;
+UBX_PAYLOAD_SIZE(ubx_aid_hui_data1_t, 72);
+
+#define UBX_AID_HUI_DATA1(payload)              ((const ubx_aid_hui_data1_t *)(payload))
+#define UBX_AID_HUI_DATA1_SIZE                  72
+#define UBX_AID_HUI_DATA1_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x0B, 0x02, ubx_aid_hui_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-DATA-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_aid_data_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_aid_data_poll0_t, 0);
+
+#define UBX_AID_DATA_POLL0(payload)             ((const ubx_aid_data_poll0_t *)(payload))
+#define UBX_AID_DATA_POLL0_SIZE                 0
+#define UBX_AID_DATA_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x0B, 0x10, ubx_aid_data_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-ALM-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_aid_alm_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_aid_alm_poll0_t, 0);
+
+#define UBX_AID_ALM_POLL0(payload)              ((const ubx_aid_alm_poll0_t *)(payload))
+#define UBX_AID_ALM_POLL0_SIZE                  0
+#define UBX_AID_ALM_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x0B, 0x30, ubx_aid_alm_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-ALM-POLLID payload (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t svid;                       // 0
+} ubx_aid_alm_pollid_t;
+UBX_PAYLOAD_SIZE(ubx_aid_alm_pollid_t, 1);
+
+#define UBX_AID_ALM_POLLID(payload)             ((const ubx_aid_alm_pollid_t *)(payload))
+#define UBX_AID_ALM_POLLID_SIZE                 1
+#define UBX_AID_ALM_POLLID_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x0B, 0x30, ubx_aid_alm_pollid_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-ALM-DATA0 payload (8 + 32 optional bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t svid;                      // 0
+    uint32_t week;                      // 4
+    uint32_t dwrd[8];                   // 8
+} ubx_aid_alm_data0_t;
+UBX_PAYLOAD_SIZE(ubx_aid_alm_data0_t, 40);
+
+#define UBX_AID_ALM_DATA0(payload)              ((const ubx_aid_alm_data0_t *)(payload))
+#define UBX_AID_ALM_DATA0_SIZE                  40
+#define UBX_AID_ALM_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x0B, 0x30, ubx_aid_alm_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-EPH-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_aid_eph_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_aid_eph_poll0_t, 0);
+
+#define UBX_AID_EPH_POLL0(payload)              ((const ubx_aid_eph_poll0_t *)(payload))
+#define UBX_AID_EPH_POLL0_SIZE                  0
+#define UBX_AID_EPH_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x0B, 0x31, ubx_aid_eph_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-EPH-POLLID payload (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t svid;                       // 0
+} ubx_aid_eph_pollid_t;
+UBX_PAYLOAD_SIZE(ubx_aid_eph_pollid_t, 1);
+
+#define UBX_AID_EPH_POLLID(payload)             ((const ubx_aid_eph_pollid_t *)(payload))
+#define UBX_AID_EPH_POLLID_SIZE                 1
+#define UBX_AID_EPH_POLLID_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x0B, 0x31, ubx_aid_eph_pollid_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-EPH-DATA0 payload (8 + 96 optional bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t svid;                      // 0
+    uint32_t how;                       // 4
+    uint32_t sf1d[8];                   // 8
+    uint32_t sf2d[8];                   // 40
+    uint32_t sf3d[8];                   // 72
+} ubx_aid_eph_data0_t;
+UBX_PAYLOAD_SIZE(ubx_aid_eph_data0_t, 104);
+
+#define UBX_AID_EPH_DATA0(payload)              ((const ubx_aid_eph_data0_t *)(payload))
+#define UBX_AID_EPH_DATA0_SIZE                  104
+#define UBX_AID_EPH_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x0B, 0x31, ubx_aid_eph_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-ALPSRV-REQ payload (16 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t idSize;                     // 0: bytes
+    uint8_t type;                       // 1
+    uint16_t ofs;                       // 2
+    uint16_t size;                      // 4
+    uint16_t fileId;                    // 6
+    uint16_t dataSize;                  // 8: bytes
+    uint8_t id1;                        // 10
+    uint8_t id2;                        // 11
+    uint32_t id3;                       // 12
+} ubx_aid_alpsrv_req_t;
+UBX_PAYLOAD_SIZE(ubx_aid_alpsrv_req_t, 16);
+
+#define UBX_AID_ALPSRV_REQ(payload)             ((const ubx_aid_alpsrv_req_t *)(payload))
+#define UBX_AID_ALPSRV_REQ_SIZE                 16
+#define UBX_AID_ALPSRV_REQ_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x0B, 0x32, ubx_aid_alpsrv_req_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-ALPSRV-SRV group1 (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t data;                       // 0
+} ubx_aid_alpsrv_srv_group1_t;
+UBX_PAYLOAD_SIZE(ubx_aid_alpsrv_srv_group1_t, 1);
+
+// UBX-AID-ALPSRV-SRV payload (16 + dataSize*1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t idSize;                     // 0: bytes
+    uint8_t type;                       // 1
+    uint16_t ofs;                       // 2
+    uint16_t size;                      // 4
+    uint16_t fileId;                    // 6
+    uint16_t dataSize;                  // 8: bytes
+    uint8_t id1;                        // 10
+    uint8_t id2;                        // 11
+    uint32_t id3;                       // 12
+    ubx_aid_alpsrv_srv_group1_t group1[];// 16: repeated
+} ubx_aid_alpsrv_srv_t;
+UBX_PAYLOAD_SIZE(ubx_aid_alpsrv_srv_t, 16);
+
+#define UBX_AID_ALPSRV_SRV(payload)             ((const ubx_aid_alpsrv_srv_t *)(payload))
+#define UBX_AID_ALPSRV_SRV_SIZE                 16
+#define UBX_AID_ALPSRV_SRV_GROUP1(payload, i)   ((const ubx_aid_alpsrv_srv_group1_t *)((const uint8_t *)(payload) + 16 + (size_t)(i) * 1))
+#define UBX_AID_ALPSRV_SRV_GROUP1_COUNT(payload, len) \
+    ((size_t)(len) <= 16 ? 0 : (size_t)UBX_AID_ALPSRV_SRV(payload)->dataSize < ((size_t)(len) - 16) / 1 ? (size_t)UBX_AID_ALPSRV_SRV(payload)->dataSize : ((size_t)(len) - 16) / 1)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-ALPSRV-CLI group1 (2 bytes)
+typedef struct __attribute__((packed)) {
+    uint16_t data;                      // 0
+} ubx_aid_alpsrv_cli_group1_t;
+UBX_PAYLOAD_SIZE(ubx_aid_alpsrv_cli_group1_t, 2);
+
+// UBX-AID-ALPSRV-CLI payload (8 + size*2 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t idSize;                     // 0: bytes
+    uint8_t type;                       // 1
+    uint16_t ofs;                       // 2
+    uint16_t size;                      // 4
+    uint16_t fileId;                    // 6
+    ubx_aid_alpsrv_cli_group1_t group1[];// 8: repeated
+} ubx_aid_alpsrv_cli_t;
+UBX_PAYLOAD_SIZE(ubx_aid_alpsrv_cli_t, 8);
+
+#define UBX_AID_ALPSRV_CLI(payload)             ((const ubx_aid_alpsrv_cli_t *)(payload))
+#define UBX_AID_ALPSRV_CLI_SIZE                 8
+#define UBX_AID_ALPSRV_CLI_GROUP1(payload, i)   ((const ubx_aid_alpsrv_cli_group1_t *)((const uint8_t *)(payload) + 8 + (size_t)(i) * 2))
+#define UBX_AID_ALPSRV_CLI_GROUP1_COUNT(payload, len) \
+    ((size_t)(len) <= 8 ? 0 : (size_t)UBX_AID_ALPSRV_CLI(payload)->size < ((size_t)(len) - 8) / 2 ? (size_t)UBX_AID_ALPSRV_CLI(payload)->size : ((size_t)(len) - 8) / 2)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-AOP-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_aid_aop_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_aid_aop_poll0_t, 0);
+
+#define UBX_AID_AOP_POLL0(payload)              ((const ubx_aid_aop_poll0_t *)(payload))
+#define UBX_AID_AOP_POLL0_SIZE                  0
+#define UBX_AID_AOP_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x0B, 0x33, ubx_aid_aop_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-AOP-POLLID payload (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t svid;                       // 0
+} ubx_aid_aop_pollid_t;
+UBX_PAYLOAD_SIZE(ubx_aid_aop_pollid_t, 1);
+
+#define UBX_AID_AOP_POLLID(payload)             ((const ubx_aid_aop_pollid_t *)(payload))
+#define UBX_AID_AOP_POLLID_SIZE                 1
+#define UBX_AID_AOP_POLLID_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x0B, 0x33, ubx_aid_aop_pollid_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-AOP-DATA0 payload (48 + 144 optional bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t svid;                       // 0
+    uint8_t data[47];                   // 1
+    uint8_t optional0[48];              // 48
+    uint8_t optional1[48];              // 96
+    uint8_t optional2[48];              // 144
+} ubx_aid_aop_data0_t;
+UBX_PAYLOAD_SIZE(ubx_aid_aop_data0_t, 192);
+
+#define UBX_AID_AOP_DATA0(payload)              ((const ubx_aid_aop_data0_t *)(payload))
+#define UBX_AID_AOP_DATA0_SIZE                  192
+#define UBX_AID_AOP_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x0B, 0x33, ubx_aid_aop_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-AOP-DATA1 payload (60 + 144 optional bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t svid;                       // 0
+    uint8_t data[59];                   // 1
+    uint8_t optional0[48];              // 60
+    uint8_t optional1[48];              // 108
+    uint8_t optional2[48];              // 156
+} ubx_aid_aop_data1_t;
+UBX_PAYLOAD_SIZE(ubx_aid_aop_data1_t, 204);
+
+#define UBX_AID_AOP_DATA1(payload)              ((const ubx_aid_aop_data1_t *)(payload))
+#define UBX_AID_AOP_DATA1_SIZE                  204
+#define UBX_AID_AOP_DATA1_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x0B, 0x33, ubx_aid_aop_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-AOP-DATA2 payload (4 + 64 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t gnssId;                     // 0
+    uint8_t svId;                       // 1
+    uint8_t reserved0[2];               // 2
+    uint8_t data[64];                   // 4
+} ubx_aid_aop_data2_t;
+UBX_PAYLOAD_SIZE(ubx_aid_aop_data2_t, 68);
+
+#define UBX_AID_AOP_DATA2(payload)              ((const ubx_aid_aop_data2_t *)(payload))
+#define UBX_AID_AOP_DATA2_SIZE                  68
+#define UBX_AID_AOP_DATA2_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x0B, 0x33, ubx_aid_aop_data2_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-ALP-TX group0 (2 bytes)
+typedef struct __attribute__((packed)) {
+    uint16_t alpData;                   // 0
+} ubx_aid_alp_tx_group0_t;
+UBX_PAYLOAD_SIZE(ubx_aid_alp_tx_group0_t, 2);
+
+// UBX-AID-ALP-TX payload (n*2 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_aid_alp_tx_t;
+UBX_PAYLOAD_SIZE(ubx_aid_alp_tx_t, 0);
+
+#define UBX_AID_ALP_TX(payload)                 ((const ubx_aid_alp_tx_t *)(payload))
+#define UBX_AID_ALP_TX_SIZE                     0
+#define UBX_AID_ALP_TX_GROUP0(payload, i)       ((const ubx_aid_alp_tx_group0_t *)((const uint8_t *)(payload) + 0 + (size_t)(i) * 2))
+#define UBX_AID_ALP_TX_GROUP0_COUNT(payload, len)((size_t)(len) > 0 ? ((size_t)(len) - 0) / 2 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-ALP-STOP payload (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t reserved0;                  // 0
+} ubx_aid_alp_stop_t;
+UBX_PAYLOAD_SIZE(ubx_aid_alp_stop_t, 1);
+
+#define UBX_AID_ALP_STOP(payload)               ((const ubx_aid_alp_stop_t *)(payload))
+#define UBX_AID_ALP_STOP_SIZE                   1
+#define UBX_AID_ALP_STOP_TYPED(name, ...)       UBX_MESSAGE_TYPED(name, 0x0B, 0x50, ubx_aid_alp_stop_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-ALP-ACK payload (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t ack;                        // 0
+} ubx_aid_alp_ack_t;
+UBX_PAYLOAD_SIZE(ubx_aid_alp_ack_t, 1);
+
+#define UBX_AID_ALP_ACK(payload)                ((const ubx_aid_alp_ack_t *)(payload))
+#define UBX_AID_ALP_ACK_SIZE                    1
+#define UBX_AID_ALP_ACK_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x0B, 0x50, ubx_aid_alp_ack_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-ALP-NAK payload (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t nak;                        // 0
+} ubx_aid_alp_nak_t;
+UBX_PAYLOAD_SIZE(ubx_aid_alp_nak_t, 1);
+
+#define UBX_AID_ALP_NAK(payload)                ((const ubx_aid_alp_nak_t *)(payload))
+#define UBX_AID_ALP_NAK_SIZE                    1
+#define UBX_AID_ALP_NAK_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x0B, 0x50, ubx_aid_alp_nak_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-ALP-STAT payload (24 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t predTow;                   // 0: s
+    uint32_t predDur;                   // 4: s
+    int32_t age;                        // 8: s
+    uint16_t predWno;                   // 12
+    uint16_t almWno;                    // 14
+    uint8_t reserved0[4];               // 16
+    uint8_t svs;                        // 20
+    uint8_t reserved1[3];               // 21
+} ubx_aid_alp_stat_t;
+UBX_PAYLOAD_SIZE(ubx_aid_alp_stat_t, 24);
+
+#define UBX_AID_ALP_STAT(payload)               ((const ubx_aid_alp_stat_t *)(payload))
+#define UBX_AID_ALP_STAT_SIZE                   24
+#define UBX_AID_ALP_STAT_TYPED(name, ...)       UBX_MESSAGE_TYPED(name, 0x0B, 0x50, ubx_aid_alp_stat_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-AID-ALP-STATEXT payload (24 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t predTow;                   // 0: s
+    uint32_t predDur;                   // 4: s
+    int32_t age;                        // 8: s
+    uint16_t predWno;                   // 12
+    uint16_t almWno;                    // 14
+    uint8_t reserved0[4];               // 16
+    uint8_t svs;                        // 20
+    uint8_t reserved1;                  // 21
+    uint8_t reserved2[2];               // 22
+} ubx_aid_alp_statext_t;
+UBX_PAYLOAD_SIZE(ubx_aid_alp_statext_t, 24);
+
+#define UBX_AID_ALP_STATEXT(payload)            ((const ubx_aid_alp_statext_t *)(payload))
+#define UBX_AID_ALP_STATEXT_SIZE                24
+#define UBX_AID_ALP_STATEXT_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x0B, 0x50, ubx_aid_alp_statext_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-TIM-TP-DATA0 payload (16 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t towMS;                     // 0: ms
+    uint32_t towSubMS;                  // 4: ms, *2^-32
+    int32_t qErr;                       // 8: ps
+    uint16_t week;                      // 12: weeks
+    union {
+        uint8_t flags;                  // 14
+        struct {
+            uint8_t timeBase : 1;           // bit 0
+            uint8_t utc : 1;                // bit 1
+            uint8_t raim : 2;               // bit 2..3
+            uint8_t qErrInvalid : 1;        // bit 4
+            uint8_t TpNotLocked : 1;        // bit 5
+            uint8_t : 2;
+        };
+    };
+    union {
+        uint8_t refInfo;                // 15
+        struct {
+            uint8_t timeRefGnss : 4;        // bit 0..3
+            uint8_t utcStandard : 4;        // bit 4..7
+        };
+    };
+} ubx_tim_tp_data0_t;
+UBX_PAYLOAD_SIZE(ubx_tim_tp_data0_t, 16);
+
+#define UBX_TIM_TP_DATA0(payload)               ((const ubx_tim_tp_data0_t *)(payload))
+#define UBX_TIM_TP_DATA0_SIZE                   16
+#define UBX_TIM_TP_DATA0_TYPED(name, ...)       UBX_MESSAGE_TYPED(name, 0x0D, 0x01, ubx_tim_tp_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-TIM-TM2-DATA1 payload (28 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t ch;                         // 0
+    union {
+        uint8_t flags;                  // 1
+        struct {
+            uint8_t mode : 1;               // bit 0
+            uint8_t run : 1;                // bit 1
+            uint8_t newFallingEdge : 1;     // bit 2
+            uint8_t timeBase : 2;           // bit 3..4
+            uint8_t utc : 1;                // bit 5
+            uint8_t time : 1;               // bit 6
+            uint8_t newRisingEdge : 1;      // bit 7
+        };
+    };
+    uint16_t count;                     // 2
+    uint16_t wnR;                       // 4
+    uint16_t wnF;                       // 6
+    uint32_t towMsR;                    // 8: ms
+    uint32_t towSubMsR;                 // 12: ns
+    uint32_t towMsF;                    // 16: ms
+    uint32_t towSubMsF;                 // 20: ns
+    uint32_t accEst;                    // 24: ns
+} ubx_tim_tm2_data1_t;
+UBX_PAYLOAD_SIZE(ubx_tim_tm2_data1_t, 28);
+
+#define UBX_TIM_TM2_DATA1(payload)              ((const ubx_tim_tm2_data1_t *)(payload))
+#define UBX_TIM_TM2_DATA1_SIZE                  28
+#define UBX_TIM_TM2_DATA1_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x0D, 0x03, ubx_tim_tm2_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-TIM-SVIN-DATA0 payload (28 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t dur;                       // 0: s
+    int32_t meanX;                      // 4: cm
+    int32_t meanY;                      // 8: cm
+    int32_t meanZ;                      // 12: cm
+    uint32_t meanV;                     // 16: mm^2
+    uint32_t obs;                       // 20
+    uint8_t valid;                      // 24
+    uint8_t active;                     // 25
+    uint8_t reserved0[2];               // 26
+} ubx_tim_svin_data0_t;
+UBX_PAYLOAD_SIZE(ubx_tim_svin_data0_t, 28);
+
+#define UBX_TIM_SVIN_DATA0(payload)             ((const ubx_tim_svin_data0_t *)(payload))
+#define UBX_TIM_SVIN_DATA0_SIZE                 28
+#define UBX_TIM_SVIN_DATA0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x0D, 0x04, ubx_tim_svin_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-TIM-VRFY-DATA1 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    int32_t itow;                       // 0: ms
+    int32_t frac;                       // 4: ns
+    int32_t deltaMs;                    // 8: ms
+    int32_t deltaNs;                    // 12: ns
+    uint16_t wno;                       // 16: week
+    union {
+        uint8_t flags;                  // 18
+        struct {
+            uint8_t src : 3;                // bit 0..2
+            uint8_t : 5;
+        };
+    };
+    uint8_t reserved0;                  // 19
+} ubx_tim_vrfy_data1_t;
+UBX_PAYLOAD_SIZE(ubx_tim_vrfy_data1_t, 20);
+
+#define UBX_TIM_VRFY_DATA1(payload)             ((const ubx_tim_vrfy_data1_t *)(payload))
+#define UBX_TIM_VRFY_DATA1_SIZE                 20
+#define UBX_TIM_VRFY_DATA1_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x0D, 0x06, ubx_tim_vrfy_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-TIM-DOSC-DATA0 payload (8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0[3];               // 1
+    uint32_t value;                     // 4
+} ubx_tim_dosc_data0_t;
+UBX_PAYLOAD_SIZE(ubx_tim_dosc_data0_t, 8);
+
+#define UBX_TIM_DOSC_DATA0(payload)             ((const ubx_tim_dosc_data0_t *)(payload))
+#define UBX_TIM_DOSC_DATA0_SIZE                 8
+#define UBX_TIM_DOSC_DATA0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x0D, 0x11, ubx_tim_dosc_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-TIM-TOS-DATA0 payload (56 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t gnssId;                     // 1
+    uint8_t reserved0[2];               // 2
+    union {
+        uint32_t flags;                 // 4
+        struct {
+            uint32_t leapNow : 1;           // bit 0
+            uint32_t leapSoon : 1;          // bit 1
+            uint32_t leapPositive : 1;      // bit 2
+            uint32_t timeInLimit : 1;       // bit 3
+            uint32_t intOscInLimit : 1;     // bit 4
+            uint32_t extOscInLimit : 1;     // bit 5
+            uint32_t gnssTimeValid : 1;     // bit 6
+            uint32_t UTCTimeValid : 1;      // bit 7
+            uint32_t DiscSrc : 3;           // bit 8..10
+            uint32_t raim : 1;              // bit 11
+            uint32_t cohPulse : 1;          // bit 12
+            uint32_t lockedPulse : 1;       // bit 13
+            uint32_t : 18;
+        };
+    };
+    uint16_t year;                      // 8: y
+    uint8_t month;                      // 10: month
+    uint8_t day;                        // 11: d
+    uint8_t hour;                       // 12: h
+    uint8_t minute;                     // 13: min
+    uint8_t second;                     // 14: s
+    uint8_t utcStandard;                // 15
+    int32_t utcOffset;                  // 16: ns
+    uint32_t utcUncertainty;            // 20: ns
+    uint32_t week;                      // 24
+    uint32_t TOW;                       // 28: s
+    int32_t gnssOffset;                 // 32: ns
+    uint32_t gnssUncertainty;           // 36: ns
+    int32_t intOscOffset;               // 40: ppb, *2^-8
+    uint32_t intOscUncertainty;         // 44: ppb, *2^-8
+    int32_t extOscOffset;               // 48: ppb, *2^-8
+    uint32_t extOscUncertainty;         // 52: ppb, *2^-8
+} ubx_tim_tos_data0_t;
+UBX_PAYLOAD_SIZE(ubx_tim_tos_data0_t, 56);
+
+#define UBX_TIM_TOS_DATA0(payload)              ((const ubx_tim_tos_data0_t *)(payload))
+#define UBX_TIM_TOS_DATA0_SIZE                  56
+#define UBX_TIM_TOS_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x0D, 0x12, ubx_tim_tos_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-TIM-SMEAS-DATA0 channel (24 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t sourceId;                   // 0
+    union {
+        uint8_t flags;                  // 1
+        struct {
+            uint8_t freqValid : 1;          // bit 0
+            uint8_t phaseValid : 1;         // bit 1
+            uint8_t : 6;
+        };
+    };
+    int8_t phaseOffsetFrac;             // 2: ns, *2^-8
+    uint8_t phaseUncFrac;               // 3: ns, *2^-8
+    int32_t phaseOffset;                // 4: ns
+    uint32_t phaseUnc;                  // 8: ns
+    uint8_t reserved2[4];               // 12
+    int32_t freqOffset;                 // 16: ppb, *2^-8
+    uint32_t freqUnc;                   // 20: ppb, *2^-8
+} ubx_tim_smeas_data0_channel_t;
+UBX_PAYLOAD_SIZE(ubx_tim_smeas_data0_channel_t, 24);
+
+// UBX-TIM-SMEAS-DATA0 payload (12 + numMeas*24 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t numMeas;                    // 1
+    uint8_t reserved0[2];               // 2
+    uint32_t iTOW;                      // 4: ms
+    uint8_t reserved1[4];               // 8
+    ubx_tim_smeas_data0_channel_t channel[];// 12: repeated
+} ubx_tim_smeas_data0_t;
+UBX_PAYLOAD_SIZE(ubx_tim_smeas_data0_t, 12);
+
+#define UBX_TIM_SMEAS_DATA0(payload)            ((const ubx_tim_smeas_data0_t *)(payload))
+#define UBX_TIM_SMEAS_DATA0_SIZE                12
+#define UBX_TIM_SMEAS_DATA0_CHANNEL(payload, i) ((const ubx_tim_smeas_data0_channel_t *)((const uint8_t *)(payload) + 12 + (size_t)(i) * 24))
+#define UBX_TIM_SMEAS_DATA0_CHANNEL_COUNT(payload, len) \
+    ((size_t)(len) <= 12 ? 0 : (size_t)UBX_TIM_SMEAS_DATA0(payload)->numMeas < ((size_t)(len) - 12) / 24 ? (size_t)UBX_TIM_SMEAS_DATA0(payload)->numMeas : ((size_t)(len) - 12) / 24)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-TIM-VCOCAL-STOP payload (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+} ubx_tim_vcocal_stop_t;
+UBX_PAYLOAD_SIZE(ubx_tim_vcocal_stop_t, 1);
+
+#define UBX_TIM_VCOCAL_STOP(payload)            ((const ubx_tim_vcocal_stop_t *)(payload))
+#define UBX_TIM_VCOCAL_STOP_SIZE                1
+#define UBX_TIM_VCOCAL_STOP_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x0D, 0x15, ubx_tim_vcocal_stop_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-TIM-VCOCAL-CMD1 payload (12 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t oscId;                      // 2
+    uint8_t srcId;                      // 3
+    uint8_t reserved0[2];               // 4
+    uint16_t raw0;                      // 6
+    uint16_t raw1;                      // 8
+    uint16_t maxStepSize;               // 10: raw value/s
+} ubx_tim_vcocal_cmd1_t;
+UBX_PAYLOAD_SIZE(ubx_tim_vcocal_cmd1_t, 12);
+
+#define UBX_TIM_VCOCAL_CMD1(payload)            ((const ubx_tim_vcocal_cmd1_t *)(payload))
+#define UBX_TIM_VCOCAL_CMD1_SIZE                12
+#define UBX_TIM_VCOCAL_CMD1_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x0D, 0x15, ubx_tim_vcocal_cmd1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-TIM-VCOCAL-DATA0 payload (12 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t oscId;                      // 2
+    uint8_t reserved0[3];               // 3
+    uint16_t gainUncertainty;           // 6: 1/1, *2^-16
+    int32_t gainVco;                    // 8: ppb/raw LSB, *2^-16
+} ubx_tim_vcocal_data0_t;
+UBX_PAYLOAD_SIZE(ubx_tim_vcocal_data0_t, 12);
+
+#define UBX_TIM_VCOCAL_DATA0(payload)           ((const ubx_tim_vcocal_data0_t *)(payload))
+#define UBX_TIM_VCOCAL_DATA0_SIZE               12
+#define UBX_TIM_VCOCAL_DATA0_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, 0x0D, 0x15, ubx_tim_vcocal_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-TIM-FCHG-DATA0 payload (32 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0[3];               // 1
+    uint32_t iTOW;                      // 4: ms
+    int32_t intDeltaFreq;               // 8: ppb, *2^-8
+    uint32_t intDeltaFreqUnc;           // 12: ppb, *2^-8
+    uint32_t intRaw;                    // 16
+    int32_t extDeltaFreq;               // 20: ppb, *2^-8
+    uint32_t extDeltaFreqUnc;           // 24: ppb, *2^-8
+    uint32_t extRaw;                    // 28
+} ubx_tim_fchg_data0_t;
+UBX_PAYLOAD_SIZE(ubx_tim_fchg_data0_t, 32);
+
+#define UBX_TIM_FCHG_DATA0(payload)             ((const ubx_tim_fchg_data0_t *)(payload))
+#define UBX_TIM_FCHG_DATA0_SIZE                 32
+#define UBX_TIM_FCHG_DATA0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x0D, 0x16, ubx_tim_fchg_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-TIM-HOC-DATA0 payload (8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t oscId;                      // 1
+    union {
+        uint8_t flags;                  // 2
+        struct {
+            uint8_t raw : 1;                // bit 0
+            uint8_t difference : 1;         // bit 1
+            uint8_t : 6;
+        };
+    };
+    uint8_t reserved0;                  // 3
+    int32_t value;                      // 4: ppb/-, *2^-8
+} ubx_tim_hoc_data0_t;
+UBX_PAYLOAD_SIZE(ubx_tim_hoc_data0_t, 8);
+
+#define UBX_TIM_HOC_DATA0(payload)              ((const ubx_tim_hoc_data0_t *)(payload))
+#define UBX_TIM_HOC_DATA0_SIZE                  8
+#define UBX_TIM_HOC_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x0D, 0x17, ubx_tim_hoc_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-ESF-MEAS-DATA0 datafields (4 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint32_t data;                  // 0
+        struct {
+            uint32_t dataField : 24;        // bit 0..23
+            uint32_t dataType : 6;          // bit 24..29
+            uint32_t : 2;
+        };
+    };
+} ubx_esf_meas_data0_datafields_t;
+UBX_PAYLOAD_SIZE(ubx_esf_meas_data0_datafields_t, 4);
+
+// UBX-ESF-MEAS-DATA0 group1 (4 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t calibTtag;                 // 0: ms
+} ubx_esf_meas_data0_group1_t;
+UBX_PAYLOAD_SIZE(ubx_esf_meas_data0_group1_t, 4);
+
+// UBX-ESF-MEAS-DATA0 payload (8 + numMeas*4 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t timeTag;                   // 0
+    union {
+        uint16_t flags;                 // 4
+        struct {
+            uint16_t timeMarkSent : 2;      // bit 0..1
+            uint16_t timeMarkEdge : 1;      // bit 2
+            uint16_t calibTtagValid : 1;    // bit 3
+            uint16_t : 7;
+            uint16_t numMeas : 5;           // bit 11..15
+        };
+    };
+    uint16_t id;                        // 6
+    ubx_esf_meas_data0_datafields_t datafields[];// 8: repeated
+} ubx_esf_meas_data0_t;
+UBX_PAYLOAD_SIZE(ubx_esf_meas_data0_t, 8);
+
+#define UBX_ESF_MEAS_DATA0(payload)             ((const ubx_esf_meas_data0_t *)(payload))
+#define UBX_ESF_MEAS_DATA0_SIZE                 8
+#define UBX_ESF_MEAS_DATA0_DATAFIELDS(payload, i)((const ubx_esf_meas_data0_datafields_t *)((const uint8_t *)(payload) + 8 + (size_t)(i) * 4))
+#define UBX_ESF_MEAS_DATA0_DATAFIELDS_COUNT(payload, len)((size_t)(len) > 8 ? ((size_t)(len) - 8) / 4 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-ESF-MEAS-DATA6R datafields (4 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint32_t data;                  // 0
+        struct {
+            uint32_t dataField : 24;        // bit 0..23
+            uint32_t dataType : 8;          // bit 24..31
+        };
+    };
+} ubx_esf_meas_data6r_datafields_t;
+UBX_PAYLOAD_SIZE(ubx_esf_meas_data6r_datafields_t, 4);
+
+// UBX-ESF-MEAS-DATA6R group1 (4 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t calibTtag;                 // 0: ms
+} ubx_esf_meas_data6r_group1_t;
+UBX_PAYLOAD_SIZE(ubx_esf_meas_data6r_group1_t, 4);
+
+// UBX-ESF-MEAS-DATA6R payload (8 + numMeas*4 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t timeTag;                   // 0
+    union {
+        uint16_t flags;                 // 4
+        struct {
+            uint16_t timeMarkSent : 2;      // bit 0..1
+            uint16_t timeMarkEdge : 1;      // bit 2
+            uint16_t calibTtagValid : 1;    // bit 3
+            uint16_t : 7;
+            uint16_t numMeas : 5;           // bit 11..15
+        };
+    };
+    uint16_t id;                        // 6
+    ubx_esf_meas_data6r_datafields_t datafields[];// 8: repeated
+} ubx_esf_meas_data6r_t;
+UBX_PAYLOAD_SIZE(ubx_esf_meas_data6r_t, 8);
+
+#define UBX_ESF_MEAS_DATA6R(payload)            ((const ubx_esf_meas_data6r_t *)(payload))
+#define UBX_ESF_MEAS_DATA6R_SIZE                8
+#define UBX_ESF_MEAS_DATA6R_DATAFIELDS(payload, i)((const ubx_esf_meas_data6r_datafields_t *)((const uint8_t *)(payload) + 8 + (size_t)(i) * 4))
+#define UBX_ESF_MEAS_DATA6R_DATAFIELDS_COUNT(payload, len)((size_t)(len) > 8 ? ((size_t)(len) - 8) / 4 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-ESF-RAW-DATA0 datafields (8 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint32_t data;                  // 0
+        struct {
+            uint32_t dataField : 24;        // bit 0..23
+            uint32_t dataType : 8;          // bit 24..31
+        };
+    };
+    uint32_t sTtag;                     // 4
+} ubx_esf_raw_data0_datafields_t;
+UBX_PAYLOAD_SIZE(ubx_esf_raw_data0_datafields_t, 8);
+
+// UBX-ESF-RAW-DATA0 payload (4 + n*8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t reserved0[4];               // 0
+    ubx_esf_raw_data0_datafields_t datafields[];// 4: repeated
+} ubx_esf_raw_data0_t;
+UBX_PAYLOAD_SIZE(ubx_esf_raw_data0_t, 4);
+
+#define UBX_ESF_RAW_DATA0(payload)              ((const ubx_esf_raw_data0_t *)(payload))
+#define UBX_ESF_RAW_DATA0_SIZE                  4
+#define UBX_ESF_RAW_DATA0_DATAFIELDS(payload, i)((const ubx_esf_raw_data0_datafields_t *)((const uint8_t *)(payload) + 4 + (size_t)(i) * 8))
+#define UBX_ESF_RAW_DATA0_DATAFIELDS_COUNT(payload, len)((size_t)(len) > 4 ? ((size_t)(len) - 4) / 8 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-ESF-CAL-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_esf_cal_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_esf_cal_poll0_t, 0);
+
+#define UBX_ESF_CAL_POLL0(payload)              ((const ubx_esf_cal_poll0_t *)(payload))
+#define UBX_ESF_CAL_POLL0_SIZE                  0
+#define UBX_ESF_CAL_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x10, 0x04, ubx_esf_cal_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-ESF-CAL-DATA0 datafields (4 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint32_t data;                  // 0
+        struct {
+            uint32_t dataField : 24;        // bit 0..23
+            uint32_t dataType : 6;          // bit 24..29
+            uint32_t : 2;
+        };
+    };
+} ubx_esf_cal_data0_datafields_t;
+UBX_PAYLOAD_SIZE(ubx_esf_cal_data0_datafields_t, 4);
+
+// UBX-ESF-CAL-DATA0 payload (12 + n*4 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t sTtag;                     // 0
+    uint8_t version;                    // 4
+    uint8_t reserved0[3];               // 5
+    uint8_t reserved1[4];               // 8
+    ubx_esf_cal_data0_datafields_t datafields[];// 12: repeated
+} ubx_esf_cal_data0_t;
+UBX_PAYLOAD_SIZE(ubx_esf_cal_data0_t, 12);
+
+#define UBX_ESF_CAL_DATA0(payload)              ((const ubx_esf_cal_data0_t *)(payload))
+#define UBX_ESF_CAL_DATA0_SIZE                  12
+#define UBX_ESF_CAL_DATA0_DATAFIELDS(payload, i)((const ubx_esf_cal_data0_datafields_t *)((const uint8_t *)(payload) + 12 + (size_t)(i) * 4))
+#define UBX_ESF_CAL_DATA0_DATAFIELDS_COUNT(payload, len)((size_t)(len) > 12 ? ((size_t)(len) - 12) / 4 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-ESF-STATUS-DATA6R sensors (4 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint8_t sensStatus1;            // 0
+        struct {
+            uint8_t type : 6;               // bit 0..5
+            uint8_t used : 1;               // bit 6
+            uint8_t : 1;
+        };
+    };
+    union {
+        uint8_t sensStatus2;            // 1
+        struct {
+            uint8_t calibStatus : 2;        // bit 0..1
+            uint8_t timeStatus : 2;         // bit 2..3
+            uint8_t : 4;
+        };
+    };
+    uint8_t freq;                       // 2: Hz
+    uint8_t reserved2;                  // 3
+} ubx_esf_status_data6r_sensors_t;
+UBX_PAYLOAD_SIZE(ubx_esf_status_data6r_sensors_t, 4);
+
+// UBX-ESF-STATUS-DATA6R payload (16 + numSens*4 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t reserved0[8];               // 4
+    uint8_t status;                     // 12
+    uint8_t reserved1[2];               // 13
+    uint8_t numSens;                    // 15
+    ubx_esf_status_data6r_sensors_t sensors[];// 16: repeated
+} ubx_esf_status_data6r_t;
+UBX_PAYLOAD_SIZE(ubx_esf_status_data6r_t, 16);
+
+#define UBX_ESF_STATUS_DATA6R(payload)          ((const ubx_esf_status_data6r_t *)(payload))
+#define UBX_ESF_STATUS_DATA6R_SIZE              16
+#define UBX_ESF_STATUS_DATA6R_SENSORS(payload, i)((const ubx_esf_status_data6r_sensors_t *)((const uint8_t *)(payload) + 16 + (size_t)(i) * 4))
+#define UBX_ESF_STATUS_DATA6R_SENSORS_COUNT(payload, len) \
+    ((size_t)(len) <= 16 ? 0 : (size_t)UBX_ESF_STATUS_DATA6R(payload)->numSens < ((size_t)(len) - 16) / 4 ? (size_t)UBX_ESF_STATUS_DATA6R(payload)->numSens : ((size_t)(len) - 16) / 4)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-ESF-STATUS-DATA2 sensors (4 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint8_t sensStatus1;            // 0
+        struct {
+            uint8_t type : 6;               // bit 0..5
+            uint8_t used : 1;               // bit 6
+            uint8_t ready : 1;              // bit 7
+        };
+    };
+    union {
+        uint8_t sensStatus2;            // 1
+        struct {
+            uint8_t calibStatus : 2;        // bit 0..1
+            uint8_t timeStatus : 2;         // bit 2..3
+            uint8_t : 4;
+        };
+    };
+    uint8_t freq;                       // 2: Hz
+    union {
+        uint8_t faults;                 // 3
+        struct {
+            uint8_t badMeas : 1;            // bit 0
+            uint8_t badTTag : 1;            // bit 1
+            uint8_t missingMeas : 1;        // bit 2
+            uint8_t noisyMeas : 1;          // bit 3
+            uint8_t : 4;
+        };
+    };
+} ubx_esf_status_data2_sensors_t;
+UBX_PAYLOAD_SIZE(ubx_esf_status_data2_sensors_t, 4);
+
+// UBX-ESF-STATUS-DATA2 payload (16 + numSens*4 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t version;                    // 4
+    uint8_t reserved0[7];               // 5
+    uint8_t status;                     // 12
+    uint8_t reserved1[2];               // 13
+    uint8_t numSens;                    // 15
+    ubx_esf_status_data2_sensors_t sensors[];// 16: repeated
+} ubx_esf_status_data2_t;
+UBX_PAYLOAD_SIZE(ubx_esf_status_data2_t, 16);
+
+#define UBX_ESF_STATUS_DATA2(payload)           ((const ubx_esf_status_data2_t *)(payload))
+#define UBX_ESF_STATUS_DATA2_SIZE               16
+#define UBX_ESF_STATUS_DATA2_SENSORS(payload, i)((const ubx_esf_status_data2_sensors_t *)((const uint8_t *)(payload) + 16 + (size_t)(i) * 4))
+#define UBX_ESF_STATUS_DATA2_SENSORS_COUNT(payload, len) \
+    ((size_t)(len) <= 16 ? 0 : (size_t)UBX_ESF_STATUS_DATA2(payload)->numSens < ((size_t)(len) - 16) / 4 ? (size_t)UBX_ESF_STATUS_DATA2(payload)->numSens : ((size_t)(len) - 16) / 4)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-ESF-STATUS-DATA3 sensors (4 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint8_t sensStatus1;            // 0
+        struct {
+            uint8_t type : 6;               // bit 0..5
+            uint8_t used : 1;               // bit 6
+            uint8_t ready : 1;              // bit 7
+        };
+    };
+    union {
+        uint8_t sensStatus2;            // 1
+        struct {
+            uint8_t calibStatus : 2;        // bit 0..1
+            uint8_t timeStatus : 2;         // bit 2..3
+            uint8_t : 4;
+        };
+    };
+    uint8_t freq;                       // 2: Hz
+    union {
+        uint8_t faults;                 // 3
+        struct {
+            uint8_t badMeas : 1;            // bit 0
+            uint8_t badTTag : 1;            // bit 1
+            uint8_t missingMeas : 1;        // bit 2
+            uint8_t noisyMeas : 1;          // bit 3
+            uint8_t : 4;
+        };
+    };
+} ubx_esf_status_data3_sensors_t;
+UBX_PAYLOAD_SIZE(ubx_esf_status_data3_sensors_t, 4);
+
+// UBX-ESF-STATUS-DATA3 payload (16 + numSens*4 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t version;                    // 4
+    union {
+        uint8_t initStatus1;            // 5
+        struct {
+            uint8_t wtInitStatus : 2;       // bit 0..1
+            uint8_t mntAlgStatus : 3;       // bit 2..4
+            uint8_t insInitStatus : 2;      // bit 5..6
+            uint8_t : 1;
+        };
+    };
+    union {
+        uint8_t initStatus2;            // 6
+        struct {
+            uint8_t imuInitStatus : 2;      // bit 0..1
+            uint8_t : 6;
+        };
+    };
+    uint8_t reserved0[5];               // 7
+    uint8_t fusionMode;                 // 12
+    uint8_t reserved1[2];               // 13
+    uint8_t numSens;                    // 15
+    ubx_esf_status_data3_sensors_t sensors[];// 16: repeated
+} ubx_esf_status_data3_t;
+UBX_PAYLOAD_SIZE(ubx_esf_status_data3_t, 16);
+
+#define UBX_ESF_STATUS_DATA3(payload)           ((const ubx_esf_status_data3_t *)(payload))
+#define UBX_ESF_STATUS_DATA3_SIZE               16
+#define UBX_ESF_STATUS_DATA3_SENSORS(payload, i)((const ubx_esf_status_data3_sensors_t *)((const uint8_t *)(payload) + 16 + (size_t)(i) * 4))
+#define UBX_ESF_STATUS_DATA3_SENSORS_COUNT(payload, len) \
+    ((size_t)(len) <= 16 ? 0 : (size_t)UBX_ESF_STATUS_DATA3(payload)->numSens < ((size_t)(len) - 16) / 4 ? (size_t)UBX_ESF_STATUS_DATA3(payload)->numSens : ((size_t)(len) - 16) / 4)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-ESF-RESETALG-DATA0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_esf_resetalg_data0_t;
+UBX_PAYLOAD_SIZE(ubx_esf_resetalg_data0_t, 0);
+
+#define UBX_ESF_RESETALG_DATA0(payload)         ((const ubx_esf_resetalg_data0_t *)(payload))
+#define UBX_ESF_RESETALG_DATA0_SIZE             0
+#define UBX_ESF_RESETALG_DATA0_TYPED(name, ...) UBX_MESSAGE_TYPED(name, 0x10, 0x13, ubx_esf_resetalg_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-ESF-ALG-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_esf_alg_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_esf_alg_poll0_t, 0);
+
+#define UBX_ESF_ALG_POLL0(payload)              ((const ubx_esf_alg_poll0_t *)(payload))
+#define UBX_ESF_ALG_POLL0_SIZE                  0
+#define UBX_ESF_ALG_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x10, 0x14, ubx_esf_alg_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-ESF-ALG-DATA1 payload (16 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t version;                    // 4
+    union {
+        uint8_t flags;                  // 5
+        struct {
+            uint8_t autoMntAlgOn : 1;       // bit 0
+            uint8_t status : 3;             // bit 1..3
+            uint8_t : 4;
+        };
+    };
+    union {
+        uint8_t error;                  // 6
+        struct {
+            uint8_t tiltAlgError : 1;       // bit 0
+            uint8_t yawAlgError : 1;        // bit 1
+            uint8_t angleError : 1;         // bit 2
+            uint8_t : 5;
+        };
+    };
+    uint8_t reserved0;                  // 7
+    uint32_t yaw;                       // 8: deg, *1e-2
+    int16_t pitch;                      // 12: deg, *1e-2
+    int16_t roll;                       // 14: deg, *1e-2
+} ubx_esf_alg_data1_t;
+UBX_PAYLOAD_SIZE(ubx_esf_alg_data1_t, 16);
+
+#define UBX_ESF_ALG_DATA1(payload)              ((const ubx_esf_alg_data1_t *)(payload))
+#define UBX_ESF_ALG_DATA1_SIZE                  16
+#define UBX_ESF_ALG_DATA1_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x10, 0x14, ubx_esf_alg_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-ESF-INS-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_esf_ins_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_esf_ins_poll0_t, 0);
+
+#define UBX_ESF_INS_POLL0(payload)              ((const ubx_esf_ins_poll0_t *)(payload))
+#define UBX_ESF_INS_POLL0_SIZE                  0
+#define UBX_ESF_INS_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x10, 0x15, ubx_esf_ins_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-ESF-INS-DATA1 payload (36 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint32_t bitfield0;             // 0
+        struct {
+            uint32_t version : 8;           // bit 0..7
+            uint32_t xAngRateValid : 1;     // bit 8
+            uint32_t yAngRateValid : 1;     // bit 9
+            uint32_t zAngRateValid : 1;     // bit 10
+            uint32_t xAccelValid : 1;       // bit 11
+            uint32_t yAccelValid : 1;       // bit 12
+            uint32_t zAccelValid : 1;       // bit 13
+            uint32_t : 18;
+        };
+    };
+    uint8_t reserved0[4];               // 4
+    uint32_t iTOW;                      // 8: ms
+    int32_t xAngRate;                   // 12: deg/s, *1e-3
+    int32_t yAngRate;                   // 16: deg/s, *1e-3
+    int32_t zAngRate;                   // 20: deg/s, *1e-3
+    int32_t xAccel;                     // 24: m/s^2, *1e-2
+    int32_t yAccel;                     // 28: m/s^2, *1e-2
+    int32_t zAccel;                     // 32: m/s^2, *1e-2
+} ubx_esf_ins_data1_t;
+UBX_PAYLOAD_SIZE(ubx_esf_ins_data1_t, 36);
+
+#define UBX_ESF_INS_DATA1(payload)              ((const ubx_esf_ins_data1_t *)(payload))
+#define UBX_ESF_INS_DATA1_SIZE                  36
+#define UBX_ESF_INS_DATA1_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x10, 0x15, ubx_esf_ins_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-GPS-EPH payload (68 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t svId;                       // 2
+    uint8_t reserved0;                  // 3
+    uint8_t fitInterval;                // 4
+    uint8_t uraIndex;                   // 5
+    uint8_t svHealth;                   // 6
+    int8_t tgd;                         // 7: s, *2^-31
+    uint16_t iodc;                      // 8
+    uint16_t toc;                       // 10: s, *2^4
+    uint8_t reserved1;                  // 12
+    int8_t af2;                         // 13: s/s squared, *2^-55
+    int16_t af1;                        // 14: s/s, *2^-43
+    int32_t af0;                        // 16: s, *2^-31
+    int16_t crs;                        // 20: m, *2^-5
+    int16_t deltaN;                     // 22: semi-circles/s, *2^-43
+    int32_t m0;                         // 24: semi-circles, *2^-31
+    int16_t cuc;                        // 28: radians, *2^-29
+    int16_t cus;                        // 30: radians, *2^-29
+    uint32_t e;                         // 32: *2^-33
+    uint32_t sqrtA;                     // 36: m^0.5, *2^-19
+    uint16_t toe;                       // 40: s, *2^4
+    int16_t cic;                        // 42: radians, *2^-29
+    int32_t omega0;                     // 44: semi-circles, *2^-31
+    int16_t cis;                        // 48: radians, *2^-29
+    int16_t crc;                        // 50: m, *2^-5
+    int32_t i0;                         // 52: semi-circles, *2^-31
+    int32_t omega;                      // 56: semi-circles, *2^-31
+    int32_t omegaDot;                   // 60: semi-circles/s, *2^-43
+    int16_t idot;                       // 64: semi-circles/s, *2^-43
+    uint8_t reserved2[2];               // 66
+} ubx_mga_gps_eph_t;
+UBX_PAYLOAD_SIZE(ubx_mga_gps_eph_t, 68);
+
+#define UBX_MGA_GPS_EPH(payload)                ((const ubx_mga_gps_eph_t *)(payload))
+#define UBX_MGA_GPS_EPH_SIZE                    68
+#define UBX_MGA_GPS_EPH_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x13, 0x00, ubx_mga_gps_eph_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-GPS-ALM payload (36 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t svId;                       // 2
+    uint8_t svHealth;                   // 3
+    uint16_t e;                         // 4: *2^-21
+    uint8_t almWNa;                     // 6: week
+    uint8_t toa;                        // 7: s, *2^12
+    int16_t deltaI;                     // 8: semi-circles, *2^-19
+    int16_t omegaDot;                   // 10: semi-circles/s, *2^-38
+    uint32_t sqrtA;                     // 12: m^0.5, *2^-11
+    int32_t omega0;                     // 16: semi-circles, *2^-23
+    int32_t omega;                      // 20: semi-circles, *2^-23
+    int32_t m0;                         // 24: semi-circles, *2^-23
+    int16_t af0;                        // 28: s, *2^-20
+    int16_t af1;                        // 30: s/s, *2^-38
+    uint8_t reserved0[4];               // 32
+} ubx_mga_gps_alm_t;
+UBX_PAYLOAD_SIZE(ubx_mga_gps_alm_t, 36);
+
+#define UBX_MGA_GPS_ALM(payload)                ((const ubx_mga_gps_alm_t *)(payload))
+#define UBX_MGA_GPS_ALM_SIZE                    36
+#define UBX_MGA_GPS_ALM_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x13, 0x00, ubx_mga_gps_alm_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-GPS-HEALTH payload (40 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t reserved0[2];               // 2
+    uint8_t healthCode[32];             // 4
+    uint8_t reserved1[4];               // 36
+} ubx_mga_gps_health_t;
+UBX_PAYLOAD_SIZE(ubx_mga_gps_health_t, 40);
+
+#define UBX_MGA_GPS_HEALTH(payload)             ((const ubx_mga_gps_health_t *)(payload))
+#define UBX_MGA_GPS_HEALTH_SIZE                 40
+#define UBX_MGA_GPS_HEALTH_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x13, 0x00, ubx_mga_gps_health_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-GPS-UTC payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t reserved0[2];               // 2
+    int32_t utcA0;                      // 4: s, *2^-30
+    int32_t utcA1;                      // 8: s/s, *2^-50
+    int8_t utcDtLS;                     // 12: s
+    uint8_t utcTot;                     // 13: s, *2^12
+    uint8_t utcWNt;                     // 14: weeks
+    uint8_t utcWNlsf;                   // 15: weeks
+    uint8_t utcDn;                      // 16: days
+    int8_t utcDtLSF;                    // 17: s
+    uint8_t reserved1[2];               // 18
+} ubx_mga_gps_utc_t;
+UBX_PAYLOAD_SIZE(ubx_mga_gps_utc_t, 20);
+
+#define UBX_MGA_GPS_UTC(payload)                ((const ubx_mga_gps_utc_t *)(payload))
+#define UBX_MGA_GPS_UTC_SIZE                    20
+#define UBX_MGA_GPS_UTC_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x13, 0x00, ubx_mga_gps_utc_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-GPS-IONO payload (16 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t reserved0[2];               // 2
+    int8_t ionoAlpha0;                  // 4: s, *2^-30
+    int8_t ionoAlpha1;                  // 5: s/semi-circle, *2^-27
+    int8_t ionoAlpha2;                  // 6: s/(semi-circle^2), *2^-24
+    int8_t ionoAlpha3;                  // 7: s/(semi-circle^3), *2^-24
+    int8_t ionoBeta0;                   // 8: s, *2^11
+    int8_t ionoBeta1;                   // 9: s/semi-circle, *2^14
+    int8_t ionoBeta2;                   // 10: s/(semi-circle^2), *2^16
+    int8_t ionoBeta3;                   // 11: s/(semi-circle^3), *2^16
+    uint8_t reserved1[4];               // 12
+} ubx_mga_gps_iono_t;
+UBX_PAYLOAD_SIZE(ubx_mga_gps_iono_t, 16);
+
+#define UBX_MGA_GPS_IONO(payload)               ((const ubx_mga_gps_iono_t *)(payload))
+#define UBX_MGA_GPS_IONO_SIZE                   16
+#define UBX_MGA_GPS_IONO_TYPED(name, ...)       UBX_MESSAGE_TYPED(name, 0x13, 0x00, ubx_mga_gps_iono_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-GAL-EPH payload (76 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t svId;                       // 2
+    uint8_t reserved0;                  // 3
+    uint16_t iodNav;                    // 4
+    int16_t deltaN;                     // 6: semi-circles/s, *2^-43
+    int32_t m0;                         // 8: semi-circles, *2^-31
+    uint32_t e;                         // 12: *2^-33
+    uint32_t sqrtA;                     // 16: m^0.5, *2^-19
+    int32_t omega0;                     // 20: semi-circles, *2^-31
+    int32_t i0;                         // 24: semi-circles, *2^-31
+    int32_t omega;                      // 28: semi-circles, *2^-31
+    int32_t omegaDot;                   // 32: semi-circles/s, *2^-43
+    int16_t iDot;                       // 36: semi-circles/s, *2^-43
+    int16_t cuc;                        // 38: radians, *2^-29
+    int16_t cus;                        // 40: radians, *2^-29
+    int16_t crc;                        // 42: radians, *2^-5
+    int16_t crs;                        // 44: radians, *2^-5
+    int16_t cic;                        // 46: radians, *2^-29
+    int16_t cis;                        // 48: radians, *2^-29
+    uint16_t toe;                       // 50: s, *60
+    int32_t af0;                        // 52: s, *2^-34
+    int32_t af1;                        // 56: s/s, *2^-46
+    int8_t af2;                         // 60: s/s squared, *2^-59
+    uint8_t sisaIndexE1E5b;             // 61
+    uint16_t toc;                       // 62: s, *60
+    int16_t bgdE1E5b;                   // 64: s, *2^-32
+    uint8_t reserved1[2];               // 66
+    uint8_t healthE1B;                  // 68
+    uint8_t dataValidityE1B;            // 69
+    uint8_t healthE5b;                  // 70
+    uint8_t dataValidityE5b;            // 71
+    uint8_t reserved2[4];               // 72
+} ubx_mga_gal_eph_t;
+UBX_PAYLOAD_SIZE(ubx_mga_gal_eph_t, 76);
+
+#define UBX_MGA_GAL_EPH(payload)                ((const ubx_mga_gal_eph_t *)(payload))
+#define UBX_MGA_GAL_EPH_SIZE                    76
+#define UBX_MGA_GAL_EPH_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x13, 0x02, ubx_mga_gal_eph_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-GAL-ALM payload (32 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t svId;                       // 2
+    uint8_t reserved0;                  // 3
+    uint8_t ioda;                       // 4
+    uint8_t almWNa;                     // 5: week
+    uint16_t toa;                       // 6: s, *600
+    int16_t deltaSqrtA;                 // 8: m^0.5, *2^-9
+    uint16_t e;                         // 10: *2^-16
+    int16_t deltaI;                     // 12: semi-circles, *2^-14
+    int16_t omega0;                     // 14: semi-circles, *2^-15
+    int16_t omegaDot;                   // 16: semi-circles/s, *2^-33
+    int16_t omega;                      // 18: semi-circles, *2^-15
+    int16_t m0;                         // 20: semi-circles, *2^-15
+    int16_t af0;                        // 22: s, *2^-19
+    int16_t af1;                        // 24: s/s, *2^-38
+    uint8_t healthE1B;                  // 26
+    uint8_t healthE5b;                  // 27
+    uint8_t reserved1[4];               // 28
+} ubx_mga_gal_alm_t;
+UBX_PAYLOAD_SIZE(ubx_mga_gal_alm_t, 32);
+
+#define UBX_MGA_GAL_ALM(payload)                ((const ubx_mga_gal_alm_t *)(payload))
+#define UBX_MGA_GAL_ALM_SIZE                    32
+#define UBX_MGA_GAL_ALM_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x13, 0x02, ubx_mga_gal_alm_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-GAL-TIMEOFFSET payload (12 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t reserved0[2];               // 2
+    int16_t a0G;                        // 4: s, *2^-35
+    int16_t a1G;                        // 6: s/s, *2^-51
+    uint8_t t0G;                        // 8: s, *3600
+    uint8_t wn0G;                       // 9: weeks
+    uint8_t reserved1[2];               // 10
+} ubx_mga_gal_timeoffset_t;
+UBX_PAYLOAD_SIZE(ubx_mga_gal_timeoffset_t, 12);
+
+#define UBX_MGA_GAL_TIMEOFFSET(payload)         ((const ubx_mga_gal_timeoffset_t *)(payload))
+#define UBX_MGA_GAL_TIMEOFFSET_SIZE             12
+#define UBX_MGA_GAL_TIMEOFFSET_TYPED(name, ...) UBX_MESSAGE_TYPED(name, 0x13, 0x02, ubx_mga_gal_timeoffset_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-GAL-UTC payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t reserved0[2];               // 2
+    int32_t a0;                         // 4: s, *2^-30
+    int32_t a1;                         // 8: s/s, *2^-50
+    int8_t dtLS;                        // 12: s
+    uint8_t tot;                        // 13: s, *3600
+    uint8_t wnt;                        // 14: weeks
+    uint8_t wnLSF;                      // 15: weeks
+    uint8_t dN;                         // 16: days
+    int8_t dTLSF;                       // 17: s
+    uint8_t reserved1[2];               // 18
+} ubx_mga_gal_utc_t;
+UBX_PAYLOAD_SIZE(ubx_mga_gal_utc_t, 20);
+
+#define UBX_MGA_GAL_UTC(payload)                ((const ubx_mga_gal_utc_t *)(payload))
+#define UBX_MGA_GAL_UTC_SIZE                    20
+#define UBX_MGA_GAL_UTC_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x13, 0x02, ubx_mga_gal_utc_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-GAL-IONO payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t reserved0[2];               // 2
+    uint16_t ai0;                       // 4: sfu, *2^-2
+    int16_t ai1;                        // 6: sfu/deg, *2^-8
+    int16_t ai2;                        // 8: sfu/deg, *2^-15
+    uint8_t sf1;                        // 10
+    uint8_t sf2;                        // 11
+    uint8_t sf3;                        // 12
+    uint8_t sf4;                        // 13
+    uint8_t sf5;                        // 14
+    uint8_t reserved1;                  // 15
+    uint8_t reserved2[4];               // 16
+} ubx_mga_gal_iono_t;
+UBX_PAYLOAD_SIZE(ubx_mga_gal_iono_t, 20);
+
+#define UBX_MGA_GAL_IONO(payload)               ((const ubx_mga_gal_iono_t *)(payload))
+#define UBX_MGA_GAL_IONO_SIZE                   20
+#define UBX_MGA_GAL_IONO_TYPED(name, ...)       UBX_MESSAGE_TYPED(name, 0x13, 0x02, ubx_mga_gal_iono_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-GAL-OSNMA-PUBKEY payload (72 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    union {
+        uint8_t bitfield0;              // 2
+        struct {
+            uint8_t pubKeyId : 4;           // bit 0..3
+            uint8_t pubKeyType : 4;         // bit 4..7
+        };
+    };
+    uint8_t reserved0;                  // 3
+    uint8_t pubKeyPoint[67];            // 4
+    uint8_t reserved1;                  // 71
+} ubx_mga_gal_osnma_pubkey_t;
+UBX_PAYLOAD_SIZE(ubx_mga_gal_osnma_pubkey_t, 72);
+
+#define UBX_MGA_GAL_OSNMA_PUBKEY(payload)       ((const ubx_mga_gal_osnma_pubkey_t *)(payload))
+#define UBX_MGA_GAL_OSNMA_PUBKEY_SIZE           72
+#define UBX_MGA_GAL_OSNMA_PUBKEY_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x13, 0x02, ubx_mga_gal_osnma_pubkey_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-GAL-OSNMA-MERKLE payload (36 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    union {
+        uint8_t bitfield0;              // 2
+        struct {
+            uint8_t applicabilityTime : 1;  // bit 0
+            uint8_t : 7;
+        };
+    };
+    uint8_t reserved0;                  // 3
+    uint8_t treeNode[32];               // 4
+} ubx_mga_gal_osnma_merkle_t;
+UBX_PAYLOAD_SIZE(ubx_mga_gal_osnma_merkle_t, 36);
+
+#define UBX_MGA_GAL_OSNMA_MERKLE(payload)       ((const ubx_mga_gal_osnma_merkle_t *)(payload))
+#define UBX_MGA_GAL_OSNMA_MERKLE_SIZE           36
+#define UBX_MGA_GAL_OSNMA_MERKLE_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x13, 0x02, ubx_mga_gal_osnma_merkle_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-BDS-EPH payload (88 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t svId;                       // 2
+    uint8_t reserved0;                  // 3
+    uint8_t SatH1;                      // 4
+    uint8_t IODC;                       // 5
+    int16_t a2;                         // 6: s/s^2, *2^-66
+    int32_t a1;                         // 8: s/s, *2^-50
+    int32_t a0;                         // 12: s, *2^-33
+    uint32_t toc;                       // 16: s, *2^3
+    int16_t TGD1;                       // 20: ns, *0.1
+    uint8_t URAI;                       // 22
+    uint8_t IODE;                       // 23
+    uint32_t toe;                       // 24: s, *2^3
+    uint32_t sqrtA;                     // 28: m^0.5, *2^-19
+    uint32_t e;                         // 32: *2^-33
+    int32_t omega;                      // 36: semi-circles, *2^-31
+    int16_t Deltan;                     // 40: semi-circles/s, *2^-43
+    int16_t IDOT;                       // 42: semi-circles/s, *2^-43
+    int32_t M0;                         // 44: semi-circles, *2^-31
+    int32_t Omega0;                     // 48: semi-circles, *2^-31
+    int32_t OmegaDot;                   // 52: semi-circles/s, *2^-43
+    int32_t i0;                         // 56: semi-circles, *2^-31
+    int32_t Cuc;                        // 60: radians, *2^-31
+    int32_t Cus;                        // 64: radians, *2^-31
+    int32_t Crc;                        // 68: m, *2^-6
+    int32_t Crs;                        // 72: m, *2^-6
+    int32_t Cic;                        // 76: radians, *2^-31
+    int32_t Cis;                        // 80: radians, *2^-31
+    uint8_t reserved1[4];               // 84
+} ubx_mga_bds_eph_t;
+UBX_PAYLOAD_SIZE(ubx_mga_bds_eph_t, 88);
+
+#define UBX_MGA_BDS_EPH(payload)                ((const ubx_mga_bds_eph_t *)(payload))
+#define UBX_MGA_BDS_EPH_SIZE                    88
+#define UBX_MGA_BDS_EPH_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x13, 0x03, ubx_mga_bds_eph_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-BDS-ALM payload (40 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t svId;                       // 2
+    uint8_t reserved0;                  // 3
+    uint8_t Wna;                        // 4: week
+    uint8_t toa;                        // 5: s, *2^12
+    int16_t deltaI;                     // 6: semi-circles, *2^-19
+    uint32_t sqrtA;                     // 8: m^0.5, *2^-11
+    uint32_t e;                         // 12: *2^-21
+    int32_t omega;                      // 16: semi-circles, *2^-23
+    int32_t M0;                         // 20: semi-circles, *2^-23
+    int32_t Omega0;                     // 24: semi-circles, *2^-23
+    int32_t omegaDot;                   // 28: semi-circles/s, *2^-38
+    int16_t a0;                         // 32: s, *2^-20
+    int16_t a1;                         // 34: s/s, *2^-38
+    uint8_t reserved1[4];               // 36
+} ubx_mga_bds_alm_t;
+UBX_PAYLOAD_SIZE(ubx_mga_bds_alm_t, 40);
+
+#define UBX_MGA_BDS_ALM(payload)                ((const ubx_mga_bds_alm_t *)(payload))
+#define UBX_MGA_BDS_ALM_SIZE                    40
+#define UBX_MGA_BDS_ALM_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x13, 0x03, ubx_mga_bds_alm_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-BDS-HEALTH payload (68 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t reserved0[2];               // 2
+    uint16_t healthCode[30];            // 4
+    uint8_t reserved1[4];               // 64
+} ubx_mga_bds_health_t;
+UBX_PAYLOAD_SIZE(ubx_mga_bds_health_t, 68);
+
+#define UBX_MGA_BDS_HEALTH(payload)             ((const ubx_mga_bds_health_t *)(payload))
+#define UBX_MGA_BDS_HEALTH_SIZE                 68
+#define UBX_MGA_BDS_HEALTH_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x13, 0x03, ubx_mga_bds_health_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-BDS-UTC payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t reserved0[2];               // 2
+    int32_t a0UTC;                      // 4: s, *2^-30
+    int32_t a1UTC;                      // 8: s/s, *2^-50
+    int8_t dtLS;                        // 12: s
+    uint8_t reserved1;                  // 13
+    uint8_t wnRec;                      // 14: week
+    uint8_t wnLSF;                      // 15: week
+    uint8_t dN;                         // 16: day
+    int8_t dtLSF;                       // 17: s
+    uint8_t reserved2[2];               // 18
+} ubx_mga_bds_utc_t;
+UBX_PAYLOAD_SIZE(ubx_mga_bds_utc_t, 20);
+
+#define UBX_MGA_BDS_UTC(payload)                ((const ubx_mga_bds_utc_t *)(payload))
+#define UBX_MGA_BDS_UTC_SIZE                    20
+#define UBX_MGA_BDS_UTC_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x13, 0x03, ubx_mga_bds_utc_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-BDS-IONO payload (16 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t reserved0[2];               // 2
+    int8_t alpha0;                      // 4: s, *2^-30
+    int8_t alpha1;                      // 5: s/pi, *2^-27
+    int8_t alpha2;                      // 6: s/pi^2, *2^-24
+    int8_t alpha3;                      // 7: s/pi^3, *2^-24
+    int8_t beta0;                       // 8: s, *2^11
+    int8_t beta1;                       // 9: s/pi, *2^14
+    int8_t beta2;                       // 10: s/pi^2, *2^16
+    int8_t beta3;                       // 11: s/pi^3, *2^16
+    uint8_t reserved1[4];               // 12
+} ubx_mga_bds_iono_t;
+UBX_PAYLOAD_SIZE(ubx_mga_bds_iono_t, 16);
+
+#define UBX_MGA_BDS_IONO(payload)               ((const ubx_mga_bds_iono_t *)(payload))
+#define UBX_MGA_BDS_IONO_SIZE                   16
+#define UBX_MGA_BDS_IONO_TYPED(name, ...)       UBX_MESSAGE_TYPED(name, 0x13, 0x03, ubx_mga_bds_iono_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-QZSS-EPH payload (68 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t svId;                       // 2
+    uint8_t reserved0;                  // 3
+    uint8_t fitInterval;                // 4
+    uint8_t uraIndex;                   // 5
+    uint8_t svHealth;                   // 6
+    int8_t tgd;                         // 7: s, *2^-31
+    uint16_t iodc;                      // 8
+    uint16_t toc;                       // 10: s, *2^4
+    uint8_t reserved1;                  // 12
+    int8_t af2;                         // 13: s/s squared, *2^-55
+    int16_t af1;                        // 14: s/s, *2^-43
+    int32_t af0;                        // 16: s, *2^-31
+    int16_t crs;                        // 20: m, *2^-5
+    int16_t deltaN;                     // 22: semi-circles/s, *2^-43
+    int32_t m0;                         // 24: semi-circles, *2^-31
+    int16_t cuc;                        // 28: radians, *2^-29
+    int16_t cus;                        // 30: radians, *2^-29
+    uint32_t e;                         // 32: *2^-33
+    uint32_t sqrtA;                     // 36: m^0.5, *2^-19
+    uint16_t toe;                       // 40: s, *2^4
+    int16_t cic;                        // 42: radians, *2^-29
+    int32_t omega0;                     // 44: semi-circles, *2^-31
+    int16_t cis;                        // 48: radians, *2^-29
+    int16_t crc;                        // 50: m, *2^-5
+    int32_t i0;                         // 52: semi-circles, *2^-31
+    int32_t omega;                      // 56: semi-circles, *2^-31
+    int32_t omegaDot;                   // 60: semi-circles/s, *2^-43
+    int16_t idot;                       // 64: semi-circles/s, *2^-43
+    uint8_t reserved2[2];               // 66
+} ubx_mga_qzss_eph_t;
+UBX_PAYLOAD_SIZE(ubx_mga_qzss_eph_t, 68);
+
+#define UBX_MGA_QZSS_EPH(payload)               ((const ubx_mga_qzss_eph_t *)(payload))
+#define UBX_MGA_QZSS_EPH_SIZE                   68
+#define UBX_MGA_QZSS_EPH_TYPED(name, ...)       UBX_MESSAGE_TYPED(name, 0x13, 0x05, ubx_mga_qzss_eph_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-QZSS-ALM payload (36 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t svId;                       // 2
+    uint8_t svHealth;                   // 3
+    uint16_t e;                         // 4: *2^-21
+    uint8_t almWNa;                     // 6: week
+    uint8_t toa;                        // 7: s, *2^12
+    int16_t deltaI;                     // 8: semi-circles, *2^-19
+    int16_t omegaDot;                   // 10: semi-circles/s, *2^-38
+    uint32_t sqrtA;                     // 12: m^0.5, *2^-11
+    int32_t omega0;                     // 16: semi-circles, *2^-23
+    int32_t omega;                      // 20: semi-circles, *2^-23
+    int32_t m0;                         // 24: semi-circles, *2^-23
+    int16_t af0;                        // 28: s, *2^-20
+    int16_t af1;                        // 30: s/s, *2^-38
+    uint8_t reserved0[4];               // 32
+} ubx_mga_qzss_alm_t;
+UBX_PAYLOAD_SIZE(ubx_mga_qzss_alm_t, 36);
+
+#define UBX_MGA_QZSS_ALM(payload)               ((const ubx_mga_qzss_alm_t *)(payload))
+#define UBX_MGA_QZSS_ALM_SIZE                   36
+#define UBX_MGA_QZSS_ALM_TYPED(name, ...)       UBX_MESSAGE_TYPED(name, 0x13, 0x05, ubx_mga_qzss_alm_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-QZSS-HEALTH payload (12 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t reserved0[2];               // 2
+    uint8_t healthCode[5];              // 4
+    uint8_t reserved1[3];               // 9
+} ubx_mga_qzss_health_t;
+UBX_PAYLOAD_SIZE(ubx_mga_qzss_health_t, 12);
+
+#define UBX_MGA_QZSS_HEALTH(payload)            ((const ubx_mga_qzss_health_t *)(payload))
+#define UBX_MGA_QZSS_HEALTH_SIZE                12
+#define UBX_MGA_QZSS_HEALTH_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x13, 0x05, ubx_mga_qzss_health_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-GLO-EPH payload (48 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t svId;                       // 2
+    uint8_t reserved0;                  // 3
+    uint8_t FT;                         // 4
+    uint8_t B;                          // 5
+    uint8_t M;                          // 6
+    int8_t H;                           // 7
+    int32_t x;                          // 8: km, *2^-11
+    int32_t y;                          // 12: km, *2^-11
+    int32_t z;                          // 16: km, *2^-11
+    int32_t dx;                         // 20: km/s, *2^-20
+    int32_t dy;                         // 24: km/s, *2^-20
+    int32_t dz;                         // 28: km/s, *2^-20
+    int8_t ddx;                         // 32: km/s^2, *2^-30
+    int8_t ddy;                         // 33: km/s^2, *2^-30
+    int8_t ddz;                         // 34: km/s^2, *2^-30
+    uint8_t tb;                         // 35: minutes, *15
+    int16_t gamma;                      // 36: *2^-40
+    uint8_t E;                          // 38: days
+    int8_t deltaTau;                    // 39: s, *2^-30
+    int32_t tau;                        // 40: s, *2^-30
+    uint8_t reserved1[4];               // 44
+} ubx_mga_glo_eph_t;
+UBX_PAYLOAD_SIZE(ubx_mga_glo_eph_t, 48);
+
+#define UBX_MGA_GLO_EPH(payload)                ((const ubx_mga_glo_eph_t *)(payload))
+#define UBX_MGA_GLO_EPH_SIZE                    48
+#define UBX_MGA_GLO_EPH_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x13, 0x06, ubx_mga_glo_eph_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-GLO-ALM payload (36 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t svId;                       // 2
+    uint8_t reserved0;                  // 3
+    uint16_t N;                         // 4: days
+    uint8_t M;                          // 6
+    uint8_t C;                          // 7
+    int16_t tau;                        // 8: s, *2^-18
+    uint16_t epsilon;                   // 10: *2^-20
+    int32_t lambda;                     // 12: semi-circles, *2^-20
+    int32_t deltaI;                     // 16: semi-circles, *2^-20
+    uint32_t tLambda;                   // 20: s, *2^-5
+    int32_t deltaT;                     // 24: s/orbital-period, *2^-9
+    int8_t deltaDT;                     // 28: s/orbital-period^2, *2^-14
+    int8_t H;                           // 29
+    int16_t omega;                      // 30
+    uint8_t reserved1[4];               // 32
+} ubx_mga_glo_alm_t;
+UBX_PAYLOAD_SIZE(ubx_mga_glo_alm_t, 36);
+
+#define UBX_MGA_GLO_ALM(payload)                ((const ubx_mga_glo_alm_t *)(payload))
+#define UBX_MGA_GLO_ALM_SIZE                    36
+#define UBX_MGA_GLO_ALM_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x13, 0x06, ubx_mga_glo_alm_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-GLO-TIMEOFFSET payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint16_t N;                         // 2: days
+    int32_t tauC;                       // 4: s, *2^-27
+    int32_t tauGps;                     // 8: s, *2^-31
+    int16_t B1;                         // 12: s, *2^-10
+    int16_t B2;                         // 14: s/msd, *2^-16
+    uint8_t reserved0[4];               // 16
+} ubx_mga_glo_timeoffset_t;
+UBX_PAYLOAD_SIZE(ubx_mga_glo_timeoffset_t, 20);
+
+#define UBX_MGA_GLO_TIMEOFFSET(payload)         ((const ubx_mga_glo_timeoffset_t *)(payload))
+#define UBX_MGA_GLO_TIMEOFFSET_SIZE             20
+#define UBX_MGA_GLO_TIMEOFFSET_TYPED(name, ...) UBX_MESSAGE_TYPED(name, 0x13, 0x06, ubx_mga_glo_timeoffset_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-SF-INI sensorFusionData (8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t reserved1[8];               // 0
+} ubx_mga_sf_ini_sensorfusiondata_t;
+UBX_PAYLOAD_SIZE(ubx_mga_sf_ini_sensorfusiondata_t, 8);
+
+// UBX-MGA-SF-INI sensorFusionDataB (8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t reserved2[8];               // 0
+} ubx_mga_sf_ini_sensorfusiondatab_t;
+UBX_PAYLOAD_SIZE(ubx_mga_sf_ini_sensorfusiondatab_t, 8);
+
+// UBX-MGA-SF-INI payload (96 + nValA*8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t nValA;                      // 2
+    uint8_t nValB;                      // 3
+    uint16_t age;                       // 4: s
+    uint8_t reserved0[90];              // 6
+    ubx_mga_sf_ini_sensorfusiondata_t sensorFusionData[];// 96: repeated
+} ubx_mga_sf_ini_t;
+UBX_PAYLOAD_SIZE(ubx_mga_sf_ini_t, 96);
+
+#define UBX_MGA_SF_INI(payload)                 ((const ubx_mga_sf_ini_t *)(payload))
+#define UBX_MGA_SF_INI_SIZE                     96
+#define UBX_MGA_SF_INI_SENSORFUSIONDATA(payload, i)((const ubx_mga_sf_ini_sensorfusiondata_t *)((const uint8_t *)(payload) + 96 + (size_t)(i) * 8))
+#define UBX_MGA_SF_INI_SENSORFUSIONDATA_COUNT(payload, len) \
+    ((size_t)(len) <= 96 ? 0 : (size_t)UBX_MGA_SF_INI(payload)->nValA < ((size_t)(len) - 96) / 8 ? (size_t)UBX_MGA_SF_INI(payload)->nValA : ((size_t)(len) - 96) / 8)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-SF-INI2 payload (464 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t reserved0[462];             // 2
+} ubx_mga_sf_ini2_t;
+UBX_PAYLOAD_SIZE(ubx_mga_sf_ini2_t, 464);
+
+#define UBX_MGA_SF_INI2(payload)                ((const ubx_mga_sf_ini2_t *)(payload))
+#define UBX_MGA_SF_INI2_SIZE                    464
+#define UBX_MGA_SF_INI2_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x13, 0x10, ubx_mga_sf_ini2_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-ANO-DATA0 payload (4 + 4 + 64 + 4 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t svId;                       // 2
+    uint8_t gnssId;                     // 3
+    uint8_t year;                       // 4
+    uint8_t month;                      // 5
+    uint8_t day;                        // 6
+    uint8_t reserved0;                  // 7
+    uint8_t data[64];                   // 8
+    uint8_t reserved1[4];               // 72
+} ubx_mga_ano_data0_t;
+UBX_PAYLOAD_SIZE(ubx_mga_ano_data0_t, 76);
+
+#define UBX_MGA_ANO_DATA0(payload)              ((const ubx_mga_ano_data0_t *)(payload))
+#define UBX_MGA_ANO_DATA0_SIZE                  76
+#define UBX_MGA_ANO_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x13, 0x20, ubx_mga_ano_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-FLASH-DATA group1 (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t data;                       // 0
+} ubx_mga_flash_data_group1_t;
+UBX_PAYLOAD_SIZE(ubx_mga_flash_data_group1_t, 1);
+
+// UBX-MGA-FLASH-DATA payload (6 + size*1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint16_t sequence;                  // 2
+    uint16_t size;                      // 4
+    ubx_mga_flash_data_group1_t group1[];// 6: repeated
+} ubx_mga_flash_data_t;
+UBX_PAYLOAD_SIZE(ubx_mga_flash_data_t, 6);
+
+#define UBX_MGA_FLASH_DATA(payload)             ((const ubx_mga_flash_data_t *)(payload))
+#define UBX_MGA_FLASH_DATA_SIZE                 6
+#define UBX_MGA_FLASH_DATA_GROUP1(payload, i)   ((const ubx_mga_flash_data_group1_t *)((const uint8_t *)(payload) + 6 + (size_t)(i) * 1))
+#define UBX_MGA_FLASH_DATA_GROUP1_COUNT(payload, len) \
+    ((size_t)(len) <= 6 ? 0 : (size_t)UBX_MGA_FLASH_DATA(payload)->size < ((size_t)(len) - 6) / 1 ? (size_t)UBX_MGA_FLASH_DATA(payload)->size : ((size_t)(len) - 6) / 1)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-FLASH-STOP payload (2 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+} ubx_mga_flash_stop_t;
+UBX_PAYLOAD_SIZE(ubx_mga_flash_stop_t, 2);
+
+#define UBX_MGA_FLASH_STOP(payload)             ((const ubx_mga_flash_stop_t *)(payload))
+#define UBX_MGA_FLASH_STOP_SIZE                 2
+#define UBX_MGA_FLASH_STOP_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x13, 0x21, ubx_mga_flash_stop_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-FLASH-ACK payload (6 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t ack;                        // 2
+    uint8_t reserved0;                  // 3
+    uint16_t sequence;                  // 4
+} ubx_mga_flash_ack_t;
+UBX_PAYLOAD_SIZE(ubx_mga_flash_ack_t, 6);
+
+#define UBX_MGA_FLASH_ACK(payload)              ((const ubx_mga_flash_ack_t *)(payload))
+#define UBX_MGA_FLASH_ACK_SIZE                  6
+#define UBX_MGA_FLASH_ACK_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x13, 0x21, ubx_mga_flash_ack_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-INI-POS-XYZ payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t reserved0[2];               // 2
+    int32_t ecefX;                      // 4: cm
+    int32_t ecefY;                      // 8: cm
+    int32_t ecefZ;                      // 12: cm
+    uint32_t posAcc;                    // 16: cm
+} ubx_mga_ini_pos_xyz_t;
+UBX_PAYLOAD_SIZE(ubx_mga_ini_pos_xyz_t, 20);
+
+#define UBX_MGA_INI_POS_XYZ(payload)            ((const ubx_mga_ini_pos_xyz_t *)(payload))
+#define UBX_MGA_INI_POS_XYZ_SIZE                20
+#define UBX_MGA_INI_POS_XYZ_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x13, 0x40, ubx_mga_ini_pos_xyz_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-INI-POS-LLH payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t reserved0[2];               // 2
+    int32_t lat;                        // 4: deg, *1e-7
+    int32_t lon;                        // 8: deg, *1e-7
+    int32_t alt;                        // 12: cm
+    uint32_t posAcc;                    // 16: cm
+} ubx_mga_ini_pos_llh_t;
+UBX_PAYLOAD_SIZE(ubx_mga_ini_pos_llh_t, 20);
+
+#define UBX_MGA_INI_POS_LLH(payload)            ((const ubx_mga_ini_pos_llh_t *)(payload))
+#define UBX_MGA_INI_POS_LLH_SIZE                20
+#define UBX_MGA_INI_POS_LLH_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x13, 0x40, ubx_mga_ini_pos_llh_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-INI-TIME-UTC payload (24 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    union {
+        uint8_t ref;                    // 2
+        struct {
+            uint8_t source : 4;             // bit 0..3
+            uint8_t fall : 1;               // bit 4
+            uint8_t last : 1;               // bit 5
+            uint8_t : 2;
+        };
+    };
+    int8_t leapSecs;                    // 3: s
+    uint16_t year;                      // 4
+    uint8_t month;                      // 6
+    uint8_t day;                        // 7
+    uint8_t hour;                       // 8
+    uint8_t minute;                     // 9
+    uint8_t second;                     // 10: s
+    union {
+        uint8_t bitfield0;              // 11
+        struct {
+            uint8_t trustedSource : 1;      // bit 0
+            uint8_t : 7;
+        };
+    };
+    uint32_t ns;                        // 12: ns
+    uint16_t tAccS;                     // 16: s
+    uint8_t reserved0[2];               // 18
+    uint32_t tAccNs;                    // 20: ns
+} ubx_mga_ini_time_utc_t;
+UBX_PAYLOAD_SIZE(ubx_mga_ini_time_utc_t, 24);
+
+#define UBX_MGA_INI_TIME_UTC(payload)           ((const ubx_mga_ini_time_utc_t *)(payload))
+#define UBX_MGA_INI_TIME_UTC_SIZE               24
+#define UBX_MGA_INI_TIME_UTC_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, 0x13, 0x40, ubx_mga_ini_time_utc_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-INI-TIME-GNSS payload (24 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    union {
+        uint8_t ref;                    // 2
+        struct {
+            uint8_t source : 4;             // bit 0..3
+            uint8_t fall : 1;               // bit 4
+            uint8_t last : 1;               // bit 5
+            uint8_t : 2;
+        };
+    };
+    uint8_t gnssId;                     // 3
+    union {
+        uint8_t bitfield0;              // 4
+        struct {
+            uint8_t trustedSource : 1;      // bit 0
+            uint8_t : 7;
+        };
+    };
+    uint8_t reserved0;                  // 5
+    uint16_t week;                      // 6
+    uint32_t tow;                       // 8: s
+    uint32_t ns;                        // 12: ns
+    uint16_t tAccS;                     // 16: s
+    uint8_t reserved1[2];               // 18
+    uint32_t tAccNs;                    // 20: ns
+} ubx_mga_ini_time_gnss_t;
+UBX_PAYLOAD_SIZE(ubx_mga_ini_time_gnss_t, 24);
+
+#define UBX_MGA_INI_TIME_GNSS(payload)          ((const ubx_mga_ini_time_gnss_t *)(payload))
+#define UBX_MGA_INI_TIME_GNSS_SIZE              24
+#define UBX_MGA_INI_TIME_GNSS_TYPED(name, ...)  UBX_MESSAGE_TYPED(name, 0x13, 0x40, ubx_mga_ini_time_gnss_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-INI-CLKD payload (12 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t reserved0[2];               // 2
+    int32_t clkD;                       // 4: ns/s
+    uint32_t clkDAcc;                   // 8: ns/s
+} ubx_mga_ini_clkd_t;
+UBX_PAYLOAD_SIZE(ubx_mga_ini_clkd_t, 12);
+
+#define UBX_MGA_INI_CLKD(payload)               ((const ubx_mga_ini_clkd_t *)(payload))
+#define UBX_MGA_INI_CLKD_SIZE                   12
+#define UBX_MGA_INI_CLKD_TYPED(name, ...)       UBX_MESSAGE_TYPED(name, 0x13, 0x40, ubx_mga_ini_clkd_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-INI-FREQ payload (12 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t reserved0;                  // 2
+    union {
+        uint8_t flags;                  // 3
+        struct {
+            uint8_t source : 4;             // bit 0..3
+            uint8_t fall : 1;               // bit 4
+            uint8_t : 3;
+        };
+    };
+    int32_t freq;                       // 4: Hz, *1e-2
+    uint32_t freqAcc;                   // 8: ppb
+} ubx_mga_ini_freq_t;
+UBX_PAYLOAD_SIZE(ubx_mga_ini_freq_t, 12);
+
+#define UBX_MGA_INI_FREQ(payload)               ((const ubx_mga_ini_freq_t *)(payload))
+#define UBX_MGA_INI_FREQ_SIZE                   12
+#define UBX_MGA_INI_FREQ_TYPED(name, ...)       UBX_MESSAGE_TYPED(name, 0x13, 0x40, ubx_mga_ini_freq_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-INI-EOP payload (72 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t reserved0[2];               // 2
+    uint16_t d2kRef;                    // 4: d
+    uint16_t d2kMax;                    // 6: d
+    int32_t xpP0;                       // 8: arcsec, *2^-30
+    int32_t xpP1;                       // 12: arcsec/d, *2^-30
+    int32_t ypP0;                       // 16: arcsec, *2^-30
+    int32_t ypP1;                       // 20: arcsec/d, *2^-30
+    int32_t dUT1;                       // 24: s, *2^-25
+    int32_t ddUT1;                      // 28: s/d, *2^-30
+    uint8_t reserved1[40];              // 32
+} ubx_mga_ini_eop_t;
+UBX_PAYLOAD_SIZE(ubx_mga_ini_eop_t, 72);
+
+#define UBX_MGA_INI_EOP(payload)                ((const ubx_mga_ini_eop_t *)(payload))
+#define UBX_MGA_INI_EOP_SIZE                    72
+#define UBX_MGA_INI_EOP_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x13, 0x40, ubx_mga_ini_eop_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-INI-ATT payload (28 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint16_t age;                       // 2: s
+    int32_t roll;                       // 4: deg, *1e-5
+    int32_t pitch;                      // 8: deg, *1e-5
+    int32_t heading;                    // 12: deg, *1e-5
+    uint32_t accRoll;                   // 16: deg, *1e-5
+    uint32_t accPitch;                  // 20: deg, *1e-5
+    uint32_t accHeading;                // 24: deg, *1e-5
+} ubx_mga_ini_att_t;
+UBX_PAYLOAD_SIZE(ubx_mga_ini_att_t, 28);
+
+#define UBX_MGA_INI_ATT(payload)                ((const ubx_mga_ini_att_t *)(payload))
+#define UBX_MGA_INI_ATT_SIZE                    28
+#define UBX_MGA_INI_ATT_TYPED(name, ...)        UBX_MESSAGE_TYPED(name, 0x13, 0x40, ubx_mga_ini_att_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-ACK-DATA0 payload (8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t type;                       // 0
+    uint8_t version;                    // 1
+    uint8_t infoCode;                   // 2
+    uint8_t msgId;                      // 3
+    uint8_t msgPayloadStart[4];         // 4
+} ubx_mga_ack_data0_t;
+UBX_PAYLOAD_SIZE(ubx_mga_ack_data0_t, 8);
+
+#define UBX_MGA_ACK_DATA0(payload)              ((const ubx_mga_ack_data0_t *)(payload))
+#define UBX_MGA_ACK_DATA0_SIZE                  8
+#define UBX_MGA_ACK_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x13, 0x60, ubx_mga_ack_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-DBD-POLL payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_mga_dbd_poll_t;
+UBX_PAYLOAD_SIZE(ubx_mga_dbd_poll_t, 0);
+
+#define UBX_MGA_DBD_POLL(payload)               ((const ubx_mga_dbd_poll_t *)(payload))
+#define UBX_MGA_DBD_POLL_SIZE                   0
+#define UBX_MGA_DBD_POLL_TYPED(name, ...)       UBX_MESSAGE_TYPED(name, 0x13, 0x80, ubx_mga_dbd_poll_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-MGA-DBD-DATA0 group1 (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t data;                       // 0
+} ubx_mga_dbd_data0_group1_t;
+UBX_PAYLOAD_SIZE(ubx_mga_dbd_data0_group1_t, 1);
+
+// UBX-MGA-DBD-DATA0 payload (12 + n*1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t reserved0[12];              // 0
+    ubx_mga_dbd_data0_group1_t group1[];// 12: repeated
+} ubx_mga_dbd_data0_t;
+UBX_PAYLOAD_SIZE(ubx_mga_dbd_data0_t, 12);
+
+#define UBX_MGA_DBD_DATA0(payload)              ((const ubx_mga_dbd_data0_t *)(payload))
+#define UBX_MGA_DBD_DATA0_SIZE                  12
+#define UBX_MGA_DBD_DATA0_GROUP1(payload, i)    ((const ubx_mga_dbd_data0_group1_t *)((const uint8_t *)(payload) + 12 + (size_t)(i) * 1))
+#define UBX_MGA_DBD_DATA0_GROUP1_COUNT(payload, len)((size_t)(len) > 12 ? ((size_t)(len) - 12) / 1 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-LOG-ERASE-DATA0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_log_erase_data0_t;
+UBX_PAYLOAD_SIZE(ubx_log_erase_data0_t, 0);
+
+#define UBX_LOG_ERASE_DATA0(payload)            ((const ubx_log_erase_data0_t *)(payload))
+#define UBX_LOG_ERASE_DATA0_SIZE                0
+#define UBX_LOG_ERASE_DATA0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x21, 0x03, ubx_log_erase_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-LOG-STRING-DATA0 group0 (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t bytes;                      // 0
+} ubx_log_string_data0_group0_t;
+UBX_PAYLOAD_SIZE(ubx_log_string_data0_group0_t, 1);
+
+// UBX-LOG-STRING-DATA0 payload (n*1 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_log_string_data0_t;
+UBX_PAYLOAD_SIZE(ubx_log_string_data0_t, 0);
+
+#define UBX_LOG_STRING_DATA0(payload)           ((const ubx_log_string_data0_t *)(payload))
+#define UBX_LOG_STRING_DATA0_SIZE               0
+#define UBX_LOG_STRING_DATA0_GROUP0(payload, i) ((const ubx_log_string_data0_group0_t *)((const uint8_t *)(payload) + 0 + (size_t)(i) * 1))
+#define UBX_LOG_STRING_DATA0_GROUP0_COUNT(payload, len)((size_t)(len) > 0 ? ((size_t)(len) - 0) / 1 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-LOG-CREATE-CREATE0 payload (8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    union {
+        uint8_t logCfg;                 // 1
+        struct {
+            uint8_t circular : 1;           // bit 0
+            uint8_t : 7;
+        };
+    };
+    uint8_t reserved0;                  // 2
+    uint8_t logSize;                    // 3
+    uint32_t userDefinedSize;           // 4: bytes
+} ubx_log_create_create0_t;
+UBX_PAYLOAD_SIZE(ubx_log_create_create0_t, 8);
+
+#define UBX_LOG_CREATE_CREATE0(payload)         ((const ubx_log_create_create0_t *)(payload))
+#define UBX_LOG_CREATE_CREATE0_SIZE             8
+#define UBX_LOG_CREATE_CREATE0_TYPED(name, ...) UBX_MESSAGE_TYPED(name, 0x21, 0x07, ubx_log_create_create0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-LOG-INFO-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_log_info_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_log_info_poll0_t, 0);
+
+#define UBX_LOG_INFO_POLL0(payload)             ((const ubx_log_info_poll0_t *)(payload))
+#define UBX_LOG_INFO_POLL0_SIZE                 0
+#define UBX_LOG_INFO_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x21, 0x08, ubx_log_info_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-LOG-INFO-DATA0 payload (48 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0[3];               // 1
+    uint32_t filestoreCapacity;         // 4: bytes
+    uint8_t reserved1[8];               // 8
+    uint32_t currentMaxLogSize;         // 16: bytes
+    uint32_t currentLogSize;            // 20: bytes
+    uint32_t entryCount;                // 24
+    uint16_t oldestYear;                // 28
+    uint8_t oldestMonth;                // 30
+    uint8_t oldestDay;                  // 31
+    uint8_t oldestHour;                 // 32
+    uint8_t oldestMinute;               // 33
+    uint8_t oldestSecond;               // 34
+    uint8_t reserved2;                  // 35
+    uint16_t newestYear;                // 36
+    uint8_t newestMonth;                // 38
+    uint8_t newestDay;                  // 39
+    uint8_t newestHour;                 // 40
+    uint8_t newestMinute;               // 41
+    uint8_t newestSecond;               // 42
+    uint8_t reserved3;                  // 43
+    union {
+        uint8_t status;                 // 44
+        struct {
+            uint8_t : 3;
+            uint8_t recording : 1;          // bit 3
+            uint8_t inactive : 1;           // bit 4
+            uint8_t circular : 1;           // bit 5
+            uint8_t : 2;
+        };
+    };
+    uint8_t reserved4[3];               // 45
+} ubx_log_info_data0_t;
+UBX_PAYLOAD_SIZE(ubx_log_info_data0_t, 48);
+
+#define UBX_LOG_INFO_DATA0(payload)             ((const ubx_log_info_data0_t *)(payload))
+#define UBX_LOG_INFO_DATA0_SIZE                 48
+#define UBX_LOG_INFO_DATA0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x21, 0x08, ubx_log_info_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-LOG-RETRIEVE-REQ0 payload (12 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t startNumber;               // 0
+    uint32_t entryCount;                // 4
+    uint8_t version;                    // 8
+    uint8_t reserved0[3];               // 9
+} ubx_log_retrieve_req0_t;
+UBX_PAYLOAD_SIZE(ubx_log_retrieve_req0_t, 12);
+
+#define UBX_LOG_RETRIEVE_REQ0(payload)          ((const ubx_log_retrieve_req0_t *)(payload))
+#define UBX_LOG_RETRIEVE_REQ0_SIZE              12
+#define UBX_LOG_RETRIEVE_REQ0_TYPED(name, ...)  UBX_MESSAGE_TYPED(name, 0x21, 0x09, ubx_log_retrieve_req0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-LOG-RETRIEVEPOS-POS0 payload (40 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t entryIndex;                // 0
+    int32_t lon;                        // 4: deg, *1e-7
+    int32_t lat;                        // 8: deg, *1e-7
+    int32_t hMSL;                       // 12: mm
+    uint32_t hAcc;                      // 16: mm
+    uint32_t gSpeed;                    // 20: mm/s
+    uint32_t heading;                   // 24: deg, *1e-5
+    uint8_t version;                    // 28
+    uint8_t fixType;                    // 29
+    uint16_t year;                      // 30
+    uint8_t month;                      // 32
+    uint8_t day;                        // 33
+    uint8_t hour;                       // 34
+    uint8_t minute;                     // 35
+    uint8_t second;                     // 36
+    uint8_t reserved0;                  // 37
+    uint8_t numSV;                      // 38
+    uint8_t reserved1;                  // 39
+} ubx_log_retrievepos_pos0_t;
+UBX_PAYLOAD_SIZE(ubx_log_retrievepos_pos0_t, 40);
+
+#define UBX_LOG_RETRIEVEPOS_POS0(payload)       ((const ubx_log_retrievepos_pos0_t *)(payload))
+#define UBX_LOG_RETRIEVEPOS_POS0_SIZE           40
+#define UBX_LOG_RETRIEVEPOS_POS0_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x21, 0x0B, ubx_log_retrievepos_pos0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-LOG-RETRIEVESTRING-STRING0 group1 (1 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t bytes;                      // 0
+} ubx_log_retrievestring_string0_group1_t;
+UBX_PAYLOAD_SIZE(ubx_log_retrievestring_string0_group1_t, 1);
+
+// UBX-LOG-RETRIEVESTRING-STRING0 payload (16 + byteCount*1 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t entryIndex;                // 0
+    uint8_t version;                    // 4
+    uint8_t reserved0;                  // 5
+    uint16_t year;                      // 6
+    uint8_t month;                      // 8
+    uint8_t day;                        // 9
+    uint8_t hour;                       // 10
+    uint8_t minute;                     // 11
+    uint8_t second;                     // 12
+    uint8_t reserved1;                  // 13
+    uint16_t byteCount;                 // 14
+    ubx_log_retrievestring_string0_group1_t group1[];// 16: repeated
+} ubx_log_retrievestring_string0_t;
+UBX_PAYLOAD_SIZE(ubx_log_retrievestring_string0_t, 16);
+
+#define UBX_LOG_RETRIEVESTRING_STRING0(payload) ((const ubx_log_retrievestring_string0_t *)(payload))
+#define UBX_LOG_RETRIEVESTRING_STRING0_SIZE     16
+#define UBX_LOG_RETRIEVESTRING_STRING0_GROUP1(payload, i)((const ubx_log_retrievestring_string0_group1_t *)((const uint8_t *)(payload) + 16 + (size_t)(i) * 1))
+#define UBX_LOG_RETRIEVESTRING_STRING0_GROUP1_COUNT(payload, len) \
+    ((size_t)(len) <= 16 ? 0 : (size_t)UBX_LOG_RETRIEVESTRING_STRING0(payload)->byteCount < ((size_t)(len) - 16) / 1 ? (size_t)UBX_LOG_RETRIEVESTRING_STRING0(payload)->byteCount : ((size_t)(len) - 16) / 1)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-LOG-FINDTIME-REQUEST payload (10 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t type;                       // 1
+    uint16_t year;                      // 2
+    uint8_t month;                      // 4
+    uint8_t day;                        // 5
+    uint8_t hour;                       // 6
+    uint8_t minute;                     // 7
+    uint8_t second;                     // 8
+    uint8_t reserved0;                  // 9
+} ubx_log_findtime_request_t;
+UBX_PAYLOAD_SIZE(ubx_log_findtime_request_t, 10);
+
+#define UBX_LOG_FINDTIME_REQUEST(payload)       ((const ubx_log_findtime_request_t *)(payload))
+#define UBX_LOG_FINDTIME_REQUEST_SIZE           10
+#define UBX_LOG_FINDTIME_REQUEST_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x21, 0x0E, ubx_log_findtime_request_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-LOG-FINDTIME-RESPONSE payload (8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t type;                       // 1
+    uint8_t reserved0[2];               // 2
+    uint32_t entryNumber;               // 4
+} ubx_log_findtime_response_t;
+UBX_PAYLOAD_SIZE(ubx_log_findtime_response_t, 8);
+
+#define UBX_LOG_FINDTIME_RESPONSE(payload)      ((const ubx_log_findtime_response_t *)(payload))
+#define UBX_LOG_FINDTIME_RESPONSE_SIZE          8
+#define UBX_LOG_FINDTIME_RESPONSE_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x21, 0x0E, ubx_log_findtime_response_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-LOG-RETRIEVEPOSEXTRA-ODOMETER0 payload (32 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t entryIndex;                // 0
+    uint8_t version;                    // 4
+    uint8_t reserved0;                  // 5
+    uint16_t year;                      // 6
+    uint8_t month;                      // 8
+    uint8_t day;                        // 9
+    uint8_t hour;                       // 10
+    uint8_t minute;                     // 11
+    uint8_t second;                     // 12
+    uint8_t reserved1[3];               // 13
+    uint32_t distance;                  // 16
+    uint8_t reserved2[12];              // 20
+} ubx_log_retrieveposextra_odometer0_t;
+UBX_PAYLOAD_SIZE(ubx_log_retrieveposextra_odometer0_t, 32);
+
+#define UBX_LOG_RETRIEVEPOSEXTRA_ODOMETER0(payload)((const ubx_log_retrieveposextra_odometer0_t *)(payload))
+#define UBX_LOG_RETRIEVEPOSEXTRA_ODOMETER0_SIZE 32
+#define UBX_LOG_RETRIEVEPOSEXTRA_ODOMETER0_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x21, 0x0F, ubx_log_retrieveposextra_odometer0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-LOG-RETRIEVEBATCH-REQ0 payload (4 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    union {
+        uint8_t flags;                  // 1
+        struct {
+            uint8_t sendMonFirst : 1;       // bit 0
+            uint8_t : 7;
+        };
+    };
+    uint8_t reserved0[2];               // 2
+} ubx_log_retrievebatch_req0_t;
+UBX_PAYLOAD_SIZE(ubx_log_retrievebatch_req0_t, 4);
+
+#define UBX_LOG_RETRIEVEBATCH_REQ0(payload)     ((const ubx_log_retrievebatch_req0_t *)(payload))
+#define UBX_LOG_RETRIEVEBATCH_REQ0_SIZE         4
+#define UBX_LOG_RETRIEVEBATCH_REQ0_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x21, 0x10, ubx_log_retrievebatch_req0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-LOG-BATCH-DATA0 payload (100 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    union {
+        uint8_t contentValid;           // 1
+        struct {
+            uint8_t extraPvt : 1;           // bit 0
+            uint8_t extraOdo : 1;           // bit 1
+            uint8_t : 6;
+        };
+    };
+    uint16_t msgCnt;                    // 2
+    uint32_t iTOW;                      // 4: ms
+    uint16_t year;                      // 8: y
+    uint8_t month;                      // 10: month
+    uint8_t day;                        // 11: d
+    uint8_t hour;                       // 12: h
+    uint8_t min;                        // 13: min
+    uint8_t sec;                        // 14: s
+    union {
+        uint8_t valid;                  // 15
+        struct {
+            uint8_t validDate : 1;          // bit 0
+            uint8_t validTime : 1;          // bit 1
+            uint8_t : 6;
+        };
+    };
+    uint32_t tAcc;                      // 16: ns
+    int32_t fracSec;                    // 20: ns
+    uint8_t fixType;                    // 24
+    union {
+        uint8_t flags;                  // 25
+        struct {
+            uint8_t gnssFixOK : 1;          // bit 0
+            uint8_t diffSoln : 1;           // bit 1
+            uint8_t psmState : 3;           // bit 2..4
+            uint8_t : 3;
+        };
+    };
+    uint8_t flags2;                     // 26
+    uint8_t numSV;                      // 27
+    int32_t lon;                        // 28: deg, *1e-7
+    int32_t lat;                        // 32: deg, *1e-7
+    int32_t height;                     // 36: mm
+    int32_t hMSL;                       // 40: mm
+    uint32_t hAcc;                      // 44: mm
+    uint32_t vAcc;                      // 48: mm
+    int32_t velN;                       // 52: mm/s
+    int32_t velE;                       // 56: mm/s
+    int32_t velD;                       // 60: mm/s
+    int32_t gSpeed;                     // 64: mm/s
+    int32_t headMot;                    // 68: deg, *1e-5
+    uint32_t sAcc;                      // 72: mm/s
+    uint32_t headAcc;                   // 76: deg, *1e-5
+    uint16_t pDOP;                      // 80: *0.01
+    uint8_t reserved0[2];               // 82
+    uint32_t distance;                  // 84: m
+    uint32_t totalDistance;             // 88: m
+    uint32_t distanceStd;               // 92: m
+    uint8_t reserved1[4];               // 96
+} ubx_log_batch_data0_t;
+UBX_PAYLOAD_SIZE(ubx_log_batch_data0_t, 100);
+
+#define UBX_LOG_BATCH_DATA0(payload)            ((const ubx_log_batch_data0_t *)(payload))
+#define UBX_LOG_BATCH_DATA0_SIZE                100
+#define UBX_LOG_BATCH_DATA0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x21, 0x11, ubx_log_batch_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-SEC-UNIQID-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_sec_uniqid_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_sec_uniqid_poll0_t, 0);
+
+#define UBX_SEC_UNIQID_POLL0(payload)           ((const ubx_sec_uniqid_poll0_t *)(payload))
+#define UBX_SEC_UNIQID_POLL0_SIZE               0
+#define UBX_SEC_UNIQID_POLL0_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, 0x27, 0x03, ubx_sec_uniqid_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-SEC-UNIQID-DATA0 payload (9 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0[3];               // 1
+    uint8_t uniqueId[5];                // 4
+} ubx_sec_uniqid_data0_t;
+UBX_PAYLOAD_SIZE(ubx_sec_uniqid_data0_t, 9);
+
+#define UBX_SEC_UNIQID_DATA0(payload)           ((const ubx_sec_uniqid_data0_t *)(payload))
+#define UBX_SEC_UNIQID_DATA0_SIZE               9
+#define UBX_SEC_UNIQID_DATA0_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, 0x27, 0x03, ubx_sec_uniqid_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-SEC-UNIQID-DATA1 payload (10 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0[3];               // 1
+    uint8_t uniqueId[6];                // 4
+} ubx_sec_uniqid_data1_t;
+UBX_PAYLOAD_SIZE(ubx_sec_uniqid_data1_t, 10);
+
+#define UBX_SEC_UNIQID_DATA1(payload)           ((const ubx_sec_uniqid_data1_t *)(payload))
+#define UBX_SEC_UNIQID_DATA1_SIZE               10
+#define UBX_SEC_UNIQID_DATA1_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, 0x27, 0x03, ubx_sec_uniqid_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-SEC-SIG-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_sec_sig_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_sec_sig_poll0_t, 0);
+
+#define UBX_SEC_SIG_POLL0(payload)              ((const ubx_sec_sig_poll0_t *)(payload))
+#define UBX_SEC_SIG_POLL0_SIZE                  0
+#define UBX_SEC_SIG_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x27, 0x09, ubx_sec_sig_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-SEC-SIG-DATA0 payload (12 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0[3];               // 1
+    union {
+        uint8_t jamFlags;               // 4
+        struct {
+            uint8_t jamDetEnabled : 1;      // bit 0
+            uint8_t jammingState : 2;       // bit 1..2
+            uint8_t : 5;
+        };
+    };
+    uint8_t reserved1[3];               // 5
+    union {
+        uint8_t spfFlags;               // 8
+        struct {
+            uint8_t spfDetEnabled : 1;      // bit 0
+            uint8_t spoofingState : 3;      // bit 1..3
+            uint8_t : 4;
+        };
+    };
+    uint8_t reserved2[3];               // 9
+} ubx_sec_sig_data0_t;
+UBX_PAYLOAD_SIZE(ubx_sec_sig_data0_t, 12);
+
+#define UBX_SEC_SIG_DATA0(payload)              ((const ubx_sec_sig_data0_t *)(payload))
+#define UBX_SEC_SIG_DATA0_SIZE                  12
+#define UBX_SEC_SIG_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x27, 0x09, ubx_sec_sig_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-SEC-SIG-DATA1 jamPerCentFreq (4 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint32_t jamStateCentFreq;      // 0
+        struct {
+            uint32_t centFreq : 24;         // bit 0..23
+            uint32_t jammed : 1;            // bit 24
+            uint32_t : 7;
+        };
+    };
+} ubx_sec_sig_data1_jampercentfreq_t;
+UBX_PAYLOAD_SIZE(ubx_sec_sig_data1_jampercentfreq_t, 4);
+
+// UBX-SEC-SIG-DATA1 payload (4 + jamNumCentFreqs*4 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    union {
+        uint8_t sigSecFlags;            // 1
+        struct {
+            uint8_t jamDetEnabled : 1;      // bit 0
+            uint8_t jamState : 2;           // bit 1..2
+            uint8_t spfDetEnabled : 1;      // bit 3
+            uint8_t spfState : 3;           // bit 4..6
+            uint8_t : 1;
+        };
+    };
+    uint8_t reserved0;                  // 2
+    uint8_t jamNumCentFreqs;            // 3
+    ubx_sec_sig_data1_jampercentfreq_t jamPerCentFreq[];// 4: repeated
+} ubx_sec_sig_data1_t;
+UBX_PAYLOAD_SIZE(ubx_sec_sig_data1_t, 4);
+
+#define UBX_SEC_SIG_DATA1(payload)              ((const ubx_sec_sig_data1_t *)(payload))
+#define UBX_SEC_SIG_DATA1_SIZE                  4
+#define UBX_SEC_SIG_DATA1_JAMPERCENTFREQ(payload, i)((const ubx_sec_sig_data1_jampercentfreq_t *)((const uint8_t *)(payload) + 4 + (size_t)(i) * 4))
+#define UBX_SEC_SIG_DATA1_JAMPERCENTFREQ_COUNT(payload, len) \
+    ((size_t)(len) <= 4 ? 0 : (size_t)UBX_SEC_SIG_DATA1(payload)->jamNumCentFreqs < ((size_t)(len) - 4) / 4 ? (size_t)UBX_SEC_SIG_DATA1(payload)->jamNumCentFreqs : ((size_t)(len) - 4) / 4)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-SEC-OSNMA-DATA0 authPerSV (4 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint16_t bitfield1;             // 0
+        struct {
+            uint16_t IODE : 10;             // bit 0..9
+            uint16_t authNum : 5;           // bit 10..14
+            uint16_t authStatus : 1;        // bit 15
+        };
+    };
+    uint8_t svId;                       // 2
+    uint8_t reserved1;                  // 3
+} ubx_sec_osnma_data0_authpersv_t;
+UBX_PAYLOAD_SIZE(ubx_sec_osnma_data0_authpersv_t, 4);
+
+// UBX-SEC-OSNMA-DATA0 payload (24 + authSVs*4 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    union {
+        uint8_t nmaHeader;              // 1
+        struct {
+            uint8_t headerAuthStatus : 1;   // bit 0
+            uint8_t nmaStatus : 2;          // bit 1..2
+            uint8_t chainInForce : 2;       // bit 3..4
+            uint8_t CPKS : 3;               // bit 5..7
+        };
+    };
+    union {
+        uint8_t osnmaMonitoring;        // 2
+        struct {
+            uint8_t osnmaEnabled : 1;       // bit 0
+            uint8_t numberSVs : 5;          // bit 1..5
+            uint8_t nmaHeaderUpdate : 2;    // bit 6..7
+        };
+    };
+    union {
+        uint8_t timSyncReq;             // 3
+        struct {
+            uint8_t timSyncEnabled : 1;     // bit 0
+            uint8_t timSyncStatus : 3;      // bit 1..3
+            uint8_t : 4;
+        };
+    };
+    int32_t timSyncReqDiff;             // 4: ms
+    uint8_t reserved0[4];               // 8
+    union {
+        uint32_t dsmAuthentication;     // 12
+        struct {
+            uint32_t dsmAuthenticationStatus : 6;// bit 0..5
+            uint32_t hashFunction : 2;      // bit 6..7
+            uint32_t macFunction : 2;       // bit 8..9
+            uint32_t pubKeyId : 4;          // bit 10..13
+            uint32_t macLookupTable : 8;    // bit 14..21
+            uint32_t keySize : 4;           // bit 22..25
+            uint32_t macSize : 4;           // bit 26..29
+            uint32_t fromNVS : 1;           // bit 30
+            uint32_t : 1;
+        };
+    };
+    union {
+        uint32_t teslaKey;              // 16
+        struct {
+            uint32_t teslaKeyAuthStatus : 3;// bit 0..2
+            uint32_t wnSf : 12;             // bit 3..14
+            uint32_t towSf : 15;            // bit 15..29
+            uint32_t chainId : 2;           // bit 30..31
+        };
+    };
+    union {
+        uint32_t generalAndTiming;      // 20
+        struct {
+            uint32_t authSVs : 6;           // bit 0..5
+            uint32_t authNumTim : 6;        // bit 6..11
+            uint32_t timingAuthResult : 2;  // bit 12..13
+            uint32_t macAdkdType : 1;       // bit 14
+            uint32_t pubKeySrc : 2;         // bit 15..16
+            uint32_t : 15;
+        };
+    };
+    ubx_sec_osnma_data0_authpersv_t authPerSV[];// 24: repeated
+} ubx_sec_osnma_data0_t;
+UBX_PAYLOAD_SIZE(ubx_sec_osnma_data0_t, 24);
+
+#define UBX_SEC_OSNMA_DATA0(payload)            ((const ubx_sec_osnma_data0_t *)(payload))
+#define UBX_SEC_OSNMA_DATA0_SIZE                24
+#define UBX_SEC_OSNMA_DATA0_AUTHPERSV(payload, i)((const ubx_sec_osnma_data0_authpersv_t *)((const uint8_t *)(payload) + 24 + (size_t)(i) * 4))
+#define UBX_SEC_OSNMA_DATA0_AUTHPERSV_COUNT(payload, len)((size_t)(len) > 24 ? ((size_t)(len) - 24) / 4 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-SEC-OSNMA-DATA1 authPerSV (4 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint16_t bitfield1;             // 0
+        struct {
+            uint16_t IODE : 10;             // bit 0..9
+            uint16_t authNum : 5;           // bit 10..14
+            uint16_t authStatus : 1;        // bit 15
+        };
+    };
+    uint8_t svId;                       // 2
+    uint8_t reserved1;                  // 3
+} ubx_sec_osnma_data1_authpersv_t;
+UBX_PAYLOAD_SIZE(ubx_sec_osnma_data1_authpersv_t, 4);
+
+// UBX-SEC-OSNMA-DATA1 payload (24 + authSVs*4 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    union {
+        uint8_t nmaHeader;              // 1
+        struct {
+            uint8_t headerAuthStatus : 1;   // bit 0
+            uint8_t nmaStatus : 2;          // bit 1..2
+            uint8_t chainInForce : 2;       // bit 3..4
+            uint8_t CPKS : 3;               // bit 5..7
+        };
+    };
+    union {
+        uint8_t osnmaMonitoring;        // 2
+        struct {
+            uint8_t osnmaEnabled : 1;       // bit 0
+            uint8_t numberSVs : 5;          // bit 1..5
+            uint8_t nmaHeaderUpdate : 2;    // bit 6..7
+        };
+    };
+    union {
+        uint8_t timSyncReq;             // 3
+        struct {
+            uint8_t timSyncEnabled : 1;     // bit 0
+            uint8_t timSyncStatus : 3;      // bit 1..3
+            uint8_t : 4;
+        };
+    };
+    int32_t timSyncReqDiff;             // 4: ms
+    uint8_t reserved0[4];               // 8
+    union {
+        uint32_t dsmAuthentication;     // 12
+        struct {
+            uint32_t dsmAuthenticationStatus : 6;// bit 0..5
+            uint32_t hashFunction : 2;      // bit 6..7
+            uint32_t macFunction : 2;       // bit 8..9
+            uint32_t pubKeyId : 4;          // bit 10..13
+            uint32_t macLookupTable : 8;    // bit 14..21
+            uint32_t keySize : 4;           // bit 22..25
+            uint32_t macSize : 4;           // bit 26..29
+            uint32_t fromNVS : 1;           // bit 30
+            uint32_t : 1;
+        };
+    };
+    union {
+        uint32_t teslaKey;              // 16
+        struct {
+            uint32_t teslaKeyAuthStatus : 3;// bit 0..2
+            uint32_t wnSf : 12;             // bit 3..14
+            uint32_t towSf : 15;            // bit 15..29
+            uint32_t chainId : 2;           // bit 30..31
+        };
+    };
+    union {
+        uint32_t generalAndTiming;      // 20
+        struct {
+            uint32_t authSVs : 6;           // bit 0..5
+            uint32_t authNumTim : 6;        // bit 6..11
+            uint32_t timingAuthResult : 2;  // bit 12..13
+            uint32_t macAdkdType : 1;       // bit 14
+            uint32_t pubKeySrc : 2;         // bit 15..16
+            uint32_t merkleRootSrc : 2;     // bit 17..18
+            uint32_t merkleRootVal : 1;     // bit 19
+            uint32_t futureMerkleRootSrc : 2;// bit 20..21
+            uint32_t futureMerkleRootVal : 1;// bit 22
+            uint32_t pubKeyVal : 1;         // bit 23
+            uint32_t futurePubKeyVal : 1;   // bit 24
+            uint32_t futurePubKeySrc : 2;   // bit 25..26
+            uint32_t futurePubKeyId : 4;    // bit 27..30
+            uint32_t : 1;
+        };
+    };
+    ubx_sec_osnma_data1_authpersv_t authPerSV[];// 24: repeated
+} ubx_sec_osnma_data1_t;
+UBX_PAYLOAD_SIZE(ubx_sec_osnma_data1_t, 24);
+
+#define UBX_SEC_OSNMA_DATA1(payload)            ((const ubx_sec_osnma_data1_t *)(payload))
+#define UBX_SEC_OSNMA_DATA1_SIZE                24
+#define UBX_SEC_OSNMA_DATA1_AUTHPERSV(payload, i)((const ubx_sec_osnma_data1_authpersv_t *)((const uint8_t *)(payload) + 24 + (size_t)(i) * 4))
+#define UBX_SEC_OSNMA_DATA1_AUTHPERSV_COUNT(payload, len)((size_t)(len) > 24 ? ((size_t)(len) - 24) / 4 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-SEC-OSNMA-DATA2 authPerSV (4 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint16_t bitfield1;             // 0
+        struct {
+            uint16_t IODE : 10;             // bit 0..9
+            uint16_t authNum : 5;           // bit 10..14
+            uint16_t authStatus : 1;        // bit 15
+        };
+    };
+    uint8_t svId;                       // 2
+    uint8_t reserved2;                  // 3
+} ubx_sec_osnma_data2_authpersv_t;
+UBX_PAYLOAD_SIZE(ubx_sec_osnma_data2_authpersv_t, 4);
+
+// UBX-SEC-OSNMA-DATA2 payload (28 + authSVs*4 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    union {
+        uint8_t nmaHeader;              // 1
+        struct {
+            uint8_t headerAuthStatus : 1;   // bit 0
+            uint8_t nmaStatus : 2;          // bit 1..2
+            uint8_t chainInForce : 2;       // bit 3..4
+            uint8_t CPKS : 3;               // bit 5..7
+        };
+    };
+    union {
+        uint16_t osnmaMonitoring;       // 2
+        struct {
+            uint16_t osnmaEnabled : 1;      // bit 0
+            uint16_t numberSVs : 5;         // bit 1..5
+            uint16_t nmaHeaderUpdate : 2;   // bit 6..7
+            uint16_t noData : 1;            // bit 8
+            uint16_t wrongData : 1;         // bit 9
+            uint16_t wrongFlxMac : 1;       // bit 10
+            uint16_t wrongMaclt : 1;        // bit 11
+            uint16_t : 4;
+        };
+    };
+    union {
+        uint8_t timSyncReq;             // 4
+        struct {
+            uint8_t timSyncEnabled : 1;     // bit 0
+            uint8_t timSyncStatus : 3;      // bit 1..3
+            uint8_t : 4;
+        };
+    };
+    uint8_t reserved0[3];               // 5
+    int32_t timSyncReqDiff;             // 8: ms
+    uint8_t reserved1[4];               // 12
+    union {
+        uint32_t dsmAuthentication;     // 16
+        struct {
+            uint32_t dsmAuthenticationStatus : 6;// bit 0..5
+            uint32_t hashFunction : 2;      // bit 6..7
+            uint32_t macFunction : 2;       // bit 8..9
+            uint32_t pubKeyId : 4;          // bit 10..13
+            uint32_t macLookupTable : 8;    // bit 14..21
+            uint32_t keySize : 4;           // bit 22..25
+            uint32_t macSize : 4;           // bit 26..29
+            uint32_t fromNVS : 1;           // bit 30
+            uint32_t : 1;
+        };
+    };
+    union {
+        uint32_t teslaKey;              // 20
+        struct {
+            uint32_t teslaKeyAuthStatus : 3;// bit 0..2
+            uint32_t wnSf : 12;             // bit 3..14
+            uint32_t towSf : 15;            // bit 15..29
+            uint32_t chainId : 2;           // bit 30..31
+        };
+    };
+    union {
+        uint32_t generalAndTiming;      // 24
+        struct {
+            uint32_t authSVs : 6;           // bit 0..5
+            uint32_t authNumTim : 6;        // bit 6..11
+            uint32_t timingAuthResult : 2;  // bit 12..13
+            uint32_t macAdkdType : 1;       // bit 14
+            uint32_t pubKeySrc : 2;         // bit 15..16
+            uint32_t merkleRootSrc : 2;     // bit 17..18
+            uint32_t merkleRootVal : 1;     // bit 19
+            uint32_t futureMerkleRootSrc : 2;// bit 20..21
+            uint32_t futureMerkleRootVal : 1;// bit 22
+            uint32_t pubKeyVal : 1;         // bit 23
+            uint32_t futurePubKeyVal : 1;   // bit 24
+            uint32_t futurePubKeySrc : 2;   // bit 25..26
+            uint32_t futurePubKeyId : 4;    // bit 27..30
+            uint32_t : 1;
+        };
+    };
+    ubx_sec_osnma_data2_authpersv_t authPerSV[];// 28: repeated
+} ubx_sec_osnma_data2_t;
+UBX_PAYLOAD_SIZE(ubx_sec_osnma_data2_t, 28);
+
+#define UBX_SEC_OSNMA_DATA2(payload)            ((const ubx_sec_osnma_data2_t *)(payload))
+#define UBX_SEC_OSNMA_DATA2_SIZE                28
+#define UBX_SEC_OSNMA_DATA2_AUTHPERSV(payload, i)((const ubx_sec_osnma_data2_authpersv_t *)((const uint8_t *)(payload) + 28 + (size_t)(i) * 4))
+#define UBX_SEC_OSNMA_DATA2_AUTHPERSV_COUNT(payload, len)((size_t)(len) > 28 ? ((size_t)(len) - 28) / 4 : 0)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-SEC-SIGLOG-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_sec_siglog_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_sec_siglog_poll0_t, 0);
+
+#define UBX_SEC_SIGLOG_POLL0(payload)           ((const ubx_sec_siglog_poll0_t *)(payload))
+#define UBX_SEC_SIGLOG_POLL0_SIZE               0
+#define UBX_SEC_SIGLOG_POLL0_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, 0x27, 0x10, ubx_sec_siglog_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-SEC-SIGLOG-DATA0 events (8 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t timeElapsed;               // 0: s
+    uint8_t detectionType;              // 4
+    uint8_t eventType;                  // 5
+    uint8_t reserved1[2];               // 6
+} ubx_sec_siglog_data0_events_t;
+UBX_PAYLOAD_SIZE(ubx_sec_siglog_data0_events_t, 8);
+
+// UBX-SEC-SIGLOG-DATA0 payload (8 + numEvents*8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t numEvents;                  // 1
+    uint8_t reserved0[6];               // 2
+    ubx_sec_siglog_data0_events_t events[];// 8: repeated
+} ubx_sec_siglog_data0_t;
+UBX_PAYLOAD_SIZE(ubx_sec_siglog_data0_t, 8);
+
+#define UBX_SEC_SIGLOG_DATA0(payload)           ((const ubx_sec_siglog_data0_t *)(payload))
+#define UBX_SEC_SIGLOG_DATA0_SIZE               8
+#define UBX_SEC_SIGLOG_DATA0_EVENTS(payload, i) ((const ubx_sec_siglog_data0_events_t *)((const uint8_t *)(payload) + 8 + (size_t)(i) * 8))
+#define UBX_SEC_SIGLOG_DATA0_EVENTS_COUNT(payload, len) \
+    ((size_t)(len) <= 8 ? 0 : (size_t)UBX_SEC_SIGLOG_DATA0(payload)->numEvents < ((size_t)(len) - 8) / 8 ? (size_t)UBX_SEC_SIGLOG_DATA0(payload)->numEvents : ((size_t)(len) - 8) / 8)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-SEC-SIGLOG-DATA1 events (8 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t timeElapsed;               // 0: s
+    uint8_t detectionType;              // 4
+    uint8_t eventType;                  // 5
+    uint8_t reserved1[2];               // 6
+} ubx_sec_siglog_data1_events_t;
+UBX_PAYLOAD_SIZE(ubx_sec_siglog_data1_events_t, 8);
+
+// UBX-SEC-SIGLOG-DATA1 payload (8 + numEvents*8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t numEvents;                  // 1
+    uint8_t reserved0[6];               // 2
+    ubx_sec_siglog_data1_events_t events[];// 8: repeated
+} ubx_sec_siglog_data1_t;
+UBX_PAYLOAD_SIZE(ubx_sec_siglog_data1_t, 8);
+
+#define UBX_SEC_SIGLOG_DATA1(payload)           ((const ubx_sec_siglog_data1_t *)(payload))
+#define UBX_SEC_SIGLOG_DATA1_SIZE               8
+#define UBX_SEC_SIGLOG_DATA1_EVENTS(payload, i) ((const ubx_sec_siglog_data1_events_t *)((const uint8_t *)(payload) + 8 + (size_t)(i) * 8))
+#define UBX_SEC_SIGLOG_DATA1_EVENTS_COUNT(payload, len) \
+    ((size_t)(len) <= 8 ? 0 : (size_t)UBX_SEC_SIGLOG_DATA1(payload)->numEvents < ((size_t)(len) - 8) / 8 ? (size_t)UBX_SEC_SIGLOG_DATA1(payload)->numEvents : ((size_t)(len) - 8) / 8)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-HNR-PVT-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_hnr_pvt_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_hnr_pvt_poll0_t, 0);
+
+#define UBX_HNR_PVT_POLL0(payload)              ((const ubx_hnr_pvt_poll0_t *)(payload))
+#define UBX_HNR_PVT_POLL0_SIZE                  0
+#define UBX_HNR_PVT_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x28, 0x00, ubx_hnr_pvt_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-HNR-PVT-DATA0 payload (72 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint16_t year;                      // 4: y
+    uint8_t month;                      // 6: month
+    uint8_t day;                        // 7: d
+    uint8_t hour;                       // 8: h
+    uint8_t min;                        // 9: min
+    uint8_t sec;                        // 10: s
+    union {
+        uint8_t valid;                  // 11
+        struct {
+            uint8_t validDate : 1;          // bit 0
+            uint8_t validTime : 1;          // bit 1
+            uint8_t fullyResolved : 1;      // bit 2
+            uint8_t : 5;
+        };
+    };
+    int32_t nano;                       // 12: ns
+    uint8_t gpsFix;                     // 16
+    union {
+        uint8_t flags;                  // 17
+        struct {
+            uint8_t GPSfixOK : 1;           // bit 0
+            uint8_t DiffSoln : 1;           // bit 1
+            uint8_t WKNSET : 1;             // bit 2
+            uint8_t TOWSET : 1;             // bit 3
+            uint8_t headVehValid : 1;       // bit 4
+            uint8_t : 3;
+        };
+    };
+    uint8_t reserved0[2];               // 18
+    int32_t lon;                        // 20: deg, *1e-7
+    int32_t lat;                        // 24: deg, *1e-7
+    int32_t height;                     // 28: mm
+    int32_t hMSL;                       // 32: mm
+    int32_t gSpeed;                     // 36: mm/s
+    int32_t speed;                      // 40: mm/s
+    int32_t headMot;                    // 44: deg, *1e-5
+    int32_t headVeh;                    // 48: deg, *1e-5
+    uint32_t hAcc;                      // 52: mm
+    uint32_t vAcc;                      // 56: mm
+    uint32_t sAcc;                      // 60: mm/s
+    uint32_t headAcc;                   // 64: deg, *1e-5
+    uint8_t reserved1[4];               // 68
+} ubx_hnr_pvt_data0_t;
+UBX_PAYLOAD_SIZE(ubx_hnr_pvt_data0_t, 72);
+
+#define UBX_HNR_PVT_DATA0(payload)              ((const ubx_hnr_pvt_data0_t *)(payload))
+#define UBX_HNR_PVT_DATA0_SIZE                  72
+#define UBX_HNR_PVT_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x28, 0x00, ubx_hnr_pvt_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-HNR-ATT-DATA1 payload (32 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t version;                    // 4
+    uint8_t reserved0[3];               // 5
+    int32_t roll;                       // 8: deg, *1e-5
+    int32_t pitch;                      // 12: deg, *1e-5
+    int32_t heading;                    // 16: deg, *1e-5
+    uint32_t accRoll;                   // 20: deg, *1e-5
+    uint32_t accPitch;                  // 24: deg, *1e-5
+    uint32_t accHeading;                // 28: deg, *1e-5
+} ubx_hnr_att_data1_t;
+UBX_PAYLOAD_SIZE(ubx_hnr_att_data1_t, 32);
+
+#define UBX_HNR_ATT_DATA1(payload)              ((const ubx_hnr_att_data1_t *)(payload))
+#define UBX_HNR_ATT_DATA1_SIZE                  32
+#define UBX_HNR_ATT_DATA1_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x28, 0x01, ubx_hnr_att_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-HNR-INS-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_hnr_ins_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_hnr_ins_poll0_t, 0);
+
+#define UBX_HNR_INS_POLL0(payload)              ((const ubx_hnr_ins_poll0_t *)(payload))
+#define UBX_HNR_INS_POLL0_SIZE                  0
+#define UBX_HNR_INS_POLL0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x28, 0x02, ubx_hnr_ins_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-HNR-INS-DATA0 payload (36 bytes)
+typedef struct __attribute__((packed)) {
+    union {
+        uint32_t bitfield0;             // 0
+        struct {
+            uint32_t version : 8;           // bit 0..7
+            uint32_t xAngRateValid : 1;     // bit 8
+            uint32_t yAngRateValid : 1;     // bit 9
+            uint32_t zAngRateValid : 1;     // bit 10
+            uint32_t xAccelValid : 1;       // bit 11
+            uint32_t yAccelValid : 1;       // bit 12
+            uint32_t zAccelValid : 1;       // bit 13
+            uint32_t : 18;
+        };
+    };
+    uint8_t reserved0[4];               // 4
+    uint32_t iTOW;                      // 8: ms
+    int32_t xAngRate;                   // 12: deg/s, *1e-3
+    int32_t yAngRate;                   // 16: deg/s, *1e-3
+    int32_t zAngRate;                   // 20: deg/s, *1e-3
+    int32_t xAccel;                     // 24: m/s^2, *1e-2
+    int32_t yAccel;                     // 28: m/s^2, *1e-2
+    int32_t zAccel;                     // 32: m/s^2, *1e-2
+} ubx_hnr_ins_data0_t;
+UBX_PAYLOAD_SIZE(ubx_hnr_ins_data0_t, 36);
+
+#define UBX_HNR_INS_DATA0(payload)              ((const ubx_hnr_ins_data0_t *)(payload))
+#define UBX_HNR_INS_DATA0_SIZE                  36
+#define UBX_HNR_INS_DATA0_TYPED(name, ...)      UBX_MESSAGE_TYPED(name, 0x28, 0x02, ubx_hnr_ins_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-POSECEF-DATA0 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    int32_t ecefX;                      // 4: cm
+    int32_t ecefY;                      // 8: cm
+    int32_t ecefZ;                      // 12: cm
+    uint32_t pAcc;                      // 16: cm
+} ubx_nav2_posecef_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_posecef_data0_t, 20);
+
+#define UBX_NAV2_POSECEF_DATA0(payload)         ((const ubx_nav2_posecef_data0_t *)(payload))
+#define UBX_NAV2_POSECEF_DATA0_SIZE             20
+#define UBX_NAV2_POSECEF_DATA0_TYPED(name, ...) UBX_MESSAGE_TYPED(name, 0x29, 0x01, ubx_nav2_posecef_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-POSLLH-DATA0 payload (28 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    int32_t lon;                        // 4: deg, *1e-7
+    int32_t lat;                        // 8: deg, *1e-7
+    int32_t height;                     // 12: mm
+    int32_t hMSL;                       // 16: mm
+    uint32_t hAcc;                      // 20: mm
+    uint32_t vAcc;                      // 24: mm
+} ubx_nav2_posllh_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_posllh_data0_t, 28);
+
+#define UBX_NAV2_POSLLH_DATA0(payload)          ((const ubx_nav2_posllh_data0_t *)(payload))
+#define UBX_NAV2_POSLLH_DATA0_SIZE              28
+#define UBX_NAV2_POSLLH_DATA0_TYPED(name, ...)  UBX_MESSAGE_TYPED(name, 0x29, 0x02, ubx_nav2_posllh_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-STATUS-DATA1 payload (16 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t gpsFix;                     // 4
+    union {
+        uint8_t flags;                  // 5
+        struct {
+            uint8_t gpsFixOk : 1;           // bit 0
+            uint8_t diffSoln : 1;           // bit 1
+            uint8_t wknSet : 1;             // bit 2
+            uint8_t towSet : 1;             // bit 3
+            uint8_t : 4;
+        };
+    };
+    union {
+        uint8_t fixStat;                // 6
+        struct {
+            uint8_t diffCorr : 1;           // bit 0
+            uint8_t carrSolnValid : 1;      // bit 1
+            uint8_t : 4;
+            uint8_t mapMatching : 2;        // bit 6..7
+        };
+    };
+    union {
+        uint8_t flags2;                 // 7
+        struct {
+            uint8_t psmState : 2;           // bit 0..1
+            uint8_t : 1;
+            uint8_t spoofDetState : 2;      // bit 3..4
+            uint8_t : 1;
+            uint8_t carrSoln : 2;           // bit 6..7
+        };
+    };
+    uint32_t ttff;                      // 8: ms
+    uint32_t msss;                      // 12: ms
+} ubx_nav2_status_data1_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_status_data1_t, 16);
+
+#define UBX_NAV2_STATUS_DATA1(payload)          ((const ubx_nav2_status_data1_t *)(payload))
+#define UBX_NAV2_STATUS_DATA1_SIZE              16
+#define UBX_NAV2_STATUS_DATA1_TYPED(name, ...)  UBX_MESSAGE_TYPED(name, 0x29, 0x03, ubx_nav2_status_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-DOP-DATA0 payload (18 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint16_t gDOP;                      // 4: *0.01
+    uint16_t pDOP;                      // 6: *0.01
+    uint16_t tDOP;                      // 8: *0.01
+    uint16_t vDOP;                      // 10: *0.01
+    uint16_t hDOP;                      // 12: *0.01
+    uint16_t nDOP;                      // 14: *0.01
+    uint16_t eDOP;                      // 16: *0.01
+} ubx_nav2_dop_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_dop_data0_t, 18);
+
+#define UBX_NAV2_DOP_DATA0(payload)             ((const ubx_nav2_dop_data0_t *)(payload))
+#define UBX_NAV2_DOP_DATA0_SIZE                 18
+#define UBX_NAV2_DOP_DATA0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x29, 0x04, ubx_nav2_dop_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-PVT-DATA1 payload (92 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint16_t year;                      // 4: y
+    uint8_t month;                      // 6: month
+    uint8_t day;                        // 7: d
+    uint8_t hour;                       // 8: h
+    uint8_t min;                        // 9: min
+    uint8_t sec;                        // 10: s
+    union {
+        uint8_t valid;                  // 11
+        struct {
+            uint8_t validDate : 1;          // bit 0
+            uint8_t validTime : 1;          // bit 1
+            uint8_t fullyResolved : 1;      // bit 2
+            uint8_t validMag : 1;           // bit 3
+            uint8_t : 4;
+        };
+    };
+    uint32_t tAcc;                      // 12: ns
+    int32_t nano;                       // 16: ns
+    uint8_t fixType;                    // 20
+    union {
+        uint8_t flags;                  // 21
+        struct {
+            uint8_t gnssFixOK : 1;          // bit 0
+            uint8_t diffSoln : 1;           // bit 1
+            uint8_t psmState : 3;           // bit 2..4
+            uint8_t headVehValid : 1;       // bit 5
+            uint8_t carrSoln : 2;           // bit 6..7
+        };
+    };
+    union {
+        uint8_t flags2;                 // 22
+        struct {
+            uint8_t : 5;
+            uint8_t confirmedAvai : 1;      // bit 5
+            uint8_t confirmedDate : 1;      // bit 6
+            uint8_t confirmedTime : 1;      // bit 7
+        };
+    };
+    uint8_t numSV;                      // 23
+    int32_t lon;                        // 24: deg, *1e-7
+    int32_t lat;                        // 28: deg, *1e-7
+    int32_t height;                     // 32: mm
+    int32_t hMSL;                       // 36: mm
+    uint32_t hAcc;                      // 40: mm
+    uint32_t vAcc;                      // 44: mm
+    int32_t velN;                       // 48: mm/s
+    int32_t velE;                       // 52: mm/s
+    int32_t velD;                       // 56: mm/s
+    int32_t gSpeed;                     // 60: mm/s
+    int32_t headMot;                    // 64: deg, *1e-5
+    uint32_t sAcc;                      // 68: mm/s
+    uint32_t headAcc;                   // 72: deg, *1e-5
+    uint16_t pDOP;                      // 76: *0.01
+    union {
+        uint16_t flags3;                // 78
+        struct {
+            uint16_t invalidLlh : 1;        // bit 0
+            uint16_t lastCorrectionAge : 4; // bit 1..4
+            uint16_t : 8;
+            uint16_t authTime : 1;          // bit 13
+            uint16_t nmaFixStatus : 1;      // bit 14
+            uint16_t : 1;
+        };
+    };
+    uint8_t reserved0[4];               // 80
+    int32_t headVeh;                    // 84: deg, *1e-5
+    int16_t magDec;                     // 88: deg, *1e-2
+    uint16_t magAcc;                    // 90: deg, *1e-2
+} ubx_nav2_pvt_data1_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_pvt_data1_t, 92);
+
+#define UBX_NAV2_PVT_DATA1(payload)             ((const ubx_nav2_pvt_data1_t *)(payload))
+#define UBX_NAV2_PVT_DATA1_SIZE                 92
+#define UBX_NAV2_PVT_DATA1_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x29, 0x07, ubx_nav2_pvt_data1_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-ODO-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_nav2_odo_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_odo_poll0_t, 0);
+
+#define UBX_NAV2_ODO_POLL0(payload)             ((const ubx_nav2_odo_poll0_t *)(payload))
+#define UBX_NAV2_ODO_POLL0_SIZE                 0
+#define UBX_NAV2_ODO_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x29, 0x09, ubx_nav2_odo_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-ODO-DATA0 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0[3];               // 1
+    uint32_t iTOW;                      // 4: ms
+    uint32_t distance;                  // 8: m
+    uint32_t totalDistance;             // 12: m
+    uint32_t distanceStd;               // 16: m
+} ubx_nav2_odo_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_odo_data0_t, 20);
+
+#define UBX_NAV2_ODO_DATA0(payload)             ((const ubx_nav2_odo_data0_t *)(payload))
+#define UBX_NAV2_ODO_DATA0_SIZE                 20
+#define UBX_NAV2_ODO_DATA0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x29, 0x09, ubx_nav2_odo_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-VELECEF-DATA0 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    int32_t ecefVX;                     // 4: cm/s
+    int32_t ecefVY;                     // 8: cm/s
+    int32_t ecefVZ;                     // 12: cm/s
+    uint32_t sAcc;                      // 16: cm/s
+} ubx_nav2_velecef_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_velecef_data0_t, 20);
+
+#define UBX_NAV2_VELECEF_DATA0(payload)         ((const ubx_nav2_velecef_data0_t *)(payload))
+#define UBX_NAV2_VELECEF_DATA0_SIZE             20
+#define UBX_NAV2_VELECEF_DATA0_TYPED(name, ...) UBX_MESSAGE_TYPED(name, 0x29, 0x11, ubx_nav2_velecef_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-VELNED-DATA0 payload (36 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    int32_t velN;                       // 4: cm/s
+    int32_t velE;                       // 8: cm/s
+    int32_t velD;                       // 12: cm/s
+    uint32_t speed;                     // 16: cm/s
+    uint32_t gSpeed;                    // 20: cm/s
+    int32_t heading;                    // 24: deg, *1e-5
+    uint32_t sAcc;                      // 28: cm/s
+    uint32_t cAcc;                      // 32: deg, *1e-5
+} ubx_nav2_velned_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_velned_data0_t, 36);
+
+#define UBX_NAV2_VELNED_DATA0(payload)          ((const ubx_nav2_velned_data0_t *)(payload))
+#define UBX_NAV2_VELNED_DATA0_SIZE              36
+#define UBX_NAV2_VELNED_DATA0_TYPED(name, ...)  UBX_MESSAGE_TYPED(name, 0x29, 0x12, ubx_nav2_velned_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-PVAT-DATA0 payload (116 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t version;                    // 4
+    union {
+        uint8_t valid;                  // 5
+        struct {
+            uint8_t validDate : 1;          // bit 0
+            uint8_t validTime : 1;          // bit 1
+            uint8_t fullyResolved : 1;      // bit 2
+            uint8_t validMag : 1;           // bit 3
+            uint8_t : 4;
+        };
+    };
+    uint16_t year;                      // 6: y
+    uint8_t month;                      // 8: month
+    uint8_t day;                        // 9: d
+    uint8_t hour;                       // 10: h
+    uint8_t min;                        // 11: min
+    uint8_t sec;                        // 12: s
+    uint8_t reserved0;                  // 13
+    uint8_t reserved1[2];               // 14
+    uint32_t tAcc;                      // 16: ns
+    int32_t nano;                       // 20: ns
+    uint8_t fixType;                    // 24
+    union {
+        uint8_t flags;                  // 25
+        struct {
+            uint8_t gnssFixOK : 1;          // bit 0
+            uint8_t diffSoln : 1;           // bit 1
+            uint8_t : 1;
+            uint8_t vehRollValid : 1;       // bit 3
+            uint8_t vehPitchValid : 1;      // bit 4
+            uint8_t vehHeadingValid : 1;    // bit 5
+            uint8_t carrSoln : 2;           // bit 6..7
+        };
+    };
+    union {
+        uint8_t flags2;                 // 26
+        struct {
+            uint8_t : 5;
+            uint8_t confirmedAvai : 1;      // bit 5
+            uint8_t confirmedDate : 1;      // bit 6
+            uint8_t confirmedTime : 1;      // bit 7
+        };
+    };
+    uint8_t numSV;                      // 27
+    int32_t lon;                        // 28: deg, *1e-7
+    int32_t lat;                        // 32: deg, *1e-7
+    int32_t height;                     // 36: mm
+    int32_t hMSL;                       // 40: mm
+    uint32_t hAcc;                      // 44: mm
+    uint32_t vAcc;                      // 48: mm
+    int32_t velN;                       // 52: mm/s
+    int32_t velE;                       // 56: mm/s
+    int32_t velD;                       // 60: mm/s
+    int32_t gSpeed;                     // 64: mm/s
+    uint32_t sAcc;                      // 68: mm/s
+    int32_t vehRoll;                    // 72: deg, *1e-5
+    int32_t vehPitch;                   // 76: deg, *1e-5
+    int32_t vehHeading;                 // 80: deg, *1e-5
+    int32_t motHeading;                 // 84: deg, *1e-5
+    uint16_t accRoll;                   // 88: deg, *1e-2
+    uint16_t accPitch;                  // 90: deg, *1e-2
+    uint16_t accHeading;                // 92: deg, *1e-2
+    int16_t magDec;                     // 94: deg, *1e-2
+    uint16_t magAcc;                    // 96: deg, *1e-2
+    uint16_t errEllipseOrient;          // 98: deg, *1e-2
+    uint32_t errEllipseMajor;           // 100: mm
+    uint32_t errEllipseMinor;           // 104: mm
+    uint8_t reserved2[4];               // 108
+    uint8_t reserved3[4];               // 112
+} ubx_nav2_pvat_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_pvat_data0_t, 116);
+
+#define UBX_NAV2_PVAT_DATA0(payload)            ((const ubx_nav2_pvat_data0_t *)(payload))
+#define UBX_NAV2_PVAT_DATA0_SIZE                116
+#define UBX_NAV2_PVAT_DATA0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x29, 0x17, ubx_nav2_pvat_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-TIMEGPS-DATA0 payload (16 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    int32_t fTOW;                       // 4: ns
+    int16_t week;                       // 8
+    int8_t leapS;                       // 10: s
+    union {
+        uint8_t valid;                  // 11
+        struct {
+            uint8_t towValid : 1;           // bit 0
+            uint8_t weekValid : 1;          // bit 1
+            uint8_t leapSValid : 1;         // bit 2
+            uint8_t : 5;
+        };
+    };
+    uint32_t tAcc;                      // 12: ns
+} ubx_nav2_timegps_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_timegps_data0_t, 16);
+
+#define UBX_NAV2_TIMEGPS_DATA0(payload)         ((const ubx_nav2_timegps_data0_t *)(payload))
+#define UBX_NAV2_TIMEGPS_DATA0_SIZE             16
+#define UBX_NAV2_TIMEGPS_DATA0_TYPED(name, ...) UBX_MESSAGE_TYPED(name, 0x29, 0x20, ubx_nav2_timegps_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-TIMEUTC-DATA0 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint32_t tAcc;                      // 4: ns
+    int32_t nano;                       // 8: ns
+    uint16_t year;                      // 12: y
+    uint8_t month;                      // 14: month
+    uint8_t day;                        // 15: d
+    uint8_t hour;                       // 16: h
+    uint8_t min;                        // 17: min
+    uint8_t sec;                        // 18: s
+    union {
+        uint8_t valid;                  // 19
+        struct {
+            uint8_t validTOW : 1;           // bit 0
+            uint8_t validWKN : 1;           // bit 1
+            uint8_t validUTC : 1;           // bit 2
+            uint8_t authStatus : 1;         // bit 3
+            uint8_t utcStandard : 4;        // bit 4..7
+        };
+    };
+} ubx_nav2_timeutc_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_timeutc_data0_t, 20);
+
+#define UBX_NAV2_TIMEUTC_DATA0(payload)         ((const ubx_nav2_timeutc_data0_t *)(payload))
+#define UBX_NAV2_TIMEUTC_DATA0_SIZE             20
+#define UBX_NAV2_TIMEUTC_DATA0_TYPED(name, ...) UBX_MESSAGE_TYPED(name, 0x29, 0x21, ubx_nav2_timeutc_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-CLOCK-DATA0 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    int32_t clkB;                       // 4: ns
+    int32_t clkD;                       // 8: ns/s
+    uint32_t tAcc;                      // 12: ns
+    uint32_t fAcc;                      // 16: ps/s
+} ubx_nav2_clock_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_clock_data0_t, 20);
+
+#define UBX_NAV2_CLOCK_DATA0(payload)           ((const ubx_nav2_clock_data0_t *)(payload))
+#define UBX_NAV2_CLOCK_DATA0_SIZE               20
+#define UBX_NAV2_CLOCK_DATA0_TYPED(name, ...)   UBX_MESSAGE_TYPED(name, 0x29, 0x22, ubx_nav2_clock_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-TIMEGLO-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_nav2_timeglo_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_timeglo_poll0_t, 0);
+
+#define UBX_NAV2_TIMEGLO_POLL0(payload)         ((const ubx_nav2_timeglo_poll0_t *)(payload))
+#define UBX_NAV2_TIMEGLO_POLL0_SIZE             0
+#define UBX_NAV2_TIMEGLO_POLL0_TYPED(name, ...) UBX_MESSAGE_TYPED(name, 0x29, 0x23, ubx_nav2_timeglo_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-TIMEGLO-DATA0 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint32_t TOD;                       // 4: s
+    int32_t fTOD;                       // 8: ns
+    uint16_t Nt;                        // 12: days
+    uint8_t N4;                         // 14
+    union {
+        uint8_t valid;                  // 15
+        struct {
+            uint8_t todValid : 1;           // bit 0
+            uint8_t dateValid : 1;          // bit 1
+            uint8_t : 6;
+        };
+    };
+    uint32_t tAcc;                      // 16: ns
+} ubx_nav2_timeglo_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_timeglo_data0_t, 20);
+
+#define UBX_NAV2_TIMEGLO_DATA0(payload)         ((const ubx_nav2_timeglo_data0_t *)(payload))
+#define UBX_NAV2_TIMEGLO_DATA0_SIZE             20
+#define UBX_NAV2_TIMEGLO_DATA0_TYPED(name, ...) UBX_MESSAGE_TYPED(name, 0x29, 0x23, ubx_nav2_timeglo_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-TIMEBDS-DATA0 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint32_t SOW;                       // 4: s
+    int32_t fSOW;                       // 8: ns
+    int16_t week;                       // 12
+    int8_t leapS;                       // 14: s
+    union {
+        uint8_t valid;                  // 15
+        struct {
+            uint8_t sowValid : 1;           // bit 0
+            uint8_t weekValid : 1;          // bit 1
+            uint8_t leapSValid : 1;         // bit 2
+            uint8_t : 5;
+        };
+    };
+    uint32_t tAcc;                      // 16: ns
+} ubx_nav2_timebds_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_timebds_data0_t, 20);
+
+#define UBX_NAV2_TIMEBDS_DATA0(payload)         ((const ubx_nav2_timebds_data0_t *)(payload))
+#define UBX_NAV2_TIMEBDS_DATA0_SIZE             20
+#define UBX_NAV2_TIMEBDS_DATA0_TYPED(name, ...) UBX_MESSAGE_TYPED(name, 0x29, 0x24, ubx_nav2_timebds_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-TIMEGAL-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_nav2_timegal_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_timegal_poll0_t, 0);
+
+#define UBX_NAV2_TIMEGAL_POLL0(payload)         ((const ubx_nav2_timegal_poll0_t *)(payload))
+#define UBX_NAV2_TIMEGAL_POLL0_SIZE             0
+#define UBX_NAV2_TIMEGAL_POLL0_TYPED(name, ...) UBX_MESSAGE_TYPED(name, 0x29, 0x25, ubx_nav2_timegal_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-TIMEGAL-DATA0 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint32_t galTow;                    // 4: s
+    int32_t fGalTow;                    // 8: ns
+    int16_t galWno;                     // 12
+    int8_t leapS;                       // 14: s
+    union {
+        uint8_t valid;                  // 15
+        struct {
+            uint8_t galTowValid : 1;        // bit 0
+            uint8_t galWnoValid : 1;        // bit 1
+            uint8_t leapSValid : 1;         // bit 2
+            uint8_t : 5;
+        };
+    };
+    uint32_t tAcc;                      // 16: ns
+} ubx_nav2_timegal_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_timegal_data0_t, 20);
+
+#define UBX_NAV2_TIMEGAL_DATA0(payload)         ((const ubx_nav2_timegal_data0_t *)(payload))
+#define UBX_NAV2_TIMEGAL_DATA0_SIZE             20
+#define UBX_NAV2_TIMEGAL_DATA0_TYPED(name, ...) UBX_MESSAGE_TYPED(name, 0x29, 0x25, ubx_nav2_timegal_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-TIMELS-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_nav2_timels_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_timels_poll0_t, 0);
+
+#define UBX_NAV2_TIMELS_POLL0(payload)          ((const ubx_nav2_timels_poll0_t *)(payload))
+#define UBX_NAV2_TIMELS_POLL0_SIZE              0
+#define UBX_NAV2_TIMELS_POLL0_TYPED(name, ...)  UBX_MESSAGE_TYPED(name, 0x29, 0x26, ubx_nav2_timels_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-TIMELS-DATA0 payload (24 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t version;                    // 4
+    uint8_t reserved0[3];               // 5
+    uint8_t srcOfCurrLs;                // 8
+    int8_t currLs;                      // 9: s
+    uint8_t srcOfLsChange;              // 10
+    int8_t lsChange;                    // 11: s
+    int32_t timeToLsEvent;              // 12: s
+    uint16_t dateOfLsGpsWn;             // 16
+    uint16_t dateOfLsGpsDn;             // 18
+    uint8_t reserved1[3];               // 20
+    union {
+        uint8_t valid;                  // 23
+        struct {
+            uint8_t validCurrLs : 1;        // bit 0
+            uint8_t validTimeToLsEvent : 1; // bit 1
+            uint8_t : 6;
+        };
+    };
+} ubx_nav2_timels_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_timels_data0_t, 24);
+
+#define UBX_NAV2_TIMELS_DATA0(payload)          ((const ubx_nav2_timels_data0_t *)(payload))
+#define UBX_NAV2_TIMELS_DATA0_SIZE              24
+#define UBX_NAV2_TIMELS_DATA0_TYPED(name, ...)  UBX_MESSAGE_TYPED(name, 0x29, 0x26, ubx_nav2_timels_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-TIMEQZSS-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_nav2_timeqzss_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_timeqzss_poll0_t, 0);
+
+#define UBX_NAV2_TIMEQZSS_POLL0(payload)        ((const ubx_nav2_timeqzss_poll0_t *)(payload))
+#define UBX_NAV2_TIMEQZSS_POLL0_SIZE            0
+#define UBX_NAV2_TIMEQZSS_POLL0_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x29, 0x27, ubx_nav2_timeqzss_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-TIMEQZSS-DATA0 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint32_t qzssTow;                   // 4: s
+    int32_t fQzssTow;                   // 8: ns
+    int16_t qzssWno;                    // 12
+    int8_t leapS;                       // 14: s
+    union {
+        uint8_t valid;                  // 15
+        struct {
+            uint8_t qzssTowValid : 1;       // bit 0
+            uint8_t qzssWnoValid : 1;       // bit 1
+            uint8_t leapSValid : 1;         // bit 2
+            uint8_t : 5;
+        };
+    };
+    uint32_t tAcc;                      // 16: ns
+} ubx_nav2_timeqzss_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_timeqzss_data0_t, 20);
+
+#define UBX_NAV2_TIMEQZSS_DATA0(payload)        ((const ubx_nav2_timeqzss_data0_t *)(payload))
+#define UBX_NAV2_TIMEQZSS_DATA0_SIZE            20
+#define UBX_NAV2_TIMEQZSS_DATA0_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x29, 0x27, ubx_nav2_timeqzss_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-SBAS-DATA0 svs (12 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t svid;                       // 0
+    uint8_t reserved1;                  // 1
+    uint8_t udre;                       // 2
+    uint8_t svSys;                      // 3
+    uint8_t svService;                  // 4
+    uint8_t reserved2;                  // 5
+    int16_t prc;                        // 6: cm
+    uint8_t reserved3[2];               // 8
+    int16_t ic;                         // 10: cm
+} ubx_nav2_sbas_data0_svs_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_sbas_data0_svs_t, 12);
+
+// UBX-NAV2-SBAS-DATA0 payload (12 + cnt*12 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t geo;                        // 4
+    uint8_t mode;                       // 5
+    int8_t sys;                         // 6
+    union {
+        uint8_t service;                // 7
+        struct {
+            uint8_t Ranging : 1;            // bit 0
+            uint8_t Corrections : 1;        // bit 1
+            uint8_t Integrity : 1;          // bit 2
+            uint8_t Testmode : 1;           // bit 3
+            uint8_t Bad : 1;                // bit 4
+            uint8_t : 3;
+        };
+    };
+    uint8_t cnt;                        // 8
+    union {
+        uint8_t statusFlags;            // 9
+        struct {
+            uint8_t integrityUsed : 2;      // bit 0..1
+            uint8_t : 6;
+        };
+    };
+    uint8_t reserved0[2];               // 10
+    ubx_nav2_sbas_data0_svs_t svs[];    // 12: repeated
+} ubx_nav2_sbas_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_sbas_data0_t, 12);
+
+#define UBX_NAV2_SBAS_DATA0(payload)            ((const ubx_nav2_sbas_data0_t *)(payload))
+#define UBX_NAV2_SBAS_DATA0_SIZE                12
+#define UBX_NAV2_SBAS_DATA0_SVS(payload, i)     ((const ubx_nav2_sbas_data0_svs_t *)((const uint8_t *)(payload) + 12 + (size_t)(i) * 12))
+#define UBX_NAV2_SBAS_DATA0_SVS_COUNT(payload, len) \
+    ((size_t)(len) <= 12 ? 0 : (size_t)UBX_NAV2_SBAS_DATA0(payload)->cnt < ((size_t)(len) - 12) / 12 ? (size_t)UBX_NAV2_SBAS_DATA0(payload)->cnt : ((size_t)(len) - 12) / 12)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-SAT-DATA0 sv (12 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t gnssId;                     // 0
+    uint8_t svId;                       // 1
+    uint8_t cno;                        // 2: dBHz
+    int8_t elev;                        // 3: deg
+    int16_t azim;                       // 4: deg
+    int16_t prRes;                      // 6: m, *0.1
+    union {
+        uint32_t flags;                 // 8
+        struct {
+            uint32_t qualityInd : 3;        // bit 0..2
+            uint32_t svUsed : 1;            // bit 3
+            uint32_t health : 2;            // bit 4..5
+            uint32_t diffCorr : 1;          // bit 6
+            uint32_t smoothed : 1;          // bit 7
+            uint32_t orbitSource : 3;       // bit 8..10
+            uint32_t ephAvail : 1;          // bit 11
+            uint32_t almAvail : 1;          // bit 12
+            uint32_t anoAvail : 1;          // bit 13
+            uint32_t aopAvail : 1;          // bit 14
+            uint32_t : 1;
+            uint32_t sbasCorrUsed : 1;      // bit 16
+            uint32_t rtcmCorrUsed : 1;      // bit 17
+            uint32_t slasCorrUsed : 1;      // bit 18
+            uint32_t spartnCorrUsed : 1;    // bit 19
+            uint32_t prCorrUsed : 1;        // bit 20
+            uint32_t crCorrUsed : 1;        // bit 21
+            uint32_t doCorrUsed : 1;        // bit 22
+            uint32_t clasCorrUsed : 1;      // bit 23
+            uint32_t lppCorrUsed : 1;       // bit 24
+            uint32_t hasCorrUsed : 1;       // bit 25
+            uint32_t : 6;
+        };
+    };
+} ubx_nav2_sat_data0_sv_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_sat_data0_sv_t, 12);
+
+// UBX-NAV2-SAT-DATA0 payload (8 + numSvs*12 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t version;                    // 4
+    uint8_t numSvs;                     // 5
+    uint8_t reserved0[2];               // 6
+    ubx_nav2_sat_data0_sv_t sv[];       // 8: repeated
+} ubx_nav2_sat_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_sat_data0_t, 8);
+
+#define UBX_NAV2_SAT_DATA0(payload)             ((const ubx_nav2_sat_data0_t *)(payload))
+#define UBX_NAV2_SAT_DATA0_SIZE                 8
+#define UBX_NAV2_SAT_DATA0_SV(payload, i)       ((const ubx_nav2_sat_data0_sv_t *)((const uint8_t *)(payload) + 8 + (size_t)(i) * 12))
+#define UBX_NAV2_SAT_DATA0_SV_COUNT(payload, len) \
+    ((size_t)(len) <= 8 ? 0 : (size_t)UBX_NAV2_SAT_DATA0(payload)->numSvs < ((size_t)(len) - 8) / 12 ? (size_t)UBX_NAV2_SAT_DATA0(payload)->numSvs : ((size_t)(len) - 8) / 12)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-COV-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_nav2_cov_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_cov_poll0_t, 0);
+
+#define UBX_NAV2_COV_POLL0(payload)             ((const ubx_nav2_cov_poll0_t *)(payload))
+#define UBX_NAV2_COV_POLL0_SIZE                 0
+#define UBX_NAV2_COV_POLL0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x29, 0x36, ubx_nav2_cov_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-COV-DATA0 payload (64 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t version;                    // 4
+    uint8_t posCovValid;                // 5
+    uint8_t velCovValid;                // 6
+    uint8_t reserved0[9];               // 7
+    float posCovNN;                     // 16: m^2
+    float posCovNE;                     // 20: m^2
+    float posCovND;                     // 24: m^2
+    float posCovEE;                     // 28: m^2
+    float posCovED;                     // 32: m^2
+    float posCovDD;                     // 36: m^2
+    float velCovNN;                     // 40: m^2/s^2
+    float velCovNE;                     // 44: m^2/s^2
+    float velCovND;                     // 48: m^2/s^2
+    float velCovEE;                     // 52: m^2/s^2
+    float velCovED;                     // 56: m^2/s^2
+    float velCovDD;                     // 60: m^2/s^2
+} ubx_nav2_cov_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_cov_data0_t, 64);
+
+#define UBX_NAV2_COV_DATA0(payload)             ((const ubx_nav2_cov_data0_t *)(payload))
+#define UBX_NAV2_COV_DATA0_SIZE                 64
+#define UBX_NAV2_COV_DATA0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x29, 0x36, ubx_nav2_cov_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-SVIN-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_nav2_svin_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_svin_poll0_t, 0);
+
+#define UBX_NAV2_SVIN_POLL0(payload)            ((const ubx_nav2_svin_poll0_t *)(payload))
+#define UBX_NAV2_SVIN_POLL0_SIZE                0
+#define UBX_NAV2_SVIN_POLL0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x29, 0x3B, ubx_nav2_svin_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-SVIN-DATA0 payload (40 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t version;                    // 0
+    uint8_t reserved0[3];               // 1
+    uint32_t iTOW;                      // 4: ms
+    uint32_t dur;                       // 8: s
+    int32_t meanX;                      // 12: cm
+    int32_t meanY;                      // 16: cm
+    int32_t meanZ;                      // 20: cm
+    int8_t meanXHP;                     // 24: 0.1_mm
+    int8_t meanYHP;                     // 25: 0.1_mm
+    int8_t meanZHP;                     // 26: 0.1_mm
+    uint8_t reserved1;                  // 27
+    uint32_t meanAcc;                   // 28: 0.1_mm
+    uint32_t obs;                       // 32
+    uint8_t valid;                      // 36
+    uint8_t active;                     // 37
+    uint8_t reserved2[2];               // 38
+} ubx_nav2_svin_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_svin_data0_t, 40);
+
+#define UBX_NAV2_SVIN_DATA0(payload)            ((const ubx_nav2_svin_data0_t *)(payload))
+#define UBX_NAV2_SVIN_DATA0_SIZE                40
+#define UBX_NAV2_SVIN_DATA0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x29, 0x3B, ubx_nav2_svin_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-EELL-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_nav2_eell_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_eell_poll0_t, 0);
+
+#define UBX_NAV2_EELL_POLL0(payload)            ((const ubx_nav2_eell_poll0_t *)(payload))
+#define UBX_NAV2_EELL_POLL0_SIZE                0
+#define UBX_NAV2_EELL_POLL0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x29, 0x3D, ubx_nav2_eell_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-EELL-DATA0 payload (16 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t version;                    // 4
+    uint8_t reserved0;                  // 5
+    uint16_t errEllipseOrient;          // 6: deg, *1e-2
+    uint32_t errEllipseMajor;           // 8: mm
+    uint32_t errEllipseMinor;           // 12: mm
+} ubx_nav2_eell_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_eell_data0_t, 16);
+
+#define UBX_NAV2_EELL_DATA0(payload)            ((const ubx_nav2_eell_data0_t *)(payload))
+#define UBX_NAV2_EELL_DATA0_SIZE                16
+#define UBX_NAV2_EELL_DATA0_TYPED(name, ...)    UBX_MESSAGE_TYPED(name, 0x29, 0x3D, ubx_nav2_eell_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-SLAS-DATA0 prcs (8 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t gnssId;                     // 0
+    uint8_t svId;                       // 1
+    uint8_t reserved1;                  // 2
+    uint8_t reserved2[3];               // 3
+    int16_t prc;                        // 6: cm
+} ubx_nav2_slas_data0_prcs_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_slas_data0_prcs_t, 8);
+
+// UBX-NAV2-SLAS-DATA0 payload (20 + cnt*8 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t version;                    // 4
+    uint8_t reserved0[3];               // 5
+    int32_t gmsLon;                     // 8: deg, *1e-3
+    int32_t gmsLat;                     // 12: deg, *1e-3
+    uint8_t gmsCode;                    // 16
+    uint8_t qzssSvId;                   // 17
+    union {
+        uint8_t serviceFlags;           // 18
+        struct {
+            uint8_t gmsAvailable : 1;       // bit 0
+            uint8_t qzssSvAvailable : 1;    // bit 1
+            uint8_t testMode : 1;           // bit 2
+            uint8_t : 5;
+        };
+    };
+    uint8_t cnt;                        // 19
+    ubx_nav2_slas_data0_prcs_t prcs[];  // 20: repeated
+} ubx_nav2_slas_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_slas_data0_t, 20);
+
+#define UBX_NAV2_SLAS_DATA0(payload)            ((const ubx_nav2_slas_data0_t *)(payload))
+#define UBX_NAV2_SLAS_DATA0_SIZE                20
+#define UBX_NAV2_SLAS_DATA0_PRCS(payload, i)    ((const ubx_nav2_slas_data0_prcs_t *)((const uint8_t *)(payload) + 20 + (size_t)(i) * 8))
+#define UBX_NAV2_SLAS_DATA0_PRCS_COUNT(payload, len) \
+    ((size_t)(len) <= 20 ? 0 : (size_t)UBX_NAV2_SLAS_DATA0(payload)->cnt < ((size_t)(len) - 20) / 8 ? (size_t)UBX_NAV2_SLAS_DATA0(payload)->cnt : ((size_t)(len) - 20) / 8)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-SIG-DATA0 sig (16 bytes)
+typedef struct __attribute__((packed)) {
+    uint8_t gnssId;                     // 0
+    uint8_t svId;                       // 1
+    uint8_t sigId;                      // 2
+    uint8_t freqId;                     // 3
+    int16_t prRes;                      // 4: m, *0.1
+    uint8_t cno;                        // 6: dBHz
+    uint8_t qualityInd;                 // 7
+    uint8_t corrSource;                 // 8
+    uint8_t ionoModel;                  // 9
+    union {
+        uint16_t sigFlags;              // 10
+        struct {
+            uint16_t health : 2;            // bit 0..1
+            uint16_t prSmoothed : 1;        // bit 2
+            uint16_t prUsed : 1;            // bit 3
+            uint16_t crUsed : 1;            // bit 4
+            uint16_t doUsed : 1;            // bit 5
+            uint16_t prCorrUsed : 1;        // bit 6
+            uint16_t crCorrUsed : 1;        // bit 7
+            uint16_t doCorrUsed : 1;        // bit 8
+            uint16_t authStatus : 1;        // bit 9
+            uint16_t : 6;
+        };
+    };
+    uint8_t reserved1[4];               // 12
+} ubx_nav2_sig_data0_sig_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_sig_data0_sig_t, 16);
+
+// UBX-NAV2-SIG-DATA0 payload (8 + numSigs*16 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint8_t version;                    // 4
+    uint8_t numSigs;                    // 5
+    uint8_t reserved0[2];               // 6
+    ubx_nav2_sig_data0_sig_t sig[];     // 8: repeated
+} ubx_nav2_sig_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_sig_data0_t, 8);
+
+#define UBX_NAV2_SIG_DATA0(payload)             ((const ubx_nav2_sig_data0_t *)(payload))
+#define UBX_NAV2_SIG_DATA0_SIZE                 8
+#define UBX_NAV2_SIG_DATA0_SIG(payload, i)      ((const ubx_nav2_sig_data0_sig_t *)((const uint8_t *)(payload) + 8 + (size_t)(i) * 16))
+#define UBX_NAV2_SIG_DATA0_SIG_COUNT(payload, len) \
+    ((size_t)(len) <= 8 ? 0 : (size_t)UBX_NAV2_SIG_DATA0(payload)->numSigs < ((size_t)(len) - 8) / 16 ? (size_t)UBX_NAV2_SIG_DATA0(payload)->numSigs : ((size_t)(len) - 8) / 16)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-EOE-DATA0 payload (4 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+} ubx_nav2_eoe_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_eoe_data0_t, 4);
+
+#define UBX_NAV2_EOE_DATA0(payload)             ((const ubx_nav2_eoe_data0_t *)(payload))
+#define UBX_NAV2_EOE_DATA0_SIZE                 4
+#define UBX_NAV2_EOE_DATA0_TYPED(name, ...)     UBX_MESSAGE_TYPED(name, 0x29, 0x61, ubx_nav2_eoe_data0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-TIMENAVIC-POLL0 payload (0 bytes)
+typedef struct __attribute__((packed)) {
+} ubx_nav2_timenavic_poll0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_timenavic_poll0_t, 0);
+
+#define UBX_NAV2_TIMENAVIC_POLL0(payload)       ((const ubx_nav2_timenavic_poll0_t *)(payload))
+#define UBX_NAV2_TIMENAVIC_POLL0_SIZE           0
+#define UBX_NAV2_TIMENAVIC_POLL0_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x29, 0x63, ubx_nav2_timenavic_poll0_t, __VA_ARGS__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+// UBX-NAV2-TIMENAVIC-DATA0 payload (20 bytes)
+typedef struct __attribute__((packed)) {
+    uint32_t iTOW;                      // 0: ms
+    uint32_t NavICTow;                  // 4: s
+    int32_t fNavICTow;                  // 8: ns
+    int16_t NavICWno;                   // 12
+    int8_t leapS;                       // 14: s
+    union {
+        uint8_t valid;                  // 15
+        struct {
+            uint8_t NavICTowValid : 1;      // bit 0
+            uint8_t NavICWnoValid : 1;      // bit 1
+            uint8_t leapSValid : 1;         // bit 2
+            uint8_t : 5;
+        };
+    };
+    uint32_t tAcc;                      // 16: ns
+} ubx_nav2_timenavic_data0_t;
+UBX_PAYLOAD_SIZE(ubx_nav2_timenavic_data0_t, 20);
+
+#define UBX_NAV2_TIMENAVIC_DATA0(payload)       ((const ubx_nav2_timenavic_data0_t *)(payload))
+#define UBX_NAV2_TIMENAVIC_DATA0_SIZE           20
+#define UBX_NAV2_TIMENAVIC_DATA0_TYPED(name, ...)UBX_MESSAGE_TYPED(name, 0x29, 0x63, ubx_nav2_timenavic_data0_t, __VA_ARGS__)
+
+#pragma pack(pop)
+
+#endif // UBX_STRUCTS_H
@@ -0,0 +1,510 @@
+#ifndef UBX_VALCFG_H
+#define UBX_VALCFG_H
+/*******************************************************************************
+ ubx_valcfg.h
+
+ Key-value configuration interface of u-blox generation 9+ receivers
+ (UBX-CFG-VALSET / UBX-CFG-VALGET), which replaces CFG-PRT, CFG-MSG, CFG-INF
+ and friends on M9/F9/M10 parts.
+
+ Every configuration item is a 32-bit key ID.  Bits 28..30 of the ID give the
+ size of the value on the wire, so frames can be built and walked without
+ knowing the key.  The keys this program uses are listed once in
+ UBX_VALCFG_KEYS(); the enum, the name table and a compile-time check that
+ each key's declared type matches the size encoded in its ID are all
+ expanded from that list.
+
+ One VALSET carries up to 64 key-value pairs for any combination of the RAM,
+ BBR and flash layers.  Longer lists are split into a transaction: the
+ receiver buffers the frames and applies them together with the last one.
+
+ Example:
+   ubx_valcfg_kv_t kv[] = {
+       { UBX_KEY_CFG_MSGOUT_NMEA_ID_ZDA_UART1, 1 },
+       { UBX_KEY_CFG_MSGOUT_NMEA_ID_GGA_UART1, 0 },
+   };
+   uint8_t frame[UBX_MAX_MSG_SIZE];
+   size_t len = ubx_valset_build(frame, sizeof(frame), UBX_VAL_LAYER_RAM,
+                                 UBX_VALSET_TXN_NONE, kv, SIZEOF(kv));
+
+ Copyright (C) 2025 Richard Elwell
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <strings.h>
+#include <errno.h>
+#include <ctype.h>
+#include "ubx_message.h"
+
+#define UBX_VALSET_MAX_KEYS      64
+#define UBX_VALGET_MAX_KEYS      64
+#define UBX_VALCFG_HDR_LEN       4      // version, layer(s), position/transaction, reserved
+
+// VALSET layers (bit mask)
+#define UBX_VAL_LAYER_RAM        0x01
+#define UBX_VAL_LAYER_BBR        0x02
+#define UBX_VAL_LAYER_FLASH      0x04
+
+// VALGET layer (one value)
+#define UBX_VALGET_RAM           0
+#define UBX_VALGET_BBR           1
+#define UBX_VALGET_FLASH         2
+#define UBX_VALGET_DEFAULT       7
+
+// VALSET transaction field
+#define UBX_VALSET_TXN_NONE      0      // apply this frame on its own
+#define UBX_VALSET_TXN_BEGIN     1      // (re)start a transaction
+#define UBX_VALSET_TXN_CONTINUE  2
+#define UBX_VALSET_TXN_APPLY     3      // last frame, apply everything
+
+// Value size from bits 28..30 of a key ID (a one-bit 'L' value takes a byte)
+#define UBX_VALCFG_KEY_SIZE(key) \
+    ((((key) >> 28) & 7) == 1 ? 1 : (((key) >> 28) & 7) == 2 ? 1 : \
+     (((key) >> 28) & 7) == 3 ? 2 : (((key) >> 28) & 7) == 4 ? 4 : \
+     (((key) >> 28) & 7) == 5 ? 8 : 0)
+
+typedef enum {
+    UBX_VAL_L,  UBX_VAL_U1, UBX_VAL_U2, UBX_VAL_U4, UBX_VAL_U8,
+    UBX_VAL_I1, UBX_VAL_I2, UBX_VAL_I4, UBX_VAL_I8,
+    UBX_VAL_E1, UBX_VAL_E2, UBX_VAL_E4,
+    UBX_VAL_X1, UBX_VAL_X2, UBX_VAL_X4, UBX_VAL_X8,
+    UBX_VAL_R4, UBX_VAL_R8,
+} ubx_val_type_t;
+
+#define UBX_VAL_SIZE_L  1
+#define UBX_VAL_SIZE_U1 1
+#define UBX_VAL_SIZE_U2 2
+#define UBX_VAL_SIZE_U4 4
+#define UBX_VAL_SIZE_U8 8
+#define UBX_VAL_SIZE_I1 1
+#define UBX_VAL_SIZE_I2 2
+#define UBX_VAL_SIZE_I4 4
+#define UBX_VAL_SIZE_I8 8
+#define UBX_VAL_SIZE_E1 1
+#define UBX_VAL_SIZE_E2 2
+#define UBX_VAL_SIZE_E4 4
+#define UBX_VAL_SIZE_X1 1
+#define UBX_VAL_SIZE_X2 2
+#define UBX_VAL_SIZE_X4 4
+#define UBX_VAL_SIZE_X8 8
+#define UBX_VAL_SIZE_R4 4
+#define UBX_VAL_SIZE_R8 8
+
+// CFG-MSGOUT-NMEA_ID_<msg>_<port> keys are numbered I2C, UART1, UART2, USB,
+// SPI from the I2C key, the same order as the UBX_PORT_* IDs
+#define UBX_VALCFG_NMEA_PORTS(X, msg, base)                                              \
+    X(CFG_MSGOUT_NMEA_ID_##msg##_I2C,   "CFG-MSGOUT-NMEA_ID_" #msg "_I2C",   (base) + 0, U1) \
+    X(CFG_MSGOUT_NMEA_ID_##msg##_UART1, "CFG-MSGOUT-NMEA_ID_" #msg "_UART1", (base) + 1, U1) \
+    X(CFG_MSGOUT_NMEA_ID_##msg##_UART2, "CFG-MSGOUT-NMEA_ID_" #msg "_UART2", (base) + 2, U1) \
+    X(CFG_MSGOUT_NMEA_ID_##msg##_USB,   "CFG-MSGOUT-NMEA_ID_" #msg "_USB",   (base) + 3, U1) \
+    X(CFG_MSGOUT_NMEA_ID_##msg##_SPI,   "CFG-MSGOUT-NMEA_ID_" #msg "_SPI",   (base) + 4, U1)
+
+// --- Key table: X(symbol, name, key ID, type) ---
+#define UBX_VALCFG_KEYS(X)                                                       \
+    UBX_VALCFG_NMEA_PORTS(X, DTM, 0x209100a6)                                    \
+    UBX_VALCFG_NMEA_PORTS(X, RMC, 0x209100ab)                                    \
+    UBX_VALCFG_NMEA_PORTS(X, VTG, 0x209100b0)                                    \
+    UBX_VALCFG_NMEA_PORTS(X, GNS, 0x209100b5)                                    \
+    UBX_VALCFG_NMEA_PORTS(X, GGA, 0x209100ba)                                    \
+    UBX_VALCFG_NMEA_PORTS(X, GSA, 0x209100bf)                                    \
+    UBX_VALCFG_NMEA_PORTS(X, GSV, 0x209100c4)                                    \
+    UBX_VALCFG_NMEA_PORTS(X, GLL, 0x209100c9)                                    \
+    UBX_VALCFG_NMEA_PORTS(X, GRS, 0x209100ce)                                    \
+    UBX_VALCFG_NMEA_PORTS(X, GST, 0x209100d3)                                    \
+    UBX_VALCFG_NMEA_PORTS(X, ZDA, 0x209100d8)                                    \
+    UBX_VALCFG_NMEA_PORTS(X, GBS, 0x209100dd)                                    \
+    UBX_VALCFG_NMEA_PORTS(X, THS, 0x209100e2)                                    \
+    UBX_VALCFG_NMEA_PORTS(X, VLW, 0x209100e7)                                    \
+    X(CFG_MSGOUT_UBX_NAV_PVT_I2C,       "CFG-MSGOUT-UBX_NAV_PVT_I2C",       0x20910006, U1) \
+    X(CFG_MSGOUT_UBX_NAV_PVT_UART1,     "CFG-MSGOUT-UBX_NAV_PVT_UART1",     0x20910007, U1) \
+    X(CFG_MSGOUT_UBX_NAV_PVT_UART2,     "CFG-MSGOUT-UBX_NAV_PVT_UART2",     0x20910008, U1) \
+    X(CFG_MSGOUT_UBX_NAV_PVT_USB,       "CFG-MSGOUT-UBX_NAV_PVT_USB",       0x20910009, U1) \
+    X(CFG_MSGOUT_UBX_NAV_PVT_SPI,       "CFG-MSGOUT-UBX_NAV_PVT_SPI",       0x2091000a, U1) \
+    X(CFG_MSGOUT_UBX_NAV_TIMEUTC_I2C,   "CFG-MSGOUT-UBX_NAV_TIMEUTC_I2C",   0x2091005b, U1) \
+    X(CFG_MSGOUT_UBX_NAV_TIMEUTC_UART1, "CFG-MSGOUT-UBX_NAV_TIMEUTC_UART1", 0x2091005c, U1) \
+    X(CFG_MSGOUT_UBX_NAV_TIMEUTC_UART2, "CFG-MSGOUT-UBX_NAV_TIMEUTC_UART2", 0x2091005d, U1) \
+    X(CFG_MSGOUT_UBX_NAV_TIMEUTC_USB,   "CFG-MSGOUT-UBX_NAV_TIMEUTC_USB",   0x2091005e, U1) \
+    X(CFG_MSGOUT_UBX_NAV_TIMEUTC_SPI,   "CFG-MSGOUT-UBX_NAV_TIMEUTC_SPI",   0x2091005f, U1) \
+    X(CFG_INFMSG_UBX_I2C,        "CFG-INFMSG-UBX_I2C",        0x20920001, X1)    \
+    X(CFG_INFMSG_UBX_UART1,      "CFG-INFMSG-UBX_UART1",      0x20920002, X1)    \
+    X(CFG_INFMSG_UBX_UART2,      "CFG-INFMSG-UBX_UART2",      0x20920003, X1)    \
+    X(CFG_INFMSG_UBX_USB,        "CFG-INFMSG-UBX_USB",        0x20920004, X1)    \
+    X(CFG_INFMSG_UBX_SPI,        "CFG-INFMSG-UBX_SPI",        0x20920005, X1)    \
+    X(CFG_INFMSG_NMEA_I2C,       "CFG-INFMSG-NMEA_I2C",       0x20920006, X1)    \
+    X(CFG_INFMSG_NMEA_UART1,     "CFG-INFMSG-NMEA_UART1",     0x20920007, X1)    \
+    X(CFG_INFMSG_NMEA_UART2,     "CFG-INFMSG-NMEA_UART2",     0x20920008, X1)    \
+    X(CFG_INFMSG_NMEA_USB,       "CFG-INFMSG-NMEA_USB",       0x20920009, X1)    \
+    X(CFG_INFMSG_NMEA_SPI,       "CFG-INFMSG-NMEA_SPI",       0x2092000a, X1)    \
+    X(CFG_I2COUTPROT_UBX,        "CFG-I2COUTPROT-UBX",        0x10720001, L)     \
+    X(CFG_I2COUTPROT_NMEA,       "CFG-I2COUTPROT-NMEA",       0x10720002, L)     \
+    X(CFG_UART1INPROT_UBX,       "CFG-UART1INPROT-UBX",       0x10730001, L)     \
+    X(CFG_UART1INPROT_NMEA,      "CFG-UART1INPROT-NMEA",      0x10730002, L)     \
+    X(CFG_UART1OUTPROT_UBX,      "CFG-UART1OUTPROT-UBX",      0x10740001, L)     \
+    X(CFG_UART1OUTPROT_NMEA,     "CFG-UART1OUTPROT-NMEA",     0x10740002, L)     \
+    X(CFG_UART2OUTPROT_UBX,      "CFG-UART2OUTPROT-UBX",      0x10760001, L)     \
+    X(CFG_UART2OUTPROT_NMEA,     "CFG-UART2OUTPROT-NMEA",     0x10760002, L)     \
+    X(CFG_USBINPROT_UBX,         "CFG-USBINPROT-UBX",         0x10770001, L)     \
+    X(CFG_USBINPROT_NMEA,        "CFG-USBINPROT-NMEA",        0x10770002, L)     \
+    X(CFG_USBOUTPROT_UBX,        "CFG-USBOUTPROT-UBX",        0x10780001, L)     \
+    X(CFG_USBOUTPROT_NMEA,       "CFG-USBOUTPROT-NMEA",       0x10780002, L)     \
+    X(CFG_SPIOUTPROT_UBX,        "CFG-SPIOUTPROT-UBX",        0x107a0001, L)     \
+    X(CFG_SPIOUTPROT_NMEA,       "CFG-SPIOUTPROT-NMEA",       0x107a0002, L)     \
+    X(CFG_UART1_BAUDRATE,        "CFG-UART1-BAUDRATE",        0x40520001, U4)    \
+    X(CFG_UART2_BAUDRATE,        "CFG-UART2-BAUDRATE",        0x40530001, U4)    \
+    X(CFG_RATE_MEAS,             "CFG-RATE-MEAS",             0x30210001, U2)    \
+    X(CFG_RATE_NAV,              "CFG-RATE-NAV",              0x30210002, U2)    \
+    X(CFG_RATE_TIMEREF,          "CFG-RATE-TIMEREF",          0x20210003, E1)    \
+    X(CFG_SIGNAL_GPS_ENA,        "CFG-SIGNAL-GPS_ENA",        0x1031001f, L)     \
+    X(CFG_SIGNAL_SBAS_ENA,       "CFG-SIGNAL-SBAS_ENA",       0x10310020, L)     \
+    X(CFG_SIGNAL_GAL_ENA,        "CFG-SIGNAL-GAL_ENA",        0x10310021, L)     \
+    X(CFG_SIGNAL_BDS_ENA,        "CFG-SIGNAL-BDS_ENA",        0x10310022, L)     \
+    X(CFG_SIGNAL_QZSS_ENA,       "CFG-SIGNAL-QZSS_ENA",       0x10310024, L)     \
+    X(CFG_SIGNAL_GLO_ENA,        "CFG-SIGNAL-GLO_ENA",        0x10310025, L)     \
+    X(CFG_TP_PULSE_DEF,          "CFG-TP-PULSE_DEF",          0x20050023, E1)    \
+    X(CFG_TP_PULSE_LENGTH_DEF,   "CFG-TP-PULSE_LENGTH_DEF",   0x20050030, E1)    \
+    X(CFG_TP_PERIOD_TP1,         "CFG-TP-PERIOD_TP1",         0x40050002, U4)    \
+    X(CFG_TP_PERIOD_LOCK_TP1,    "CFG-TP-PERIOD_LOCK_TP1",    0x40050003, U4)    \
+    X(CFG_TP_LEN_TP1,            "CFG-TP-LEN_TP1",            0x40050004, U4)    \
+    X(CFG_TP_LEN_LOCK_TP1,       "CFG-TP-LEN_LOCK_TP1",       0x40050005, U4)    \
+    X(CFG_TP_USER_DELAY_TP1,     "CFG-TP-USER_DELAY_TP1",     0x40050006, I4)    \
+    X(CFG_TP_TP1_ENA,            "CFG-TP-TP1_ENA",            0x10050007, L)     \
+    X(CFG_TP_SYNC_GNSS_TP1,      "CFG-TP-SYNC_GNSS_TP1",      0x10050008, L)     \
+    X(CFG_TP_USE_LOCKED_TP1,     "CFG-TP-USE_LOCKED_TP1",     0x10050009, L)     \
+    X(CFG_TP_ALIGN_TO_TOW_TP1,   "CFG-TP-ALIGN_TO_TOW_TP1",   0x1005000a, L)     \
+    X(CFG_TP_POL_TP1,            "CFG-TP-POL_TP1",            0x1005000b, L)     \
+    X(CFG_TP_TIMEGRID_TP1,       "CFG-TP-TIMEGRID_TP1",       0x2005000c, E1)    \
+    X(CFG_TMODE_MODE,            "CFG-TMODE-MODE",            0x20030001, E1)    \
+    X(CFG_TMODE_POS_TYPE,        "CFG-TMODE-POS_TYPE",        0x20030002, E1)    \
+    X(CFG_TMODE_ECEF_X,          "CFG-TMODE-ECEF_X",          0x40030003, I4)    \
+    X(CFG_TMODE_ECEF_Y,          "CFG-TMODE-ECEF_Y",          0x40030004, I4)    \
+    X(CFG_TMODE_ECEF_Z,          "CFG-TMODE-ECEF_Z",          0x40030005, I4)    \
+    X(CFG_TMODE_ECEF_X_HP,       "CFG-TMODE-ECEF_X_HP",       0x20030006, I1)    \
+    X(CFG_TMODE_ECEF_Y_HP,       "CFG-TMODE-ECEF_Y_HP",       0x20030007, I1)    \
+    X(CFG_TMODE_ECEF_Z_HP,       "CFG-TMODE-ECEF_Z_HP",       0x20030008, I1)    \
+    X(CFG_TMODE_FIXED_POS_ACC,   "CFG-TMODE-FIXED_POS_ACC",   0x4003000f, U4)    \
+    X(CFG_TMODE_SVIN_MIN_DUR,    "CFG-TMODE-SVIN_MIN_DUR",    0x40030010, U4)    \
+    X(CFG_TMODE_SVIN_ACC_LIMIT,  "CFG-TMODE-SVIN_ACC_LIMIT",  0x40030011, U4)
+
+#define UBX_VALCFG_ENUM(sym, name, id, type) UBX_KEY_##sym = (uint32_t)(id),
+enum { UBX_VALCFG_KEYS(UBX_VALCFG_ENUM) };
+#undef UBX_VALCFG_ENUM
+
+#define UBX_VALCFG_CHECK(sym, name, id, type) \
+    _Static_assert(UBX_VALCFG_KEY_SIZE(id) == UBX_VAL_SIZE_##type, name ": type does not match key size");
+UBX_VALCFG_KEYS(UBX_VALCFG_CHECK)
+#undef UBX_VALCFG_CHECK
+
+typedef struct {
+    uint32_t key;
+    const char *name;
+    ubx_val_type_t type;
+} ubx_valcfg_key_t;
+
+#define UBX_VALCFG_ENTRY(sym, name, id, type) { (uint32_t)(id), name, UBX_VAL_##type },
+static const ubx_valcfg_key_t ubx_valcfg_keys[] = { UBX_VALCFG_KEYS(UBX_VALCFG_ENTRY) };
+#undef UBX_VALCFG_ENTRY
+
+// One configuration item; 'value' holds the raw little-endian bits
+typedef struct {
+    uint32_t key;
+    uint64_t value;
+} ubx_valcfg_kv_t;
+
+static inline size_t ubx_valcfg_size(uint32_t key)
+{
+    return UBX_VALCFG_KEY_SIZE(key);
+}
+
+static inline const ubx_valcfg_key_t *ubx_valcfg_find(uint32_t key)
+{
+    for (size_t i = 0; i < SIZEOF(ubx_valcfg_keys); i++) {
+        if (ubx_valcfg_keys[i].key == key)
+            return &ubx_valcfg_keys[i];
+    }
+    return NULL;
+}
+
+// Key by name (case-insensitive, '_' and '-' interchangeable after CFG-)
+// or by numeric ID, e.g. "CFG-RATE-MEAS" or "0x30210001".  Returns 0 if unknown.
+static inline uint32_t ubx_valcfg_lookup(const char *name)
+{
+    if (name[0] == '0' && (name[1] == 'x' || name[1] == 'X')) {
+        char *end;
+        errno = 0;
+        unsigned long key = strtoul(name, &end, 16);
+        if (errno || *end || key == 0 || key > 0xFFFFFFFFUL || ubx_valcfg_size(key) == 0)
+            return 0;
+        return (uint32_t)key;
+    }
+    for (size_t i = 0; i < SIZEOF(ubx_valcfg_keys); i++) {
+        const char *a = ubx_valcfg_keys[i].name, *b = name;
+        while (*a && *b && (toupper((unsigned char)*a) == toupper((unsigned char)*b) ||
+                            ((*a == '-' || *a == '_') && (*b == '-' || *b == '_')))) {
+            a++;
+            b++;
+        }
+        if (!*a && !*b)
+            return ubx_valcfg_keys[i].key;
+    }
+    return 0;
+}
+
+// Name of a key, or its hex ID for keys not in the table
+static inline const char *ubx_valcfg_name(uint32_t key)
+{
+    const ubx_valcfg_key_t *k = ubx_valcfg_find(key);
+    if (k)
+        return k->name;
+
+    static _Thread_local char buffers[4][12];
+    static _Thread_local int index = 0;
+    char *output_str = buffers[index];
+    index = (index + 1) % (sizeof(buffers) / sizeof(buffers[0]));
+    snprintf(output_str, sizeof(buffers[0]), "0x%08" PRIx32, key);
+    return output_str;
+}
+
+static inline ubx_val_type_t ubx_valcfg_type(uint32_t key)
+{
+    const ubx_valcfg_key_t *k = ubx_valcfg_find(key);
+    if (k)
+        return k->type;
+    switch (ubx_valcfg_size(key)) {     // unknown key: show it as raw bits
+        case 2:  return UBX_VAL_X2;
+        case 4:  return UBX_VAL_X4;
+        case 8:  return UBX_VAL_X8;
+        default: return ((key >> 28) & 7) == 1 ? UBX_VAL_L : UBX_VAL_X1;
+    }
+}
+
+/*
+ * ubx_valset_build()
+ * ------------------
+ * Builds one UBX-CFG-VALSET frame writing 'n' items (at most
+ * UBX_VALSET_MAX_KEYS) to 'layers'.  'txn' is one of UBX_VALSET_TXN_*;
+ * anything but UBX_VALSET_TXN_NONE makes it a version 1 (transactional)
+ * frame.  Returns the frame length, or 0 if it does not fit.
+ */
+static inline size_t ubx_valset_build(uint8_t *out, size_t size, uint8_t layers, uint8_t txn,
+                                      const ubx_valcfg_kv_t *kv, size_t n)
+{
+    uint8_t payload[UBX_MAX_PAYLOAD_SIZE];
+    size_t len = UBX_VALCFG_HDR_LEN;
+
+    if (n > UBX_VALSET_MAX_KEYS)
+        return 0;
+    payload[0] = (txn == UBX_VALSET_TXN_NONE) ? 0 : 1;
+    payload[1] = layers;
+    payload[2] = txn & 3;
+    payload[3] = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        size_t vlen = ubx_valcfg_size(kv[i].key);
+        if (vlen == 0 || len + 4 + vlen > sizeof(payload))
+            return 0;
+        for (int b = 0; b < 4; b++)
+            payload[len++] = (kv[i].key >> (8 * b)) & 0xFF;
+        for (size_t b = 0; b < vlen; b++)
+            payload[len++] = (kv[i].value >> (8 * b)) & 0xFF;
+    }
+    return ubx_frame_build(out, size, UBX_CLS_CFG, UBX_ID_CFG_VALSET, payload, len);
+}
+
+/*
+ * ubx_valget_build()
+ * ------------------
+ * Builds a UBX-CFG-VALGET poll for 'n' keys (at most UBX_VALGET_MAX_KEYS) of
+ * one layer.  A key may use the group wildcard 0xffff in its low bits; the
+ * answer then starts at item 'position' of the group.
+ */
+static inline size_t ubx_valget_build(uint8_t *out, size_t size, uint8_t layer, uint16_t position,
+                                      const uint32_t *keys, size_t n)
+{
+    uint8_t payload[UBX_VALCFG_HDR_LEN + 4 * UBX_VALGET_MAX_KEYS];
+    size_t len = UBX_VALCFG_HDR_LEN;
+
+    if (n > UBX_VALGET_MAX_KEYS)
+        return 0;
+    payload[0] = 0;
+    payload[1] = layer;
+    payload[2] = position & 0xFF;
+    payload[3] = position >> 8;
+    for (size_t i = 0; i < n; i++) {
+        for (int b = 0; b < 4; b++)
+            payload[len++] = (keys[i] >> (8 * b)) & 0xFF;
+    }
+    return ubx_frame_build(out, size, UBX_CLS_CFG, UBX_ID_CFG_VALGET, payload, len);
+}
+
+// Walk the key-value pairs after the 4-byte header of a VALSET or VALGET
+// response.  Returns false at the end or on a truncated item.
+static inline bool ubx_valcfg_next(const uint8_t **pos, const uint8_t *end, ubx_valcfg_kv_t *kv)
+{
+    const uint8_t *p = *pos;
+    if (end - p < 4)
+        return false;
+    uint32_t key = p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+    size_t vlen = ubx_valcfg_size(key);
+    if (vlen == 0 || (size_t)(end - p) < 4 + vlen)
+        return false;
+
+    kv->key = key;
+    kv->value = 0;
+    for (size_t b = 0; b < vlen; b++)
+        kv->value |= (uint64_t)p[4 + b] << (8 * b);
+    *pos = p + 4 + vlen;
+    return true;
+}
+
+// Find 'key' in a VALGET response payload
+static inline bool ubx_valget_find(const uint8_t *payload, size_t len, uint32_t key, uint64_t *value)
+{
+    if (len < UBX_VALCFG_HDR_LEN)
+        return false;
+    const uint8_t *p = payload + UBX_VALCFG_HDR_LEN, *end = payload + len;
+    ubx_valcfg_kv_t kv;
+    while (ubx_valcfg_next(&p, end, &kv)) {
+        if (kv.key == key) {
+            *value = kv.value;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Value as text: signed, unsigned, hex, float or 0/1 depending on the type
+static inline int ubx_valcfg_format(const ubx_valcfg_kv_t *kv, char *buf, size_t size)
+{
+    const char *name = ubx_valcfg_name(kv->key);
+    uint64_t v = kv->value;
+
+    switch (ubx_valcfg_type(kv->key)) {
+        case UBX_VAL_I1: return snprintf(buf, size, "%s=%d", name, (int8_t)v);
+        case UBX_VAL_I2: return snprintf(buf, size, "%s=%d", name, (int16_t)v);
+        case UBX_VAL_I4: return snprintf(buf, size, "%s=%" PRId32, name, (int32_t)v);
+        case UBX_VAL_I8: return snprintf(buf, size, "%s=%" PRId64, name, (int64_t)v);
+        case UBX_VAL_X1: case UBX_VAL_X2: case UBX_VAL_X4: case UBX_VAL_X8:
+            return snprintf(buf, size, "%s=0x%" PRIx64, name, v);
+        case UBX_VAL_R4: {
+            float f;
+            uint32_t u = (uint32_t)v;
+            memcpy(&f, &u, sizeof(f));
+            return snprintf(buf, size, "%s=%g", name, f);
+        }
+        case UBX_VAL_R8: {
+            double d;
+            memcpy(&d, &v, sizeof(d));
+            return snprintf(buf, size, "%s=%.17g", name, d);
+        }
+        default:
+            return snprintf(buf, size, "%s=%" PRIu64, name, v);
+    }
+}
+
+/*
+ * ubx_valcfg_parse()
+ * ------------------
+ * Parses "NAME=VALUE" into 'kv'.  Values are integers in any C base, on/off
+ * for one-bit keys, or decimals for R4/R8 keys, and must fit the key's type.
+ * Returns 0 on success, or -1 with a reason in 'err'.
+ */
+static inline int ubx_valcfg_parse(const char *text, ubx_valcfg_kv_t *kv, char *err, size_t err_size)
+{
+    char name[64];
+    const char *eq = strchr(text, '=');
+    if (!eq || eq == text || (size_t)(eq - text) >= sizeof(name)) {
+        snprintf(err, err_size, "expected KEY=VALUE: %.80s", text);
+        return -1;
+    }
+    memcpy(name, text, eq - text);
+    name[eq - text] = '\0';
+    const char *val = eq + 1;
+
+    uint32_t key = ubx_valcfg_lookup(name);
+    if (!key) {
+        snprintf(err, err_size, "unknown key: %s", name);
+        return -1;
+    }
+    ubx_val_type_t type = ubx_valcfg_type(key);
+    size_t vlen = ubx_valcfg_size(key);
+    char *end = NULL;
+    uint64_t v;
+
+    errno = 0;
+    if (type == UBX_VAL_L && (!strcasecmp(val, "on") || !strcasecmp(val, "true"))) {
+        v = 1;
+    } else if (type == UBX_VAL_L && (!strcasecmp(val, "off") || !strcasecmp(val, "false"))) {
+        v = 0;
+    } else if (type == UBX_VAL_R4) {
+        float f = strtof(val, &end);
+        uint32_t u;
+        memcpy(&u, &f, sizeof(u));
+        v = u;
+    } else if (type == UBX_VAL_R8) {
+        double d = strtod(val, &end);
+        memcpy(&v, &d, sizeof(v));
+    } else if (type >= UBX_VAL_I1 && type <= UBX_VAL_I8) {
+        long long s = strtoll(val, &end, 0);
+        long long lim = (vlen == 8) ? INT64_MAX : (1LL << (8 * vlen - 1)) - 1;
+        if (s > lim || s < -lim - 1)
+            errno = ERANGE;
+        v = (uint64_t)s & (vlen == 8 ? UINT64_MAX : (1ULL << (8 * vlen)) - 1);
+    } else {
+        if (*val == '-')
+            errno = ERANGE;
+        v = strtoull(val, &end, 0);
+        if (vlen < 8 && v >> (8 * vlen))
+            errno = ERANGE;
+        if (type == UBX_VAL_L && v > 1)
+            errno = ERANGE;
+    }
+    if (end && (end == val || *end)) {
+        snprintf(err, err_size, "bad value for %s: %.40s", name, val);
+        return -1;
+    }
+    if (errno) {
+        snprintf(err, err_size, "value out of range for %s: %.40s", name, val);
+        return -1;
+    }
+
+    kv->key = key;
+    kv->value = v;
+    return 0;
+}
+
+// Layers named like "ram,bbr,flash" (VALSET mask); 0 if invalid
+static inline uint8_t ubx_valcfg_parse_layers(const char *s)
+{
+    uint8_t layers = 0;
+    while (*s) {
+        size_t n = strcspn(s, ",+");
+        if (n == 3 && !strncasecmp(s, "ram", n))        layers |= UBX_VAL_LAYER_RAM;
+        else if (n == 3 && !strncasecmp(s, "bbr", n))   layers |= UBX_VAL_LAYER_BBR;
+        else if (n == 5 && !strncasecmp(s, "flash", n)) layers |= UBX_VAL_LAYER_FLASH;
+        else return 0;
+        s += n;
+        if (*s)
+            s++;
+    }
+    return layers;
+}
+
+
+#endif // UBX_VALCFG_H
@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+################################################################################
+# bench-pp-checksum.py
+#
+# Purpose:
+#   Compile-time benchmark of the PP_SUM/PP_CSUM checksum macros used by
+#   UBX_MESSAGE. The headers in src/ are compared with the previous
+#   fixed-arity scheme (PP_SUM_1 .. PP_SUM_256 dispatched on PP_NARG),
+#   which this script regenerates into a scratch directory. Each case is
+#   compiled with both, timed (best of --runs) and, where the old headers
+#   can compile it at all, checked for identical .rodata, i.e. identical
+#   message bytes and checksums.
+#
+#   Cases:
+#     include      an empty unit including ubx_message.h
+#     ubx_defs     the built-in message table (ubx_defs.h)
+#     payload-N    --count messages with an N byte payload each
+#
+# Usage:
+#   ./bench-pp-checksum.py [--cc gcc] [--runs 10] [--count 20]
+#
+# Example:
+#   $ ./bench-pp-checksum.py --cc clang
+#
+# Copyright (C) 2025 Richard Elwell
+# Licensed under GPLv3 or later
+################################################################################
+
+import argparse
+import os
+import resource
+import shutil
+import subprocess
+import sys
+import tempfile
+
+SRC = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src")
+OLD_MAX = 256
+
+OLD_UTILS = """\
+#ifndef PP_UTILS_H_
+#define PP_UTILS_H_
+#define PP_JOIN_INNER(a,b) a##b
+#define PP_JOIN(a,b) PP_JOIN_INNER(a,b)
+#define PP_NARG(...) PP_NARG_(__VA_ARGS__, PP_RSEQ_N())
+#define PP_NARG_(...) PP_ARG_N(__VA_ARGS__)
+#include "pp_arg.h"
+#define PP_SUM(...) PP_JOIN(PP_SUM_, PP_NARG(__VA_ARGS__))(__VA_ARGS__)
+#define PP_CSUM(...) PP_JOIN(PP_CSUM_, PP_NARG(__VA_ARGS__))(__VA_ARGS__)
+#include "pp_sum.h"
+#include "pp_csum.h"
+#endif
+"""
+
+def old_headers(d):
+    """Write the fixed-arity headers over the copy of src/ in 'd'."""
+    # PP_MAP (typed messages) is unchanged, take it from the current header
+    with open(os.path.join(SRC, "pp_utils.h")) as f:
+        pp_map = [l for l in f if l.startswith("#define PP_MAP")]
+    with open(os.path.join(d, "pp_utils.h"), "w") as f:
+        f.write(OLD_UTILS.replace("#endif\n", "".join(pp_map) + "#endif\n"))
+    for name, weight in (("SUM", lambda i, j: ""), ("CSUM", lambda i, j: f"{i - j + 1}*")):
+        with open(os.path.join(d, f"pp_{name.lower()}.h"), "w") as f:
+            for i in range(1, OLD_MAX + 1):
+                args = ",".join(f"a{j}" for j in range(1, i + 1))
+                terms = "+".join(f"{weight(i, j)}a{j}" for j in range(1, i + 1))
+                f.write(f"#define PP_{name}_{i}({args}) ({terms})\n")
+
+def unit(case, count):
+    lines = ["#include <stdint.h>", "#include <string.h>"]
+    if case == "include":
+        lines.append('#include "ubx_message.h"')
+    elif case == "ubx_defs":
+        lines.append('#include "ubx_defs.h"')
+    else:
+        size = int(case.split("-")[1])
+        lines.append('#include "ubx_message.h"')
+        for m in range(count):
+            payload = ", ".join(f"0x{(m * 31 + i * 7) & 0xFF:02X}" for i in range(size))
+            lines.append(f"UBX_MESSAGE(bench_{m}, 0x13, 0x40, {payload})")
+    return "\n".join(lines) + "\n"
+
+def compile_time(cc, d, src, runs):
+    obj = src + ".o"
+    cmd = [cc, "-std=c11", "-O0", "-w", "-I", d, "-c", src, "-o", obj]
+    best = None
+    for _ in range(runs):
+        # CPU time of the compiler, steadier than wall time on a busy host
+        r0 = resource.getrusage(resource.RUSAGE_CHILDREN)
+        r = subprocess.run(cmd, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+        r1 = resource.getrusage(resource.RUSAGE_CHILDREN)
+        t = (r1.ru_utime - r0.ru_utime) + (r1.ru_stime - r0.ru_stime)
+        if r.returncode != 0:
+            return None, None
+        best = t if best is None else min(best, t)
+    rodata = obj + ".rodata"
+    subprocess.run(["objcopy", "-O", "binary", "--only-section=.rodata", obj, rodata], check=True)
+    with open(rodata, "rb") as f:
+        return best, f.read()
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__)
+    ap.add_argument("--cc", default=os.environ.get("CC", "gcc"))
+    ap.add_argument("--runs", type=int, default=10)
+    ap.add_argument("--count", type=int, default=20, help="messages per payload case")
+    a = ap.parse_args()
+
+    cases = ["include", "ubx_defs", "payload-16", "payload-100", "payload-248", "payload-1016"]
+    tmp = tempfile.mkdtemp(prefix="bench-pp-")
+    rc = 0
+    try:
+        dirs = {}
+        for which in ("old", "new"):
+            d = dirs[which] = os.path.join(tmp, which)
+            shutil.copytree(SRC, d, ignore=shutil.ignore_patterns("*.c"))
+        old_headers(dirs["old"])
+
+        print(f"{'case':<14} {'old [ms]':>10} {'new [ms]':>10} {'speedup':>8}  bytes")
+        for case in cases:
+            src = os.path.join(tmp, case + ".c")
+            with open(src, "w") as f:
+                f.write(unit(case, a.count))
+            t_old, b_old = compile_time(a.cc, dirs["old"], src, a.runs)
+            t_new, b_new = compile_time(a.cc, dirs["new"], src, a.runs)
+            if t_new is None:
+                print(f"{case:<14} new headers failed to compile", file=sys.stderr)
+                rc = 1
+                continue
+            if t_old is None:
+                print(f"{case:<14} {'n/a':>10} {t_new * 1e3:10.1f} {'':>8}  (over {OLD_MAX} arguments)")
+                continue
+            same = "same" if b_old == b_new else "DIFFER"
+            if b_old != b_new:
+                rc = 1
+            print(f"{case:<14} {t_old * 1e3:10.1f} {t_new * 1e3:10.1f} {t_old / t_new:7.2f}x  {same}")
+    finally:
+        shutil.rmtree(tmp, ignore_errors=True)
+    return rc
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -6,25 +6,78 @@
 #   Generate C preprocessor macros for computing weighted cumulative sums
 #   at compile time. This is useful for generating UBX message checksums
 #   during compile-time assembly. The script produces macros of the form:
-#     - PP_CSUM_1, PP_CSUM_2, ..., PP_CSUM_N
-#   Each macro computes the sum: (N*a1 + (N-1)*a2 + ... + 1*aN)
+#     - PP_CSUM_L0, PP_CSUM_L1, ..., PP_CSUM_L<LEVELS-1>
+#   Together they compute the index-weighted sum (0*a1 + 1*a2 + ... +
+#   (N-1)*aN), from which PP_CSUM (pp_utils.h) forms
+#     N*a1 + (N-1)*a2 + ... + 1*aN  =  N*PP_SUM(...) - (0*a1 + ... + (N-1)*aN)
+#   The levels are chained as in gen-sum-macros.py, CHUNK arguments each.
 #
 # Usage:
-#   Run this script to output macro definitions directly to stdout, which
-#   can then be redirected into a header file (e.g., pp_csum.h).
+#   Run this script to output the header directly to stdout, which can
+#   then be redirected into a header file (e.g., pp_csum.h).
 #
 # Example:
-#   $ ./gen-csum-macros.py >pp_csum.h
+#   $ ./gen-csum-macros.py >../src/pp_csum.h
 #
 # Copyright (C) 2025 Richard Elwell
 # Licensed under GPLv3 or later
 ################################################################################
 
-def gen_csum_macros(n):
-    for i in range(1, n + 1):
-        args = ",".join(f"a{j}" for j in range(1, i + 1))
-        terms = "+".join(f"{i - j + 1}*a{j}" for j in range(1, i + 1))
-        print(f"#define PP_CSUM_{i}({args}) ({terms})")
+CHUNK = 32      # must match the padding in PP_SUM and PP_CSUM (pp_utils.h)
+LEVELS = 32     # CHUNK * LEVELS arguments, UBX_MAX_PAYLOAD_SIZE + 4 fits
 
-gen_csum_macros(256)
+HEADER = """\
+#ifndef PP_CSUM_H_
+#define PP_CSUM_H_
+/*******************************************************************************
+ pp_csum.h - Preprocessor macros for cumulative sum expansion
 
+ Generated by test/gen-csum-macros.py, do not edit.
+
+ Defines macros that expand each argument into a cumulative sum of the arguments
+
+ Example:
+   The cumulative sum expansion of (a, b, c, d) is:
+     a + a+b + a+b+c + a+b+c+d
+
+   But, we expand a simplified expression here:
+     4*a + 3*b + 2*c + 1*d
+
+   which PP_CSUM evaluates as 4*(a+b+c+d) - (0*a + 1*b + 2*c + 3*d), so the
+   weight of an argument depends only on its position, not on the length
+   of the list.  The PP_CSUM_Lk macros below produce the second term,
+   {chunk} arguments per level, chained like the PP_SUM_Lk macros.
+
+   PP_CSUM(1, 2, 3, 4)   ->  20
+
+ Copyright (C) 2025 Richard Elwell
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*******************************************************************************/
+"""
+
+def gen_csum_macros(chunk, levels):
+    print(HEADER.format(chunk=chunk))
+    args = ",".join(f"a{j}" for j in range(chunk))
+    for k in range(levels):
+        terms = "+".join(f"{k * chunk + j}*(a{j}+0)" for j in range(chunk))
+        print(f"#define PP_CSUM_L{k}({args},...) +{terms} "
+              f"PP_JOIN(PP_CSUM_L{k + 1}, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)")
+        print(f"#define PP_CSUM_L{k + 1}_END(...)")
+    print(f"#define PP_CSUM_L{levels}(...) +PP_SUM_TOO_MANY_ARGUMENTS")
+    print()
+    print("#endif // PP_CSUM_H_")
+
+gen_csum_macros(CHUNK, LEVELS)
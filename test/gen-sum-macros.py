@@ -6,26 +6,73 @@
 #   Generate C preprocessor macros for computing the sum of a list of
 #   numeric arguments at compile time. This script produces macros of the
 #   form:
-#     - PP_SUM_1, PP_SUM_2, ..., PP_SUM_N
-#   Each macro computes the sum of its arguments, enabling compile-time
-#   evaluation in UBX message assembly.
+#     - PP_SUM_L0, PP_SUM_L1, ..., PP_SUM_L<LEVELS-1>
+#   Each level adds CHUNK arguments and passes the rest on to the next
+#   level while the first of them is not empty. PP_SUM (pp_utils.h) pads
+#   the list with CHUNK empty arguments, so the expansion stops within a
+#   chunk of the end of the list rather than at a fixed arity, and the
+#   cost grows with the list instead of with the largest list supported.
 #
 # Usage:
-#   Run this script to output macro definitions directly to stdout, which
-#   can then be redirected into a header file (e.g., pp_sum.h).
+#   Run this script to output the header directly to stdout, which can
+#   then be redirected into a header file (e.g., pp_sum.h).
 #
 # Example:
-#   $ ./gen-sum-macros.py >pp_sum.h
+#   $ ./gen-sum-macros.py >../src/pp_sum.h
 #
 # Copyright (C) 2025 Richard Elwell
 # Licensed under GPLv3 or later
 ################################################################################
 
-def gen_sum_macros(n):
-    for i in range(1, n + 1):
-        args = ",".join(f"a{j}" for j in range(1, i + 1))
-        terms = "+".join(f"a{j}" for j in range(1, i + 1))
-        print(f"#define PP_SUM_{i}({args}) ({terms})")
+CHUNK = 32      # must match the padding in PP_SUM and PP_CSUM (pp_utils.h)
+LEVELS = 32     # CHUNK * LEVELS arguments, UBX_MAX_PAYLOAD_SIZE + 4 fits
 
-gen_sum_macros(256)
+HEADER = """\
+#ifndef PP_SUM_H_
+#define PP_SUM_H_
+/*******************************************************************************
+ pp_sum.h - Preprocessor macros for summing argument lists
 
+ Generated by test/gen-sum-macros.py, do not edit.
+
+ Each PP_SUM_Lk macro adds {chunk} arguments, an empty one counting as 0,
+ and continues with PP_SUM_Lk+1 while arguments are left.  Up to {max}
+ arguments are supported; PP_SUM_TOO_MANY_ARGUMENTS is left behind as an
+ undeclared identifier beyond that.
+
+ Example:
+   PP_SUM(1, 2, 3)   ->  6
+
+ Copyright (C) 2025 Richard Elwell
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*******************************************************************************/
+
+#define PP_SUM_MAX {max}
+"""
+
+def gen_sum_macros(chunk, levels):
+    print(HEADER.format(chunk=chunk, max=chunk * levels))
+    args = ",".join(f"a{j}" for j in range(chunk))
+    terms = "+".join(f"(a{j}+0)" for j in range(chunk))
+    for k in range(levels):
+        print(f"#define PP_SUM_L{k}({args},...) +{terms} "
+              f"PP_JOIN(PP_SUM_L{k + 1}, PP_IF_END(__VA_ARGS__))(__VA_ARGS__)")
+        print(f"#define PP_SUM_L{k + 1}_END(...)")
+    print(f"#define PP_SUM_L{levels}(...) +PP_SUM_TOO_MANY_ARGUMENTS")
+    print()
+    print("#endif // PP_SUM_H_")
+
+gen_sum_macros(CHUNK, LEVELS)
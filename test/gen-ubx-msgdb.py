@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+################################################################################
+# gen-ubx-msgdb.py
+#
+# Purpose:
+#   Generate the message description tables used by ubx_msgdb.h from the
+#   u-center 2 message database:
+#     - ucenter2-messages.json   names, groups, fields and bitfields
+#     - ucenter2-variants.json   how a payload selects one of the variants
+#                                of a class/id (length, or a byte in it)
+#   Every public UBX message gets one descriptor per variant, sorted by
+#   class and id so that ubx_msgdb_find() is a binary search. NMEA and
+#   PUBX sentences get a descriptor without fields, for their names.
+#
+# Usage:
+#   Run this script to output the header directly to stdout, which can
+#   then be redirected into a header file (e.g., ubx_msgdb_tables.h).
+#
+# Example:
+#   $ ./gen-ubx-msgdb.py >../src/ubx_msgdb_tables.h
+#   $ ./gen-ubx-msgdb.py --db ucenter2 >../src/ubx_msgdb_tables.h
+#
+# Copyright (C) 2025 Richard Elwell
+# Licensed under GPLv3 or later
+################################################################################
+
+import argparse
+import json
+import os
+import sys
+
+# Classes the database does not describe but receivers do send
+EXTRA_CLASSES = {0x03: "TRK"}
+
+REPEATS = {"once": "ONCE", "optional": "OPTIONAL", "by_size": "BY_SIZE",
+           "by_field": "BY_FIELD", "by_const": "BY_CONST"}
+
+HEADER = """\
+#ifndef UBX_MSGDB_TABLES_H
+#define UBX_MSGDB_TABLES_H
+/*******************************************************************************
+ ubx_msgdb_tables.h
+
+ Generated by test/gen-ubx-msgdb.py from test/ucenter2/ucenter2-messages.json
+ and ucenter2-variants.json, do not edit.  Types and lookups: ubx_msgdb.h.
+
+ {nmsg} descriptors ({nubx} UBX), {nfield} fields, {nbits} bitfields, {nrule} variant rules.
+
+ Copyright (C) 2025 Richard Elwell
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*******************************************************************************/
+"""
+
+def load(path):
+    # the database has a few Latin-1 characters in its descriptions
+    with open(path, encoding="latin-1") as f:
+        return json.load(f)
+
+def flatten_variants(node, conds, out):
+    """Walk a variant decision tree into (conditions, versionName) rules
+    in tree order.  An 'else' branch adds no condition: the rules are
+    tried first to last, so every earlier case has already failed."""
+    switches = node["switch"]
+    if isinstance(switches, dict):
+        switches = [switches]
+    for sw in switches:
+        s = sw["$"]
+        if "type" not in s:
+            out.append((conds, s["versionName"]))
+            continue
+        cond = lambda vals: (s.get("payloadOffset", -1), s["type"], tuple(vals))
+        for case in sw.get("case", []):
+            c = conds + [cond(case["$"]["val"])]
+            if "switch" in case:
+                flatten_variants(case, c, out)
+            else:
+                out.append((c, case["$"]["versionName"]))
+        for other in sw.get("else", []):
+            if "switch" in other:
+                flatten_variants(other, conds, out)
+            else:
+                out.append((conds, other["$"]["versionName"]))
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("--db", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), "ucenter2"))
+    a = ap.parse_args()
+
+    messages = load(os.path.join(a.db, "ucenter2-messages.json"))["messages"]
+    variants = load(os.path.join(a.db, "ucenter2-variants.json"))["variants"]
+
+    ubx = [m for m in messages.values() if m["protocolName"] == "UBX" and m["audience"] == "PUB"]
+    nmea = [m for m in messages.values() if m["protocolName"] == "NMEA" and m["audience"] == "PUB"]
+    ubx.sort(key=lambda m: (m["classId"], m["messageId"], m["versionId"], m["versionName"]))
+
+    classes = dict(EXTRA_CLASSES)
+    for m in ubx + nmea:
+        classes.setdefault(m["classId"], m["className"])
+
+    bits, fields, groups, msgs = [], [], [], []
+    index = {}
+    for m in ubx:
+        index[(m["label"], m["versionName"])] = len(msgs)
+        group_first = len(groups)
+        fixed = 0           # offset of the first group that does not start at a fixed position
+        fixed_known = True
+        field_pos = {}      # field name -> (absolute offset, type), fixed part only
+        for g in m["groups"]:
+            repeat = g["repeat"]
+            count, count_type = 0, "U1"
+            if repeat == "by_field":
+                pos = field_pos.get(g["field"])
+                if pos is None:
+                    repeat = "by_size"      # counted by a bitfield: let the length decide
+                else:
+                    count = pos[0]
+                    count_type = pos[1]
+            elif repeat == "by_const":
+                count = g["const"]
+            field_first = len(fields)
+            for f in g["fields"]:
+                bits_first = len(bits)
+                for b in f.get("bits", []):
+                    width = (b["mask"] >> b["shift"]).bit_length()
+                    bits.append((b["name"], b["shift"], width, b["type"] == "signed"))
+                fields.append((f["name"], f["offset"], f["type"], f["repeat"],
+                               f.get("reserved", 0), bits_first, len(bits) - bits_first))
+                if repeat == "once" and fixed_known:
+                    field_pos[f["name"]] = (fixed + f["offset"], f["type"])
+            groups.append((g["name"], g["size"], REPEATS[repeat], count, count_type,
+                           field_first, len(fields) - field_first))
+            if repeat == "once" and fixed_known:
+                fixed += g["size"]
+            else:
+                fixed_known = False
+        msgs.append(((m["classId"] << 8) | m["messageId"], m["messageName"], m["versionName"],
+                     group_first, len(groups) - group_first))
+
+    # names only, so that CFG-MSG and ACK can name any message
+    nmea_keys = set()
+    for m in sorted(nmea, key=lambda m: (m["classId"], m["messageId"])):
+        key = (m["classId"] << 8) | m["messageId"]
+        if key not in nmea_keys:
+            nmea_keys.add(key)
+            msgs.append((key, m["messageName"], "", 0, 0))
+    order = sorted(range(len(msgs)), key=lambda i: (msgs[i][0], i))
+    renum = {old: new for new, old in enumerate(order)}
+    msgs = [msgs[i] for i in order]
+    index = {k: renum[v] for k, v in index.items()}
+
+    rules, conds, vals = [], [], []
+    for label in sorted(variants):
+        if not label.startswith("UBX-"):
+            continue
+        out = []
+        flatten_variants(variants[label], [], out)
+        for cs, name in out:
+            msg = index.get((label, name))
+            if msg is None:
+                continue        # a variant not in the public message list
+            cond_first = len(conds)
+            for offset, typ, vs in cs:
+                conds.append((offset, 2 if typ == "U2" else 1, len(vals), len(vs)))
+                vals.extend(vs)
+            rules.append((msgs[msg][0], msg, cond_first, len(conds) - cond_first))
+    rules.sort(key=lambda r: r[0])      # stable: tree order within a class/id
+
+    print(HEADER.format(nmsg=len(msgs), nubx=len(ubx), nfield=len(fields), nbits=len(bits), nrule=len(rules)))
+    print("static const ubx_msgdb_class_t ubx_msgdb_classes[] = {")
+    for cls in sorted(classes):
+        print(f'    {{ 0x{cls:02X}, "{classes[cls]}" }},')
+    print("};\n")
+    print("static const ubx_msgdb_bits_t ubx_msgdb_bits[] = {")
+    for i, (name, shift, width, signed) in enumerate(bits):
+        print(f'    {{ "{name}", {shift}, {width}, {int(signed)} }},{"  // " + str(i) if i % 50 == 0 else ""}')
+    print("};\n")
+    print("static const ubx_msgdb_field_t ubx_msgdb_fields[] = {")
+    for i, (name, offset, typ, repeat, reserved, bf, bn) in enumerate(fields):
+        print(f'    {{ "{name}", {offset}, UBX_MSGDB_{typ}, {repeat}, {reserved}, {bf}, {bn} }},'
+              f'{"  // " + str(i) if i % 50 == 0 else ""}')
+    print("};\n")
+    print("static const ubx_msgdb_group_t ubx_msgdb_groups[] = {")
+    for i, (name, size, repeat, count, ctype, ff, fn) in enumerate(groups):
+        print(f'    {{ "{name}", {size}, UBX_MSGDB_{repeat}, {count}, UBX_MSGDB_{ctype}, {ff}, {fn} }},'
+              f'{"  // " + str(i) if i % 50 == 0 else ""}')
+    print("};\n")
+    print("static const ubx_msgdb_msg_t ubx_msgdb_msgs[] = {")
+    for i, (key, name, variant, gf, gn) in enumerate(msgs):
+        print(f'    {{ 0x{key:04X}, "{name}", "{variant}", {gf}, {gn} }},  // {i}')
+    print("};\n")
+    print("static const ubx_msgdb_cond_t ubx_msgdb_conds[] = {")
+    for offset, size, vf, vn in conds:
+        print(f"    {{ {offset}, {size}, {vf}, {vn} }},")
+    print("};\n")
+    print("static const uint16_t ubx_msgdb_vals[] = {")
+    for i in range(0, len(vals), 16):
+        print("    " + ", ".join(str(v) for v in vals[i:i + 16]) + ",")
+    print("};\n")
+    print("static const ubx_msgdb_rule_t ubx_msgdb_rules[] = {")
+    for key, msg, cf, cn in rules:
+        print(f"    {{ 0x{key:04X}, {msg}, {cf}, {cn} }},")
+    print("};\n")
+    print("#endif // UBX_MSGDB_TABLES_H")
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
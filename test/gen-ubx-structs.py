@@ -0,0 +1,290 @@
+#!/usr/bin/env python3
+################################################################################
+# gen-ubx-structs.py
+#
+# Purpose:
+#   Generate packed payload structs for every public UBX message from the
+#   u-center 2 message database (ucenter2-messages.json), one per variant:
+#     - ubx_<class>_<message>_<variant>_t    fixed part of the payload, with
+#                                            X fields as a union of the raw
+#                                            word and its bitfields
+#     - ubx_<...>_<group>_t                  each repeated block
+#     - UBX_PAYLOAD_SIZE() asserts           against the database's sizes
+#   and zero-cost macros for each variant:
+#     - UBX_<CLASS>_<MESSAGE>_<VARIANT>(payload)        typed view
+#     - UBX_<CLASS>_<MESSAGE>_<VARIANT>_SIZE            fixed part, bytes
+#     - UBX_<...>_<GROUP>(payload, i)                   i-th repeated block
+#     - UBX_<...>_<GROUP>_COUNT(payload, len)           number of blocks, never
+#                                                       more than fit in len
+#     - UBX_<CLASS>_<MESSAGE>_<VARIANT>_TYPED(name, (field, value)...)
+#                                                       frame constructor
+#                                                       (UBX_MESSAGE_TYPED)
+#   Variants that ubx_payload.h already defines by hand are left out, so
+#   the hand-written layouts and their users keep working unchanged.
+#
+# Usage:
+#   Run this script to output the header directly to stdout, which can
+#   then be redirected into a header file (e.g., ubx_structs.h).
+#
+# Example:
+#   $ ./gen-ubx-structs.py >../src/ubx_structs.h
+#   $ ./gen-ubx-structs.py --db ucenter2 --payload ../src/ubx_payload.h >../src/ubx_structs.h
+#
+# Copyright (C) 2025 Richard Elwell
+# Licensed under GPLv3 or later
+################################################################################
+
+import argparse
+import json
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+CTYPES = {"U1": "uint8_t", "U2": "uint16_t", "U4": "uint32_t",
+          "I1": "int8_t", "I2": "int16_t", "I4": "int32_t",
+          "X1": "uint8_t", "X2": "uint16_t", "X4": "uint32_t",
+          "R4": "float", "R8": "double", "CH": "char"}
+SIGNED = {"uint8_t": "int8_t", "uint16_t": "int16_t", "uint32_t": "int32_t"}
+SIZES = {"U1": 1, "U2": 2, "U4": 4, "I1": 1, "I2": 2, "I4": 4,
+         "X1": 1, "X2": 2, "X4": 4, "R4": 4, "R8": 8, "CH": 1}
+
+HEADER = """\
+#ifndef UBX_STRUCTS_H
+#define UBX_STRUCTS_H
+/*******************************************************************************
+ ubx_structs.h
+
+ Generated by test/gen-ubx-structs.py from test/ucenter2/ucenter2-messages.json,
+ do not edit.  Included by ubx_payload.h, which provides UBX_PAYLOAD_SIZE and
+ the hand-written structs of the {nhand} variants left out here.
+
+ {nstruct} payload structs ({nblock} of them repeated blocks) for {nvar} message variants.
+
+ Example:
+   const ubx_nav_sat_data0_t *sat = UBX_NAV_SAT_DATA0(payload);
+   for (unsigned i = 0; i < UBX_NAV_SAT_DATA0_SV_COUNT(payload, len); i++)
+       if (UBX_NAV_SAT_DATA0_SV(payload, i)->svUsed) ...
+
+   UBX_TIM_TP_DATA0_TYPED(tim_tp, (towMS, 1000), (week, 2380))
+
+ Copyright (C) 2025 Richard Elwell
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*******************************************************************************/
+"""
+
+def load(path):
+    # the database has a few Latin-1 characters in its descriptions
+    with open(path, encoding="latin-1") as f:
+        return json.load(f)
+
+def ident(s):
+    return re.sub(r"\W", "_", s)
+
+def dash(label):
+    return label.replace("_", "-")
+
+def field_comment(offset, f):
+    notes = [f.get("unit", "")]
+    if "scale" in f:
+        notes.append("*" + f["scale"])
+    notes = ", ".join(n for n in notes if n)
+    return f"// {offset}" + (f": {notes}" if notes else "")
+
+class Scope:
+    """Member names of one struct; anonymous unions put the bitfield names
+    in the same scope as the fields."""
+    def __init__(self, fields):
+        self.names = {f["name"] for f in fields}
+
+    def bit_name(self, field, bit):
+        for name in (bit, f"{field}_{bit}"):
+            if name not in self.names:
+                self.names.add(name)
+                return name
+        return None
+
+def emit_field(out, f, offset, scope, indent="    "):
+    ctype = CTYPES[f["type"]]
+    name = f["name"]
+    repeat = f.get("repeat", 1)
+    comment = field_comment(offset, f)
+    bits = f.get("bits", [])
+    if repeat != 1 or not bits or f["type"] in ("R4", "R8", "CH"):
+        dim = f"[{repeat}]" if repeat != 1 else ""
+        out.append(f"{indent}{ctype} {name}{dim};".ljust(40) + comment)
+        return
+    width = SIZES[f["type"]] * 8
+    out.append(f"{indent}union {{")
+    out.append(f"{indent}    {ctype} {name};".ljust(40) + comment)
+    out.append(f"{indent}    struct {{")
+    pos = 0
+    for b in sorted(bits, key=lambda b: b["shift"]):
+        w = (b["mask"] >> b["shift"]).bit_length()
+        if b["shift"] < pos or b["shift"] + w > width:
+            continue        # overlaps an earlier bitfield or does not fit
+        bname = scope.bit_name(name, b["name"])
+        if bname is None:
+            continue
+        if b["shift"] > pos:
+            out.append(f"{indent}        {ctype} : {b['shift'] - pos};")
+        btype = SIGNED[ctype] if b["type"] == "signed" else ctype
+        out.append(f"{indent}        {btype} {bname} : {w};".ljust(44) +
+                   f"// bit {b['shift']}" + (f"..{b['shift'] + w - 1}" if w > 1 else ""))
+        pos = b["shift"] + w
+    if pos < width:
+        out.append(f"{indent}        {ctype} : {width - pos};")
+    out.append(f"{indent}    }};")
+    out.append(f"{indent}}};")
+
+def emit_struct(out, tname, fields, comment, size, tail=None):
+    scope = Scope(fields)
+    out.append(f"// {comment}")
+    out.append("typedef struct __attribute__((packed)) {")
+    pos = 0
+    for f in sorted(fields, key=lambda f: f["offset"]):
+        if f["offset"] != pos:
+            sys.exit(f"{tname}: {f['name']} at offset {f['offset']}, expected {pos}")
+        if f["type"] is None:
+            out.append(f"    {f['block']} {f['name']}[{f['repeat']}];".ljust(40) + f"// {f['offset']}")
+            pos += f["size"] * f["repeat"]
+            continue
+        emit_field(out, f, f["offset"], scope)
+        pos += SIZES[f["type"]] * f.get("repeat", 1)
+    if pos != size:
+        sys.exit(f"{tname}: fields add up to {pos} bytes, the database says {size}")
+    if tail and fields and tail[1] not in scope.names:
+        # a flexible array member needs a named member before it
+        out.append(f"    {tail[0]} {tail[1]}[];".ljust(40) + f"// {pos}: repeated")
+    out.append(f"}} {tname};")
+    out.append(f"UBX_PAYLOAD_SIZE({tname}, {size});")
+    out.append("")
+
+def gen_variant(m, out, stats):
+    label = f"{m['className']}_{m['messageName']}_{m['versionName']}"
+    tname = f"ubx_{ident(label).lower()}_t"
+    macro = f"UBX_{ident(label).upper()}"
+    cls, mid = m["classId"], m["messageId"]
+
+    # the fixed part: groups at a known offset, up to the first one whose
+    # length depends on the payload
+    fixed, pos, desc = [], 0, []
+    groups = list(m["groups"])
+    var = None
+    while groups:
+        g = groups[0]
+        if g["repeat"] in ("once", "optional"):
+            for f in g["fields"]:
+                fixed.append(dict(f, offset=pos + f["offset"]))
+            desc.append(f"{g['size']}" + (" optional" if g["repeat"] == "optional" else ""))
+        elif g["repeat"] == "by_const":
+            fixed.append({"name": g["name"], "offset": pos, "type": None,
+                          "block": f"ubx_{ident(label + '_' + g['name']).lower()}_t",
+                          "repeat": g["const"], "size": g["size"]})
+            desc.append(f"{g['const']}*{g['size']}")
+        else:
+            var = (g, pos)
+            break
+        pos += g["size"] * (g["const"] if g["repeat"] == "by_const" else 1)
+        groups.pop(0)
+
+    if var:
+        g = var[0]
+        desc.append(f"{g['field'] if g['repeat'] == 'by_field' else 'n'}*{g['size']}")
+    size = pos
+
+    out.append("////////////////////////////////////////////////////////////////////////////////")
+    out.append("")
+    # repeated blocks, and groups that follow one (no fixed offset)
+    blocks = {}
+    for g in m["groups"]:
+        if g["repeat"] not in ("once", "optional") or any(g is r for r in groups):
+            bname = f"ubx_{ident(label + '_' + g['name']).lower()}_t"
+            emit_struct(out, bname, g["fields"], f"UBX-{dash(label)} {g['name']} ({g['size']} bytes)", g["size"])
+            blocks[g["name"]] = bname
+            stats["block"] += 1
+
+    tail = (blocks[var[0]["name"]], var[0]["name"]) if var else None
+    emit_struct(out, tname, fixed, f"UBX-{dash(label)} payload ({' + '.join(desc) or '0'} bytes)", size, tail)
+    stats["struct"] += 1
+
+    out.append(f"#define {macro}(payload)".ljust(48) + f"((const {tname} *)(payload))")
+    out.append(f"#define {macro}_SIZE".ljust(48) + f"{size}")
+    if var:
+        g, off = var
+        bname = blocks[g['name']]
+        gm = f"{macro}_{ident(g['name']).upper()}"
+        out.append(f"#define {gm}(payload, i)".ljust(48) +
+                   f"((const {bname} *)((const uint8_t *)(payload) + {off} + (size_t)(i) * {g['size']}))")
+        fit = f"((size_t)(len) - {off}) / {g['size']}"
+        if g["repeat"] == "by_field" and any(f["name"] == g["field"] and f["type"] for f in fixed):
+            # the count field, but no more blocks than the payload holds
+            field = f"(size_t){macro}(payload)->{g['field']}"
+            out.append(f"#define {gm}_COUNT(payload, len)".ljust(47) + " \\")
+            out.append(f"    ((size_t)(len) <= {off} ? 0 : {field} < {fit} ? {field} : {fit})")
+        else:
+            out.append(f"#define {gm}_COUNT(payload, len)".ljust(48) +
+                       f"((size_t)(len) > {off} ? {fit} : 0)")
+    else:
+        out.append(f"#define {macro}_TYPED(name, ...)".ljust(48) +
+                   f"UBX_MESSAGE_TYPED(name, 0x{cls:02X}, 0x{mid:02X}, {tname}, __VA_ARGS__)")
+    out.append("")
+
+def hand_written(path):
+    with open(path) as f:
+        return set(re.findall(r"^}\s*(\w+_t);", f.read(), re.M))
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("--db", default=os.path.join(HERE, "ucenter2"))
+    ap.add_argument("--payload", default=os.path.join(HERE, "..", "src", "ubx_payload.h"),
+                    help="hand-written structs, whose variants are left out")
+    a = ap.parse_args()
+
+    messages = load(os.path.join(a.db, "ucenter2-messages.json"))["messages"]
+    ubx = [m for m in messages.values() if m["protocolName"] == "UBX" and m["audience"] == "PUB"]
+    ubx.sort(key=lambda m: (m["classId"], m["messageId"], m["versionId"], m["versionName"]))
+    hand = hand_written(a.payload)
+
+    out, skipped = [], []
+    stats = {"struct": 0, "block": 0}
+    for m in ubx:
+        label = f"{m['className']}_{m['messageName']}_{m['versionName']}"
+        if f"ubx_{ident(label).lower()}_t" in hand:
+            skipped.append(label)
+            continue
+        gen_variant(m, out, stats)
+
+    print(HEADER.format(nhand=len(skipped), nstruct=stats["struct"] + stats["block"],
+                        nblock=stats["block"], nvar=stats["struct"]))
+    print("#include <stddef.h>")
+    print("#include <stdint.h>")
+    print()
+    print("#pragma pack(push, 1)")
+    print()
+    print("// Defined in ubx_payload.h:")
+    for i in range(0, len(skipped), 4):
+        print("//   " + ", ".join(f"UBX-{s.replace('_', '-')}" for s in skipped[i:i + 4]))
+    print()
+    print("\n".join(out))
+    print("#pragma pack(pop)")
+    print()
+    print("#endif // UBX_STRUCTS_H")
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
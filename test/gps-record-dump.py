@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+################################################################################
+# gps-record-dump.py
+#
+# Purpose:
+#   Read a capture written by ntpgps-shm-writer --record FILE (format in
+#   src/gps_record.h). Lists one line per read() chunk: its CLOCK_MONOTONIC
+#   time relative to the start of the file, its CLOCK_REALTIME time, the
+#   gap to the previous chunk and the start of the bytes. With --raw, the
+#   bytes alone are written to stdout, as the receiver sent them. A file
+#   still being written is read up to its last complete record.
+#
+# Usage:
+#   ./gps-record-dump.py [--raw] [--hex] FILE [FILE ...]
+#
+# Example:
+#   $ ./gps-record-dump.py /var/tmp/gps.rec.1 /var/tmp/gps.rec
+#   $ ./gps-record-dump.py --raw /var/tmp/gps.rec >gps.raw
+#
+# Copyright (C) 2025 Richard Elwell
+# Licensed under GPLv3 or later
+################################################################################
+
+import argparse
+import struct
+import sys
+import time
+
+MAGIC = 0x4e475243      # "NGRC"
+FILE_HDR = struct.Struct("<IHHQQQ32s")
+REC_HDR = struct.Struct("<IIQQ")
+
+def records(path):
+    """Yield (file header dict, None) once, then (mono_ns, real_ns, data)."""
+    with open(path, "rb") as f:
+        buf = f.read()
+    if len(buf) < FILE_HDR.size:
+        raise ValueError(f"{path}: too short")
+    magic, version, hdr_size, size, mono, real, dev = FILE_HDR.unpack_from(buf)
+    if magic != MAGIC:
+        raise ValueError(f"{path}: not a gps record file")
+    if version != 1:
+        raise ValueError(f"{path}: unsupported version {version}")
+    yield {"size": size, "start_mono_ns": mono, "start_real_ns": real,
+           "device": dev.split(b"\0", 1)[0].decode(errors="replace")}, None, None
+    pos = hdr_size
+    while pos + REC_HDR.size <= len(buf):
+        n, _flags, mono_ns, real_ns = REC_HDR.unpack_from(buf, pos)
+        pos += REC_HDR.size
+        if n == 0 or pos + n > len(buf):
+            break
+        yield mono_ns, real_ns, buf[pos:pos + n]
+        pos += (n + 7) & ~7
+
+def preview(data, width, as_hex):
+    n = width // 3 if as_hex else width
+    if as_hex:
+        s = data[:n].hex(" ")
+    else:
+        s = "".join(chr(b) if 0x20 <= b < 0x7f else "." for b in data[:n])
+    return s + (" ..." if len(data) > n else "")
+
+def main():
+    ap = argparse.ArgumentParser(description="List or extract a --record capture")
+    ap.add_argument("files", nargs="+", metavar="FILE")
+    ap.add_argument("--raw", action="store_true", help="write the captured bytes to stdout")
+    ap.add_argument("--hex", action="store_true", help="preview bytes in hex instead of ASCII")
+    a = ap.parse_args()
+
+    out = sys.stdout.buffer
+    for path in a.files:
+        try:
+            it = records(path)
+            hdr, _, _ = next(it)
+            if not a.raw:
+                t = time.strftime("%Y-%m-%d %H:%M:%S", time.gmtime(hdr["start_real_ns"] // 10**9))
+                print(f"# {path}: device {hdr['device']}, started {t} UTC, {hdr['size']} bytes")
+                print(f"# {'mono s':>12} {'realtime UTC':>18} {'gap ms':>9} {'len':>5}  data")
+            nrec = nbytes = 0
+            prev = None
+            for mono_ns, real_ns, data in it:
+                nrec += 1
+                nbytes += len(data)
+                if a.raw:
+                    out.write(data)
+                    continue
+                rt = time.strftime("%H:%M:%S", time.gmtime(real_ns // 10**9))
+                gap = "" if prev is None else f"{(mono_ns - prev) / 1e6:9.3f}"
+                prev = mono_ns
+                print(f"{(mono_ns - hdr['start_mono_ns']) / 1e9:14.6f} {rt}.{real_ns % 10**9:09d}"
+                      f" {gap:>9} {len(data):5d}  {preview(data, 48, a.hex)}")
+            if not a.raw:
+                print(f"# {nrec} reads, {nbytes} bytes")
+        except (OSError, ValueError) as e:
+            print(e, file=sys.stderr)
+            return 1
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+################################################################################
+# replay-check.py
+#
+# Purpose:
+#   Run every capture in test/replay/ (NAME.rec, written by --record)
+#   through ntpgps-shm-writer --replay and diff the SHM writes it lists
+#   against the known good listing NAME.txt next to it. Exits non-zero on
+#   any difference. With --update the listings are rewritten instead,
+#   after a change to the output that was checked by hand.
+#
+#   rmc-zda.rec holds 12 s of RMC+ZDA across the 2025/2026 year change,
+#   with two void RMC fixes and one read that splits a sentence.
+#
+# Usage:
+#   ./replay-check.py [--update] WRITER [DIR]
+#
+# Example:
+#   $ gcc -std=c11 -O2 -Wall src/ntpgps-shm-writer.c -o /tmp/w -latomic -pthread -lm
+#   $ test/replay-check.py /tmp/w
+#
+# Copyright (C) 2025 Richard Elwell
+# Licensed under GPLv3 or later
+################################################################################
+
+import argparse
+import difflib
+import pathlib
+import subprocess
+import sys
+
+def main():
+    ap = argparse.ArgumentParser(description="Diff --replay listings against known good ones")
+    ap.add_argument("writer", help="ntpgps-shm-writer binary")
+    ap.add_argument("dir", nargs="?", default=pathlib.Path(__file__).parent / "replay")
+    ap.add_argument("--update", action="store_true", help="rewrite the .txt listings")
+    a = ap.parse_args()
+
+    caps = sorted(pathlib.Path(a.dir).glob("*.rec"))
+    if not caps:
+        print(f"no captures in {a.dir}", file=sys.stderr)
+        return 1
+    failed = 0
+    for rec in caps:
+        golden = rec.with_suffix(".txt")
+        run = subprocess.run([a.writer, "--replay", str(rec)], capture_output=True, text=True)
+        if run.returncode != 0:
+            print(f"FAIL {rec.name}: exit {run.returncode}\n{run.stderr}", end="")
+            failed += 1
+            continue
+        if a.update:
+            golden.write_text(run.stdout)
+            print(f"updated {golden.name}")
+            continue
+        want = golden.read_text().splitlines(keepends=True)
+        diff = list(difflib.unified_diff(want, run.stdout.splitlines(keepends=True),
+                                         str(golden), f"{rec.name} replayed"))
+        if diff:
+            sys.stdout.writelines(diff)
+            print(f"FAIL {rec.name}")
+            failed += 1
+        else:
+            print(f"ok   {rec.name}")
+    return 1 if failed else 0
+
+if __name__ == "__main__":
+    sys.exit(main())
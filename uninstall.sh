@@ -142,6 +142,8 @@ files=(
     /etc/ntpgps/template/keys.conf
     /etc/ntpgps/template/ntpgps.conf
     /etc/ntpgps/template/99-ntpgps-usb.rules
+    /etc/ntpgps/profiles/zda-only.profile
+    /etc/ntpgps/profiles/nmea-default.profile
     /etc/udev/rules.d/99-ntpgps-usb.rules
     /etc/modules-load.d/ntpgps-pps.conf
     /etc/systemd/system/ntpgps-configure@.service